@@ -38,6 +38,7 @@ using namespace OpenSim;
 using namespace std;
 
 void testThoracoscapularShoulderModel();
+void testSolveTrajectory();
 void testBallJoint();
 
 int main()
@@ -72,6 +73,9 @@ int main()
 
         testThoracoscapularShoulderModel();
         cout << "testThoracoscapularShoulderModel passed" << endl;
+
+        testSolveTrajectory();
+        cout << "testSolveTrajectory passed" << endl;
         // Commented out testBallJoint due to sporadic crash in Model destructor
         // -Ayman 03/21
         //testBallJoint();
@@ -138,6 +142,56 @@ void testThoracoscapularShoulderModel() {
         "testThoracoscapularShoulderModel failed");
 }
 
+void testSolveTrajectory() {
+    // The batched trajectory solve must reproduce the frame-at-a-time solve
+    // for the same (q, u, udot) inputs.
+    Model model("arm26.osim");
+    SimTK::State& s = model.initSystem();
+    const int nq = model.getNumCoordinates();
+    const int nu = model.getNumSpeeds();
+
+    const int nt = 25;
+    const double dt = 0.01;
+    std::vector<double> times(nt);
+    SimTK::Matrix q(nt, nq), u(nt, nu), udot(nt, nu);
+    for (int i = 0; i < nt; ++i) {
+        times[i] = i*dt;
+        for (int j = 0; j < nq; ++j) {
+            q[i][j] = 0.1*sin(times[i] + j);
+            u[i][j] = 0.1*cos(times[i] + j);
+            udot[i][j] = -0.1*sin(times[i] + j);
+        }
+    }
+
+    InverseDynamicsSolver idSolver(model);
+
+    // frame-at-a-time reference solution
+    SimTK::Matrix expected(nt, nu);
+    for (int i = 0; i < nt; ++i) {
+        s.updTime() = times[i];
+        s.updQ() = ~q.row(i);
+        s.updU() = ~u.row(i);
+        SimTK::Vector udotFrame = ~udot.row(i);
+        expected.updRow(i) = ~idSolver.solve(s, udotFrame);
+    }
+
+    TimeSeriesTable genForcesTable;
+    idSolver.solveTrajectory(times, q, u, udot, genForcesTable);
+
+    ASSERT(int(genForcesTable.getNumRows()) == nt, __FILE__, __LINE__,
+        "testSolveTrajectory: wrong number of rows");
+    ASSERT(int(genForcesTable.getNumColumns()) == nu, __FILE__, __LINE__,
+        "testSolveTrajectory: wrong number of columns");
+
+    for (int i = 0; i < nt; ++i) {
+        const auto& row = genForcesTable.getRowAtIndex(i);
+        for (int j = 0; j < nu; ++j) {
+            ASSERT_EQUAL(expected[i][j], row[j], 1e-10, __FILE__, __LINE__,
+                "testSolveTrajectory: generalized force mismatch");
+        }
+    }
+}
+
 void testBallJoint() {
     Model mdl;
     Body* bdy = new Body("body", 1.0, SimTK::Vec3(0), SimTK::Inertia(1));
@@ -30,6 +30,7 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/OrientationsReference.h>
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Tools/InverseKinematicsBatch.h>
 #include <OpenSim/Tools/InverseKinematicsTool.h>
 #include <OpenSim/Tools/IKTaskSet.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
@@ -89,6 +90,23 @@ int main()
         failures.push_back("testInverseKinematicsGait2354");
     }
 
+    try {
+        InverseKinematicsTool ikp("subject01_Setup_InverseKinematics.xml");
+        // Solve the same trial in parallel windows and verify the solution
+        // still matches the sequential standard to the same tolerance.
+        ikp.set_parallel_threads(4);
+        ikp.run();
+        Storage resultp(ikp.getOutputMotionFileName());
+        CHECK_STORAGE_AGAINST_STANDARD(resultp, standard,
+            std::vector<double>(24, 0.2), __FILE__, __LINE__,
+            "testInverseKinematicsGait2354 parallel windows failed");
+        cout << "testInverseKinematicsGait2354 parallel windows passed" << endl;
+    }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testInverseKinematicsGait2354_parallel_windows");
+    }
+
     try {
         InverseKinematicsTool ik2("subject01_Setup_InverseKinematics_NoModel.xml");
         Model mdl("subject01_simbody.osim");
@@ -106,6 +124,32 @@ int main()
         failures.push_back("testInverseKinematicsGait2354_GUI_workflow");
     }
 
+    try {
+        // Batch the same trial twice against the shared model; each result
+        // must match the sequential standard.
+        InverseKinematicsTool prototype("subject01_Setup_InverseKinematics.xml");
+        InverseKinematicsBatch batch(prototype);
+        batch.addTrial("subject01_synthetic_marker_data.trc",
+                       "subject01_walk1_batch0_ik.mot");
+        batch.addTrial("subject01_synthetic_marker_data.trc",
+                       "subject01_walk1_batch1_ik.mot");
+        int numSolved = batch.run(2);
+        ASSERT(numSolved == 2, __FILE__, __LINE__,
+            "testInverseKinematicsBatch failed to solve all trials");
+        for (int t = 0; t < 2; ++t) {
+            Storage result("subject01_walk1_batch" + std::to_string(t) +
+                           "_ik.mot");
+            CHECK_STORAGE_AGAINST_STANDARD(result, standard,
+                std::vector<double>(24, 0.2), __FILE__, __LINE__,
+                "testInverseKinematicsBatch failed");
+        }
+        cout << "testInverseKinematicsBatch passed" << endl;
+    }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testInverseKinematicsBatch");
+    }
+
     try {
         InverseKinematicsTool ik3("constraintTest_setup_ik.xml");
         ik3.run();
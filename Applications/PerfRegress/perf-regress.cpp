@@ -0,0 +1,368 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  perf-regress.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// A performance-regression harness: run a configured set of tool workflows
+// (IK, ID, SO, CMC, Moco -- anything opensim-cmd run-tool accepts) against
+// two installed versions of OpenSim, time each run repeatedly, and report
+// the timing deltas along with whether the tools' result files still agree.
+// This replaces the external comparison script that had to be patched on
+// every release.
+//
+// The configuration file lists one workflow per line:
+//
+//     # name      setup file             result file (optional)
+//     workflow ik_gait   ik_setup.xml    ik_output.mot
+//     workflow cmc_gait  cmc_setup.xml
+//
+// Each workflow is executed as `<bin>/opensim-cmd run-tool <setup>` from the
+// current directory with the bin directory of version A and of version B in
+// turn, so the setup files and their data are shared by both versions. When
+// a result file is named, the copy produced by each version's final
+// repetition is kept (suffixed _A/_B) and the two are compared numerically.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <OpenSim/version.h>
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Storage.h>
+
+using namespace OpenSim;
+using namespace std;
+
+static void PrintUsage(const char* aProgName, ostream& aOStream);
+
+namespace {
+
+struct Workflow {
+    std::string name;
+    std::string setupFile;
+    std::string resultFile;  // empty when no output comparison is wanted
+};
+
+struct TimingStats {
+    double median = SimTK::NaN;
+    double medianAbsDeviation = SimTK::NaN;
+    double minimum = SimTK::NaN;
+    int failures = 0;
+};
+
+std::vector<Workflow> readConfiguration(const std::string& fileName)
+{
+    std::ifstream file(fileName);
+    if (!file.good()) {
+        cout << "perf-regress: cannot open configuration file '"
+             << fileName << "'." << endl;
+        exit(-1);
+    }
+    std::vector<Workflow> workflows;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream tokens(line);
+        std::string keyword;
+        if (!(tokens >> keyword) || keyword[0] == '#')
+            continue;
+        if (keyword != "workflow") {
+            cout << "perf-regress: unrecognized keyword '" << keyword
+                 << "' in '" << fileName << "'." << endl;
+            exit(-1);
+        }
+        Workflow workflow;
+        tokens >> workflow.name >> workflow.setupFile;
+        tokens >> workflow.resultFile;  // optional; stays empty if absent
+        if (workflow.name.empty() || workflow.setupFile.empty()) {
+            cout << "perf-regress: malformed workflow line in '"
+                 << fileName << "': " << line << endl;
+            exit(-1);
+        }
+        workflows.push_back(workflow);
+    }
+    return workflows;
+}
+
+double median(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    const size_t n = samples.size();
+    return (n % 2 == 1) ? samples[n/2]
+                        : 0.5*(samples[n/2 - 1] + samples[n/2]);
+}
+
+// Run one workflow `repeats` times (after `warmup` discarded runs) with the
+// given installation and collect robust timing statistics.
+TimingStats timeWorkflow(const Workflow& workflow, const std::string& binDir,
+        int repeats, int warmup)
+{
+    const std::string command = "\"" + binDir + "/opensim-cmd\" run-tool \"" +
+        workflow.setupFile + "\" > " + (
+#ifdef _WIN32
+        std::string("NUL")
+#else
+        std::string("/dev/null")
+#endif
+        ) + " 2>&1";
+
+    TimingStats stats;
+    std::vector<double> samples;
+    for (int run = 0; run < warmup + repeats; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        const int exitCode = std::system(command.c_str());
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        if (exitCode != 0) {
+            ++stats.failures;
+            continue;
+        }
+        if (run >= warmup)
+            samples.push_back(seconds);
+    }
+    if (samples.empty())
+        return stats;
+
+    stats.median = median(samples);
+    std::vector<double> deviations(samples.size());
+    for (size_t i = 0; i < samples.size(); ++i)
+        deviations[i] = std::abs(samples[i] - stats.median);
+    stats.medianAbsDeviation = median(deviations);
+    stats.minimum = *std::min_element(samples.begin(), samples.end());
+    return stats;
+}
+
+// Largest absolute difference between two result files over their shared
+// columns and rows; NaN when either file cannot be read or they have no
+// columns in common.
+double compareResults(const std::string& fileA, const std::string& fileB)
+{
+    std::unique_ptr<Storage> a, b;
+    try {
+        a.reset(new Storage(fileA));
+        b.reset(new Storage(fileB));
+    } catch (const std::exception& e) {
+        cout << "perf-regress: could not read results for comparison: "
+             << e.what() << endl;
+        return SimTK::NaN;
+    }
+
+    const Array<std::string>& labels = a->getColumnLabels();
+    double maxDifference = -SimTK::Infinity;
+    // Skip labels[0] ("time"); rows are matched by index, which assumes the
+    // two versions report on the same time grid.
+    for (int c = 1; c < labels.getSize(); ++c) {
+        Array<double> columnA, columnB;
+        try {
+            a->getDataColumn(labels[c], columnA);
+            b->getDataColumn(labels[c], columnB);
+        } catch (const std::exception&) {
+            continue;  // column missing from B; reported via row/col counts
+        }
+        const int numRows = std::min(columnA.getSize(), columnB.getSize());
+        for (int r = 0; r < numRows; ++r)
+            maxDifference =
+                std::max(maxDifference, std::abs(columnA[r] - columnB[r]));
+    }
+    return (maxDifference < 0) ? SimTK::NaN : maxDifference;
+}
+
+// Keep the result file a version's run just produced out of the way of the
+// other version's run.
+std::string stashResultFile(const std::string& resultFile,
+        const std::string& suffix)
+{
+    const std::string stashed = resultFile + suffix;
+    std::remove(stashed.c_str());
+    std::rename(resultFile.c_str(), stashed.c_str());
+    return stashed;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string binDirA, binDirB, configFile, reportFile;
+    int repeats = 5;
+    int warmup = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "-h" || option == "-Help" || option == "-H") {
+            PrintUsage(argv[0], cout);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            cout << "perf-regress: option " << option
+                 << " requires an argument." << endl;
+            PrintUsage(argv[0], cout);
+            return -1;
+        }
+        const std::string value = argv[++i];
+        if (option == "-A") binDirA = value;
+        else if (option == "-B") binDirB = value;
+        else if (option == "-C") configFile = value;
+        else if (option == "-O") reportFile = value;
+        else if (option == "-R") repeats = atoi(value.c_str());
+        else if (option == "-W") warmup = atoi(value.c_str());
+        else {
+            cout << "perf-regress: unrecognized option " << option << endl;
+            PrintUsage(argv[0], cout);
+            return -1;
+        }
+    }
+    if (binDirA.empty() || binDirB.empty() || configFile.empty()) {
+        PrintUsage(argv[0], cout);
+        return -1;
+    }
+    if (repeats < 1 || warmup < 0) {
+        cout << "perf-regress: -R must be at least 1 and -W nonnegative."
+             << endl;
+        return -1;
+    }
+
+    const std::vector<Workflow> workflows = readConfiguration(configFile);
+    if (workflows.empty()) {
+        cout << "perf-regress: '" << configFile
+             << "' configures no workflows." << endl;
+        return -1;
+    }
+
+    std::ofstream report;
+    if (!reportFile.empty()) {
+        report.open(reportFile);
+        if (!report.good()) {
+            cout << "perf-regress: cannot write report to '" << reportFile
+                 << "'." << endl;
+            return -1;
+        }
+    }
+
+    cout << "perf-regress (" << GetVersionAndDate() << ")" << endl;
+    cout << "A = " << binDirA << endl;
+    cout << "B = " << binDirB << endl;
+    cout << repeats << " timed repetition(s) per version, " << warmup
+         << " warm-up run(s) discarded." << endl << endl;
+
+    int regressions = 0;
+    int brokenWorkflows = 0;
+    for (const Workflow& workflow : workflows) {
+        cout << "[" << workflow.name << "] " << workflow.setupFile << endl;
+
+        const TimingStats statsA =
+            timeWorkflow(workflow, binDirA, repeats, warmup);
+        std::string resultA;
+        if (!workflow.resultFile.empty())
+            resultA = stashResultFile(workflow.resultFile, "_A");
+
+        const TimingStats statsB =
+            timeWorkflow(workflow, binDirB, repeats, warmup);
+        std::string resultB;
+        if (!workflow.resultFile.empty())
+            resultB = stashResultFile(workflow.resultFile, "_B");
+
+        if (statsA.failures > 0 || statsB.failures > 0)
+            cout << "  failed runs: A=" << statsA.failures << " B="
+                 << statsB.failures << endl;
+        if (SimTK::isNaN(statsA.median) || SimTK::isNaN(statsB.median)) {
+            cout << "  no successful timed runs; skipping comparison."
+                 << endl;
+            ++brokenWorkflows;
+            continue;
+        }
+
+        const double deltaSeconds = statsB.median - statsA.median;
+        const double deltaPercent = 100.0*deltaSeconds/statsA.median;
+        // A delta is only meaningful once it clears the run-to-run noise;
+        // use the larger of the two versions' spreads as the yardstick.
+        const double noise = 3.0*std::max(statsA.medianAbsDeviation,
+                                          statsB.medianAbsDeviation);
+        const bool significant = std::abs(deltaSeconds) > noise;
+        if (significant && deltaSeconds > 0)
+            ++regressions;
+
+        cout << "  median A=" << statsA.median << " s (min "
+             << statsA.minimum << " s), B=" << statsB.median << " s (min "
+             << statsB.minimum << " s)" << endl;
+        cout << "  delta " << (deltaSeconds >= 0 ? "+" : "") << deltaPercent
+             << "% ("
+             << (significant ? (deltaSeconds > 0 ? "slower" : "faster")
+                             : "within noise")
+             << ")" << endl;
+
+        double maxDifference = SimTK::NaN;
+        if (!workflow.resultFile.empty()) {
+            maxDifference = compareResults(resultA, resultB);
+            if (SimTK::isNaN(maxDifference))
+                cout << "  results: not comparable" << endl;
+            else
+                cout << "  results: max column difference = "
+                     << maxDifference << endl;
+        }
+
+        if (report.good())
+            report << "workflow=" << workflow.name
+                   << " median_a_s=" << statsA.median
+                   << " median_b_s=" << statsB.median
+                   << " mad_a_s=" << statsA.medianAbsDeviation
+                   << " mad_b_s=" << statsB.medianAbsDeviation
+                   << " delta_pct=" << deltaPercent
+                   << " significant=" << (significant ? 1 : 0)
+                   << " failures_a=" << statsA.failures
+                   << " failures_b=" << statsB.failures
+                   << " max_result_diff=" << maxDifference
+                   << "\n";
+        cout << endl;
+    }
+
+    cout << regressions << " significant regression(s), " << brokenWorkflows
+         << " broken workflow(s) across " << workflows.size()
+         << " workflow(s)." << endl;
+
+    // Nonzero exit so CI can gate on the harness directly.
+    return (regressions > 0 || brokenWorkflows > 0) ? 1 : 0;
+}
+
+//_____________________________________________________________________________
+/**
+ * Print the usage for this application.
+ */
+static void PrintUsage(const char* aProgName, ostream& aOStream)
+{
+    string progName = IO::GetFileNameFromURI(aProgName);
+    aOStream << "\n\n" << progName << ":\n"
+             << GetVersionAndDate() << "\n\n";
+    aOStream << "Option              Argument          Action / Notes\n";
+    aOStream << "------              --------          --------------\n";
+    aOStream << "-A                  BinDirA           Bin directory of the baseline installation (required).\n";
+    aOStream << "-B                  BinDirB           Bin directory of the candidate installation (required).\n";
+    aOStream << "-C                  ConfigFile        Workflow configuration file (required).\n";
+    aOStream << "-R                  Repeats           Timed repetitions per version (default 5).\n";
+    aOStream << "-W                  Warmup            Discarded warm-up runs per version (default 1).\n";
+    aOStream << "-O                  ReportFile        Also write a machine-readable key=value report.\n";
+    aOStream << "-H                                    Print this help.\n";
+}
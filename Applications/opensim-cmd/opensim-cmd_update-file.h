@@ -23,11 +23,19 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <docopt.h>
 #include "parse_arguments.h"
 
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/XMLDocument.h>
+
 static const char HELP_UPDATE_FILE[] =
 R"(Update an .osim, .xml (e.g., setup) or .sto file to this version's format.
 
@@ -38,6 +46,7 @@ Usage:
 Options:
   -L <path>, --library <path>  Load a plugin.
   -o <level>, --log <level>  Logging level.
+  -j <num>, --jobs <num>  Number of worker threads for directory conversion.
 
 Description:
   In an OpenSim XML file, the XML file format version appears as
@@ -45,22 +54,35 @@ Description:
   version number is generally not the same as the OpenSim software version
   number.
 
+  A file that is already at the latest format is copied to the output
+  unchanged, without running the format migration machinery.
+
+  When <input-file> is a directory, every .osim, .xml and .sto file directly
+  inside it is updated into the directory <output-file> (created if needed),
+  on parallel worker threads (--jobs; default: the hardware concurrency).
+  Files that fail to convert are reported and skipped, and the command then
+  exits with a non-zero status.
+
 Examples:
   opensim-cmd update-file lowerlimb_v3.3.osim lowerlimb_updated.osim
   opensim-cmd update-file RRA_taskset_v3.3.xml RRA_taskset_updated.osim
   opensim-cmd update-file data_v3.3.sto data_updated.sto
+  opensim-cmd update-file -j 8 archive_v3.3/ archive_updated/
 )";
 
-int update_file(int argc, const char** argv) {
+static void copy_file_bytes(const std::string& inputFile,
+                            const std::string& outputFile) {
+    std::ifstream src(inputFile, std::ios::binary);
+    std::ofstream dst(outputFile, std::ios::binary);
+    dst << src.rdbuf();
+}
 
-    using namespace OpenSim;
+// Update a single file, dispatching on its extension. Files already at the
+// latest format are copied without being parsed. Throws on failure.
+static void update_single_file(const std::string& inputFile,
+                               const std::string& outputFile) {
 
-    std::map<std::string, docopt::value> args = OpenSim::parse_arguments(
-            HELP_UPDATE_FILE, { argv + 1, argv + argc },
-            true); // show help if requested
-
-    const std::string inputFile = args["<input-file>"].asString();
-    const std::string outputFile = args["<output-file>"].asString();
+    using namespace OpenSim;
 
     // Grab the file extension.
     std::string::size_type extSep = inputFile.rfind(".");
@@ -72,6 +94,21 @@ int update_file(int argc, const char** argv) {
 
     // .osim or .xml file.
     if (extension == ".osim" || extension == ".xml") {
+        // Current files need no migration; move their bytes, not a DOM.
+        if (XMLDocument::sniffDocumentVersion(inputFile) ==
+                XMLDocument::getLatestVersion()) {
+            if (inputFile == outputFile) {
+                log_info("File '{}' is already at the latest format; "
+                         "nothing to do.", inputFile);
+            } else {
+                log_info("File '{}' is already at the latest format; "
+                         "copying it unchanged to '{}'.",
+                        inputFile, outputFile);
+                copy_file_bytes(inputFile, outputFile);
+            }
+            return;
+        }
+
         log_info("Loading input file '{}'.", inputFile);
         const auto* obj = Object::makeObjectFromFile(inputFile);
         if (!obj) {
@@ -81,21 +118,87 @@ int update_file(int argc, const char** argv) {
         }
         log_info("Printing updated file to '{}'.", outputFile);
         obj->print(outputFile);
-        return EXIT_SUCCESS;
+        return;
     }
 
     // .sto file.
     if (extension == ".sto") {
         log_info("Loading input file '{}'.", inputFile);
-        Storage stg(inputFile);
+        OpenSim::Storage stg(inputFile);
         log_info("Printing updated file to '{}'.", outputFile);
         stg.print(outputFile);
-        return EXIT_SUCCESS;
+        return;
     }
 
     throw Exception(
             "Input file '" + inputFile + "' has an unrecognized extension.");
 }
 
+int update_file(int argc, const char** argv) {
+
+    using namespace OpenSim;
+
+    std::map<std::string, docopt::value> args = OpenSim::parse_arguments(
+            HELP_UPDATE_FILE, { argv + 1, argv + argc },
+            true); // show help if requested
+
+    const std::string inputFile = args["<input-file>"].asString();
+    const std::string outputFile = args["<output-file>"].asString();
+
+    // Directory: batch-convert its files on worker threads.
+    if (IO::isDirectory(inputFile)) {
+        if (!IO::isDirectory(outputFile) && IO::makeDir(outputFile) != 0) {
+            throw Exception("Could not create output directory '" +
+                            outputFile + "'.");
+        }
+
+        std::vector<std::string> files;
+        for (const auto& name : IO::getFilesInDirectory(inputFile)) {
+            const std::string::size_type extSep = name.rfind(".");
+            if (extSep == std::string::npos) continue;
+            const std::string extension = name.substr(extSep);
+            if (extension == ".osim" || extension == ".xml" ||
+                    extension == ".sto")
+                files.push_back(name);
+        }
+        log_info("Updating {} files from '{}' into '{}'.",
+                files.size(), inputFile, outputFile);
+
+        int numThreads = 0;
+        if (args["--jobs"]) numThreads = (int)args["--jobs"].asLong();
+        if (numThreads <= 0)
+            numThreads = (int)std::thread::hardware_concurrency();
+        numThreads = std::max(1, std::min(numThreads, (int)files.size()));
+
+        std::atomic<int> nextFile(0);
+        std::atomic<int> numFailed(0);
+        auto worker = [&]() {
+            while (true) {
+                const int i = nextFile++;
+                if (i >= (int)files.size()) break;
+                try {
+                    update_single_file(inputFile + "/" + files[i],
+                                       outputFile + "/" + files[i]);
+                }
+                catch (const std::exception& ex) {
+                    log_error("Failed to update '{}': {}",
+                            files[i], ex.what());
+                    ++numFailed;
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i) threads.emplace_back(worker);
+        for (auto& thread : threads) thread.join();
+
+        log_info("Updated {} of {} files.",
+                (int)files.size() - numFailed, files.size());
+        return numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    update_single_file(inputFile, outputFile);
+    return EXIT_SUCCESS;
+}
+
 
 #endif // OPENSIM_CMD_UPDATE_FILE_H_
@@ -23,6 +23,7 @@
 
 #include <SimTKcommon/Testing.h>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <regex>
@@ -478,12 +479,36 @@ void testUpdateFile() {
     // (We are not really trying to test print-xml right now.)
     testCommand("print-xml Model testupdatefile_Model.osim", EXIT_SUCCESS,
             ContainsSubstring("Printing 'testupdatefile_Model.osim'.\n"));
+    // The file print-xml writes is already at the latest format, so
+    // update-file copies it without running the migration machinery.
     testCommand("update-file testupdatefile_Model.osim "
                 "testupdatefile_Model_updated.osim", EXIT_SUCCESS,
-                std::regex(RE_ANY + "(Loading input file "
-                           "'testupdatefile_Model.osim'.\n)" + 
-                           RE_ANY + "(Printing updated file to "
-                           "'testupdatefile_Model_updated.osim'.\n)" + RE_ANY));
+                std::regex(RE_ANY + "(already at the latest format)" +
+                           RE_ANY + "(copying it unchanged to "
+                           "'testupdatefile_Model_updated.osim')" + RE_ANY));
+
+    // Directory batch conversion.
+    // ===========================
+    std::system("mkdir testupdatefile_dir");
+    testCommand("print-xml Model testupdatefile_dir/Model1.osim",
+            EXIT_SUCCESS, ContainsSubstring("Printing "));
+    testCommand("print-xml Model testupdatefile_dir/Model2.osim",
+            EXIT_SUCCESS, ContainsSubstring("Printing "));
+    testCommand("update-file -j 2 testupdatefile_dir "
+                "testupdatefile_dir_updated", EXIT_SUCCESS,
+                std::regex(RE_ANY +
+                    "(Updating 2 files from 'testupdatefile_dir')" +
+                    RE_ANY + "(Updated 2 of 2 files.)" + RE_ANY));
+    // A file that fails to convert is reported and skipped, and the
+    // command exits with a non-zero status.
+    {
+        std::ofstream bad("testupdatefile_dir/bad.xml");
+        bad << "<NoSuchOpenSimClass/>\n";
+    }
+    testCommand("update-file testupdatefile_dir "
+                "testupdatefile_dir_updated", EXIT_FAILURE,
+                std::regex(RE_ANY + "(Failed to update 'bad.xml')" +
+                    RE_ANY + "(Updated 2 of 3 files.)" + RE_ANY));
 
     // Library option.
     // ===============
@@ -24,7 +24,9 @@
 // INCLUDE
 #include <OpenSim/OpenSim.h>  // clock(), clock_t, CLOCKS_PER_SEC
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/XMLDocument.h>
 #include <OpenSim/version.h>
+#include <fstream>
 using namespace OpenSim;
 using namespace std;
 
@@ -88,6 +90,20 @@ int main(int argc,char **argv)
         return 1;// if '_fileName' contains path information...
     }
 
+    // A file already at the latest format needs no migration; copy the
+    // bytes instead of rebuilding and re-printing the document.
+    if (XMLDocument::sniffDocumentVersion(inputFileName) ==
+            XMLDocument::getLatestVersion()) {
+        log_info("File '{}' is already at the latest format; copying it "
+                 "unchanged.", inputFileName);
+        if (inputFileName != outputFileName) {
+            std::ifstream src(inputFileName, std::ios::binary);
+            std::ofstream dst(outputFileName, std::ios::binary);
+            dst << src.rdbuf();
+        }
+        return (0);
+    }
+
     Object* newObject = Object::makeObjectFromFile(inputFileName);
 
     newObject->print(outputFileName);
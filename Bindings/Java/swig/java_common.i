@@ -219,4 +219,142 @@ using namespace SimTK;
 
 %import "java_simbody.i"
 
+// Direct-ByteBuffer bulk table transfer
+// =====================================
+// Tables used to cross JNI one element at a time, which dominates runtime
+// for Matlab batch scripts. These methods move a whole table's contents
+// through one JNI crossing via a direct NIO buffer (see the `nioBuffer`
+// typemaps in java_preliminaries.i). Data is column-major, matching both
+// SimTK storage and Matlab's memory layout, so the Matlab side can
+// reshape() without transposing.
+%extend OpenSim::DataTable_<double, double> {
+    /** Copy the table's data matrix into a direct NIO buffer, column-major,
+    in one JNI crossing. The buffer must hold at least numElements doubles
+    and numElements must be at least getNumRows()*getNumColumns(). */
+    void copyDataToBuffer(double* nioBuffer, long long numElements) const {
+        const auto& matrix = $self->getMatrix();
+        const long long n = (long long)matrix.nrow() * matrix.ncol();
+        OPENSIM_THROW_IF(numElements < n, OpenSim::Exception,
+                "Buffer of " + std::to_string(numElements) + " doubles is "
+                "too small for " + std::to_string(n) + " table elements.");
+        if (matrix.hasContiguousData()) {
+            std::copy_n(matrix.getContiguousScalarData(), n, nioBuffer);
+        } else {
+            for (int c = 0; c < matrix.ncol(); ++c)
+                for (int r = 0; r < matrix.nrow(); ++r)
+                    nioBuffer[r + (long long)matrix.nrow() * c] =
+                            matrix.getElt(r, c);
+        }
+    }
+    /** Overwrite the table's data matrix from a direct NIO buffer holding
+    getNumRows()*getNumColumns() doubles, column-major, in one JNI
+    crossing. The table's shape is unchanged. */
+    void copyDataFromBuffer(double* nioBuffer, long long numElements) {
+        auto& matrix = $self->updMatrix();
+        const long long n = (long long)matrix.nrow() * matrix.ncol();
+        OPENSIM_THROW_IF(numElements < n, OpenSim::Exception,
+                "Buffer of " + std::to_string(numElements) + " doubles is "
+                "too small for " + std::to_string(n) + " table elements.");
+        for (int c = 0; c < matrix.ncol(); ++c)
+            for (int r = 0; r < matrix.nrow(); ++r)
+                matrix.updElt(r, c) =
+                        nioBuffer[r + (long long)matrix.nrow() * c];
+    }
+    /** Copy the independent (time) column into a direct NIO buffer of at
+    least getNumRows() doubles in one JNI crossing. */
+    void copyIndependentColumnToBuffer(
+            double* nioBuffer, long long numElements) const {
+        const auto& column = $self->getIndependentColumn();
+        OPENSIM_THROW_IF(numElements < (long long)column.size(),
+                OpenSim::Exception,
+                "Buffer of " + std::to_string(numElements) + " doubles is "
+                "too small for " + std::to_string(column.size()) +
+                " time values.");
+        std::copy(column.begin(), column.end(), nioBuffer);
+    }
+}
+%typemap(javacode) OpenSim::DataTable_<double, double> %{
+  /** The table's data matrix as a new direct DoubleBuffer, column-major
+      (reshape to [getNumRows(), getNumColumns()] in Matlab), filled with
+      one JNI crossing. */
+  public java.nio.DoubleBuffer getDataAsJavaBuffer() {
+      long n = getNumRows() * getNumColumns();
+      java.nio.ByteBuffer buffer = java.nio.ByteBuffer
+              .allocateDirect((int)(8 * n))
+              .order(java.nio.ByteOrder.nativeOrder());
+      copyDataToBuffer(buffer, n);
+      return buffer.asDoubleBuffer();
+  }
+  /** The independent (time) column as a new direct DoubleBuffer filled
+      with one JNI crossing. */
+  public java.nio.DoubleBuffer getIndependentColumnAsJavaBuffer() {
+      long n = getNumRows();
+      java.nio.ByteBuffer buffer = java.nio.ByteBuffer
+              .allocateDirect((int)(8 * n))
+              .order(java.nio.ByteOrder.nativeOrder());
+      copyIndependentColumnToBuffer(buffer, n);
+      return buffer.asDoubleBuffer();
+  }
+%}
+
+%extend OpenSim::Storage {
+    /** Copy all data columns (time excluded) into a direct NIO buffer,
+    column-major, in one JNI crossing. The buffer must hold at least
+    numElements doubles and numElements must be at least
+    getSize()*getSmallestNumberOfStates(). Throws if the rows do not all
+    have the same number of states. */
+    void copyDataToBuffer(double* nioBuffer, long long numElements) const {
+        const int nr = $self->getSize();
+        const int nc = nr > 0 ? $self->getStateVector(0)->getSize() : 0;
+        OPENSIM_THROW_IF(numElements < (long long)nr * nc,
+                OpenSim::Exception,
+                "Buffer of " + std::to_string(numElements) + " doubles is "
+                "too small for " + std::to_string((long long)nr * nc) +
+                " storage elements.");
+        for (int r = 0; r < nr; ++r) {
+            const OpenSim::StateVector* row = $self->getStateVector(r);
+            OPENSIM_THROW_IF(row->getSize() != nc, OpenSim::Exception,
+                    "Storage rows have differing numbers of states; "
+                    "cannot transfer as one matrix.");
+            const OpenSim::Array<double>& data = row->getData();
+            for (int c = 0; c < nc; ++c)
+                nioBuffer[r + (long long)nr * c] = data[c];
+        }
+    }
+    /** Copy the time column into a direct NIO buffer of at least getSize()
+    doubles in one JNI crossing. */
+    void copyTimeColumnToBuffer(
+            double* nioBuffer, long long numElements) const {
+        const int nr = $self->getSize();
+        OPENSIM_THROW_IF(numElements < nr, OpenSim::Exception,
+                "Buffer of " + std::to_string(numElements) + " doubles is "
+                "too small for " + std::to_string(nr) + " time values.");
+        for (int r = 0; r < nr; ++r)
+            nioBuffer[r] = $self->getStateVector(r)->getTime();
+    }
+}
+%typemap(javacode) OpenSim::Storage %{
+  /** All data columns (time excluded) as a new direct DoubleBuffer,
+      column-major (reshape to [getSize(), getSmallestNumberOfStates()] in
+      Matlab), filled with one JNI crossing. */
+  public java.nio.DoubleBuffer getDataAsJavaBuffer() {
+      long n = (long)getSize() * getSmallestNumberOfStates();
+      java.nio.ByteBuffer buffer = java.nio.ByteBuffer
+              .allocateDirect((int)(8 * n))
+              .order(java.nio.ByteOrder.nativeOrder());
+      copyDataToBuffer(buffer, n);
+      return buffer.asDoubleBuffer();
+  }
+  /** The time column as a new direct DoubleBuffer filled with one JNI
+      crossing. */
+  public java.nio.DoubleBuffer getTimeColumnAsJavaBuffer() {
+      long n = getSize();
+      java.nio.ByteBuffer buffer = java.nio.ByteBuffer
+              .allocateDirect((int)(8 * n))
+              .order(java.nio.ByteOrder.nativeOrder());
+      copyTimeColumnToBuffer(buffer, n);
+      return buffer.asDoubleBuffer();
+  }
+%}
+
 %include <Bindings/common.i>
@@ -72,6 +72,27 @@ SWIG_JAVABODY_PROXY(public, public, SWIGTYPE)
 	  }
 }
 
+/* Direct java.nio.ByteBuffer interop.
+Any wrapped function taking a `double* nioBuffer` argument receives the
+address of a direct ByteBuffer, so a whole table can cross JNI in one call
+instead of one call per element. The buffer must be allocated with
+java.nio.ByteBuffer.allocateDirect() (heap buffers have no stable address
+and are rejected) and read/written in native byte order.                      */
+%typemap(jni) double* nioBuffer "jobject"
+%typemap(jtype) double* nioBuffer "java.nio.ByteBuffer"
+%typemap(jstype) double* nioBuffer "java.nio.ByteBuffer"
+%typemap(javain) double* nioBuffer "$javainput"
+%typemap(in) double* nioBuffer %{
+    $1 = static_cast<double*>(jenv->GetDirectBufferAddress($input));
+    if (!$1) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException,
+                "Expected a direct java.nio.ByteBuffer "
+                "(allocated with java.nio.ByteBuffer.allocateDirect).");
+        return $null;
+    }
+%}
+%typemap(freearg) double* nioBuffer ""
+
 // https://github.com/swig/swig/blob/master/Lib/java/std_auto_ptr.i
 %define opensim_unique_ptr(TYPE)
 %template() std::unique_ptr<TYPE>;
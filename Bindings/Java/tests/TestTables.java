@@ -768,6 +768,55 @@ class TestTables {
         }
     }
 
+    public static void test_NioBuffers() {
+        TimeSeriesTable table = new TimeSeriesTable();
+        StdVectorString labels = new StdVectorString();
+        labels.add("a"); labels.add("b");
+        table.setColumnLabels(labels);
+        RowVector row = new RowVector(2);
+        row.set(0, 1.0); row.set(1, 2.0);
+        table.appendRow(0.0, row);
+        row.set(0, 3.0); row.set(1, 4.0);
+        table.appendRow(0.5, row);
+        row.set(0, 5.0); row.set(1, 6.0);
+        table.appendRow(1.0, row);
+
+        // One JNI crossing for the whole matrix; data is column-major.
+        java.nio.DoubleBuffer data = table.getDataAsJavaBuffer();
+        assert data.capacity() == 6;
+        assert data.get(0) == 1.0 && data.get(1) == 3.0 && data.get(2) == 5.0;
+        assert data.get(3) == 2.0 && data.get(4) == 4.0 && data.get(5) == 6.0;
+        java.nio.DoubleBuffer time = table.getIndependentColumnAsJavaBuffer();
+        assert time.capacity() == 3;
+        assert time.get(0) == 0.0 && time.get(1) == 0.5 && time.get(2) == 1.0;
+
+        // One JNI crossing writes the matrix back in place.
+        java.nio.ByteBuffer bytes = java.nio.ByteBuffer
+                .allocateDirect(8 * 6)
+                .order(java.nio.ByteOrder.nativeOrder());
+        java.nio.DoubleBuffer newData = bytes.asDoubleBuffer();
+        for (int i = 0; i < 6; ++i) newData.put(i, 10.0 + i);
+        table.copyDataFromBuffer(bytes, 6);
+        assert table.getRowAtIndex(0).get(0) == 10.0;
+        assert table.getRowAtIndex(1).get(0) == 11.0;
+        assert table.getRowAtIndex(0).get(1) == 13.0;
+        assert table.getRowAtIndex(2).get(1) == 15.0;
+
+        // A heap (non-direct) buffer is rejected.
+        try {
+            table.copyDataToBuffer(java.nio.ByteBuffer.allocate(8 * 6), 6);
+            assert false;
+        } catch (IllegalArgumentException expected) {}
+
+        // A too-small buffer is rejected.
+        try {
+            java.nio.ByteBuffer small = java.nio.ByteBuffer
+                    .allocateDirect(8).order(java.nio.ByteOrder.nativeOrder());
+            table.copyDataToBuffer(small, 1);
+            assert false;
+        } catch (RuntimeException expected) {}
+    }
+
     public static void main(String[] args)  throws java.io.IOException {
         test_DataTable();
         test_DataTableVec3();
@@ -775,5 +824,6 @@ class TestTables {
         test_TimeSeriesTableVec3();
         test_FlattenWithIK();
         test_vector_rowvector();
+        test_NioBuffers();
     }
 }
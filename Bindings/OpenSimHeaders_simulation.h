@@ -148,6 +148,7 @@
 #include <OpenSim/Simulation/StatesTrajectoryReporter.h>
 
 #include <OpenSim/Simulation/SimulationUtilities.h>
+#include <OpenSim/Simulation/StateVariableBatch.h>
 #include <OpenSim/Simulation/VisualizerUtilities.h>
 
 #include <OpenSim/Simulation/TableProcessor.h>
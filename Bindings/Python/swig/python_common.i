@@ -287,6 +287,24 @@ note: ## is a "glue" operator: `a ## b` --> `ab`.
     std::string __str__() const {
         return $self->toString();
     }
+%pythoncode %{
+    def to_numpy_view(self):
+        """Zero-copy read-only (numRows, numColumns) NumPy view of this
+        table's data matrix. Unlike getMatrix().to_numpy(), nothing is
+        copied: the view reads the table's memory directly, so it is O(1)
+        regardless of table size and reflects later changes to the table.
+        The table must outlive the view, and appending rows (which can
+        reallocate the matrix) invalidates it. Only tables of scalars
+        (e.g. TimeSeriesTable) support views; tables of composite elements
+        such as Vec3 do not."""
+        return self.getMatrix().to_numpy_view()
+
+    def upd_numpy_view(self):
+        """Zero-copy writable NumPy view of this table's data matrix;
+        assignments through the array write the table's elements in place.
+        Same shape and lifetime rules as to_numpy_view()."""
+        return self.updMatrix().upd_numpy_view()
+%}
 }
 
 // Include all the OpenSim code.
@@ -49,6 +49,12 @@ using namespace SimTK;
     }
 }
 
+// Release the GIL around long-running solves (the macro reacquires it
+// before relaying exceptions; director callbacks re-take it themselves)
+// so Python threads can drive several native solves concurrently.
+OPENSIM_RELEASE_GIL(OpenSim::MocoStudy::solve)
+OPENSIM_RELEASE_GIL(OpenSim::MocoStudy::analyze)
+
 // Typemaps
 // ========
 // None.
@@ -289,7 +295,8 @@ using namespace SimTK;
     (int nrowstates, int ncolstates, double* states),
     (int nrowcontrols, int ncolcontrols, double* controls),
     (int nrowmults, int ncolmults, double* mults),
-    (int nrowderivs, int ncolderivs, double* derivs)
+    (int nrowderivs, int ncolderivs, double* derivs),
+    (int nrowblock, int ncolblock, double* block)
 };
 // For getState(), etc.
 // The typemaps for functions that return matrices is more complicated: we must
@@ -312,7 +319,8 @@ using namespace SimTK;
     (int nrow, int ncol, double* statesOut),
     (int nrow, int ncol, double* controlsOut),
     (int nrow, int ncol, double* multsOut),
-    (int nrow, int ncol, double* derivsOut)
+    (int nrow, int ncol, double* derivsOut),
+    (int nrow, int ncol, double* blockOut)
 };
 %extend OpenSim::MocoTrajectory {
     MocoTrajectory(
@@ -448,6 +456,17 @@ using namespace SimTK;
                 "ncol != number of derivs");
         std::copy_n(derivs.getContiguousScalarData(), nrow * ncol, derivsOut);
     }
+    void _exportToBlockMat(int nrow, int ncol, double* blockOut) const {
+        OPENSIM_THROW_IF(nrow != $self->getNumTimes(), OpenSim::Exception,
+                "nrow != getNumTimes()");
+        OPENSIM_THROW_IF(ncol != $self->getNumBlockColumns(),
+                OpenSim::Exception, "ncol != getNumBlockColumns()");
+        const SimTK::Matrix block = $self->exportToBlock();
+        std::copy_n(block.getContiguousScalarData(), nrow * ncol, blockOut);
+    }
+    void _setFromBlockMat(int nrowblock, int ncolblock, double* block) {
+        $self->setFromBlock(SimTK::Matrix(nrowblock, ncolblock, block));
+    }
 %pythoncode %{
     def getTimeMat(self):
         return self._getTimeMat(self.getNumTimes())
@@ -483,6 +502,40 @@ using namespace SimTK;
         self._getDerivativesTrajectoryMat(mat)
         return mat
 
+    def exportToBlock(self):
+        """Return (block, schema): the whole trajectory as one NumPy array
+        (one SWIG crossing) and a dict describing its columns. Column 0 of
+        the block is time, followed by the states, controls, multipliers,
+        and derivatives; schema['columns'] lists the column names in order,
+        and the per-group name lists and the parameter names are included
+        under their own keys. Parameters are time-invariant and not part of
+        the block; use getParametersMat()."""
+        import numpy as np
+        block = np.empty([self.getNumTimes(), self.getNumBlockColumns()])
+        self._exportToBlockMat(block)
+        schema = {
+            'columns': (['time']
+                        + list(self.getStateNames())
+                        + list(self.getControlNames())
+                        + list(self.getMultiplierNames())
+                        + list(self.getDerivativeNames())),
+            'state_names': list(self.getStateNames()),
+            'control_names': list(self.getControlNames()),
+            'multiplier_names': list(self.getMultiplierNames()),
+            'derivative_names': list(self.getDerivativeNames()),
+            'parameter_names': list(self.getParameterNames()),
+        }
+        return block, schema
+
+    def setFromBlock(self, block):
+        """Overwrite the time, states, controls, multipliers, and
+        derivatives from a 2D NumPy array laid out as produced by
+        exportToBlock(), in one SWIG crossing. The column names are
+        unchanged, so the block must have getNumBlockColumns() columns; the
+        number of rows may differ from getNumTimes(). Use this to inject a
+        warm start produced elsewhere."""
+        self._setFromBlockMat(block)
+
 %};
 }
 
@@ -47,6 +47,44 @@ note: ## is a "glue" operator: `a ## b` --> `ab`.
 };
 %enddef
 
+// Threading
+// =========
+// Activate SWIG's Python thread-support macros so that director callbacks
+// (e.g. a Python LogSink receiving log messages from a native worker
+// thread, or while the GIL is released below) acquire the GIL before
+// touching Python objects.
+%begin %{
+#define SWIG_PYTHON_THREADS
+%}
+
+/*
+A macro that releases the Python GIL for the duration of a long-running
+native call, so one Python process can drive several concurrent native
+solves (or keep its own threads responsive) instead of serializing on the
+interpreter lock. The GIL is reacquired before any exception is relayed to
+Python. Apply only to entry points that do not themselves call back into
+Python, except through director classes (whose callbacks re-take the GIL;
+see above).
+*/
+%define OPENSIM_RELEASE_GIL(FUNCTION)
+%exception FUNCTION {
+    PyThreadState* _threadState = PyEval_SaveThread();
+    try {
+        $action
+        PyEval_RestoreThread(_threadState);
+    } catch (const std::exception& e) {
+        PyEval_RestoreThread(_threadState);
+        std::string str("std::exception in '$fulldecl': ");
+        std::string what(e.what());
+        SWIG_exception_fail(SWIG_RuntimeError, (str + what).c_str());
+    } catch (...) {
+        PyEval_RestoreThread(_threadState);
+        SWIG_exception_fail(SWIG_RuntimeError,
+                "Non-standard exception in '$fulldecl'.");
+    }
+}
+%enddef
+
 // https://github.com/swig/swig/blob/master/Lib/python/std_auto_ptr.i
 %define opensim_unique_ptr(TYPE)
 %template() std::unique_ptr<TYPE>;
@@ -203,6 +203,23 @@ namespace SimTK {
 %pythoncode %{
     def to_numpy(self):
         return self._to_numpy(self.size())
+
+    def _numpy_view(self, writable):
+        import numpy as np
+        if self.size() == 0:
+            return np.empty([0])
+        view = np.frombuffer(self._memoryview(writable), dtype=np.float64)
+        return view[:self.size()]
+
+    def to_numpy_view(self):
+        """Zero-copy read-only 1D NumPy view of this vector's own storage;
+        see MatrixBaseDouble.to_numpy_view() for the lifetime rules."""
+        return self._numpy_view(False)
+
+    def upd_numpy_view(self):
+        """Zero-copy writable 1D NumPy view of this vector's own storage;
+        see MatrixBaseDouble.upd_numpy_view() for the lifetime rules."""
+        return self._numpy_view(True)
 %};
 }
 
@@ -232,6 +249,26 @@ namespace SimTK {
 %pythoncode %{
     def to_numpy(self):
         return self._to_numpy(self.size())
+
+    def _numpy_view(self, writable):
+        import numpy as np
+        if self.size() == 0:
+            return np.empty([0])
+        view = np.frombuffer(self._memoryview(writable), dtype=np.float64)
+        return view[:self.size()]
+
+    def to_numpy_view(self):
+        """Zero-copy read-only 1D NumPy view of this row vector's own
+        storage; see MatrixBaseDouble.to_numpy_view() for the lifetime
+        rules. A row view into a matrix (e.g. a table row) is not
+        contiguous and must use to_numpy()."""
+        return self._numpy_view(False)
+
+    def upd_numpy_view(self):
+        """Zero-copy writable 1D NumPy view of this row vector's own
+        storage; see MatrixBaseDouble.upd_numpy_view() for the lifetime
+        rules."""
+        return self._numpy_view(True)
 %};
 }
 
@@ -249,12 +286,52 @@ namespace SimTK {
                 "Number of columns must be %i.", $self->ncol());
         std::copy_n($self->getContiguousScalarData(), nrow * ncol, numpyout);
     }
+    // Expose the matrix's own storage through the buffer protocol so
+    // to_numpy_view() can wrap it without copying. Matrix storage is
+    // column-major; the Python side reshapes accordingly.
+    PyObject* _memoryview(bool writable) {
+        SimTK_ERRCHK_ALWAYS($self->hasContiguousData(), "_memoryview()",
+                "This matrix does not view contiguous data; "
+                "use to_numpy(), which copies.");
+        char* data = writable
+                ? reinterpret_cast<char*>($self->updContiguousScalarData())
+                : const_cast<char*>(reinterpret_cast<const char*>(
+                          $self->getContiguousScalarData()));
+        return PyMemoryView_FromMemory(data,
+                (Py_ssize_t)($self->getContiguousScalarDataLength() *
+                             sizeof(double)),
+                writable ? PyBUF_WRITE : PyBUF_READ);
+    }
 %pythoncode %{
     def to_numpy(self):
         import numpy as np
         mat = np.empty([self.nrow(), self.ncol()])
         self._to_numpy(mat)
         return mat
+
+    def _numpy_view(self, writable):
+        import numpy as np
+        if self.nrow() * self.ncol() == 0:
+            return np.empty([self.nrow(), self.ncol()])
+        view = np.frombuffer(self._memoryview(writable), dtype=np.float64)
+        return view[:self.nrow() * self.ncol()].reshape(
+                (self.nrow(), self.ncol()), order='F')
+
+    def to_numpy_view(self):
+        """Zero-copy read-only NumPy view of this matrix's own storage.
+        Unlike to_numpy(), nothing is copied: the returned array reads the
+        matrix's memory directly, so it is O(1) regardless of size and
+        reflects later changes to the matrix. The matrix (and whatever owns
+        it, e.g. a table) must outlive the view, and resizing the matrix
+        invalidates it. Requires contiguous storage; non-contiguous views
+        must use to_numpy()."""
+        return self._numpy_view(False)
+
+    def upd_numpy_view(self):
+        """Zero-copy writable NumPy view of this matrix's own storage;
+        assignments through the array write the matrix elements in place.
+        Same lifetime rules as to_numpy_view()."""
+        return self._numpy_view(True)
 %};
 }
 
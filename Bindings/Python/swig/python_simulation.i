@@ -18,6 +18,13 @@ using namespace OpenSim;
 using namespace SimTK;
 %}
 
+// Add support for converting between NumPy and C arrays (for
+// StateVariableBatch).
+%include "numpy.i"
+%init %{
+    import_array();
+%}
+
 // Ignore method that is not callable from Python (uses double[] arg)
 %ignore OpenSim::Coordinate::setRange;
 
@@ -44,6 +51,15 @@ using namespace SimTK;
     }
 }
 
+// Release the GIL around long-running native calls (the macro reacquires
+// it before relaying exceptions; director callbacks re-take it themselves)
+// so Python threads can drive several native solves concurrently.
+OPENSIM_RELEASE_GIL(OpenSim::Manager::integrate)
+OPENSIM_RELEASE_GIL(OpenSim::simulate)
+OPENSIM_RELEASE_GIL(OpenSim::Model::initSystem)
+OPENSIM_RELEASE_GIL(OpenSim::InverseKinematicsSolver::assemble)
+OPENSIM_RELEASE_GIL(OpenSim::InverseKinematicsSolver::track)
+
 // Rename
 // ======
 
@@ -98,7 +114,42 @@ MODEL_ADOPT_HELPER(Controller);
 %}
 // Typemaps
 // ========
-// None.
+// Let a StateVariableBatch exchange all of its values with NumPy arrays in
+// one call, following the NumPy typemap pattern used for MocoTrajectory:
+// an input (int n, double* values) pair becomes a single NumPy array, and
+// _getValuesMat() fills a preallocated output array that the Python-side
+// getValuesMat() creates at the right size.
+// https://docs.scipy.org/doc/numpy/reference/swig.interface-file.html
+%apply (int DIM1, double* IN_ARRAY1) {
+    (int n, double* values)
+};
+%apply (int DIM1, double* ARGOUT_ARRAY1) {
+    (int n, double* valuesOut)
+};
+
+%extend OpenSim::StateVariableBatch {
+    void setValuesMat(SimTK::State& state, int n, double* values) const {
+        OPENSIM_THROW_IF(n != $self->getSize(), OpenSim::Exception,
+                "Expected " + std::to_string($self->getSize()) +
+                " values but received " + std::to_string(n) + ".");
+        // Wrap the NumPy buffer as a shared-data Vector; no copy is made.
+        $self->setValues(state, SimTK::Vector(n, values, true));
+    }
+    void _getValuesMat(const SimTK::State& state, int n,
+            double* valuesOut) const {
+        OPENSIM_THROW_IF(n != $self->getSize(), OpenSim::Exception,
+                "Expected " + std::to_string($self->getSize()) +
+                " values but received " + std::to_string(n) + ".");
+        SimTK::Vector shared(n, valuesOut, true);
+        $self->getValues(state, shared);
+    }
+%pythoncode %{
+    def getValuesMat(self, state):
+        """Read all batch values out of the state into a NumPy array with
+        a single call."""
+        return self._getValuesMat(state, self.getSize())
+%};
+}
 
 // Pythonic operators
 // ==================
@@ -44,6 +44,19 @@ using namespace SimTK;
     }
 }
 
+// Release the GIL around the tools' long-running run() entry points (the
+// macro reacquires it before relaying exceptions; director callbacks such
+// as Python LogSinks re-take it themselves) so Python threads can drive
+// several native solves concurrently.
+OPENSIM_RELEASE_GIL(OpenSim::ForwardTool::run)
+OPENSIM_RELEASE_GIL(OpenSim::AnalyzeTool::run)
+OPENSIM_RELEASE_GIL(OpenSim::CMCTool::run)
+OPENSIM_RELEASE_GIL(OpenSim::InverseDynamicsTool::run)
+OPENSIM_RELEASE_GIL(OpenSim::InverseKinematicsTool::run)
+OPENSIM_RELEASE_GIL(OpenSim::IMUInverseKinematicsTool::run)
+OPENSIM_RELEASE_GIL(OpenSim::ToolJobPool::wait)
+OPENSIM_RELEASE_GIL(OpenSim::ToolJobPool::waitAll)
+
 // Typemaps
 // ========
 // None.
@@ -96,6 +96,34 @@ class TestBasics(unittest.TestCase):
 
     def test_ToyReflexController(self):
         controller = osim.ToyReflexController()
+
+    def test_ToolJobPool(self):
+        # Run a batch of ForwardTools through the in-process job pool and
+        # check the per-job status reporting.
+        model = osim.Model(os.path.join(test_dir, "arm26.osim"))
+        pool = osim.ToolJobPool()
+        pool.setNumThreads(2)
+        jobs = []
+        for i in range(3):
+            forward = osim.ForwardTool()
+            forward.setName('test_ToolJobPool_fwd%d' % i)
+            forward.setModel(model)
+            forward.setFinalTime(0.01)
+            jobs.append(pool.submit(forward))
+        # A tool without a model fails without stopping the batch.
+        broken = osim.ForwardTool()
+        broken.setName('test_ToolJobPool_broken')
+        bad_job = pool.submit(broken)
+
+        assert pool.waitAll() == 3
+        for job in jobs:
+            assert pool.getJobStatus(job) == osim.ToolJobPool.JobStatus_Succeeded
+            assert pool.wait(job)
+        assert not pool.wait(bad_job)
+        assert pool.getJobStatus(bad_job) == osim.ToolJobPool.JobStatus_Failed
+        assert 'model' in pool.getJobMessage(bad_job)
+        with self.assertRaises(RuntimeError):
+            pool.getJobStatus(100)
         
     def test_GCVSplineSet(self):
         splineset = osim.GCVSplineSet(os.path.join(test_dir,
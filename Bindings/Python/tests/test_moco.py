@@ -216,6 +216,55 @@ class TestSwigAddtlInterface(unittest.TestCase):
         assert (it.getDerivativesTrajectoryMat() == dt).all()
         assert (it.getParametersMat() == p).all()
 
+    def test_MocoTrajectory_block(self):
+        try:
+            import numpy as np
+        except ImportError as e:
+            print("Could not import numpy; skipping test.")
+            return
+
+        time = np.linspace(0, 0.2, 3)
+        st = np.random.rand(3, 2)
+        ct = np.random.rand(3, 3)
+        mt = np.random.rand(3, 1)
+        dt = np.random.rand(3, 4)
+        p = np.random.rand(2)
+        it = osim.MocoTrajectory(time, ['s0', 's1'], ['c0', 'c1', 'c2'],
+                              ['m0'], ['d0', 'd1', 'd2', 'd3'],
+                              ['p0', 'p1'], st, ct, mt, dt, p)
+
+        # The whole trajectory comes back as one block plus a schema.
+        assert it.getNumBlockColumns() == 1 + 2 + 3 + 1 + 4
+        block, schema = it.exportToBlock()
+        assert block.shape == (3, it.getNumBlockColumns())
+        assert schema['columns'] == (['time', 's0', 's1', 'c0', 'c1', 'c2',
+                                      'm0', 'd0', 'd1', 'd2', 'd3'])
+        assert schema['parameter_names'] == ['p0', 'p1']
+        assert (block[:, 0] == time).all()
+        assert (block[:, 1:3] == st).all()
+        assert (block[:, 3:6] == ct).all()
+        assert (block[:, 6:7] == mt).all()
+        assert (block[:, 7:11] == dt).all()
+
+        # A modified block injects back in one call, including a different
+        # number of rows.
+        newblock = np.random.rand(5, it.getNumBlockColumns())
+        newblock[:, 0] = np.linspace(0, 0.4, 5)
+        it.setFromBlock(newblock)
+        assert it.getNumTimes() == 5
+        assert (it.getTimeMat() == newblock[:, 0]).all()
+        assert (it.getStatesTrajectoryMat() == newblock[:, 1:3]).all()
+        assert (it.getControlsTrajectoryMat() == newblock[:, 3:6]).all()
+        assert (it.getMultipliersTrajectoryMat() == newblock[:, 6:7]).all()
+        assert (it.getDerivativesTrajectoryMat() == newblock[:, 7:11]).all()
+        # The names and parameters are untouched.
+        assert list(it.getStateNames()) == ['s0', 's1']
+        assert (it.getParametersMat() == p).all()
+
+        # A block of the wrong width is rejected.
+        with self.assertRaises(RuntimeError):
+            it.setFromBlock(np.random.rand(5, 3))
+
     def test_createRep(self):
         model = osim.Model()
         model.setName('sliding_mass')
@@ -133,6 +133,38 @@ class TestSimbody(unittest.TestCase):
         with self.assertRaises(TypeError):
             osim.Matrix.createFromMat(npm)
 
+    def test_numpy_views(self):
+        table = osim.TimeSeriesTable()
+        table.setColumnLabels(['a', 'b'])
+        table.appendRow(0.0, osim.RowVector([1.5, 2.5]))
+        table.appendRow(1.0, osim.RowVector([3.5, 4.5]))
+
+        # The view reads the table's memory without copying and reflects
+        # later changes to the table.
+        view = table.to_numpy_view()
+        assert view.shape == (2, 2)
+        assert (view == table.getMatrix().to_numpy()).all()
+        table.setRowAtIndex(0, osim.RowVector([6.5, 7.5]))
+        assert view[0][0] == 6.5
+        assert view[0][1] == 7.5
+
+        # The read-only view rejects writes.
+        with self.assertRaises(ValueError):
+            view[0][0] = 0.0
+
+        # Writes through the writable view land in the table.
+        writable = table.upd_numpy_view()
+        writable[1][0] = 8.5
+        assert table.getRowAtIndex(1)[0] == 8.5
+
+        # A column of the table is contiguous and viewable; a row is a
+        # strided slice of column-major storage, so it must be copied.
+        column = table.getDependentColumn('a').to_numpy_view()
+        assert column[0] == 6.5
+        assert column[1] == 8.5
+        with self.assertRaises(RuntimeError):
+            table.getRowAtIndex(0).to_numpy_view()
+
     def test_vector_operators(self):
         v = osim.Vector(5, 3)
 
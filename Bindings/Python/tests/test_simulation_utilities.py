@@ -2,6 +2,8 @@
 import os
 import unittest
 
+import numpy as np
+
 import opensim as osim
 
 test_dir = os.path.join(os.path.dirname(os.path.abspath(osim.__file__)),
@@ -16,3 +18,32 @@ class TestSimulationUtilities(unittest.TestCase):
         # updatePre40KinematicsStorageFor40MotionType() is not wrapped.
         osim.updatePre40KinematicsFilesFor40MotionType(model,
                 [kinematics_file])
+
+    def test_state_variable_batch(self):
+        model = osim.Model(
+                os.path.join(test_dir, 'gait10dof18musc_subject01.osim'))
+        state = model.initSystem()
+
+        # A batch of every state variable, and a batch of a chosen subset.
+        all_batch = osim.StateVariableBatch(model)
+        assert all_batch.getSize() == model.getNumStateVariables()
+        names = [model.getStateVariableNames().get(i) for i in range(3)]
+        batch = osim.StateVariableBatch(model, names)
+        assert batch.getSize() == 3
+        assert list(batch.getStateVariableNames()) == names
+
+        # One crossing writes all values; one crossing reads them back.
+        values = np.array([0.1, 0.2, 0.3])
+        batch.setValuesMat(state, values)
+        assert np.allclose(batch.getValuesMat(state), values)
+        for i, name in enumerate(names):
+            assert model.getStateVariableValue(state, name) == values[i]
+
+        # Size mismatches are rejected.
+        with self.assertRaises(RuntimeError):
+            batch.setValuesMat(state, np.array([1.0]))
+
+        # The Vector-based accessors cross with SimTK types.
+        vec = osim.Vector(3, 0.5)
+        batch.setValues(state, vec)
+        assert batch.getValues(state).to_numpy()[0] == 0.5
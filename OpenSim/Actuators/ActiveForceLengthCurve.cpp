@@ -23,10 +23,27 @@
 #include "ActiveForceLengthCurve.h"
 #include <OpenSim/Common/SmoothSegmentedFunctionFactory.h>
 
+#include <array>
+#include <map>
+#include <mutex>
+
 using namespace OpenSim;
 using namespace SimTK;
 using namespace std;
 
+namespace {
+    // Process-wide cache of fitted curves, keyed by the property values that
+    // determine the fit. Fitting is expensive relative to copying the
+    // resulting SmoothSegmentedFunction, so when many models share the same
+    // (typically default) curve properties the fit is performed only once per
+    // process. The cache is capped so that ensembles with continuously
+    // varying curve properties cannot grow it without bound.
+    typedef std::array<double,5> CurveKey;
+    std::mutex curveCacheMutex;
+    std::map<CurveKey, SmoothSegmentedFunction> curveCache;
+    const size_t maxCachedCurves = 256;
+}
+
 //==============================================================================
 // CONSTRUCTION
 //==============================================================================
@@ -84,9 +101,33 @@ void ActiveForceLengthCurve::constructProperties()
 
 void ActiveForceLengthCurve::buildCurve()
 {
+    const CurveKey key = {{get_min_norm_active_fiber_length(),
+                           get_transition_norm_fiber_length(),
+                           get_max_norm_active_fiber_length(),
+                           get_shallow_ascending_slope(),
+                           get_minimum_value()}};
+    {
+        std::lock_guard<std::mutex> lock(curveCacheMutex);
+        std::map<CurveKey, SmoothSegmentedFunction>::const_iterator it =
+            curveCache.find(key);
+        if (it != curveCache.end()) {
+            m_curve = it->second;
+            std::string name = getName();
+            m_curve.setName(name);
+            setObjectIsUpToDateWithProperties();
+            return;
+        }
+    }
+
     SimTK::Function* f = createSimTKFunction();
     m_curve = *(static_cast<SmoothSegmentedFunction*>(f));
     delete f;
+
+    {
+        std::lock_guard<std::mutex> lock(curveCacheMutex);
+        if (curveCache.size() < maxCachedCurves)
+            curveCache.insert(std::make_pair(key, m_curve));
+    }
     setObjectIsUpToDateWithProperties();
 }
 
@@ -185,6 +226,22 @@ SimTK::Vec2 ActiveForceLengthCurve::getCurveDomain() const
     return m_curve.getCurveDomain();
 }
 
+void ActiveForceLengthCurve::buildLookupTable(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.buildLookupTable(tolerance);
+}
+
+bool ActiveForceLengthCurve::isLookupTableInUse() const
+{
+    return m_curve.isLookupTableInUse();
+}
+
+void ActiveForceLengthCurve::clearLookupTable()
+{
+    m_curve.clearLookupTable();
+}
+
 void ActiveForceLengthCurve::printMuscleCurveToCSVFile(const std::string& path)
 {
     ensureCurveUpToDate();
@@ -933,6 +933,107 @@ DataTable DeGrooteFregly2016Muscle::exportFiberVelocityMultiplierToTable(
     return table;
 }
 
+void DeGrooteFregly2016Muscle::calcActiveForceLengthMultiplier(
+        const SimTK::Vector& normFiberLengths,
+        SimTK::Vector& multipliers) const {
+    const double scale = get_active_force_width_scale();
+    const int n = normFiberLengths.size();
+    multipliers.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const double x = (normFiberLengths[i] - 1.0) / scale + 1.0;
+        multipliers[i] = calcGaussianLikeCurve(x, b11, b21, b31, b41) +
+                         calcGaussianLikeCurve(x, b12, b22, b32, b42) +
+                         calcGaussianLikeCurve(x, b13, b23, b33, b43);
+    }
+}
+
+void DeGrooteFregly2016Muscle::calcActiveForceLengthMultiplierDerivative(
+        const SimTK::Vector& normFiberLengths,
+        SimTK::Vector& derivatives) const {
+    const double scale = get_active_force_width_scale();
+    const int n = normFiberLengths.size();
+    derivatives.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const double x = (normFiberLengths[i] - 1.0) / scale + 1.0;
+        derivatives[i] =
+                (1.0 / scale) *
+                (calcGaussianLikeCurveDerivative(x, b11, b21, b31, b41) +
+                        calcGaussianLikeCurveDerivative(x, b12, b22, b32, b42) +
+                        calcGaussianLikeCurveDerivative(x, b13, b23, b33, b43));
+    }
+}
+
+void DeGrooteFregly2016Muscle::calcForceVelocityMultiplier(
+        const SimTK::Vector& normFiberVelocities,
+        SimTK::Vector& multipliers) {
+    using SimTK::square;
+    const int n = normFiberVelocities.size();
+    multipliers.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const double tempV = d2 * normFiberVelocities[i] + d3;
+        const double tempLogArg = tempV + sqrt(square(tempV) + 1.0);
+        multipliers[i] = d1 * log(tempLogArg) + d4;
+    }
+}
+
+void DeGrooteFregly2016Muscle::calcPassiveForceMultiplier(
+        const SimTK::Vector& normFiberLengths,
+        SimTK::Vector& multipliers) const {
+    const int n = normFiberLengths.size();
+    multipliers.resize(n);
+    if (get_ignore_passive_fiber_force()) {
+        multipliers.setToZero();
+        return;
+    }
+    const double e0 = get_passive_fiber_strain_at_one_norm_force();
+    const double offset = exp(kPE * (m_minNormFiberLength - 1.0) / e0);
+    const double denom = exp(kPE) - offset;
+    for (int i = 0; i < n; ++i) {
+        multipliers[i] =
+                (exp(kPE * (normFiberLengths[i] - 1.0) / e0) - offset) / denom;
+    }
+}
+
+void DeGrooteFregly2016Muscle::calcPassiveForceMultiplierDerivative(
+        const SimTK::Vector& normFiberLengths,
+        SimTK::Vector& derivatives) const {
+    const int n = normFiberLengths.size();
+    derivatives.resize(n);
+    if (get_ignore_passive_fiber_force()) {
+        derivatives.setToZero();
+        return;
+    }
+    const double e0 = get_passive_fiber_strain_at_one_norm_force();
+    const double offset = exp(kPE * (m_minNormFiberLength - 1) / e0);
+    const double denom = e0 * (exp(kPE) - offset);
+    for (int i = 0; i < n; ++i) {
+        derivatives[i] =
+                (kPE * exp((kPE * (normFiberLengths[i] - 1)) / e0)) / denom;
+    }
+}
+
+void DeGrooteFregly2016Muscle::calcTendonForceMultiplier(
+        const SimTK::Vector& normTendonLengths,
+        SimTK::Vector& multipliers) const {
+    const double kT = m_kT;
+    const int n = normTendonLengths.size();
+    multipliers.resize(n);
+    for (int i = 0; i < n; ++i) {
+        multipliers[i] = c1 * exp(kT * (normTendonLengths[i] - c2)) - c3;
+    }
+}
+
+void DeGrooteFregly2016Muscle::calcTendonForceMultiplierDerivative(
+        const SimTK::Vector& normTendonLengths,
+        SimTK::Vector& derivatives) const {
+    const double kT = m_kT;
+    const int n = normTendonLengths.size();
+    derivatives.resize(n);
+    for (int i = 0; i < n; ++i) {
+        derivatives[i] = c1 * kT * exp(kT * (normTendonLengths[i] - c2));
+    }
+}
+
 void DeGrooteFregly2016Muscle::printCurvesToSTOFiles(
         const std::string& directory) const {
     const std::string prefix =
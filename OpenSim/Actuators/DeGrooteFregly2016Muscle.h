@@ -538,6 +538,38 @@ public:
                (c1 * m_kT * exp(m_kT * (normTendonLength - c2)));
     }
 
+    /// @name Batch curve calculations.
+    /// Each of these evaluates its scalar counterpart above across a vector
+    /// of inputs — e.g., one muscle's normalized fiber lengths at every mesh
+    /// point of a trajectory — in a single tight loop. Curve constants that
+    /// the scalar methods recompute per call (property lookups and the
+    /// fixed exponentials of the passive curve) are hoisted out of the loop,
+    /// and the loop bodies contain only unit-stride arithmetic and exp/log
+    /// calls so that compilers can vectorize them. The results are identical
+    /// to calling the scalar method elementwise: the operations applied to
+    /// each element are unchanged, so no additional approximation error is
+    /// introduced.
+    /// @{
+    void calcActiveForceLengthMultiplier(const SimTK::Vector& normFiberLengths,
+            SimTK::Vector& multipliers) const;
+    void calcActiveForceLengthMultiplierDerivative(
+            const SimTK::Vector& normFiberLengths,
+            SimTK::Vector& derivatives) const;
+    static void calcForceVelocityMultiplier(
+            const SimTK::Vector& normFiberVelocities,
+            SimTK::Vector& multipliers);
+    void calcPassiveForceMultiplier(const SimTK::Vector& normFiberLengths,
+            SimTK::Vector& multipliers) const;
+    void calcPassiveForceMultiplierDerivative(
+            const SimTK::Vector& normFiberLengths,
+            SimTK::Vector& derivatives) const;
+    void calcTendonForceMultiplier(const SimTK::Vector& normTendonLengths,
+            SimTK::Vector& multipliers) const;
+    void calcTendonForceMultiplierDerivative(
+            const SimTK::Vector& normTendonLengths,
+            SimTK::Vector& derivatives) const;
+    /// @}
+
     /// This computes both the total fiber force and the individual components
     /// of fiber force (active, conservative passive, and non-conservative
     /// passive).
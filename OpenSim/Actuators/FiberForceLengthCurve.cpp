@@ -259,6 +259,22 @@ SimTK::Vec2 FiberForceLengthCurve::getCurveDomain() const
     return m_curve.getCurveDomain();
 }
 
+void FiberForceLengthCurve::buildLookupTable(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.buildLookupTable(tolerance);
+}
+
+bool FiberForceLengthCurve::isLookupTableInUse() const
+{
+    return m_curve.isLookupTableInUse();
+}
+
+void FiberForceLengthCurve::clearLookupTable()
+{
+    m_curve.clearLookupTable();
+}
+
 void FiberForceLengthCurve::printMuscleCurveToCSVFile(const std::string& path)
 {
     ensureCurveUpToDate();
@@ -319,6 +319,26 @@ public:
     */
     SimTK::Vec2 getCurveDomain() const;
 
+    /** Builds a lookup-table approximation of this curve so that subsequent
+    calls to calcValue and calcDerivative are evaluated by interpolating a
+    precomputed uniform grid rather than by numerically inverting the
+    underlying Bezier curve (see SmoothSegmentedFunction::buildLookupTable
+    for details). This function is not const to permit the curve to be
+    rebuilt if it is out-of-date with its properties. Note that changing a
+    property of the curve rebuilds it, which discards the lookup table.
+    @param tolerance
+        The maximum permissible absolute error in the value and first
+        derivative of the curve across its domain.
+    */
+    void buildLookupTable(double tolerance);
+
+    /** @returns True if a lookup table has been built and is being used to
+    evaluate the curve. */
+    bool isLookupTableInUse() const;
+
+    /** Discards the lookup table, restoring exact curve evaluation. */
+    void clearLookupTable();
+
     /** Generates a .csv file with a name that matches the curve name (e.g.,
     "bicepsfemoris_FiberForceLengthCurve.csv"). This function is not const to
     permit the curve to be rebuilt if it is out-of-date with its properties.
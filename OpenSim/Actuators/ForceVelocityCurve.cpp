@@ -23,10 +23,27 @@
 #include "ForceVelocityCurve.h"
 #include <OpenSim/Common/SmoothSegmentedFunctionFactory.h>
 
+#include <array>
+#include <map>
+#include <mutex>
+
 using namespace OpenSim;
 using namespace SimTK;
 using namespace std;
 
+namespace {
+    // Process-wide cache of fitted curves, keyed by the property values that
+    // determine the fit. Fitting is expensive relative to copying the
+    // resulting SmoothSegmentedFunction, so when many models share the same
+    // (typically default) curve properties the fit is performed only once per
+    // process. The cache is capped so that ensembles with continuously
+    // varying curve properties cannot grow it without bound.
+    typedef std::array<double,8> CurveKey;
+    std::mutex curveCacheMutex;
+    std::map<CurveKey, SmoothSegmentedFunction> curveCache;
+    const size_t maxCachedCurves = 256;
+}
+
 //==============================================================================
 // CONSTRUCTION
 //==============================================================================
@@ -86,9 +103,36 @@ void ForceVelocityCurve::constructProperties()
 
 void ForceVelocityCurve::buildCurve()
 {
+    const CurveKey key = {{get_max_eccentric_velocity_force_multiplier(),
+                           get_concentric_slope_at_vmax(),
+                           get_concentric_slope_near_vmax(),
+                           get_isometric_slope(),
+                           get_eccentric_slope_at_vmax(),
+                           get_eccentric_slope_near_vmax(),
+                           get_concentric_curviness(),
+                           get_eccentric_curviness()}};
+    {
+        std::lock_guard<std::mutex> lock(curveCacheMutex);
+        std::map<CurveKey, SmoothSegmentedFunction>::const_iterator it =
+            curveCache.find(key);
+        if (it != curveCache.end()) {
+            m_curve = it->second;
+            std::string name = getName();
+            m_curve.setName(name);
+            setObjectIsUpToDateWithProperties();
+            return;
+        }
+    }
+
     SimTK::Function* f = createSimTKFunction();
     m_curve = *(static_cast<SmoothSegmentedFunction*>(f));
     delete f;
+
+    {
+        std::lock_guard<std::mutex> lock(curveCacheMutex);
+        if (curveCache.size() < maxCachedCurves)
+            curveCache.insert(std::make_pair(key, m_curve));
+    }
     setObjectIsUpToDateWithProperties();
 }
 
@@ -202,6 +246,22 @@ SimTK::Vec2 ForceVelocityCurve::getCurveDomain() const
     return m_curve.getCurveDomain();
 }
 
+void ForceVelocityCurve::buildLookupTable(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.buildLookupTable(tolerance);
+}
+
+bool ForceVelocityCurve::isLookupTableInUse() const
+{
+    return m_curve.isLookupTableInUse();
+}
+
+void ForceVelocityCurve::clearLookupTable()
+{
+    m_curve.clearLookupTable();
+}
+
 void ForceVelocityCurve::printMuscleCurveToCSVFile(const std::string& path)
 {
     ensureCurveUpToDate();
@@ -527,14 +527,90 @@ setFiberLength(SimTK::State& s, double fiberLength) const
 double Millard2012EquilibriumMuscle::
 computeActuation(const SimTK::State& s) const
 {
+    if(get_ignore_tendon_compliance()) {            // rigid tendon
+        // Fiber kinematics follow in closed form from the path length, so
+        // the tendon force can be computed directly without populating the
+        // muscle info caches (which remain lazily available for reporting).
+        const double tendonForce = calcRigidTendonForce(s);
+        setActuation(s, tendonForce);
+        return tendonForce;
+    }
     const MuscleDynamicsInfo& mdi = getMuscleDynamicsInfo(s);
     setActuation(s, mdi.tendonForce);
     return mdi.tendonForce;
 }
 
+double Millard2012EquilibriumMuscle::
+calcRigidTendonForce(const SimTK::State& s) const
+{
+    // Position level; see the rigid-tendon branch of calcMuscleLengthInfo.
+    const double tendonSlackLen = getTendonSlackLength();
+    const double optFiberLen    = getOptimalFiberLength();
+    const double pathLength     = getLength(s);
+    const double lce    = clampFiberLength(
+                            getPennationModel().calcFiberLength(pathLength,
+                                tendonSlackLen));
+    const double lceN   = lce/optFiberLen;
+    const double phi    = getPennationModel().calcPennationAngle(lce);
+    const double cosphi = cos(phi);
+    // Necessary even for the rigid tendon, as it might have gone slack.
+    const double tl     = getPennationModel().calcTendonLength(cosphi, lce,
+                            pathLength);
+
+    // Velocity level; see the rigid-tendon branch of calcFiberVelocityInfo.
+    double dlce  = 0.0;
+    double dlceN = 0.0;
+    double fv    = 1.0;
+    if(tl >= tendonSlackLen - SimTK::SignificantReal) {
+        // The tendon is not buckling, so the fiber absorbs the path speed.
+        dlce  = getPennationModel().calcFiberVelocity(cosphi,
+                    getLengtheningSpeed(s), 0.0);
+        dlceN = dlce/(optFiberLen*getMaxContractionVelocity());
+        fv    = get_ForceVelocityCurve().calcValue(dlceN);
+    }
+
+    // A clamped fiber transmits no force; see calcMuscleDynamicsInfo.
+    if(isFiberStateClamped(lce,dlce)) {
+        return 0.0;
+    }
+
+    SimTK_ERRCHK_ALWAYS(lce > SimTK::SignificantReal,
+        "calcRigidTendonForce",
+        "The muscle fiber has a length of 0, causing a singularity");
+    SimTK_ERRCHK_ALWAYS(cosphi > SimTK::SignificantReal,
+        "calcRigidTendonForce",
+        "Pennation angle is 90 degrees, causing a singularity");
+
+    double a = SimTK::NaN;
+    if(!get_ignore_activation_dynamics()) {
+        a = getActivationModel().clampActivation(
+                getStateVariableValue(s, STATE_ACTIVATION_NAME));
+    } else {
+        a = getActivationModel().clampActivation(getControl(s));
+    }
+
+    const double fiso = getMaxIsometricForce();
+    const double fal  = get_ActiveForceLengthCurve().calcValue(lceN);
+    const double fpe  = get_FiberForceLengthCurve().calcValue(lceN);
+
+    const SimTK::Vec4 fiberForceV =
+        calcFiberForce(fiso, a, fal, fv, fpe, dlceN);
+    double fm = fiberForceV[0];
+    // The fiber must generate only tensile forces; the damping force from
+    // the parallel element saturates so that the total is never compressive.
+    if(fm < 0) {
+        fm = 0.0;
+    }
+
+    const double fmAT = fm*cosphi;
+    const double fse  = fmAT/fiso;
+    return fse*fiso;
+}
+
 
 void Millard2012EquilibriumMuscle::
-computeFiberEquilibrium(SimTK::State& s, bool solveForVelocity) const
+computeFiberEquilibrium(SimTK::State& s, bool solveForVelocity,
+                        double previousFiberLength) const
 {
     if(get_ignore_tendon_compliance()) {                    // rigid tendon
         return;
@@ -560,7 +636,7 @@ computeFiberEquilibrium(SimTK::State& s, bool solveForVelocity) const
         std::pair<StatusFromEstimateMuscleFiberState,
                   ValuesFromEstimateMuscleFiberState> result =
             estimateMuscleFiberState(activation, pathLength, pathSpeed,
-                tol, maxIter, solveForVelocity);
+                tol, maxIter, solveForVelocity, previousFiberLength);
 
         switch(result.first) {
 
@@ -595,6 +671,43 @@ computeFiberEquilibrium(SimTK::State& s, bool solveForVelocity) const
     }
 }
 
+SimTK::Vector Millard2012EquilibriumMuscle::
+computeFiberEquilibria(const Model& model, SimTK::State& s,
+                       const SimTK::Vector& previousFiberLengths,
+                       bool solveForVelocity)
+{
+    model.getMultibodySystem().realize(s, SimTK::Stage::Velocity);
+
+    auto muscles = model.getComponentList<Millard2012EquilibriumMuscle>();
+    int numMuscles = 0;
+    for (const auto& muscle : muscles) {
+        (void)muscle;
+        ++numMuscles;
+    }
+
+    OPENSIM_THROW_IF(previousFiberLengths.size() > 0 &&
+            previousFiberLengths.size() != numMuscles, Exception,
+            "Expected previousFiberLengths to be empty or of size {}, "
+            "but it is of size {}.",
+            numMuscles, previousFiberLengths.size());
+
+    SimTK::Vector fiberLengths(numMuscles, SimTK::NaN);
+    int i = 0;
+    for (const auto& muscle : muscles) {
+        if (muscle.appliesForce(s) && !muscle.get_ignore_tendon_compliance()) {
+            const double previousFiberLength =
+                    (previousFiberLengths.size() > 0)
+                            ? previousFiberLengths[i]
+                            : SimTK::NaN;
+            muscle.computeFiberEquilibrium(s, solveForVelocity,
+                    previousFiberLength);
+        }
+        fiberLengths[i] = muscle.getFiberLength(s);
+        ++i;
+    }
+    return fiberLengths;
+}
+
 //==============================================================================
 // SCALING
 //==============================================================================
@@ -1364,7 +1477,8 @@ Millard2012EquilibriumMuscle::estimateMuscleFiberState(
                                     const double pathLengtheningSpeed,
                                     const double aSolTolerance,
                                     const int aMaxIterations,
-                                    bool staticSolution) const
+                                    bool staticSolution,
+                                    double initialFiberLength) const
 {
     // If seeking a static solution, set velocities to zero and avoid the
     // velocity-sharing algorithm below, as it can produce nonzero fiber and
@@ -1393,7 +1507,10 @@ Millard2012EquilibriumMuscle::estimateMuscleFiberState(
 
     // Position level
     double tl  = getTendonSlackLength()*1.01;  // begin with small tendon force
-    double lce = clampFiberLength(getPennationModel().calcFiberLength(ml,tl));
+    double lce = SimTK::isNaN(initialFiberLength)
+                 ? clampFiberLength(getPennationModel().calcFiberLength(ml,tl))
+                 : clampFiberLength(initialFiberLength); // warm start from a
+                                                         // previous solution
 
     double phi = 0.0;
     double cosphi = 1.0;
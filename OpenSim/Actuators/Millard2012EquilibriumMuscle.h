@@ -434,13 +434,50 @@ public:
     /** Computes the fiber length such that the fiber and tendon are developing
         the same force, either assuming muscle-tendon velocity as provided
         by the state or zero as designated by the useZeroVelocity flag.
+        The Newton solve normally begins from a generic initial guess (a
+        nearly slack tendon); pass previousFiberLength to warm-start the
+        solve from a previous solution instead. When initializing states
+        along a trajectory, warm-starting each solve from the fiber length
+        solved at the previous time point typically converges in 1-2
+        iterations rather than 10+.
         @param[in,out] s         The state of the system.
         @param solveForVelocity  Flag indicating to solve for fiber velocity,
                                  which by default is false (zero fiber-velocity)
+        @param previousFiberLength  Fiber length (m) from which to start the
+                                 Newton solve, e.g., the solution at the
+                                 previous time point. NaN (the default) uses
+                                 the generic initial guess.
         @throws MuscleCannotEquilibrate
     */
-    void computeFiberEquilibrium(SimTK::State& s, 
-                                 bool solveForVelocity = false) const;
+    void computeFiberEquilibrium(SimTK::State& s,
+                                 bool solveForVelocity = false,
+                                 double previousFiberLength
+                                     = SimTK::NaN) const;
+
+    /** Calls computeFiberEquilibrium() on every Millard2012EquilibriumMuscle
+        in the model that applies force and has an elastic tendon,
+        warm-starting each muscle's Newton solve from the corresponding entry
+        of previousFiberLengths, and returns the solved fiber lengths in the
+        same order. When initializing states along a trajectory, feed the
+        returned vector back in at the next time point so that each solve
+        starts from the previous solution. Pass an empty vector (or NaN
+        entries) to use the generic initial guess.
+        @param model     The model containing the muscles.
+        @param[in,out] s The state of the system.
+        @param previousFiberLengths  Fiber lengths (m) from which to start
+                         each solve, sized to the number of
+                         Millard2012EquilibriumMuscles in the model, or empty.
+        @param solveForVelocity  Flag indicating to solve for fiber velocity,
+                                 which by default is false (zero
+                                 fiber-velocity)
+        @returns The solved fiber lengths (m), one per
+                 Millard2012EquilibriumMuscle in the model.
+        @throws MuscleCannotEquilibrate
+    */
+    static SimTK::Vector computeFiberEquilibria(const Model& model,
+        SimTK::State& s,
+        const SimTK::Vector& previousFiberLengths = SimTK::Vector(),
+        bool solveForVelocity = false);
 
 //==============================================================================
 // DEPRECATED
@@ -671,6 +708,17 @@ private:
                                                double beta,
                                                double dlceN_dt) const;
 
+    /*  Reduced evaluation path used by computeActuation() when the tendon is
+    rigid: fiber kinematics follow in closed form from the path length, so the
+    tendon force is computed directly without populating the muscle length,
+    velocity, and dynamics info caches (which remain lazily available for
+    reporting). Mirrors the rigid-tendon branches of calcMuscleLengthInfo,
+    calcFiberVelocityInfo, and calcMuscleDynamicsInfo and must be kept
+    consistent with them.
+        @param s the state of the system
+        @returns the tensile force the muscle is generating (N) */
+    double calcRigidTendonForce(const SimTK::State& s) const;
+
     /*  @param fiberForce the force, in Newtons, developed by the fiber
         @param fiberStiffness the stiffness, in N/m, of the fiber
         @param lce the fiber length
@@ -759,6 +807,8 @@ private:
            give up attempting to initialize the model
     @param staticSolution set to true to calculate the static equilibrium
            solution, setting fiber and tendon velocities to zero
+    @param initialFiberLength fiber length (m) from which to start the Newton
+           solve; NaN uses the generic initial guess (a nearly slack tendon)
     */
     std::pair<StatusFromEstimateMuscleFiberState,
               ValuesFromEstimateMuscleFiberState>
@@ -767,7 +817,9 @@ private:
                                  const double pathLengtheningSpeed,
                                  const double aSolTolerance,
                                  const int aMaxIterations,
-                                 bool staticSolution=false) const;
+                                 bool staticSolution=false,
+                                 double initialFiberLength
+                                     = SimTK::NaN) const;
 
 };
 } //end of namespace OpenSim
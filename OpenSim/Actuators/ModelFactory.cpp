@@ -292,6 +292,21 @@ void ModelFactory::createReserveActuators(Model& model, double optimalForce,
 
     Model modelCopy(model);
     auto state = modelCopy.initSystem();
+
+    // Configure the properties shared by every reserve once on a prototype
+    // and replicate it per coordinate, rather than constructing and setting
+    // each actuator's properties individually.
+    CoordinateActuator prototype;
+    prototype.setOptimalForce(optimalForce);
+    if (!SimTK::isNaN(bound)) {
+        OPENSIM_THROW_IF(bound < 0, Exception,
+                "Expected a non-negative bound but got {}.", bound);
+        prototype.setMinControl(-bound);
+        prototype.setMaxControl(bound);
+    }
+    // Pool the replicas' property trees (see ObjectAllocationArena).
+    ObjectAllocationArena arena;
+
     std::vector<std::string> coordPaths;
     // Borrowed from
     // CoordinateActuator::CreateForceSetOfCoordinateAct...
@@ -309,7 +324,7 @@ void ModelFactory::createReserveActuators(Model& model, double optimalForce,
         }
 
         if (!coord.isConstrained(state) && !skipCoord) {
-            auto* actu = new CoordinateActuator();
+            auto* actu = prototype.clone();
             actu->setCoordinate(&model.updComponent<Coordinate>(
                     coord.getAbsolutePathString()));
             auto path = coord.getAbsolutePathString();
@@ -317,13 +332,6 @@ void ModelFactory::createReserveActuators(Model& model, double optimalForce,
             // Get rid of slashes in the path; slashes not allowed in names.
             std::replace(path.begin(), path.end(), '/', '_');
             actu->setName("reserve" + path);
-            actu->setOptimalForce(optimalForce);
-            if (!SimTK::isNaN(bound)) {
-                OPENSIM_THROW_IF(bound < 0, Exception,
-                        "Expected a non-negative bound but got {}.", bound);
-                actu->setMinControl(-bound);
-                actu->setMaxControl(bound);
-            }
             model.addForce(actu);
         }
     }
@@ -21,6 +21,7 @@
 #include "ModelProcessor.h"
 
 #include <OpenSim/Actuators/ModelFactory.h>
+#include <OpenSim/Actuators/PolynomialPathFitter.h>
 #include <OpenSim/Simulation/Model/ExternalLoads.h>
 
 namespace OpenSim {
@@ -188,6 +189,32 @@ public:
     }
 };
 
+/** Replace the model's point-based actuator paths with fitted polynomial
+FunctionBasedPaths using PolynomialPathFitter. */
+class OSIMACTUATORS_API ModOpReplacePathsWithFunctionBasedPaths
+        : public ModelOperator {
+    OpenSim_DECLARE_CONCRETE_OBJECT(
+            ModOpReplacePathsWithFunctionBasedPaths, ModelOperator);
+    OpenSim_DECLARE_UNNAMED_PROPERTY(PolynomialPathFitter,
+            "The fitter used to sample the model's paths and fit the "
+            "polynomial length functions.");
+
+public:
+    ModOpReplacePathsWithFunctionBasedPaths() {
+        constructProperty_PolynomialPathFitter(PolynomialPathFitter());
+    }
+    ModOpReplacePathsWithFunctionBasedPaths(
+            const PolynomialPathFitter& fitter)
+            : ModOpReplacePathsWithFunctionBasedPaths() {
+        set_PolynomialPathFitter(fitter);
+    }
+    void operate(Model& model, const std::string&) const override {
+        model.finalizeFromProperties();
+        model.finalizeConnections();
+        get_PolynomialPathFitter().fit(model);
+    }
+};
+
 } // namespace OpenSim
 
 #endif // OPENSIM_MODELOPERATORS_H
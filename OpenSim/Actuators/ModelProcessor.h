@@ -20,6 +20,14 @@
 
 #include "osimActuatorsDLL.h"
 
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
 namespace OpenSim {
@@ -42,7 +50,18 @@ property or the filepath property. In C++, one can easily chain together
 the operators in a processor using the C++ pipe operator:
 @code
 ModelProcessor proc = ModelProcessor("model.osim") | ModOpAddReserves();
-@endcode */
+@endcode
+
+Processed models can be cached so that the operator chain executes once per
+unique input rather than once per process() call: set the cache_directory
+property to enable a two-tier cache keyed by a hash of the source model's
+content and the serialized operator chain. Results are kept in a
+process-wide in-memory table and written as .osim files into the cache
+directory, so repeated studies (e.g., MocoTrack and MocoInverse sweeps over
+the same base model) — and repeated runs of the same program — reuse the
+processed model. Note that the hash covers the source model and the
+operators' properties, not any auxiliary files an operator reads by path;
+clear the cache directory if such files change. */
 class OSIMACTUATORS_API ModelProcessor : public Object {
     OpenSim_DECLARE_CONCRETE_OBJECT(ModelProcessor, Object);
 
@@ -51,11 +70,16 @@ public:
             filepath, std::string, "File path to a Model (.osim).");
     OpenSim_DECLARE_LIST_PROPERTY(operators, ModelOperator,
             "Operators to apply to the source Model of this processor.");
+    OpenSim_DECLARE_PROPERTY(cache_directory, std::string,
+            "Directory for caching processed models, keyed by a hash of the "
+            "source model and operator chain; leave empty (default) to "
+            "disable caching.");
     /** This constructor is only for use when reading (deserializing) from an
     XML file. */
     ModelProcessor() {
         constructProperty_filepath("");
         constructProperty_operators();
+        constructProperty_cache_directory("");
         constructProperty_model();
     }
 
@@ -104,8 +128,30 @@ public:
 
     /** Process and obtain the model. If the base model is specified via the
     filepath property, the filepath will be evaluated relative to
-    `relativeToDirectory`, if provided. */
+    `relativeToDirectory`, if provided. If the cache_directory property is
+    set, a previously processed model with the same content hash is returned
+    (from memory or from disk) without re-running the operators. */
     Model process(const std::string& relativeToDirectory = {}) const {
+        std::string cacheKey;
+        if (!get_cache_directory().empty()) {
+            cacheKey = computeCacheKey(relativeToDirectory);
+            {
+                std::lock_guard<std::mutex> lock(cacheMutex());
+                const auto it = memoryCache().find(cacheKey);
+                if (it != memoryCache().end()) return it->second;
+            }
+            const std::string cacheFile =
+                    get_cache_directory() + "/" + cacheKey + ".osim";
+            if (std::ifstream(cacheFile).good()) {
+                Model cached(cacheFile);
+                cached.finalizeFromProperties();
+                cached.finalizeConnections();
+                std::lock_guard<std::mutex> lock(cacheMutex());
+                memoryCache().emplace(cacheKey, cached);
+                return cached;
+            }
+        }
+
         Model model;
         if (get_filepath().empty()) {
             if (!getProperty_model().empty()) {
@@ -133,9 +179,24 @@ public:
         for (int i = 0; i < getProperty_operators().size(); ++i) {
             get_operators(i).operate(model, relativeToDirectory);
         }
+
+        if (!cacheKey.empty()) {
+            if (!IO::isDirectory(get_cache_directory()))
+                IO::makeDir(get_cache_directory());
+            model.print(get_cache_directory() + "/" + cacheKey + ".osim");
+            std::lock_guard<std::mutex> lock(cacheMutex());
+            memoryCache().emplace(cacheKey, model);
+        }
         return model;
     }
 
+    /** Empty the process-wide in-memory tier of the processed-model cache.
+    Cached .osim files in cache directories are left in place. */
+    static void clearMemoryCache() {
+        std::lock_guard<std::mutex> lock(cacheMutex());
+        memoryCache().clear();
+    }
+
     /** Append an operation to the end of the operations in this processor. */
     ModelProcessor& append(const ModelOperator& op) {
         append_operators(op);
@@ -151,6 +212,50 @@ public:
 
 private:
     OpenSim_DECLARE_OPTIONAL_PROPERTY(model, Model, "Base model to process.");
+
+    // FNV-1a hash of the source model's content (the .osim file's bytes, or
+    // the in-memory model's XML) and the serialized operator chain, as a
+    // 16-character hex string used to name cache entries.
+    std::string computeCacheKey(const std::string& relativeToDirectory) const {
+        std::uint64_t hash = 14695981039346656037ULL;
+        auto mix = [&hash](const std::string& text) {
+            for (const unsigned char c : text) {
+                hash ^= c;
+                hash *= 1099511628211ULL;
+            }
+        };
+        if (get_filepath().empty()) {
+            if (!getProperty_model().empty()) mix(get_model().dump());
+        } else {
+            std::string path = get_filepath();
+            if (!relativeToDirectory.empty()) {
+                path = SimTK::Pathname::
+                        getAbsolutePathnameUsingSpecifiedWorkingDirectory(
+                                relativeToDirectory, path);
+            }
+            std::ifstream file(path, std::ios::binary);
+            std::stringstream contents;
+            contents << file.rdbuf();
+            mix(contents.str());
+        }
+        // relativeToDirectory anchors any files the operators read by path.
+        mix(relativeToDirectory);
+        for (int i = 0; i < getProperty_operators().size(); ++i) {
+            mix(get_operators(i).dump());
+        }
+        std::stringstream key;
+        key << std::hex << std::setfill('0') << std::setw(16) << hash;
+        return key.str();
+    }
+
+    static std::unordered_map<std::string, Model>& memoryCache() {
+        static std::unordered_map<std::string, Model> cache;
+        return cache;
+    }
+    static std::mutex& cacheMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
 };
 
 } // namespace OpenSim
@@ -0,0 +1,117 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  MuscleBatchEvaluator.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MuscleBatchEvaluator.h"
+
+#include <cmath>
+
+#include "DeGrooteFregly2016Muscle.h"
+#include "Millard2012EquilibriumMuscle.h"
+#include "Thelen2003Muscle.h"
+
+using namespace OpenSim;
+
+MuscleBatchEvaluator::MuscleBatchEvaluator(const Model& model)
+{
+    const Set<Muscle>& muscles = model.getMuscles();
+    m_numMuscles = muscles.getSize();
+    m_numBatchedMuscles = 0;
+    m_batched.assign(m_numMuscles, false);
+
+    for (int i = 0; i < m_numMuscles; ++i) {
+        const Muscle& muscle = muscles.get(i);
+        if (muscle.get_ignore_activation_dynamics())
+            continue;
+
+        const MuscleFirstOrderActivationDynamicModel* actMdl = nullptr;
+        if (const auto* millard =
+                        dynamic_cast<const Millard2012EquilibriumMuscle*>(
+                                &muscle)) {
+            actMdl = &millard->getActivationModel();
+        } else if (const auto* thelen =
+                           dynamic_cast<const Thelen2003Muscle*>(&muscle)) {
+            actMdl = &thelen->getActivationModel();
+        }
+        if (actMdl != nullptr) {
+            m_firstOrder.muscles.push_back(&muscle);
+            m_firstOrder.indices.push_back(i);
+            m_firstOrder.actTau.push_back(
+                    actMdl->get_activation_time_constant());
+            m_firstOrder.deactTau.push_back(
+                    actMdl->get_deactivation_time_constant());
+            m_firstOrder.minActivation.push_back(
+                    actMdl->get_minimum_activation());
+            m_batched[i] = true;
+            ++m_numBatchedMuscles;
+            continue;
+        }
+
+        if (const auto* dgf = dynamic_cast<const DeGrooteFregly2016Muscle*>(
+                    &muscle)) {
+            m_tanh.muscles.push_back(dgf);
+            m_tanh.indices.push_back(i);
+            m_tanh.actTau.push_back(dgf->get_activation_time_constant());
+            m_tanh.deactTau.push_back(dgf->get_deactivation_time_constant());
+            m_batched[i] = true;
+            ++m_numBatchedMuscles;
+        }
+    }
+}
+
+void MuscleBatchEvaluator::calcActivationDerivatives(
+        const SimTK::State& s, SimTK::Vector& rDADT) const
+{
+    rDADT.resize(m_numMuscles);
+    rDADT = SimTK::NaN;
+
+    // First-order model (Millard2012EquilibriumMuscle, Thelen2003Muscle);
+    // mirrors MuscleFirstOrderActivationDynamicModel::calcDerivative().
+    for (size_t k = 0; k < m_firstOrder.muscles.size(); ++k) {
+        const Muscle& muscle = *m_firstOrder.muscles[k];
+        double a = muscle.getActivation(s);
+        const double u = muscle.getExcitation(s);
+        const double aMin = m_firstOrder.minActivation[k];
+        if (a < aMin)
+            a = aMin;
+        else if (a > 1.0)
+            a = 1.0;
+        const double tau = (u > a)
+                ? m_firstOrder.actTau[k] * (0.5 + 1.5*a)
+                : m_firstOrder.deactTau[k] / (0.5 + 1.5*a);
+        rDADT[m_firstOrder.indices[k]] = (u - a) / tau;
+    }
+
+    // Tanh-smoothed model; mirrors the activation-dynamics block of
+    // DeGrooteFregly2016Muscle::computeStateVariableDerivatives().
+    static const double tanhSteepness = 0.1;
+    for (size_t k = 0; k < m_tanh.muscles.size(); ++k) {
+        const Muscle& muscle = *m_tanh.muscles[k];
+        const double a = muscle.getActivation(s);
+        const double u = muscle.getExcitation(s);
+        const double timeConstFactor = 0.5 + 1.5*a;
+        const double tempAct = 1.0 / (m_tanh.actTau[k] * timeConstFactor);
+        const double tempDeact = timeConstFactor / m_tanh.deactTau[k];
+        const double f = 0.5 * tanh(tanhSteepness * (u - a));
+        const double timeConst = tempAct * (f + 0.5) + tempDeact * (-f + 0.5);
+        rDADT[m_tanh.indices[k]] = timeConst * (u - a);
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef OPENSIM_MUSCLEBATCHEVALUATOR_H
+#define OPENSIM_MUSCLEBATCHEVALUATOR_H
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  MuscleBatchEvaluator.h                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimActuatorsDLL.h"
+
+#include <vector>
+
+#include <OpenSim/Simulation/Model/Model.h>
+
+namespace OpenSim {
+
+class DeGrooteFregly2016Muscle;
+
+/**
+ * An opt-in helper that evaluates the activation dynamics of all muscles in
+ * a model in one pass per muscle type, instead of dispatching through each
+ * muscle's virtual computeStateVariableDerivatives() chain.
+ *
+ * At construction, the evaluator walks the model's muscle set and groups
+ * muscles whose activation dynamics it recognizes:
+ *  - Millard2012EquilibriumMuscle and Thelen2003Muscle, which both use
+ *    MuscleFirstOrderActivationDynamicModel, and
+ *  - DeGrooteFregly2016Muscle, which uses a tanh-smoothed variant.
+ *
+ * The time constants and minimum activation of each group are copied into
+ * structure-of-arrays storage so that calcActivationDerivatives() touches
+ * contiguous parameter memory and evaluates each group in a tight loop,
+ * reproducing each muscle's own derivative bit for bit. Muscles of other
+ * types, and muscles with ignore_activation_dynamics enabled, are left out
+ * of the batch; their entries in the result are NaN and the caller should
+ * fall back to the per-muscle path for them (see isBatched()).
+ *
+ * Fiber dynamics remain on the per-muscle path: they are entangled with
+ * each muscle's curve subcomponents and the multibody realization cache and
+ * cannot be hoisted out without duplicating them.
+ *
+ * The evaluator snapshots muscle parameters at construction; reconstruct it
+ * if muscles are added, removed, or their properties change.
+ */
+class OSIMACTUATORS_API MuscleBatchEvaluator {
+public:
+    /** Group the muscles of the model (which must have a valid system, i.e.
+    initSystem() has been called) by activation-dynamics type and snapshot
+    their parameters. */
+    explicit MuscleBatchEvaluator(const Model& model);
+
+    /** The number of muscles in the model's muscle set; indices into the
+    result of calcActivationDerivatives() follow that set's order. */
+    int getNumMuscles() const { return m_numMuscles; }
+
+    /** The number of muscles whose activation dynamics are evaluated in a
+    batched group. */
+    int getNumBatchedMuscles() const { return m_numBatchedMuscles; }
+
+    /** Whether the muscle at the given index in the model's muscle set is
+    evaluated in a batched group. */
+    bool isBatched(int muscleIndex) const {
+        return m_batched[muscleIndex];
+    }
+
+    /** Compute the activation state derivative of every batched muscle at
+    the provided state, which must be realized to the stage required by
+    Muscle::getExcitation() and Muscle::getActivation(). rDADT is resized to
+    getNumMuscles(); entries of muscles that are not batched are NaN. */
+    void calcActivationDerivatives(
+            const SimTK::State& s, SimTK::Vector& rDADT) const;
+
+private:
+    /** Muscles governed by MuscleFirstOrderActivationDynamicModel. */
+    struct FirstOrderGroup {
+        std::vector<const Muscle*> muscles;
+        std::vector<int> indices;
+        std::vector<double> actTau;
+        std::vector<double> deactTau;
+        std::vector<double> minActivation;
+    };
+    /** DeGrooteFregly2016Muscle%s, which use tanh-smoothed switching. */
+    struct TanhGroup {
+        std::vector<const DeGrooteFregly2016Muscle*> muscles;
+        std::vector<int> indices;
+        std::vector<double> actTau;
+        std::vector<double> deactTau;
+    };
+
+    int m_numMuscles;
+    int m_numBatchedMuscles;
+    std::vector<bool> m_batched;
+    FirstOrderGroup m_firstOrder;
+    TanhGroup m_tanh;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MUSCLEBATCHEVALUATOR_H
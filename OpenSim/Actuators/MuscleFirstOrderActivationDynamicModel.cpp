@@ -80,12 +80,44 @@ calcDerivative(double activation, double excitation) const
     activation = clamp(get_minimum_activation(), activation, 1.0);
 
     double tau = (excitation > activation) ?
-        get_activation_time_constant() * (0.5 + 1.5*activation) : 
+        get_activation_time_constant() * (0.5 + 1.5*activation) :
         get_deactivation_time_constant() / (0.5 + 1.5*activation);
 
     return (excitation - activation) / tau;
 }
 
+double MuscleFirstOrderActivationDynamicModel::
+calc_DDerivative_DActivation(double activation, double excitation) const
+{
+    // The clamp in calcDerivative makes dadt insensitive to activation
+    // outside the clamping range.
+    if(activation < get_minimum_activation() || activation > 1.0)
+        return 0;
+
+    if(excitation > activation) {
+        // dadt = (u-a) / (tauA*(0.5+1.5a))
+        double tau = get_activation_time_constant() * (0.5 + 1.5*activation);
+        return -1.0/tau
+               - (excitation-activation)*1.5*get_activation_time_constant()
+                 / (tau*tau);
+    }
+    // dadt = (u-a)*(0.5+1.5a) / tauD
+    return (-(0.5 + 1.5*activation) + 1.5*(excitation-activation))
+           / get_deactivation_time_constant();
+}
+
+double MuscleFirstOrderActivationDynamicModel::
+calc_DDerivative_DExcitation(double activation, double excitation) const
+{
+    activation = clamp(get_minimum_activation(), activation, 1.0);
+
+    double tau = (excitation > activation) ?
+        get_activation_time_constant() * (0.5 + 1.5*activation) :
+        get_deactivation_time_constant() / (0.5 + 1.5*activation);
+
+    return 1.0 / tau;
+}
+
 //==============================================================================
 // COMPONENT INTERFACE
 //==============================================================================
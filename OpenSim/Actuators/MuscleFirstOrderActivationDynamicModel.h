@@ -111,6 +111,22 @@ public:
     /** Calculates the time derivative of activation. */
     double calcDerivative(double activation, double excitation) const;
 
+    /** Calculates the partial derivative of the activation time derivative
+    (as computed by calcDerivative) with respect to activation. The partial
+    is zero when the activation argument lies outside the clamping range
+    [minActivation, 1.0], and otherwise follows the same branch selection as
+    calcDerivative at the kink where excitation equals activation. Implicit
+    formulations can use
+    this and calc_DDerivative_DExcitation() to build Jacobians in closed form
+    rather than by finite differences. */
+    double calc_DDerivative_DActivation(double activation,
+                                        double excitation) const;
+
+    /** Calculates the partial derivative of the activation time derivative
+    (as computed by calcDerivative) with respect to excitation. */
+    double calc_DDerivative_DExcitation(double activation,
+                                        double excitation) const;
+
 protected:
     // Component interface.
     void extendFinalizeFromProperties() override;
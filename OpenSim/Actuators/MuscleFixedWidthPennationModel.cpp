@@ -326,6 +326,60 @@ calc_DTendonLength_DfiberLength(double fiberLength,
            - cosPennationAngle;
 }
 
+//==============================================================================
+// Partial derivatives with respect to fiber velocity
+//==============================================================================
+double MuscleFixedWidthPennationModel::
+calc_DPennationAngularVelocity_DfiberVelocity(double tanPennationAngle,
+                                              double fiberLength) const
+{
+    double Ddphi_Ddlce = 0;
+    double optimalPennationAngle = get_pennation_angle_at_optimal();
+
+    if(optimalPennationAngle > SimTK::Eps) {
+        SimTK_ERRCHK_ALWAYS(fiberLength > 0,
+         "MuscleFixedWidthPennationModel::"
+         "calc_DPennationAngularVelocity_DfiberVelocity",
+         "Fiber length cannot be zero.");
+        // dphidot_ddlce = d/ddlce (-(dlce/lce)*tan(phi))
+        Ddphi_Ddlce = -tanPennationAngle/fiberLength;
+    }
+    return Ddphi_Ddlce;
+}
+
+double MuscleFixedWidthPennationModel::
+calc_DFiberVelocityAlongTendon_DfiberVelocity(double fiberLength,
+                        double sinPennationAngle,
+                        double cosPennationAngle,
+                        double DpennationAngularVelocity_DfiberVelocity) const
+{
+    // d/ddlce (dlce*cos(phi) - lce*sin(phi)*dphi)
+    return cosPennationAngle - fiberLength*sinPennationAngle
+                               *DpennationAngularVelocity_DfiberVelocity;
+}
+
+double MuscleFixedWidthPennationModel::
+calc_DTendonVelocity_DfiberVelocity(double fiberLength,
+                        double sinPennationAngle,
+                        double cosPennationAngle,
+                        double DpennationAngularVelocity_DfiberVelocity) const
+{
+    // d/ddlce (dlmt - dlce*cos(phi) + lce*sin(phi)*dphi)
+    return -cosPennationAngle + fiberLength*sinPennationAngle
+                                *DpennationAngularVelocity_DfiberVelocity;
+}
+
+double MuscleFixedWidthPennationModel::
+calc_DFiberVelocity_DfiberLength(double muscleVelocity,
+                                 double tendonVelocity,
+                                 double sinPennationAngle,
+                                 double DpennationAngle_DfiberLength) const
+{
+    // d/dlce ((dlmt-dlt)*cos(phi)) = -(dlmt-dlt)*sin(phi)*dphi_dlce
+    return -(muscleVelocity-tendonVelocity)*sinPennationAngle
+           *DpennationAngle_DfiberLength;
+}
+
 //==============================================================================
 // Kinematic fiber pose equations (useful during initialization)
 //==============================================================================
@@ -354,3 +408,19 @@ calcFiberVelocity(double cosPennationAngle,
     // Solve (2) for phidot, substitute into (1), and solve for v^M.
     return (muscleVelocity-tendonVelocity)*cosPennationAngle;
 }
+
+double MuscleFixedWidthPennationModel::
+calc_DFiberLength_DmuscleLength(double muscleLength,
+                                double tendonLength) const
+{
+    double fiberLengthAT = muscleLength-tendonLength;
+    double Dlce_Dlmt     = 0.0;
+
+    if(fiberLengthAT >= getMinimumFiberLengthAlongTendon()) {
+        // d/dlmt sqrt(h^2 + (lmt-lt)^2) = (lmt-lt)/lce
+        Dlce_Dlmt = fiberLengthAT
+                    / sqrt(m_parallelogramHeight*m_parallelogramHeight
+                           + fiberLengthAT*fiberLengthAT);
+    }
+    return Dlce_Dlmt;
+}
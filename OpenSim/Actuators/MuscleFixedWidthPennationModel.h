@@ -295,6 +295,40 @@ public:
                                            double DpennationAngle_DfiberLength)
                                            const;
 
+    /** Calculates the partial derivative of the pennation angular velocity
+    with respect to the fiber velocity. Together with the partial derivatives
+    below, this allows implicit formulations to assemble the Jacobian of the
+    velocity-level kinematics in closed form rather than by finite
+    differences. */
+    double calc_DPennationAngularVelocity_DfiberVelocity(
+                                    double tanPennationAngle,
+                                    double fiberLength) const;
+
+    /** Calculates the partial derivative of the fiber velocity along the
+    tendon with respect to the fiber velocity. */
+    double calc_DFiberVelocityAlongTendon_DfiberVelocity(
+                        double fiberLength,
+                        double sinPennationAngle,
+                        double cosPennationAngle,
+                        double DpennationAngularVelocity_DfiberVelocity) const;
+
+    /** Calculates the partial derivative of the tendon velocity with respect
+    to the fiber velocity. */
+    double calc_DTendonVelocity_DfiberVelocity(
+                        double fiberLength,
+                        double sinPennationAngle,
+                        double cosPennationAngle,
+                        double DpennationAngularVelocity_DfiberVelocity) const;
+
+    /** Calculates the partial derivative of the fiber velocity (as computed
+    by calcFiberVelocity) with respect to the fiber length, holding the
+    musculotendon and tendon velocities fixed. */
+    double calc_DFiberVelocity_DfiberLength(
+                        double muscleVelocity,
+                        double tendonVelocity,
+                        double sinPennationAngle,
+                        double DpennationAngle_DfiberLength) const;
+
     /**
     @param muscleLength
         The length of the musculotendon actuator (m).
@@ -320,6 +354,12 @@ public:
                              double muscleVelocity,
                              double tendonVelocity) const;
 
+    /** Calculates the partial derivative of the fiber length (as computed by
+    calcFiberLength) with respect to the musculotendon length. The derivative
+    is zero when the fiber is at its lower bound. */
+    double calc_DFiberLength_DmuscleLength(double muscleLength,
+                                           double tendonLength) const;
+
 protected:
     // Component interface.
     void extendFinalizeFromProperties() override;
@@ -0,0 +1,280 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: PolynomialPathFitter.cpp                                          *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2023 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "PolynomialPathFitter.h"
+
+#include <OpenSim/Common/MultivariatePolynomialFunction.h>
+#include <OpenSim/Simulation/Model/FunctionBasedPath.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/PathActuator.h>
+#include <OpenSim/Simulation/MomentArmSolver.h>
+
+using namespace OpenSim;
+
+using SimTK::Matrix;
+using SimTK::Vector;
+
+namespace {
+
+// Enumerate the exponent tuple of every polynomial term, in the coefficient
+// order expected by MultivariatePolynomialFunction.
+std::vector<std::array<int, 4>> enumerateTerms(int dimension, int order) {
+    std::vector<std::array<int, 4>> terms;
+    std::array<int, 4> nq{{0, 0, 0, 0}};
+    for (nq[0] = 0; nq[0] < order + 1; ++nq[0]) {
+        int nq2_s = (dimension < 2) ? 0 : order - nq[0];
+        for (nq[1] = 0; nq[1] < nq2_s + 1; ++nq[1]) {
+            int nq3_s = (dimension < 3) ? 0 : order - nq[0] - nq[1];
+            for (nq[2] = 0; nq[2] < nq3_s + 1; ++nq[2]) {
+                int nq4_s =
+                        (dimension < 4) ? 0 : order - nq[0] - nq[1] - nq[2];
+                for (nq[3] = 0; nq[3] < nq4_s + 1; ++nq[3]) {
+                    terms.push_back(nq);
+                }
+            }
+        }
+    }
+    return terms;
+}
+
+// Evaluate one polynomial term at a point.
+double evalTerm(const std::array<int, 4>& exponents, const Vector& q) {
+    double value = 1.0;
+    for (int i = 0; i < q.size(); ++i) {
+        value *= std::pow(q[i], exponents[i]);
+    }
+    return value;
+}
+
+// Evaluate the first derivative of one polynomial term with respect to input
+// component d at a point.
+double evalTermDerivative(
+        const std::array<int, 4>& exponents, const Vector& q, int d) {
+    if (exponents[d] == 0) { return 0.0; }
+    double value = exponents[d] * std::pow(q[d], exponents[d] - 1);
+    for (int i = 0; i < q.size(); ++i) {
+        if (i == d) { continue; }
+        value *= std::pow(q[i], exponents[i]);
+    }
+    return value;
+}
+
+} // anonymous namespace
+
+PolynomialPathFitter::PolynomialPathFitter() { constructProperties(); }
+
+void PolynomialPathFitter::constructProperties() {
+    constructProperty_polynomial_order(3);
+    constructProperty_num_samples(500);
+    constructProperty_moment_arm_threshold(1e-4);
+}
+
+void PolynomialPathFitter::fit(Model& model) const {
+    const int order = get_polynomial_order();
+    const int numRequestedSamples = get_num_samples();
+    const double momentArmThreshold = get_moment_arm_threshold();
+    OPENSIM_THROW_IF(order < 1, Exception,
+            "Expected polynomial_order >= 1 but got {}.", order);
+    OPENSIM_THROW_IF(numRequestedSamples < 10, Exception,
+            "Expected num_samples >= 10 but got {}.", numRequestedSamples);
+    OPENSIM_THROW_IF(momentArmThreshold <= 0, Exception,
+            "Expected moment_arm_threshold > 0 but got {}.",
+            momentArmThreshold);
+
+    // Sample on a copy of the model so the caller's model is untouched until
+    // the fitted paths are installed.
+    Model samplingModel(model);
+    SimTK::State state = samplingModel.initSystem();
+
+    // Collect the point-based paths to fit.
+    std::vector<const PathActuator*> actuators;
+    std::vector<const GeometryPath*> paths;
+    for (const auto& actuator :
+            samplingModel.getComponentList<PathActuator>()) {
+        if (dynamic_cast<const FunctionBasedPath*>(
+                    &actuator.getGeometryPath())) {
+            continue;
+        }
+        actuators.push_back(&actuator);
+        paths.push_back(&actuator.getGeometryPath());
+    }
+    if (actuators.empty()) {
+        log_info("PolynomialPathFitter: the model has no point-based paths "
+                 "to fit.");
+        return;
+    }
+    const int numPaths = (int)paths.size();
+
+    // Candidate input coordinates: locked, prescribed, and coupled
+    // coordinates cannot vary independently, so they are never treated as
+    // inputs; the moment arms already fold their effect into the
+    // coordinates that drive them.
+    const CoordinateSet& coordSet = samplingModel.getCoordinateSet();
+    std::vector<const Coordinate*> candidates;
+    std::vector<int> candidateIndices;
+    for (int i = 0; i < coordSet.getSize(); ++i) {
+        const Coordinate& coordinate = coordSet[i];
+        if (coordinate.isConstrained(state)) { continue; }
+        candidates.push_back(&coordinate);
+        candidateIndices.push_back(i);
+    }
+    const int numCandidates = (int)candidates.size();
+    OPENSIM_THROW_IF(numCandidates == 0, Exception,
+            "The model has no coordinates free to vary, so its paths cannot "
+            "be sampled.");
+
+    // Sample coordinate configurations uniformly over the coordinate range
+    // properties with a fixed seed so fits are reproducible. Samples where
+    // the constraint projection fails are discarded.
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(0);
+    MomentArmSolver maSolver(samplingModel);
+    std::vector<Vector> qData;      // candidate coordinate values per sample
+    std::vector<Vector> lengthData; // path lengths per sample
+    std::vector<Matrix> maData;     // numPaths x numCoordinates per sample
+    for (int sample = 0; sample < numRequestedSamples; ++sample) {
+        for (int k = 0; k < numCandidates; ++k) {
+            const Coordinate& coordinate = *candidates[k];
+            const double value = coordinate.getRangeMin() +
+                    random.getValue() * (coordinate.getRangeMax() -
+                                         coordinate.getRangeMin());
+            coordinate.setValue(state, value, false);
+        }
+        try {
+            samplingModel.getMultibodySystem().realize(
+                    state, SimTK::Stage::Position);
+            samplingModel.getMultibodySystem().projectQ(state, 1e-8);
+            samplingModel.getMultibodySystem().realize(
+                    state, SimTK::Stage::Position);
+        } catch (const std::exception&) {
+            continue;
+        }
+
+        Vector q(numCandidates);
+        for (int k = 0; k < numCandidates; ++k) {
+            q[k] = candidates[k]->getValue(state);
+        }
+        Vector lengths(numPaths);
+        for (int p = 0; p < numPaths; ++p) {
+            lengths[p] = paths[p]->getLength(state);
+        }
+        qData.push_back(q);
+        lengthData.push_back(lengths);
+        maData.push_back(maSolver.solveMomentArms(state, paths));
+    }
+    const int numSamples = (int)qData.size();
+    OPENSIM_THROW_IF(numSamples < 10, Exception,
+            "Only {} of {} sampled configurations satisfied the model's "
+            "constraints; the paths cannot be fit.",
+            numSamples, numRequestedSamples);
+
+    log_info("PolynomialPathFitter: fitting {} path(s) to {} sampled "
+             "configurations (order {}).", numPaths, numSamples, order);
+
+    // Fit each path and install the fitted replacement on the caller's
+    // model.
+    for (int p = 0; p < numPaths; ++p) {
+        const std::string actuatorPath =
+                actuators[p]->getAbsolutePathString();
+
+        // Determine which candidate coordinates this path depends on.
+        std::vector<int> dependent;
+        for (int k = 0; k < numCandidates; ++k) {
+            double maxMomentArm = 0.0;
+            for (int sample = 0; sample < numSamples; ++sample) {
+                maxMomentArm = std::max(maxMomentArm,
+                        std::abs(maData[sample](p, candidateIndices[k])));
+            }
+            if (maxMomentArm > momentArmThreshold) { dependent.push_back(k); }
+        }
+        const int dimension = (int)dependent.size();
+        if (dimension == 0) {
+            log_info("  {}: does not depend on any coordinate; skipped.",
+                    actuatorPath);
+            continue;
+        }
+        if (dimension > 4) {
+            log_warn("  {}: depends on {} coordinates, but "
+                     "MultivariatePolynomialFunction supports at most four "
+                     "input dimensions; skipped.", actuatorPath, dimension);
+            continue;
+        }
+
+        // Least-squares fit of the polynomial coefficients to the sampled
+        // lengths and moment arms: one length equation and one moment-arm
+        // equation per dependent coordinate for every sample.
+        const std::vector<std::array<int, 4>> terms =
+                enumerateTerms(dimension, order);
+        const int numCoefficients = (int)terms.size();
+        Matrix A(numSamples * (1 + dimension), numCoefficients);
+        Vector b(numSamples * (1 + dimension));
+        for (int sample = 0; sample < numSamples; ++sample) {
+            Vector q(dimension);
+            for (int d = 0; d < dimension; ++d) {
+                q[d] = qData[sample][dependent[d]];
+            }
+            int row = sample * (1 + dimension);
+            for (int c = 0; c < numCoefficients; ++c) {
+                A(row, c) = evalTerm(terms[c], q);
+            }
+            b[row] = lengthData[sample][p];
+            for (int d = 0; d < dimension; ++d) {
+                ++row;
+                for (int c = 0; c < numCoefficients; ++c) {
+                    A(row, c) = evalTermDerivative(terms[c], q, d);
+                }
+                b[row] = -maData[sample](
+                        p, candidateIndices[dependent[d]]);
+            }
+        }
+        SimTK::FactorQTZ qtz(A);
+        Vector coefficients;
+        qtz.solve(b, coefficients);
+
+        // Fitting error report.
+        const Vector residuals = A * coefficients - b;
+        double lengthSSE = 0.0, maxLengthError = 0.0, momentArmSSE = 0.0;
+        for (int sample = 0; sample < numSamples; ++sample) {
+            const int row = sample * (1 + dimension);
+            lengthSSE += residuals[row] * residuals[row];
+            maxLengthError =
+                    std::max(maxLengthError, std::abs(residuals[row]));
+            for (int d = 1; d <= dimension; ++d) {
+                momentArmSSE += residuals[row + d] * residuals[row + d];
+            }
+        }
+        const double lengthRMSE = std::sqrt(lengthSSE / numSamples);
+        const double momentArmRMSE =
+                std::sqrt(momentArmSSE / (numSamples * dimension));
+        log_info("  {}: {} coordinate(s), length RMSE {:.3e} m (max {:.3e} "
+                 "m), moment arm RMSE {:.3e} m.", actuatorPath, dimension,
+                lengthRMSE, maxLengthError, momentArmRMSE);
+
+        // Install the fitted path on the caller's model.
+        FunctionBasedPath fittedPath;
+        fittedPath.setName(actuators[p]->getGeometryPath().getName());
+        for (int d = 0; d < dimension; ++d) {
+            fittedPath.appendCoordinatePath(
+                    candidates[dependent[d]]->getAbsolutePathString());
+        }
+        fittedPath.setLengthFunction(MultivariatePolynomialFunction(
+                coefficients, dimension, order));
+        model.updComponent<PathActuator>(actuatorPath)
+                .set_GeometryPath(fittedPath);
+    }
+
+    model.finalizeFromProperties();
+}
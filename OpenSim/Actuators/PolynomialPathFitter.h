@@ -0,0 +1,80 @@
+#ifndef OPENSIM_POLYNOMIALPATHFITTER_H
+#define OPENSIM_POLYNOMIALPATHFITTER_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim: PolynomialPathFitter.h                                            *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2023 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimActuatorsDLL.h"
+#include <OpenSim/Common/Object.h>
+
+namespace OpenSim {
+
+class Model;
+
+/** Fit polynomial path functions to the point-based paths in a model.
+
+%PolynomialPathFitter samples a model's PathActuator paths (muscle paths
+included) over the coordinate workspace spanned by the coordinates' range
+properties, detects which coordinates each path depends on from its moment
+arms, and fits a MultivariatePolynomialFunction to the sampled lengths and
+moment arms in a least-squares sense. Each fitted path replaces the
+actuator's GeometryPath with a FunctionBasedPath, which evaluates in
+closed form instead of solving the wrapping geometry every position
+realize. A fitting error report (RMS and maximum length error and RMS
+moment-arm error per path) is written to the log.
+
+Paths that depend on more than four coordinates are left unchanged because
+MultivariatePolynomialFunction supports at most four input dimensions; a
+warning names each skipped path. Locked, prescribed, and
+constraint-coupled coordinates are never treated as path inputs; the
+effect of coupled coordinates is folded into the moment arms of the
+coordinates that drive them.
+
+To fit and replace the paths of a model in place:
+@code
+PolynomialPathFitter fitter;
+fitter.fit(model);
+@endcode
+See ModOpReplacePathsWithFunctionBasedPaths to perform the same operation
+within a ModelProcessor pipeline. */
+class OSIMACTUATORS_API PolynomialPathFitter : public Object {
+    OpenSim_DECLARE_CONCRETE_OBJECT(PolynomialPathFitter, Object);
+
+public:
+    OpenSim_DECLARE_PROPERTY(polynomial_order, int,
+            "The order (largest sum of exponents in a single term) of the "
+            "fitted polynomials. Default: 3.");
+    OpenSim_DECLARE_PROPERTY(num_samples, int,
+            "The number of coordinate configurations sampled over the "
+            "coordinate ranges when fitting the polynomials. Default: 500.");
+    OpenSim_DECLARE_PROPERTY(moment_arm_threshold, double,
+            "A path is considered dependent on a coordinate if the magnitude "
+            "of its moment arm about the coordinate exceeds this threshold "
+            "(in meters) at any sample. Default: 1e-4.");
+
+    PolynomialPathFitter();
+
+    /** Fit all of the model's point-based PathActuator paths and replace
+    each fitted path with an equivalent FunctionBasedPath. The model is
+    modified in place and the fitting error report is written to the log. */
+    void fit(Model& model) const;
+
+private:
+    void constructProperties();
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_POLYNOMIALPATHFITTER_H
@@ -263,6 +263,22 @@ SimTK::Vec2 TendonForceLengthCurve::getCurveDomain() const
     return m_curve.getCurveDomain();
 }
 
+void TendonForceLengthCurve::buildLookupTable(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.buildLookupTable(tolerance);
+}
+
+bool TendonForceLengthCurve::isLookupTableInUse() const
+{
+    return m_curve.isLookupTableInUse();
+}
+
+void TendonForceLengthCurve::clearLookupTable()
+{
+    m_curve.clearLookupTable();
+}
+
 void TendonForceLengthCurve::printMuscleCurveToCSVFile(const std::string& path)
 {
     ensureCurveUpToDate();
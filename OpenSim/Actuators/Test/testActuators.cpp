@@ -57,6 +57,9 @@ void testClutchedPathSpring();
 void testMcKibbenActuator();
 void testActuatorsCombination();
 void testActivationCoordinateActuator();
+void testMuscleBatchEvaluator();
+void testMillardWarmStartEquilibrium();
+void testMillardRigidTendonFastPath();
 
 
 int main()
@@ -87,6 +90,20 @@ int main()
     catch (const std::exception& e) {
         cout << e.what() << endl; failures.push_back("testActivationCoordinateActuator");
     }
+    try { testMuscleBatchEvaluator(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl; failures.push_back("testMuscleBatchEvaluator");
+    }
+    try { testMillardWarmStartEquilibrium(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testMillardWarmStartEquilibrium");
+    }
+    try { testMillardRigidTendonFastPath(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testMillardRigidTendonFastPath");
+    }
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
         return 1;
@@ -967,3 +984,194 @@ void testActivationCoordinateActuator() {
             aca->getStateVariableValue(state, "activation");
     ASSERT_EQUAL(expectedFinalActivation, foundFinalActivation, 1e-4);
 }
+
+void testMuscleBatchEvaluator()
+{
+    using namespace SimTK;
+
+    Model model;
+    model.setName("batchEvaluatorModel");
+    Ground& ground = model.updGround();
+
+    OpenSim::Body* body = new OpenSim::Body("body", 1.0, Vec3(0), Inertia(1));
+    model.addBody(body);
+    SliderJoint* slider = new SliderJoint("slider", ground, Vec3(0), Vec3(0),
+            *body, Vec3(0), Vec3(0));
+    slider->updCoordinate().setName("tx");
+    slider->updCoordinate().setDefaultValue(0.30);
+    model.addJoint(slider);
+
+    auto* millard = new Millard2012EquilibriumMuscle(
+            "millard", 100.0, 0.10, 0.20, 0.0);
+    auto* thelen = new Thelen2003Muscle("thelen", 100.0, 0.10, 0.20, 0.0);
+    auto* dgf = new DeGrooteFregly2016Muscle();
+    dgf->setName("dgf");
+    dgf->setMaxIsometricForce(100.0);
+    dgf->setOptimalFiberLength(0.10);
+    dgf->setTendonSlackLength(0.20);
+    dgf->set_ignore_tendon_compliance(true);
+    // Not a recognized activation model; must be left out of the batch.
+    auto* rigid = new RigidTendonMuscle("rigid", 100.0, 0.10, 0.20, 0.0);
+
+    Muscle* muscles[] = {millard, thelen, dgf, rigid};
+    for (Muscle* muscle : muscles) {
+        muscle->addNewPathPoint("origin", ground, Vec3(0));
+        muscle->addNewPathPoint("insertion", *body, Vec3(0));
+        model.addForce(muscle);
+    }
+
+    auto* controller = new PrescribedController();
+    const double excitations[] = {0.7, 0.4, 0.55, 0.2};
+    for (int i = 0; i < 4; ++i) {
+        controller->addActuator(*muscles[i]);
+        controller->prescribeControlForActuator(muscles[i]->getName(),
+                new Constant(excitations[i]));
+    }
+    model.addController(controller);
+
+    SimTK::State s = model.initSystem();
+    millard->setActivation(s, 0.30);
+    thelen->setActivation(s, 0.85);
+    dgf->setActivation(s, 0.50);
+    model.realizeAcceleration(s);
+
+    MuscleBatchEvaluator evaluator(model);
+    ASSERT(evaluator.getNumMuscles() == 4);
+    ASSERT(evaluator.getNumBatchedMuscles() == 3);
+
+    const Set<Muscle>& muscleSet = model.getMuscles();
+    SimTK::Vector adot;
+    evaluator.calcActivationDerivatives(s, adot);
+    ASSERT(adot.size() == 4);
+    for (int i = 0; i < muscleSet.getSize(); ++i) {
+        const Muscle& muscle = muscleSet.get(i);
+        if (muscle.getName() == "rigid") {
+            ASSERT(!evaluator.isBatched(i));
+            ASSERT(SimTK::isNaN(adot[i]));
+            continue;
+        }
+        ASSERT(evaluator.isBatched(i));
+        // The batched pass must reproduce each muscle's own activation
+        // state derivative.
+        const double expected =
+                muscle.getStateVariableDerivativeValue(s, "activation");
+        ASSERT_EQUAL(expected, adot[i], SimTK::SignificantReal, __FILE__,
+                __LINE__, "batched activation derivative mismatch for " +
+                muscle.getName());
+    }
+}
+
+void testMillardWarmStartEquilibrium()
+{
+    using namespace SimTK;
+
+    Model model;
+    model.setName("warmStartModel");
+    Ground& ground = model.updGround();
+
+    OpenSim::Body* body = new OpenSim::Body("body", 1.0, Vec3(0), Inertia(1));
+    model.addBody(body);
+    SliderJoint* slider = new SliderJoint("slider", ground, Vec3(0), Vec3(0),
+            *body, Vec3(0), Vec3(0));
+    slider->updCoordinate().setName("tx");
+    slider->updCoordinate().setDefaultValue(0.31);
+    model.addJoint(slider);
+
+    auto* millard = new Millard2012EquilibriumMuscle(
+            "millard", 100.0, 0.10, 0.20, 0.0);
+    millard->addNewPathPoint("origin", ground, Vec3(0));
+    millard->addNewPathPoint("insertion", *body, Vec3(0));
+    model.addForce(millard);
+
+    SimTK::State s = model.initSystem();
+    millard->setActivation(s, 0.60);
+
+    // Solve from the generic initial guess.
+    millard->computeFiberEquilibrium(s);
+    const double coldFiberLength = millard->getFiberLength(s);
+
+    // Warm-starting from a perturbed guess must converge to the same
+    // solution.
+    millard->setFiberLength(s, 0.5*millard->getOptimalFiberLength());
+    millard->computeFiberEquilibrium(s, false, 1.05*coldFiberLength);
+    ASSERT_EQUAL(coldFiberLength, millard->getFiberLength(s),
+            1e-6*millard->getOptimalFiberLength(), __FILE__, __LINE__,
+            "warm-started equilibrium disagrees with cold start");
+
+    // The batched variant must report the solved fiber length and accept
+    // its own output as the warm start for the next solve.
+    SimTK::Vector fiberLengths =
+            Millard2012EquilibriumMuscle::computeFiberEquilibria(model, s);
+    ASSERT(fiberLengths.size() == 1);
+    ASSERT_EQUAL(millard->getFiberLength(s), fiberLengths[0],
+            SimTK::SignificantReal, __FILE__, __LINE__,
+            "batched equilibrium did not report the solved fiber length");
+
+    fiberLengths = Millard2012EquilibriumMuscle::computeFiberEquilibria(
+            model, s, fiberLengths);
+    ASSERT_EQUAL(coldFiberLength, fiberLengths[0],
+            1e-6*millard->getOptimalFiberLength(), __FILE__, __LINE__,
+            "re-solving from the previous solution changed the solution");
+
+    // A previous-solution vector of the wrong size is rejected.
+    ASSERT_THROW(OpenSim::Exception,
+            Millard2012EquilibriumMuscle::computeFiberEquilibria(
+                    model, s, SimTK::Vector(3, 0.1)));
+}
+
+void testMillardRigidTendonFastPath()
+{
+    using namespace SimTK;
+
+    Model model;
+    model.setName("rigidTendonModel");
+    Ground& ground = model.updGround();
+
+    OpenSim::Body* body = new OpenSim::Body("body", 1.0, Vec3(0), Inertia(1));
+    model.addBody(body);
+    SliderJoint* slider = new SliderJoint("slider", ground, Vec3(0), Vec3(0),
+            *body, Vec3(0), Vec3(0));
+    slider->updCoordinate().setName("tx");
+    slider->updCoordinate().setDefaultValue(0.30);
+    model.addJoint(slider);
+
+    auto* millard = new Millard2012EquilibriumMuscle(
+            "millard", 100.0, 0.10, 0.20, 0.0);
+    millard->set_ignore_tendon_compliance(true);
+    millard->addNewPathPoint("origin", ground, Vec3(0));
+    millard->addNewPathPoint("insertion", *body, Vec3(0));
+    model.addForce(millard);
+
+    auto* controller = new PrescribedController();
+    controller->addActuator(*millard);
+    controller->prescribeControlForActuator(millard->getName(),
+            new Constant(0.6));
+    model.addController(controller);
+
+    SimTK::State s = model.initSystem();
+    const Coordinate& tx = slider->getCoordinate();
+    millard->setActivation(s, 0.40);
+
+    // The actuation produced by the fast path must agree with the tendon
+    // force computed through the full muscle-info pipeline, at rest and
+    // while lengthening and shortening.
+    const double speeds[] = {0.0, 0.05, -0.05};
+    for (double speed : speeds) {
+        tx.setSpeedValue(s, speed);
+        model.realizeDynamics(s);
+        ASSERT_EQUAL(millard->getTendonForce(s), millard->getActuation(s),
+                SimTK::SignificantReal, __FILE__, __LINE__,
+                "rigid-tendon fast path disagrees with full pipeline");
+    }
+
+    // A path shorter than the tendon slack length buckles the tendon; the
+    // fiber is clamped and no force is transmitted.
+    tx.setValue(s, 0.15);
+    tx.setSpeedValue(s, 0.0);
+    model.realizeDynamics(s);
+    ASSERT_EQUAL(0.0, millard->getActuation(s), SimTK::SignificantReal,
+            __FILE__, __LINE__, "buckled rigid tendon transmitted force");
+    ASSERT_EQUAL(millard->getTendonForce(s), millard->getActuation(s),
+            SimTK::SignificantReal, __FILE__, __LINE__,
+            "rigid-tendon fast path disagrees with full pipeline");
+}
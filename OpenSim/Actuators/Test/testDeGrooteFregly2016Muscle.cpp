@@ -1085,3 +1085,74 @@ TEST_CASE("DeGrooteFregly2016Muscle basics") {
         CHECK(state.getY()[2] == Approx(0.451));
     }
 }
+
+TEST_CASE("DeGrooteFregly2016Muscle batch curve kernels") {
+    DeGrooteFregly2016Muscle muscle;
+    muscle.setName("muscle");
+    muscle.set_max_isometric_force(10);
+    muscle.set_optimal_fiber_length(0.1);
+    muscle.set_tendon_slack_length(0.2);
+    muscle.set_tendon_strain_at_one_norm_force(0.10);
+    muscle.set_active_force_width_scale(1.2);
+    muscle.set_passive_fiber_strain_at_one_norm_force(0.5);
+    muscle.finalizeFromProperties();
+
+    const auto normFiberLengths = createVectorLinspace(75, 0.3, 1.9);
+    const auto normFiberVelocities = createVectorLinspace(75, -1, 1);
+    const auto normTendonLengths = createVectorLinspace(75, 0.99, 1.12);
+
+    // Each batch kernel must reproduce its scalar counterpart exactly.
+    SimTK::Vector batch;
+    SECTION("active force-length") {
+        muscle.calcActiveForceLengthMultiplier(normFiberLengths, batch);
+        REQUIRE(batch.size() == normFiberLengths.size());
+        for (int i = 0; i < batch.size(); ++i) {
+            CHECK(batch[i] == muscle.calcActiveForceLengthMultiplier(
+                                      normFiberLengths[i]));
+        }
+        muscle.calcActiveForceLengthMultiplierDerivative(
+                normFiberLengths, batch);
+        for (int i = 0; i < batch.size(); ++i) {
+            CHECK(batch[i] == muscle.calcActiveForceLengthMultiplierDerivative(
+                                      normFiberLengths[i]));
+        }
+    }
+    SECTION("force-velocity") {
+        DeGrooteFregly2016Muscle::calcForceVelocityMultiplier(
+                normFiberVelocities, batch);
+        for (int i = 0; i < batch.size(); ++i) {
+            CHECK(batch[i] ==
+                    DeGrooteFregly2016Muscle::calcForceVelocityMultiplier(
+                            normFiberVelocities[i]));
+        }
+    }
+    SECTION("passive force-length") {
+        muscle.calcPassiveForceMultiplier(normFiberLengths, batch);
+        for (int i = 0; i < batch.size(); ++i) {
+            CHECK(batch[i] ==
+                    muscle.calcPassiveForceMultiplier(normFiberLengths[i]));
+        }
+        muscle.calcPassiveForceMultiplierDerivative(normFiberLengths, batch);
+        for (int i = 0; i < batch.size(); ++i) {
+            CHECK(batch[i] == muscle.calcPassiveForceMultiplierDerivative(
+                                      normFiberLengths[i]));
+        }
+
+        muscle.set_ignore_passive_fiber_force(true);
+        muscle.finalizeFromProperties();
+        muscle.calcPassiveForceMultiplier(normFiberLengths, batch);
+        for (int i = 0; i < batch.size(); ++i) { CHECK(batch[i] == 0); }
+    }
+    SECTION("tendon force-length") {
+        muscle.calcTendonForceMultiplier(normTendonLengths, batch);
+        for (int i = 0; i < batch.size(); ++i) {
+            CHECK(batch[i] ==
+                    muscle.calcTendonForceMultiplier(normTendonLengths[i]));
+        }
+        muscle.calcTendonForceMultiplierDerivative(normTendonLengths, batch);
+        for (int i = 0; i < batch.size(); ++i) {
+            CHECK(batch[i] == muscle.calcTendonForceMultiplierDerivative(
+                                      normTendonLengths[i]));
+        }
+    }
+}
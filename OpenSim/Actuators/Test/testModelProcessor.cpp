@@ -19,9 +19,12 @@
 #define CATCH_CONFIG_MAIN
 #include "OpenSim/Moco/Test/Testing.h"
 
+#include <cstdio>
+
 #include <OpenSim/Actuators/Millard2012EquilibriumMuscle.h>
 #include <OpenSim/Actuators/ModelOperators.h>
 #include <OpenSim/Analyses/MuscleAnalysis.h>
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Moco/osimMoco.h>
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
 
@@ -61,6 +64,51 @@ TEST_CASE("ModelProcessor") {
         CHECK(proc.process().getAnalysisSet().getSize() == 1);
     }
 
+    SECTION("Cached processing") {
+        static int numOperateCalls = 0;
+        class CountingOperator : public ModelOperator {
+            OpenSim_DECLARE_CONCRETE_OBJECT(CountingOperator, ModelOperator);
+
+        public:
+            void operate(Model& model, const std::string&) const override {
+                ++numOperateCalls;
+                model.addAnalysis(new MuscleAnalysis());
+            }
+        };
+        Object::registerType(CountingOperator());
+        numOperateCalls = 0;
+
+        // start from an empty cache so the counts below are deterministic
+        // across repeated test runs
+        for (const auto& file : IO::getFilesInDirectory(
+                     "testModelProcessor_cache")) {
+            std::remove(("testModelProcessor_cache/" + file).c_str());
+        }
+        ModelProcessor::clearMemoryCache();
+
+        ModelProcessor proc = ModelProcessor(model) | CountingOperator();
+        proc.set_cache_directory("testModelProcessor_cache");
+
+        // the operator chain runs once per unique input, not per call
+        CHECK(proc.process().getAnalysisSet().getSize() == 1);
+        CHECK(proc.process().getAnalysisSet().getSize() == 1);
+        CHECK(numOperateCalls == 1);
+
+        // the on-disk tier survives a cleared in-memory tier
+        ModelProcessor::clearMemoryCache();
+        CHECK(proc.process().getAnalysisSet().getSize() == 1);
+        CHECK(numOperateCalls == 1);
+
+        // a different source model is a different cache entry
+        Model otherModel = ModelFactory::createPendulum();
+        otherModel.setName("other_pendulum");
+        ModelProcessor otherProc =
+                ModelProcessor(otherModel) | CountingOperator();
+        otherProc.set_cache_directory("testModelProcessor_cache");
+        CHECK(otherProc.process().getAnalysisSet().getSize() == 1);
+        CHECK(numOperateCalls == 2);
+    }
+
     SECTION("Serialization") {
         model.print("testModelProcessor_model.osim");
         {
@@ -335,7 +335,52 @@ int main(int argc, char* argv[])
                 ,minTol,taylorMult,maxDxDiff);
 
         cout<<"*****************************************************"<<endl;
-        cout<<"TEST: Exceptions thrown correctly.                   "<<endl;           
+        cout<<"TEST: Partial derivatives of d/dt activation         "<<endl;
+        cout << endl;
+
+        //Compare the closed-form partials of calcDerivative against central
+        //differences, staying a step away from the kink at u == a and from
+        //the clamp at amin and 1 so the differences are one-sided-free.
+        double h = 1e-6;
+        double derivTol = 1e-6;
+        double maxPartialErr = 0;
+
+        amin = actMdl.get_minimum_activation();
+        for(int i=0; i<actV.size(); i++){
+            for(int j=0; j<uV.size(); j++){
+                double a = actV(i);
+                double u = uV(j);
+                if(    a < amin+2*h || a > 1.0-2*h
+                    || abs(u-a) < 2*h)
+                    continue;
+
+                double DdaDa = actMdl.calc_DDerivative_DActivation(a,u);
+                double DdaDaNUM = ( actMdl.calcDerivative(a+h,u)
+                                   -actMdl.calcDerivative(a-h,u) )/(2.0*h);
+                tmp = abs(DdaDa-DdaDaNUM);
+                if(tmp > maxPartialErr)
+                    maxPartialErr = tmp;
+                SimTK_TEST_EQ_TOL(DdaDa, DdaDaNUM, derivTol);
+
+                double DdaDu = actMdl.calc_DDerivative_DExcitation(a,u);
+                double DdaDuNUM = ( actMdl.calcDerivative(a,u+h)
+                                   -actMdl.calcDerivative(a,u-h) )/(2.0*h);
+                tmp = abs(DdaDu-DdaDuNUM);
+                if(tmp > maxPartialErr)
+                    maxPartialErr = tmp;
+                SimTK_TEST_EQ_TOL(DdaDu, DdaDuNUM, derivTol);
+            }
+        }
+
+        //The partial w.r.t. activation vanishes outside the clamping range.
+        SimTK_TEST_EQ(actMdl.calc_DDerivative_DActivation(amin-0.005,0.5),0.0);
+        SimTK_TEST_EQ(actMdl.calc_DDerivative_DActivation(1.005,0.5),0.0);
+
+        printf("PASSED: with a max. error < tol (%fe-8 < %fe-8)\n",
+                maxPartialErr*1e8, derivTol*1e8);
+
+        cout<<"*****************************************************"<<endl;
+        cout<<"TEST: Exceptions thrown correctly.                   "<<endl;
         cout << endl;
 
         SimTK_END_TEST();
@@ -792,6 +792,117 @@ int main(int argc, char* argv[])
         printf("    :passed with a max. error < rel. tol. (%f < %f)\n"
                 ,maxErr,2e-3);
 
+        cout << endl;
+        cout << "**************************************************" << endl;
+        cout << "TEST: fiber velocity partial derivative correctness" << endl;
+
+        //Validate the velocity-level partials against central differences
+        //taken directly on the functions they differentiate. The step is
+        //sized so that the O(h^2) truncation error of the difference is
+        //well below the test tolerance.
+        double h = 1e-5;
+        double derivTol = 1e-6;
+        maxErr = 0;
+
+        for(int i=0;i<numPts; i++)
+        {
+            double sinPhi = sin(penAng(i));
+            double cosPhi = cos(penAng(i));
+            double tanPhi = tan(penAng(i));
+
+            //calc_DPennationAngularVelocity_DfiberVelocity
+            double DdphiDdlce = fibKin.
+                calc_DPennationAngularVelocity_DfiberVelocity(tanPhi,
+                                                              fibLen(i));
+            double DdphiDdlceNUM =
+                ( fibKin.calcPennationAngularVelocity(tanPhi, fibLen(i),
+                                                      fibVel(i)+h)
+                 -fibKin.calcPennationAngularVelocity(tanPhi, fibLen(i),
+                                                      fibVel(i)-h) )/(2.0*h);
+            err = abs(DdphiDdlce-DdphiDdlceNUM);
+            if(err > maxErr) maxErr = err;
+            SimTK_TEST_EQ_TOL(err, 0, derivTol);
+
+            //calc_DFiberVelocityAlongTendon_DfiberVelocity
+            double DdlceATDdlce = fibKin.
+                calc_DFiberVelocityAlongTendon_DfiberVelocity(fibLen(i),
+                    sinPhi, cosPhi, DdphiDdlce);
+            double DdlceATDdlceNUM =
+                ( fibKin.calcFiberVelocityAlongTendon(fibLen(i),fibVel(i)+h,
+                    sinPhi, cosPhi,
+                    fibKin.calcPennationAngularVelocity(tanPhi,fibLen(i),
+                                                        fibVel(i)+h))
+                 -fibKin.calcFiberVelocityAlongTendon(fibLen(i),fibVel(i)-h,
+                    sinPhi, cosPhi,
+                    fibKin.calcPennationAngularVelocity(tanPhi,fibLen(i),
+                                                        fibVel(i)-h)) )
+                /(2.0*h);
+            err = abs(DdlceATDdlce-DdlceATDdlceNUM);
+            if(err > maxErr) maxErr = err;
+            SimTK_TEST_EQ_TOL(err, 0, derivTol);
+
+            //calc_DTendonVelocity_DfiberVelocity
+            double DdtlDdlce = fibKin.
+                calc_DTendonVelocity_DfiberVelocity(fibLen(i),
+                    sinPhi, cosPhi, DdphiDdlce);
+            double DdtlDdlceNUM =
+                ( fibKin.calcTendonVelocity(cosPhi, sinPhi,
+                    fibKin.calcPennationAngularVelocity(tanPhi,fibLen(i),
+                                                        fibVel(i)+h),
+                    fibLen(i), fibVel(i)+h, mclVel(i))
+                 -fibKin.calcTendonVelocity(cosPhi, sinPhi,
+                    fibKin.calcPennationAngularVelocity(tanPhi,fibLen(i),
+                                                        fibVel(i)-h),
+                    fibLen(i), fibVel(i)-h, mclVel(i)) )/(2.0*h);
+            err = abs(DdtlDdlce-DdtlDdlceNUM);
+            if(err > maxErr) maxErr = err;
+            SimTK_TEST_EQ_TOL(err, 0, derivTol);
+
+            //calc_DFiberVelocity_DfiberLength: perturb the fiber length,
+            //recompute the pennation angle, and difference calcFiberVelocity
+            //while holding the musculotendon and tendon velocities fixed.
+            double DphiDlce =
+                fibKin.calc_DPennationAngle_DfiberLength(fibLen(i));
+            double DdlceDlce = fibKin.
+                calc_DFiberVelocity_DfiberLength(mclVel(i), tdnVel(i),
+                                                 sinPhi, DphiDlce);
+            double DdlceDlceNUM =
+                ( fibKin.calcFiberVelocity(
+                    cos(fibKin.calcPennationAngle(fibLen(i)+h)),
+                    mclVel(i), tdnVel(i))
+                 -fibKin.calcFiberVelocity(
+                    cos(fibKin.calcPennationAngle(fibLen(i)-h)),
+                    mclVel(i), tdnVel(i)) )/(2.0*h);
+            //The curvature of cos(phi(lce)) grows rapidly near the minimum
+            //fiber length, so compare this partial in a relative sense.
+            err = abs(DdlceDlce-DdlceDlceNUM)/(smallTol + abs(DdlceDlceNUM));
+            if(err > maxErr) maxErr = err;
+            SimTK_TEST_EQ_TOL(err, 0, 5e-4);
+        }
+        printf("    :passed with a max. error < tol (%f < %f)\n",
+                maxErr, 5e-4);
+
+        cout << endl;
+        cout << "**************************************************" << endl;
+        cout << "TEST: calc_DFiberLength_DmuscleLength correctness" << endl;
+
+        maxErr = 0;
+        for(int i=0;i<numPts; i++)
+        {
+            tmp = fibKin.calc_DFiberLength_DmuscleLength(mclLen(i),tdnLen(i));
+            err = abs(tmp -
+                ( fibKin.calcFiberLength(mclLen(i)+h, tdnLen(i))
+                 -fibKin.calcFiberLength(mclLen(i)-h, tdnLen(i)) )/(2.0*h));
+            if(err > maxErr) maxErr = err;
+            SimTK_TEST_EQ_TOL(err, 0, derivTol);
+        }
+        //The partial is zero when the fiber is clamped at its lower bound.
+        SimTK_TEST_EQ_TOL(fibKin.calc_DFiberLength_DmuscleLength(
+            tendonSlackLen, tendonSlackLen), 0, SimTK::Eps);
+
+        printf("    :passed with a max. error < tol (%fe-8 < %fe-8)\n",
+                maxErr*1e8, derivTol*1e8);
+
         cout << endl;
         cout << "**************************************************" << endl;
         cout << "TEST: Exception Handling" << endl;
@@ -0,0 +1,169 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: testPolynomialPathFitter.cpp                                      *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2023 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#define CATCH_CONFIG_MAIN
+#include "OpenSim/Moco/Test/Testing.h"
+
+#include <OpenSim/Actuators/ModelOperators.h>
+#include <OpenSim/Actuators/PolynomialPathFitter.h>
+#include <OpenSim/Simulation/Model/FunctionBasedPath.h>
+#include <OpenSim/Simulation/Model/PathActuator.h>
+#include <OpenSim/Simulation/MomentArmSolver.h>
+
+using namespace OpenSim;
+using SimTK::Vec3;
+
+namespace {
+
+// A double pendulum with a PathActuator spanning both pin joints; its
+// point-based path length is a smooth function of the two coordinates.
+Model createPathModel() {
+    Model model = ModelFactory::createDoublePendulum();
+
+    for (int i = 0; i < model.updCoordinateSet().getSize(); ++i) {
+        Coordinate& coordinate = model.updCoordinateSet()[i];
+        coordinate.setRangeMin(-1.0);
+        coordinate.setRangeMax(1.0);
+    }
+
+    auto* actu = new PathActuator();
+    actu->setName("path_actuator");
+    actu->addNewPathPoint("origin", model.updGround(), Vec3(0.05, 0.05, 0));
+    actu->addNewPathPoint("via", model.updBodySet().get("b0"),
+            Vec3(-0.3, 0.05, 0));
+    actu->addNewPathPoint("insertion", model.updBodySet().get("b1"),
+            Vec3(-0.25, 0.05, 0));
+    actu->setOptimalForce(10.0);
+    model.addForce(actu);
+    model.finalizeConnections();
+    return model;
+}
+
+} // anonymous namespace
+
+TEST_CASE("PolynomialPathFitter replicates a point-based path") {
+    Model original = createPathModel();
+    Model fitted = createPathModel();
+
+    PolynomialPathFitter fitter;
+    fitter.set_polynomial_order(5);
+    fitter.set_num_samples(300);
+    fitter.fit(fitted);
+
+    auto& fittedActu = fitted.updComponent<PathActuator>("/forceset/path_actuator");
+    REQUIRE(dynamic_cast<const FunctionBasedPath*>(
+            &fittedActu.getGeometryPath()));
+
+    SimTK::State sOriginal = original.initSystem();
+    SimTK::State sFitted = fitted.initSystem();
+
+    const auto& originalActu =
+            original.getComponent<PathActuator>("/forceset/path_actuator");
+
+    SimTK::Random::Uniform random(-0.9, 0.9);
+    random.setSeed(42);
+    const double tol = 1e-3;
+    for (int trial = 0; trial < 10; ++trial) {
+        for (int i = 0; i < original.getCoordinateSet().getSize(); ++i) {
+            const double q = random.getValue();
+            const double u = random.getValue();
+            original.getCoordinateSet()[i].setValue(sOriginal, q);
+            original.getCoordinateSet()[i].setSpeedValue(sOriginal, u);
+            fitted.getCoordinateSet()[i].setValue(sFitted, q);
+            fitted.getCoordinateSet()[i].setSpeedValue(sFitted, u);
+        }
+        original.realizeVelocity(sOriginal);
+        fitted.realizeVelocity(sFitted);
+
+        CHECK(std::abs(originalActu.getLength(sOriginal) -
+                       fittedActu.getLength(sFitted)) < tol);
+        CHECK(std::abs(originalActu.getLengtheningSpeed(sOriginal) -
+                       fittedActu.getLengtheningSpeed(sFitted)) < tol);
+        for (int i = 0; i < original.getCoordinateSet().getSize(); ++i) {
+            const double maOriginal =
+                    originalActu.getGeometryPath().computeMomentArm(
+                            sOriginal, original.getCoordinateSet()[i]);
+            const double maFitted =
+                    fittedActu.getGeometryPath().computeMomentArm(
+                            sFitted, fitted.getCoordinateSet()[i]);
+            CHECK(std::abs(maOriginal - maFitted) < tol);
+        }
+    }
+}
+
+TEST_CASE("FunctionBasedPath applies equivalent generalized forces") {
+    Model fitted = createPathModel();
+    PolynomialPathFitter fitter;
+    fitter.set_polynomial_order(5);
+    fitter.set_num_samples(300);
+    fitter.fit(fitted);
+
+    SimTK::State state = fitted.initSystem();
+    fitted.getCoordinateSet()[0].setValue(state, 0.3);
+    fitted.getCoordinateSet()[1].setValue(state, -0.4);
+    fitted.realizeVelocity(state);
+
+    // The generalized force of a unit tension along the path must match the
+    // path's moment arms; this exercises addInEquivalentForces() through
+    // the MomentArmSolver as well as directly.
+    const auto& path = fitted.getComponent<PathActuator>(
+            "/forceset/path_actuator").getGeometryPath();
+    SimTK::Vector_<SimTK::SpatialVec> bodyForces(
+            fitted.getMatterSubsystem().getNumBodies(),
+            SimTK::SpatialVec(Vec3(0), Vec3(0)));
+    SimTK::Vector mobilityForces(state.getNU(), 0.0);
+    path.addInEquivalentForces(state, 1.0, bodyForces, mobilityForces);
+
+    MomentArmSolver maSolver(fitted);
+    for (int i = 0; i < fitted.getCoordinateSet().getSize(); ++i) {
+        const Coordinate& coordinate = fitted.getCoordinateSet()[i];
+        const double ma = path.computeMomentArm(state, coordinate);
+        CHECK_THAT(mobilityForces[i], Catch::WithinAbs(ma, 1e-10));
+        CHECK_THAT(maSolver.solve(state, coordinate, path),
+                Catch::WithinAbs(ma, 1e-8));
+    }
+}
+
+TEST_CASE("FunctionBasedPath serialization roundtrip") {
+    Model fitted = createPathModel();
+    PolynomialPathFitter().fit(fitted);
+
+    SimTK::State state = fitted.initSystem();
+    fitted.getCoordinateSet()[0].setValue(state, 0.5);
+    fitted.realizePosition(state);
+    const double length = fitted.getComponent<PathActuator>(
+            "/forceset/path_actuator").getLength(state);
+
+    fitted.print("testPolynomialPathFitter_fitted.osim");
+    Model roundtrip("testPolynomialPathFitter_fitted.osim");
+    SimTK::State stateRoundtrip = roundtrip.initSystem();
+    roundtrip.getCoordinateSet()[0].setValue(stateRoundtrip, 0.5);
+    roundtrip.realizePosition(stateRoundtrip);
+    CHECK_THAT(roundtrip.getComponent<PathActuator>(
+                       "/forceset/path_actuator").getLength(stateRoundtrip),
+            Catch::WithinAbs(length, 1e-12));
+}
+
+TEST_CASE("ModOpReplacePathsWithFunctionBasedPaths") {
+    PolynomialPathFitter fitter;
+    fitter.set_num_samples(100);
+    ModelProcessor processor = ModelProcessor(createPathModel()) |
+            ModOpReplacePathsWithFunctionBasedPaths(fitter);
+    Model processed = processor.process();
+    CHECK(dynamic_cast<const FunctionBasedPath*>(
+            &processed.getComponent<PathActuator>("/forceset/path_actuator")
+                     .getGeometryPath()));
+}
@@ -45,6 +45,7 @@ void testTendonForceLengthCurve();
 void testFiberForceLengthCurve();
 void testFiberCompressiveForceLengthCurve();
 void testFiberCompressiveForceCosPennationCurve();
+void testCurveLookupTables();
 
 int main(int argc, char* argv[])
 {
@@ -59,6 +60,7 @@ int main(int argc, char* argv[])
             testFiberForceLengthCurve();
             testFiberCompressiveForceLengthCurve();
             testFiberCompressiveForceCosPennationCurve();
+            testCurveLookupTables();
 
             cout << "================================================" << endl;
             cout << "                   Timing Tests                 " << endl;
@@ -1227,3 +1229,73 @@ void testFiberCompressiveForceCosPennationCurve()
         cout <<"________________________________________________________"<<endl;
 
 }
+
+template <class CurveType>
+void checkCurveLookupTable(const std::string& name)
+{
+    cout <<"    " << name << endl;
+    double tol = 1e-6;
+
+    CurveType exactCurve;
+    CurveType lutCurve;
+    SimTK_TEST(!lutCurve.isLookupTableInUse());
+    lutCurve.buildLookupTable(tol);
+    SimTK_TEST(lutCurve.isLookupTableInUse());
+    SimTK_TEST(!exactCurve.isLookupTableInUse());
+
+    //Sample the curve across its domain and a little beyond it on each
+    //side so that the linear-extrapolation region is exercised as well.
+    SimTK::Vec2 dom = exactCurve.getCurveDomain();
+    double pad = 0.1*(dom(1)-dom(0));
+    double x0  = dom(0)-pad;
+    double x1  = dom(1)+pad;
+    int nSample = 1000;
+    for(int i=0; i<=nSample; i++){
+        double x = x0 + i*(x1-x0)/nSample;
+        //The refinement enforces the tolerance at the interval midpoints,
+        //where the interpolation error peaks; allow a small safety factor
+        //for the remaining higher-order terms.
+        SimTK_TEST_EQ_TOL(lutCurve.calcValue(x),
+                          exactCurve.calcValue(x), 2*tol);
+        SimTK_TEST_EQ_TOL(lutCurve.calcDerivative(x,1),
+                          exactCurve.calcDerivative(x,1), 2*tol);
+    }
+
+    //The second derivative interpolates the stored (d2y,d3y) pairs and is
+    //accurate, but is not held to the refinement tolerance.
+    double xmid = 0.5*(dom(0)+dom(1));
+    SimTK_TEST_EQ_TOL(lutCurve.calcDerivative(xmid,2),
+                      exactCurve.calcDerivative(xmid,2), 1e-3);
+
+    //Outside of the curve domain the lookup table is bypassed entirely, so
+    //the linear extrapolation is reproduced bit-for-bit.
+    SimTK_TEST(lutCurve.calcValue(x0) == exactCurve.calcValue(x0));
+    SimTK_TEST(lutCurve.calcDerivative(x1,1)
+               == exactCurve.calcDerivative(x1,1));
+
+    //Clearing the table restores exact evaluation.
+    lutCurve.clearLookupTable();
+    SimTK_TEST(!lutCurve.isLookupTableInUse());
+    SimTK_TEST(lutCurve.calcValue(xmid) == exactCurve.calcValue(xmid));
+}
+
+void testCurveLookupTables()
+{
+        cout <<"________________________________________________________"<<endl;
+        cout <<"8. Testing: curve lookup tables "<<endl;
+        cout <<"________________________________________________________"<<endl;
+
+        checkCurveLookupTable<ActiveForceLengthCurve>(
+            "a. ActiveForceLengthCurve");
+        checkCurveLookupTable<ForceVelocityCurve>(
+            "b. ForceVelocityCurve");
+        checkCurveLookupTable<TendonForceLengthCurve>(
+            "c. TendonForceLengthCurve");
+        checkCurveLookupTable<FiberForceLengthCurve>(
+            "d. FiberForceLengthCurve");
+
+        cout <<"________________________________________________________"<<endl;
+        cout <<"          TESTING curve lookup tables"<<endl;
+        cout <<"                    COMPLETED                     "<<endl;
+        cout <<"________________________________________________________"<<endl;
+}
@@ -291,6 +291,8 @@ updateBodiesToRecord()
     if(!_model) {
         _bodyIndices.setSize(0);
         _kin.setSize(0);
+        _vKin.setSize(0);
+        _aKin.setSize(0);
         return;
     }
 
@@ -314,6 +316,8 @@ updateBodiesToRecord()
         _bodyIndices.append(index);
     }
     _kin.setSize(6*_bodyIndices.getSize()+(_recordCenterOfMass?3:0));
+    _vKin.setSize(_kin.getSize());
+    _aKin.setSize(_kin.getSize());
 
     if(_kin.getSize()==0) {
         log_warn("BodyKinematics analysis has no bodies to record kinematics "
@@ -444,153 +448,97 @@ int BodyKinematics::
 record(const SimTK::State& s)
 {
 
-    // Realize to Acceleration first since we'll ask for Accelerations 
+    // Realize to Acceleration first since we'll ask for Accelerations
     _model->getMultibodySystem().realize(s, SimTK::Stage::Acceleration);
     // VARIABLES
-    SimTK::Vec3 vec,angVec;
     double Mass = 0.0;
 
-    // GROUND BODY
-    const Ground &ground = _model->getGround();
-
-    // POSITION
     BodySet& bs = _model->updBodySet();
 
+    // Single pass over the bodies: fetch each body's ground transform and
+    // spatial velocity/acceleration once and fill the position, velocity,
+    // and acceleration rows together, instead of re-querying the body's
+    // kinematics in three separate loops.
     for(int i=0;i<_bodyIndices.getSize();i++) {
         Body& body = bs.get(_bodyIndices[i]);
         const SimTK::Vec3& com = body.get_mass_center();
-        // GET POSITIONS AND EULER ANGLES
-        vec = body.findStationLocationInGround(s, com);
-        angVec = body.getTransformInGround(s).R().convertRotationToBodyFixedXYZ();
 
-        // CONVERT TO DEGREES?
-        if(getInDegrees()) {
-            angVec[0] *= SimTK_RADIAN_TO_DEGREE;
-            angVec[1] *= SimTK_RADIAN_TO_DEGREE;
-            angVec[2] *= SimTK_RADIAN_TO_DEGREE;
-        }           
+        const SimTK::Transform& X_GB = body.getTransformInGround(s);
+        const SimTK::SpatialVec& V_GB = body.getVelocityInGround(s);
+        const SimTK::SpatialVec& A_GB = body.getAccelerationInGround(s);
+        const SimTK::Vec3 r_G = X_GB.R()*com;
 
-        // FILL KINEMATICS ARRAY
-        int I=6*i;
-        memcpy(&_kin[I],&vec[0],3*sizeof(double));
-        memcpy(&_kin[I+3],&angVec[0],3*sizeof(double));
-    }
+        // POSITIONS AND EULER ANGLES
+        SimTK::Vec3 vec = X_GB.p() + r_G;
+        SimTK::Vec3 angVec = X_GB.R().convertRotationToBodyFixedXYZ();
 
-    if(_recordCenterOfMass) {
-        double rP[3] = { 0.0, 0.0, 0.0 };
-        for(int i=0;i<bs.getSize();i++) {
-            Body& body = bs.get(i);
-            const SimTK::Vec3& com = body.get_mass_center();
-            vec = body.findStationLocationInGround(s, com);
-            // ADD TO WHOLE BODY MASS
-            Mass += body.get_mass();
-            rP[0] += body.get_mass() * vec[0];
-            rP[1] += body.get_mass() * vec[1];
-            rP[2] += body.get_mass() * vec[2];
-        }
+        // VELOCITIES AND ANGULAR VELOCITIES
+        SimTK::Vec3 vel = V_GB[1] + SimTK::cross(V_GB[0], r_G);
+        SimTK::Vec3 angVel = V_GB[0];
 
-        //COMPUTE COM OF WHOLE BODY AND ADD TO ARRAY
-        rP[0] /= Mass;
-        rP[1] /= Mass;
-        rP[2] /= Mass;
-        int I = 6*_bodyIndices.getSize();
-        memcpy(&_kin[I],rP,3*sizeof(double));
-    }
-    
-    _pStore->append(s.getTime(),_kin.getSize(),&_kin[0]);
+        // ACCELERATIONS AND ANGULAR ACCELERATIONS
+        SimTK::Vec3 acc = A_GB[1] + SimTK::cross(A_GB[0], r_G) +
+            SimTK::cross(V_GB[0], SimTK::cross(V_GB[0], r_G));
+        SimTK::Vec3 angAcc = A_GB[0];
 
-    // VELOCITY
-    for(int i=0;i<_bodyIndices.getSize();i++) {
-        Body& body = bs.get(_bodyIndices[i]);
-        const SimTK::Vec3& com = body.get_mass_center();
-        // GET VELOCITIES AND ANGULAR VELOCITIES
-        vec = body.findStationVelocityInGround(s, com);
-        angVec = body.getVelocityInGround(s)[0];
-        if (_expressInLocalFrame) {
-            vec = ground.expressVectorInAnotherFrame(s, vec, body);
-            angVec = ground.expressVectorInAnotherFrame(s, angVec, body);
+        if(_expressInLocalFrame) {
+            vel = ~X_GB.R()*vel;
+            angVel = ~X_GB.R()*angVel;
+            acc = ~X_GB.R()*acc;
+            angAcc = ~X_GB.R()*angAcc;
         }
 
         // CONVERT TO DEGREES?
         if(getInDegrees()) {
-            angVec[0] *= SimTK_RADIAN_TO_DEGREE;
-            angVec[1] *= SimTK_RADIAN_TO_DEGREE;
-            angVec[2] *= SimTK_RADIAN_TO_DEGREE;
-        }           
+            angVec *= SimTK_RADIAN_TO_DEGREE;
+            angVel *= SimTK_RADIAN_TO_DEGREE;
+            angAcc *= SimTK_RADIAN_TO_DEGREE;
+        }
 
-        // FILL KINEMATICS ARRAY
-        int I = 6*i;
+        // FILL KINEMATICS ARRAYS
+        int I=6*i;
         memcpy(&_kin[I],&vec[0],3*sizeof(double));
         memcpy(&_kin[I+3],&angVec[0],3*sizeof(double));
+        memcpy(&_vKin[I],&vel[0],3*sizeof(double));
+        memcpy(&_vKin[I+3],&angVel[0],3*sizeof(double));
+        memcpy(&_aKin[I],&acc[0],3*sizeof(double));
+        memcpy(&_aKin[I+3],&angAcc[0],3*sizeof(double));
     }
 
     if(_recordCenterOfMass) {
-        double rV[3] = { 0.0, 0.0, 0.0 };
+        SimTK::Vec3 rP(0.0),rV(0.0),rA(0.0);
         for(int i=0;i<bs.getSize();i++) {
             Body& body = bs.get(i);
             const SimTK::Vec3& com = body.get_mass_center();
-            vec = body.findStationVelocityInGround(s, com);
-            rV[0] += body.get_mass() * vec[0];
-            rV[1] += body.get_mass() * vec[1];
-            rV[2] += body.get_mass() * vec[2];
-        }
 
-        //COMPUTE VELOCITY OF COM OF WHOLE BODY AND ADD TO ARRAY
-        rV[0] /= Mass;
-        rV[1] /= Mass;
-        rV[2] /= Mass;
-        int I = 6*_bodyIndices.getSize();
-        memcpy(&_kin[I],rV,3*sizeof(double));
-    }
-
-    _vStore->append(s.getTime(),_kin.getSize(),&_kin[0]);
-
-    // ACCELERATIONS
-    for(int i=0;i<_bodyIndices.getSize();i++) {
-        Body& body = bs.get(_bodyIndices[i]);
-        const SimTK::Vec3& com = body.get_mass_center();
-
-        // GET ACCELERATIONS AND ANGULAR ACCELERATIONS
-        vec = body.findStationAccelerationInGround(s, com);
-        angVec = body.getAccelerationInGround(s)[0];
-        if(_expressInLocalFrame) {
-            vec = ground.expressVectorInAnotherFrame(s, vec, body);
-            angVec = ground.expressVectorInAnotherFrame(s, angVec, body);
-        }
+            const SimTK::Transform& X_GB = body.getTransformInGround(s);
+            const SimTK::SpatialVec& V_GB = body.getVelocityInGround(s);
+            const SimTK::SpatialVec& A_GB = body.getAccelerationInGround(s);
+            const SimTK::Vec3 r_G = X_GB.R()*com;
 
-        // CONVERT TO DEGREES?
-        if(getInDegrees()) {
-            angVec[0] *= SimTK_RADIAN_TO_DEGREE;
-            angVec[1] *= SimTK_RADIAN_TO_DEGREE;
-            angVec[2] *= SimTK_RADIAN_TO_DEGREE;
-        }           
-
-        // FILL KINEMATICS ARRAY
-        int I = 6*i;
-        memcpy(&_kin[I],&vec[0],3*sizeof(double));
-        memcpy(&_kin[I+3],&angVec[0],3*sizeof(double));
-    }
-
-    if(_recordCenterOfMass) {
-        double rA[3] = { 0.0, 0.0, 0.0 };
-        for(int i=0;i<bs.getSize();i++) {
-            Body& body = bs.get(i);
-            const SimTK::Vec3& com = body.get_mass_center();
-            vec = body.findStationAccelerationInGround(s, com);
-            rA[0] += body.get_mass() * vec[0];
-            rA[1] += body.get_mass() * vec[1];
-            rA[2] += body.get_mass() * vec[2];
+            // ADD TO WHOLE BODY MASS
+            double mass = body.get_mass();
+            Mass += mass;
+            rP += mass * (X_GB.p() + r_G);
+            rV += mass * (V_GB[1] + SimTK::cross(V_GB[0], r_G));
+            rA += mass * (A_GB[1] + SimTK::cross(A_GB[0], r_G) +
+                SimTK::cross(V_GB[0], SimTK::cross(V_GB[0], r_G)));
         }
 
-        //COMPUTE ACCELERATION OF COM OF WHOLE BODY AND ADD TO ARRAY
-        rA[0] /= Mass;
-        rA[1] /= Mass;
-        rA[2] /= Mass;
+        //COMPUTE POSITION, VELOCITY, AND ACCELERATION OF COM OF WHOLE BODY
+        //AND ADD TO ARRAYS
+        rP /= Mass;
+        rV /= Mass;
+        rA /= Mass;
         int I = 6*_bodyIndices.getSize();
-        memcpy(&_kin[I],rA,3*sizeof(double));
+        memcpy(&_kin[I],&rP[0],3*sizeof(double));
+        memcpy(&_vKin[I],&rV[0],3*sizeof(double));
+        memcpy(&_aKin[I],&rA[0],3*sizeof(double));
     }
 
-    _aStore->append(s.getTime(),_kin.getSize(),&_kin[0]);
+    _pStore->append(s.getTime(),_kin.getSize(),&_kin[0]);
+    _vStore->append(s.getTime(),_vKin.getSize(),&_vKin[0]);
+    _aStore->append(s.getTime(),_aKin.getSize(),&_aKin[0]);
 
     //printf("BodyKinematics:\taT:\t%.16f\trA[1]:\t%.16f\n",s.getTime(),rA[1]);
     return(0);
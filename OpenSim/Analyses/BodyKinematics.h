@@ -66,6 +66,10 @@ protected:
     Array<int> _bodyIndices;
     bool _recordCenterOfMass;
     Array<double> _kin;
+    /** Velocity and acceleration rows filled alongside _kin in record()'s
+    single pass over the bodies. */
+    Array<double> _vKin;
+    Array<double> _aKin;
 
     Storage *_pStore;
     Storage *_vStore;
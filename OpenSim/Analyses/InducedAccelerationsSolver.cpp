@@ -46,6 +46,7 @@ InducedAccelerationsSolver::InducedAccelerationsSolver(const Model& model) :
     _modelCopy = model;
     _modelCopy.initSystem();
     _forceThreshold = 1.0; // 1N
+    _cachedFrameTime = SimTK::NaN;
 }
 
 //=============================================================================
@@ -72,24 +73,16 @@ const SimTK::Vector& InducedAccelerationsSolver::solve(const SimTK::State& s,
     int nu = _modelCopy.getNumSpeeds();
     double aT = s.getTime();
 
-    SimTK::State& s_solver = _modelCopy.updWorkingState();
-
-    //_modelCopy.initStateWithoutRecreatingSystem(s_solver);
-    // Just need to set current time and kinematics to determine state of constraints
-    s_solver.setTime(aT);
-    s_solver.updQ()=s.getQ();
-    s_solver.updU()=s.getU();
-
-    // Check the external forces and determine if contact constraints should be applied at this time
-    // and turn constraint on if it should be.
-    Array<bool> constraintOn = applyContactConstraintAccordingToExternalForces(s_solver);
+    // Engage the contact constraints and rebuild the constrained system only
+    // if a previous solve has not already done so for this frame; the setup
+    // (and the factorizations it triggers) is identical for every
+    // contributor at the same frame.
+    if (!isFrameInitialized(s)) {
+        initializeFrame(s);
+    }
+    const Array<bool>& constraintOn = _cachedConstraintOn;
 
-    // Hang on to a state that has the right flags for contact constraints turned on/off
-    _modelCopy.setPropertiesFromState(s_solver);
-    // Use this state for the remainder of this step (record)
-    s_solver = _modelCopy.getMultibodySystem().realizeTopology();
-    // DO NOT recreate the system, will lose location of constraint
-    _modelCopy.initStateWithoutRecreatingSystem(s_solver);
+    SimTK::State& s_solver = _modelCopy.updWorkingState();
 
     //cout << "Solving for contributor: " << _contributors[c] << endl;
     // Need to be at the dynamics stage to disable a force
@@ -254,6 +247,63 @@ const SimTK::Vector& InducedAccelerationsSolver::solve(const SimTK::State& s,
     return s_solver.getUDot();
 }
 
+/* Solve for the induced accelerations (udot_f) of all named contributors,
+   sharing one frame setup (constraint engagement and system rebuild) */
+void InducedAccelerationsSolver::solve(const SimTK::State& s,
+        const Array<std::string>& forceNames,
+        SimTK::Array_<SimTK::Vector>& inducedUdots)
+{
+    int nf = forceNames.getSize();
+    inducedUdots.resize(nf);
+
+    // Perform the frame setup once up front; the per-contributor solves
+    // below detect the initialized frame and reuse it.
+    initializeFrame(s);
+
+    for(int i=0; i<nf; i++){
+        inducedUdots[i] = solve(s, forceNames[i]);
+    }
+}
+
+void InducedAccelerationsSolver::initializeFrame(const SimTK::State& s)
+{
+    double aT = s.getTime();
+
+    SimTK::State& s_solver = _modelCopy.updWorkingState();
+
+    //_modelCopy.initStateWithoutRecreatingSystem(s_solver);
+    // Just need to set current time and kinematics to determine state of constraints
+    s_solver.setTime(aT);
+    s_solver.updQ()=s.getQ();
+    s_solver.updU()=s.getU();
+
+    // Check the external forces and determine if contact constraints should be applied at this time
+    // and turn constraint on if it should be.
+    _cachedConstraintOn = applyContactConstraintAccordingToExternalForces(s_solver);
+
+    // Hang on to a state that has the right flags for contact constraints turned on/off
+    _modelCopy.setPropertiesFromState(s_solver);
+    // Use this state for the remainder of this frame
+    s_solver = _modelCopy.getMultibodySystem().realizeTopology();
+    // DO NOT recreate the system, will lose location of constraint
+    _modelCopy.initStateWithoutRecreatingSystem(s_solver);
+
+    // Remember the frame so subsequent solves can tell when the setup above
+    // can be reused across contributors.
+    _cachedFrameTime = aT;
+    _cachedFrameQ = s.getQ();
+}
+
+bool InducedAccelerationsSolver::
+    isFrameInitialized(const SimTK::State& s) const
+{
+    if(_cachedFrameQ.size() != s.getQ().size())
+        return false;
+
+    return (s.getTime() == _cachedFrameTime) &&
+           ((s.getQ() - _cachedFrameQ).normInf() == 0);
+}
+
 const SimTK::State& InducedAccelerationsSolver::
     getSolvedState(const SimTK::State& s) const
 {
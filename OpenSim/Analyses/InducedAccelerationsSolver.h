@@ -164,6 +164,20 @@ public:
                 bool computeActuatorPotentialOnly=false,
                 SimTK::Vector_<SimTK::SpatialVec>* constraintReactions=0);
 
+    /** Solve for the induced (generalized) accelerations of all the named
+        force contributors at the frame given by the state. The frame setup
+        (engaging the contact constraints and rebuilding the constrained
+        system) is performed once and shared by every contributor, which is
+        considerably cheaper than solving each contributor independently.
+        @param[in]  state       current State of the model
+        @param[in]  forceNames  names of the model Force contributors
+                                ("gravity", "velocity" and "total" are
+                                 recognized as for the solve by name above)
+        @param[out] inducedUdots  induced generalized accelerations (udot),
+                                  one Vector per named contributor */
+    void solve(const SimTK::State& state,
+        const Array<std::string>& forceNames,
+        SimTK::Array_<SimTK::Vector>& inducedUdots);
 
 //----------------------------------------------------------------------------
 /** Convenience coordinate, body, or center of mass acceleration access after
@@ -186,14 +200,29 @@ protected:
         the state is not at the acceleration stage, an exception is thrown. */
     const SimTK::State& getSolvedState(const SimTK::State& s) const;
 
+    /** Engage the contact constraints according to the external forces and
+        rebuild the constrained system for the frame given by the state. The
+        result is cached so that every per-contributor solve at the same
+        frame (same time and coordinates) reuses the setup instead of
+        repeating the topology rebuild and the factorizations it incurs. */
+    void initializeFrame(const SimTK::State& s);
+    /** Whether the cached frame setup corresponds to the given state. */
+    bool isFrameInitialized(const SimTK::State& s) const;
+
     Array<bool> applyContactConstraintAccordingToExternalForces(SimTK::State &s);
 
 private:
     double _forceThreshold;
     Set<Force> _forcesToReplace;
-    Set<Constraint> _replacementConstraints; 
+    Set<Constraint> _replacementConstraints;
     Model _modelCopy;
 
+    // Frame (time, coordinates, engaged constraints) the solver was last
+    // initialized for; shared across all contributors at that frame.
+    double _cachedFrameTime;
+    SimTK::Vector _cachedFrameQ;
+    Array<bool> _cachedConstraintOn;
+
 //=============================================================================
 }; // END of class InducedAccelerationsSolver
 }; //namespace
@@ -117,6 +117,7 @@ setNull()
     // OTHER VARIABLES
     _useModelForceSet = true;
     _storage = NULL;
+    _suppliedStatesSplineSet = false;
     _ownsForceSet = false;
     _forceSet = NULL;
     _numCoordinateActuators = 0;
@@ -492,7 +493,8 @@ int InverseDynamics::begin(const SimTK::State& s )
         _lapackWork.resize(lwork);
     }
 
-    _statesSplineSet=GCVSplineSet(5,_statesStore);
+    if(!_suppliedStatesSplineSet)
+        _statesSplineSet=GCVSplineSet(5,_statesStore);
 
     // DESCRIPTION AND LABELS
     constructDescription();
@@ -64,6 +64,8 @@ protected:
 
     Storage *_storage;
     GCVSplineSet _statesSplineSet;
+    /** Whether _statesSplineSet was supplied via setStatesSplineSet(). */
+    bool _suppliedStatesSplineSet;
 
     Array<double> _dydt;
     Array<int> _accelerationIndices;
@@ -112,6 +114,13 @@ public:
     bool getUseModelForceSet() { return _useModelForceSet; }
     void setUseModelForceSet(bool aUseModelForceSet) { _useModelForceSet = aUseModelForceSet; }
 
+    /** Supply a precomputed spline fit of the states storage to use in place
+    of fitting one in begin().  Useful when the same states are analyzed
+    repeatedly (e.g., RRA evaluates residuals before and after adjusting the
+    model), so the fit is paid for only once. */
+    void setStatesSplineSet(const GCVSplineSet& aSplineSet)
+    {   _statesSplineSet = aSplineSet; _suppliedStatesSplineSet = true; }
+
     void setModel(Model& aModel) override;
     //--------------------------------------------------------------------------
     // ANALYSIS
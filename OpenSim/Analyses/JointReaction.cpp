@@ -482,11 +482,14 @@ void JointReaction::loadForcesFromFile()
 void JointReaction::
 setupStorage()
 {
-    // Reaction Loads
-    _storeReactionLoads.reset(0);
-    _storeReactionLoads.setName("Joint Reaction Loads");
-    _storeReactionLoads.setDescription(getDescription());
-    _storeReactionLoads.setColumnLabels(getColumnLabels());
+    // Reaction Loads: reset the table and give it the current column labels,
+    // less the leading time column which the table holds separately.
+    _reactionLoadsTable = TimeSeriesTable();
+    const Array<string>& labels = getColumnLabels();
+    std::vector<string> tableLabels;
+    for(int i=1; i<labels.getSize(); i++)
+        tableLabels.push_back(labels[i]);
+    _reactionLoadsTable.setColumnLabels(tableLabels);
 
     // Actuator forces - if a forces file is specified, load the forces storage data to _storeActuation
     if(!(_forcesFileName == "")) loadForcesFromFile();
@@ -520,9 +523,9 @@ setModel(Model& aModel)
     constructColumnLabels();
 
     int numJoints = _reactionList.getSize();
-    // set size of working array of loads.  Each load has 3 components each
+    // set size of working row of loads.  Each load has 3 components each
     // for force, moment, and point of application
-    _Loads.setSize(9*numJoints);
+    _Loads.resize(9*numJoints);
 }
 
 
@@ -545,12 +548,14 @@ setModel(Model& aModel)
 int JointReaction::
 record(const SimTK::State& s)
 {
-    /** if a forces file is specified replace the computed actuation with the 
-        forces from storage.*/
-    SimTK::State s_analysis = s;
-
-    _model->updMultibodySystem().realize(s_analysis, s.getSystemStage());
+    /** if a forces file is specified replace the computed actuation with the
+        forces from storage, which requires a writable copy of the state.
+        Otherwise analyze the passed-in state directly so an acceleration
+        cache that is already realized is reused rather than recomputed. */
+    SimTK::State s_forces;
     if(_useForceStorage){
+        s_forces = s;
+        _model->updMultibodySystem().realize(s_forces, s.getSystemStage());
         const auto& actuatorSet = _model->getActuators();
         int nA = actuatorSet.getSize();
         Array<double> forces(0,nA);
@@ -568,20 +573,22 @@ record(const SimTK::State& s)
             }
             const ScalarActuator* act = dynamic_cast<const ScalarActuator*>(&actuatorSet[actuatorIndex]);
             if (act){
-                act->overrideActuation(s_analysis, true);
-                act->setOverrideActuation(s_analysis, forces[storageIndex]);
+                act->overrideActuation(s_forces, true);
+                act->setOverrideActuation(s_forces, forces[storageIndex]);
             }
         }
     }
+    const SimTK::State& s_analysis = _useForceStorage ? s_forces : s;
+
     // VARIABLES
     const Ground& ground = _model->getGround();
 
     _model->realizeAcceleration(s_analysis);
 
-    /* retrieved desired joint reactions, convert to desired bodies, and convert
-    *  to desired reference frames*/
+    /* retrieve desired joint reactions, convert to desired bodies, convert
+    *  to desired reference frames and emit directly into the preallocated
+    *  output row*/
     int numOutputJoints = _reactionList.getSize();
-    Vector_<Vec3> forcesVec(numOutputJoints), momentsVec(numOutputJoints), pointsVec(numOutputJoints);
     for(int i=0; i<numOutputJoints; i++) {
         JointReactionKey currentKey = _reactionList[i];
         const Joint& joint = *currentKey.joint;
@@ -614,23 +621,17 @@ record(const SimTK::State& s)
         Vec3 force = ground.expressVectorInAnotherFrame(s_analysis, jointReaction[1], expressedInBody);
         Vec3 moment = ground.expressVectorInAnotherFrame(s_analysis, jointReaction[0], expressedInBody);
 
-        /* place results in the truncated loads vectors*/
-        forcesVec[i] = force;
-        momentsVec[i] = moment;
-        pointsVec[i] = pointOfApplication;
-    }
-
-    /* fill out row construction array*/
-    for(int i=0;i<numOutputJoints;i++) {
+        /* place results directly in the output row*/
         int I = 9*i;
         for(int j=0;j<3;j++) {
-            _Loads[I+j] = forcesVec[i][j];
-            _Loads[I+j+3] = momentsVec[i][j];
-            _Loads[I+j+6] = pointsVec[i][j];
+            _Loads[I+j] = force[j];
+            _Loads[I+j+3] = moment[j];
+            _Loads[I+j+6] = pointOfApplication[j];
         }
     }
-    /* Write the reaction data to storage*/
-    _storeReactionLoads.append(s.getTime(),_Loads.getSize(),&_Loads[0]);
+
+    /* Write the reaction data to the table*/
+    _reactionLoadsTable.appendRow(s.getTime(), _Loads);
 
     return 0;
 }
@@ -649,15 +650,20 @@ int JointReaction::
 begin(const SimTK::State& s)
 {
     if(!proceed()) return(0);
+
+    // Rebuild the reported-joint plan here so that changes made to the
+    // properties or the model after setModel() are honored for this trial.
+    setupReactionList();
+    constructDescription();
+    constructColumnLabels();
+    _Loads.resize(9*_reactionList.getSize());
+
     // Read forces file here rather than during initialization
     setupStorage();
 
-    // RESET STORAGE
-    _storeReactionLoads.reset(s.getTime());
-
     // RECORD
     int status = 0;
-    if(_storeReactionLoads.getSize()<=0) {
+    if(_reactionLoadsTable.getNumRows() <= 0) {
         status = record(s);
     }
 
@@ -728,7 +734,11 @@ printResults(const string &aBaseName,const string &aDir,double aDT,
                  const string &aExtension)
 {
     // Reaction Loads
-    Storage::printResult(&_storeReactionLoads,
+    Storage reactionLoads;
+    convertTableToStorage(&_reactionLoadsTable, reactionLoads);
+    reactionLoads.setName("Joint Reaction Loads");
+    reactionLoads.setDescription(getDescription());
+    Storage::printResult(&reactionLoads,
             aBaseName + "_" + getName() + "_ReactionLoads", aDir, aDT,
             aExtension);
 
@@ -29,6 +29,7 @@
 //=============================================================================
 #include <OpenSim/Common/PropertyStr.h>
 #include <OpenSim/Common/PropertyStrArray.h>
+#include <OpenSim/Common/TimeSeriesTable.h>
 #include <OpenSim/Simulation/Model/Analysis.h>
 #include "osimAnalysesDLL.h"
 
@@ -112,8 +113,9 @@ protected:
     /** Storage for holding actuator forces IF SPECIFIED by user.*/
     Storage *_storeActuation;
 
-    /** Storage for recording joint Reaction loads.*/
-    Storage _storeReactionLoads;
+    /** Table for recording joint Reaction loads, one preallocated row
+    *   emitted per frame.*/
+    TimeSeriesTable _reactionLoadsTable;
 
     //-----------------------------------------------------------------------
     // Additional storage and internal working variable
@@ -127,9 +129,9 @@ protected:
     *   joints in the model*/
     Array<double> _allLoads;
 
-    /** Internal work array for holding the computed joint loads of all 
-    *   joints specified in _jointNames*/
-    Array<double> _Loads;
+    /** Internal work row for holding the computed joint loads of all
+    *   joints specified in _jointNames; appended to the table each frame*/
+    SimTK::RowVector _Loads;
 
     /** Internal work array for holding the JointReactionKeys to identify the 
     *   desired joints, onBody, and inFrame to be output*/
@@ -180,6 +182,10 @@ public:
      /** Public accessors for the inFrame property */
     const Array<std::string>& getInFrame() const { return _inFrame; }
     void setInFrame( Array<std::string>& inFrame) { _inFrame = inFrame; }
+    /** Access the recorded joint reaction loads (forces, moments and points
+    *   of application per reported joint) as a TimeSeriesTable. */
+    const TimeSeriesTable& getReactionLoadsTable() const
+    {   return _reactionLoadsTable; }
 
     //-------------------------------------------------------------------------
     // INTEGRATION
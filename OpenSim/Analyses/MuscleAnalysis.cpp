@@ -26,6 +26,9 @@
 //=============================================================================
 // INCLUDES
 //=============================================================================
+#include <exception>
+#include <vector>
+
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include "MuscleAnalysis.h"
@@ -640,27 +643,37 @@ int MuscleAnalysis::record(const SimTK::State& s)
 
     if (getComputeMoments()){
         // LOOP OVER ACTIVE MOMENT ARM STORAGE OBJECTS
-        Coordinate *q = NULL;
-        Storage *maStore=NULL, *mStore=NULL;
         int nq = _momentArmStorageArray.getSize();
-        Array<double> ma(0.0,nm),m(0.0,nm);
 
-        for(int i=0; i<nq; i++) {
+        // The moment arms of all (coordinate, muscle) pairs come from the
+        // model's shared moment-arm solver, which sweeps the full
+        // muscle-by-coordinate matrix in one pass and caches it on the pose,
+        // so other consumers that need moment arms at this state share the
+        // same computation.
+        std::vector<const GeometryPath*> paths(nm);
+        for(int j=0; j<nm; j++) {
+            paths[j] = &_muscleArray[j]->getGeometryPath();
+        }
+        const SimTK::Matrix& momentArms =
+            _model->getMomentArmSolver().solveMomentArmsCached(s, paths);
 
-            q = _momentArmStorageArray[i]->q;
-            maStore = _momentArmStorageArray[i]->momentArmStore;
-            mStore = _momentArmStorageArray[i]->momentStore;
-           
-            // bool locked = q->getLocked(s);
+        // The matrix columns are ordered as the model's CoordinateSet; map
+        // each active moment-arm storage to its column.
+        const CoordinateSet& coords = _model->getCoordinateSet();
 
-            _model->getMultibodySystem().realize(s, s.getSystemStage());
-            // LOOP OVER MUSCLES
+        // APPEND TO THE MOMENT ARM AND MOMENT STORAGE OBJECTS
+        Array<double> ma(0.0,nm),m(0.0,nm);
+        for(int i=0; i<nq; i++) {
+            const int col =
+                coords.getIndex(_momentArmStorageArray[i]->q->getName());
             for(int j=0; j<nm; j++) {
-                ma[j] = _muscleArray[j]->computeMomentArm(s,*q);
+                ma[j] = momentArms(j, col);
                 m[j] = ma[j] * force[j];
             }
-            maStore->append(s.getTime(),nm,&ma[0]);
-            mStore->append(s.getTime(),nm,&m[0]);
+            _momentArmStorageArray[i]->momentArmStore
+                ->append(s.getTime(),nm,&ma[0]);
+            _momentArmStorageArray[i]->momentStore
+                ->append(s.getTime(),nm,&m[0]);
         }
     }
     return 0;
@@ -44,22 +44,19 @@ int OutputReporter::begin(const SimTK::State& s)
 
     _pvtModel.reset(_model->clone());
 
-    _tableReporterDouble = new TableReporter_<double>();
-    _tableReporterDouble->setName("ReporterDouble");
-    auto& inputDouble = _tableReporterDouble->updInput("inputs");
-    _tableReporterVec3 = new TableReporter_<SimTK::Vec3>();
-    _tableReporterVec3->setName("ReporterVec3");
-    auto& inputVec3 = _tableReporterVec3->updInput("inputs");
-    _tableReporterSpatialVec = new TableReporter_<SimTK::SpatialVec>();
-    _tableReporterSpatialVec->setName("ReporterSpatialVec");
-    auto& inputSpatialVec = _tableReporterSpatialVec->updInput("inputs");
-
-    _pvtModel->addComponent(_tableReporterDouble.get());
-    _pvtModel->addComponent(_tableReporterVec3.get());
-    _pvtModel->addComponent(_tableReporterSpatialVec.get());
+    _tableReporterDouble = nullptr;
+    _tableReporterVec3 = nullptr;
+    _tableReporterSpatialVec = nullptr;
 
     _minimumStageToRealize = SimTK::Stage::Time;
 
+    // Resolve and classify the requested outputs up front, so that only
+    // reporters for the types actually requested are added to the model;
+    // report() then skips the types that have nothing to record.
+    std::vector<std::string> doublePaths;
+    std::vector<std::string> vec3Paths;
+    std::vector<std::string> spatialVecPaths;
+
     for (int i = 0; i < getProperty_output_paths().size(); ++i) {
         std::string componentPath;
         std::string outputName;
@@ -78,13 +75,13 @@ int OutputReporter::begin(const SimTK::State& s)
         const auto& comp = _pvtModel->getComponent(componentPath);
         auto& out = comp.getOutput(outputName);
         if (out.getTypeName() == "double") {
-            inputDouble.appendConnecteePath(path);
+            doublePaths.push_back(path);
         }
         else if (out.getTypeName() == "Vec3") {
-            inputVec3.appendConnecteePath(path);
+            vec3Paths.push_back(path);
         }
         else if (out.getTypeName() == "SpatialVec") {
-            inputSpatialVec.appendConnecteePath(path);
+            spatialVecPaths.push_back(path);
         }
         else {
             log_warn("Output '{}' of type {} is not supported by "
@@ -97,6 +94,31 @@ int OutputReporter::begin(const SimTK::State& s)
         }
     }
 
+    if (!doublePaths.empty()) {
+        _tableReporterDouble = new TableReporter_<double>();
+        _tableReporterDouble->setName("ReporterDouble");
+        auto& input = _tableReporterDouble->updInput("inputs");
+        for (const auto& path : doublePaths)
+            input.appendConnecteePath(path);
+        _pvtModel->addComponent(_tableReporterDouble.get());
+    }
+    if (!vec3Paths.empty()) {
+        _tableReporterVec3 = new TableReporter_<SimTK::Vec3>();
+        _tableReporterVec3->setName("ReporterVec3");
+        auto& input = _tableReporterVec3->updInput("inputs");
+        for (const auto& path : vec3Paths)
+            input.appendConnecteePath(path);
+        _pvtModel->addComponent(_tableReporterVec3.get());
+    }
+    if (!spatialVecPaths.empty()) {
+        _tableReporterSpatialVec = new TableReporter_<SimTK::SpatialVec>();
+        _tableReporterSpatialVec->setName("ReporterSpatialVec");
+        auto& input = _tableReporterSpatialVec->updInput("inputs");
+        for (const auto& path : spatialVecPaths)
+            input.appendConnecteePath(path);
+        _pvtModel->addComponent(_tableReporterSpatialVec.get());
+    }
+
     _pvtModel->initSystem();
     report(s);
 
@@ -135,22 +157,28 @@ int OutputReporter::printResults(const std::string& baseName,
 
     std::string prefix = dir.empty() ? "" : dir + "/";
 
-    auto& tableD = _tableReporterDouble->getTable();
-    if (tableD.getNumColumns()) {
-        STOFileAdapter_<double>::write(tableD,
-            prefix + baseName + "_Outputs" + extension);
+    if (!_tableReporterDouble.empty()) {
+        auto& tableD = _tableReporterDouble->getTable();
+        if (tableD.getNumColumns()) {
+            STOFileAdapter_<double>::write(tableD,
+                prefix + baseName + "_Outputs" + extension);
+        }
     }
 
-    auto& tableV3 = _tableReporterVec3->getTable();
-    if (tableV3.getNumColumns()) {
-        STOFileAdapter_<SimTK::Vec3>::write(tableV3,
-            prefix + baseName + "_OutputsVec3" + extension);
+    if (!_tableReporterVec3.empty()) {
+        auto& tableV3 = _tableReporterVec3->getTable();
+        if (tableV3.getNumColumns()) {
+            STOFileAdapter_<SimTK::Vec3>::write(tableV3,
+                prefix + baseName + "_OutputsVec3" + extension);
+        }
     }
 
-    auto& tableSV = _tableReporterSpatialVec->getTable();
-    if (tableSV.getNumColumns()) {
-        STOFileAdapter_<SimTK::SpatialVec>::write(tableSV,
-            prefix + baseName + "_OutputsSpatialVec" + extension);
+    if (!_tableReporterSpatialVec.empty()) {
+        auto& tableSV = _tableReporterSpatialVec->getTable();
+        if (tableSV.getNumColumns()) {
+            STOFileAdapter_<SimTK::SpatialVec>::write(tableSV,
+                prefix + baseName + "_OutputsSpatialVec" + extension);
+        }
     }
 
     return 0;
@@ -159,7 +187,9 @@ int OutputReporter::printResults(const std::string& baseName,
 void OutputReporter::report(const SimTK::State& s)
 {
     _pvtModel->getMultibodySystem().realize(s, _minimumStageToRealize);
-    _tableReporterDouble->report(s);
-    _tableReporterVec3->report(s);
-    _tableReporterSpatialVec->report(s);
+    // Only the reporters instantiated in begin() for the requested output
+    // types exist; the rest have nothing to record.
+    if (!_tableReporterDouble.empty()) _tableReporterDouble->report(s);
+    if (!_tableReporterVec3.empty()) _tableReporterVec3->report(s);
+    if (!_tableReporterSpatialVec.empty()) _tableReporterSpatialVec->report(s);
 }
@@ -148,7 +148,6 @@ void PointKinematics::
 setNull()
 {
     // POINTERS
-    _kin = NULL;
     _pStore = NULL;
     _vStore = NULL;
     _aStore = NULL;
@@ -202,6 +201,10 @@ operator=(const PointKinematics &aPointKinematics)
     _pointName = aPointKinematics._pointName;
     _bodyName = aPointKinematics._bodyName;
     _relativeToBodyName = aPointKinematics._relativeToBodyName;
+    _batchPointNames = aPointKinematics._batchPointNames;
+    _batchBodyNames = aPointKinematics._batchBodyNames;
+    _batchPoints = aPointKinematics._batchPoints;
+    _batchBodies = aPointKinematics._batchBodies;
 
     // STORAGE
     deleteStorage();
@@ -233,6 +236,11 @@ constructDescription()
             _model->getName().c_str());
     }
     strcat(descrip,tmp);
+    if(_batchPointNames.getSize()>0) {
+        sprintf(tmp,"%d additional point(s) are recorded in the columns that follow.\n",
+            _batchPointNames.getSize());
+        strcat(descrip,tmp);
+    }
     strcat(descrip,"\nUnits are S.I. units (seconds, meters, Newtons,...)\n\n");
 
     setDescription(descrip);
@@ -250,6 +258,11 @@ constructColumnLabels()
     labels.append(getPointName() + "_X");
     labels.append(getPointName() + "_Y");
     labels.append(getPointName() + "_Z");
+    for(int i=0;i<_batchPointNames.getSize();i++) {
+        labels.append(_batchPointNames[i] + "_X");
+        labels.append(_batchPointNames[i] + "_Y");
+        labels.append(_batchPointNames[i] + "_Z");
+    }
     setColumnLabels(labels);
 }
 
@@ -297,30 +310,43 @@ deleteStorage()
 // GET AND SET
 //=============================================================================
 //_____________________________________________________________________________
+/**
+ * Resolve a body name to a physical frame in the model.
+ *
+ * @param aName Name of the body or frame.
+ * @return Frame pointer, or NULL if no match was found.
+ */
+const PhysicalFrame* PointKinematics::
+resolveBody(const std::string &aName)
+{
+    if (_model->hasComponent<PhysicalFrame>(aName))
+        return &_model->getComponent<PhysicalFrame>(aName);
+    if (_model->hasComponent<PhysicalFrame>("./bodyset/" + aName))
+        return &_model->getComponent<PhysicalFrame>("./bodyset/" + aName);
+    return nullptr;
+}
+//_____________________________________________________________________________
 /* Set the model for which the point kinematics are to be computed. */
 void PointKinematics::setModel(Model& model)
 {
     Analysis::setModel(model);
 
-    _body = nullptr;
-    _relativeToBody = nullptr;
-
-    // Map name to index
-    if (model.hasComponent<PhysicalFrame>(_bodyName))
-        _body = &model.getComponent<PhysicalFrame>(_bodyName);
-    else if (model.hasComponent<PhysicalFrame>("./bodyset/" + _bodyName))
-        _body = &model.getComponent<PhysicalFrame>("./bodyset/"+_bodyName);
+    // Map names to frames
+    _body = resolveBody(_bodyName);
+    _relativeToBody = resolveBody(_relativeToBodyName);
 
-    if (model.hasComponent<PhysicalFrame>(_relativeToBodyName))
-        _relativeToBody = &model.getComponent<PhysicalFrame>(
-            _relativeToBodyName);
-    else if(model.hasComponent<PhysicalFrame>("./bodyset/" + _relativeToBodyName))
-        _relativeToBody = &model.getComponent<PhysicalFrame>(
-            "./bodyset/" + _relativeToBodyName);
+    for(int i=0;i<_batchBodyNames.getSize();i++) {
+        _batchBodies[i] = resolveBody(_batchBodyNames[i]);
+        if(_batchBodies[i]==NULL)
+            throw Exception("PointKinematics: ERR- Could not find body named '"+_batchBodyNames[i]+"'",__FILE__,__LINE__);
+    }
 
     // DESCRIPTION AND LABELS
     constructDescription();
     constructColumnLabels();
+    if(_aStore!=NULL) _aStore->setColumnLabels(getColumnLabels());
+    if(_vStore!=NULL) _vStore->setColumnLabels(getColumnLabels());
+    if(_pStore!=NULL) _pStore->setColumnLabels(getColumnLabels());
 }
 //-----------------------------------------------------------------------------
 // BODY
@@ -451,6 +477,54 @@ getPointName()
     return(_pointName);
 }
 
+//-----------------------------------------------------------------------------
+// MULTI-POINT BATCH
+//-----------------------------------------------------------------------------
+//_____________________________________________________________________________
+/**
+ * Append an additional point to be recorded by this instance.
+ *
+ * All points recorded by one instance share the same storages (one column
+ * triple per point) and are computed together in record(), so tracking many
+ * points with one analysis is much cheaper than one analysis per point.
+ * The result files are named after the primary point.
+ *
+ * @param aPointName Name for the point; used for its column labels.
+ * @param aBodyName Name of the body the point is fixed to.
+ * @param aPoint Point coordinates in the body frame.
+ */
+void PointKinematics::
+appendPoint(const string &aPointName,const string &aBodyName,
+    const SimTK::Vec3 &aPoint)
+{
+    _batchPointNames.append(aPointName);
+    _batchBodyNames.append(aBodyName);
+    _batchPoints.append(aPoint[0]);
+    _batchPoints.append(aPoint[1]);
+    _batchPoints.append(aPoint[2]);
+    _batchBodies.push_back(NULL);
+
+    if(_model!=NULL) {
+        _batchBodies.back() = resolveBody(aBodyName);
+        if(_batchBodies.back()==NULL)
+            throw Exception("PointKinematics.appendPoint: ERR- Could not find body named '"+aBodyName+"'",__FILE__,__LINE__);
+        constructColumnLabels();
+        if(_aStore!=NULL) _aStore->setColumnLabels(getColumnLabels());
+        if(_vStore!=NULL) _vStore->setColumnLabels(getColumnLabels());
+        if(_pStore!=NULL) _pStore->setColumnLabels(getColumnLabels());
+    }
+}
+//_____________________________________________________________________________
+/**
+ * Get the total number of points recorded by this instance, including the
+ * primary point.
+ */
+int PointKinematics::
+getNumPoints() const
+{
+    return(1 + _batchPointNames.getSize());
+}
+
 //-----------------------------------------------------------------------------
 // STORAGE
 //-----------------------------------------------------------------------------
@@ -518,36 +592,51 @@ setStorageCapacityIncrements(int aIncrement)
 int PointKinematics::
 record(const SimTK::State& s)
 {
-    // VARIABLES
-    SimTK::Vec3 vec;
-
     const double& time = s.getTime();
     const Ground& ground = _model->getGround();
 
-    // POSITION
-    vec = _body->findStationLocationInGround(s, _point);
-    if(_relativeToBody){
-        vec = ground.findStationLocationInAnotherFrame(s, vec, *_relativeToBody);
-    }
-
-    _pStore->append(time, vec);
-
-    // VELOCITY
-    vec = _body->findStationVelocityInGround(s, _point);
-    if(_relativeToBody){
-        vec = ground.expressVectorInAnotherFrame(s, vec, *_relativeToBody);
-    }
-
-    _vStore->append(time, vec);
-
-    // ACCELERATIONS
+    // The accelerations below read the acceleration-stage cache.
     _model->getMultibodySystem().realize(s, SimTK::Stage::Acceleration);
-    vec = _body->findStationAccelerationInGround(s, _point);
-    if(_relativeToBody){
-        vec = ground.expressVectorInAnotherFrame(s, vec, *_relativeToBody);
+
+    int numPoints = getNumPoints();
+    _pKin.setSize(3*numPoints);
+    _vKin.setSize(3*numPoints);
+    _aKin.setSize(3*numPoints);
+
+    // Single pass over the points: fetch each point's body kinematics in
+    // ground once and derive the point's position, velocity, and acceleration
+    // from them, rather than issuing three findStation* queries per point
+    // that each re-fetch the body kinematics.
+    for(int i=0;i<numPoints;i++) {
+        const PhysicalFrame *body = (i==0) ? _body : _batchBodies[i-1];
+        const SimTK::Vec3 point = (i==0) ? _point :
+            SimTK::Vec3(_batchPoints[3*(i-1)],_batchPoints[3*(i-1)+1],
+                _batchPoints[3*(i-1)+2]);
+
+        const SimTK::Transform& X_GF = body->getTransformInGround(s);
+        const SimTK::SpatialVec& V_GF = body->getVelocityInGround(s);
+        const SimTK::SpatialVec& A_GF = body->getAccelerationInGround(s);
+        const SimTK::Vec3 r_G = X_GF.R()*point;
+
+        SimTK::Vec3 pos = X_GF.p() + r_G;
+        SimTK::Vec3 vel = V_GF[1] + SimTK::cross(V_GF[0], r_G);
+        SimTK::Vec3 acc = A_GF[1] + SimTK::cross(A_GF[0], r_G) +
+            SimTK::cross(V_GF[0], SimTK::cross(V_GF[0], r_G));
+
+        if(_relativeToBody){
+            pos = ground.findStationLocationInAnotherFrame(s, pos, *_relativeToBody);
+            vel = ground.expressVectorInAnotherFrame(s, vel, *_relativeToBody);
+            acc = ground.expressVectorInAnotherFrame(s, acc, *_relativeToBody);
+        }
+
+        memcpy(&_pKin[3*i],&pos[0],3*sizeof(double));
+        memcpy(&_vKin[3*i],&vel[0],3*sizeof(double));
+        memcpy(&_aKin[3*i],&acc[0],3*sizeof(double));
     }
 
-    _aStore->append(time, vec);
+    _pStore->append(time,_pKin.getSize(),&_pKin[0]);
+    _vStore->append(time,_vKin.getSize(),&_vKin[0]);
+    _aStore->append(time,_aKin.getSize(),&_aKin[0]);
 
     return(0);
 }
@@ -37,6 +37,7 @@
 
 #include <OpenSim/Common/PropertyStr.h>
 #include <OpenSim/Simulation/Model/Analysis.h>
+#include <vector>
 
 const int PointKinematicsNAME_LENGTH = 256;
 const int PointKinematicsBUFFER_LENGTH = 2048;
@@ -83,7 +84,20 @@ protected:
     std::string &_pointName;
     std::string &_relativeToBodyName;
 
-    double *_kin;
+    /** Additional points recorded by this instance beyond the primary point,
+    stored structure-of-arrays (names, body names, flattened x-y-z triples)
+    so that record() fills one contiguous row per storage for all points. */
+    Array<std::string> _batchPointNames;
+    Array<std::string> _batchBodyNames;
+    Array<double> _batchPoints;
+    std::vector<const PhysicalFrame*> _batchBodies;
+
+    /** Work rows for the positions, velocities, and accelerations of all
+    points at the current frame. */
+    Array<double> _pKin;
+    Array<double> _vKin;
+    Array<double> _aKin;
+
     Storage *_pStore;
     Storage *_vStore;
     Storage *_aStore;
@@ -104,6 +118,7 @@ private:
     void constructColumnLabels();
     void allocateStorage();
     void deleteStorage();
+    const PhysicalFrame* resolveBody(const std::string &aName);
     //--------------------------------------------------------------------------
     // CONSTRUCTION
     //--------------------------------------------------------------------------
@@ -131,6 +146,10 @@ public:
     // POINT NAME
     void setPointName(const std::string &aName);
     const std::string &getPointName();
+    // MULTI-POINT BATCH
+    void appendPoint(const std::string &aPointName,
+        const std::string &aBodyName, const SimTK::Vec3 &aPoint);
+    int getNumPoints() const;
     // MODEL
     void setModel(Model& aModel) override;
     
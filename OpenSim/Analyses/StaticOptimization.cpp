@@ -139,6 +139,7 @@ void StaticOptimization::setNull()
     _convergenceCriterion = 1e-4;
     _maximumIterations = 100;
     _forceReporter = nullptr;
+    _parametersAreWarm = false;
     setName("StaticOptimization");
 }
 //_____________________________________________________________________________
@@ -331,37 +332,45 @@ record(const SimTK::State& s)
     //_optimizationConvergenceTolerance = 1e-004;
     //_maxIterations = 2000;
 
-    // Optimization target
+    // Optimization target and optimizer, built on first use and reused
+    // across frames so the optimizer keeps its workspace between solves.
     _modelWorkingCopy->setAllControllersEnabled(false);
-    StaticOptimizationTarget target(sWorkingCopy,_modelWorkingCopy,na,nacc,_useMusclePhysiology);
-    target.setStatesStore(_statesStore);
-    target.setStatesSplineSet(_statesSplineSet);
-    target.setActivationExponent(_activationExponent);
-    target.setDX(_numericalDerivativeStepSize);
-
-    // Pick optimizer algorithm
-    SimTK::OptimizerAlgorithm algorithm = SimTK::InteriorPoint;
-    //SimTK::OptimizerAlgorithm algorithm = SimTK::CFSQP;
-
-    // Optimizer
-    SimTK::Optimizer *optimizer = new SimTK::Optimizer(target, algorithm);
-
-    // Optimizer options
-    //cout<<"\nSetting optimizer print level to "<<_printLevel<<".\n";
-    optimizer->setDiagnosticsLevel(_printLevel);
-    //cout<<"Setting optimizer convergence criterion to "<<_convergenceCriterion<<".\n";
-    optimizer->setConvergenceTolerance(_convergenceCriterion);
-    //cout<<"Setting optimizer maximum iterations to "<<_maximumIterations<<".\n";
-    optimizer->setMaxIterations(_maximumIterations);
-    optimizer->useNumericalGradient(false);
-    optimizer->useNumericalJacobian(false);
-    if(algorithm == SimTK::InteriorPoint) {
-        // Some IPOPT-specific settings
-        optimizer->setLimitedMemoryHistory(500); // works well for our small systems
-        optimizer->setAdvancedBoolOption("warm_start",true);
-        optimizer->setAdvancedRealOption("obj_scaling_factor",1);
-        optimizer->setAdvancedRealOption("nlp_scaling_max_gradient",1);
+    if (!_target || _target->getNumParameters() != na ||
+            _target->getNumConstraints() != nacc) {
+        _target.reset(new StaticOptimizationTarget(sWorkingCopy,
+            _modelWorkingCopy, na, nacc, _useMusclePhysiology));
+        _target->setStatesStore(_statesStore);
+        _target->setStatesSplineSet(_statesSplineSet);
+        _target->setActivationExponent(_activationExponent);
+        _target->setDX(_numericalDerivativeStepSize);
+
+        // Pick optimizer algorithm
+        SimTK::OptimizerAlgorithm algorithm = SimTK::InteriorPoint;
+        //SimTK::OptimizerAlgorithm algorithm = SimTK::CFSQP;
+
+        // Optimizer
+        _optimizer.reset(new SimTK::Optimizer(*_target, algorithm));
+
+        // Optimizer options
+        //cout<<"\nSetting optimizer print level to "<<_printLevel<<".\n";
+        _optimizer->setDiagnosticsLevel(_printLevel);
+        //cout<<"Setting optimizer convergence criterion to "<<_convergenceCriterion<<".\n";
+        _optimizer->setConvergenceTolerance(_convergenceCriterion);
+        //cout<<"Setting optimizer maximum iterations to "<<_maximumIterations<<".\n";
+        _optimizer->setMaxIterations(_maximumIterations);
+        _optimizer->useNumericalGradient(false);
+        _optimizer->useNumericalJacobian(false);
+        if(algorithm == SimTK::InteriorPoint) {
+            // Some IPOPT-specific settings
+            _optimizer->setLimitedMemoryHistory(500); // works well for our small systems
+            _optimizer->setAdvancedBoolOption("warm_start",true);
+            _optimizer->setAdvancedRealOption("obj_scaling_factor",1);
+            _optimizer->setAdvancedRealOption("nlp_scaling_max_gradient",1);
+        }
+
+        _parametersAreWarm = false;
     }
+    StaticOptimizationTarget& target = *_target;
 
     // Parameter bounds
     SimTK::Vector lowerBounds(na), upperBounds(na);
@@ -373,10 +382,14 @@ record(const SimTK::State& s)
             j++;
         }
     }
-    
+
     target.setParameterLimits(lowerBounds, upperBounds);
 
-    _parameters = 0; // Set initial guess to zeros
+    // Warm start from the previous frame's solution when one is available;
+    // otherwise start the first frame (or a restart after a failure) from
+    // zeros.
+    if (!_parametersAreWarm)
+        _parameters = 0;
 
     // Static optimization
     _modelWorkingCopy->getMultibodySystem().realize(sWorkingCopy,SimTK::Stage::Velocity);
@@ -391,9 +404,13 @@ record(const SimTK::State& s)
 
     try {
         target.setCurrentState( &sWorkingCopy );
-        optimizer->optimize(_parameters);
+        _optimizer->optimize(_parameters);
+        _parametersAreWarm = true;
     }
     catch (const SimTK::Exception::Base& ex) {
+        // cold-start the next frame rather than warm-starting from a
+        // solution the optimizer never found
+        _parametersAreWarm = false;
         log_warn(ex.getMessage());
         log_warn("OPTIMIZATION FAILED...");
         log_warn("StaticOptimization.record: The optimizer could not find a "
@@ -590,6 +607,9 @@ int StaticOptimization::begin(const SimTK::State& s )
 
         _parameters.resize(_modelWorkingCopy->getNumControls());
         _parameters = 0;
+        _target.reset();
+        _optimizer.reset();
+        _parametersAreWarm = false;
     }
 
     _statesSplineSet=GCVSplineSet(5,_statesStore);
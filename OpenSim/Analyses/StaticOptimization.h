@@ -37,10 +37,15 @@
 //=============================================================================
 /**
  */
-namespace OpenSim { 
+namespace SimTK {
+class Optimizer;
+}
+
+namespace OpenSim {
 
 class Model;
 class ForceSet;
+class StaticOptimizationTarget;
 
 /**
  * This class implements static optimization to compute Muscle Forces and 
@@ -91,6 +96,14 @@ protected:
     std::string _optimizerAlgorithm;
     int _printLevel;
 
+    // Optimization target and optimizer reused across record() calls so the
+    // optimizer keeps its workspace; rebuilt only when the problem
+    // dimensions change. Whether _parameters holds the previous frame's
+    // solution and can warm-start the next solve.
+    std::unique_ptr<StaticOptimizationTarget> _target;
+    std::unique_ptr<SimTK::Optimizer> _optimizer;
+    bool _parametersAreWarm;
+
     Model *_modelWorkingCopy;
 
 //=============================================================================
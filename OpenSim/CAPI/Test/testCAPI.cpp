@@ -0,0 +1,204 @@
+/* -------------------------------------------------------------------------- *
+ *                           OpenSim:  testCAPI.cpp                           *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Exercises the C API end to end: the model file is produced with the C++
+ * API, then loaded, stepped, and queried exclusively through osimCAPI.h,
+ * as an embedding C host would. */
+
+#include <OpenSim/CAPI/osimCAPI.h>
+
+#include <OpenSim/Actuators/CoordinateActuator.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+namespace {
+
+const char* theModelFile = "testCAPI_pendulum.osim";
+
+/* A one-degree-of-freedom pendulum with a torque actuator on its joint. */
+void writePendulumModel() {
+    OpenSim::Model model;
+    model.setName("pendulum");
+
+    auto* rod = new OpenSim::Body("rod", 1.0, SimTK::Vec3(0, -0.5, 0),
+            SimTK::Inertia::cylinderAlongY(0.01, 0.5));
+    model.addBody(rod);
+
+    auto* pin = new OpenSim::PinJoint("pin", model.getGround(),
+            SimTK::Vec3(0), SimTK::Vec3(0), *rod, SimTK::Vec3(0),
+            SimTK::Vec3(0));
+    pin->updCoordinate().setName("angle");
+    model.addJoint(pin);
+
+    auto* actuator = new OpenSim::CoordinateActuator("angle");
+    actuator->setName("tau");
+    actuator->setOptimalForce(1.0);
+    model.addForce(actuator);
+
+    model.finalizeConnections();
+    model.print(theModelFile);
+}
+
+} // namespace
+
+TEST_CASE("C API model loading and enumeration") {
+    writePendulumModel();
+
+    osim_Model* model = nullptr;
+    REQUIRE(osim_model_load(theModelFile, &model) == OSIM_OK);
+    REQUIRE(model != nullptr);
+
+    int numStates = 0, numControls = 0, numCoordinates = 0;
+    REQUIRE(osim_model_num_state_variables(model, &numStates) == OSIM_OK);
+    REQUIRE(osim_model_num_controls(model, &numControls) == OSIM_OK);
+    REQUIRE(osim_model_num_coordinates(model, &numCoordinates) == OSIM_OK);
+    CHECK(numStates == 2);
+    CHECK(numControls == 1);
+    CHECK(numCoordinates == 1);
+
+    char buffer[256];
+    int size = sizeof(buffer);
+    REQUIRE(osim_model_control_name(model, 0, buffer, &size) == OSIM_OK);
+    CHECK(std::string{buffer} == "tau");
+    CHECK(size == 4);
+
+    size = sizeof(buffer);
+    REQUIRE(osim_model_coordinate_name(model, 0, buffer, &size) == OSIM_OK);
+    CHECK(std::string{buffer} == "angle");
+
+    size = sizeof(buffer);
+    REQUIRE(osim_model_state_variable_name(model, 0, buffer, &size) ==
+            OSIM_OK);
+    CHECK(std::string{buffer}.find("angle") != std::string::npos);
+
+    SECTION("too-small name buffer reports the required size") {
+        size = 1;
+        CHECK(osim_model_control_name(model, 0, buffer, &size) ==
+              OSIM_BUFFER_TOO_SMALL);
+        CHECK(size == 4);
+    }
+
+    SECTION("bad indices and handles are rejected") {
+        size = sizeof(buffer);
+        CHECK(osim_model_control_name(model, 5, buffer, &size) ==
+              OSIM_INVALID_ARGUMENT);
+        CHECK(osim_model_num_controls(nullptr, &numControls) ==
+              OSIM_INVALID_ARGUMENT);
+    }
+
+    osim_model_destroy(model);
+    std::remove(theModelFile);
+}
+
+TEST_CASE("C API stepping, controls, and outputs") {
+    writePendulumModel();
+
+    osim_Model* model = nullptr;
+    REQUIRE(osim_model_load(theModelFile, &model) == OSIM_OK);
+    osim_Simulation* simulation = nullptr;
+    REQUIRE(osim_simulation_create(model, 1e-5, &simulation) == OSIM_OK);
+    REQUIRE(simulation != nullptr);
+
+    SECTION("an offset pendulum swings back toward equilibrium") {
+        REQUIRE(osim_simulation_reset(simulation, 0.0) == OSIM_OK);
+        const double initialStates[2] = {1.0, 0.0};
+        REQUIRE(osim_simulation_set_state_variables(simulation,
+                        initialStates, 2) == OSIM_OK);
+        REQUIRE(osim_simulation_step(simulation, 0.5) == OSIM_OK);
+
+        double time = 0;
+        REQUIRE(osim_simulation_get_time(simulation, &time) == OSIM_OK);
+        CHECK(time == 0.5);
+
+        double angle = 0;
+        REQUIRE(osim_simulation_get_coordinate_values(simulation,
+                        &angle, 1) == OSIM_OK);
+        CHECK(angle < 1.0);
+
+        double states[2] = {0, 0};
+        REQUIRE(osim_simulation_get_state_variables(simulation,
+                        states, 2) == OSIM_OK);
+        CHECK(states[0] == angle);
+    }
+
+    SECTION("a control torque drives the pendulum off equilibrium") {
+        REQUIRE(osim_simulation_reset(simulation, 0.0) == OSIM_OK);
+        const double torque = 1.0;
+        REQUIRE(osim_simulation_set_controls(simulation, &torque, 1) ==
+                OSIM_OK);
+        REQUIRE(osim_simulation_step(simulation, 0.5) == OSIM_OK);
+
+        double angle = 0;
+        REQUIRE(osim_simulation_get_coordinate_values(simulation,
+                        &angle, 1) == OSIM_OK);
+        CHECK(angle > 0.0);
+    }
+
+    SECTION("outputs resolve once and read per step") {
+        int index = -1;
+        REQUIRE(osim_simulation_add_output(simulation,
+                        "/jointset/pin/angle", "value", &index) == OSIM_OK);
+        CHECK(index == 0);
+        int numOutputs = 0;
+        REQUIRE(osim_simulation_num_outputs(simulation, &numOutputs) ==
+                OSIM_OK);
+        CHECK(numOutputs == 1);
+
+        REQUIRE(osim_simulation_reset(simulation, 0.0) == OSIM_OK);
+        const double initialStates[2] = {0.5, 0.0};
+        REQUIRE(osim_simulation_set_state_variables(simulation,
+                        initialStates, 2) == OSIM_OK);
+        REQUIRE(osim_simulation_step(simulation, 0.1) == OSIM_OK);
+
+        double output = 0, angle = 0;
+        REQUIRE(osim_simulation_get_outputs(simulation, &output, 1) ==
+                OSIM_OK);
+        REQUIRE(osim_simulation_get_coordinate_values(simulation,
+                        &angle, 1) == OSIM_OK);
+        CHECK(output == angle);
+    }
+
+    SECTION("wrong buffer lengths are rejected") {
+        double values[4] = {0, 0, 0, 0};
+        CHECK(osim_simulation_set_controls(simulation, values, 3) ==
+              OSIM_INVALID_ARGUMENT);
+        CHECK(osim_simulation_get_state_variables(simulation, values, 4) ==
+              OSIM_INVALID_ARGUMENT);
+    }
+
+    osim_simulation_destroy(simulation);
+    osim_model_destroy(model);
+    std::remove(theModelFile);
+}
+
+TEST_CASE("C API error reporting") {
+    osim_Model* model = nullptr;
+    CHECK(osim_model_load("no-such-file.osim", &model) == OSIM_ERROR);
+    CHECK(std::strlen(osim_last_error()) > 0);
+    CHECK(std::string{osim_version()}.size() > 0);
+}
@@ -0,0 +1,398 @@
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  osimCAPI.cpp                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCAPI.h"
+
+#include <OpenSim/Common/About.h>
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Simulation/Control/PrescribedController.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Model/Model.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OpenSim;
+
+/* The opaque handle types. A handle may not be shared between threads, so
+ * no locking is needed here; the error string is per thread. */
+
+struct osim_Model {
+    std::unique_ptr<Model> model;
+    std::vector<std::string> stateVariableNames;
+    std::vector<std::string> controlNames;
+    std::vector<std::string> coordinateNames;
+};
+
+struct osim_Simulation {
+    std::unique_ptr<Model> model;
+    std::unique_ptr<Manager> manager;
+    /* One preallocated control function per actuator, in actuator-set
+     * order; osim_simulation_set_controls() only writes their values. */
+    std::vector<Constant*> controlFunctions;
+    SimTK::State defaultState;
+    SimTK::State state;
+    SimTK::Vector stateVariableBuffer;
+    std::vector<const AbstractOutput*> outputs;
+    bool managerInitialized{false};
+    /* Set when the state was changed behind the integrator's back and the
+     * manager must be (re)wound before the next step. */
+    bool stateDirty{true};
+};
+
+namespace {
+
+thread_local std::string theLastError{"No error."};
+
+template <typename Callable>
+int guarded(Callable&& callable) {
+    try {
+        return callable();
+    } catch (const std::exception& ex) {
+        theLastError = ex.what();
+        return OSIM_ERROR;
+    } catch (...) {
+        theLastError = "Unknown error.";
+        return OSIM_ERROR;
+    }
+}
+
+int copyName(const std::string& name, char* buffer, int* sizeInOut) {
+    if (sizeInOut == nullptr) return OSIM_INVALID_ARGUMENT;
+    const int required = static_cast<int>(name.size()) + 1;
+    if (buffer == nullptr || *sizeInOut < required) {
+        *sizeInOut = required;
+        return OSIM_BUFFER_TOO_SMALL;
+    }
+    std::memcpy(buffer, name.c_str(), static_cast<size_t>(required));
+    *sizeInOut = required;
+    return OSIM_OK;
+}
+
+int nameAtIndex(const std::vector<std::string>& names,
+                int index,
+                char* buffer,
+                int* sizeInOut) {
+    if (index < 0 || index >= static_cast<int>(names.size()))
+        return OSIM_INVALID_ARGUMENT;
+    return copyName(names[static_cast<size_t>(index)], buffer, sizeInOut);
+}
+
+} // anonymous namespace
+
+const char* osim_version(void) {
+    static const std::string version = GetVersion();
+    return version.c_str();
+}
+
+const char* osim_last_error(void) {
+    return theLastError.c_str();
+}
+
+/* ------------------------------------------------------------------ */
+/* Model                                                              */
+/* ------------------------------------------------------------------ */
+
+int osim_model_load(const char* model_file, osim_Model** model_out) {
+    if (model_file == nullptr || model_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        auto handle = std::make_unique<osim_Model>();
+        handle->model.reset(new Model(model_file));
+        const SimTK::State& state = handle->model->initSystem();
+        (void)state;
+
+        const auto names = handle->model->getStateVariableNames();
+        for (int i = 0; i < names.getSize(); ++i)
+            handle->stateVariableNames.push_back(names[i]);
+        const auto& actuators = handle->model->getActuators();
+        for (int i = 0; i < actuators.getSize(); ++i)
+            handle->controlNames.push_back(actuators.get(i).getName());
+        const auto& coordinates = handle->model->getCoordinateSet();
+        for (int i = 0; i < coordinates.getSize(); ++i)
+            handle->coordinateNames.push_back(coordinates.get(i).getName());
+
+        *model_out = handle.release();
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+void osim_model_destroy(osim_Model* model) {
+    delete model;
+}
+
+int osim_model_num_state_variables(const osim_Model* model, int* num_out) {
+    if (model == nullptr || num_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    *num_out = static_cast<int>(model->stateVariableNames.size());
+    return OSIM_OK;
+}
+
+int osim_model_num_controls(const osim_Model* model, int* num_out) {
+    if (model == nullptr || num_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    *num_out = static_cast<int>(model->controlNames.size());
+    return OSIM_OK;
+}
+
+int osim_model_num_coordinates(const osim_Model* model, int* num_out) {
+    if (model == nullptr || num_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    *num_out = static_cast<int>(model->coordinateNames.size());
+    return OSIM_OK;
+}
+
+int osim_model_state_variable_name(const osim_Model* model,
+                                   int index,
+                                   char* buffer,
+                                   int* size_inout) {
+    if (model == nullptr) return OSIM_INVALID_ARGUMENT;
+    return nameAtIndex(model->stateVariableNames, index, buffer, size_inout);
+}
+
+int osim_model_control_name(const osim_Model* model,
+                            int index,
+                            char* buffer,
+                            int* size_inout) {
+    if (model == nullptr) return OSIM_INVALID_ARGUMENT;
+    return nameAtIndex(model->controlNames, index, buffer, size_inout);
+}
+
+int osim_model_coordinate_name(const osim_Model* model,
+                               int index,
+                               char* buffer,
+                               int* size_inout) {
+    if (model == nullptr) return OSIM_INVALID_ARGUMENT;
+    return nameAtIndex(model->coordinateNames, index, buffer, size_inout);
+}
+
+/* ------------------------------------------------------------------ */
+/* Simulation                                                         */
+/* ------------------------------------------------------------------ */
+
+int osim_simulation_create(const osim_Model* model,
+                           double accuracy,
+                           osim_Simulation** simulation_out) {
+    if (model == nullptr || simulation_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        auto handle = std::make_unique<osim_Simulation>();
+        handle->model.reset(model->model->clone());
+
+        /* The controls the caller sets each step are fed to the model
+         * through a PrescribedController holding one Constant per
+         * actuator; setting a control is then just a value write. */
+        auto* controller = new PrescribedController();
+        controller->setName("osim_capi_controller");
+        const auto& actuators = handle->model->getActuators();
+        for (int i = 0; i < actuators.getSize(); ++i)
+            controller->addActuator(actuators.get(i));
+        handle->model->addController(controller);
+        for (int i = 0; i < actuators.getSize(); ++i) {
+            auto* constant = new Constant(0.0);
+            controller->prescribeControlForActuator(
+                    actuators.get(i).getName(), constant);
+            handle->controlFunctions.push_back(constant);
+        }
+
+        handle->defaultState = handle->model->initSystem();
+        handle->state = handle->defaultState;
+        handle->stateVariableBuffer.resize(
+                handle->model->getNumStateVariables());
+
+        handle->manager.reset(new Manager(*handle->model));
+        if (accuracy > 0)
+            handle->manager->setIntegratorAccuracy(accuracy);
+
+        *simulation_out = handle.release();
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+void osim_simulation_destroy(osim_Simulation* simulation) {
+    delete simulation;
+}
+
+int osim_simulation_reset(osim_Simulation* simulation, double initial_time) {
+    if (simulation == nullptr) return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        simulation->state = simulation->defaultState;
+        simulation->state.setTime(initial_time);
+        simulation->stateDirty = true;
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+int osim_simulation_set_state_variables(osim_Simulation* simulation,
+                                        const double* values,
+                                        int num_values) {
+    if (simulation == nullptr || values == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    if (num_values != simulation->stateVariableBuffer.size())
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        for (int i = 0; i < num_values; ++i)
+            simulation->stateVariableBuffer[i] = values[i];
+        simulation->model->setStateVariableValues(
+                simulation->state, simulation->stateVariableBuffer);
+        simulation->stateDirty = true;
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+int osim_simulation_set_controls(osim_Simulation* simulation,
+                                 const double* controls,
+                                 int num_controls) {
+    if (simulation == nullptr || controls == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    if (num_controls != static_cast<int>(simulation->controlFunctions.size()))
+        return OSIM_INVALID_ARGUMENT;
+    for (int i = 0; i < num_controls; ++i)
+        simulation->controlFunctions[static_cast<size_t>(i)]
+                ->setValue(controls[i]);
+    return OSIM_OK;
+}
+
+int osim_simulation_step(osim_Simulation* simulation, double to_time) {
+    if (simulation == nullptr) return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        if (simulation->stateDirty) {
+            if (simulation->managerInitialized)
+                simulation->manager->reinitialize(simulation->state);
+            else {
+                simulation->manager->initialize(simulation->state);
+                simulation->managerInitialized = true;
+            }
+            simulation->stateDirty = false;
+        }
+        simulation->state = simulation->manager->integrate(to_time);
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+int osim_simulation_get_time(const osim_Simulation* simulation,
+                             double* time_out) {
+    if (simulation == nullptr || time_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    *time_out = simulation->state.getTime();
+    return OSIM_OK;
+}
+
+int osim_simulation_get_state_variables(const osim_Simulation* simulation,
+                                        double* values,
+                                        int num_values) {
+    if (simulation == nullptr || values == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    if (num_values != simulation->stateVariableBuffer.size())
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        const SimTK::Vector stateValues =
+                simulation->model->getStateVariableValues(simulation->state);
+        for (int i = 0; i < num_values; ++i)
+            values[i] = stateValues[i];
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+int osim_simulation_get_coordinate_values(const osim_Simulation* simulation,
+                                          double* values,
+                                          int num_values) {
+    if (simulation == nullptr || values == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        const auto& coordinates = simulation->model->getCoordinateSet();
+        if (num_values != coordinates.getSize())
+            return static_cast<int>(OSIM_INVALID_ARGUMENT);
+        for (int i = 0; i < num_values; ++i)
+            values[i] = coordinates.get(i).getValue(simulation->state);
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+int osim_simulation_get_coordinate_speeds(const osim_Simulation* simulation,
+                                          double* values,
+                                          int num_values) {
+    if (simulation == nullptr || values == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        const auto& coordinates = simulation->model->getCoordinateSet();
+        if (num_values != coordinates.getSize())
+            return static_cast<int>(OSIM_INVALID_ARGUMENT);
+        for (int i = 0; i < num_values; ++i)
+            values[i] = coordinates.get(i).getSpeedValue(simulation->state);
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+/* ------------------------------------------------------------------ */
+/* Outputs                                                            */
+/* ------------------------------------------------------------------ */
+
+int osim_simulation_add_output(osim_Simulation* simulation,
+                               const char* component_path,
+                               const char* output_name,
+                               int* index_out) {
+    if (simulation == nullptr || component_path == nullptr ||
+            output_name == nullptr || index_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        const Component& component =
+                simulation->model->getComponent(component_path);
+        const AbstractOutput& output = component.getOutput(output_name);
+        if (dynamic_cast<const Output<double>*>(&output) == nullptr) {
+            theLastError = "Output '" + std::string{output_name} +
+                           "' of component '" + component_path +
+                           "' is not a double-valued output.";
+            return static_cast<int>(OSIM_ERROR);
+        }
+        simulation->outputs.push_back(&output);
+        *index_out = static_cast<int>(simulation->outputs.size()) - 1;
+        return static_cast<int>(OSIM_OK);
+    });
+}
+
+int osim_simulation_num_outputs(const osim_Simulation* simulation,
+                                int* num_out) {
+    if (simulation == nullptr || num_out == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    *num_out = static_cast<int>(simulation->outputs.size());
+    return OSIM_OK;
+}
+
+int osim_simulation_get_outputs(osim_Simulation* simulation,
+                                double* values,
+                                int num_values) {
+    if (simulation == nullptr || values == nullptr)
+        return OSIM_INVALID_ARGUMENT;
+    if (num_values != static_cast<int>(simulation->outputs.size()))
+        return OSIM_INVALID_ARGUMENT;
+    return guarded([&]() {
+        simulation->model->getMultibodySystem().realize(
+                simulation->state, SimTK::Stage::Report);
+        for (int i = 0; i < num_values; ++i)
+            values[i] = Output<double>::downcast(
+                    *simulation->outputs[static_cast<size_t>(i)])
+                            .getValue(simulation->state);
+        return static_cast<int>(OSIM_OK);
+    });
+}
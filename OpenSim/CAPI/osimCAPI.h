@@ -0,0 +1,194 @@
+/* -------------------------------------------------------------------------- *
+ *                           OpenSim:  osimCAPI.h                             *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_C_API_H_
+#define OPENSIM_C_API_H_
+
+/* A minimal, stable C API for embedding the OpenSim simulation core in a
+ * C (or C-ABI) host process, without SWIG and without C++ ABI coupling.
+ * It wraps model loading, state initialization, setting controls, stepping
+ * the integration, and reading outputs.
+ *
+ * The API is designed for low-overhead repeated calls from a controller
+ * loop: all name-to-index resolution happens at setup time (see
+ * osim_simulation_add_output()), the per-step calls take only handles,
+ * indices and caller-owned buffers, and no memory is allocated per step.
+ *
+ * Every function returns a status code (see osim_Status); on failure,
+ * osim_last_error() describes the most recent error on the calling thread.
+ * Handles are created and destroyed by this library; a handle must not be
+ * used concurrently from multiple threads, but distinct handles are
+ * independent.
+ */
+
+#ifndef _WIN32
+    #define OSIMCAPI_API
+#else
+    #ifdef OSIMCAPI_EXPORTS
+        #define OSIMCAPI_API __declspec(dllexport)
+    #else
+        #define OSIMCAPI_API __declspec(dllimport)
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Status codes returned by every function in this API. */
+typedef enum osim_Status {
+    OSIM_OK                = 0,
+    /* A failure inside OpenSim; osim_last_error() has the details. */
+    OSIM_ERROR             = 1,
+    /* A null handle, bad index, or a buffer of the wrong length. */
+    OSIM_INVALID_ARGUMENT  = 2,
+    /* A string buffer was too small; the required size was returned. */
+    OSIM_BUFFER_TOO_SMALL  = 3
+} osim_Status;
+
+/* An opaque loaded model; create with osim_model_load(). */
+typedef struct osim_Model osim_Model;
+/* An opaque simulation (model + integrator + state); create with
+ * osim_simulation_create(). */
+typedef struct osim_Simulation osim_Simulation;
+
+/* The OpenSim version string, e.g. "4.4". */
+OSIMCAPI_API const char* osim_version(void);
+
+/* A description of the most recent error on the calling thread. The
+ * returned pointer stays valid until the next failing call on the same
+ * thread. */
+OSIMCAPI_API const char* osim_last_error(void);
+
+/* ------------------------------------------------------------------ */
+/* Model                                                              */
+/* ------------------------------------------------------------------ */
+
+/* Load a model from a .osim file and initialize its system. On success,
+ * *model_out owns the model; release it with osim_model_destroy(). */
+OSIMCAPI_API int osim_model_load(const char* model_file,
+                                 osim_Model** model_out);
+
+OSIMCAPI_API void osim_model_destroy(osim_Model* model);
+
+/* Sizes of the buffers the per-step calls expect. Controls are one per
+ * actuator, in the order of the model's actuator set. */
+OSIMCAPI_API int osim_model_num_state_variables(const osim_Model* model,
+                                                int* num_out);
+OSIMCAPI_API int osim_model_num_controls(const osim_Model* model,
+                                         int* num_out);
+OSIMCAPI_API int osim_model_num_coordinates(const osim_Model* model,
+                                            int* num_out);
+
+/* Copy the name of the state variable / control / coordinate at the given
+ * index into the caller's buffer (including the null terminator). If the
+ * buffer is too small, returns OSIM_BUFFER_TOO_SMALL and sets *size_inout
+ * to the required size; otherwise sets it to the copied size. Call these
+ * at setup time to build index maps; the indices match the buffer layout
+ * of the per-step calls below. */
+OSIMCAPI_API int osim_model_state_variable_name(const osim_Model* model,
+                                                int index,
+                                                char* buffer,
+                                                int* size_inout);
+OSIMCAPI_API int osim_model_control_name(const osim_Model* model,
+                                         int index,
+                                         char* buffer,
+                                         int* size_inout);
+OSIMCAPI_API int osim_model_coordinate_name(const osim_Model* model,
+                                            int index,
+                                            char* buffer,
+                                            int* size_inout);
+
+/* ------------------------------------------------------------------ */
+/* Simulation                                                         */
+/* ------------------------------------------------------------------ */
+
+/* Create a simulation of the given model with the given integrator
+ * accuracy (pass 0 for the default). The simulation holds its own copy of
+ * the model, so one loaded model can drive several simulations. Release
+ * with osim_simulation_destroy(). */
+OSIMCAPI_API int osim_simulation_create(const osim_Model* model,
+                                        double accuracy,
+                                        osim_Simulation** simulation_out);
+
+OSIMCAPI_API void osim_simulation_destroy(osim_Simulation* simulation);
+
+/* Rewind to the model's default state at the given time. Also the way to
+ * start a fresh episode on an existing simulation; the integrator is
+ * reused, not rebuilt. */
+OSIMCAPI_API int osim_simulation_reset(osim_Simulation* simulation,
+                                       double initial_time);
+
+/* Overwrite all state variable values (length must equal
+ * osim_model_num_state_variables(); order matches the name indices). */
+OSIMCAPI_API int osim_simulation_set_state_variables(
+        osim_Simulation* simulation, const double* values, int num_values);
+
+/* Set the control (one per actuator) applied from now on. Cheap: values
+ * are copied into preallocated slots; no lookups, no allocation. */
+OSIMCAPI_API int osim_simulation_set_controls(osim_Simulation* simulation,
+                                              const double* controls,
+                                              int num_controls);
+
+/* Advance the simulation to the given time. */
+OSIMCAPI_API int osim_simulation_step(osim_Simulation* simulation,
+                                      double to_time);
+
+OSIMCAPI_API int osim_simulation_get_time(const osim_Simulation* simulation,
+                                          double* time_out);
+
+/* Read current values into caller-owned buffers. Lengths must equal the
+ * corresponding osim_model_num_* count. */
+OSIMCAPI_API int osim_simulation_get_state_variables(
+        const osim_Simulation* simulation, double* values, int num_values);
+OSIMCAPI_API int osim_simulation_get_coordinate_values(
+        const osim_Simulation* simulation, double* values, int num_values);
+OSIMCAPI_API int osim_simulation_get_coordinate_speeds(
+        const osim_Simulation* simulation, double* values, int num_values);
+
+/* ------------------------------------------------------------------ */
+/* Outputs                                                            */
+/* ------------------------------------------------------------------ */
+
+/* Resolve a double-valued component output once, at setup time. The
+ * component is named by its path in the model (e.g. "/jointset/knee/...")
+ * and the output by its name. On success, *index_out is the output's slot
+ * in the buffer filled by osim_simulation_get_outputs(). */
+OSIMCAPI_API int osim_simulation_add_output(osim_Simulation* simulation,
+                                            const char* component_path,
+                                            const char* output_name,
+                                            int* index_out);
+
+OSIMCAPI_API int osim_simulation_num_outputs(
+        const osim_Simulation* simulation, int* num_out);
+
+/* Evaluate every added output at the current state, in the order the
+ * outputs were added. num_values must equal osim_simulation_num_outputs().
+ * No lookups or allocation per call. */
+OSIMCAPI_API int osim_simulation_get_outputs(osim_Simulation* simulation,
+                                             double* values,
+                                             int num_values);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* OPENSIM_C_API_H_ */
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <fstream>
+#include <thread>
 #include "Simbody.h"
 #include "Exception.h"
 #include "FileAdapter.h"
@@ -50,15 +52,14 @@ APDMDataReader::extendRead(const std::string& fileName) const {
     std::vector<int>  orientationsIndex;
 
     int n_imus = _settings.getProperty_ExperimentalSensors().size();
-    int last_size = 1024;
     // Will read data into pre-allocated Matrices in-memory rather than appendRow
-    // on the fly which copies the whole table on every call.
-    SimTK::Matrix_<SimTK::Quaternion> rotationsData{ last_size, n_imus };
-    SimTK::Matrix_<SimTK::Vec3> linearAccelerationData{ last_size, n_imus };
-    SimTK::Matrix_<SimTK::Vec3> magneticHeadingData{ last_size, n_imus };
-    SimTK::Matrix_<SimTK::Vec3> angularVelocityData{ last_size, n_imus };
+    // on the fly which copies the whole table on every call; the matrices
+    // are sized once the number of data lines is known.
+    SimTK::Matrix_<SimTK::Quaternion> rotationsData{ 0, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> linearAccelerationData{ 0, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> magneticHeadingData{ 0, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> angularVelocityData{ 0, n_imus };
     std::vector<double> times;
-    times.resize(last_size);
     // We support two formats, they contain similar data but headers are different
     std::string line;
     // Line 1
@@ -119,11 +120,15 @@ APDMDataReader::extendRead(const std::string& fileName) const {
             find_start_column(tokens, APDMDataReader::orientation_labels, sensorName, orientationsIndex);
         }
     }
-    // Will create a table to map 
-    // internally keep track of what data was found in input files
-    bool foundLinearAccelerationData = accIndex.size()>0;
-    bool foundMagneticHeadingData = magIndex.size()>0;
-    bool foundAngularVelocityData = gyroIndex.size()>0;
+    // Will create a table to map
+    // internally keep track of what data was found in input files,
+    // and whether the settings ask for it to be decoded at all
+    bool foundLinearAccelerationData = accIndex.size() > 0 &&
+            _settings.get_read_linear_accelerations();
+    bool foundMagneticHeadingData = magIndex.size() > 0 &&
+            _settings.get_read_magnetic_heading();
+    bool foundAngularVelocityData = gyroIndex.size() > 0 &&
+            _settings.get_read_angular_velocity();
 
     // If no Orientation data is available we'll abort
     OPENSIM_THROW_IF((orientationsIndex.size() == 0),
@@ -131,80 +136,93 @@ APDMDataReader::extendRead(const std::string& fileName) const {
     // Line 4, Units unused
     std::getline(in_stream, line);
 
-    // For all tables, will create row, stitch values from different sensors then append
-    bool done = false;
-    double time = 0.0;
-    double timeIncrement = 1 / dataRate;
-    int rowNumber = 0;
-    while (!done){
-        // Make vectors one per table
-        TimeSeriesTableQuaternion::RowVector
-            orientation_row_vector{ n_imus, SimTK::Quaternion() };
-        TimeSeriesTableVec3::RowVector
-            accel_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        TimeSeriesTableVec3::RowVector
-            magneto_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        TimeSeriesTableVec3::RowVector
-            gyro_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        std::vector<std::string> nextRow = FileAdapter::getNextLine(in_stream, ",");
-        if (nextRow.empty()) {
-            done = true;
-            break;
-        }
-        // Cycle through the imus collating values
-        for (int imu_index = 0; imu_index < n_imus; ++imu_index) {
-            // parse gyro info from in_stream
-           if (foundLinearAccelerationData)
-                accel_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[accIndex[imu_index]]),
-                    std::stod(nextRow[accIndex[imu_index] + 1]), std::stod(nextRow[accIndex[imu_index] + 2]));
-            if (foundMagneticHeadingData)
-                magneto_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[magIndex[imu_index]]),
-                    std::stod(nextRow[magIndex[imu_index] + 1]), std::stod(nextRow[magIndex[imu_index] + 2]));
-            if (foundAngularVelocityData)
-                gyro_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[gyroIndex[imu_index]]),
-                    std::stod(nextRow[gyroIndex[imu_index] + 1]), std::stod(nextRow[gyroIndex[imu_index] + 2]));
-            // Create Quaternion from values in file, assume order in file W, X, Y, Z
-            orientation_row_vector[imu_index] = 
-                SimTK::Quaternion(std::stod(nextRow[orientationsIndex[imu_index]]),
+    // Slurp the remaining data lines so decoding can proceed over row
+    // ranges in parallel; a line's tokens only ever fill its own row of the
+    // preallocated matrices.
+    std::vector<std::string> dataLines;
+    while (std::getline(in_stream, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) break;
+        dataLines.push_back(std::move(line));
+    }
+
+    const int numRows = int(dataLines.size());
+    const double timeIncrement = 1 / dataRate;
+    times.resize(numRows);
+    rotationsData.resizeKeep(numRows, n_imus);
+    // Only matrices being decoded need storage.
+    linearAccelerationData.resizeKeep(
+            foundLinearAccelerationData ? numRows : 0, n_imus);
+    magneticHeadingData.resizeKeep(
+            foundMagneticHeadingData ? numRows : 0, n_imus);
+    angularVelocityData.resizeKeep(
+            foundAngularVelocityData ? numRows : 0, n_imus);
+
+    // Decode rows [startRow, endRow) of the collected lines into the
+    // preallocated matrices, only touching the selected signals.
+    auto decodeRows = [&](int startRow, int endRow) {
+        for (int rowNumber = startRow; rowNumber < endRow; ++rowNumber) {
+            const std::vector<std::string> nextRow =
+                    FileAdapter::tokenize(dataLines[rowNumber], ",");
+            // We could get some indication of time from file or generate
+            // time based on rate. Here we use the latter mechanism.
+            times[rowNumber] = rowNumber * timeIncrement;
+            // Cycle through the imus collating values
+            for (int imu_index = 0; imu_index < n_imus; ++imu_index) {
+                if (foundLinearAccelerationData)
+                    linearAccelerationData(rowNumber, imu_index) = SimTK::Vec3(
+                        std::stod(nextRow[accIndex[imu_index]]),
+                        std::stod(nextRow[accIndex[imu_index] + 1]),
+                        std::stod(nextRow[accIndex[imu_index] + 2]));
+                if (foundMagneticHeadingData)
+                    magneticHeadingData(rowNumber, imu_index) = SimTK::Vec3(
+                        std::stod(nextRow[magIndex[imu_index]]),
+                        std::stod(nextRow[magIndex[imu_index] + 1]),
+                        std::stod(nextRow[magIndex[imu_index] + 2]));
+                if (foundAngularVelocityData)
+                    angularVelocityData(rowNumber, imu_index) = SimTK::Vec3(
+                        std::stod(nextRow[gyroIndex[imu_index]]),
+                        std::stod(nextRow[gyroIndex[imu_index] + 1]),
+                        std::stod(nextRow[gyroIndex[imu_index] + 2]));
+                // Create Quaternion from values in file, assume order in
+                // file W, X, Y, Z
+                rotationsData(rowNumber, imu_index) = SimTK::Quaternion(
+                    std::stod(nextRow[orientationsIndex[imu_index]]),
                     std::stod(nextRow[orientationsIndex[imu_index] + 1]),
                     std::stod(nextRow[orientationsIndex[imu_index] + 2]),
                     std::stod(nextRow[orientationsIndex[imu_index] + 3]));
+            }
         }
-        // append to the tables
-        times[rowNumber] = time;
-        if (foundLinearAccelerationData) 
-            linearAccelerationData[rowNumber] =  accel_row_vector;
-        if (foundMagneticHeadingData) 
-            magneticHeadingData[rowNumber] = magneto_row_vector;
-        if (foundAngularVelocityData) 
-            angularVelocityData[rowNumber] = gyro_row_vector;
-        rotationsData[rowNumber] = orientation_row_vector;
-        // We could get some indication of time from file or generate time based on rate
-        // Here we use the latter mechanism.
-        time += timeIncrement;
-        rowNumber++;
-        if (std::remainder(rowNumber, last_size) == 0) {
-            // resize all Data/Matrices, double the size  while keeping data
-            int newSize = last_size*2;
-            times.resize(newSize);
-            // Repeat for Data matrices in use
-            if (foundLinearAccelerationData) linearAccelerationData.resizeKeep(newSize, n_imus);
-            if (foundMagneticHeadingData) magneticHeadingData.resizeKeep(newSize, n_imus);
-            if (foundAngularVelocityData) angularVelocityData.resizeKeep(newSize, n_imus);
-            rotationsData.resizeKeep(newSize, n_imus);
-            last_size = newSize;
+    };
+
+    // Short files are not worth the thread spin-up.
+    const int minRowsPerThread = 512;
+    int numThreads = std::min(int(std::thread::hardware_concurrency()),
+            numRows / minRowsPerThread);
+    if (numThreads > 1) {
+        const int rowsPerThread = numRows / numThreads;
+        std::vector<std::thread> threads;
+        // A decode failure (e.g. malformed number) must surface to the
+        // caller, not kill the process on a worker thread.
+        std::vector<std::exception_ptr> workerExceptions(numThreads);
+        for (int t = 0; t < numThreads; ++t) {
+            const int startRow = t * rowsPerThread;
+            const int endRow =
+                    (t == numThreads - 1) ? numRows : startRow + rowsPerThread;
+            threads.emplace_back([&, t, startRow, endRow]() {
+                try {
+                    decodeRows(startRow, endRow);
+                } catch (...) {
+                    workerExceptions[t] = std::current_exception();
+                }
+            });
         }
+        for (auto& thread : threads) thread.join();
+        for (const auto& exception : workerExceptions)
+            if (exception) std::rethrow_exception(exception);
+    } else {
+        decodeRows(0, numRows);
     }
-    // Trim Matrices in use to actual data and move into tables
-    times.resize(rowNumber);
-    // Repeat for Data matrices in use and create Tables from them or size 0 for empty
-    linearAccelerationData.resizeKeep(foundLinearAccelerationData? rowNumber : 0,
-        n_imus);
-    magneticHeadingData.resizeKeep(foundMagneticHeadingData? rowNumber : 0,
-            n_imus);
-    angularVelocityData.resizeKeep(foundAngularVelocityData? rowNumber :0,
-        n_imus);
-    rotationsData.resizeKeep(rowNumber, n_imus);
     // Now create the tables from matrices
     // Create 4 tables for Rotations, LinearAccelerations, AngularVelocity, MagneticHeading
     // Tables could be empty if data is not present in file(s)
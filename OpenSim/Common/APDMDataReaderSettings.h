@@ -39,6 +39,19 @@ public:
     OpenSim_DECLARE_LIST_PROPERTY(ExperimentalSensors, ExperimentalSensor,
         "List of Experimental sensors and desired associated column labels in resulting tables");
 
+    OpenSim_DECLARE_PROPERTY(read_linear_accelerations, bool,
+        "Whether to decode accelerometer columns into the "
+        "linear_accelerations table (default true). Skipping signals that "
+        "are not needed avoids decoding their columns at read time.");
+
+    OpenSim_DECLARE_PROPERTY(read_magnetic_heading, bool,
+        "Whether to decode magnetometer columns into the magnetic_heading "
+        "table (default true).");
+
+    OpenSim_DECLARE_PROPERTY(read_angular_velocity, bool,
+        "Whether to decode gyroscope columns into the angular_velocity "
+        "table (default true).");
+
 public:
     // Default Constructor
     APDMDataReaderSettings() {
@@ -55,6 +68,9 @@ public:
 private:
     void constructProperties() {
         constructProperty_ExperimentalSensors();
+        constructProperty_read_linear_accelerations(true);
+        constructProperty_read_magnetic_heading(true);
+        constructProperty_read_angular_velocity(true);
     }
 };
 
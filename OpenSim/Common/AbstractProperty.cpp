@@ -33,6 +33,21 @@ using namespace SimTK;
 using namespace std;
 
 
+//=============================================================================
+// ALLOCATION
+//=============================================================================
+// Route single-property allocations through the same (possibly pool-backed)
+// machinery as Object; see ObjectAllocationArena in Object.h.
+void* AbstractProperty::operator new(std::size_t numBytes)
+{
+    return ObjectAllocationArena::allocate(numBytes);
+}
+
+void AbstractProperty::operator delete(void* ptr)
+{
+    ObjectAllocationArena::deallocate(ptr);
+}
+
 //=============================================================================
 // CONSTRUCTION
 //=============================================================================
@@ -70,6 +85,20 @@ void AbstractProperty::setNull()
     _maxListSize    = std::numeric_limits<int>::max();
 }
 
+void AbstractProperty::writeToBinaryStream(std::ostream&) const {
+    throw Exception("Property '" + getName() + "' of type " + getTypeName()
+        + " does not support binary serialization; objects carrying "
+          "deprecated properties cannot be written in the binary object "
+          "format.");
+}
+
+void AbstractProperty::readFromBinaryStream(std::istream&, int) {
+    throw Exception("Property '" + getName() + "' of type " + getTypeName()
+        + " does not support binary serialization; objects carrying "
+          "deprecated properties cannot be read from the binary object "
+          "format.");
+}
+
 void AbstractProperty::clear() {
     clearValues();
 }
@@ -25,6 +25,8 @@
 
 // INCLUDES
 #include <assert.h>
+#include <cstddef>
+#include <iosfwd>
 #include <string>
 #include <typeinfo>
 #include "osimCommonDLL.h"
@@ -92,6 +94,21 @@ public:
     /** Return all heap space used by this property. **/
     virtual ~AbstractProperty() {}
 
+#ifndef SWIG
+    /** Like %Object, single-property allocations are routed through the
+    (possibly pool-backed) ObjectAllocationArena machinery so that an entire
+    deserialized object/property tree can be carved out of a pool; see
+    ObjectAllocationArena. **/
+    void* operator new(std::size_t numBytes);
+    /** Return storage obtained from operator new; blocks are routed back to
+    the pool or the global heap, whichever they came from. **/
+    void operator delete(void* ptr);
+    /** Placement new passes through unchanged. **/
+    void* operator new(std::size_t, void* ptr) noexcept { return ptr; }
+    /** Placement delete counterpart (called only if a constructor throws). **/
+    void operator delete(void*, void*) noexcept {}
+#endif
+
     /** Return a new instance of this concrete property object, containing
     new copies of this property's values. The new property object is
     allocated on the heap and it is up to the caller to delete it when done. **/
@@ -120,12 +137,19 @@ public:
     virtual std::string toStringForDisplay(const int precision) const
     {   return toString(); }
 
-    /** This returns a string representation of this property's value type 
+    /** This returns a string representation of this property's value type
     which will be the same as T::getClassName() for Object-derived types T, and
     some reasonably nice name for simple types, including at least "bool",
     "int", "double", "string", "Vec3", "Vector", and "Transform". **/
     virtual std::string getTypeName() const = 0;
 
+    /** Estimated bytes of storage held by this property and its values; used
+    by the component memory footprint report. Object-valued properties report
+    only their own overhead — the contained objects are accounted for
+    separately by the report. **/
+    virtual std::size_t getMemorySizeEstimate() const
+    {   return sizeof(*this); }
+
     /** Return true if this is an "object property", meaning that its values
     are all concrete objects of types that ultimately derive from the %OpenSim
     serializable base class Object. If this returns true then it is safe to 
@@ -376,6 +400,20 @@ protected:
     virtual void writeToXMLElement
        (SimTK::Xml::Element& propertyElement) const = 0;
 
+#ifndef SWIG
+    /** Write this property's value list to a binary stream in the OpenSim
+    binary object format (see Object::printBinary()); the property's name,
+    type, and use-default flag are written by the owning %Object. The default
+    implementation throws: only the new-style typed properties support binary
+    serialization, so an object still carrying deprecated properties cannot
+    be written in the binary format. **/
+    virtual void writeToBinaryStream(std::ostream& out) const;
+
+    /** Restore this property's value list from a binary stream written by
+    writeToBinaryStream(). The default implementation throws; see
+    writeToBinaryStream(). **/
+    virtual void readFromBinaryStream(std::istream& in, int formatVersion);
+#endif
 
     /** How may values are currently stored in this property? If this is an
     object property you can use this with getValueAsObject() to iterate over
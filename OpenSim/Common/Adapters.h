@@ -26,9 +26,22 @@
 #include "DelimFileAdapter.h"
 #include "STOFileAdapter.h"
 #include "CSVFileAdapter.h"
+#include "OSTBFileAdapter.h"
 
 #if defined (WITH_EZC3D)
 
 #include "C3DFileAdapter.h"
 
 #endif
+
+#if defined (WITH_ARROW)
+
+#include "ParquetFileAdapter.h"
+
+#endif
+
+#if defined (WITH_HDF5)
+
+#include "H5FileAdapter.h"
+
+#endif
@@ -0,0 +1,156 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  AllocationTracker.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "AllocationTracker.h"
+
+#include "Component.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace OpenSim;
+
+namespace {
+
+std::atomic<bool> trackingEnabled(false);
+std::atomic<unsigned long long> numAllocations(0);
+std::atomic<unsigned long long> numDeallocations(0);
+std::atomic<unsigned long long> numBytesAllocated(0);
+
+} // namespace
+
+#ifdef OPENSIM_TRACK_ALLOCATIONS
+
+// Replacements of the global allocation functions. They must not themselves
+// allocate, so they count with lock-free atomics and forward to malloc/free.
+// The replacements bind process-wide on the platforms where OpenSim runs
+// natively; on Windows they do not cross DLL boundaries, so allocations made
+// inside Simbody or other dependency DLLs go uncounted there.
+
+void* operator new(std::size_t size) {
+    void* p = std::malloc(size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    if (trackingEnabled.load(std::memory_order_relaxed)) {
+        numAllocations.fetch_add(1, std::memory_order_relaxed);
+        numBytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    void* p = std::malloc(size);
+    if (p != nullptr && trackingEnabled.load(std::memory_order_relaxed)) {
+        numAllocations.fetch_add(1, std::memory_order_relaxed);
+        numBytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* p) noexcept {
+    if (p != nullptr && trackingEnabled.load(std::memory_order_relaxed))
+        numDeallocations.fetch_add(1, std::memory_order_relaxed);
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    operator delete(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    operator delete(p);
+}
+
+#endif // OPENSIM_TRACK_ALLOCATIONS
+
+bool AllocationTracker::isAvailable() {
+#ifdef OPENSIM_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationTracker::setEnabled(bool enabled) {
+    trackingEnabled = enabled;
+}
+
+bool AllocationTracker::isEnabled() {
+    return trackingEnabled;
+}
+
+unsigned long long AllocationTracker::getNumAllocations() {
+    return numAllocations.load(std::memory_order_relaxed);
+}
+
+unsigned long long AllocationTracker::getNumDeallocations() {
+    return numDeallocations.load(std::memory_order_relaxed);
+}
+
+unsigned long long AllocationTracker::getNumBytesAllocated() {
+    return numBytesAllocated.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::resetCounts() {
+    numAllocations = 0;
+    numDeallocations = 0;
+    numBytesAllocated = 0;
+}
+
+AllocationTracker::Scope::Scope(const Component& component, const char* label)
+        : Scope(component.getAbsolutePathString() + "|" + label) {}
+
+AllocationTracker::Scope::Scope(const std::string& label)
+        : _name(label), _startAllocations(getNumAllocations()) {}
+
+AllocationTracker::Scope::~Scope() {
+    // The counter event is recorded even when the count is zero (or counting
+    // is unavailable): a flat zero track is evidence of a clean steady
+    // state, which is what this facility exists to demonstrate.
+    Component::appendRealizeTraceCounter(_name,
+        static_cast<double>(getNumAllocations()));
+}
+
+unsigned long long AllocationTracker::Scope::getNumAllocations() const {
+    return AllocationTracker::getNumAllocations() - _startAllocations;
+}
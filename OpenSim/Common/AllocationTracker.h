@@ -0,0 +1,114 @@
+#ifndef OPENSIM_ALLOCATION_TRACKER_H_
+#define OPENSIM_ALLOCATION_TRACKER_H_
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  AllocationTracker.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+
+#include <cstddef>
+#include <string>
+
+namespace OpenSim {
+
+class Component;
+
+/** Opt-in, process-wide counting of heap allocations, for finding (and then
+asserting the absence of) heap churn in hot loops such as the per-step work of
+a forward simulation.
+
+The counters are fed by replacements of the global `operator new`/
+`operator delete`, which are compiled into osimCommon only when OpenSim is
+configured with the advanced CMake option `OPENSIM_TRACK_ALLOCATIONS`. In an
+ordinary build isAvailable() returns false and every count reads as zero; all
+other calls remain valid so client code need not be conditionally compiled.
+Even in a tracking build, counting costs one relaxed atomic load per
+allocation until setEnabled(true) is called.
+
+Typical use:
+@code
+AllocationTracker::setEnabled(true);
+{
+    AllocationTracker::Scope scope(muscle, "computeEquilibrium");
+    // ... work ...
+    std::cout << scope.getNumAllocations() << std::endl;
+}
+AllocationTracker::setEnabled(false);
+@endcode
+
+A Scope whose lifetime ends while realize-stage tracing is active (see
+Component::startRealizeTracing()) also records its allocation count as a
+counter event in the trace, so allocation spikes line up with the timing
+events in the same viewer. Manager reports allocations per integration step
+through the same counters; see Manager::setRecordAllocationsPerStep() and
+Manager::setAssertZeroSteadyStateAllocations(). */
+class OSIMCOMMON_API AllocationTracker {
+public:
+    /** Whether this build of osimCommon intercepts the global heap (i.e.,
+    whether it was configured with `OPENSIM_TRACK_ALLOCATIONS`). When false,
+    the counters below always read zero. */
+    static bool isAvailable();
+
+    /** Turn counting on or off. Counting is process-wide and off by
+    default. */
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /** Number of calls to `operator new`/`operator new[]` made while counting
+    was enabled, since the last resetCounts(). */
+    static unsigned long long getNumAllocations();
+    /** Number of calls to `operator delete`/`operator delete[]` made while
+    counting was enabled, since the last resetCounts(). */
+    static unsigned long long getNumDeallocations();
+    /** Total bytes requested by counted allocations since the last
+    resetCounts(). */
+    static unsigned long long getNumBytesAllocated();
+
+    /** Reset all counters to zero. */
+    static void resetCounts();
+
+    /** Count the allocations made during this object's lifetime and
+    attribute them to a component and call site, named
+    "<component-path>|<label>" like the realize profiler's rows. If
+    realize-stage tracing is active when the Scope is destructed, the count
+    is appended to the trace as a counter event. */
+    class OSIMCOMMON_API Scope {
+    public:
+        Scope(const Component& component, const char* label);
+        /** For call sites without an associated component; `label` is used
+        as the name verbatim. */
+        explicit Scope(const std::string& label);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /** Allocations counted so far during this Scope's lifetime. */
+        unsigned long long getNumAllocations() const;
+
+    private:
+        std::string _name;
+        unsigned long long _startAllocations{0};
+    };
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_ALLOCATION_TRACKER_H_
@@ -4,6 +4,9 @@
 #include "ezc3d/ezc3d_all.h"
 #endif
 
+#include <algorithm>
+#include <future>
+
 namespace {
 
 #ifdef WITH_EZC3D
@@ -67,6 +70,11 @@ void C3DFileAdapter::write(
 C3DFileAdapter::OutputTables
 C3DFileAdapter::extendRead(const std::string& fileName) const {
 #ifdef WITH_EZC3D
+    OPENSIM_THROW_IF(_decimationFactor < 1,
+                     Exception,
+                     "Decimation factor must be at least 1.");
+    const int decimation = _decimationFactor;
+
     auto c3d = ezc3d::c3d(fileName);
 
     EventTable event_table{};
@@ -101,41 +109,71 @@ C3DFileAdapter::extendRead(const std::string& fileName) const {
                     c3d.parameters().group("POINT")
                             .parameter("RATE").valuesAsDouble()[0]));
 
-    if(numMarkers != 0) {
-
-        int marker_nrow = numFrames;
-        int marker_ncol = numMarkers;
+    // Marker and force-plate conversion only read from the parsed c3d
+    // structures, so the two signal groups can be converted concurrently:
+    // the marker table is built on a worker thread while this thread
+    // converts the force-plate data below.
+    auto buildMarkerTable = [&]() -> std::shared_ptr<TimeSeriesTableVec3> {
+        if(numMarkers == 0) { // return empty table
+            std::vector<double> emptyTimes;
+            std::vector<std::string> emptyLabels;
+            SimTK::Matrix_<SimTK::Vec3> noData;
+            return std::make_shared<TimeSeriesTableVec3>(
+                    emptyTimes, noData, emptyLabels);
+        }
 
-        std::vector<double> marker_times(marker_nrow);
-        SimTK::Matrix_<SimTK::Vec3> marker_matrix(marker_nrow, marker_ncol);
+        // Resolve the marker-name filter to point indices in file order.
+        const auto fileLabels = c3d.parameters().group("POINT")
+                .parameter("LABELS").valuesAsString();
+        std::vector<size_t> selected{};
+        if(_markersToRead.empty()) {
+            for(size_t m = 0; m < fileLabels.size(); ++m)
+                selected.push_back(m);
+        } else {
+            for(size_t m = 0; m < fileLabels.size(); ++m) {
+                if(std::find(_markersToRead.begin(), _markersToRead.end(),
+                             fileLabels[m]) != _markersToRead.end())
+                    selected.push_back(m);
+            }
+            OPENSIM_THROW_IF(selected.size() != _markersToRead.size(),
+                             Exception,
+                             "A marker requested through setMarkersToRead() "
+                             "was not found in file '" + fileName + "'.");
+        }
 
         std::vector<std::string> marker_labels{};
-        for (auto label : c3d.parameters().group("POINT")
-                .parameter("LABELS").valuesAsString()) {
-            marker_labels.push_back(SimTK::Value<std::string>(label));
+        for (auto idx : selected) {
+            marker_labels.push_back(
+                    SimTK::Value<std::string>(fileLabels[idx]));
         }
 
+        const int marker_nrow = (numFrames + decimation - 1) / decimation;
+        const int marker_ncol = static_cast<int>(selected.size());
+
+        std::vector<double> marker_times(marker_nrow);
+        SimTK::Matrix_<SimTK::Vec3> marker_matrix(marker_nrow, marker_ncol);
+
         double time_step{1.0 / pointFrequency};
-        for(int f = 0; f < marker_nrow; ++f) {
-            SimTK::RowVector_<SimTK::Vec3> row{ numMarkers,
+        for(int f = 0, out = 0; f < numFrames; f += decimation, ++out) {
+            SimTK::RowVector_<SimTK::Vec3> row{ marker_ncol,
                                                 SimTK::Vec3(SimTK::NaN) };
-            int m{0};
+            const auto& points = c3d.data().frame(f).points().points();
             // C3D standard is to read empty values as zero, but sets a
             // "residual" value to -1 and it is how it knows to export these
             // values as blank, instead of 0,  when exporting to .trc
             // See: C3D documention 3D Point Residuals
             // Read in value if it is not zero or residual is not -1
-            for(auto pt : c3d.data().frame(f).points().points()) {
+            for(int m = 0; m < marker_ncol; ++m) {
+                const auto& pt = points[selected[m]];
                 if (!pt.isEmpty() ) {//residual is not -1
                     row[m] = SimTK::Vec3{ static_cast<double>(pt.x()),
                                           static_cast<double>(pt.y()),
                                           static_cast<double>(pt.z()) };
                 }
-                ++m;
             }
 
-            marker_matrix.updRow(f) = row;
-            marker_times[f] = 0 + f * time_step; //TODO: 0 should be start_time
+            marker_matrix.updRow(out) = row;
+            marker_times[out] = 0 + f * time_step; //TODO: 0 should be start_time
         }
 
         // Create the data
@@ -147,7 +185,7 @@ C3DFileAdapter::extendRead(const std::string& fileName) const {
         marker_table->
                 updTableMetaData().
                 setValueForKey("DataRate",
-                               std::to_string(pointFrequency));
+                               std::to_string(pointFrequency / decimation));
 
         const auto& units_param = c3d.parameters().group("POINT")
                 .parameter("UNITS").valuesAsString();
@@ -162,17 +200,9 @@ C3DFileAdapter::extendRead(const std::string& fileName) const {
 
         marker_table->updTableMetaData().setValueForKey("events", event_table);
 
-        tables.emplace(_markers, marker_table);
-    }
-    else { // insert empty table
-        std::vector<double> emptyTimes;
-        std::vector<std::string> emptyLabels;
-        SimTK::Matrix_<SimTK::Vec3> noData;
-        auto emptyMarkersTable =
-                std::make_shared<TimeSeriesTableVec3>(
-                        emptyTimes, noData, emptyLabels);
-        tables.emplace(_markers, emptyMarkersTable);
-    }
+        return marker_table;
+    };
+    auto markerFuture = std::async(std::launch::async, buildMarkerTable);
 
     std::vector<SimTK::Matrix_<double>> fpCalMatrices{};
     std::vector<SimTK::Matrix_<double>> fpCorners{};
@@ -233,12 +263,14 @@ C3DFileAdapter::extendRead(const std::string& fileName) const {
                                                    * c3d.header().nbAnalogByFrame());
         const auto& pf_ref(force_platforms_extractor.forcePlatforms());
 
-        std::vector<double> force_times(nf);
-        SimTK::Matrix_<SimTK::Vec3> force_matrix(nf, (int)labels.size());
+        const int force_nrow = (nf + decimation - 1) / decimation;
+        std::vector<double> force_times(force_nrow);
+        SimTK::Matrix_<SimTK::Vec3> force_matrix(force_nrow,
+                                                 (int)labels.size());
 
         double time_step{1.0 / analogFrequency};
 
-        for(int f = 0; f < nf;  ++f) {
+        for(int f = 0, out = 0; f < nf;  f += decimation, ++out) {
             SimTK::RowVector_<SimTK::Vec3>
                     row{numPlatform * 3};
             int col{0};
@@ -271,8 +303,8 @@ C3DFileAdapter::extendRead(const std::string& fileName) const {
                                   "implemented for ezc3d files");
                 }
             }
-            force_matrix.updRow(f) = row;
-            force_times[f] = 0 + f * time_step; //TODO: 0 should be start_time
+            force_matrix.updRow(out) = row;
+            force_times[out] = 0 + f * time_step; //TODO: 0 should be start_time
         }
 
         auto&  force_table =
@@ -304,7 +336,7 @@ C3DFileAdapter::extendRead(const std::string& fileName) const {
         force_table.
                 updTableMetaData().
                 setValueForKey("DataRate",
-                               std::to_string(analogFrequency));
+                               std::to_string(analogFrequency / decimation));
 
         tables.emplace(_forces,
                        std::shared_ptr<TimeSeriesTableVec3>(&force_table));
@@ -319,6 +351,11 @@ C3DFileAdapter::extendRead(const std::string& fileName) const {
                 emptyTimes, noData, emptyLabels);
         tables.emplace(_forces, emptyforcesTable);
     }
+
+    // Collect the marker table from the worker thread; any exception thrown
+    // while converting the markers is rethrown here.
+    tables.emplace(_markers, markerFuture.get());
+
     return tables;
 #endif
 }
@@ -117,6 +117,32 @@ public:
         return _location;
     }
 
+    /** Keep only every Nth frame of the marker and force trajectories when
+        reading, where N is the given factor. The default factor of 1 keeps
+        every frame. Decimation is applied during conversion, so skipped
+        frames are never materialized. Time stamps of the kept frames are
+        preserved and the "DataRate" metadata of the output tables reflects
+        the decimated rate. */
+    void setReadDecimationFactor(int factor) {
+        _decimationFactor = factor;
+    }
+    /** Retrieve the decimation factor applied when reading (default 1). */
+    int getReadDecimationFactor() const {
+        return _decimationFactor;
+    }
+
+    /** Restrict reading to the named markers; columns appear in file order.
+        An empty list (the default) reads all markers. Reading throws if a
+        requested marker is not present in the file. Force-plate data are
+        unaffected. */
+    void setMarkersToRead(const std::vector<std::string>& markerNames) {
+        _markersToRead = markerNames;
+    }
+    /** Retrieve the marker-name filter applied when reading.                 */
+    const std::vector<std::string>& getMarkersToRead() const {
+        return _markersToRead;
+    }
+
 #ifndef SWIG
     static
     void write(const Tables& markerTable, const std::string& fileName);
@@ -149,6 +175,10 @@ private:
 
     ForceLocation _location{ ForceLocation::OriginOfForcePlate };
 
+    int _decimationFactor{1};
+
+    std::vector<std::string> _markersToRead{};
+
 };
 
 } // namespace OpenSim
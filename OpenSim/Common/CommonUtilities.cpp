@@ -26,8 +26,10 @@
 #include "PiecewiseLinearFunction.h"
 #include "STOFileAdapter.h"
 #include "TimeSeriesTable.h"
+#include <atomic>
 #include <chrono>
 #include <ctime>
+#include <map>
 #include <iomanip>
 #include <memory>
 #include <sstream>
@@ -183,3 +185,88 @@ SimTK::Real OpenSim::solveBisection(
     }
     return midpoint;
 }
+
+namespace {
+
+struct TimingBucket {
+    double seconds = 0;
+    unsigned long long calls = 0;
+};
+
+std::atomic<bool> scopedTimersEnabled(false);
+
+std::mutex& getTimingBucketMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::string, TimingBucket>& getTimingBuckets() {
+    static std::map<std::string, TimingBucket> buckets;
+    return buckets;
+}
+
+long long scopedTimerNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+OpenSim::ScopedTimer::ScopedTimer(const char* bucket)
+        : m_bucket(nullptr), m_startTimeNs(0) {
+    if (!scopedTimersEnabled.load(std::memory_order_relaxed)) return;
+    m_bucket = bucket;
+    m_startTimeNs = scopedTimerNowNs();
+}
+
+OpenSim::ScopedTimer::~ScopedTimer() {
+    if (!m_bucket) return;
+    const double seconds = 1e-9*(scopedTimerNowNs() - m_startTimeNs);
+    std::lock_guard<std::mutex> lock(getTimingBucketMutex());
+    TimingBucket& bucket = getTimingBuckets()[m_bucket];
+    bucket.seconds += seconds;
+    ++bucket.calls;
+}
+
+void OpenSim::ScopedTimer::setEnabled(bool enabled) {
+    scopedTimersEnabled = enabled;
+}
+
+bool OpenSim::ScopedTimer::isEnabled() {
+    return scopedTimersEnabled.load(std::memory_order_relaxed);
+}
+
+double OpenSim::ScopedTimer::getBucketSeconds(const std::string& bucket) {
+    std::lock_guard<std::mutex> lock(getTimingBucketMutex());
+    const auto& buckets = getTimingBuckets();
+    const auto found = buckets.find(bucket);
+    return (found == buckets.end()) ? 0 : found->second.seconds;
+}
+
+unsigned long long OpenSim::ScopedTimer::getBucketCount(
+        const std::string& bucket) {
+    std::lock_guard<std::mutex> lock(getTimingBucketMutex());
+    const auto& buckets = getTimingBuckets();
+    const auto found = buckets.find(bucket);
+    return (found == buckets.end()) ? 0 : found->second.calls;
+}
+
+std::vector<std::string> OpenSim::ScopedTimer::getBucketNames() {
+    std::lock_guard<std::mutex> lock(getTimingBucketMutex());
+    std::vector<std::string> names;
+    for (const auto& entry : getTimingBuckets()) names.push_back(entry.first);
+    return names;
+}
+
+void OpenSim::ScopedTimer::resetBuckets() {
+    std::lock_guard<std::mutex> lock(getTimingBucketMutex());
+    getTimingBuckets().clear();
+}
+
+void OpenSim::ScopedTimer::logBuckets() {
+    std::lock_guard<std::mutex> lock(getTimingBucketMutex());
+    for (const auto& entry : getTimingBuckets()) {
+        log_info("timing_bucket name={} seconds={:.6g} calls={}",
+                entry.first, entry.second.seconds, entry.second.calls);
+    }
+}
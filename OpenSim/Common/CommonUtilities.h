@@ -29,6 +29,8 @@
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <string>
+#include <vector>
 #include <condition_variable>
 
 #include <SimTKcommon/internal/BigMatrix.h>
@@ -124,6 +126,57 @@ SimTK::Real solveBisection(std::function<double(const double&)> calcResidual,
         double left, double right, const double& tolerance = 1e-6,
         int maxIterations = 1000);
 
+/// Measure the wall-clock time spent in a scope and aggregate it into a
+/// process-wide named bucket, so scattered hot paths (solver inner loops,
+/// tool runs, Manager::integrate()) all report timing through one mechanism
+/// instead of each site keeping its own Stopwatch:
+/// @code
+/// ScopedTimer::setEnabled(true);
+/// {
+///     ScopedTimer timer("InverseKinematicsTool::solveFrame");
+///     // ... work ...
+/// }
+/// ScopedTimer::logBuckets();
+/// @endcode
+/// Each bucket accumulates the total seconds and the number of timers that
+/// reported into it. Buckets are shared by all threads and aggregation is
+/// thread-safe; a timer constructed while timing is disabled (the default)
+/// costs one relaxed atomic load and records nothing on destruction.
+/// logBuckets() writes one structured `timing_bucket` record per bucket
+/// through the Logger, so downstream tooling parses all timing the same way.
+/// @ingroup commonutil
+class OSIMCOMMON_API ScopedTimer {
+public:
+    /// Start timing; the elapsed time is added to `bucket` when this timer
+    /// is destructed. The bucket name must outlive the timer; string
+    /// literals are the intended use.
+    explicit ScopedTimer(const char* bucket);
+    ~ScopedTimer();
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    /// Turn aggregation on or off; off by default. Timers already running
+    /// when the setting changes honor the setting they were constructed
+    /// under.
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+    /// Total seconds accumulated in a bucket; zero for an unknown bucket.
+    static double getBucketSeconds(const std::string& bucket);
+    /// Number of timers that have reported into a bucket.
+    static unsigned long long getBucketCount(const std::string& bucket);
+    /// Names of all buckets that have accumulated time, sorted.
+    static std::vector<std::string> getBucketNames();
+    /// Discard all buckets.
+    static void resetBuckets();
+    /// Write one `timing_bucket name=<bucket> seconds=<total> calls=<count>`
+    /// record per bucket through the Logger, at info level.
+    static void logBuckets();
+
+private:
+    const char* m_bucket;  // null when constructed with timing disabled
+    long long m_startTimeNs;
+};
+
 /// This class lets you store objects of a single type for reuse by multiple
 /// threads, ensuring threadsafe access to each of those objects.
 /// @ingroup commonutil
@@ -25,15 +25,284 @@
 // INCLUDES
 #include "Component.h"
 #include "OpenSim/Common/IO.h"
+#include "TimeSeriesTable.h"
 #include "XMLDocument.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <cstdio>
 #include <unordered_map>
 #include <set>
 #include <regex>
+#include <vector>
 
 using namespace SimTK;
 
 namespace OpenSim {
 
+//==============================================================================
+//                        REALIZE-COST PROFILER
+//==============================================================================
+// Backing store for the opt-in profiler exposed through
+// Component::startRealizeProfiling() and friends. The enabled flag is an
+// atomic so the disabled-case check in the hot realize path is essentially
+// free; actual accumulation happens under a mutex, which is acceptable
+// overhead for a diagnostic that is off by default.
+namespace {
+
+// The three realize stages the profiler instruments, in row order of the
+// reported table.
+enum ProfiledRealizeStage {
+    ProfiledPosition = 0,
+    ProfiledVelocity,
+    ProfiledDynamics,
+    NumProfiledStages
+};
+
+struct RealizeProfileEntry {
+    std::string componentPath; // resolved once, on first record
+    double seconds[NumProfiledStages];
+    long long calls[NumProfiledStages];
+    RealizeProfileEntry() {
+        for (int i = 0; i < NumProfiledStages; ++i) {
+            seconds[i] = 0;
+            calls[i] = 0;
+        }
+    }
+};
+
+std::atomic<bool> realizeProfilingEnabled(false);
+
+std::atomic<bool> realizeTracingEnabled(false);
+
+// One recorded event of the realize tracer. Timed scopes are "complete"
+// ('X') events in the Chrome trace-event format -- viewers infer nesting
+// from time containment on the same thread -- and counter samples are 'C'
+// events, for which durUs is unused and value holds the sample.
+struct RealizeTraceEvent {
+    std::string name;
+    double beginUs;
+    double durUs;
+    unsigned long long tid;
+    char phase;
+    double value;
+};
+
+std::mutex& getRealizeTraceMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<RealizeTraceEvent>& getRealizeTraceEvents() {
+    static std::vector<RealizeTraceEvent> events;
+    return events;
+}
+
+std::chrono::steady_clock::time_point& getRealizeTraceStart() {
+    static std::chrono::steady_clock::time_point start;
+    return start;
+}
+
+double realizeTraceNowUs() {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - getRealizeTraceStart()).count();
+}
+
+unsigned long long realizeTraceThreadId() {
+    return static_cast<unsigned long long>(
+        std::hash<std::thread::id>()(std::this_thread::get_id()));
+}
+
+std::atomic<bool> parallelFinalizeFromPropertiesEnabled(false);
+
+// Process-wide budget of extra worker threads available to parallel property
+// finalization. Spawning claims from the budget and returns to it on join;
+// once the budget is spent, nested finalizations simply run inline, so deep
+// component trees cannot oversubscribe the machine.
+std::atomic<int>& availableFinalizeWorkers() {
+    static std::atomic<int> count(std::max(0,
+            static_cast<int>(std::thread::hardware_concurrency()) - 1));
+    return count;
+}
+
+std::mutex& getRealizeProfileMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<const OpenSim::Component*, RealizeProfileEntry>&
+getRealizeProfileData() {
+    static std::map<const OpenSim::Component*, RealizeProfileEntry> data;
+    return data;
+}
+
+// RAII timer wrapped around each profiled extendRealize*() dispatch in
+// ComponentMeasure below; a no-op unless profiling is enabled.
+class RealizeProfileScope {
+public:
+    RealizeProfileScope(const OpenSim::Component& component,
+                        ProfiledRealizeStage stage)
+            : _component(nullptr), _stage(stage) {
+        if (!realizeProfilingEnabled.load(std::memory_order_relaxed))
+            return;
+        _component = &component;
+        _start = std::chrono::steady_clock::now();
+    }
+    ~RealizeProfileScope() {
+        if (!_component) return;
+        const double seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - _start).count();
+        std::lock_guard<std::mutex> lock(getRealizeProfileMutex());
+        RealizeProfileEntry& entry = getRealizeProfileData()[_component];
+        if (entry.componentPath.empty())
+            entry.componentPath = _component->getAbsolutePathString();
+        entry.seconds[_stage] += seconds;
+        ++entry.calls[_stage];
+    }
+private:
+    const OpenSim::Component* _component;
+    ProfiledRealizeStage _stage;
+    std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace
+
+void Component::startRealizeProfiling() {
+    std::lock_guard<std::mutex> lock(getRealizeProfileMutex());
+    getRealizeProfileData().clear();
+    realizeProfilingEnabled = true;
+}
+
+void Component::stopRealizeProfiling() {
+    realizeProfilingEnabled = false;
+}
+
+bool Component::isRealizeProfilingEnabled() {
+    return realizeProfilingEnabled;
+}
+
+TimeSeriesTable_<double> Component::getRealizeProfile() {
+    std::lock_guard<std::mutex> lock(getRealizeProfileMutex());
+    const auto& data = getRealizeProfileData();
+
+    // Order columns by component path so the report is stable across runs.
+    std::map<std::string, const RealizeProfileEntry*> byPath;
+    for (const auto& entry : data)
+        byPath[entry.second.componentPath] = &entry.second;
+
+    std::vector<std::string> labels;
+    labels.reserve(2*byPath.size());
+    for (const auto& entry : byPath) {
+        labels.push_back(entry.first + "|seconds");
+        labels.push_back(entry.first + "|calls");
+    }
+
+    TimeSeriesTable_<double> table;
+    if (labels.empty())
+        return table;
+    table.setColumnLabels(labels);
+
+    // One row per profiled stage; the independent column holds the
+    // SimTK::Stage number so rows are identifiable (and increasing).
+    const SimTK::Stage stages[NumProfiledStages] = {
+        SimTK::Stage::Position, SimTK::Stage::Velocity,
+        SimTK::Stage::Dynamics };
+    for (int i = 0; i < NumProfiledStages; ++i) {
+        SimTK::RowVector row(int(labels.size()));
+        int col = 0;
+        for (const auto& entry : byPath) {
+            row[col++] = entry.second->seconds[i];
+            row[col++] = double(entry.second->calls[i]);
+        }
+        table.appendRow(double(int(stages[i])), row);
+    }
+    return table;
+}
+
+//==============================================================================
+//                        REALIZE-STAGE TRACER
+//==============================================================================
+void Component::startRealizeTracing() {
+    std::lock_guard<std::mutex> lock(getRealizeTraceMutex());
+    getRealizeTraceEvents().clear();
+    getRealizeTraceStart() = std::chrono::steady_clock::now();
+    realizeTracingEnabled = true;
+}
+
+void Component::stopRealizeTracing() {
+    realizeTracingEnabled = false;
+}
+
+bool Component::isRealizeTracingEnabled() {
+    return realizeTracingEnabled;
+}
+
+std::size_t Component::writeRealizeTrace(const std::string& fileName) {
+    std::lock_guard<std::mutex> lock(getRealizeTraceMutex());
+    std::vector<RealizeTraceEvent>& events = getRealizeTraceEvents();
+
+    FILE* file = std::fopen(fileName.c_str(), "w");
+    OPENSIM_THROW_IF(file == nullptr, Exception,
+        "Component::writeRealizeTrace(): could not open '" + fileName +
+        "' for writing.");
+
+    std::fprintf(file, "{\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); ++i) {
+        const RealizeTraceEvent& event = events[i];
+        if (event.phase == 'C') {
+            std::fprintf(file,
+                "{\"name\":\"%s\",\"cat\":\"realize\",\"ph\":\"C\","
+                "\"ts\":%.3f,\"pid\":1,\"tid\":%llu,"
+                "\"args\":{\"value\":%g}}%s\n",
+                event.name.c_str(), event.beginUs, event.tid, event.value,
+                i + 1 < events.size() ? "," : "");
+            continue;
+        }
+        std::fprintf(file,
+            "{\"name\":\"%s\",\"cat\":\"realize\",\"ph\":\"X\","
+            "\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%llu}%s\n",
+            event.name.c_str(), event.beginUs, event.durUs, event.tid,
+            i + 1 < events.size() ? "," : "");
+    }
+    std::fprintf(file, "]}\n");
+    std::fclose(file);
+
+    const size_t numEvents = events.size();
+    events.clear();
+    return numEvents;
+}
+
+void Component::appendRealizeTraceCounter(const std::string& name,
+        double value) {
+    if (!realizeTracingEnabled.load(std::memory_order_relaxed))
+        return;
+    const double nowUs = realizeTraceNowUs();
+    std::lock_guard<std::mutex> lock(getRealizeTraceMutex());
+    getRealizeTraceEvents().push_back(
+        {name, nowUs, 0, realizeTraceThreadId(), 'C', value});
+}
+
+Component::RealizeTraceScope::RealizeTraceScope(const Component& component,
+        const char* label) {
+    if (!realizeTracingEnabled.load(std::memory_order_relaxed))
+        return;
+    _name = component.getAbsolutePathString() + "|" + label;
+    _beginUs = realizeTraceNowUs();
+}
+
+Component::RealizeTraceScope::~RealizeTraceScope() {
+    if (_beginUs < 0)
+        return;
+    const double durUs = realizeTraceNowUs() - _beginUs;
+    std::lock_guard<std::mutex> lock(getRealizeTraceMutex());
+    getRealizeTraceEvents().push_back(
+        {std::move(_name), _beginUs, durUs, realizeTraceThreadId(), 'X', 0});
+}
+
 //==============================================================================
 //                            COMPONENT MEASURE
 //==============================================================================
@@ -89,16 +358,23 @@ public:
     {   _Component.extendRealizeTime(s); }
     void realizeMeasurePositionVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizePosition(s); }
+    {   RealizeProfileScope profile(_Component, ProfiledPosition);
+        Component::RealizeTraceScope trace(_Component, "realizePosition");
+        _Component.extendRealizePosition(s); }
     void realizeMeasureVelocityVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeVelocity(s); }
+    {   RealizeProfileScope profile(_Component, ProfiledVelocity);
+        Component::RealizeTraceScope trace(_Component, "realizeVelocity");
+        _Component.extendRealizeVelocity(s); }
     void realizeMeasureDynamicsVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeDynamics(s); }
+    {   RealizeProfileScope profile(_Component, ProfiledDynamics);
+        Component::RealizeTraceScope trace(_Component, "realizeDynamics");
+        _Component.extendRealizeDynamics(s); }
     void realizeMeasureAccelerationVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeAcceleration(s); }
+    {   Component::RealizeTraceScope trace(_Component, "realizeAcceleration");
+        _Component.extendRealizeAcceleration(s); }
     void realizeMeasureReportVirtual(const SimTK::State& s)
         const override final
     {   _Component.extendRealizeReport(s); }
@@ -177,6 +453,13 @@ void Component::prependComponentPathToConnecteePath(
 
 void Component::finalizeFromProperties()
 {
+    // This method ends by restoring the up-to-date flag, so a property edit's
+    // staleness leaves no trace by the time finalizeConnections() runs its
+    // skip check; a stale component forfeits its connection marker here so
+    // the next sweep is guaranteed to revisit it.
+    if (!isObjectUpToDateWithProperties())
+        _connectionsFinalizedRoot = nullptr;
+
     reset();
 
     // last opportunity to modify Object names based on properties
@@ -274,22 +557,180 @@ void Component::finalizeFromProperties()
     setObjectIsUpToDateWithProperties();
 }
 
-// Base class implementation of virtual method.
-// Call finalizeFromProperties on all subcomponents
-void Component::componentsFinalizeFromProperties() const
+void Component::finalizeFromPropertiesIfNeeded()
 {
+    // A stale component gets the full (recursive) treatment: its own
+    // finalization rebuilds its subcomponent lists, so there is no cheaper
+    // option for the subtree it roots.
+    if (!isObjectUpToDateWithProperties()) {
+        finalizeFromProperties();
+        return;
+    }
+
+    // This component is untouched; descend looking for stale subtrees.
     for (auto& comp : _memberSubcomponents) {
         const_cast<Component*>(comp.get())
-            ->finalizeFromProperties();
+            ->finalizeFromPropertiesIfNeeded();
     }
     for (auto& comp : _propertySubcomponents) {
         const_cast<Component*>(comp.get())
-            ->finalizeFromProperties();
+            ->finalizeFromPropertiesIfNeeded();
     }
     for (auto& comp : _adoptedSubcomponents) {
+        const_cast<Component*>(comp.get())
+            ->finalizeFromPropertiesIfNeeded();
+    }
+}
+
+bool Component::isComponentTreeUpToDateWithProperties() const
+{
+    if (!isObjectUpToDateWithProperties())
+        return false;
+
+    for (auto& comp : _memberSubcomponents) {
+        if (!comp->isComponentTreeUpToDateWithProperties())
+            return false;
+    }
+    for (auto& comp : _propertySubcomponents) {
+        if (!comp->isComponentTreeUpToDateWithProperties())
+            return false;
+    }
+    for (auto& comp : _adoptedSubcomponents) {
+        if (!comp->isComponentTreeUpToDateWithProperties())
+            return false;
+    }
+    return true;
+}
+
+// Base class implementation of virtual method.
+// Call finalizeFromProperties on all subcomponents
+void Component::componentsFinalizeFromProperties() const
+{
+    for (auto& comp : _memberSubcomponents) {
         const_cast<Component*>(comp.get())
             ->finalizeFromProperties();
     }
+
+    // The property and adopted subtrees are independent during this phase:
+    // sockets only have their connectee-path properties checked here and are
+    // not resolved across subtrees until finalizeConnections(). When the
+    // opt-in parallel mode is enabled, farm the subtrees out to worker
+    // threads drawn from the process-wide budget.
+    std::vector<Component*> subtrees;
+    subtrees.reserve(
+            _propertySubcomponents.size() + _adoptedSubcomponents.size());
+    for (auto& comp : _propertySubcomponents)
+        subtrees.push_back(const_cast<Component*>(comp.get()));
+    for (auto& comp : _adoptedSubcomponents)
+        subtrees.push_back(const_cast<Component*>(comp.get()));
+
+    int claimed = 0;
+    if (parallelFinalizeFromPropertiesEnabled && subtrees.size() > 1) {
+        const int want = static_cast<int>(subtrees.size()) - 1;
+        int available = availableFinalizeWorkers().load();
+        while (claimed < want && available > 0) {
+            if (availableFinalizeWorkers().compare_exchange_weak(
+                        available, available - 1)) {
+                ++claimed;
+                --available;
+            }
+        }
+    }
+
+    if (claimed == 0) {
+        for (auto* comp : subtrees) comp->finalizeFromProperties();
+        return;
+    }
+
+    std::atomic<std::size_t> nextSubtree(0);
+    std::mutex exceptionMutex;
+    std::exception_ptr firstException = nullptr;
+    auto work = [&]() {
+        while (true) {
+            const std::size_t i = nextSubtree++;
+            if (i >= subtrees.size()) break;
+            try {
+                subtrees[i]->finalizeFromProperties();
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!firstException)
+                    firstException = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < claimed; ++i) workers.emplace_back(work);
+    work(); // this thread participates too
+    for (auto& worker : workers) worker.join();
+    availableFinalizeWorkers() += claimed;
+
+    if (firstException) std::rethrow_exception(firstException);
+}
+
+namespace {
+// Bytes of an object's property storage, recursing into object-valued
+// properties but stopping at contained Components: those are reported as
+// components in their own right by the footprint report.
+std::size_t calcPropertyTreeBytes(const OpenSim::Object& object) {
+    std::size_t bytes = 0;
+    for (int i = 0; i < object.getNumProperties(); ++i) {
+        const OpenSim::AbstractProperty& prop =
+                object.getPropertyByIndex(i);
+        bytes += prop.getMemorySizeEstimate();
+        if (!prop.isObjectProperty()) continue;
+        for (int j = 0; j < prop.size(); ++j) {
+            const OpenSim::Object& value = prop.getValueAsObject(j);
+            if (dynamic_cast<const OpenSim::Component*>(&value)) continue;
+            bytes += calcPropertyTreeBytes(value);
+        }
+    }
+    return bytes;
+}
+} // namespace
+
+std::size_t Component::getMemoryFootprint() const {
+    return calcPropertyTreeBytes(*this) + extendGetMemoryFootprint();
+}
+
+TimeSeriesTable_<double> Component::getMemoryFootprintReport() const {
+    // Depth-first walk collecting, per component, the bytes attributable to
+    // it alone and the total for the subtree it roots.
+    std::vector<std::string> labels;
+    std::vector<double> values;
+    std::function<std::size_t(const Component&)> visit =
+            [&](const Component& comp) -> std::size_t {
+        const std::size_t self = comp.getMemoryFootprint();
+        // Reserve this component's slots before visiting children so the
+        // report lists owners ahead of their subcomponents.
+        const std::size_t slot = values.size();
+        labels.push_back(comp.getAbsolutePathString() + "|self");
+        labels.push_back(comp.getAbsolutePathString() + "|subtree");
+        values.push_back(double(self));
+        values.push_back(0);
+        std::size_t subtree = self;
+        for (const auto& sub : comp.getImmediateSubcomponents())
+            subtree += visit(sub.getRef());
+        values[slot + 1] = double(subtree);
+        return subtree;
+    };
+    visit(*this);
+
+    TimeSeriesTable_<double> table;
+    table.setColumnLabels(labels);
+    SimTK::RowVector row(int(values.size()));
+    for (int i = 0; i < int(values.size()); ++i) row[i] = values[i];
+    table.appendRow(0.0, row);
+    return table;
+}
+
+void Component::setParallelFinalizeFromPropertiesEnabled(bool enabled) {
+    parallelFinalizeFromPropertiesEnabled = enabled;
+}
+
+bool Component::getParallelFinalizeFromPropertiesEnabled() {
+    return parallelFinalizeFromPropertiesEnabled;
 }
 
 // Base class implementation of non-virtual finalizeConnections method.
@@ -299,7 +740,30 @@ void Component::finalizeConnections(Component& root)
         // if edits occur between construction and connect() this is
         // the last chance to finalize before addToSystem.
         finalizeFromProperties();
-    }
+    } else if (this == &root) {
+        // A stale subtree's property finalization rebuilds its subcomponent
+        // lists (e.g. dropping removed components); it must run before the
+        // tree walk below touches those lists.
+        finalizeFromPropertiesIfNeeded();
+    }
+
+    // Removing, renaming, or replacing a component invalidates connectees
+    // resolved by *other*, unedited components, and the edited component's
+    // own staleness evidence may already have been erased by an intervening
+    // finalizeFromProperties() (Model::setup() finalizes properties before
+    // connecting). Compare the tree against the snapshot taken when this
+    // root last connected; on mismatch every component must be revisited.
+    if (this == &root && !matchesConnectionsTreeSignature())
+        clearConnectionMarkers();
+
+    // Nothing in this subtree has been edited since it was last connected
+    // against this same root, so its resolved sockets and inputs are still
+    // valid; skip the revalidation sweep. Property edits and direct socket
+    // or input edits both mark the edited component, and the sweep follows
+    // the marks back down to it.
+    if (hasFinalizedConnections(root))
+        return;
+    _connectionsFinalizedRoot = nullptr;
 
     for (auto& it : _socketsTable) {
         auto& socket = it.second;
@@ -337,6 +801,76 @@ void Component::finalizeConnections(Component& root)
     // Forming connections changes the Socket which is a property
     // Remark as upToDate.
     setObjectIsUpToDateWithProperties();
+    _connectionsFinalizedRoot = &root;
+
+    if (this == &root) {
+        // The tree is now stable: (re)build the flattened traversal index so
+        // loops over getFlattenedComponentList() need no lazy rebuild, and
+        // snapshot the tree's identity for the structural check above.
+        if ((_memberSubcomponents.size() + _propertySubcomponents.size()
+                + _adoptedSubcomponents.size()) > 0) {
+            buildFlattenedComponentList();
+        }
+        recordConnectionsTreeSignature();
+    }
+}
+
+bool Component::hasFinalizedConnections(const Component& root) const
+{
+    if (_connectionsFinalizedRoot != &root || !isObjectUpToDateWithProperties())
+        return false;
+
+    for (auto& comp : _memberSubcomponents) {
+        if (!comp->hasFinalizedConnections(root))
+            return false;
+    }
+    for (auto& comp : _propertySubcomponents) {
+        if (!comp->hasFinalizedConnections(root))
+            return false;
+    }
+    for (auto& comp : _adoptedSubcomponents) {
+        if (!comp->hasFinalizedConnections(root))
+            return false;
+    }
+    return true;
+}
+
+bool Component::matchesConnectionsTreeSignature() const
+{
+    // Walk the tree in the same pre-order used to record the snapshot,
+    // comparing both identity (address) and name, so removals, additions,
+    // replacements, and renames all register as mismatches.
+    std::size_t i = 0;
+    const std::size_t n = _connectionsTreeSignature.size();
+    for (const Component& comp : getComponentList<Component>()) {
+        if (i >= n || _connectionsTreeSignature[i].first != &comp ||
+                _connectionsTreeSignature[i].second != comp.getName())
+            return false;
+        ++i;
+    }
+    return i == n;
+}
+
+void Component::recordConnectionsTreeSignature()
+{
+    _connectionsTreeSignature.clear();
+    for (const Component& comp : getComponentList<Component>()) {
+        _connectionsTreeSignature.emplace_back(&comp, comp.getName());
+    }
+}
+
+void Component::clearConnectionMarkers()
+{
+    _connectionsFinalizedRoot = nullptr;
+    for (unsigned int i = 0; i < _memberSubcomponents.size(); ++i) {
+        _memberSubcomponents[i].upd()->clearConnectionMarkers();
+    }
+    for (unsigned int i = 0; i < _propertySubcomponents.size(); ++i) {
+        _propertySubcomponents[i].get()->clearConnectionMarkers();
+    }
+    for (unsigned int i = 0; i < _adoptedSubcomponents.size(); ++i) {
+        _adoptedSubcomponents[i].upd()->clearConnectionMarkers();
+    }
 }
 
 // invoke connect on all (sub)components of this component
@@ -377,6 +911,9 @@ void Component::clearConnections()
         it.second->disconnect();
     }
 
+    // The next finalizeConnections() must revisit this component.
+    _connectionsFinalizedRoot = nullptr;
+
     //now clear all the stored system indices from this component
     reset();
 }
@@ -845,6 +1382,97 @@ double Component::
     return SimTK::NaN;
 }
 
+Component::StateVariableHandle Component::
+    getStateVariableHandle(const std::string& name) const
+{
+    // Must have already called initSystem.
+    OPENSIM_THROW_IF_FRMOBJ(!hasSystem(), ComponentHasNoSystem);
+
+    const StateVariable* rsv = traverseToStateVariable(name);
+    if (rsv) {
+        return StateVariableHandle(rsv);
+    }
+
+    std::stringstream msg;
+    msg << "Component::getStateVariableHandle: ERR- state named '" << name
+        << "' not found in " << getName() << " of type "
+        << getConcreteClassName();
+    throw Exception(msg.str(),__FILE__,__LINE__);
+}
+
+// Get the value of a state variable through a precomputed handle.
+double Component::
+    getStateVariableValue(const SimTK::State& s,
+                          const StateVariableHandle& handle) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!handle.isValid(), Exception,
+        "Invalid StateVariableHandle: resolve it with "
+        "getStateVariableHandle() after initSystem.");
+
+    return handle._stateVariable->getValue(s);
+}
+
+// Set the value of a state variable through a precomputed handle.
+void Component::
+    setStateVariableValue(SimTK::State& s,
+                          const StateVariableHandle& handle,
+                          double value) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!handle.isValid(), Exception,
+        "Invalid StateVariableHandle: resolve it with "
+        "getStateVariableHandle() after initSystem.");
+
+    handle._stateVariable->setValue(s, value);
+}
+
+// Get the values of a batch of state variables through precomputed handles.
+SimTK::Vector Component::
+    getStateVariableValues(const SimTK::State& s,
+                           const std::vector<StateVariableHandle>& handles) const
+{
+    Vector values;
+    getStateVariableValues(s, handles, values);
+    return values;
+}
+
+// In-place variant of the above: fills a caller-supplied Vector so tight
+// loops do not allocate.
+void Component::
+    getStateVariableValues(const SimTK::State& s,
+                           const std::vector<StateVariableHandle>& handles,
+                           SimTK::Vector& values) const
+{
+    const int nsv = (int)handles.size();
+    if (values.size() != nsv)
+        values.resize(nsv);
+    for (int i = 0; i < nsv; ++i) {
+        OPENSIM_THROW_IF_FRMOBJ(!handles[i].isValid(), Exception,
+            "Invalid StateVariableHandle: resolve it with "
+            "getStateVariableHandle() after initSystem.");
+        values[i] = handles[i]._stateVariable->getValue(s);
+    }
+}
+
+// Set the values of a batch of state variables through precomputed handles.
+void Component::
+    setStateVariableValues(SimTK::State& s,
+                           const std::vector<StateVariableHandle>& handles,
+                           const SimTK::Vector& values) const
+{
+    const int nsv = (int)handles.size();
+
+    SimTK_ASSERT(values.size() == nsv,
+        "Component::setStateVariableValues() number of values does not match "
+        "the number of handles.");
+
+    for (int i = 0; i < nsv; ++i) {
+        OPENSIM_THROW_IF_FRMOBJ(!handles[i].isValid(), Exception,
+            "Invalid StateVariableHandle: resolve it with "
+            "getStateVariableHandle() after initSystem.");
+        handles[i]._stateVariable->setValue(s, values[i]);
+    }
+}
+
 // Get the value of a state variable derivative computed by this Component.
 double Component::
     getStateVariableDerivativeValue(const SimTK::State& state,
@@ -932,6 +1560,17 @@ bool Component::isAllStatesVariablesListValid() const
 // state variables allocated by its subcomponents.
 SimTK::Vector Component::
     getStateVariableValues(const SimTK::State& state) const
+{
+    Vector stateVariableValues;
+    getStateVariableValues(state, stateVariableValues);
+    return stateVariableValues;
+}
+
+// In-place variant of the above: fills a caller-supplied Vector so repeated
+// calls (e.g. states logging every reporting interval) do not allocate.
+void Component::
+    getStateVariableValues(const SimTK::State& state,
+                           SimTK::Vector& values) const
 {
     // Must have already called initSystem.
     OPENSIM_THROW_IF_FRMOBJ(!hasSystem(), ComponentHasNoSystem);
@@ -947,12 +1586,11 @@ SimTK::Vector Component::
             _allStateVariables[i].reset(traverseToStateVariable(names[i]));
     }
 
-    Vector stateVariableValues(nsv, SimTK::NaN);
+    if (values.size() != nsv)
+        values.resize(nsv);
     for(int i=0; i<nsv; ++i){
-        stateVariableValues[i]= _allStateVariables[i]->getValue(state);
+        values[i] = _allStateVariables[i]->getValue(state);
     }
-
-    return stateVariableValues;
 }
 
 // Set all values of the state variables allocated by this Component. Includes
@@ -1317,6 +1955,24 @@ std::vector<SimTK::ReferencePtr<const Component>>
     return mySubcomponents;
 }
 
+const Component* Component::getImmediateSubcomponentByIndex(size_t index) const
+{
+    const size_t nmsc = _memberSubcomponents.size();
+    if (index < nmsc)
+        return _memberSubcomponents[(unsigned)index].get();
+    index -= nmsc;
+
+    const size_t npsc = _propertySubcomponents.size();
+    if (index < npsc)
+        return _propertySubcomponents[(unsigned)index].get();
+    index -= npsc;
+
+    if (index < _adoptedSubcomponents.size())
+        return _adoptedSubcomponents[(unsigned)index].get();
+
+    return nullptr;
+}
+
 
 size_t Component::getNumMemberSubcomponents() const
 {
@@ -1837,6 +2493,22 @@ void Component::reset()
     _propertySubcomponents.clear();
     _adoptedSubcomponents.clear();
     resetSubcomponentOrder();
+
+    // the ownership tree is changing: drop the flattened traversal index
+    _flatComponentTraversal.clear();
+    _flatTypeSublists.clear();
+}
+
+void Component::buildFlattenedComponentList() const
+{
+    _flatComponentTraversal.clear();
+    _flatTypeSublists.clear();
+
+    // getComponentList() performs the pre-order tree walk (including this
+    // component itself); record each visited component contiguously.
+    for (const Component& comp : getComponentList<Component>()) {
+        _flatComponentTraversal.push_back(&comp);
+    }
 }
 
 void Component::warnBeforePrint() const {
@@ -50,7 +50,10 @@
 #include "OpenSim/Common/ComponentSocket.h"
 #include "OpenSim/Common/Object.h"
 #include "simbody/internal/MultibodySystem.h"
+#include <memory>
+#include <typeindex>
 #include <unordered_map>
+#include <vector>
 
 #include <OpenSim/Common/osimCommonDLL.h>
 
@@ -58,6 +61,7 @@ namespace OpenSim {
 
 class Model;
 class ModelDisplayHints;
+template <typename ETY> class TimeSeriesTable_;
 
 //==============================================================================
 /// Component Exceptions
@@ -455,10 +459,41 @@ public:
         that System.*/
     void finalizeFromProperties();
 
+    /** Incremental variant of finalizeFromProperties() for parameter-sweep
+        loops that edit a few property values between evaluations. Only the
+        components whose properties have changed since they were last
+        finalized (and their subtrees) are re-finalized; components that are
+        still up to date with their properties are left untouched, so editing
+        a single muscle in a large model re-finalizes just that muscle.
+
+        A property edit marks only the component that owns the property as
+        out of date, so this method is appropriate when each edited value is
+        consumed by the component it belongs to (the overwhelmingly common
+        case, e.g. a muscle's max_isometric_force). If an *ancestor's*
+        extendFinalizeFromProperties() derives data from the edited property,
+        call the full finalizeFromProperties() instead.
+
+        Note that, as with finalizeFromProperties(), edits that change the
+        number or type of state variables still require rebuilding the System
+        (e.g., Model::initSystem()) before realizing. */
+    void finalizeFromPropertiesIfNeeded();
+
+    /** Whether this Component and all of its subcomponents, recursively, are
+        up to date with their property values; that is, whether
+        finalizeFromPropertiesIfNeeded() would have any work to do. */
+    bool isComponentTreeUpToDateWithProperties() const;
+
     /** Satisfy the Component's connections specified by its Sockets and Inputs.
         Locate Components and their Outputs to satisfy the connections in an
         aggregate Component (e.g. Model), which is the root of a tree of
-        Components. */
+        Components.
+
+        Revalidation is incremental: a subtree that has not been edited since
+        it was last finalized against the same root is skipped, so the cost of
+        reconnecting after an edit scales with the size of the edit rather
+        than the size of the tree. Editing any property, reconnecting or
+        disconnecting any Socket or Input, or copying a component all mark
+        the affected subtree for revalidation. */
     void finalizeConnections(Component& root);
 
     /** Disconnect/clear this Component from its aggregate component. Empties
@@ -669,6 +704,53 @@ public:
         return count;
     }
 
+#ifndef SWIG
+    /**
+     * Get a flattened, cache-friendly list of this component and all its
+     * subcomponents of the specified type, in the same tree pre-order as
+     * getComponentList().
+     *
+     * Unlike getComponentList(), which walks the ownership tree pointer by
+     * pointer and applies a dynamic_cast filter at every step, this method
+     * returns a reference to a precomputed contiguous array of pointers, so
+     * per-step loops over (say) all Muscles or Forces in a large model touch
+     * contiguous memory and pay the type filtering cost only once. The flat
+     * traversal index is built when the tree's connections are finalized (see
+     * finalizeConnections()), or lazily on first use; one type-segregated
+     * sub-list is cached per requested type T. The index is invalidated
+     * whenever the component tree is edited (any edit that triggers
+     * finalizeFromProperties()), and the returned reference is invalidated
+     * with it.
+     *
+     * @code{.cpp}
+     * for (const Muscle* muscle : model.getFlattenedComponentList<Muscle>()) {
+     *     muscle->get_max_isometric_force();
+     * }
+     * @endcode
+     *
+     * @tparam T A subclass of Component (e.g., Body, Muscle).
+     */
+    template <typename T = Component>
+    const std::vector<const T*>& getFlattenedComponentList() const {
+        static_assert(std::is_base_of<Component, T>::value,
+                "Template argument must be Component or a derived class.");
+        if (_flatComponentTraversal.empty())
+            buildFlattenedComponentList();
+
+        const std::type_index key(typeid(T));
+        auto it = _flatTypeSublists.find(key);
+        if (it == _flatTypeSublists.end()) {
+            auto sublist = std::make_shared<std::vector<const T*>>();
+            for (const Component* comp : _flatComponentTraversal) {
+                if (const T* match = dynamic_cast<const T*>(comp))
+                    sublist->push_back(match);
+            }
+            it = _flatTypeSublists.emplace(key, sublist).first;
+        }
+        return *static_cast<const std::vector<const T*>*>(it->second.get());
+    }
+#endif
+
     /** Class that permits iterating over components/subcomponents (but does
      * not actually contain the components themselves). */
     template <typename T>
@@ -1324,6 +1406,122 @@ public:
      */
     void setStateVariableValue(SimTK::State& state, const std::string& name, double value) const;
 
+    // Forward declaration; the full definition appears with the other
+    // state-variable machinery in the protected section below.
+    class StateVariable;
+
+    /**
+     * A stable, precomputed handle to a state variable owned by this
+     * Component (or one of its subcomponents).
+     *
+     * Resolving a state variable by name requires splitting the path and
+     * traversing the component tree on every call, which is wasteful when the
+     * same variable is accessed every time step (e.g., by a Controller). A
+     * `StateVariableHandle` performs that resolution exactly once (via
+     * getStateVariableHandle()) so that subsequent accesses through
+     * getStateVariableValue(const SimTK::State&, const StateVariableHandle&)
+     * are a direct read of the underlying state entry.
+     *
+     * A handle remains valid only as long as the System it was resolved
+     * against; it must be re-resolved after any call that recreates the
+     * System (e.g., Model::initSystem()).
+     */
+    class StateVariableHandle {
+    public:
+        /** Construct an invalid (unresolved) handle. */
+        StateVariableHandle() = default;
+
+        /** Whether this handle refers to a resolved state variable. */
+        bool isValid() const { return _stateVariable != nullptr; }
+
+    private:
+        friend class Component;
+        explicit StateVariableHandle(const StateVariable* sv)
+                : _stateVariable(sv) {}
+
+        const StateVariable* _stateVariable = nullptr;
+    };
+
+    /**
+     * Resolve a state variable by path name into a StateVariableHandle.
+     *
+     * Call this once after Model::initSystem() and reuse the returned handle
+     * to avoid per-call string resolution. The handle is invalidated when the
+     * System is rebuilt and must then be re-resolved.
+     *
+     * @param name    the name (string) or path of the state variable
+     * @throws ComponentHasNoSystem if this Component has not been added to a
+     *         System (i.e., if initSystem has not been called)
+     * @throws Exception if no state variable with this name exists
+     */
+    StateVariableHandle getStateVariableHandle(const std::string& name) const;
+
+    /**
+     * Get the value of a state variable through a precomputed handle.
+     *
+     * This is the fast-path equivalent of
+     * getStateVariableValue(const SimTK::State&, const std::string&): no
+     * string parsing or tree traversal is performed.
+     *
+     * @param state   the State for which to get the value
+     * @param handle  a handle obtained from getStateVariableHandle()
+     * @throws Exception if the handle is invalid (default-constructed or
+     *         stale)
+     */
+    double getStateVariableValue(const SimTK::State& state,
+            const StateVariableHandle& handle) const;
+
+    /**
+     * %Set the value of a state variable through a precomputed handle.
+     *
+     * @param state   the State for which to set the value
+     * @param handle  a handle obtained from getStateVariableHandle()
+     * @param value   the value to set
+     * @throws Exception if the handle is invalid (default-constructed or
+     *         stale)
+     */
+    void setStateVariableValue(SimTK::State& state,
+            const StateVariableHandle& handle, double value) const;
+
+    /**
+     * Get the values of a batch of state variables through precomputed
+     * handles, in the order the handles are given.
+     *
+     * @param state    the State for which to get the values
+     * @param handles  handles obtained from getStateVariableHandle()
+     * @return Vector of state variable values of length handles.size()
+     * @throws Exception if any handle is invalid
+     */
+    SimTK::Vector getStateVariableValues(const SimTK::State& state,
+            const std::vector<StateVariableHandle>& handles) const;
+
+    /**
+     * Get the values of a batch of state variables through precomputed
+     * handles, writing them into a caller-supplied Vector so repeated calls
+     * do not allocate. `values` is resized to handles.size() if necessary.
+     *
+     * @param state    the State for which to get the values
+     * @param handles  handles obtained from getStateVariableHandle()
+     * @param values   Vector the values are written into
+     * @throws Exception if any handle is invalid
+     */
+    void getStateVariableValues(const SimTK::State& state,
+            const std::vector<StateVariableHandle>& handles,
+            SimTK::Vector& values) const;
+
+    /**
+     * %Set the values of a batch of state variables through precomputed
+     * handles, in the order the handles are given.
+     *
+     * @param state    the State whose values are set
+     * @param handles  handles obtained from getStateVariableHandle()
+     * @param values   Vector of state variable values of length
+     *                 handles.size()
+     * @throws Exception if any handle is invalid
+     */
+    void setStateVariableValues(SimTK::State& state,
+            const std::vector<StateVariableHandle>& handles,
+            const SimTK::Vector& values) const;
 
     /**
      * Get all values of the state variables allocated by this Component.
@@ -1337,6 +1535,21 @@ public:
      */
     SimTK::Vector getStateVariableValues(const SimTK::State& state) const;
 
+    /**
+     * Get all values of the state variables allocated by this Component,
+     * writing them into a caller-supplied Vector so repeated calls (e.g.
+     * states logging in a reporting loop) do not allocate. `values` is
+     * resized to getNumStateVariables() if necessary.
+     *
+     * @param state   the State for which to get the value
+     * @param values  Vector the values are written into, in the order
+     *                returned by getStateVariableNames()
+     * @throws ComponentHasNoSystem if this Component has not been added to a
+     *         System (i.e., if initSystem has not been called)
+     */
+    void getStateVariableValues(const SimTK::State& state,
+                                SimTK::Vector& values) const;
+
     /**
      * %Set all values of the state variables allocated by this Component.
      * Includes state variables allocated by its subcomponents. Note, this
@@ -1954,6 +2167,129 @@ public:
     void printOutputInfo(const bool includeDescendants = true) const;
     /// @}
 
+    /** @name Realize-cost profiling
+    An opt-in diagnostic that records wall-clock time and call counts, per
+    component, for the Position, Velocity, and Dynamics realization stages
+    (i.e. extendRealizePosition(), extendRealizeVelocity(), and
+    extendRealizeDynamics()). Use it to find which component dominates the
+    realize cost of a simulation without resorting to deleting components
+    one at a time:
+    @code
+    Component::startRealizeProfiling();
+    manager.integrate(finalTime);
+    Component::stopRealizeProfiling();
+    STOFileAdapter::write(Component::getRealizeProfile(), "profile.sto");
+    @endcode
+    Profiling is process-wide (all models in all threads are recorded) and
+    adds a timer and a map update to every profiled realize call, so leave
+    it off except when diagnosing performance. **/
+    /// @{
+    /** Discard any previously collected profile and begin recording. **/
+    static void startRealizeProfiling();
+    /** Stop recording. The collected profile is retained and can still be
+    obtained with getRealizeProfile() until profiling is restarted. **/
+    static void stopRealizeProfiling();
+    /** Whether the realize-cost profiler is currently recording. **/
+    static bool isRealizeProfilingEnabled();
+    /** Report the collected profile as a TimeSeriesTable with one row per
+    profiled stage (the independent column is the SimTK::Stage number for
+    Position, Velocity, and Dynamics) and, for each component that was
+    realized while profiling, a "<path>|seconds" column of accumulated wall
+    time and a "<path>|calls" column of call counts. **/
+    static TimeSeriesTable_<double> getRealizeProfile();
+    /// @}
+
+    /** @name Realize-stage tracing
+    An opt-in diagnostic that complements the realize-cost profiler: rather
+    than accumulating per-component totals it records every traced realize
+    call as a timed event, preserving nesting and thread identity, and
+    writes the collection in the Chrome trace-event JSON format. Load the
+    file at chrome://tracing (or any Perfetto viewer) to see a flame graph
+    of where each realization stage of each integrator step spends its
+    time — for example, that most of a path's position-stage cost sits in
+    two wrap objects:
+    @code
+    Component::startRealizeTracing();
+    manager.integrate(finalTime);
+    Component::stopRealizeTracing();
+    Component::writeRealizeTrace("trace.json");
+    @endcode
+    Hot paths that run inside a component's realize call (e.g.
+    %GeometryPath's wrapping computation) contribute nested events through
+    RealizeTraceScope. Tracing is process-wide and buffers every event in
+    memory until the trace is written, so keep traced intervals short. **/
+    /// @{
+    /** Discard any previously collected events and begin recording. **/
+    static void startRealizeTracing();
+    /** Stop recording. Collected events are retained until the trace is
+    written or tracing is restarted. **/
+    static void stopRealizeTracing();
+    /** Whether the realize tracer is currently recording. **/
+    static bool isRealizeTracingEnabled();
+    /** Write the collected events to `fileName` in the Chrome trace-event
+    JSON format and discard them. Returns the number of events written. **/
+    static std::size_t writeRealizeTrace(const std::string& fileName);
+    /** Append one sample of a named counter to the realize trace (a "C"
+    event in the trace-event format, drawn by viewers as a counter track
+    aligned with the timed events). No-op when tracing is disabled. Used by
+    AllocationTracker::Scope and by Manager's per-step allocation
+    reporting. **/
+    static void appendRealizeTraceCounter(const std::string& name,
+            double value);
+
+    /** RAII scope contributing one event, labelled
+    "<component path>|<label>", to the realize trace. Events nest by time
+    containment in the trace viewer, so a scope opened inside a realize
+    call appears under that call. Inactive, and cheap, when tracing is
+    disabled. **/
+    class OSIMCOMMON_API RealizeTraceScope {
+    public:
+        RealizeTraceScope(const Component& component, const char* label);
+        ~RealizeTraceScope();
+        RealizeTraceScope(const RealizeTraceScope&) = delete;
+        RealizeTraceScope& operator=(const RealizeTraceScope&) = delete;
+    private:
+        std::string _name;
+        double _beginUs{-1};
+    };
+    /// @}
+
+    /** @name Parallel property finalization
+    An opt-in, process-wide mode in which finalizeFromProperties() farms the
+    independent property and adopted subtrees of each component out to worker
+    threads. Subtrees are independent during this phase because sockets only
+    have their connectee-path properties checked here; cross-subtree socket
+    resolution happens later, in finalizeConnections(), which remains serial.
+    The worker budget is the hardware concurrency, shared across the process;
+    nested finalizations run inline once it is spent. Leave this off if any
+    component in the tree has an extendFinalizeFromProperties() override that
+    touches state shared across components. **/
+    /// @{
+    static void setParallelFinalizeFromPropertiesEnabled(bool enabled);
+    static bool getParallelFinalizeFromPropertiesEnabled();
+    /// @}
+
+    /** @name Memory footprint reporting
+    Attribute the memory of a model to its components. The footprint of a
+    component is an estimate of the bytes held by its property storage
+    (excluding contained subcomponents, which are reported on their own)
+    plus whatever non-property heap buffers its concrete class accounts for
+    in extendGetMemoryFootprint() — decoded mesh geometry, cached curves,
+    and the like. Simbody's internal System and State storage is not
+    visible from here and is not counted. **/
+    /// @{
+    /** Estimated bytes attributable to this component alone. **/
+    std::size_t getMemoryFootprint() const;
+    /** Report the footprint of every component in this subtree as a table
+    with a single row and, for each component, a "<path>|self" column (bytes
+    attributable to that component alone) and a "<path>|subtree" column
+    (self plus all of its subcomponents):
+    @code
+    STOFileAdapter::write(model.getMemoryFootprintReport(), "memory.sto");
+    @endcode **/
+    TimeSeriesTable_<double> getMemoryFootprintReport() const;
+    /// @}
+
 protected:
     class StateVariable;
     //template <class T> friend class ComponentSet;
@@ -2020,6 +2356,13 @@ protected:
     std::vector<SimTK::ReferencePtr<const Component>>
         getImmediateSubcomponents() const;
 
+    /** Access the immediate subcomponent at the given index in the
+        member/property/adopted ordering used by getImmediateSubcomponents(),
+        without building the intermediate list. Returns nullptr if the index
+        is out of range. This is primarily used to re-resolve cached socket
+        connectee routes cheaply. */
+    const Component* getImmediateSubcomponentByIndex(size_t index) const;
+
     /** @name  Component Extension Interface
     The interface ensures that deserialization, resolution of inter-connections,
     and handling of dependencies are performed systematically and prior to
@@ -2091,6 +2434,17 @@ protected:
         @endcode   */
     virtual void extendFinalizeFromProperties() {};
 
+    /** Account for heap storage that is not visible through this component's
+        properties — decoded mesh buffers, cached curve coefficients, etc. —
+        in the memory footprint report. Overrides must add their own buffers'
+        bytes to what the superclass reports:
+        @code
+        std::size_t MyComponent::extendGetMemoryFootprint() const {
+            return Super::extendGetMemoryFootprint() + myBufferBytes();
+        }
+        @endcode */
+    virtual std::size_t extendGetMemoryFootprint() const { return 0; }
+
     /** Perform any necessary initializations required to connect the component
     (and it subcomponents) to other components and mark the connection status.
     Provides a check for error conditions. connect() is invoked on all components
@@ -2584,6 +2938,13 @@ protected:
         // Get rid of all the ".."'s that are not at the front of the path.
         path.trimDotAndDotDotElements();
 
+        // Work from the interned form of the path: element comparisons below
+        // are either O(1) Atom comparisons or string comparisons against a
+        // reference into the global segment table, so no per-element
+        // substrings are allocated during traversal.
+        const std::vector<ComponentPath::Atom>& pathAtoms = path.getAtoms();
+        static const ComponentPath::Atom parentAtom = ComponentPath::intern("..");
+
         // Move up either to the root component or just enough to resolve all
         // the ".."'s.
         size_t iPathEltStart = 0u;
@@ -2591,8 +2952,8 @@ protected:
         if (path.isAbsolute()) {
             current = &current->getRoot();
         } else {
-            while (iPathEltStart < path.getNumPathLevels() &&
-                    path.getSubcomponentNameAtLevel(iPathEltStart) == "..") {
+            while (iPathEltStart < pathAtoms.size() &&
+                    pathAtoms[iPathEltStart] == parentAtom) {
                 // The path sends us up farther than the root.
                 if (!current->hasOwner()) return nullptr;
                 current = &current->getOwner();
@@ -2603,14 +2964,14 @@ protected:
         using RefComp = SimTK::ReferencePtr<const Component>;
 
         // Skip over the root component name.
-        for (size_t i = iPathEltStart; i < path.getNumPathLevels(); ++i) {
+        for (size_t i = iPathEltStart; i < pathAtoms.size(); ++i) {
             // At this depth in the tree, is there a component whose name
             // matches the corresponding path element?
-            const auto& currentPathElement =
-                path.getSubcomponentNameAtLevel(i);
+            const std::string& currentPathElement =
+                ComponentPath::getAtomString(pathAtoms[i]);
             const auto& currentSubs = current->getImmediateSubcomponents();
             const auto it = std::find_if(currentSubs.begin(), currentSubs.end(),
-                    [currentPathElement](const RefComp& sub)
+                    [&currentPathElement](const RefComp& sub)
                     { return sub->getName() == currentPathElement; });
             if (it != currentSubs.end())
                 current = it->get();
@@ -2890,6 +3251,25 @@ private:
     /// Invoke connect() on the (sub)components of this Component.
     void componentsFinalizeConnections(Component& root);
 
+    /// Whether this Component and all of its subcomponents, recursively, were
+    /// finalized against this root and have not been edited since, in which
+    /// case finalizeConnections() can skip this subtree.
+    bool hasFinalizedConnections(const Component& root) const;
+
+    /// Whether the tree below (and including) this component still matches
+    /// the identity snapshot taken when it last completed
+    /// finalizeConnections() as the root. False means components were added,
+    /// removed, renamed, or replaced since, so previously resolved connectees
+    /// anywhere in the tree may be stale or dangling.
+    bool matchesConnectionsTreeSignature() const;
+
+    /// Take the identity snapshot checked by matchesConnectionsTreeSignature().
+    void recordConnectionsTreeSignature();
+
+    /// Clear the finalized-connections markers of this whole subtree so that
+    /// the next finalizeConnections() revisits every component in it.
+    void clearConnectionMarkers();
+
     /// Base Component must create underlying resources in computational System.
     void baseAddToSystem(SimTK::MultibodySystem& system) const;
 
@@ -3075,6 +3455,26 @@ private:
     // Table of Component's Outputs indexed by name.
     std::map<std::string, SimTK::ClonePtr<AbstractOutput> > _outputsTable;
 
+    // The root against which this component's sockets and inputs were last
+    // finalized. finalizeConnections() skips a subtree whose root pointers
+    // still match and whose components are all up to date with their
+    // properties, so editing one component revalidates only the subtrees
+    // the edit made stale. ResetOnCopy: a copy has never been connected.
+    // AbstractSocket clears this when a socket or input is edited directly,
+    // since those edits do not flip the property up-to-date flag.
+    friend class AbstractSocket;
+    SimTK::ResetOnCopy<const Component*> _connectionsFinalizedRoot{nullptr};
+
+    // Identity snapshot (address and name, in pre-order) of the whole tree,
+    // taken when this component last completed finalizeConnections() as the
+    // root. Unlike the markers above, this snapshot survives
+    // finalizeFromProperties(), which restores every component's up-to-date
+    // flag before the skip check runs; comparing against it is what catches
+    // removed, renamed, or replaced components, whose death invalidates
+    // connectees resolved by *other*, unedited components.
+    SimTK::ResetOnCopy<std::vector<std::pair<const Component*, std::string>>>
+                                                _connectionsTreeSignature;
+
     // Underlying SimTK custom measure ComponentMeasure, which implements
     // the realizations in the subsystem by calling private concrete methods on
     // the Component. Every model component has one of these, allocated
@@ -3239,6 +3639,21 @@ private:
     // cache information.
     mutable SimTK::ResetOnCopy<std::unordered_map<std::string, StoredCacheVariable>> _namedCacheVariables;
 
+    // Flattened pre-order traversal index over this component and its
+    // subcomponents, plus one cached type-segregated sub-list per type
+    // requested through getFlattenedComponentList(). Both are rebuilt from
+    // the ownership tree on first use after being cleared (reset() clears
+    // them on every tree edit; finalizeConnections() rebuilds eagerly at the
+    // root). ResetOnCopy: the pointers refer into this tree, not a copy's.
+    mutable SimTK::ResetOnCopy<std::vector<const Component*>>
+                                                    _flatComponentTraversal;
+    mutable SimTK::ResetOnCopy<
+            std::unordered_map<std::type_index, std::shared_ptr<void>>>
+                                                    _flatTypeSublists;
+
+    // (Re)build _flatComponentTraversal by walking the ownership tree once.
+    void buildFlattenedComponentList() const;
+
     // Check that the list of _allStateVariables is valid
     bool isAllStatesVariablesListValid() const;
 
@@ -3377,12 +3792,32 @@ void Socket<C>::finalizeConnection(const Component& root) {
             connecteePath = connectee->getAbsolutePath();
         updConnecteePathProp().setValue(0, connecteePath.toString());
 
+        recordConnecteeRoute(root, comp);
+
     } else {
         const auto connecteePath = getConnecteePath();
         OPENSIM_THROW_IF(connecteePath.empty(), ConnecteeNotSpecified,
                         *this, getOwner());
 
         ComponentPath path(connecteePath);
+
+        // Fast path: if a resolution route was cached by a previous
+        // finalizeConnection (possibly in the component this socket was
+        // copied from, e.g. by Model::clone()), re-resolving is a child-index
+        // fix-up instead of a path search. The candidate is verified against
+        // the connectee path and type before use; any mismatch (an edited
+        // tree) falls through to the full search below.
+        if (const Component* candidate = followCachedConnecteeRoute(root)) {
+            if (const C* candidateT = dynamic_cast<const C*>(candidate)) {
+                const ComponentPath absPath = path.isAbsolute() ? path
+                    : path.formAbsolutePath(getOwner().getAbsolutePath());
+                if (candidate->getAbsolutePath() == absPath) {
+                    connectInternal(*candidateT);
+                    return;
+                }
+            }
+        }
+
         const C* comp = nullptr;
         if (path.isAbsolute()) {
             comp = &root.template getComponent<C>(path);
@@ -3390,6 +3825,7 @@ void Socket<C>::finalizeConnection(const Component& root) {
             comp = &getOwner().template getComponent<C>(path);
         }
         connectInternal(*comp);
+        recordConnecteeRoute(root, *comp);
     }
 }
 
@@ -29,3 +29,58 @@ using namespace OpenSim;
 std::string AbstractOutput::getPathName() const {
     return getOwner().getAbsolutePathString() + "|" + getName();
 }
+
+void OutputBatch::addOutput(const AbstractOutput& output) {
+    OPENSIM_THROW_IF(output.isListOutput(), Exception,
+        "OutputBatch: cannot batch list Output '" + output.getName() +
+        "'; register its individual channels' outputs instead.");
+
+    const int numScalars = output.getNumScalars();
+    OPENSIM_THROW_IF(numScalars < 0, Exception,
+        "OutputBatch: Output '" + output.getName() + "' of type " +
+        output.getTypeName() + " cannot be flattened into scalars.");
+
+    Entry entry;
+    entry.output.reset(&output);
+    entry.offset = _numScalars;
+    entry.numScalars = numScalars;
+    _entries.push_back(entry);
+
+    _numScalars += numScalars;
+    if (output.getDependsOnStage() > _dependsOnStage)
+        _dependsOnStage = output.getDependsOnStage();
+}
+
+std::vector<std::string> OutputBatch::getScalarLabels() const {
+    std::vector<std::string> labels;
+    labels.reserve(_numScalars);
+    for (const Entry& entry : _entries) {
+        const std::string pathName = entry.output->getPathName();
+        if (entry.numScalars == 1) {
+            labels.push_back(pathName);
+        } else {
+            for (int i = 0; i < entry.numScalars; ++i)
+                labels.push_back(pathName + "_" + std::to_string(i));
+        }
+    }
+    return labels;
+}
+
+void OutputBatch::evaluateInto(const SimTK::State& state,
+                               SimTK::Vector& buffer) const {
+    if (buffer.size() != _numScalars)
+        buffer.resize(_numScalars);
+
+    if (_entries.empty())
+        return;
+
+    // one stage check for the whole batch
+    if (state.getSystemStage() < _dependsOnStage) {
+        throw SimTK::Exception::StageTooLow(__FILE__, __LINE__,
+                state.getSystemStage(), _dependsOnStage,
+                "OutputBatch::evaluateInto()");
+    }
+
+    for (const Entry& entry : _entries)
+        entry.output->getValueAsScalars(state, &buffer[entry.offset]);
+}
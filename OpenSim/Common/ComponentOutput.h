@@ -36,6 +36,8 @@
 
 #include <functional>
 #include <map>
+#include <string>
+#include <vector>
 
 #include <SimTKcommon/internal/Stage.h>
 #include <SimTKcommon/internal/State.h>
@@ -135,6 +137,20 @@ public:
     virtual bool        isCompatible(const AbstractOutput&) const = 0;
     virtual void compatibleAssign(const AbstractOutput&) = 0;
 
+    /** The number of scalars (doubles) this output's value flattens into for
+    batched evaluation (e.g., 1 for double, 3 for Vec3, 6 for SpatialVec), or
+    -1 if this output's type cannot be flattened. @see OutputBatch */
+    virtual int getNumScalars() const { return -1; }
+    /** Write this output's value, flattened into getNumScalars() doubles,
+    into `buffer`. Unlike getValue(), no stage check is performed here: the
+    caller (typically an OutputBatch) is responsible for checking the stage
+    once for the whole batch. Throws if getNumScalars() is -1. */
+    virtual void getValueAsScalars(const SimTK::State& state,
+                                   double* buffer) const {
+        OPENSIM_THROW(Exception, "Output '" + getName() + "' of type " +
+                getTypeName() + " cannot be evaluated as scalars.");
+    }
+
     AbstractOutput& operator=(const AbstractOutput& o)
     { compatibleAssign(o); return *this; }
 
@@ -165,6 +181,34 @@ private:
 //=============================================================================
 };  // END class AbstractOutput
 
+#ifndef SWIG
+/** Traits describing how an Output value type flattens into doubles for
+batched evaluation (see OutputBatch). The primary template marks a type as
+non-flattenable; specializations exist for the scalarizable types. */
+template <typename T> struct OutputScalarTraits {
+    static const int numScalars = -1;
+    static void copyOut(const T&, double*) {}
+};
+template <> struct OutputScalarTraits<double> {
+    static const int numScalars = 1;
+    static void copyOut(const double& value, double* out) { out[0] = value; }
+};
+template <> struct OutputScalarTraits<SimTK::Vec3> {
+    static const int numScalars = 3;
+    static void copyOut(const SimTK::Vec3& value, double* out) {
+        for (int i = 0; i < 3; ++i) out[i] = value[i];
+    }
+};
+template <> struct OutputScalarTraits<SimTK::Vec<2, SimTK::Vec3>> {
+    static const int numScalars = 6;
+    static void copyOut(const SimTK::Vec<2, SimTK::Vec3>& value, double* out) {
+        for (int i = 0; i < 2; ++i)
+            for (int j = 0; j < 3; ++j)
+                out[3*i + j] = value[i][j];
+    }
+};
+#endif // SWIG
+
 template<class T>
 class Output : public AbstractOutput {
 public:
@@ -308,6 +352,28 @@ public:
         return s.str();
     }
 
+#ifndef SWIG
+    int getNumScalars() const override
+    {   return OutputScalarTraits<T>::numScalars; }
+
+    void getValueAsScalars(const SimTK::State& state,
+                           double* buffer) const override {
+        if (OutputScalarTraits<T>::numScalars < 0) {
+            // fall through to the (throwing) base implementation
+            AbstractOutput::getValueAsScalars(state, buffer);
+            return;
+        }
+        if (isListOutput()) {
+            throw Exception("Cannot get value for list Output. "
+                            "Ask a specific channel for its value.");
+        }
+        // The stage was checked once for the whole batch by the caller;
+        // evaluate directly into the caller's buffer.
+        _outputFcn(_owner.get(), state, "", _result);
+        OutputScalarTraits<T>::copyOut(_result, buffer);
+    }
+#endif
+
     Output<T>* clone() const override { return new Output(*this); }
     SimTK_DOWNCAST(Output, AbstractOutput);
 
@@ -369,6 +435,72 @@ private:
 #endif
 };
 
+//=============================================================================
+//                              OUTPUT BATCH
+//=============================================================================
+/** A preresolved set of Outputs that can be evaluated in one pass per
+realize stage into a preallocated contiguous buffer.
+
+Reporters that pull hundreds of outputs per report interval pay a virtual
+getValue() call plus a SimTK::Stage check per output per report. An
+%OutputBatch lets such a consumer register its outputs once (addOutput()),
+then evaluate them all per report with a single stage check and one flat
+write into a caller-owned buffer (evaluateInto()):
+
+@code
+OutputBatch batch;
+for (const auto* output : outputsOfInterest)
+    batch.addOutput(*output);
+SimTK::Vector row(batch.getNumScalars());
+// ... per reporting step:
+batch.evaluateInto(state, row);
+@endcode
+
+Only outputs whose value type flattens into a fixed number of doubles can be
+batched (double, Vec3, SpatialVec; see OutputScalarTraits); addOutput()
+throws for list outputs and non-flattenable types. Registered output
+references must outlive the batch, so re-register after any operation that
+rebuilds the component tree. **/
+class OSIMCOMMON_API OutputBatch {
+public:
+    OutputBatch() = default;
+
+    /** Register an output with this batch. Its scalars will occupy the next
+    getNumScalars(output) slots of the evaluation buffer. Throws if the
+    output is a list output or its type cannot be flattened into doubles. **/
+    void addOutput(const AbstractOutput& output);
+
+    /** Number of registered outputs. **/
+    int getNumOutputs() const { return (int)_entries.size(); }
+
+    /** Total number of scalars written by evaluateInto(). **/
+    int getNumScalars() const { return _numScalars; }
+
+    /** Highest dependsOnStage over all registered outputs; this is the one
+    stage requirement checked by evaluateInto(). **/
+    const SimTK::Stage& getDependsOnStage() const { return _dependsOnStage; }
+
+    /** One label per scalar, in buffer order. A one-scalar output is labeled
+    by its path name ("<component-path>|<output-name>"); each scalar of a
+    multi-scalar output gets a "_<index>" suffix. **/
+    std::vector<std::string> getScalarLabels() const;
+
+    /** Evaluate all registered outputs into `buffer` in registration order.
+    The stage is checked once for the whole batch; `buffer` is resized only
+    if its size does not match getNumScalars(). **/
+    void evaluateInto(const SimTK::State& state, SimTK::Vector& buffer) const;
+
+private:
+    struct Entry {
+        SimTK::ReferencePtr<const AbstractOutput> output;
+        int offset;
+        int numScalars;
+    };
+    std::vector<Entry> _entries;
+    int _numScalars = 0;
+    SimTK::Stage _dependsOnStage = SimTK::Stage::Topology;
+};
+
 // TODO consider using std::reference_wrapper<T> as type for _output_##oname,
 // since it is copyable.
 
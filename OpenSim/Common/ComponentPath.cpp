@@ -25,7 +25,10 @@
 
 #include "Exception.h"
 #include <algorithm>
+#include <deque>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 using OpenSim::ComponentPath;
 
@@ -262,6 +265,28 @@ namespace {
 
         return path;
     }
+
+    /**
+     * The process-global path-segment table backing ComponentPath::Atom.
+     *
+     * Entries are only ever appended, never removed, so:
+     *
+     * - an Atom (an index into `strings`) stays valid for the lifetime of
+     *   the process
+     * - references returned by ComponentPath::getAtomString remain valid
+     *   after the table's lock is released (std::deque never relocates
+     *   existing elements)
+     */
+    struct AtomTable {
+        std::mutex mutex;
+        std::unordered_map<std::string, ComponentPath::Atom> ids;
+        std::deque<std::string> strings;
+    };
+
+    AtomTable& getAtomTable() {
+        static AtomTable table;
+        return table;
+    }
 }
 
 ComponentPath::ComponentPath() = default;
@@ -409,6 +434,76 @@ std::string ComponentPath::getSubcomponentNameAtLevel(size_t index) const {
     return std::string{firstComponent, componentEnd};
 }
 
+ComponentPath::Atom ComponentPath::intern(const std::string& pathElement) {
+    if (pathElement.find_first_of(newInvalidChars) != std::string::npos) {
+        OPENSIM_THROW(Exception, pathElement + ": provided path element contains invalid characters.");
+    }
+
+    AtomTable& table = getAtomTable();
+    std::lock_guard<std::mutex> lock{table.mutex};
+
+    auto it = table.ids.find(pathElement);
+    if (it != table.ids.end()) {
+        return it->second;
+    }
+
+    auto atom = static_cast<Atom>(table.strings.size());
+    table.strings.push_back(pathElement);
+    table.ids.emplace(pathElement, atom);
+    return atom;
+}
+
+const std::string& ComponentPath::getAtomString(Atom atom) {
+    AtomTable& table = getAtomTable();
+    std::lock_guard<std::mutex> lock{table.mutex};
+
+    if (atom >= table.strings.size()) {
+        std::stringstream msg;
+        msg << "Invalid atom id '" << atom << "': no such path element has been interned.";
+        OPENSIM_THROW(Exception, msg.str());
+    }
+
+    return table.strings[atom];
+}
+
+const std::vector<ComponentPath::Atom>& ComponentPath::getAtoms() const {
+    if (!_atomsValid) {
+        _atoms.clear();
+        _atoms.reserve(getNumPathLevels());
+
+        auto elementStart = firstComponentIn(_path);
+        while (elementStart != _path.end()) {
+            auto elementEnd = std::find(elementStart, _path.end(), separator);
+            _atoms.push_back(intern(std::string{elementStart, elementEnd}));
+
+            if (elementEnd == _path.end()) {
+                break;
+            }
+            elementStart = elementEnd + 1;  // skip the found separator
+        }
+
+        _atomsValid = true;
+    }
+
+    return _atoms;
+}
+
+ComponentPath::Atom ComponentPath::getAtomAtLevel(size_t index) const {
+    const std::vector<Atom>& atoms = getAtoms();
+
+    if (index >= atoms.size()) {
+        std::stringstream msg;
+        msg << _path << ": invalid index '" << index << "' into this path.";
+        OPENSIM_THROW(Exception, msg.str());
+    }
+
+    return atoms[index];
+}
+
+const std::string& ComponentPath::getAtomStringAtLevel(size_t index) const {
+    return getAtomString(getAtomAtLevel(index));
+}
+
 std::string ComponentPath::getComponentName() const {
     if (firstComponentIn(_path) == _path.end()) {
         return {};
@@ -466,6 +561,10 @@ void ComponentPath::pushBack(const std::string& pathElement) {
         _path += separator;
     }
     _path += pathElement;
+
+    // the cached interned form (if any) no longer matches the path string
+    _atoms.clear();
+    _atomsValid = false;
 }
 
 bool ComponentPath::isLegalPathElement(const std::string& pathElement) const {
@@ -25,6 +25,7 @@
 
 #include "osimCommonDLL.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -51,7 +52,41 @@ class OSIMCOMMON_API ComponentPath {
 private:
     std::string _path;
 
+    // Lazily-computed interned form of the path: one Atom per path element.
+    // Invalidated whenever `_path` is mutated (see pushBack).
+    mutable std::vector<std::uint32_t> _atoms;
+    mutable bool _atomsValid = false;
+
 public:
+    /**
+     * An interned path-segment id.
+     *
+     * Each distinct path element (e.g. "femur_r" in "/bodyset/femur_r") is
+     * assigned a small integer id from a process-global segment table the
+     * first time it is seen. Two Atoms compare equal if, and only if, their
+     * segments are string-equal, so element comparisons during tree traversal
+     * are O(1) integer comparisons with no allocation. Atoms are never
+     * recycled, so an Atom remains valid for the lifetime of the process.
+     */
+    using Atom = std::uint32_t;
+
+    /**
+     * Interns a single path element into the global segment table and returns
+     * its Atom. Repeated calls with the same element return the same Atom.
+     * This function is thread-safe.
+     *
+     * Throws if `pathElement` contains invalid characters.
+     */
+    static Atom intern(const std::string& pathElement);
+
+    /**
+     * Returns the path element associated with an Atom. The returned
+     * reference remains valid for the lifetime of the process (entries are
+     * never removed from the segment table). Throws if `atom` was not
+     * produced by intern().
+     */
+    static const std::string& getAtomString(Atom atom);
+
     /**
      * Default constructor that constructs an empty path ("").
      */
@@ -118,6 +153,29 @@ public:
      */
     std::string getSubcomponentNameAtLevel(size_t index) const;
 
+    /**
+     * Returns the interned form of this path: one Atom per path element, in
+     * order. The interned form is computed on first use and cached, so
+     * repeated traversals of the same ComponentPath perform no splitting or
+     * allocation. Like the other lazily-cached accessors in this class, this
+     * method is not thread-safe on a single instance.
+     */
+    const std::vector<Atom>& getAtoms() const;
+
+    /**
+     * Returns the Atom of the path element at the specified level
+     * (0-indexed). Throws if `index` is out of range.
+     */
+    Atom getAtomAtLevel(size_t index) const;
+
+    /**
+     * Returns the path element at the specified level (0-indexed) as a
+     * reference into the global segment table. Unlike
+     * getSubcomponentNameAtLevel(), this does not allocate a new string per
+     * call. Throws if `index` is out of range.
+     */
+    const std::string& getAtomStringAtLevel(size_t index) const;
+
     /**
      * Returns the name of the Component in the path (effectively, the last
      * element in the path).
@@ -24,6 +24,8 @@
 #include "ComponentSocket.h"
 #include "Component.h"
 
+#include <algorithm>
+
 using namespace OpenSim;
 
 const Property<std::string>&
@@ -34,11 +36,63 @@ AbstractSocket::getConnecteePathProp() const {
 Property<std::string>&
 AbstractSocket::updConnecteePathProp() {
     auto* owner = const_cast<Component*>(_owner.get());
-    // We do not want to flip the isObjectUpToDateWithProperties flag.
+    // We do not want to flip the isObjectUpToDateWithProperties flag, but
+    // the next finalizeConnections() must not skip the owner's subtree.
+    markOwnerConnectionsStale();
     const auto& prop = owner->getProperty<std::string>(_connecteePathIndex);
     return const_cast<Property<std::string>&>(prop);
 }
 
+void AbstractSocket::markOwnerConnectionsStale() {
+    if (_owner.empty())
+        return;
+    const_cast<Component*>(_owner.get())->_connectionsFinalizedRoot = nullptr;
+}
+
+const Component*
+AbstractSocket::followCachedConnecteeRoute(const Component& root) const {
+    if (!_hasConnecteeRoute)
+        return nullptr;
+
+    const Component* current = &root;
+    for (unsigned index : _connecteeRoute) {
+        current = current->getImmediateSubcomponentByIndex(index);
+        if (!current)
+            return nullptr;
+    }
+    return current;
+}
+
+void AbstractSocket::recordConnecteeRoute(const Component& root,
+                                          const Component& connectee) {
+    _connecteeRoute.clear();
+    _hasConnecteeRoute = false;
+
+    const Component* current = &connectee;
+    while (current != &root) {
+        if (!current->hasOwner())
+            return; // connectee is not in root's tree; nothing to record
+        const Component& parent = current->getOwner();
+        const auto siblings = parent.getImmediateSubcomponents();
+        bool found = false;
+        for (unsigned i = 0; i < siblings.size(); ++i) {
+            if (siblings[i].get() == current) {
+                _connecteeRoute.push_back(i);
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            _connecteeRoute.clear();
+            return;
+        }
+        current = &parent;
+    }
+
+    std::reverse(_connecteeRoute.begin(), _connecteeRoute.end());
+    _hasConnecteeRoute = true;
+}
+
 void AbstractSocket::prependComponentPathToConnecteePath(
         const std::string& pathToPrepend) {
     for (unsigned iConn = 0u; iConn < getNumConnectees(); ++iConn) {
@@ -33,6 +33,8 @@
 #include "Exception.h"
 #include "Property.h"
 
+#include <vector>
+
 namespace OpenSim {
 
 //==============================================================================
@@ -310,6 +312,33 @@ protected:
     /// (Object::isObjectUpToDateWithProperties()).
     Property<std::string>& updConnecteePathProp();
 
+    /// Clear the owning Component's record of having finalized its
+    /// connections, so the next Component::finalizeConnections() revisits
+    /// it rather than skipping its subtree. Called whenever a socket or
+    /// input is edited directly (connected, disconnected, or given a new
+    /// connectee path), since such edits do not flip the owner's property
+    /// up-to-date flag.
+    void markOwnerConnectionsStale();
+
+    /// Follow this socket's cached connectee-resolution route (if one has
+    /// been recorded) from `root` to a candidate connectee. The route is a
+    /// sequence of child indices, so following it is a pointer fix-up rather
+    /// than a path search; it is carried across socket copies, which is what
+    /// makes re-finalizing a cloned model cheap. Returns nullptr if no route
+    /// was recorded or the route no longer leads to a component. Callers
+    /// must verify the candidate's identity (type and path) before
+    /// connecting to it, since the tree may have been edited since the route
+    /// was recorded.
+    const Component* followCachedConnecteeRoute(const Component& root) const;
+
+    /// Record the child-index route from `root` to `connectee` so that later
+    /// re-finalizations (including those of copies of this socket, e.g.
+    /// after Model::clone()) can resolve the connectee without a path
+    /// search. Clears any previously recorded route if `connectee` is not
+    /// reachable from `root`.
+    void recordConnecteeRoute(const Component& root,
+                              const Component& connectee);
+
 
 private:
 
@@ -329,6 +358,12 @@ private:
     SimTK::ReferencePtr<const Component> _owner;
     // _isList must be after _owner, as _owner is used to set its value.
     bool _isList;
+    // Cached connectee-resolution route: child indices (in the ordering of
+    // Component::getImmediateSubcomponents()) from the root component down
+    // to the connectee. Deliberately copied with the socket so clones of an
+    // already-connected component can re-resolve by index fix-up.
+    std::vector<unsigned> _connecteeRoute;
+    bool _hasConnecteeRoute = false;
 
     /* So that Component can invoke setOwner(), etc. */
     friend Component;
@@ -392,6 +427,7 @@ public:
 
     void disconnect() override {
         connectee.reset(nullptr);
+        markOwnerConnectionsStale();
     }
     
     /** Derived classes must satisfy this Interface */
@@ -431,6 +467,7 @@ private:
 
     void connectInternal(const T& objT) {
         connectee = &objT;
+        markOwnerConnectionsStale();
     }
 
     mutable SimTK::ReferencePtr<const T> connectee;
@@ -704,6 +741,7 @@ public:
         _registeredChannels.clear();
         _connectees.clear();
         _aliases.clear();
+        markOwnerConnectionsStale();
     }
     
     bool isConnected() const override {
@@ -910,6 +948,7 @@ private:
         _registeredChannels.emplace_back(
                 SimTK::ReferencePtr<const Output<T>>(&chanT->getOutput()),
                 chanT->getChannelName(), alias);
+        markOwnerConnectionsStale();
     }
     void connectInternal(const AbstractChannel& channel,
             const std::string& alias) {
@@ -930,6 +969,7 @@ private:
         }
         _connectees.emplace_back(chanT);
         _aliases.push_back(alias);
+        markOwnerConnectionsStale();
     }
     // These are channels the user has requested that we connect to.
     using RegisteredChannel =
@@ -44,8 +44,16 @@ bool
 registerAdapters{DataAdapter::registerDataAdapter("trc", TRCFileAdapter{}) 
         && DataAdapter::registerDataAdapter("mot", STOFileAdapter_<double>{}) 
         && DataAdapter::registerDataAdapter("csv", CSVFileAdapter{})
+        && DataAdapter::registerDataAdapter("ostb", OSTBFileAdapter{})
 #if defined (WITH_EZC3D)
               && DataAdapter::registerDataAdapter("c3d", C3DFileAdapter{})
+#endif
+#if defined (WITH_ARROW)
+              && DataAdapter::registerDataAdapter("parquet",
+                                                  ParquetFileAdapter{})
+#endif
+#if defined (WITH_HDF5)
+              && DataAdapter::registerDataAdapter("h5", H5FileAdapter{})
 #endif
                 };
 
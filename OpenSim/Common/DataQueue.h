@@ -22,8 +22,11 @@
  * See the License for the specific language governing permissions and        *
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
+#include <atomic>
 #include <queue>
 #include <condition_variable>
+#include <thread>
+#include <vector>
 #include <SimTKcommon.h>
 #include <OpenSim/Common/osimCommonDLL.h>
 
@@ -43,7 +46,7 @@ namespace OpenSim {
  * @author Ayman Habib
  */
 /** Template class to contain Queue Entries, typically timestamped */
-template <class U> 
+template <class U>
 class DataQueueEntry_ {
 public:
     DataQueueEntry_(double timeStamp, const SimTK::RowVectorView_<U>& data)
@@ -54,20 +57,31 @@ public:
     virtual ~DataQueueEntry_(){};
 
     double getTimeStamp() const { return _timeStamp; };
-    SimTK::RowVectorView_<U> getData() const { return _data; };
+    const SimTK::RowVector_<U>& getData() const { return _data; };
 
 private:
     double _timeStamp;
-    SimTK::RowVectorView_<U> _data;
+    // The entry owns a deep copy of the row so that it remains valid after
+    // the producer's buffer is reused or destroyed.
+    SimTK::RowVector_<U> _data;
 };
 /**
- * DataQueue is a wrapper around the std::queue customized to handle data 
- * processing and synchronization, and limiting the interface to only the 
- * subset of operations needed for this use case. 
- * Synchronization is experimental as of now. Client is responsible for 
+ * DataQueue is a wrapper around the std::queue customized to handle data
+ * processing and synchronization, and limiting the interface to only the
+ * subset of operations needed for this use case.
+ * Synchronization is experimental as of now. Client is responsible for
  * making sure order is preserved.
  * timestamp is required to pass in data so that clients can enforce order,
  * however timestamp is not used/order-enforced internally.
+ *
+ * By default the queue is unbounded and guarded by a mutex and condition
+ * variable. Calling setRingBufferSize() before any data is pushed switches
+ * the queue to a lock-free single-producer single-consumer ring buffer with
+ * preallocated row slots: push_back() and pop_front() then copy rows into
+ * and out of fixed storage without allocating or taking a lock, which keeps
+ * a live acquisition thread (e.g. streaming IMU orientations at 200 Hz)
+ * from contending with the consuming solver thread. In ring-buffer mode
+ * exactly one producer thread and one consumer thread are supported.
  */
 // @TODO Test support of multiple consumers. 
 template<class T> class DataQueue_ {
@@ -79,54 +93,183 @@ public:
     // CONSTRUCTION
     //--------------------------------------------------------------------------
     virtual ~DataQueue_() {}
-    
+
     DataQueue_()                                = default;
-    // using compiler generated methods here is problematic due to mutex 
-    DataQueue_(const DataQueue_& other){ 
+    // using compiler generated methods here is problematic due to mutex
+    DataQueue_(const DataQueue_& other){
         m_data_queue = other.m_data_queue;
+        copyRingBuffer(other);
     };
-    DataQueue_(DataQueue_&& other){ 
+    DataQueue_(DataQueue_&& other){
         m_data_queue = other.m_data_queue;
+        copyRingBuffer(other);
     };
-    DataQueue_& operator=(const DataQueue_& other) { 
+    DataQueue_& operator=(const DataQueue_& other) {
         m_data_queue = other.m_data_queue;
+        copyRingBuffer(other);
         return (*this);
     };
 
     //--------------------------------------------------------------------------
     // DataQueue Interface
     //--------------------------------------------------------------------------
+    /** Switch to lock-free single-producer single-consumer mode, holding at
+    most numSlots rows of numColumns entries each. All row storage is
+    allocated here; subsequent push/pop calls are lock- and allocation-free.
+    Must be called before any data is pushed, and every pushed row must have
+    numColumns entries. */
+    void setRingBufferSize(int numSlots, int numColumns) {
+        m_slotTimes.assign(numSlots, 0.0);
+        m_slots.assign(numSlots, SimTK::RowVector_<T>(numColumns));
+        m_numSlots = numSlots;
+        m_pushCount = 0;
+        m_popCount = 0;
+    }
+    /** Whether setRingBufferSize() has switched this queue to the lock-free
+    single-producer single-consumer mode. */
+    bool isRingBuffer() const { return m_numSlots > 0; }
+
     // push data and associated timestamp to the end of the queue
-    void push_back(const double time, const SimTK::RowVectorView_<T>& data) { 
-        SimTK::RowVector_<T>* deepCopy = new SimTK::RowVector_<T>(data);
+    void push_back(const double time, const SimTK::RowVectorView_<T>& data) {
+        if (isRingBuffer()) {
+            // Wait for the consumer to free a slot; producer-side spin is
+            // rare unless the consumer has stalled outright.
+            while (!tryPushBack(time, data)) std::this_thread::yield();
+            return;
+        }
         std::unique_lock<std::mutex> mlock(m_mutex);
-        m_data_queue.push(DataQueueEntry_<T>(time, *deepCopy));
+        m_data_queue.push(DataQueueEntry_<T>(time, data));
         mlock.unlock();     // unlock before notificiation to minimize mutex con
-        m_cond.notify_one(); 
+        m_cond.notify_one();
+    }
+    /** Push without blocking; returns false if the ring buffer is full (in
+    the default mutex mode the queue is unbounded and this always
+    succeeds). */
+    bool tryPushBack(const double time, const SimTK::RowVectorView_<T>& data) {
+        if (!isRingBuffer()) {
+            push_back(time, data);
+            return true;
+        }
+        const long long pushed = m_pushCount.load(std::memory_order_relaxed);
+        if (pushed - m_popCount.load(std::memory_order_acquire) >= m_numSlots)
+            return false;
+        const int slot = (int)(pushed % m_numSlots);
+        m_slotTimes[slot] = time;
+        m_slots[slot] = data;
+        m_pushCount.store(pushed + 1, std::memory_order_release);
+        return true;
     }
     // pop the front of the queue and return data and associated timestamp
-    void pop_front(double& time, SimTK::RowVector_<T>& data) { 
+    void pop_front(double& time, SimTK::RowVector_<T>& data) {
+        if (isRingBuffer()) {
+            while (!tryPopFront(time, data)) std::this_thread::yield();
+            return;
+        }
         std::unique_lock<std::mutex> mlock(m_mutex);
         while (m_data_queue.empty()) { m_cond.wait(mlock); }
-        DataQueueEntry_<SimTK::Rotation> frontEntry = m_data_queue.front();
+        DataQueueEntry_<T> frontEntry = m_data_queue.front();
         m_data_queue.pop();
-        mlock.unlock(); 
+        mlock.unlock();
         time = frontEntry.getTimeStamp();
         data = frontEntry.getData();
     }
+    /** Pop without blocking; returns false if no data is available. */
+    bool tryPopFront(double& time, SimTK::RowVector_<T>& data) {
+        if (!isRingBuffer()) {
+            std::unique_lock<std::mutex> mlock(m_mutex);
+            if (m_data_queue.empty()) return false;
+            DataQueueEntry_<T> frontEntry = m_data_queue.front();
+            m_data_queue.pop();
+            mlock.unlock();
+            time = frontEntry.getTimeStamp();
+            data = frontEntry.getData();
+            return true;
+        }
+        const long long popped = m_popCount.load(std::memory_order_relaxed);
+        if (m_pushCount.load(std::memory_order_acquire) == popped)
+            return false;
+        const int slot = (int)(popped % m_numSlots);
+        time = m_slotTimes[slot];
+        data = m_slots[slot];
+        m_popCount.store(popped + 1, std::memory_order_release);
+        return true;
+    }
+    /** Pop every row currently in the queue in one call, without blocking.
+    Row i of data holds the i-th popped row and times[i] its timestamp.
+    Returns the number of rows popped (possibly 0); data is only resized
+    when that number changes between calls. */
+    int popAvailable(std::vector<double>& times, SimTK::Matrix_<T>& data) {
+        times.clear();
+        if (isRingBuffer()) {
+            const long long popped = m_popCount.load(std::memory_order_relaxed);
+            const long long pushed =
+                    m_pushCount.load(std::memory_order_acquire);
+            const int numRows = (int)(pushed - popped);
+            if (data.nrow() != numRows)
+                data.resize(numRows, m_slots.empty() ? 0 : m_slots[0].size());
+            for (int i = 0; i < numRows; ++i) {
+                const int slot = (int)((popped + i) % m_numSlots);
+                times.push_back(m_slotTimes[slot]);
+                data.updRow(i) = m_slots[slot];
+            }
+            m_popCount.store(pushed, std::memory_order_release);
+            return numRows;
+        }
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        const int numRows = (int)m_data_queue.size();
+        if (data.nrow() != numRows)
+            data.resize(numRows,
+                    numRows > 0 ? m_data_queue.front().getData().size() : 0);
+        for (int i = 0; i < numRows; ++i) {
+            times.push_back(m_data_queue.front().getTimeStamp());
+            data.updRow(i) = m_data_queue.front().getData();
+            m_data_queue.pop();
+        }
+        return numRows;
+    }
+    /** Number of rows currently queued (pushed but not yet popped). */
+    int getNumQueued() {
+        if (isRingBuffer()) {
+            return (int)(m_pushCount.load(std::memory_order_acquire) -
+                         m_popCount.load(std::memory_order_acquire));
+        }
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        return (int)m_data_queue.size();
+    }
     // check if the queue is empty
-    bool isEmpty() { 
+    bool isEmpty() {
+        if (isRingBuffer()) {
+            return m_pushCount.load(std::memory_order_acquire) ==
+                   m_popCount.load(std::memory_order_acquire);
+        }
         bool status = false;
         std::unique_lock<std::mutex> mlock(m_mutex);
         status = m_data_queue.empty();
-        mlock.unlock(); 
+        mlock.unlock();
         return status;
     }
 private:
+    void copyRingBuffer(const DataQueue_& other) {
+        m_slotTimes = other.m_slotTimes;
+        m_slots = other.m_slots;
+        m_numSlots = other.m_numSlots;
+        m_pushCount.store(other.m_pushCount.load());
+        m_popCount.store(other.m_popCount.load());
+    }
+
     // As of now we use std::queue but other data structures could be used as well
     std::queue<DataQueueEntry_<T>> m_data_queue;
     std::mutex m_mutex;
     std::condition_variable m_cond;
+    // Ring-buffer mode (setRingBufferSize()). The producer only writes
+    // m_pushCount and the slots it is filling; the consumer only writes
+    // m_popCount. Slot indices are the counters modulo m_numSlots, so the
+    // buffer is full when the counters differ by m_numSlots.
+    std::vector<double> m_slotTimes;
+    std::vector<SimTK::RowVector_<T>> m_slots;
+    int m_numSlots{0};
+    std::atomic<long long> m_pushCount{0};
+    std::atomic<long long> m_popCount{0};
 
     //=============================================================================
 };  // END of class templatized DataQueue_<T>
@@ -1145,6 +1145,198 @@ public:
 
     /// @}
 
+    /// @name Zero-copy span views.
+    /// The underlying matrix stores its columns contiguously, so a dependent
+    /// column can be viewed as a raw stride-1 span without copying. These
+    /// accessors return SimTK::ArrayView(Const)_ objects pointing directly
+    /// into the table's storage -- suitable for passing to code that expects
+    /// contiguous arrays. The scalar-span variants additionally view a
+    /// column of composite elements (Vec3, Quaternion, etc.) as a flat run
+    /// of scalars: a Vec3 column of n rows is seen as 3n consecutive
+    /// doubles. Spans are invalidated by any operation that resizes the
+    /// table.
+    /// @{
+
+    /** Get a read-only contiguous span over the elements of the dependent
+    column at index. No data are copied.
+
+    \throws EmptyTable If the table is empty.
+    \throws ColumnIndexOutOfRange If index is out of range for number of
+                                  columns in the table.                       */
+    SimTK::ArrayViewConst_<ETY> getDependentColumnSpan(size_t index) const {
+        OPENSIM_THROW_IF(isEmpty(), EmptyTable);
+        OPENSIM_THROW_IF(isColumnIndexOutOfRange(index),
+                         ColumnIndexOutOfRange, index, 0,
+                         static_cast<size_t>(_depData.ncol() - 1));
+
+        const ETY* first = &_depData.getElt(0, static_cast<int>(index));
+        return SimTK::ArrayViewConst_<ETY>(first, first + _depData.nrow());
+    }
+
+    /** Get a writable contiguous span over the elements of the dependent
+    column at index. No data are copied.
+
+    \throws EmptyTable If the table is empty.
+    \throws ColumnIndexOutOfRange If index is out of range for number of
+                                  columns in the table.                       */
+    SimTK::ArrayView_<ETY> updDependentColumnSpan(size_t index) {
+        OPENSIM_THROW_IF(isEmpty(), EmptyTable);
+        OPENSIM_THROW_IF(isColumnIndexOutOfRange(index),
+                         ColumnIndexOutOfRange, index, 0,
+                         static_cast<size_t>(_depData.ncol() - 1));
+
+        ETY* first = &_depData.updElt(0, static_cast<int>(index));
+        return SimTK::ArrayView_<ETY>(first, first + _depData.nrow());
+    }
+
+    /** Get a read-only flat scalar span over the dependent column at index:
+    each element contributes numComponentsPerElement() consecutive scalars.
+    No data are copied.
+
+    \throws EmptyTable If the table is empty.
+    \throws ColumnIndexOutOfRange If index is out of range for number of
+                                  columns in the table.                       */
+    SimTK::ArrayViewConst_<double>
+    getDependentColumnScalarSpan(size_t index) const {
+        static_assert(sizeof(ETY) % sizeof(double) == 0,
+                      "Template argument ETY must be a packed composite of "
+                      "scalars of type double.");
+        OPENSIM_THROW_IF(isEmpty(), EmptyTable);
+        OPENSIM_THROW_IF(isColumnIndexOutOfRange(index),
+                         ColumnIndexOutOfRange, index, 0,
+                         static_cast<size_t>(_depData.ncol() - 1));
+
+        const double* first = reinterpret_cast<const double*>(
+                &_depData.getElt(0, static_cast<int>(index)));
+        const size_t numScalars =
+                _depData.nrow() * (sizeof(ETY) / sizeof(double));
+        return SimTK::ArrayViewConst_<double>(first, first + numScalars);
+    }
+
+    /** Get a writable flat scalar span over the dependent column at index:
+    each element contributes numComponentsPerElement() consecutive scalars.
+    No data are copied.
+
+    \throws EmptyTable If the table is empty.
+    \throws ColumnIndexOutOfRange If index is out of range for number of
+                                  columns in the table.                       */
+    SimTK::ArrayView_<double> updDependentColumnScalarSpan(size_t index) {
+        static_assert(sizeof(ETY) % sizeof(double) == 0,
+                      "Template argument ETY must be a packed composite of "
+                      "scalars of type double.");
+        OPENSIM_THROW_IF(isEmpty(), EmptyTable);
+        OPENSIM_THROW_IF(isColumnIndexOutOfRange(index),
+                         ColumnIndexOutOfRange, index, 0,
+                         static_cast<size_t>(_depData.ncol() - 1));
+
+        double* first = reinterpret_cast<double*>(
+                &_depData.updElt(0, static_cast<int>(index)));
+        const size_t numScalars =
+                _depData.nrow() * (sizeof(ETY) / sizeof(double));
+        return SimTK::ArrayView_<double>(first, first + numScalars);
+    }
+
+    /// @}
+
+    /// @name Table concatenation.
+    /// These functions grow this table from another table of the same type
+    /// with one bulk storage operation instead of per-row/per-column appends
+    /// (which reallocate repeatedly), and consume the other table so large
+    /// intermediates in processing pipelines are not duplicated. The other
+    /// table is left empty of data (its labels and metadata are untouched).
+    /// @{
+
+    /** Append the rows of another table to this table. Column labels of the
+    two tables must match. If this table has no rows and no columns, the
+    other table's data, labels and metadata are adopted wholesale. Appended
+    rows are validated as if added through appendRow(), so derived-class
+    invariants (e.g. increasing times in TimeSeriesTable_) are enforced; on
+    validation failure this table is restored to its original size.
+
+    \throws InvalidArgument If the argument is this table itself, or if the
+                            column labels of the two tables do not match.
+    \throws InvalidRow If an appended row fails derived-class validation.     */
+    void concatenateRows(DataTable_&& that) {
+        OPENSIM_THROW_IF(this == &that,
+                         InvalidArgument,
+                         "Cannot concatenate a table to itself.");
+
+        if(that.getNumRows() == 0)
+            return;
+
+        if(getNumRows() == 0 && getNumColumns() == 0) {
+            *this = std::move(that);
+            return;
+        }
+
+        OPENSIM_THROW_IF(getColumnLabels() != that.getColumnLabels(),
+                         InvalidArgument,
+                         "Column labels of the two tables do not match.");
+
+        const int oldRows = _depData.nrow();
+        const int thatRows = that._depData.nrow();
+        const int numCols = that._depData.ncol();
+        if(oldRows == 0) {
+            _depData = std::move(that._depData);
+            _indData = std::move(that._indData);
+        } else {
+            _depData.resizeKeep(oldRows + thatRows, numCols);
+            _depData.updBlock(oldRows, 0, thatRows, numCols) = that._depData;
+            _indData.insert(_indData.end(),
+                            std::make_move_iterator(that._indData.begin()),
+                            std::make_move_iterator(that._indData.end()));
+        }
+        that._indData.clear();
+        that._depData.resize(0, numCols);
+
+        try {
+            for(int r = oldRows; r < _depData.nrow(); ++r)
+                validateRow(static_cast<size_t>(r),
+                            _indData[r],
+                            _depData.row(r));
+        } catch(...) {
+            _indData.erase(_indData.begin() + oldRows, _indData.end());
+            _depData.resizeKeep(oldRows, numCols);
+            throw;
+        }
+    }
+
+    /** Append the columns of another table to this table. The independent
+    columns of the two tables must match exactly.
+
+    \throws InvalidArgument If the argument is this table itself, or if the
+                            independent columns of the two tables do not
+                            match.
+    \throws InvalidColumnLabel If the combined column labels are invalid.     */
+    void concatenateColumns(DataTable_&& that) {
+        OPENSIM_THROW_IF(this == &that,
+                         InvalidArgument,
+                         "Cannot concatenate a table to itself.");
+
+        if(that.getNumColumns() == 0)
+            return;
+
+        OPENSIM_THROW_IF(_indData != that._indData,
+                         InvalidArgument,
+                         "Independent columns of the two tables do not "
+                         "match.");
+
+        auto labels = getColumnLabels();
+        const auto thatLabels = that.getColumnLabels();
+        labels.insert(labels.end(), thatLabels.cbegin(), thatLabels.cend());
+        setColumnLabels(labels);
+
+        const int oldCols = _depData.ncol();
+        const int thatCols = that._depData.ncol();
+        _depData.resizeKeep(static_cast<int>(_indData.size()),
+                            oldCols + thatCols);
+        _depData.updBlock(0, oldCols, _depData.nrow(), thatCols) =
+                that._depData;
+        that._depData.resize(that._depData.nrow(), 0);
+    }
+
+    /// @}
+
     /** Get a string representation of the table, including the key-value pairs
     in the table metadata. Table metadata will be of the form:
     \code
@@ -174,10 +174,14 @@ private:
                                const SimTK::Vec<M>& elem,
                                const unsigned& prec) const;
       
-    /** Trim string -- remove specified leading and trailing characters from 
+    /** Trim string -- remove specified leading and trailing characters from
     string. Trims out whitespace by default.                                  */
     static std::string trim(const std::string& str, const char& ch = ' ');
-    
+
+protected:
+    // The delimiters and header keywords are shared with STOStreamWriter_,
+    // which emits the same on-disk format one row at a time.
+
     /** Delimiters used for reading.                                          */
     const std::string _delimitersRead;
     /** Delimiter used for writing. Separates elements from each other.       */
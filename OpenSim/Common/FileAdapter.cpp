@@ -2,6 +2,10 @@
 #include <OpenSim/Common/IO.h>
 #include "STOFileAdapter.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 namespace OpenSim {
 
 std::shared_ptr<DataAdapter>
@@ -90,4 +94,69 @@ FileAdapter::createAdapterFromExtension(const std::string& fileName) {
         dataAdapter = createAdapter(extension);
     return dataAdapter;
 }
+
+void
+FileAdapter::readFiles(const std::vector<std::string>& fileNames,
+                       const std::function<void(const std::string&,
+                                                const OutputTables&)>&
+                               onFileRead,
+                       unsigned numThreads) {
+    if(fileNames.empty())
+        return;
+
+    if(numThreads == 0) {
+        numThreads = std::thread::hardware_concurrency();
+        if(numThreads == 0)
+            numThreads = 1;
+    }
+    if(numThreads > fileNames.size())
+        numThreads = static_cast<unsigned>(fileNames.size());
+
+    // Workers claim files from a shared counter so threads that draw small
+    // files keep working while others are still parsing large ones.
+    std::atomic<size_t> nextFile{0};
+    // Serializes delivery to the callback and capture of the first error.
+    std::mutex deliveryMutex{};
+    std::exception_ptr firstError{};
+
+    auto worker = [&]() {
+        while(true) {
+            const size_t i = nextFile++;
+            if(i >= fileNames.size())
+                break;
+            try {
+                auto adapter = createAdapterFromExtension(fileNames[i]);
+                const auto tables = adapter->read(fileNames[i]);
+                std::lock_guard<std::mutex> lock{deliveryMutex};
+                onFileRead(fileNames[i], tables);
+            } catch(...) {
+                std::lock_guard<std::mutex> lock{deliveryMutex};
+                if(!firstError)
+                    firstError = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    for(unsigned i = 0; i < numThreads; ++i)
+        threads.emplace_back(worker);
+    for(auto& thread : threads)
+        thread.join();
+
+    if(firstError)
+        std::rethrow_exception(firstError);
+}
+
+std::map<std::string, DataAdapter::OutputTables>
+FileAdapter::readFiles(const std::vector<std::string>& fileNames,
+                       unsigned numThreads) {
+    std::map<std::string, OutputTables> results{};
+    readFiles(fileNames,
+              [&results](const std::string& fileName,
+                         const OutputTables& tables) {
+                  results[fileName] = tables;
+              },
+              numThreads);
+    return results;
+}
 } // namespace OpenSim
@@ -28,6 +28,7 @@
 */
 #include "DataAdapter.h"
 
+#include <functional>
 #include <vector>
 
 namespace OpenSim {
@@ -214,9 +215,33 @@ public:
     static std::vector<std::string> tokenize(const std::string& str, 
                                       const std::string& delims);
     /** Create a concerte FileAdapter based on the extension of the passed in file and return it.
-     This serves as a Factory of FileAdapters so clients don't need to know specific concrete 
+     This serves as a Factory of FileAdapters so clients don't need to know specific concrete
      subclasses, as long as the generic base class read interface is used */
     static std::shared_ptr<DataAdapter> createAdapterFromExtension(const std::string& fileName);
+
+    /** Read a batch of data files concurrently. The files may be of mixed
+    formats; each is read by the adapter registered for its extension, as if
+    by createAdapterFromExtension(fileName)->read(fileName). Files are
+    distributed over numThreads worker threads (pass 0, the default, to use
+    one thread per hardware core), and onFileRead is invoked with the file
+    name and its tables as each file completes. Invocations of onFileRead are
+    serialized, so the callback need not be thread-safe; do not perform
+    heavy work in it, as it blocks delivery of other files. If reading any
+    file throws, the remaining files are still read (and delivered), and the
+    first error is rethrown once all worker threads have finished.           */
+    static void readFiles(const std::vector<std::string>& fileNames,
+                          const std::function<void(const std::string&,
+                                                   const OutputTables&)>&
+                                  onFileRead,
+                          unsigned numThreads = 0);
+
+    /** Read a batch of data files concurrently, collecting the result into a
+    map from file name to the tables read from that file. See the callback
+    overload for the threading and error semantics; if reading any file
+    throws, the first error is rethrown and no results are returned.          */
+    static std::map<std::string, OutputTables>
+    readFiles(const std::vector<std::string>& fileNames,
+              unsigned numThreads = 0);
 };
 
 } // OpenSim namespace
@@ -27,6 +27,11 @@
 
 // INCLUDES
 #include "FunctionSet.h"
+#include "Constant.h"
+#include "GCVSpline.h"
+#include "GCVSplineSet.h"
+#include "PiecewiseConstantFunction.h"
+#include "PiecewiseLinearFunction.h"
 
 
 
@@ -140,17 +145,120 @@ evaluate(Array<double> &rValues,int aDerivOrder,double aX) const
     int size = getSize();
     rValues.setSize(size);
 
+    // The argument and derivative-component vectors are the same for every
+    // function; build them once rather than once per function.
+    SimTK::Vector arg(1, aX);
+    std::vector<int> derivComponents(aDerivOrder, 0);
+
     int i;
     for(i=0;i<size;i++) {
         Function& func = get(i);
         if (aDerivOrder==0)
-            rValues[i] = func.calcValue(SimTK::Vector(1,aX));
-        else {
-            std::vector<int> derivComponents;
-            for(int j=0; j<aDerivOrder; j++)
-                derivComponents.push_back(0);
-            rValues[i] = func.calcDerivative(derivComponents, SimTK::Vector(1,aX));
+            rValues[i] = func.calcValue(arg);
+        else
+            rValues[i] = func.calcDerivative(derivComponents, arg);
+    }
+}
+
+//=============================================================================
+// BULK EVALUATION
+//=============================================================================
+FunctionSetEvaluator::FunctionSetEvaluator(const FunctionSet& aFunctionSet) :
+    _splineSetEvaluator(NULL), _argument(1), _result(1)
+{
+    const int size = aFunctionSet.getSize();
+    OPENSIM_THROW_IF(size <= 0,
+                     Exception,
+                     "FunctionSetEvaluator: the function set is empty.");
 
+    _functions.reserve(size);
+    _kinds.reserve(size);
+    _constants.assign(size, 0.0);
+    bool allSplines = true;
+    for (int i = 0; i < size; ++i) {
+        const Function& func = aFunctionSet.get(i);
+        FunctionKind kind = GenericKind;
+        if (const Constant* constant = dynamic_cast<const Constant*>(&func)) {
+            kind = ConstantKind;
+            _constants[i] = constant->getValue();
+        } else if (dynamic_cast<const PiecewiseConstantFunction*>(&func)) {
+            kind = PiecewiseConstantKind;
+        } else if (dynamic_cast<const PiecewiseLinearFunction*>(&func)) {
+            kind = PiecewiseLinearKind;
+        } else if (dynamic_cast<const GCVSpline*>(&func)) {
+            kind = GCVSplineKind;
+        }
+        _functions.push_back(&func);
+        _kinds.push_back(kind);
+        if (kind != GCVSplineKind) allSplines = false;
+    }
+
+    // When every member is a GCVSpline the whole set may share its knots;
+    // if so, pack it for single-search evaluation. Splines with different
+    // knots fall back to the per-function path below.
+    if (allSplines) {
+        try {
+            _splineSetEvaluator = new GCVSplineSetEvaluator(aFunctionSet);
+        } catch (const Exception&) {
+            _splineSetEvaluator = NULL;
+        }
+    }
+}
+
+FunctionSetEvaluator::~FunctionSetEvaluator()
+{
+    delete _splineSetEvaluator;
+}
+
+void FunctionSetEvaluator::
+calcValues(int aDerivOrder, double aX, SimTK::Vector& rY) const
+{
+    OPENSIM_THROW_IF(aDerivOrder < 0,
+                     Exception,
+                     "Derivative order must be non-negative.");
+
+    if (_splineSetEvaluator != NULL) {
+        _splineSetEvaluator->calcValues(aDerivOrder, aX, rY);
+        return;
+    }
+
+    const int size = (int)_functions.size();
+    rY.resize(size);
+    _argument[0] = aX;
+    std::vector<int> derivComponents(aDerivOrder, 0);
+
+    for (int i = 0; i < size; ++i) {
+        switch (_kinds[i]) {
+        case ConstantKind:
+            rY[i] = (aDerivOrder == 0) ? _constants[i] : 0.0;
+            break;
+        case PiecewiseConstantKind: {
+            const PiecewiseConstantFunction* func =
+                static_cast<const PiecewiseConstantFunction*>(_functions[i]);
+            rY[i] = (aDerivOrder == 0) ? func->calcValue(_argument) : 0.0;
+            break;
+        }
+        case PiecewiseLinearKind: {
+            const PiecewiseLinearFunction* func =
+                static_cast<const PiecewiseLinearFunction*>(_functions[i]);
+            rY[i] = (aDerivOrder == 0)
+                    ? func->calcValue(_argument)
+                    : func->calcDerivative(derivComponents, _argument);
+            break;
+        }
+        case GCVSplineKind: {
+            const GCVSpline* spline =
+                static_cast<const GCVSpline*>(_functions[i]);
+            spline->calcValues(aDerivOrder, _argument, _result);
+            rY[i] = _result[0];
+            break;
+        }
+        case GenericKind:
+            rY[i] = (aDerivOrder == 0)
+                    ? _functions[i]->calcValue(_argument)
+                    : _functions[i]->calcDerivative(
+                              derivComponents, _argument);
+            break;
         }
     }
 }
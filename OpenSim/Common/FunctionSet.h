@@ -79,6 +79,81 @@ public:
 //=============================================================================
 };  // END class FunctionSet
 
+class GCVSplineSetEvaluator;
+
+/**
+ * Evaluates every function of a FunctionSet at a common abscissa in one
+ * call, with the per-function concrete-type dispatch done once at
+ * construction instead of once per evaluation.
+ *
+ * The evaluator snapshots the set on construction and classifies each
+ * member.  If every member is a GCVSpline on a shared knot sequence, the
+ * whole set is packed into a GCVSplineSetEvaluator and evaluated with a
+ * single knot search per query.  Otherwise each function is evaluated
+ * through a direct (non-virtual) call for the common concrete types
+ * (Constant, PiecewiseConstantFunction, PiecewiseLinearFunction,
+ * GCVSpline), falling back to the virtual interface for anything else,
+ * and the argument and derivative scratch vectors are reused across the
+ * whole set rather than rebuilt per function.
+ *
+ * Because the evaluator is a snapshot, it does not see changes made to the
+ * set after construction; construct a new evaluator after modifying the
+ * set.  An evaluator instance keeps mutable scratch state, so it is not
+ * thread-safe; use one evaluator per thread.
+ *
+ * @see FunctionSet
+ * @see GCVSplineSetEvaluator
+ */
+class OSIMCOMMON_API FunctionSetEvaluator {
+public:
+    /**
+     * Classify the functions of the given set for bulk evaluation.
+     *
+     * @throws Exception If the set is empty.
+     */
+    explicit FunctionSetEvaluator(const FunctionSet& aFunctionSet);
+    ~FunctionSetEvaluator();
+
+    FunctionSetEvaluator(const FunctionSetEvaluator&) = delete;
+    FunctionSetEvaluator& operator=(const FunctionSetEvaluator&) = delete;
+
+    /**
+     * Evaluate all functions, or one of their derivatives, at a single
+     * abscissa.
+     *
+     * @param aDerivOrder Order of the derivative to evaluate; 0 evaluates
+     *                    the functions themselves.
+     * @param aX Query abscissa.
+     * @param rY Resized to the number of functions and filled with the
+     *           results, in the order of the functions in the set.
+     */
+    void calcValues(int aDerivOrder, double aX, SimTK::Vector& rY) const;
+
+    int getNumFunctions() const { return (int)_functions.size(); }
+
+private:
+    enum FunctionKind {
+        ConstantKind,
+        PiecewiseConstantKind,
+        PiecewiseLinearKind,
+        GCVSplineKind,
+        GenericKind
+    };
+
+    /** The functions of the set, in set order.                               */
+    std::vector<const Function*> _functions;
+    /** Concrete type of each function, resolved at construction.             */
+    std::vector<FunctionKind> _kinds;
+    /** Cached values of the Constant members (unused slots are zero).        */
+    std::vector<double> _constants;
+    /** Shared-knot fast path; non-NULL when every member is a GCVSpline
+    on the same knots.                                                        */
+    GCVSplineSetEvaluator* _splineSetEvaluator;
+    /** Scratch: single-element argument vector reused across functions.      */
+    mutable SimTK::Vector _argument;
+    /** Scratch: single-element result vector for GCVSpline evaluation.       */
+    mutable SimTK::Vector _result;
+};  // END class FunctionSetEvaluator
 
 }; //namespace
 //=============================================================================
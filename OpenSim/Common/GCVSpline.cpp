@@ -30,6 +30,7 @@
 // C++ INCLUDES
 #include "GCVSpline.h"
 #include "Constant.h"
+#include "HotPathCounters.h"
 #include "gcvspl.h"
 #include "XYFunctionInterface.h"
 
@@ -580,6 +581,59 @@ addPoint(double aX, double aY)
     return i;
 }
 
+void GCVSpline::
+ensureFitted() const
+{
+    if (_function == NULL)
+        _function = createSimTKFunction();
+}
+
+//=============================================================================
+// EVALUATION
+//=============================================================================
+//_____________________________________________________________________________
+/**
+ * Evaluate the spline, or one of its derivatives, at a batch of abscissae.
+ * The knot interval found for one query seeds the search for the next one
+ * (see search() in gcvspl.c), so sorted queries avoid re-searching.
+ */
+void GCVSpline::
+calcValues(int aDerivOrder, const SimTK::Vector& aX, SimTK::Vector& rY) const
+{
+    OPENSIM_THROW_IF(aDerivOrder < 0,
+                     Exception,
+                     "Derivative order must be non-negative.");
+
+    rY.resize(aX.size());
+    if (aX.size() == 0)
+        return;
+
+    HotPathCounters::increment(HotPathCounters::SplineEvaluations, aX.size());
+
+    // The coefficients are synced with the fitted spline when the SimTK
+    // function is created; make sure that has happened. This lazy fit
+    // mutates the spline, so concurrent callers must ensureFitted() first
+    // (see the doc in GCVSpline.h).
+    ensureFitted();
+
+    const int n = getSize();
+    const double minX = _x[0];
+    const double maxX = _x[n-1];
+    // Knot interval hint, updated in place by splder().
+    int interval = 1;
+    // Workspace for the B-spline tableau (2*m values).
+    Array<double> work(0.0, 2*_halfOrder);
+    double* xValues = &_x[0];
+    double* coefficients = &_coefficients[0];
+    for (int i = 0; i < aX.size(); ++i) {
+        double t = aX[i];
+        if (t < minX) t = minX;
+        else if (t > maxX) t = maxX;
+        rY[i] = splder(aDerivOrder, _halfOrder, n, t,
+                       xValues, coefficients, &interval, &work[0]);
+    }
+}
+
 SimTK::Function* GCVSpline::createSimTKFunction() const {
     int degree = _halfOrder*2-1;
     Vector x(_x.getSize());
@@ -229,10 +229,44 @@ public:
     virtual bool deletePoints(const Array<int>& indices);
     virtual int addPoint(double aX, double aY);
     SimTK::Function* createSimTKFunction() const override;
+    /**
+     * Fit the spline now, rather than lazily on the first evaluation, and
+     * cache the result. Subsequent calls are no-ops until the function is
+     * reset (e.g., by scale() or addPoint()). Because the fit of one spline
+     * is independent of any other, this method may be called concurrently
+     * on different splines; it must not be called concurrently on the same
+     * spline.
+     */
+    void ensureFitted() const;
 
     //--------------------------------------------------------------------------
     // EVALUATION
     //--------------------------------------------------------------------------
+    /**
+     * Evaluate the spline, or one of its derivatives, at many abscissae in
+     * one call. This is much cheaper than calling calcValue() or
+     * calcDerivative() once per query point: the knot-interval search is
+     * seeded with the interval found for the previous query (GCVSPL's
+     * search() starts from a caller-provided guess), so monotone query
+     * sequences -- the common case when an integrator sweeps time forward
+     * -- locate their interval in amortized constant time, and the inner
+     * loop evaluates over plain arrays without virtual dispatch.
+     *
+     * Query points outside the abscissa range are clamped to the range.
+     * The interval hint is local to each call, so this method may be called
+     * concurrently on the same spline -- provided the spline has already
+     * been fitted. If it has not, the first call fits it lazily, which
+     * mutates the spline; call ensureFitted() before sharing a spline
+     * across threads.
+     *
+     * @param aDerivOrder Order of the derivative to evaluate; 0 evaluates
+     *                    the spline itself.
+     * @param aX Query abscissae. They need not be sorted, but sorted
+     *           queries evaluate fastest.
+     * @param rY Resized to aX.size() and filled with the results.
+     */
+    void calcValues(int aDerivOrder, const SimTK::Vector& aX,
+                    SimTK::Vector& rY) const;
 
 //=============================================================================
 };  // END class GCVSpline
@@ -24,6 +24,11 @@
 #include "GCVSplineSet.h"
 #include "GCVSpline.h"
 #include "Storage.h"
+#include "gcvspl.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 
 using namespace OpenSim;
@@ -68,6 +73,7 @@ GCVSplineSet::GCVSplineSet(const TimeSeriesTable& table,
         adoptAndAppend(new GCVSpline(degree, column.size(), time.data(),
                                      &column[0], label, errorVariance));
     }
+    fitSplines();
 }
 
 void GCVSplineSet::setNull() {
@@ -118,19 +124,64 @@ void GCVSplineSet::construct(int aDegree,
         // CONSTRUCT SPLINE
         //printf("%s\t",name);
         spline = new GCVSpline(aDegree,nData,times,data,name,aErrorVariance);
-        SimTK::Function* fp = spline->createSimTKFunction();
-        delete fp;  
 
         // ADD SPLINE
         adoptAndAppend(spline);
     }
     //printf("\n%d splines constructed.\n\n",i);
 
+    // FIT
+    // The splines used to be fit one at a time as they were constructed
+    // (and the fit was discarded after syncing the coefficients);
+    // fitting all of them here distributes the fits over threads and
+    // caches each result for the first evaluation.
+    fitSplines();
+
     // CLEANUP
     if(times!=NULL) delete[] times;
     if(data!=NULL) delete[] data;
 }
 
+void GCVSplineSet::fitSplines() {
+    const int numSplines = getSize();
+    if (numSplines <= 0) return;
+
+    std::atomic<int> nextSpline(0);
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        while (true) {
+            const int i = nextSpline++;
+            if (i >= numSplines) break;
+            try {
+                const GCVSpline* spline = getGCVSpline(i);
+                if (spline != NULL) spline->ensureFitted();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) firstError = std::current_exception();
+            }
+        }
+    };
+
+    unsigned numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 1;
+    if (numThreads > static_cast<unsigned>(numSplines))
+        numThreads = static_cast<unsigned>(numSplines);
+
+    if (numThreads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < numThreads; ++t)
+            threads.emplace_back(worker);
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    if (firstError) std::rethrow_exception(firstError);
+}
+
 GCVSpline* GCVSplineSet::getGCVSpline(int aIndex) const {
     GCVSpline& func = (GCVSpline&)get(aIndex);
     return(&func);
@@ -240,3 +291,109 @@ double GCVSplineSet::getMaxX() const
 
     return max;
 }
+
+//=============================================================================
+// SHARED-KNOT EVALUATION
+//=============================================================================
+GCVSplineSetEvaluator::GCVSplineSetEvaluator(const FunctionSet& aSplineSet) :
+    _halfOrder(0), _numPoints(0), _numSplines(aSplineSet.getSize()),
+    _interval(1)
+{
+    OPENSIM_THROW_IF(_numSplines <= 0,
+                     Exception,
+                     "GCVSplineSetEvaluator: the spline set is empty.");
+
+    for (int k = 0; k < _numSplines; ++k) {
+        GCVSpline* spline = dynamic_cast<GCVSpline*>(&aSplineSet.get(k));
+        OPENSIM_THROW_IF(spline == NULL,
+                         Exception,
+                         "GCVSplineSetEvaluator: function '" +
+                         aSplineSet.get(k).getName() +
+                         "' is not a GCVSpline.");
+
+        // Evaluating once makes sure the coefficients are in sync with the
+        // fitted spline (see GCVSpline::createSimTKFunction()).
+        SimTK::Vector probe(1, spline->getMinX()), tmp;
+        spline->calcValues(0, probe, tmp);
+
+        const Array<double>& x = spline->getX();
+        if (k == 0) {
+            _halfOrder = spline->getHalfOrder();
+            _numPoints = x.getSize();
+            _knots.assign(&x[0], &x[0] + _numPoints);
+            _packedCoefficients.assign(
+                    static_cast<size_t>(_numPoints)*_numSplines, 0.0);
+        } else {
+            bool sameKnots = (spline->getHalfOrder() == _halfOrder) &&
+                             (x.getSize() == _numPoints);
+            for (int j = 0; sameKnots && j < _numPoints; ++j)
+                sameKnots = (x[j] == _knots[j]);
+            OPENSIM_THROW_IF(!sameKnots,
+                             Exception,
+                             "GCVSplineSetEvaluator: spline '" +
+                             spline->getName() +
+                             "' does not share the knots and half order of "
+                             "the first spline in the set.");
+        }
+
+        const Array<double>& c = spline->getCoefficients();
+        for (int j = 0; j < _numPoints; ++j)
+            _packedCoefficients[static_cast<size_t>(j)*_numSplines + k] =
+                    c[j];
+    }
+
+    _unitCoefficients.assign(_numPoints, 0.0);
+    _tableau.assign(2*_halfOrder, 0.0);
+}
+
+void GCVSplineSetEvaluator::
+calcValues(int aDerivOrder, double aX, SimTK::Vector& rY) const
+{
+    OPENSIM_THROW_IF(aDerivOrder < 0,
+                     Exception,
+                     "Derivative order must be non-negative.");
+
+    rY.resize(_numSplines);
+    rY = 0.0;
+    // Derivatives of order 2m and higher are identically zero.
+    if (2*_halfOrder - aDerivOrder < 1)
+        return;
+
+    double t = aX;
+    if (t < _knots.front()) t = _knots.front();
+    else if (t > _knots.back()) t = _knots.back();
+
+    // One knot-interval search for the whole set; the hint is carried
+    // across calls, so monotone query sequences resolve immediately.
+    double* knots = const_cast<double*>(_knots.data());
+    search(_numPoints, knots, t, &_interval);
+
+    // The value of a spline is linear in its coefficients and at most 2m of
+    // them are active on any interval (see splder()); extract the basis
+    // weight of each active coefficient by evaluating with a unit
+    // coefficient vector.
+    const int jmin =
+            (_interval - _halfOrder > 0) ? _interval - _halfOrder : 0;
+    const int jmaxCandidate = _interval + _halfOrder - 1;
+    const int jmax = (jmaxCandidate < _numPoints - 1) ? jmaxCandidate
+                                                      : _numPoints - 1;
+    double weights[8]; // at most 2m active, and the half order m is <= 4
+    for (int j = jmin; j <= jmax; ++j) {
+        _unitCoefficients[j] = 1.0;
+        int interval = _interval;
+        weights[j - jmin] = splder(aDerivOrder, _halfOrder, _numPoints, t,
+                                   knots, &_unitCoefficients[0],
+                                   &interval, &_tableau[0]);
+        _unitCoefficients[j] = 0.0;
+    }
+
+    // Accumulate all splines at once, streaming the packed coefficients.
+    double* y = &rY[0];
+    for (int j = jmin; j <= jmax; ++j) {
+        const double w = weights[j - jmin];
+        const double* coefficients =
+                &_packedCoefficients[static_cast<size_t>(j)*_numSplines];
+        for (int k = 0; k < _numSplines; ++k)
+            y[k] += w*coefficients[k];
+    }
+}
@@ -125,6 +125,17 @@ private:
      */
     void construct(int aDegree,const Storage *aStore,double aErrorVariance);
 
+    /**
+     * Fit all splines in the set, distributing the per-column generalized
+     * cross-validation solves over hardware threads.  The fits are
+     * independent of one another, so each worker claims the next unfitted
+     * column and fits it; the first error raised by any fit is rethrown
+     * once all workers have finished.  Fitting eagerly here (rather than
+     * lazily on each spline's first evaluation) is what makes the
+     * parallelism possible.
+     */
+    void fitSplines();
+
 public:
     /**
      * Get the function at a specified index.
@@ -156,6 +167,72 @@ public:
 
 };  // END class GCVSplineSet
 
+/**
+ * Evaluates every spline of a GCVSplineSet at a common abscissa in one call,
+ * exploiting the fact that splines fit from the columns of one Storage or
+ * TimeSeriesTable all share the same knots (times).
+ *
+ * The evaluator snapshots the set on construction: it verifies that all
+ * splines share identical knots and half order, and packs their coefficients
+ * into a single basis-major array (all splines' coefficient j are adjacent).
+ * Evaluation then performs the knot-interval search once, computes the 2m
+ * basis weights once, and accumulates every spline's value by streaming
+ * through the packed coefficients contiguously -- instead of N independent
+ * searches and N strided tableau evaluations.
+ *
+ * Because the evaluator is a snapshot, it does not see changes made to the
+ * set after construction; construct a new evaluator after modifying the set.
+ * The knot-interval hint is kept between calls (queries from an integrator
+ * sweeping time forward hit it), which makes an evaluator instance not
+ * thread-safe; use one evaluator per thread.
+ *
+ * @see GCVSplineSet
+ * @see GCVSpline
+ */
+class OSIMCOMMON_API GCVSplineSetEvaluator {
+public:
+    /**
+     * Pack the splines of the given set for shared-knot evaluation.  Any
+     * FunctionSet whose members are all GCVSpline%s qualifies, not just a
+     * GCVSplineSet.
+     *
+     * @throws Exception If the set is empty, if a member of the set is not
+     * a GCVSpline, or if the splines do not all share the same knots and
+     * half order.
+     */
+    explicit GCVSplineSetEvaluator(const FunctionSet& aSplineSet);
+
+    /**
+     * Evaluate all splines, or one of their derivatives, at a single
+     * abscissa. Query points outside the knot range are clamped to the
+     * range.
+     *
+     * @param aDerivOrder Order of the derivative to evaluate; 0 evaluates
+     *                    the splines themselves.
+     * @param aX Query abscissa.
+     * @param rY Resized to the number of splines and filled with the
+     *           results, in the order of the splines in the set.
+     */
+    void calcValues(int aDerivOrder, double aX, SimTK::Vector& rY) const;
+
+    int getNumSplines() const { return _numSplines; }
+
+private:
+    int _halfOrder;
+    int _numPoints;
+    int _numSplines;
+    /** The knots shared by all splines in the set.                           */
+    std::vector<double> _knots;
+    /** Coefficient j of spline k at [j*_numSplines + k].                     */
+    std::vector<double> _packedCoefficients;
+    /** Knot interval hint carried across calls.                              */
+    mutable int _interval;
+    /** Scratch: all-zero coefficient vector used to extract basis weights.   */
+    mutable std::vector<double> _unitCoefficients;
+    /** Scratch: workspace for the B-spline evaluation tableau.               */
+    mutable std::vector<double> _tableau;
+};  // END class GCVSplineSetEvaluator
+
 }; //namespace
 
 #endif // OPENSIM_GCV_SPLINESET_H_
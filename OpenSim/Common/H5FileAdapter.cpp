@@ -0,0 +1,472 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  H5FileAdapter.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "H5FileAdapter.h"
+
+#ifdef WITH_HDF5
+
+#include <hdf5.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace OpenSim {
+
+namespace {
+
+const char* theTimeDataset = "time";
+const char* theDataDataset = "data";
+const char* theLabelsAttribute = "columnLabels";
+const unsigned theDeflateLevel = 4;
+
+// Closes an HDF5 identifier when it goes out of scope.
+class H5Guard {
+public:
+    H5Guard(hid_t id, herr_t (*closer)(hid_t)) : _id{id}, _closer{closer} {}
+    H5Guard(const H5Guard&)            = delete;
+    H5Guard& operator=(const H5Guard&) = delete;
+    ~H5Guard() {
+        if(_id >= 0)
+            _closer(_id);
+    }
+    hid_t get() const { return _id; }
+
+private:
+    hid_t _id;
+    herr_t (*_closer)(hid_t);
+};
+
+void throwIfFailed(hid_t id,
+                   const std::string& fileName,
+                   const std::string& what) {
+    OPENSIM_THROW_IF(id < 0,
+                     IOError,
+                     "Error accessing file '" + fileName + "': " + what + ".");
+}
+
+// HDF5 prints its error stack to stderr by default; exceptions carry the
+// failure instead.
+void suppressErrorPrinting() {
+    static const bool suppressed = []() {
+        H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+        return true;
+    }();
+    (void)suppressed;
+}
+
+hid_t makeVariableStringType() {
+    const hid_t type = H5Tcopy(H5T_C_S1);
+    H5Tset_size(type, H5T_VARIABLE);
+    H5Tset_cset(type, H5T_CSET_UTF8);
+    return type;
+}
+
+void writeStringAttribute(hid_t location,
+                          const std::string& name,
+                          const std::string& value,
+                          const std::string& fileName) {
+    H5Guard type{makeVariableStringType(), H5Tclose};
+    H5Guard space{H5Screate(H5S_SCALAR), H5Sclose};
+    H5Guard attribute{H5Acreate2(location,
+                                 name.c_str(),
+                                 type.get(),
+                                 space.get(),
+                                 H5P_DEFAULT,
+                                 H5P_DEFAULT),
+                      H5Aclose};
+    throwIfFailed(attribute.get(), fileName,
+                  "cannot create attribute '" + name + "'");
+    const char* pointer = value.c_str();
+    throwIfFailed(H5Awrite(attribute.get(), type.get(), &pointer),
+                  fileName,
+                  "cannot write attribute '" + name + "'");
+}
+
+void writeStringArrayAttribute(hid_t location,
+                               const std::string& name,
+                               const std::vector<std::string>& values,
+                               const std::string& fileName) {
+    H5Guard type{makeVariableStringType(), H5Tclose};
+    const hsize_t dims[1] = {values.size()};
+    H5Guard space{H5Screate_simple(1, dims, nullptr), H5Sclose};
+    H5Guard attribute{H5Acreate2(location,
+                                 name.c_str(),
+                                 type.get(),
+                                 space.get(),
+                                 H5P_DEFAULT,
+                                 H5P_DEFAULT),
+                      H5Aclose};
+    throwIfFailed(attribute.get(), fileName,
+                  "cannot create attribute '" + name + "'");
+    std::vector<const char*> pointers{};
+    for(const auto& value : values)
+        pointers.push_back(value.c_str());
+    throwIfFailed(H5Awrite(attribute.get(), type.get(), pointers.data()),
+                  fileName,
+                  "cannot write attribute '" + name + "'");
+}
+
+std::string readStringAttribute(hid_t attribute, const std::string& fileName) {
+    H5Guard type{makeVariableStringType(), H5Tclose};
+    char* pointer{};
+    throwIfFailed(H5Aread(attribute, type.get(), &pointer),
+                  fileName,
+                  "cannot read string attribute");
+    std::string value{pointer == nullptr ? "" : pointer};
+    H5free_memory(pointer);
+    return value;
+}
+
+std::vector<std::string> readStringArrayAttribute(
+        hid_t attribute,
+        const std::string& fileName) {
+    H5Guard type{makeVariableStringType(), H5Tclose};
+    H5Guard space{H5Aget_space(attribute), H5Sclose};
+    hsize_t numValues{};
+    H5Sget_simple_extent_dims(space.get(), &numValues, nullptr);
+    std::vector<char*> pointers(static_cast<size_t>(numValues), nullptr);
+    if(numValues > 0)
+        throwIfFailed(H5Aread(attribute, type.get(), pointers.data()),
+                      fileName,
+                      "cannot read string-array attribute");
+    std::vector<std::string> values{};
+    for(char* pointer : pointers) {
+        values.emplace_back(pointer == nullptr ? "" : pointer);
+        H5free_memory(pointer);
+    }
+    return values;
+}
+
+// Creates a chunked, deflate-compressed double dataset and writes buffer
+// into it. For an empty table (numRows == 0) the dataset is contiguous,
+// since HDF5 chunks cannot be empty.
+void writeDoubleDataset(hid_t group,
+                        const std::string& name,
+                        const std::vector<hsize_t>& dims,
+                        unsigned rowsPerChunk,
+                        const double* buffer,
+                        const std::string& fileName) {
+    H5Guard space{H5Screate_simple(static_cast<int>(dims.size()),
+                                   dims.data(),
+                                   nullptr),
+                  H5Sclose};
+    H5Guard properties{H5Pcreate(H5P_DATASET_CREATE), H5Pclose};
+    if(dims[0] > 0) {
+        std::vector<hsize_t> chunkDims{dims};
+        chunkDims[0] = std::min<hsize_t>(rowsPerChunk, dims[0]);
+        H5Pset_chunk(properties.get(),
+                     static_cast<int>(chunkDims.size()),
+                     chunkDims.data());
+        H5Pset_deflate(properties.get(), theDeflateLevel);
+    }
+    H5Guard dataset{H5Dcreate2(group,
+                               name.c_str(),
+                               H5T_NATIVE_DOUBLE,
+                               space.get(),
+                               H5P_DEFAULT,
+                               properties.get(),
+                               H5P_DEFAULT),
+                    H5Dclose};
+    throwIfFailed(dataset.get(), fileName,
+                  "cannot create dataset '" + name + "'");
+    if(dims[0] > 0)
+        throwIfFailed(H5Dwrite(dataset.get(),
+                               H5T_NATIVE_DOUBLE,
+                               H5S_ALL,
+                               H5S_ALL,
+                               H5P_DEFAULT,
+                               buffer),
+                      fileName,
+                      "cannot write dataset '" + name + "'");
+}
+
+} // anonymous namespace
+
+H5FileAdapter*
+H5FileAdapter::clone() const {
+    return new H5FileAdapter{*this};
+}
+
+const std::string
+H5FileAdapter::tableString() {
+    return "table";
+}
+
+void
+H5FileAdapter::write(const TimeSeriesTable& table,
+                     const std::string& fileName) {
+    InputTables tables{};
+    tables.emplace(tableString(), &table);
+    H5FileAdapter adapter{};
+    adapter.extendWrite(tables, fileName);
+}
+
+std::vector<std::string>
+H5FileAdapter::getTableNames(const std::string& fileName) {
+    suppressErrorPrinting();
+    H5Guard file{H5Fopen(fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT),
+                 H5Fclose};
+    throwIfFailed(file.get(), fileName, "cannot open file");
+
+    H5G_info_t groupInfo{};
+    throwIfFailed(H5Gget_info(file.get(), &groupInfo),
+                  fileName,
+                  "cannot list tables");
+    std::vector<std::string> names{};
+    for(hsize_t i = 0; i < groupInfo.nlinks; ++i) {
+        const ssize_t length = H5Lget_name_by_idx(file.get(), ".",
+                H5_INDEX_NAME, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT);
+        std::string name(static_cast<size_t>(length), '\0');
+        H5Lget_name_by_idx(file.get(), ".",
+                H5_INDEX_NAME, H5_ITER_INC, i, &name[0],
+                static_cast<size_t>(length) + 1, H5P_DEFAULT);
+        names.push_back(name);
+    }
+    return names;
+}
+
+TimeSeriesTable
+H5FileAdapter::readTable(const std::string& fileName,
+                         const std::string& tableName,
+                         const std::vector<std::string>& columns) {
+    suppressErrorPrinting();
+    H5Guard file{H5Fopen(fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT),
+                 H5Fclose};
+    throwIfFailed(file.get(), fileName, "cannot open file");
+
+    OPENSIM_THROW_IF(H5Lexists(file.get(), tableName.c_str(), H5P_DEFAULT)
+                             <= 0,
+                     KeyNotFound,
+                     tableName);
+    H5Guard group{H5Gopen2(file.get(), tableName.c_str(), H5P_DEFAULT),
+                  H5Gclose};
+    throwIfFailed(group.get(), fileName,
+                  "cannot open table '" + tableName + "'");
+
+    H5Guard data{H5Dopen2(group.get(), theDataDataset, H5P_DEFAULT),
+                 H5Dclose};
+    throwIfFailed(data.get(), fileName,
+                  "table '" + tableName + "' has no '" + theDataDataset +
+                          "' dataset");
+    H5Guard fileSpace{H5Dget_space(data.get()), H5Sclose};
+    hsize_t dims[2] = {0, 0};
+    H5Sget_simple_extent_dims(fileSpace.get(), dims, nullptr);
+    const size_t numRows = static_cast<size_t>(dims[0]);
+    const size_t numCols = static_cast<size_t>(dims[1]);
+
+    std::vector<std::string> labels{};
+    if(H5Aexists(data.get(), theLabelsAttribute) > 0) {
+        H5Guard attribute{H5Aopen(data.get(), theLabelsAttribute, H5P_DEFAULT),
+                          H5Aclose};
+        labels = readStringArrayAttribute(attribute.get(), fileName);
+    }
+
+    // Map the requested labels (or, by default, every column in file order)
+    // to column indices.
+    std::vector<size_t> selected{};
+    std::vector<std::string> selectedLabels{};
+    if(columns.empty()) {
+        for(size_t i = 0; i < numCols; ++i)
+            selected.push_back(i);
+        selectedLabels = labels;
+    } else {
+        for(const auto& label : columns) {
+            const auto iter = std::find(labels.cbegin(), labels.cend(), label);
+            OPENSIM_THROW_IF(iter == labels.cend(),
+                             KeyNotFound,
+                             label);
+            selected.push_back(
+                    static_cast<size_t>(iter - labels.cbegin()));
+            selectedLabels.push_back(label);
+        }
+    }
+
+    TimeSeriesTable table{};
+    if(numRows == 0) {
+        table.setColumnLabels(selectedLabels);
+    } else {
+        std::vector<double> times(numRows);
+        {
+            H5Guard time{H5Dopen2(group.get(), theTimeDataset, H5P_DEFAULT),
+                         H5Dclose};
+            throwIfFailed(time.get(), fileName,
+                          "table '" + tableName + "' has no '" +
+                                  theTimeDataset + "' dataset");
+            throwIfFailed(H5Dread(time.get(),
+                                  H5T_NATIVE_DOUBLE,
+                                  H5S_ALL,
+                                  H5S_ALL,
+                                  H5P_DEFAULT,
+                                  times.data()),
+                          fileName,
+                          "cannot read the time column");
+        }
+
+        // Read one column at a time through a hyperslab, so unselected
+        // columns are never fetched.
+        SimTK::Matrix_<double> depData{static_cast<int>(numRows),
+                                       static_cast<int>(selected.size())};
+        std::vector<double> columnValues(numRows);
+        const hsize_t columnCount[2] = {dims[0], 1};
+        H5Guard memorySpace{H5Screate_simple(1, &dims[0], nullptr), H5Sclose};
+        for(size_t j = 0; j < selected.size(); ++j) {
+            const hsize_t start[2] = {0, static_cast<hsize_t>(selected[j])};
+            H5Sselect_hyperslab(fileSpace.get(), H5S_SELECT_SET,
+                                start, nullptr, columnCount, nullptr);
+            throwIfFailed(H5Dread(data.get(),
+                                  H5T_NATIVE_DOUBLE,
+                                  memorySpace.get(),
+                                  fileSpace.get(),
+                                  H5P_DEFAULT,
+                                  columnValues.data()),
+                          fileName,
+                          "cannot read column '" + selectedLabels[j] + "'");
+            for(size_t r = 0; r < numRows; ++r)
+                depData.updElt(static_cast<int>(r), static_cast<int>(j)) =
+                        columnValues[r];
+        }
+
+        table = TimeSeriesTable{times, depData, selectedLabels};
+    }
+
+    // Every attribute of the group is a string metadata entry.
+    H5O_info_t objectInfo{};
+    H5Oget_info(group.get(), &objectInfo);
+    for(hsize_t i = 0; i < objectInfo.num_attrs; ++i) {
+        H5Guard attribute{H5Aopen_by_idx(group.get(), ".",
+                                         H5_INDEX_NAME, H5_ITER_INC, i,
+                                         H5P_DEFAULT, H5P_DEFAULT),
+                          H5Aclose};
+        const ssize_t length =
+                H5Aget_name(attribute.get(), 0, nullptr);
+        std::string key(static_cast<size_t>(length), '\0');
+        H5Aget_name(attribute.get(), static_cast<size_t>(length) + 1,
+                    &key[0]);
+        table.updTableMetaData().setValueForKey(
+                key, readStringAttribute(attribute.get(), fileName));
+    }
+
+    return table;
+}
+
+void
+H5FileAdapter::setRowsPerChunk(unsigned rowsPerChunk) {
+    OPENSIM_THROW_IF(rowsPerChunk == 0,
+                     InvalidArgument,
+                     "Rows per chunk must be at least 1.");
+    _rowsPerChunk = rowsPerChunk;
+}
+
+unsigned
+H5FileAdapter::getRowsPerChunk() const {
+    return _rowsPerChunk;
+}
+
+DataAdapter::OutputTables
+H5FileAdapter::extendRead(const std::string& fileName) const {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+
+    OutputTables output_tables{};
+    for(const auto& name : getTableNames(fileName))
+        output_tables.emplace(name,
+                              std::make_shared<TimeSeriesTable>(
+                                      readTable(fileName, name)));
+    return output_tables;
+}
+
+void
+H5FileAdapter::extendWrite(const InputTables& absTables,
+                           const std::string& fileName) const {
+    OPENSIM_THROW_IF(absTables.empty(),
+                     NoTableFound);
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+
+    suppressErrorPrinting();
+    H5Guard file{H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC,
+                           H5P_DEFAULT, H5P_DEFAULT),
+                 H5Fclose};
+    throwIfFailed(file.get(), fileName, "cannot create file");
+
+    for(const auto& keyTable : absTables) {
+        const auto* table =
+                dynamic_cast<const TimeSeriesTable*>(keyTable.second);
+        OPENSIM_THROW_IF(table == nullptr,
+                         IncorrectTableType);
+
+        H5Guard group{H5Gcreate2(file.get(), keyTable.first.c_str(),
+                                 H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT),
+                      H5Gclose};
+        throwIfFailed(group.get(), fileName,
+                      "cannot create table '" + keyTable.first + "'");
+
+        const size_t numRows = table->getNumRows();
+        const size_t numCols = table->getNumColumns();
+
+        writeDoubleDataset(group.get(),
+                           theTimeDataset,
+                           {static_cast<hsize_t>(numRows)},
+                           _rowsPerChunk,
+                           table->getIndependentColumn().data(),
+                           fileName);
+
+        // HDF5 datasets are row-major; gather the table's column-major
+        // matrix into one row-major buffer.
+        std::vector<double> buffer(numRows * numCols);
+        const auto& matrix = table->getMatrix();
+        for(size_t r = 0; r < numRows; ++r)
+            for(size_t c = 0; c < numCols; ++c)
+                buffer[r * numCols + c] =
+                        matrix(static_cast<int>(r), static_cast<int>(c));
+        writeDoubleDataset(group.get(),
+                           theDataDataset,
+                           {static_cast<hsize_t>(numRows),
+                            static_cast<hsize_t>(numCols)},
+                           _rowsPerChunk,
+                           buffer.data(),
+                           fileName);
+
+        {
+            H5Guard data{H5Dopen2(group.get(), theDataDataset, H5P_DEFAULT),
+                         H5Dclose};
+            writeStringArrayAttribute(data.get(),
+                                      theLabelsAttribute,
+                                      table->getColumnLabels(),
+                                      fileName);
+        }
+
+        // Key-value metadata of the table. As with the .sto header, only
+        // string-valued entries are serialized.
+        const auto& metadata = table->getTableMetaData();
+        for(const auto& key : metadata.getKeys()) {
+            const auto* value = dynamic_cast<const SimTK::Value<std::string>*>(
+                    &metadata.getValueForKey(key));
+            if(value != nullptr)
+                writeStringAttribute(group.get(), key, value->get(),
+                                     fileName);
+        }
+    }
+}
+
+} // namespace OpenSim
+
+#endif // WITH_HDF5
@@ -0,0 +1,110 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  H5FileAdapter.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_H5_FILE_ADAPTER_H_
+#define OPENSIM_H5_FILE_ADAPTER_H_
+
+#if defined (WITH_HDF5)
+
+#include "FileAdapter.h"
+#include "TimeSeriesTable.h"
+
+namespace OpenSim {
+
+/** H5FileAdapter reads/writes HDF5 (.h5) files holding one or more
+TimeSeriesTable_<double>%s, so a whole run (states, controls, analysis
+outputs) can be bundled into one file instead of a directory of .sto
+files:
+
+ - Each table becomes an HDF5 group named by its key in the
+   InputTables/OutputTables containers. The group holds a 1-D "time"
+   dataset, a 2-D "data" dataset (rows x columns, chunked and
+   deflate-compressed), and the column labels as an attribute of "data".
+ - String-valued table metadata is stored as attributes of the group,
+   equivalent to the header of a .sto file.
+ - Reads support partial access: readTable() fetches one named table, and
+   optionally only some of its columns, without touching the rest of the
+   file.
+
+The adapter is only available when OpenSim is compiled with HDF5 support
+(CMake variable OPENSIM_WITH_HDF5). It is registered with extension "h5",
+so FileAdapter::writeFile() with a multi-table InputTables container and
+the TimeSeriesTable filename constructor (which reads the table named
+"table") both work with these files.                                        */
+class OSIMCOMMON_API H5FileAdapter : public FileAdapter {
+public:
+    H5FileAdapter()                                = default;
+    H5FileAdapter(const H5FileAdapter&)            = default;
+    H5FileAdapter(H5FileAdapter&&)                 = default;
+    H5FileAdapter& operator=(const H5FileAdapter&) = default;
+    H5FileAdapter& operator=(H5FileAdapter&&)      = default;
+    ~H5FileAdapter()                               = default;
+
+    H5FileAdapter* clone() const override;
+
+    /** Key under which a single table is stored by write() and expected by
+    the TimeSeriesTable filename constructor.                                */
+    static const std::string tableString();
+
+    /** Write a single table to an HDF5 file, under the group named by
+    tableString(). To bundle several tables into one file, use
+    FileAdapter::writeFile() with one InputTables entry per table.           */
+    static
+    void write(const TimeSeriesTable& table, const std::string& fileName);
+
+    /** Names of the tables (top-level groups) stored in an HDF5 file.       */
+    static
+    std::vector<std::string> getTableNames(const std::string& fileName);
+
+    /** Read one table from an HDF5 file. If columns is non-empty, only the
+    columns with the given labels are read (in the given order); the time
+    column is always read.
+
+    \throws KeyNotFound If tableName is not a group in the file, or a
+                        requested column label is not in the table.          */
+    static
+    TimeSeriesTable readTable(const std::string& fileName,
+                              const std::string& tableName = tableString(),
+                              const std::vector<std::string>& columns = {});
+
+    /** Set the number of rows per HDF5 chunk used by write(). Chunks are
+    the unit of compression and of partial reads.                            */
+    void setRowsPerChunk(unsigned rowsPerChunk);
+    unsigned getRowsPerChunk() const;
+
+protected:
+    /** Reads every table in the file; the keys of the returned container
+    are the group names.                                                     */
+    OutputTables extendRead(const std::string& fileName) const override;
+
+    /** Writes every entry of tables to one file, one group per entry.       */
+    void extendWrite(const InputTables& tables,
+                     const std::string& fileName) const override;
+
+private:
+    unsigned _rowsPerChunk{4096};
+};
+
+} // namespace OpenSim
+
+#endif // WITH_HDF5
+
+#endif // OPENSIM_H5_FILE_ADAPTER_H_
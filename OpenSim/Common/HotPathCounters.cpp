@@ -0,0 +1,128 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  HotPathCounters.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include "HotPathCounters.h"
+
+#include "Logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+using namespace OpenSim;
+
+namespace {
+
+std::atomic<bool> countersEnabled(false);
+std::atomic<unsigned long long> counts[HotPathCounters::NumCounters] = {};
+
+// Periodic snapshots: increment() bumps this ticker and checks the clock
+// only when the low bits roll over, so the common case stays one relaxed
+// atomic add. The interval comparison and the actual logging are serialized
+// by a mutex; concurrent callers that lose the race simply skip the check.
+std::atomic<unsigned long long> snapshotTicker(0);
+std::atomic<double> snapshotIntervalSeconds(0);
+
+std::mutex& getSnapshotMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::chrono::steady_clock::time_point& getLastSnapshotTime() {
+    static std::chrono::steady_clock::time_point last =
+            std::chrono::steady_clock::now();
+    return last;
+}
+
+const char* counterNames[HotPathCounters::NumCounters] = {
+    "path_recomputes",
+    "wrap_solves",
+    "spline_evaluations",
+    "state_copies",
+};
+
+} // namespace
+
+void HotPathCounters::setEnabled(bool enabled) {
+    // Restart the snapshot clock so the first periodic snapshot covers only
+    // time spent counting, not however long the process was idle before.
+    if (enabled && !countersEnabled.load()) {
+        std::lock_guard<std::mutex> lock(getSnapshotMutex());
+        getLastSnapshotTime() = std::chrono::steady_clock::now();
+    }
+    countersEnabled = enabled;
+}
+
+bool HotPathCounters::isEnabled() {
+    return countersEnabled.load(std::memory_order_relaxed);
+}
+
+void HotPathCounters::increment(Counter counter, unsigned long long count) {
+    if (!countersEnabled.load(std::memory_order_relaxed))
+        return;
+    counts[counter].fetch_add(count, std::memory_order_relaxed);
+
+    if ((snapshotTicker.fetch_add(1, std::memory_order_relaxed) & 0x3FF)
+            != 0x3FF)
+        return;
+    const double interval =
+            snapshotIntervalSeconds.load(std::memory_order_relaxed);
+    if (interval <= 0)
+        return;
+    std::unique_lock<std::mutex> lock(getSnapshotMutex(), std::try_to_lock);
+    if (!lock.owns_lock())
+        return;
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - getLastSnapshotTime();
+    if (elapsed.count() < interval)
+        return;
+    getLastSnapshotTime() = now;
+    logSnapshot();
+}
+
+unsigned long long HotPathCounters::getCount(Counter counter) {
+    return counts[counter].load(std::memory_order_relaxed);
+}
+
+const char* HotPathCounters::getCounterName(Counter counter) {
+    return counterNames[counter];
+}
+
+void HotPathCounters::resetCounts() {
+    for (int i = 0; i < NumCounters; ++i)
+        counts[i].store(0, std::memory_order_relaxed);
+}
+
+void HotPathCounters::logSnapshot() {
+    log_info("hotpath_counters {}={} {}={} {}={} {}={}",
+            counterNames[PathRecomputes], getCount(PathRecomputes),
+            counterNames[WrapSolves], getCount(WrapSolves),
+            counterNames[SplineEvaluations], getCount(SplineEvaluations),
+            counterNames[StateCopies], getCount(StateCopies));
+}
+
+void HotPathCounters::setLoggingInterval(double seconds) {
+    snapshotIntervalSeconds.store(seconds, std::memory_order_relaxed);
+}
+
+double HotPathCounters::getLoggingInterval() {
+    return snapshotIntervalSeconds.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,110 @@
+#ifndef OPENSIM_HOT_PATH_COUNTERS_H_
+#define OPENSIM_HOT_PATH_COUNTERS_H_
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  HotPathCounters.h                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+
+namespace OpenSim {
+
+/** Process-wide, increment-only counters for a small fixed set of hot-path
+events (path recomputations, wrap solves, spline evaluations, state copies).
+
+The intent is post-hoc diagnosis of misbehaving production runs: when
+counting is enabled, a snapshot of all counters is periodically written
+through the Logger as a single structured `key=value` record, so the counts
+are available in the run's logs without rerunning under a profiler or with
+debug logging.
+
+Counting is off by default and an increment on a disabled registry costs one
+relaxed atomic load. The counter set is a compile-time enum rather than a
+string-keyed map so that incrementing never hashes, locks, or allocates;
+call sites are sprinkled through code that runs millions of times per
+simulation. Unlike AllocationTracker, no special build configuration is
+required.
+
+Typical use:
+@code
+HotPathCounters::setLoggingInterval(10);  // snapshot every 10 s of activity
+HotPathCounters::setEnabled(true);
+// ... run ...
+HotPathCounters::logSnapshot();           // final counts
+HotPathCounters::setEnabled(false);
+@endcode */
+class OSIMCOMMON_API HotPathCounters {
+public:
+    /// This is a static singleton class: there is no way of constructing it.
+    HotPathCounters() = delete;
+
+    /** The counters in the registry. Each is incremented by the code that
+    does the corresponding work; see getCounterName() for the key under
+    which each appears in logged snapshots. */
+    enum Counter {
+        /** GeometryPath recomputed a path (cache misses only; revalidation
+        of an unchanged path does not count). */
+        PathRecomputes = 0,
+        /** A WrapObject ran its wrapping computation for a path segment. */
+        WrapSolves,
+        /** A spline (GCVSpline, SimmSpline, PiecewiseLinearFunction) was
+        evaluated; batch evaluations count each abscissa. */
+        SplineEvaluations,
+        /** A full SimTK::State was copied into a StatesTrajectory. */
+        StateCopies,
+        NumCounters
+    };
+
+    /** Turn counting on or off. Counting is process-wide and off by
+    default. Increments made while counting is off are discarded. */
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /** Add `count` to a counter. No-op unless counting is enabled. Called
+    from hot loops; cheap and thread-safe (relaxed atomics, no locks). */
+    static void increment(Counter counter, unsigned long long count = 1);
+
+    /** The value a counter has accumulated since the last resetCounts(). */
+    static unsigned long long getCount(Counter counter);
+
+    /** The key under which a counter is reported in logged snapshots,
+    e.g. "path_recomputes". */
+    static const char* getCounterName(Counter counter);
+
+    /** Reset all counters to zero. */
+    static void resetCounts();
+
+    /** Write all counters through the Logger, at Info level, as one line of
+    `key=value` pairs prefixed with "hotpath_counters". */
+    static void logSnapshot();
+
+    /** Automatically logSnapshot() roughly every `seconds` of wall-clock
+    time while counting is enabled. The elapsed time is checked from
+    increment() (at most every 1024th call, to keep increments cheap), so a
+    completely idle process writes no snapshots. A non-positive interval
+    (the default) disables periodic snapshots; logSnapshot() can still be
+    called directly. */
+    static void setLoggingInterval(double seconds);
+    static double getLoggingInterval();
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_HOT_PATH_COUNTERS_H_
@@ -30,6 +30,7 @@
 #include "IO.h"
 
 #include "Logger.h"
+#include <algorithm>
 #include <climits>
 #include <math.h>
 #include <string>
@@ -37,10 +38,15 @@
 #if defined(__linux__) || defined(__APPLE__)
     #include <sys/stat.h>
     #include <sys/types.h>
+    #include <dirent.h>
 #elif defined(_MSC_VER)
     #include <direct.h>
+    #include <sys/stat.h>
+    #include <windows.h>
 #else
     #include <unistd.h>
+    #include <sys/stat.h>
+    #include <dirent.h>
 #endif
 
 // PATH stuff from Kenny
@@ -58,11 +64,11 @@ using namespace OpenSim;
 using namespace std;
 
 // STATICS
-bool IO::_Scientific = false;
-bool IO::_GFormatForDoubleOutput = false;
-int IO::_Pad = 8;
-int IO::_Precision = 8;
-char IO::_DoubleFormat[] = "%16.8lf";
+thread_local bool IO::_Scientific = false;
+thread_local bool IO::_GFormatForDoubleOutput = false;
+thread_local int IO::_Pad = 8;
+thread_local int IO::_Precision = 8;
+thread_local char IO::_DoubleFormat[] = "%16.8lf";
 bool IO::_PrintOfflineDocuments = true;
 
 
@@ -250,9 +256,10 @@ GetPrecision()
 /**
  * Get the current output format for numbers of type double.
  *
- * The format is maintained as a static variable in class IO, so any
- * changes made to the output parameters in class IO will be seen globally
- * by all classes using this method.
+ * The format is maintained as a per-thread static variable in class IO, so
+ * any changes made to the output parameters in class IO will be seen by all
+ * classes using this method on the same thread; each thread starts from
+ * the default format.
  *
  * The returned output format will be of the form
  *
@@ -486,6 +493,63 @@ makeDir(const string &aDirName)
 #endif
 }
 //_____________________________________________________________________________
+/**
+ * Whether the path names an existing directory. Potentially platform
+ * dependent.
+ */
+bool IO::
+isDirectory(const string &aPath)
+{
+#if defined _MSC_VER
+    struct _stat status;
+    if (_stat(aPath.c_str(), &status) != 0)
+        return false;
+    return (status.st_mode & _S_IFDIR) != 0;
+#else
+    struct stat status;
+    if (stat(aPath.c_str(), &status) != 0)
+        return false;
+    return S_ISDIR(status.st_mode);
+#endif
+}
+//_____________________________________________________________________________
+/**
+ * List the names of the regular files directly inside a directory, sorted.
+ * Subdirectories are not listed and not entered. Potentially platform
+ * dependent.
+ */
+std::vector<std::string> IO::
+getFilesInDirectory(const string &aDirName)
+{
+    std::vector<std::string> files;
+#if defined _MSC_VER
+    WIN32_FIND_DATAA findData;
+    HANDLE find = FindFirstFileA((aDirName + "\\*").c_str(), &findData);
+    if (find == INVALID_HANDLE_VALUE)
+        return files;
+    do {
+        if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+            files.push_back(findData.cFileName);
+    } while (FindNextFileA(find, &findData));
+    FindClose(find);
+#else
+    DIR* dir = opendir(aDirName.c_str());
+    if (dir == NULL)
+        return files;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        const std::string name = entry->d_name;
+        if (name == "." || name == "..")
+            continue;
+        if (!isDirectory(aDirName + "/" + name))
+            files.push_back(name);
+    }
+    closedir(dir);
+#endif
+    std::sort(files.begin(), files.end());
+    return files;
+}
+//_____________________________________________________________________________
 /**
  * Change working directory. Potentially platform dependent.
   * @return int 0 on success, error condition otherwise
@@ -53,16 +53,19 @@ class OSIMCOMMON_API IO {
 //=============================================================================
 private:
     // NUMBER OUTPUT
+    // The number format is kept per-thread so tools that set their output
+    // precision inside run() can execute concurrently without racing on a
+    // shared format; every thread starts from the defaults.
     /** Specifies whether number output is in scientific or float format. */
-    static bool _Scientific;
+    static thread_local bool _Scientific;
     /** Specifies whether number output is in %g format or not. */
-    static bool _GFormatForDoubleOutput;
-    /** Specifies number of digits of padding in number output. */ 
-    static int _Pad;
+    static thread_local bool _GFormatForDoubleOutput;
+    /** Specifies number of digits of padding in number output. */
+    static thread_local int _Pad;
     /** Specifies the precision of number output. */
-    static int _Precision;
+    static thread_local int _Precision;
     /** The output format string. */
-    static char _DoubleFormat[256];
+    static thread_local char _DoubleFormat[256];
     /** Whether offline documents should also be printed when Object::print is called. */
     static bool _PrintOfflineDocuments;
 
@@ -107,6 +110,13 @@ public:
     static int makeDir(const std::string &aDirName);
     static int chDir(const std::string &aDirName);
     static std::string getCwd();
+    /** Whether the path names an existing directory. */
+    static bool isDirectory(const std::string& aPath);
+    /** Names (not paths) of the regular files directly inside a directory,
+        sorted; subdirectories are not listed and not entered. Returns an
+        empty vector if the directory cannot be read. */
+    static std::vector<std::string> getFilesInDirectory(
+            const std::string& aDirName);
     static std::string getParentDirectory(const std::string& fileName);
     static std::string GetFileNameFromURI(const std::string& aURI);
     static std::string formatText(const std::string& aComment,const std::string& leadingWhitespace,int width,const std::string& endlineTokenToInsert="\n");
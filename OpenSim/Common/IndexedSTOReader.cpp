@@ -0,0 +1,370 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  IndexedSTOReader.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "IndexedSTOReader.h"
+
+#include "DelimFileAdapter.h"
+#include "IO.h"
+
+#include <algorithm>
+#include <fstream>
+#include <regex>
+
+using namespace OpenSim;
+
+namespace {
+    // STO/MOT columns are separated by tabs or spaces.
+    const std::string delimiters{" \t"};
+
+    // True for lines containing only whitespace (e.g. a trailing newline).
+    bool isBlank(const std::string& line) {
+        return line.find_first_not_of(" \t") == std::string::npos;
+    }
+}
+
+IndexedSTOReader::IndexedSTOReader(const std::string& fileName,
+                                   size_t rowsPerChunk) :
+    _fileName{fileName},
+    _rowsPerChunk{rowsPerChunk},
+    _numRows{0},
+    _firstTime{SimTK::NaN},
+    _lastTime{SimTK::NaN} {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+    OPENSIM_THROW_IF(rowsPerChunk == 0,
+                     InvalidArgument,
+                     "rowsPerChunk must be greater than zero.");
+    buildIndex(rowsPerChunk);
+}
+
+const std::string&
+IndexedSTOReader::getFileName() const {
+    return _fileName;
+}
+
+const std::vector<std::string>&
+IndexedSTOReader::getColumnLabels() const {
+    return _columnLabels;
+}
+
+size_t
+IndexedSTOReader::getNumRows() const {
+    return _numRows;
+}
+
+double
+IndexedSTOReader::getFirstTime() const {
+    return _firstTime;
+}
+
+double
+IndexedSTOReader::getLastTime() const {
+    return _lastTime;
+}
+
+size_t
+IndexedSTOReader::getNumChunks() const {
+    return _chunks.size();
+}
+
+void
+IndexedSTOReader::buildIndex(size_t rowsPerChunk) {
+    // Open in binary mode so that stream offsets recorded here are byte
+    // offsets that seekg() can be handed back verbatim on all platforms;
+    // the stray '\r' of CRLF files is stripped manually as in
+    // DelimFileAdapter.
+    std::ifstream in_stream{_fileName, std::ios::binary};
+    OPENSIM_THROW_IF(!in_stream.good(),
+                     FileDoesNotExist,
+                     _fileName);
+
+    OPENSIM_THROW_IF(in_stream.peek() == std::ifstream::traits_type::eof(),
+                     FileIsEmpty,
+                     _fileName);
+
+    // Parse the header the same way DelimFileAdapter::extendRead() does:
+    // all the lines until "endheader" are header, with "key=value" lines
+    // collected as metadata.
+    std::regex endheader{R"([ \t]*endheader[ \t]*)"};
+    std::regex keyvalue{R"((.*)=(.*))"};
+    std::string header{};
+    std::string line{};
+    while(std::getline(in_stream, line)) {
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        if(std::regex_match(line, endheader))
+            break;
+
+        std::smatch matchRes{};
+        if(std::regex_match(line, matchRes, keyvalue)) {
+            auto key = matchRes[1].str();
+            auto value = matchRes[2].str();
+            IO::TrimWhitespace(key);
+            IO::TrimWhitespace(value);
+            if(!key.empty() && !value.empty()) {
+                if(key == "DataType") {
+                    // Only scalar tables can be windowed through this reader.
+                    OPENSIM_THROW_IF(value != "double",
+                                     DataTypeMismatch,
+                                     "double",
+                                     value);
+                } else if(key == "version" || key == "OpenSimVersion") {
+                    // Discard version numbers, as DelimFileAdapter does.
+                } else {
+                    _metaData.setValueForKey(key, value);
+                }
+                continue;
+            }
+        }
+
+        if(header.empty())
+            header = line;
+        else
+            header += "\n" + line;
+    }
+    _metaData.setValueForKey("header", header);
+
+    // Read the line containing column labels.
+    std::vector<std::string> columnLabels{};
+    while(columnLabels.empty() && in_stream.good()) {
+        columnLabels = FileAdapter::getNextLine(in_stream, delimiters);
+        IO::eraseEmptyElements(columnLabels);
+    }
+
+    OPENSIM_THROW_IF(columnLabels.empty(),
+                     Exception,
+                     "No column labels detected in file '" + _fileName + "'.");
+
+    // Column 0 is the time column; the time stamps are kept in the index
+    // rather than with the data labels.
+    OPENSIM_THROW_IF(columnLabels[0] != "time",
+                     UnexpectedColumnLabel,
+                     _fileName,
+                     "time",
+                     columnLabels[0]);
+    columnLabels.erase(columnLabels.begin());
+    _columnLabels = std::move(columnLabels);
+
+    // Sweep the data region once, recording the byte offset and time stamp
+    // of every rowsPerChunk-th row. Only the leading time token of those
+    // rows is parsed; the numeric columns are left untouched until a window
+    // is requested.
+    std::string lastDataLine{};
+    while(true) {
+        const auto offset = static_cast<long long>(in_stream.tellg());
+        if(!std::getline(in_stream, line))
+            break;
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if(isBlank(line))
+            continue;
+
+        if(_numRows % rowsPerChunk == 0) {
+            ChunkEntry entry;
+            entry.offset = offset;
+            entry.time   = std::stod(line);
+            OPENSIM_THROW_IF(!_chunks.empty() &&
+                             entry.time <= _chunks.back().time,
+                             Exception,
+                             "Time column of file '" + _fileName +
+                             "' is not strictly increasing.");
+            _chunks.push_back(entry);
+        }
+
+        lastDataLine = line;
+        ++_numRows;
+    }
+
+    OPENSIM_THROW_IF(_numRows == 0,
+                     Exception,
+                     "No data rows detected in file '" + _fileName + "'.");
+
+    _firstTime = _chunks.front().time;
+    _lastTime  = std::stod(lastDataLine);
+}
+
+TimeSeriesTable_<double>
+IndexedSTOReader::readTimeRange(double startTime,
+                                double endTime) const {
+    OPENSIM_THROW_IF(endTime < startTime,
+                     InvalidArgument,
+                     "endTime (" + std::to_string(endTime) + ") is less "
+                     "than startTime (" + std::to_string(startTime) + ").");
+
+    TimeSeriesTable_<double> table{};
+    table.setColumnLabels(_columnLabels);
+    table.updTableMetaData() = _metaData;
+
+    if(startTime > _lastTime || endTime < _firstTime)
+        return table;
+
+    std::ifstream in_stream{_fileName, std::ios::binary};
+    OPENSIM_THROW_IF(!in_stream.good(),
+                     FileDoesNotExist,
+                     _fileName);
+
+    // Seek to the last chunk that starts at or before startTime; rows
+    // preceding the window within that chunk are skipped below after
+    // parsing just their time token.
+    auto chunk = std::upper_bound(_chunks.begin(), _chunks.end(), startTime,
+        [](double time, const ChunkEntry& entry) {
+            return time < entry.time;
+        });
+    if(chunk != _chunks.begin())
+        --chunk;
+    in_stream.seekg(static_cast<std::streamoff>(chunk->offset));
+
+    const int ncol = static_cast<int>(_columnLabels.size());
+    SimTK::RowVector_<double> row(ncol);
+    std::string line{};
+    while(std::getline(in_stream, line)) {
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if(isBlank(line))
+            continue;
+
+        const double time = std::stod(line);
+        if(time > endTime)
+            break;
+        if(time < startTime)
+            continue;
+
+        auto tokens = FileAdapter::tokenize(line, delimiters);
+        IO::eraseEmptyElements(tokens);
+        OPENSIM_THROW_IF(static_cast<int>(tokens.size()) - 1 != ncol,
+                         Exception,
+                         "Row at time " + std::to_string(time) + " of file '" +
+                         _fileName + "' has " +
+                         std::to_string(tokens.size() - 1) +
+                         " data columns; expected " + std::to_string(ncol) +
+                         ".");
+
+        for(int i = 0; i < ncol; ++i)
+            row[i] = std::stod(tokens[static_cast<size_t>(i) + 1]);
+        table.appendRow(time, row);
+    }
+
+    return table;
+}
+
+size_t
+IndexedSTOReader::findRowIndex(double time) const {
+    if(time <= _firstTime)
+        return 0;
+    if(time >= _lastTime)
+        return _numRows - 1;
+
+    // Seek to the last chunk starting at or before the requested time; the
+    // answer lies within it, since the next chunk starts after the time.
+    auto chunk = std::upper_bound(_chunks.begin(), _chunks.end(), time,
+        [](double t, const ChunkEntry& entry) {
+            return t < entry.time;
+        });
+    if(chunk != _chunks.begin())
+        --chunk;
+
+    std::ifstream in_stream{_fileName, std::ios::binary};
+    OPENSIM_THROW_IF(!in_stream.good(),
+                     FileDoesNotExist,
+                     _fileName);
+    in_stream.seekg(static_cast<std::streamoff>(chunk->offset));
+
+    // Parse only the time tokens of the chunk's rows.
+    size_t irow = static_cast<size_t>(chunk - _chunks.begin()) * _rowsPerChunk;
+    size_t result = irow;
+    std::string line{};
+    while(std::getline(in_stream, line)) {
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if(isBlank(line))
+            continue;
+
+        if(std::stod(line) > time)
+            break;
+        result = irow;
+        ++irow;
+    }
+    return result;
+}
+
+TimeSeriesTable_<double>
+IndexedSTOReader::readRowRange(size_t firstRow,
+                               size_t lastRow) const {
+    OPENSIM_THROW_IF(lastRow < firstRow,
+                     InvalidArgument,
+                     "lastRow (" + std::to_string(lastRow) + ") is less "
+                     "than firstRow (" + std::to_string(firstRow) + ").");
+    OPENSIM_THROW_IF(lastRow >= _numRows,
+                     InvalidArgument,
+                     "lastRow (" + std::to_string(lastRow) + ") is out of "
+                     "range; file '" + _fileName + "' has " +
+                     std::to_string(_numRows) + " data rows.");
+
+    TimeSeriesTable_<double> table{};
+    table.setColumnLabels(_columnLabels);
+    table.updTableMetaData() = _metaData;
+
+    std::ifstream in_stream{_fileName, std::ios::binary};
+    OPENSIM_THROW_IF(!in_stream.good(),
+                     FileDoesNotExist,
+                     _fileName);
+
+    // Chunks cover consecutive runs of _rowsPerChunk rows, so the chunk
+    // holding firstRow is known without parsing; rows preceding firstRow
+    // within it are skipped without tokenizing their numeric columns.
+    in_stream.seekg(static_cast<std::streamoff>(
+            _chunks[firstRow / _rowsPerChunk].offset));
+
+    const int ncol = static_cast<int>(_columnLabels.size());
+    SimTK::RowVector_<double> row(ncol);
+    std::string line{};
+    size_t irow = (firstRow / _rowsPerChunk) * _rowsPerChunk;
+    while(irow <= lastRow && std::getline(in_stream, line)) {
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if(isBlank(line))
+            continue;
+        if(irow < firstRow) {
+            ++irow;
+            continue;
+        }
+
+        const double time = std::stod(line);
+        auto tokens = FileAdapter::tokenize(line, delimiters);
+        IO::eraseEmptyElements(tokens);
+        OPENSIM_THROW_IF(static_cast<int>(tokens.size()) - 1 != ncol,
+                         Exception,
+                         "Row at time " + std::to_string(time) + " of file '" +
+                         _fileName + "' has " +
+                         std::to_string(tokens.size() - 1) +
+                         " data columns; expected " + std::to_string(ncol) +
+                         ".");
+
+        for(int i = 0; i < ncol; ++i)
+            row[i] = std::stod(tokens[static_cast<size_t>(i) + 1]);
+        table.appendRow(time, row);
+        ++irow;
+    }
+
+    return table;
+}
@@ -0,0 +1,129 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  IndexedSTOReader.h                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_INDEXED_STO_READER_H_
+#define OPENSIM_INDEXED_STO_READER_H_
+
+#include "FileAdapter.h"
+#include "TimeSeriesTable.h"
+
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+/** IndexedSTOReader provides windowed access to large STO/MOT files of
+scalar (DataType=double) data without materializing the whole table.
+STOFileAdapter parses every row of a file eagerly, which is wasteful when an
+analysis only touches a short time window of a multi-gigabyte recording.
+
+On construction the reader makes a single sequential pass over the file that
+parses the header and column labels and records a sparse index of the data
+region: the byte offset and time stamp of every chunk of rows (1024 rows per
+chunk by default). The numeric columns are not tokenized during this pass.
+readTimeRange() then seeks directly to the chunk preceding the requested
+start time and parses only the rows that fall inside the window, returning
+them as an ordinary TimeSeriesTable that carries the file's metadata.
+
+The index holds byte offsets into the file rather than pointers into a
+memory mapping, so the reader works through ordinary seekable streams on all
+platforms; the underlying file must not change while the reader is in use.
+The file must have strictly increasing times, as required of STO files.     */
+class OSIMCOMMON_API IndexedSTOReader {
+public:
+    IndexedSTOReader()                                   = delete;
+    IndexedSTOReader(const IndexedSTOReader&)            = default;
+    IndexedSTOReader(IndexedSTOReader&&)                 = default;
+    IndexedSTOReader& operator=(const IndexedSTOReader&) = default;
+    IndexedSTOReader& operator=(IndexedSTOReader&&)      = default;
+    ~IndexedSTOReader()                                  = default;
+
+    /** Open the given STO/MOT file and build the chunk index. The file is
+    read sequentially once; only the time column is parsed. rowsPerChunk
+    controls the index granularity -- smaller chunks seek closer to the
+    requested window at the cost of a larger index.                           */
+    explicit IndexedSTOReader(const std::string& fileName,
+                              size_t rowsPerChunk = 1024);
+
+    /** Name of the indexed file.                                             */
+    const std::string& getFileName() const;
+
+    /** Column labels of the data columns (time column excluded).             */
+    const std::vector<std::string>& getColumnLabels() const;
+
+    /** Total number of data rows in the file.                                */
+    size_t getNumRows() const;
+
+    /** Time stamp of the first data row.                                     */
+    double getFirstTime() const;
+
+    /** Time stamp of the last data row.                                      */
+    double getLastTime() const;
+
+    /** Number of chunks recorded in the index.                               */
+    size_t getNumChunks() const;
+
+    /** Read the rows whose times lie in [startTime, endTime] (inclusive on
+    both ends) into a TimeSeriesTable. Only the chunks overlapping the window
+    are parsed. The returned table carries the file's metadata and column
+    labels; it is empty if no row falls inside the window.                    */
+    TimeSeriesTable_<double> readTimeRange(double startTime,
+                                           double endTime) const;
+
+    /** Index of the last row whose time is at or before the given time
+    (matching Storage::findIndex()); 0 if the given time precedes the first
+    row. Only the time tokens of the chunk containing the row are parsed.    */
+    size_t findRowIndex(double time) const;
+
+    /** Read the rows with (0-based) indices in [firstRow, lastRow]
+    (inclusive on both ends) into a TimeSeriesTable. Only the chunks
+    overlapping the range are parsed. This is the primitive behind streaming
+    consumers that walk a file window by window: successive, non-overlapping
+    row ranges partition the file exactly, which inclusive time ranges
+    cannot guarantee. The returned table carries the file's metadata and
+    column labels.                                                           */
+    TimeSeriesTable_<double> readRowRange(size_t firstRow,
+                                          size_t lastRow) const;
+
+private:
+    /** Byte offset and time stamp of the first row of a chunk.               */
+    struct ChunkEntry {
+        long long offset;
+        double    time;
+    };
+
+    /** Parse the header and column labels and record the chunk index.        */
+    void buildIndex(size_t rowsPerChunk);
+
+    std::string              _fileName;
+    std::vector<std::string> _columnLabels;
+    ValueArrayDictionary     _metaData;
+    std::vector<ChunkEntry>  _chunks;
+    size_t                   _rowsPerChunk;
+    size_t                   _numRows;
+    double                   _firstTime;
+    double                   _lastTime;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_INDEXED_STO_READER_H_
@@ -46,7 +46,6 @@ double dmin1(double a, double b);
 double dmax1(double a, double b);
 
 //#define BUG 0
-int JACOBIAN;
 
 void fdjac2(
   void (*fcn)(int, int, double[], double[], int *, void *),
@@ -318,7 +317,6 @@ void lmdif_C(
 {
    int i;
    int iflag;
-   int ij;
    int jj;
    int iter;
    int j;
@@ -450,56 +448,47 @@ L30:
          delta = factor;
    }
    
-   /* form (q transpose)*fvec and store the first n components in qtf. */
+   /* form (q transpose)*fvec and store the first n components in qtf.
+    * the column of fjac is addressed through a base pointer so the
+    * unit-stride accumulation and update loops vectorize.
+    */
    for (i=0; i<m; i++)
       wa4[i] = fvec[i];
-   
+
    jj = 0;
    for (j=0; j<n; j++)
    {
+      double *fjcol = &fjac[m*j]; /* fjcol[i] == fjac[i+m*j] */
       temp3 = fjac[jj];
       if (temp3 != zero)
       {
          sum = zero;
-         ij = jj;
          for (i=j; i<m; i++)
-         {
-            sum += fjac[ij] * wa4[i];
-            ij += 1;    /* fjac[i+m*j] */
-         }
+            sum += fjcol[i] * wa4[i];
          temp = -sum / temp3;
-         ij = jj;
          for (i=j; i<m; i++)
-         {
-            wa4[i] += fjac[ij] * temp;
-            ij += 1;    /* fjac[i+m*j] */
-         }
+            wa4[i] += fjcol[i] * temp;
       }
       fjac[jj] = wa1[j];
       jj += m+1;  /* fjac[j+m*j] */
       qtf[j] = wa4[j];
    }
-   
+
    /* compute the norm of the scaled gradient. */
    gnorm = zero;
    if (fnorm != zero)
    {
-      jj = 0;
       for (j=0; j<n; j++)
       {
          l = ipvt[j];
          if (wa2[l] != zero)
          {
+            const double *fjcol = &fjac[m*j];
             sum = zero;
-            ij = jj;
             for (i=0; i<=j; i++)
-            {
-               sum += fjac[ij]*(qtf[i]/fnorm);
-               ij += 1; /* fjac[i+m*j] */
-            }
+               sum += fjcol[i]*(qtf[i]/fnorm);
             gnorm = dmax1(gnorm,fabs(sum/wa2[l]));
          }
-         jj += m;
       }
    }
    
@@ -562,19 +551,14 @@ L200:
    /* compute the scaled predicted reduction and
     * the scaled directional derivative.
     */
-   jj = 0;
    for (j=0; j<n; j++)
    {
+      const double *fjcol = &fjac[m*j];
       wa3[j] = zero;
       l = ipvt[j];
       temp = wa1[l];
-      ij = jj;
       for (i=0; i<=j; i++)
-      {
-         wa3[i] += fjac[ij]*temp;
-         ij += 1; /* fjac[i+m*j] */
-      }
-      jj += m;
+         wa3[i] += fjcol[i]*temp;
    }
    temp1 = enorm(n,wa3)/fnorm;
    temp2 = (sqrt(par)*pnorm)/fnorm;
@@ -1160,16 +1144,16 @@ void qrfac(int m,
       }
       if (kmax == j)
          goto L40;
-      
-      ij = m * j;
-      jj = m * kmax;
-      for (i=0; i<m; i++)
+
       {
-         temp = a[ij]; /* [i+m*j] */
-         a[ij] = a[jj]; /* [i+m*kmax] */
-         a[jj] = temp;
-         ij += 1;
-         jj += 1;
+         double *ajcol = &a[m*j];
+         double *akcol = &a[m*kmax];
+         for (i=0; i<m; i++)
+         {
+            temp = ajcol[i];
+            ajcol[i] = akcol[i];
+            akcol[i] = temp;
+         }
       }
       rdiag[kmax] = rdiag[j];
       wa[kmax] = wa[j];
@@ -1204,26 +1188,19 @@ L40:
       jp1 = j + 1;
       if (jp1 < n)
       {
+         /* address the columns through base pointers so the unit-stride
+          * dot product and update loops vectorize.
+          */
+         const double *ajcol = &a[m*j]; /* ajcol[i] == a[i+m*j] */
          for (k=jp1; k<n; k++)
          {
+            double *akcol = &a[m*k]; /* akcol[i] == a[i+m*k] */
             sum = zero;
-            ij = j + m*k;
-            jj = j + m*j;
             for (i=j; i<m; i++)
-            {
-               sum += a[jj]*a[ij];
-               ij += 1; /* [i+m*k] */
-               jj += 1; /* [i+m*j] */
-            }
-            temp = sum/a[j+m*j];
-            ij = j + m*k;
-            jj = j + m*j;
+               sum += ajcol[i]*akcol[i];
+            temp = sum/ajcol[j];
             for (i=j; i<m; i++)
-            {
-               a[ij] -= temp*a[jj];
-               ij += 1; /* [i+m*k] */
-               jj += 1; /* [i+m*j] */
-            }
+               akcol[i] -= temp*ajcol[i];
             if ((pivot != 0) && (rdiag[k] != zero))
             {
                temp = a[j+m*k]/rdiag[k];
@@ -1715,7 +1692,6 @@ void fdjac2(void (*fcn)(int, int, double[], double[], int *, void *),
 {
    int i;
    int j;
-   int ij;
    double eps;
    double h;
    double temp;
@@ -1725,20 +1701,19 @@ void fdjac2(void (*fcn)(int, int, double[], double[], int *, void *),
    //    temp = dmax1(epsfcn,MACHEP);
    //    eps = sqrt(temp);
 
-   JACOBIAN = 1;
    eps = 1e-5;
 
 #ifdef BUG
    printf( "fdjac2\n" );
 #endif
 
-   ij = 0;
    for (j=0; j<n; j++)
    {
+      double *fjcol = &fjac[m*j]; /* fjcol[i] == fjac[i+m*j] */
       temp = x[j];
       //        h = eps * fabs(temp);
       //        if (h == zero)
-      //            h = eps;      
+      //            h = eps;
       h = eps; // added dkb
       x[j] = temp + h;
 
@@ -1748,19 +1723,15 @@ void fdjac2(void (*fcn)(int, int, double[], double[], int *, void *),
          return;
 
       for (i=0; i<m; i++)
-      {
-         fjac[ij] = (wa[i] - fvec[i])/h;
-         ij += 1;    /* fjac[i+m*j] */
-      }
+         fjcol[i] = (wa[i] - fvec[i])/h;
    }
-   
+
 #ifdef BUG
    printf("jacobian:\n");
    pmat( m, n, fjac );
    for (i = 0; i < m*n; i++)
       printf("%6e  ", fjac[i]);
 #endif
-   JACOBIAN = 0;
 }
 
 
@@ -1801,7 +1772,7 @@ void pmat(int m, int n, double y[])
    int i;
    int j;
    int k;
-   
+
    k = 0;
    for (i=0; i<m; i++)
    {
@@ -1814,4 +1785,42 @@ void pmat(int m, int n, double y[])
       }
       printf( "\n" );
    }
-}   
+}
+
+
+/************************LmdifSolver*************************/
+
+namespace OpenSim {
+
+LmdifSolver::LmdifSolver(int numResiduals, int numParameters)
+{
+   resize(numResiduals, numParameters);
+}
+
+void LmdifSolver::resize(int numResiduals, int numParameters)
+{
+   _numResiduals = numResiduals;
+   _numParameters = numParameters;
+   _fjac.resize((size_t)numResiduals * numParameters);
+   _ipvt.resize(numParameters);
+   _qtf.resize(numParameters);
+   _wa1.resize(numParameters);
+   _wa2.resize(numParameters);
+   _wa3.resize(numParameters);
+   _wa4.resize(numResiduals);
+}
+
+void LmdifSolver::solve(Function fcn, double x[], double fvec[], double ftol,
+        double xtol, double gtol, int maxfev, double epsfcn, double diag[],
+        int mode, double factor, int nprint, int* info, int* nfev, void* data)
+{
+   /* Improper inputs (including numParameters > numResiduals) are reported
+    * by lmdif_C through *info == 0, as documented above.
+    */
+   lmdif_C(fcn, _numResiduals, _numParameters, x, fvec, ftol, xtol, gtol,
+           maxfev, epsfcn, diag, mode, factor, nprint, info, nfev,
+           &_fjac[0], _numResiduals, &_ipvt[0], &_qtf[0],
+           &_wa1[0], &_wa2[0], &_wa3[0], &_wa4[0], data);
+}
+
+} // namespace OpenSim
@@ -1,3 +1,5 @@
+#ifndef OPENSIM_LMDIF_H_
+#define OPENSIM_LMDIF_H_
 /* -------------------------------------------------------------------------- *
  *                             OpenSim:  Lmdif.h                              *
  * -------------------------------------------------------------------------- *
@@ -36,6 +38,8 @@
 
 #include "osimCommonDLL.h"
 
+#include <vector>
+
 void OSIMCOMMON_API lmdif_C(
   void (*fcn)(int, int, double[], double[], int *, void *),
   int    m,
@@ -62,3 +66,58 @@ void OSIMCOMMON_API lmdif_C(
   double wa3[],
   double wa4[],
   void *data);
+
+namespace OpenSim {
+
+/**
+ * Reusable wrapper around lmdif_C() that owns the Jacobian, pivot, and work
+ * arrays. Construct it once for a given problem size and call solve()
+ * repeatedly; the workspace is allocated up front instead of by the caller on
+ * every invocation, which matters for code that solves many small
+ * least-squares problems in a loop (e.g., wrapping and marker fitting).
+ *
+ * The workspace is reused across solve() calls, so a single LmdifSolver must
+ * not be shared between threads; give each thread its own instance.
+ */
+class OSIMCOMMON_API LmdifSolver {
+public:
+    /** Signature of the residual function passed to solve(); identical to the
+    fcn argument of lmdif_C(). */
+    typedef void (*Function)(int, int, double[], double[], int*, void*);
+
+    /** Allocate workspace for a problem with numResiduals nonlinear functions
+    of numParameters variables (numParameters must not exceed numResiduals). */
+    LmdifSolver(int numResiduals, int numParameters);
+
+    /** Resize the workspace for a new problem size. No allocation occurs if
+    the new problem is no larger than the largest seen so far. */
+    void resize(int numResiduals, int numParameters);
+
+    int getNumResiduals() const { return _numResiduals; }
+    int getNumParameters() const { return _numParameters; }
+
+    /** Minimize the sum of squares of the residuals computed by fcn, starting
+    from x (length getNumParameters()); on return x holds the solution and
+    fvec (length getNumResiduals()) the residuals at x. The remaining
+    arguments have the same meaning as the identically named arguments of
+    lmdif_C(), documented in Lmdif.cpp. */
+    void solve(Function fcn, double x[], double fvec[], double ftol,
+            double xtol, double gtol, int maxfev, double epsfcn, double diag[],
+            int mode, double factor, int nprint, int* info, int* nfev,
+            void* data);
+
+private:
+    int _numResiduals;
+    int _numParameters;
+    std::vector<double> _fjac;
+    std::vector<int> _ipvt;
+    std::vector<double> _qtf;
+    std::vector<double> _wa1;
+    std::vector<double> _wa2;
+    std::vector<double> _wa3;
+    std::vector<double> _wa4;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_LMDIF_H_
@@ -27,8 +27,10 @@
 #include "LogSink.h"
 
 #include "spdlog/sinks/stdout_color_sinks.h"
+#include "spdlog/async.h"
 
 #include <algorithm>
+#include <chrono>
 
 using namespace OpenSim;
 
@@ -275,4 +277,79 @@ void Logger::removeSink(const std::shared_ptr<LogSink> sink) {
     removeSinkInternal(std::static_pointer_cast<spdlog::sinks::sink>(sink));
 }
 
+// whether messages are currently routed through spdlog's thread pool
+static bool asyncLoggingEnabled = false;
+
+// Replace the given logger (in the spdlog registry and in our globals) with
+// an async_logger feeding the registry's thread pool through the same sinks.
+static std::shared_ptr<spdlog::logger> toAsyncLogger(
+        const std::shared_ptr<spdlog::logger>& logger) {
+    auto async = std::make_shared<spdlog::async_logger>(
+            logger->name(),
+            logger->sinks().begin(), logger->sinks().end(),
+            spdlog::thread_pool(),
+            spdlog::async_overflow_policy::block);
+    async->set_level(logger->level());
+    spdlog::drop(logger->name());
+    spdlog::register_logger(async);
+    return async;
+}
+
+// Replace the given logger with a synchronous logger on the same sinks.
+static std::shared_ptr<spdlog::logger> toSyncLogger(
+        const std::shared_ptr<spdlog::logger>& logger) {
+    auto sync = std::make_shared<spdlog::logger>(
+            logger->name(),
+            logger->sinks().begin(), logger->sinks().end());
+    sync->set_level(logger->level());
+    spdlog::drop(logger->name());
+    spdlog::register_logger(sync);
+    return sync;
+}
+
+void Logger::startAsyncLogging(size_t queueSize) {
+    if (asyncLoggingEnabled) {
+        return;
+    }
+    // Create the lazily-initialized file sink now, so the async loggers
+    // built below inherit it.
+    initFileLoggingAsNeeded();
+    // One background thread services the ring buffer; the formatters already
+    // installed on the sinks are reused as-is.
+    spdlog::init_thread_pool(queueSize, 1);
+    coutLogger = toAsyncLogger(coutLogger);
+    defaultLogger = toAsyncLogger(defaultLogger);
+    spdlog::set_default_logger(defaultLogger);
+    // Coalesce I/O: flush only for errors and periodically, instead of after
+    // every Info message (the synchronous default).
+    spdlog::flush_on(spdlog::level::err);
+    spdlog::flush_every(std::chrono::seconds(2));
+    asyncLoggingEnabled = true;
+}
+
+void Logger::stopAsyncLogging() {
+    if (!asyncLoggingEnabled) {
+        return;
+    }
+    flush();
+    coutLogger = toSyncLogger(coutLogger);
+    defaultLogger = toSyncLogger(defaultLogger);
+    spdlog::set_default_logger(defaultLogger);
+    spdlog::flush_on(spdlog::level::info);
+    // The registry keeps the (now idle) worker thread alive; messages that
+    // were still queued when the loggers were swapped drain through it. The
+    // periodic flusher is likewise left running -- flushing the synchronous
+    // loggers is a no-op between messages.
+    asyncLoggingEnabled = false;
+}
+
+bool Logger::isAsyncLogging() {
+    return asyncLoggingEnabled;
+}
+
+void Logger::flush() {
+    defaultLogger->flush();
+    coutLogger->flush();
+}
+
 
@@ -182,6 +182,40 @@ public:
     /// @note This function is not thread-safe. Do not invoke this function
     /// concurrently, or concurrently with addLogFile() or addSink().
     static void removeSink(const std::shared_ptr<LogSink> sink);
+
+    /// @name Asynchronous logging
+    /// By default, messages are formatted and flushed to the sinks on the
+    /// thread that logs them; every Info-or-higher message forces a flush.
+    /// Asynchronous logging instead enqueues messages into a fixed-size ring
+    /// buffer serviced by one background thread, and flushing is coalesced:
+    /// sinks are flushed on Error messages and periodically, not per message.
+    /// Use this when logging from performance-sensitive code (e.g. inside
+    /// solver iterations) so the simulation thread does not pay formatting
+    /// and I/O latency. If the ring buffer fills up, the logging thread
+    /// blocks rather than dropping messages.
+    /// @{
+
+    /// Route messages through a background thread. queueSize is the capacity
+    /// (in messages) of the ring buffer. Does nothing if asynchronous logging
+    /// is already active.
+    /// @note This function is not thread-safe; do not invoke it concurrently
+    /// with any logging function or with addSink()/removeSink().
+    static void startAsyncLogging(size_t queueSize = 8192);
+
+    /// Flush pending messages and return to synchronous logging.
+    /// Does nothing if asynchronous logging is not active.
+    /// @note This function is not thread-safe; see startAsyncLogging().
+    static void stopAsyncLogging();
+
+    /// Whether messages are currently routed through a background thread.
+    static bool isAsyncLogging();
+
+    /// Ask all sinks to flush. With asynchronous logging active, the flush
+    /// request is processed by the background thread after any messages
+    /// already queued.
+    static void flush();
+
+    /// @}
 private:
     static spdlog::logger& getCoutLogger();
     static spdlog::logger& getDefaultLogger();
@@ -235,6 +269,27 @@ void log_cout(spdlog::string_view_t fmt, const Args&... args) {
 
 /// @}
 
+/// @name Compile-time-filterable logging macros
+/// OPENSIM_LOG_TRACE() and OPENSIM_LOG_DEBUG() behave like log_trace() and
+/// log_debug(), except that defining OPENSIM_DISABLE_TRACE_LOGGING (e.g. for
+/// production builds) compiles them away entirely: neither the runtime level
+/// check nor evaluation of the arguments remains. Use these for
+/// instrumentation in hot code paths (per-iteration solver messages) where
+/// even a disabled log call is measurable.
+/// @{
+
+#ifdef OPENSIM_DISABLE_TRACE_LOGGING
+    #define OPENSIM_LOG_TRACE(...) ((void)0)
+    #define OPENSIM_LOG_DEBUG(...) ((void)0)
+#else
+    /// @related Logger
+    #define OPENSIM_LOG_TRACE(...) OpenSim::Logger::trace(__VA_ARGS__)
+    /// @related Logger
+    #define OPENSIM_LOG_DEBUG(...) OpenSim::Logger::debug(__VA_ARGS__)
+#endif
+
+/// @}
+
 } // namespace OpenSim
 
 #endif // OPENSIM_LOG_H_
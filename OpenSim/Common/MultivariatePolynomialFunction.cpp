@@ -52,7 +52,10 @@ public:
                         nq4_s = 0;
                     else
                         nq4_s = order - nq[0] - nq[1] - nq[2];
-                    for (nq[3] = 0; nq[3] < nq4_s + 1; ++nq[3]) { ++coeff_nr; }
+                    for (nq[3] = 0; nq[3] < nq4_s + 1; ++nq[3]) {
+                        terms.push_back(nq);
+                        ++coeff_nr;
+                    }
                 }
             }
         }
@@ -61,108 +64,40 @@ public:
                 coefficients.size());
     }
     T calcValue(const SimTK::Vector& x) const override {
-        std::array<int, 4> nq{{0, 0, 0, 0}};
-        T value = static_cast<T>(0);
-        int coeff_nr = 0;
-        for (nq[0] = 0; nq[0] < order + 1; ++nq[0]) {
-            int nq2_s;
-            if (dimension < 2)
-                nq2_s = 0;
-            else
-                nq2_s = order - nq[0];
-            for (nq[1] = 0; nq[1] < nq2_s + 1; ++nq[1]) {
-                int nq3_s;
-                if (dimension < 3)
-                    nq3_s = 0;
-                else
-                    nq3_s = order - nq[0] - nq[1];
-                for (nq[2] = 0; nq[2] < nq3_s + 1; ++nq[2]) {
-                    int nq4_s;
-                    if (dimension < 4)
-                        nq4_s = 0;
-                    else
-                        nq4_s = order - nq[0] - nq[1] - nq[2];
-                    for (nq[3] = 0; nq[3] < nq4_s + 1; ++nq[3]) {
-                        T valueP = static_cast<T>(1);
-                        for (int i = 0; i < dimension; ++i) {
-                            valueP *= std::pow(x[i], nq[i]);
-                        }
-                        value += valueP * coefficients[coeff_nr];
-                        ++coeff_nr;
-                    }
-                }
-            }
-        }
-        return value;
+        return calcValuePoint(x.size() ? &x[0] : nullptr);
     }
     T calcDerivative(const SimTK::Array_<int>& derivComponent,
             const SimTK::Vector& x) const override {
-        std::array<int, 4> nq{{0, 0, 0, 0}};
-        T value = static_cast<T>(0);
-        int nqNonNegative;
-        int coeff_nr = 0;
-        for (nq[0] = 0; nq[0] < order + 1; ++nq[0]) {
-            int nq2_s;
-            if (dimension < 2)
-                nq2_s = 0;
-            else
-                nq2_s = order - nq[0];
-            for (nq[1] = 0; nq[1] < nq2_s + 1; ++nq[1]) {
-                int nq3_s;
-                if (dimension < 3)
-                    nq3_s = 0;
-                else
-                    nq3_s = order - nq[0] - nq[1];
-                for (nq[2] = 0; nq[2] < nq3_s + 1; ++nq[2]) {
-                    int nq4_s;
-                    if (dimension < 4)
-                        nq4_s = 0;
-                    else
-                        nq4_s = order - nq[0] - nq[1] - nq[2];
-                    for (nq[3] = 0; nq[3] < nq4_s + 1; ++nq[3]) {
-                        if (derivComponent[0] == 0) {
-                            nqNonNegative = nq[0] - 1;
-                            if (nqNonNegative < 0) nqNonNegative = 0;
-                            T valueP = nq[0] * std::pow(x[0], nqNonNegative);
-                            for (int i = 0; i < dimension; ++i) {
-                                if (i == derivComponent[0]) continue;
-                                valueP *= std::pow(x[i], nq[i]);
-                            }
-                            value += valueP * coefficients[coeff_nr];
-                        } else if (derivComponent[0] == 1) {
-                            nqNonNegative = nq[1] - 1;
-                            if (nqNonNegative < 0) nqNonNegative = 0;
-                            T valueP = nq[1] * std::pow(x[1], nqNonNegative);
-                            for (int i = 0; i < dimension; ++i) {
-                                if (i == derivComponent[0]) continue;
-                                valueP *= std::pow(x[i], nq[i]);
-                            }
-                            value += valueP * coefficients[coeff_nr];
-                        } else if (derivComponent[0] == 2) {
-                            nqNonNegative = nq[2] - 1;
-                            if (nqNonNegative < 0) nqNonNegative = 0;
-                            T valueP = nq[2] * std::pow(x[2], nqNonNegative);
-                            for (int i = 0; i < dimension; ++i) {
-                                if (i == derivComponent[0]) continue;
-                                valueP *= std::pow(x[i], nq[i]);
-                            }
-                            value += valueP * coefficients[coeff_nr];
-                        } else if (derivComponent[0] == 3) {
-                            nqNonNegative = nq[3] - 1;
-                            if (nqNonNegative < 0) nqNonNegative = 0;
-                            T valueP = nq[3] * std::pow(x[3], nqNonNegative);
-                            for (int i = 0; i < dimension; ++i) {
-                                if (i == derivComponent[0]) continue;
-                                valueP *= std::pow(x[i], nq[i]);
-                            }
-                            value += valueP * coefficients[coeff_nr];
-                        }
-                        ++coeff_nr;
-                    }
-                }
+        return calcDerivativePoint(
+                derivComponent[0], x.size() ? &x[0] : nullptr);
+    }
+    /** Evaluate at a single point given as a plain array of `dimension`
+    values; this is the kernel behind calcValue() and the batch methods. */
+    T calcValuePoint(const T* x) const {
+        if (order <= MaxTableOrder) {
+            switch (dimension) {
+            case 1: return calcValueT<1>(x);
+            case 2: return calcValueT<2>(x);
+            case 3: return calcValueT<3>(x);
+            case 4: return calcValueT<4>(x);
             }
         }
-        return value;
+        return calcValueGeneric(x);
+    }
+    /** Evaluate the first derivative with respect to one component at a
+    single point given as a plain array of `dimension` values. */
+    T calcDerivativePoint(int derivComponent, const T* x) const {
+        if (derivComponent < 0 || derivComponent >= dimension)
+            return static_cast<T>(0);
+        if (order <= MaxTableOrder) {
+            switch (dimension) {
+            case 1: return calcDerivativeT<1>(derivComponent, x);
+            case 2: return calcDerivativeT<2>(derivComponent, x);
+            case 3: return calcDerivativeT<3>(derivComponent, x);
+            case 4: return calcDerivativeT<4>(derivComponent, x);
+            }
+        }
+        return calcDerivativeGeneric(derivComponent, x);
     }
     int getArgumentSize() const override { return dimension; }
     int getMaxDerivativeOrder() const override { return 1; }
@@ -175,12 +110,131 @@ public:
     }
 
 private:
+    /** Largest order evaluated through the stack-allocated power tables;
+    higher orders take the generic std::pow path. */
+    static const int MaxTableOrder = 10;
+
+    /** Dimension-templated kernel: the per-variable powers are tabulated
+    once per point and the product over variables unrolls at compile time,
+    instead of re-deriving the exponent tuples and calling std::pow once
+    per term and variable. The arithmetic (and hence the result, bit for
+    bit) is the same as the original nested-loop evaluation. */
+    template <int D>
+    T calcValueT(const T* x) const {
+        T pows[D][MaxTableOrder + 1];
+        for (int i = 0; i < D; ++i)
+            for (int k = 0; k <= order; ++k)
+                pows[i][k] = std::pow(x[i], k);
+        T value = static_cast<T>(0);
+        const int numTerms = static_cast<int>(terms.size());
+        for (int c = 0; c < numTerms; ++c) {
+            const std::array<int, 4>& nq = terms[c];
+            T valueP = static_cast<T>(1);
+            for (int i = 0; i < D; ++i)
+                valueP *= pows[i][nq[i]];
+            value += valueP * coefficients[c];
+        }
+        return value;
+    }
+    template <int D>
+    T calcDerivativeT(int d, const T* x) const {
+        T pows[D][MaxTableOrder + 1];
+        for (int i = 0; i < D; ++i)
+            for (int k = 0; k <= order; ++k)
+                pows[i][k] = std::pow(x[i], k);
+        T value = static_cast<T>(0);
+        const int numTerms = static_cast<int>(terms.size());
+        for (int c = 0; c < numTerms; ++c) {
+            const std::array<int, 4>& nq = terms[c];
+            int nqNonNegative = nq[d] - 1;
+            if (nqNonNegative < 0) nqNonNegative = 0;
+            T valueP = nq[d] * pows[d][nqNonNegative];
+            for (int i = 0; i < D; ++i) {
+                if (i == d) continue;
+                valueP *= pows[i][nq[i]];
+            }
+            value += valueP * coefficients[c];
+        }
+        return value;
+    }
+    T calcValueGeneric(const T* x) const {
+        T value = static_cast<T>(0);
+        const int numTerms = static_cast<int>(terms.size());
+        for (int c = 0; c < numTerms; ++c) {
+            const std::array<int, 4>& nq = terms[c];
+            T valueP = static_cast<T>(1);
+            for (int i = 0; i < dimension; ++i)
+                valueP *= std::pow(x[i], nq[i]);
+            value += valueP * coefficients[c];
+        }
+        return value;
+    }
+    T calcDerivativeGeneric(int d, const T* x) const {
+        T value = static_cast<T>(0);
+        const int numTerms = static_cast<int>(terms.size());
+        for (int c = 0; c < numTerms; ++c) {
+            const std::array<int, 4>& nq = terms[c];
+            int nqNonNegative = nq[d] - 1;
+            if (nqNonNegative < 0) nqNonNegative = 0;
+            T valueP = nq[d] * std::pow(x[d], nqNonNegative);
+            for (int i = 0; i < dimension; ++i) {
+                if (i == d) continue;
+                valueP *= std::pow(x[i], nq[i]);
+            }
+            value += valueP * coefficients[c];
+        }
+        return value;
+    }
+
     SimTK::Vector_<T> coefficients;
     int dimension;
     int order;
+    /** One entry per coefficient: the exponent of each input variable in
+    the corresponding term, in coefficient order. */
+    std::vector<std::array<int, 4>> terms;
 };
 
 SimTK::Function* MultivariatePolynomialFunction::createSimTKFunction() const {
     return new SimTKMultivariatePolynomial<SimTK::Real>(
             get_coefficients(), get_dimension(), getOrder());
 }
+
+void MultivariatePolynomialFunction::calcValues(
+        const SimTK::Matrix& points, SimTK::Vector& values) const {
+    OPENSIM_THROW_IF(points.ncol() != get_dimension(), Exception,
+            "Expected one column per dimension ({}) but got {}.",
+            get_dimension(), points.ncol());
+    if (_function == NULL) _function = createSimTKFunction();
+    const auto* polynomial =
+            dynamic_cast<const SimTKMultivariatePolynomial<SimTK::Real>*>(
+                    _function);
+    const int numPoints = points.nrow();
+    values.resize(numPoints);
+    double point[4];
+    for (int r = 0; r < numPoints; ++r) {
+        for (int i = 0; i < points.ncol(); ++i) point[i] = points(r, i);
+        values[r] = polynomial->calcValuePoint(point);
+    }
+}
+
+void MultivariatePolynomialFunction::calcDerivatives(int derivComponent,
+        const SimTK::Matrix& points, SimTK::Vector& derivatives) const {
+    OPENSIM_THROW_IF(
+            derivComponent < 0 || derivComponent >= get_dimension(), Exception,
+            "Expected derivComponent >= 0 && < {} but got {}.",
+            get_dimension(), derivComponent);
+    OPENSIM_THROW_IF(points.ncol() != get_dimension(), Exception,
+            "Expected one column per dimension ({}) but got {}.",
+            get_dimension(), points.ncol());
+    if (_function == NULL) _function = createSimTKFunction();
+    const auto* polynomial =
+            dynamic_cast<const SimTKMultivariatePolynomial<SimTK::Real>*>(
+                    _function);
+    const int numPoints = points.nrow();
+    derivatives.resize(numPoints);
+    double point[4];
+    for (int r = 0; r < numPoints; ++r) {
+        for (int i = 0; i < points.ncol(); ++i) point[i] = points(r, i);
+        derivatives[r] = polynomial->calcDerivativePoint(derivComponent, point);
+    }
+}
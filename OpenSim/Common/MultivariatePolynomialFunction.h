@@ -98,6 +98,19 @@ public:
     /// Return function
     SimTK::Function* createSimTKFunction() const override;
 
+    /** Evaluate the polynomial at a batch of input points in one call.
+    Each row of `points` is one input point, so the matrix must have one
+    column per dimension. The results are bit-for-bit identical to calling
+    calcValue() once per point, but the per-term bookkeeping is set up once
+    for the whole batch. */
+    void calcValues(const SimTK::Matrix& points, SimTK::Vector& values) const;
+    /** Evaluate the first derivative of the polynomial with respect to one
+    input component at a batch of input points in one call. Each row of
+    `points` is one input point, so the matrix must have one column per
+    dimension. */
+    void calcDerivatives(int derivComponent, const SimTK::Matrix& points,
+            SimTK::Vector& derivatives) const;
+
 private:
     void constructProperties() {
         constructProperty_coefficients(SimTK::Vector(0));
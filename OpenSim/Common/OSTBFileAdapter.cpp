@@ -0,0 +1,480 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  OSTBFileAdapter.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OSTBFileAdapter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace OpenSim {
+
+namespace {
+
+const char theMagic[4] = {'O', 'S', 'T', 'B'};
+const uint32_t theVersion = 1;
+// Written as-is and checked on read so a file moved between machines of
+// different endianness fails loudly instead of decoding garbage.
+const uint32_t theByteOrderMark = 0x01020304u;
+
+void writeBytes(std::ostream& out, const void* data, size_t numBytes) {
+    out.write(static_cast<const char*>(data),
+              static_cast<std::streamsize>(numBytes));
+}
+
+void writeU32(std::ostream& out, uint32_t value) {
+    writeBytes(out, &value, sizeof(value));
+}
+
+void writeU64(std::ostream& out, uint64_t value) {
+    writeBytes(out, &value, sizeof(value));
+}
+
+void writeString(std::ostream& out, const std::string& str) {
+    writeU32(out, static_cast<uint32_t>(str.size()));
+    writeBytes(out, str.data(), str.size());
+}
+
+void readBytes(std::istream& in,
+               void* dest,
+               size_t numBytes,
+               const std::string& fileName) {
+    in.read(static_cast<char*>(dest), static_cast<std::streamsize>(numBytes));
+    OPENSIM_THROW_IF(in.gcount() != static_cast<std::streamsize>(numBytes),
+                     OSTBFormatError,
+                     fileName,
+                     "Unexpected end of file.");
+}
+
+uint32_t readU32(std::istream& in, const std::string& fileName) {
+    uint32_t value{};
+    readBytes(in, &value, sizeof(value), fileName);
+    return value;
+}
+
+uint64_t readU64(std::istream& in, const std::string& fileName) {
+    uint64_t value{};
+    readBytes(in, &value, sizeof(value), fileName);
+    return value;
+}
+
+std::string readString(std::istream& in, const std::string& fileName) {
+    const uint32_t length = readU32(in, fileName);
+    std::string str(length, '\0');
+    if(length > 0)
+        readBytes(in, &str[0], length, fileName);
+    return str;
+}
+
+// Byte-shuffle: group byte 0 of every double, then byte 1, and so on. The
+// shuffled planes of smoothly varying signals are mostly constant, which the
+// run-length encoder below exploits.
+std::vector<unsigned char> shuffleDoubles(const double* values,
+                                          size_t numValues) {
+    std::vector<unsigned char> shuffled(numValues * sizeof(double));
+    const unsigned char* bytes =
+            reinterpret_cast<const unsigned char*>(values);
+    for(size_t i = 0; i < numValues; ++i)
+        for(size_t plane = 0; plane < sizeof(double); ++plane)
+            shuffled[plane * numValues + i] = bytes[i * sizeof(double) +
+                                                    plane];
+    return shuffled;
+}
+
+void unshuffleDoubles(const std::vector<unsigned char>& shuffled,
+                      size_t numValues,
+                      double* values) {
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(values);
+    for(size_t i = 0; i < numValues; ++i)
+        for(size_t plane = 0; plane < sizeof(double); ++plane)
+            bytes[i * sizeof(double) + plane] = shuffled[plane * numValues +
+                                                         i];
+}
+
+// Run-length encoding in the PackBits scheme: a control byte n in [0, 127]
+// means n+1 literal bytes follow; n in [129, 255] means the following byte
+// is repeated 257-n times; 128 is a no-op.
+std::vector<unsigned char> rleCompress(const std::vector<unsigned char>& data)
+{
+    std::vector<unsigned char> packed{};
+    packed.reserve(data.size() / 4);
+    size_t i = 0;
+    while(i < data.size()) {
+        // Length of the run of identical bytes starting at i, capped at the
+        // longest run a single control byte can express.
+        size_t run = 1;
+        while(i + run < data.size() &&
+              data[i + run] == data[i] &&
+              run < 128)
+            ++run;
+
+        if(run >= 3) {
+            packed.push_back(static_cast<unsigned char>(257 - run));
+            packed.push_back(data[i]);
+            i += run;
+        } else {
+            // Accumulate literals until the next run of 3+ identical bytes
+            // or the literal limit of a single control byte.
+            size_t literals = run;
+            while(i + literals < data.size() && literals < 128) {
+                size_t nextRun = 1;
+                while(i + literals + nextRun < data.size() &&
+                      data[i + literals + nextRun] == data[i + literals] &&
+                      nextRun < 3)
+                    ++nextRun;
+                if(nextRun >= 3)
+                    break;
+                literals += nextRun;
+            }
+            literals = std::min<size_t>(literals, 128);
+            packed.push_back(static_cast<unsigned char>(literals - 1));
+            packed.insert(packed.end(),
+                          data.begin() + i,
+                          data.begin() + i + literals);
+            i += literals;
+        }
+    }
+    return packed;
+}
+
+std::vector<unsigned char>
+rleDecompress(const std::vector<unsigned char>& packed,
+              size_t expectedSize,
+              const std::string& fileName) {
+    std::vector<unsigned char> data{};
+    data.reserve(expectedSize);
+    size_t i = 0;
+    while(i < packed.size()) {
+        const unsigned char control = packed[i++];
+        if(control < 128) {
+            const size_t count = control + size_t{1};
+            OPENSIM_THROW_IF(i + count > packed.size(),
+                             OSTBFormatError,
+                             fileName,
+                             "Corrupt compressed block.");
+            data.insert(data.end(),
+                        packed.begin() + i,
+                        packed.begin() + i + count);
+            i += count;
+        } else if(control > 128) {
+            const size_t count = 257 - size_t{control};
+            OPENSIM_THROW_IF(i >= packed.size(),
+                             OSTBFormatError,
+                             fileName,
+                             "Corrupt compressed block.");
+            data.insert(data.end(), count, packed[i++]);
+        }
+    }
+    OPENSIM_THROW_IF(data.size() != expectedSize,
+                     OSTBFormatError,
+                     fileName,
+                     "Compressed block decoded to an unexpected size.");
+    return data;
+}
+
+struct BlockEntry {
+    uint64_t offset;
+    uint64_t compressedSize;
+};
+
+} // namespace
+
+OSTBFileAdapter*
+OSTBFileAdapter::clone() const {
+    return new OSTBFileAdapter{*this};
+}
+
+const std::string
+OSTBFileAdapter::tableString() {
+    return "table";
+}
+
+void
+OSTBFileAdapter::write(const TimeSeriesTable& table,
+                       const std::string& fileName,
+                       unsigned rowsPerBlock) {
+    InputTables tables{};
+    tables.emplace(tableString(), &table);
+    OSTBFileAdapter adapter{};
+    adapter.setRowsPerBlock(rowsPerBlock);
+    adapter.extendWrite(tables, fileName);
+}
+
+TimeSeriesTable
+OSTBFileAdapter::readTable(const std::string& fileName,
+                           const std::vector<std::string>& columns) {
+    OSTBFileAdapter adapter{};
+    adapter.setColumnsToRead(columns);
+    auto tables = adapter.extendRead(fileName);
+    return static_cast<const TimeSeriesTable&>(*tables.at(tableString()));
+}
+
+void
+OSTBFileAdapter::setColumnsToRead(const std::vector<std::string>& labels) {
+    _columnsToRead = labels;
+}
+
+const std::vector<std::string>&
+OSTBFileAdapter::getColumnsToRead() const {
+    return _columnsToRead;
+}
+
+void
+OSTBFileAdapter::setRowsPerBlock(unsigned rowsPerBlock) {
+    OPENSIM_THROW_IF(rowsPerBlock == 0,
+                     InvalidArgument,
+                     "Rows per block must be at least 1.");
+    _rowsPerBlock = rowsPerBlock;
+}
+
+unsigned
+OSTBFileAdapter::getRowsPerBlock() const {
+    return _rowsPerBlock;
+}
+
+DataAdapter::OutputTables
+OSTBFileAdapter::extendRead(const std::string& fileName) const {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+
+    std::ifstream in_stream{fileName, std::ios::binary};
+    OPENSIM_THROW_IF(!in_stream.good(),
+                     FileDoesNotExist,
+                     fileName);
+
+    char magic[4]{};
+    readBytes(in_stream, magic, sizeof(magic), fileName);
+    OPENSIM_THROW_IF(std::memcmp(magic, theMagic, sizeof(theMagic)) != 0,
+                     OSTBFormatError,
+                     fileName,
+                     "Not an OpenSim binary table file.");
+    const uint32_t version = readU32(in_stream, fileName);
+    OPENSIM_THROW_IF(version != theVersion,
+                     OSTBFormatError,
+                     fileName,
+                     "Unsupported file version " + std::to_string(version) +
+                     ".");
+    OPENSIM_THROW_IF(readU32(in_stream, fileName) != theByteOrderMark,
+                     OSTBFormatError,
+                     fileName,
+                     "File was written on a machine with different byte "
+                     "order.");
+
+    const size_t numRows =
+            static_cast<size_t>(readU64(in_stream, fileName));
+    const size_t numCols =
+            static_cast<size_t>(readU32(in_stream, fileName));
+    const size_t rowsPerBlock =
+            static_cast<size_t>(readU32(in_stream, fileName));
+    OPENSIM_THROW_IF(rowsPerBlock == 0,
+                     OSTBFormatError,
+                     fileName,
+                     "Rows per block must be at least 1.");
+
+    const uint32_t numMetaData = readU32(in_stream, fileName);
+    std::vector<std::pair<std::string, std::string>> metadata{};
+    for(uint32_t i = 0; i < numMetaData; ++i) {
+        auto key = readString(in_stream, fileName);
+        auto value = readString(in_stream, fileName);
+        metadata.emplace_back(std::move(key), std::move(value));
+    }
+
+    std::vector<std::string> labels{};
+    for(size_t i = 0; i < numCols; ++i)
+        labels.push_back(readString(in_stream, fileName));
+
+    // Block index: time column first, then one entry list per dependent
+    // column.
+    const size_t numBlocks =
+            numRows == 0 ? 0 : (numRows + rowsPerBlock - 1) / rowsPerBlock;
+    std::vector<std::vector<BlockEntry>> index(numCols + 1);
+    for(auto& column : index) {
+        column.resize(numBlocks);
+        for(auto& block : column) {
+            block.offset = readU64(in_stream, fileName);
+            block.compressedSize = readU64(in_stream, fileName);
+        }
+    }
+
+    // Resolve the column-subset projection, if any.
+    std::vector<size_t> selected{};
+    std::vector<std::string> selectedLabels{};
+    if(_columnsToRead.empty()) {
+        for(size_t i = 0; i < numCols; ++i)
+            selected.push_back(i);
+        selectedLabels = labels;
+    } else {
+        for(const auto& label : _columnsToRead) {
+            auto iter = std::find(labels.cbegin(), labels.cend(), label);
+            OPENSIM_THROW_IF(iter == labels.cend(),
+                             KeyNotFound,
+                             label);
+            selected.push_back(
+                    static_cast<size_t>(iter - labels.cbegin()));
+            selectedLabels.push_back(label);
+        }
+    }
+
+    // Fetch and decode the blocks of one on-disk column into dest, which
+    // must have room for numRows doubles.
+    auto decodeColumn = [&](size_t fileColumn, double* dest) {
+        const auto& blocks = index.at(fileColumn);
+        for(size_t b = 0; b < numBlocks; ++b) {
+            const size_t blockRows =
+                    std::min(rowsPerBlock, numRows - b * rowsPerBlock);
+            in_stream.seekg(
+                    static_cast<std::streamoff>(blocks[b].offset));
+            std::vector<unsigned char> packed(
+                    static_cast<size_t>(blocks[b].compressedSize));
+            readBytes(in_stream, packed.data(), packed.size(), fileName);
+            const auto shuffled = rleDecompress(packed,
+                                                blockRows * sizeof(double),
+                                                fileName);
+            unshuffleDoubles(shuffled,
+                             blockRows,
+                             dest + b * rowsPerBlock);
+        }
+    };
+
+    std::shared_ptr<TimeSeriesTable> table{};
+    if(numRows == 0) {
+        table = std::make_shared<TimeSeriesTable>();
+        table->setColumnLabels(selectedLabels);
+    } else {
+        std::vector<double> times(numRows);
+        decodeColumn(0, times.data());
+
+        SimTK::Matrix_<double> depData{static_cast<int>(numRows),
+                                       static_cast<int>(selected.size())};
+        for(size_t j = 0; j < selected.size(); ++j)
+            decodeColumn(selected[j] + 1,
+                         &depData.updElt(0, static_cast<int>(j)));
+
+        table = std::make_shared<TimeSeriesTable>(times,
+                                                  depData,
+                                                  selectedLabels);
+    }
+    for(const auto& keyValue : metadata)
+        table->updTableMetaData().setValueForKey(keyValue.first,
+                                                 keyValue.second);
+
+    OutputTables output_tables{};
+    output_tables.emplace(tableString(), table);
+    return output_tables;
+}
+
+void
+OSTBFileAdapter::extendWrite(const InputTables& absTables,
+                             const std::string& fileName) const {
+    OPENSIM_THROW_IF(absTables.empty(),
+                     NoTableFound);
+
+    const TimeSeriesTable* table{};
+    try {
+        auto abs_table = absTables.at(tableString());
+        table = dynamic_cast<const TimeSeriesTable*>(abs_table);
+    } catch(std::out_of_range&) {
+        OPENSIM_THROW(KeyMissing,
+                      tableString());
+    }
+    OPENSIM_THROW_IF(table == nullptr,
+                     IncorrectTableType);
+
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+
+    std::ofstream out_stream{fileName, std::ios::binary | std::ios::trunc};
+
+    const size_t numRows = table->getNumRows();
+    const size_t numCols = table->getNumColumns();
+    const size_t rowsPerBlock = _rowsPerBlock;
+    const size_t numBlocks =
+            numRows == 0 ? 0 : (numRows + rowsPerBlock - 1) / rowsPerBlock;
+
+    writeBytes(out_stream, theMagic, sizeof(theMagic));
+    writeU32(out_stream, theVersion);
+    writeU32(out_stream, theByteOrderMark);
+    writeU64(out_stream, static_cast<uint64_t>(numRows));
+    writeU32(out_stream, static_cast<uint32_t>(numCols));
+    writeU32(out_stream, static_cast<uint32_t>(rowsPerBlock));
+
+    // Key-value metadata of the table. As with the .sto header, only
+    // string-valued entries are serialized.
+    const auto& metadata = table->getTableMetaData();
+    std::vector<std::pair<std::string, std::string>> stringMetaData{};
+    for(const auto& key : metadata.getKeys()) {
+        const auto* value = dynamic_cast<const SimTK::Value<std::string>*>(
+                &metadata.getValueForKey(key));
+        if(value != nullptr)
+            stringMetaData.emplace_back(key, value->get());
+    }
+    writeU32(out_stream, static_cast<uint32_t>(stringMetaData.size()));
+    for(const auto& keyValue : stringMetaData) {
+        writeString(out_stream, keyValue.first);
+        writeString(out_stream, keyValue.second);
+    }
+
+    for(const auto& label : table->getColumnLabels())
+        writeString(out_stream, label);
+
+    // Reserve the block index; it is back-patched once the block offsets
+    // are known.
+    const auto indexPos = out_stream.tellp();
+    {
+        const std::vector<char> zeros((numCols + 1) * numBlocks *
+                                              2 * sizeof(uint64_t),
+                                      '\0');
+        writeBytes(out_stream, zeros.data(), zeros.size());
+    }
+
+    std::vector<BlockEntry> entries{};
+    entries.reserve((numCols + 1) * numBlocks);
+    // Compress and append one on-disk column: the time column first, then
+    // each dependent column (contiguous in the table's storage).
+    auto encodeColumn = [&](const double* column) {
+        for(size_t b = 0; b < numBlocks; ++b) {
+            const size_t blockRows =
+                    std::min(rowsPerBlock, numRows - b * rowsPerBlock);
+            const auto packed = rleCompress(
+                    shuffleDoubles(column + b * rowsPerBlock, blockRows));
+            BlockEntry entry{};
+            entry.offset = static_cast<uint64_t>(
+                    static_cast<std::streamoff>(out_stream.tellp()));
+            entry.compressedSize = static_cast<uint64_t>(packed.size());
+            entries.push_back(entry);
+            writeBytes(out_stream, packed.data(), packed.size());
+        }
+    };
+    if(numRows > 0) {
+        encodeColumn(table->getIndependentColumn().data());
+        for(size_t i = 0; i < numCols; ++i)
+            encodeColumn(table->getDependentColumnSpan(i).cbegin());
+    }
+
+    out_stream.seekp(indexPos);
+    for(const auto& entry : entries) {
+        writeU64(out_stream, entry.offset);
+        writeU64(out_stream, entry.compressedSize);
+    }
+}
+
+} // namespace OpenSim
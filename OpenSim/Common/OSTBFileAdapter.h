@@ -0,0 +1,118 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  OSTBFileAdapter.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_OSTB_FILE_ADAPTER_H_
+#define OPENSIM_OSTB_FILE_ADAPTER_H_
+
+#include "FileAdapter.h"
+#include "TimeSeriesTable.h"
+
+namespace OpenSim {
+
+class OSTBFormatError : public IOError {
+public:
+    OSTBFormatError(const std::string& file,
+                    size_t line,
+                    const std::string& func,
+                    const std::string& filename,
+                    const std::string& detail) :
+        IOError(file, line, func) {
+        std::string msg = "Error reading file '" + filename + "'. " + detail;
+
+        addMessage(msg);
+    }
+};
+
+/** OSTBFileAdapter reads/writes OpenSim binary table (.ostb) files. The
+format is a compressed, columnar binary alternative to the .sto text format
+for TimeSeriesTable_<double>:
+
+ - Data are laid out column by column, and each column is split into
+   fixed-size blocks of rows. A block index at the start of the file records
+   the offset and compressed size of every block, so a reader can fetch a
+   subset of columns without touching the rest of the file.
+ - Each block is compressed by byte-shuffling the doubles (grouping the
+   first byte of every value, then the second byte, and so on) followed by
+   run-length encoding. Smoothly varying signals have near-constant
+   high-order bytes, so the shuffled planes compress well; the codec is
+   self-contained and needs no external compression library.
+ - The key-value metadata of the table is stored in the file, equivalent to
+   the header of a .sto file.
+
+The adapter is registered with extension "ostb", so
+FileAdapter::createAdapterFromExtension() and the TimeSeriesTable filename
+constructor both work with these files. To read only some of the columns,
+use readTable() with an explicit list of labels, or setColumnsToRead()
+before read(); the time column is always read.                               */
+class OSIMCOMMON_API OSTBFileAdapter : public FileAdapter {
+public:
+    OSTBFileAdapter()                                  = default;
+    OSTBFileAdapter(const OSTBFileAdapter&)            = default;
+    OSTBFileAdapter(OSTBFileAdapter&&)                 = default;
+    OSTBFileAdapter& operator=(const OSTBFileAdapter&) = default;
+    OSTBFileAdapter& operator=(OSTBFileAdapter&&)      = default;
+    ~OSTBFileAdapter()                                 = default;
+
+    OSTBFileAdapter* clone() const override;
+
+    /** Key of the table in the OutputTables container returned by read().    */
+    static const std::string tableString();
+
+    /** Write an OSTB file. rowsPerBlock is the number of rows per
+    compression block; it trades compression ratio (larger blocks) against
+    the granularity of partial reads.                                         */
+    static
+    void write(const TimeSeriesTable& table,
+               const std::string& fileName,
+               unsigned rowsPerBlock = 4096);
+
+    /** Read an OSTB file. If columns is non-empty, only the columns with the
+    given labels are read (in the given order); only the blocks of those
+    columns are fetched and decompressed.
+
+    \throws KeyNotFound If a requested column label is not in the file.       */
+    static
+    TimeSeriesTable readTable(const std::string& fileName,
+                              const std::vector<std::string>& columns = {});
+
+    /** Restrict read() to the columns with the given labels. An empty list
+    (the default) reads all columns.                                          */
+    void setColumnsToRead(const std::vector<std::string>& labels);
+    const std::vector<std::string>& getColumnsToRead() const;
+
+    /** Set the number of rows per compression block used by write().         */
+    void setRowsPerBlock(unsigned rowsPerBlock);
+    unsigned getRowsPerBlock() const;
+
+protected:
+    OutputTables extendRead(const std::string& fileName) const override;
+
+    void extendWrite(const InputTables& tables,
+                     const std::string& fileName) const override;
+
+private:
+    std::vector<std::string> _columnsToRead{};
+    unsigned _rowsPerBlock{4096};
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_OSTB_FILE_ADAPTER_H_
@@ -38,7 +38,12 @@
 #include "PropertyTransform.h"
 #include "Property_Deprecated.h"
 #include "XMLDocument.h"
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 using namespace OpenSim;
 using namespace std;
@@ -48,13 +53,187 @@ using SimTK::Transform;
 //=============================================================================
 // STATICS
 //=============================================================================
-ArrayPtrs<Object>           Object::_registeredTypes;
-std::map<string,Object*>    Object::_mapTypesToDefaultObjects;
-std::map<string,string>     Object::_renamedTypesMap;
-
 bool                        Object::_serializeAllDefaults=false;
 const string                Object::DEFAULT_NAME(ObjectDEFAULT_NAME);
 
+//=============================================================================
+// TYPE REGISTRY
+//=============================================================================
+namespace {
+
+// The type registry is maintained copy-on-write: readers (most importantly
+// newInstanceOfType(), which is hit for every element of every model being
+// deserialized) grab the current immutable snapshot without taking a lock,
+// while writers (registerType(), renameType()) copy the tables, apply their
+// change under a mutex that only serializes writers, and atomically publish
+// the new snapshot. Registration is effectively confined to library load
+// time, so writer contention is a non-issue; the payoff is that concurrent
+// loader threads never contend on registry access.
+struct TypeRegistry {
+    // Default instances in registration order; each type appears once.
+    // Renamed types usually do not have separate default objects; they are
+    // just used to locate one of the current ones.
+    std::vector<Object*> registeredTypes;
+
+    // Map from concrete object class name string to a default object of that
+    // type kept in registeredTypes. Renamed types are *not* normally entered
+    // here; the names are mapped separately using the map below.
+    std::map<std::string, Object*> typesToDefaultObjects;
+
+    // Map types that have been renamed to their new names, which can then be
+    // used to find them in the default object map. This lets us recognize the
+    // old names while converting to the new ones internally so that they will
+    // be updated when written out.
+    std::map<std::string, std::string> renamedTypes;
+};
+
+// Serializes registry *writers* only; never taken on the read path.
+std::mutex& getRegistryUpdateMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// The published snapshot. Accessed only through loadTypeRegistry() /
+// storeTypeRegistry() below, which use the shared_ptr atomic-access
+// functions so readers and writers need no common lock.
+std::shared_ptr<const TypeRegistry>& getTypeRegistrySlot() {
+    static std::shared_ptr<const TypeRegistry> snapshot =
+            std::make_shared<TypeRegistry>();
+    return snapshot;
+}
+
+std::shared_ptr<const TypeRegistry> loadTypeRegistry() {
+    return std::atomic_load(&getTypeRegistrySlot());
+}
+
+void storeTypeRegistry(std::shared_ptr<const TypeRegistry> snapshot) {
+    std::atomic_store(&getTypeRegistrySlot(),
+            std::shared_ptr<const TypeRegistry>(std::move(snapshot)));
+}
+
+} // namespace
+
+//=============================================================================
+// OBJECT ALLOCATION ARENA
+//=============================================================================
+namespace {
+
+// Every block handed out by ObjectAllocationArena::allocate() is preceded by
+// a header recording where it came from, so deallocate() can route it back
+// correctly regardless of whether an arena is active (or even alive) at
+// deletion time. The header is max_align_t-aligned so the caller-visible
+// storage that follows it stays suitably aligned for any object.
+struct alignas(std::max_align_t) BlockHeader {
+    int bucket; // pool bucket index, or -1 if from the global heap
+};
+
+// Blocks up to MinBucketBytes<<(NumBuckets-1) == 2048 bytes come from the
+// pool; anything larger (rare for Object/property nodes) falls back to the
+// global heap.
+const int    NumBuckets     = 8;
+const size_t MinBucketBytes = 16;
+const size_t ChunkBytes     = 64*1024;
+
+size_t bucketBytes(int bucket) { return MinBucketBytes << bucket; }
+
+// The process-global pool. Backing chunks are only ever appended and are
+// released at process exit; freed blocks go onto per-bucket free lists for
+// reuse. A single mutex guards the pool: pooled allocation is only enabled
+// within an arena (typically one deserialization per thread), so contention
+// is low and the win comes from bump-pointer carving and block reuse.
+struct ObjectPool {
+    std::mutex mutex;
+    std::vector<char*> chunks;
+    void* freeLists[NumBuckets];
+    char* bumpCursor;
+    size_t bumpRemaining;
+
+    ObjectPool() : bumpCursor(nullptr), bumpRemaining(0) {
+        for (int i = 0; i < NumBuckets; ++i)
+            freeLists[i] = nullptr;
+    }
+};
+
+ObjectPool& getObjectPool() {
+    // Intentionally never destroyed: pooled objects may be deleted during
+    // static destruction (whose cross-translation-unit order is undefined),
+    // so the pool must outlive every Object in the process. The OS reclaims
+    // the chunks at process exit.
+    static ObjectPool* pool = new ObjectPool();
+    return *pool;
+}
+
+// Number of live ObjectAllocationArena objects on this thread; pooled
+// allocation is active while nonzero.
+thread_local int threadArenaDepth = 0;
+
+} // namespace
+
+ObjectAllocationArena::ObjectAllocationArena() {
+    ++threadArenaDepth;
+}
+
+ObjectAllocationArena::~ObjectAllocationArena() {
+    --threadArenaDepth;
+}
+
+bool ObjectAllocationArena::isActive() {
+    return threadArenaDepth > 0;
+}
+
+void* ObjectAllocationArena::allocate(std::size_t numBytes) {
+    const size_t totalBytes = sizeof(BlockHeader) + numBytes;
+
+    int bucket = -1;
+    if (threadArenaDepth > 0 && totalBytes <= bucketBytes(NumBuckets-1)) {
+        bucket = 0;
+        while (bucketBytes(bucket) < totalBytes)
+            ++bucket;
+    }
+
+    BlockHeader* header = nullptr;
+    if (bucket >= 0) {
+        ObjectPool& pool = getObjectPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        if (pool.freeLists[bucket]) {
+            // reuse a previously-freed block of this size
+            header = static_cast<BlockHeader*>(pool.freeLists[bucket]);
+            pool.freeLists[bucket] = *static_cast<void**>(pool.freeLists[bucket]);
+        } else {
+            if (pool.bumpRemaining < bucketBytes(bucket)) {
+                char* chunk = static_cast<char*>(::operator new(ChunkBytes));
+                pool.chunks.push_back(chunk);
+                pool.bumpCursor = chunk;
+                pool.bumpRemaining = ChunkBytes;
+            }
+            header = reinterpret_cast<BlockHeader*>(pool.bumpCursor);
+            pool.bumpCursor += bucketBytes(bucket);
+            pool.bumpRemaining -= bucketBytes(bucket);
+        }
+    } else {
+        header = static_cast<BlockHeader*>(::operator new(totalBytes));
+    }
+
+    header->bucket = bucket;
+    return header + 1;
+}
+
+void ObjectAllocationArena::deallocate(void* ptr) {
+    if (!ptr) return;
+
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+    if (header->bucket < 0) {
+        ::operator delete(header);
+        return;
+    }
+
+    ObjectPool& pool = getObjectPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    *reinterpret_cast<void**>(header) = pool.freeLists[header->bucket];
+    pool.freeLists[header->bucket] = header;
+}
+
 //=============================================================================
 // CONSTRUCTOR(S)
 //=============================================================================
@@ -190,6 +369,7 @@ Object& Object::operator=(const Object& source)
         _authors        = source._authors;
         _references     = source._references;
         _propertyTable  = source._propertyTable;
+        _localStructuralHashValid = false;
 
         delete _document; _document = NULL;
         _inlined = true; // meaning: not associated to an XML document
@@ -210,6 +390,8 @@ void Object::setNull()
     _propertySet.clear();
     _propertyTable.clear();
     _objectIsUpToDate = false;
+    _localStructuralHash = 0;
+    _localStructuralHashValid = false;
 
     _name = "";
     _description = "";
@@ -304,6 +486,7 @@ void Object::
 setName(const string &aName)
 {
     _name = aName;
+    _localStructuralHashValid = false;
 }
 //_____________________________________________________________________________
 /**
@@ -394,6 +577,7 @@ updPropertyByIndex(int propertyIndex) {
 
     // A property is being modified.
     _objectIsUpToDate = false;
+    _localStructuralHashValid = false;
 
     // TODO: remove deprecated code from here ...
     if (propertyIndex >= _propertyTable.getNumProperties()) {
@@ -443,6 +627,7 @@ AbstractProperty& Object::
 updPropertyByName(const std::string& name) {
     // A property is being modified.
     _objectIsUpToDate = false;
+    _localStructuralHashValid = false;
 
     AbstractProperty* p = _propertyTable.updPropertyPtr(name);
     if (p) return *p;
@@ -505,44 +690,57 @@ registerType(const Object& aObject)
     }
     log_debug("Object.registerType: {}.", type);
 
+    Object* defaultObj = aObject.clone();
+    defaultObj->setName(DEFAULT_NAME);
+
+    std::lock_guard<std::mutex> lock(getRegistryUpdateMutex());
+    auto registry = std::make_shared<TypeRegistry>(*loadTypeRegistry());
+
     // REPLACE IF A MATCHING TYPE IS ALREADY REGISTERED
-    for(int i=0; i <_registeredTypes.size(); ++i) {
-        Object *object = _registeredTypes.get(i);
-        if(object->getConcreteClassName() == type) {
+    // Note that the previous default object is *not* deleted: readers working
+    // from an earlier snapshot may still be holding it. Re-registration only
+    // happens when a library re-registers a type it shadows, so the leak is
+    // bounded and tiny.
+    bool replaced = false;
+    for (size_t i = 0; i < registry->registeredTypes.size(); ++i) {
+        if (registry->registeredTypes[i]->getConcreteClassName() == type) {
             log_debug("Object.registerType: replacing registered object of "
                       "type {} with a new default object of the same type.",
                       type);
-            Object* defaultObj = aObject.clone();
-            defaultObj->setName(DEFAULT_NAME);
-            _registeredTypes.set(i,defaultObj);
-            _mapTypesToDefaultObjects[type]= defaultObj;
-            return;
-        } 
+            registry->registeredTypes[i] = defaultObj;
+            replaced = true;
+            break;
+        }
     }
 
     // REGISTERING FOR THE FIRST TIME -- APPEND
-    Object* defaultObj = aObject.clone();
-    defaultObj->setName(DEFAULT_NAME);
-    _registeredTypes.append(defaultObj);
-    _mapTypesToDefaultObjects[type]= defaultObj;
+    if (!replaced)
+        registry->registeredTypes.push_back(defaultObj);
+
+    registry->typesToDefaultObjects[type] = defaultObj;
+    storeTypeRegistry(std::move(registry));
 }
 
 /*static*/ void Object::
 renameType(const std::string& oldTypeName, const std::string& newTypeName)
 {
     if(oldTypeName == newTypeName)
-        return; 
+        return;
+
+    std::lock_guard<std::mutex> lock(getRegistryUpdateMutex());
+    auto registry = std::make_shared<TypeRegistry>(*loadTypeRegistry());
 
-    std::map<std::string,Object*>::const_iterator p = 
-        _mapTypesToDefaultObjects.find(newTypeName);
+    std::map<std::string,Object*>::const_iterator p =
+        registry->typesToDefaultObjects.find(newTypeName);
 
-    if (p == _mapTypesToDefaultObjects.end())
+    if (p == registry->typesToDefaultObjects.end())
         throw OpenSim::Exception(
             "Object::renameType(): illegal attempt to rename object type "
             + oldTypeName + " to " + newTypeName + " which is unregistered.",
             __FILE__, __LINE__);
 
-    _renamedTypesMap[oldTypeName] = newTypeName;
+    registry->renamedTypes[oldTypeName] = newTypeName;
+    storeTypeRegistry(std::move(registry));
 }
 
 /*static*/ const Object* Object::
@@ -550,15 +748,19 @@ getDefaultInstanceOfType(const std::string& objectTypeTag) {
     std::string actualName = objectTypeTag;
     bool wasRenamed = false; // for a better error message
 
+    // Work from a single snapshot so the lookups below are consistent with
+    // one another even if a writer publishes a new registry meanwhile.
+    const std::shared_ptr<const TypeRegistry> registry = loadTypeRegistry();
+
     // First apply renames if any.
 
     // Avoid an infinite loop if there is a cycle in the rename table.
-    const int MaxRenames = (int)_renamedTypesMap.size();
+    const int MaxRenames = (int)registry->renamedTypes.size();
     int renameCount = 0;
     while(true) {
         std::map<std::string,std::string>::const_iterator newNamep =
-            _renamedTypesMap.find(actualName);
-        if (newNamep == _renamedTypesMap.end())
+            registry->renamedTypes.find(actualName);
+        if (newNamep == registry->renamedTypes.end())
             break; // actualName has not been renamed
 
         if (++renameCount > MaxRenames) {
@@ -572,9 +774,9 @@ getDefaultInstanceOfType(const std::string& objectTypeTag) {
     }
 
     // Look up the "actualName" default object and return it.
-    std::map<std::string,Object*>::const_iterator p = 
-        _mapTypesToDefaultObjects.find(actualName);
-    if (p != _mapTypesToDefaultObjects.end())
+    std::map<std::string,Object*>::const_iterator p =
+        registry->typesToDefaultObjects.find(actualName);
+    if (p != registry->typesToDefaultObjects.end())
         return p->second;
 
     // The requested object was not registered. That's OK normally but is
@@ -622,14 +824,26 @@ newInstanceOfType(const std::string& objectTypeTag)
 /*static*/ void Object::
 getRegisteredTypenames(Array<std::string>& rTypeNames)
 {
-    std::map<string,Object*>::const_iterator p = 
-        _mapTypesToDefaultObjects.begin();
-    for (; p != _mapTypesToDefaultObjects.end(); ++p)
+    const std::shared_ptr<const TypeRegistry> registry = loadTypeRegistry();
+    std::map<string,Object*>::const_iterator p =
+        registry->typesToDefaultObjects.begin();
+    for (; p != registry->typesToDefaultObjects.end(); ++p)
         rTypeNames.append(p->first);
     // Renamed type names don't appear in the registeredTypes map, unless
     // they were separately registered.
 }
 
+/*
+ * getRegisteredTypeDefaults() hands the header-side template
+ * getRegisteredObjectsOfGivenType() a copy of the registration-order default
+ * instances from the current registry snapshot.
+ */
+/*static*/ std::vector<Object*> Object::
+getRegisteredTypeDefaults()
+{
+    return loadTypeRegistry()->registeredTypes;
+}
+
 //=============================================================================
 // XML
 //=============================================================================
@@ -1412,13 +1626,11 @@ PrintPropertyInfo(ostream &aOStream,
 
     if(aClassName=="") {
         // NO CLASS
-        int size = _registeredTypes.getSize();
-        ss<<"REGISTERED CLASSES ("<<size<<")\n";
-        Object *obj;
-        for(int i=0;i<size;i++) {
-            obj = _registeredTypes.get(i);
-            if(obj==NULL) continue;
-            ss<<obj->getConcreteClassName()<<endl;
+        const std::vector<Object*> defaults = getRegisteredTypeDefaults();
+        ss<<"REGISTERED CLASSES ("<<defaults.size()<<")\n";
+        for(size_t i=0;i<defaults.size();i++) {
+            if(defaults[i]==NULL) continue;
+            ss<<defaults[i]->getConcreteClassName()<<endl;
         }
         if (printFlagInfo) {
             ss<<"\n\nUse '-PropertyInfo ClassName' to list the properties of a particular class.\n\n";
@@ -1619,6 +1831,158 @@ makeObjectFromFile(const std::string &aFileName)
     }
 }
 
+//=============================================================================
+// BINARY OBJECT FORMAT
+//=============================================================================
+// File layout (version 1): an 8-byte magic, the format version, the OpenSim
+// document version the writer was built with (recorded for diagnostics), and
+// then one recursive object record: concrete class name, the name /
+// description / authors / references strings, and each property as its name,
+// type name, use-default flag, and value list (see
+// AbstractProperty::writeToBinaryStream()). Values are in the machine's
+// native layout; the format is a same-architecture load-time cache.
+namespace {
+const char binaryFormatMagic[8] = {'O','S','I','M','B','I','N','\0'};
+const int  binaryFormatVersion  = 1;
+}
+
+void Object::printBinary(const std::string& fileName) const
+{
+    std::ofstream out(fileName.c_str(),
+            std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw Exception("Object::printBinary(): could not open file '"
+            + fileName + "' for writing.", __FILE__, __LINE__);
+
+    out.write(binaryFormatMagic, sizeof(binaryFormatMagic));
+    writeBinaryRaw(out, binaryFormatVersion);
+    writeBinaryRaw(out, XMLDocument::getLatestVersion());
+    writeObjectToBinaryStream(out);
+
+    if (!out)
+        throw Exception("Object::printBinary(): failed while writing '"
+            + fileName + "'.", __FILE__, __LINE__);
+}
+
+Object* Object::makeObjectFromBinaryFile(const std::string& fileName)
+{
+    std::ifstream in(fileName.c_str(), std::ios::binary);
+    if (!in)
+        throw Exception("Object::makeObjectFromBinaryFile(): could not open "
+            "file '" + fileName + "' for reading.", __FILE__, __LINE__);
+
+    char magic[sizeof(binaryFormatMagic)];
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, binaryFormatMagic, sizeof(magic)) != 0)
+        throw Exception("Object::makeObjectFromBinaryFile(): '" + fileName
+            + "' is not an OpenSim binary object file.", __FILE__, __LINE__);
+
+    int formatVersion = 0;
+    readBinaryRaw(in, formatVersion);
+    if (!in || formatVersion < 1 || formatVersion > binaryFormatVersion)
+        throw Exception("Object::makeObjectFromBinaryFile(): '" + fileName
+            + "' was written by an unsupported binary format version ("
+            + std::to_string(formatVersion) + "; this build supports up to "
+            + std::to_string(binaryFormatVersion) + ").", __FILE__, __LINE__);
+
+    int documentVersion = 0;
+    readBinaryRaw(in, documentVersion); // recorded for diagnostics only
+
+    Object* object = newObjectFromBinaryStream(in, formatVersion);
+    if (!in) {
+        delete object;
+        throw Exception("Object::makeObjectFromBinaryFile(): file '"
+            + fileName + "' is truncated or corrupt.", __FILE__, __LINE__);
+    }
+    return object;
+}
+
+void Object::writeObjectToBinaryStream(std::ostream& out) const
+{
+    if (_propertySet.getSize() > 0)
+        throw Exception("Object::printBinary(): "
+            + getConcreteClassName() + " still uses deprecated properties, "
+            "which cannot be written in the binary object format.",
+            __FILE__, __LINE__);
+
+    writeBinaryPropertyValue(out, getConcreteClassName());
+    writeBinaryPropertyValue(out, getName());
+    writeBinaryPropertyValue(out, getDescription());
+    writeBinaryPropertyValue(out, getAuthors());
+    writeBinaryPropertyValue(out, getReferences());
+
+    writeBinaryRaw(out, getNumProperties());
+    for (int i = 0; i < getNumProperties(); ++i) {
+        const AbstractProperty& prop = getPropertyByIndex(i);
+        writeBinaryPropertyValue(out, prop.getName());
+        writeBinaryPropertyValue(out, prop.getTypeName());
+        writeBinaryPropertyValue(out, prop.getValueIsDefault());
+        prop.writeToBinaryStream(out);
+    }
+}
+
+Object* Object::newObjectFromBinaryStream(std::istream& in,
+                                          int formatVersion)
+{
+    std::string className;
+    readBinaryPropertyValue(in, className);
+    if (!in)
+        throw Exception("Object::newObjectFromBinaryStream(): stream is "
+            "truncated or corrupt.", __FILE__, __LINE__);
+
+    // Throws if the type was never registered, just like XML deserialization.
+    Object* object = newInstanceOfType(className);
+    try {
+        object->readObjectFromBinaryStream(in, formatVersion);
+    } catch (...) {
+        delete object;
+        throw;
+    }
+    return object;
+}
+
+void Object::readObjectFromBinaryStream(std::istream& in, int formatVersion)
+{
+    std::string str;
+    readBinaryPropertyValue(in, str); setName(str);
+    readBinaryPropertyValue(in, str); setDescription(str);
+    readBinaryPropertyValue(in, str); setAuthors(str);
+    readBinaryPropertyValue(in, str); setReferences(str);
+
+    int numProperties = 0;
+    readBinaryRaw(in, numProperties);
+    if (!in || numProperties < 0)
+        throw Exception("Object::readObjectFromBinaryStream(): stream is "
+            "truncated or corrupt.", __FILE__, __LINE__);
+
+    for (int i = 0; i < numProperties; ++i) {
+        std::string propName, typeName;
+        bool isDefault = false;
+        readBinaryPropertyValue(in, propName);
+        readBinaryPropertyValue(in, typeName);
+        readBinaryPropertyValue(in, isDefault);
+        if (!in)
+            throw Exception("Object::readObjectFromBinaryStream(): stream "
+                "is truncated or corrupt.", __FILE__, __LINE__);
+
+        if (!hasProperty(propName))
+            throw Exception("Object::readObjectFromBinaryStream(): "
+                + getConcreteClassName() + " has no property named '"
+                + propName + "'; the file does not match this build.",
+                __FILE__, __LINE__);
+
+        AbstractProperty& prop = updPropertyByName(propName);
+        if (prop.getTypeName() != typeName)
+            throw Exception("Object::readObjectFromBinaryStream(): property "
+                "'" + propName + "' has type " + prop.getTypeName()
+                + " but the file recorded " + typeName + "; the file does "
+                "not match this build.", __FILE__, __LINE__);
+
+        prop.readFromBinaryStream(in, formatVersion);
+        prop.setValueIsDefault(isDefault);
+    }
+}
+
 void Object::makeObjectNamesConsistentWithProperties()
 {
     bool prevDirtyFlag = isObjectUpToDateWithProperties();
@@ -1661,6 +2025,53 @@ void Object::setObjectIsUpToDateWithProperties()
     _objectIsUpToDate = true;
 }
 
+std::uint64_t Object::getStructuralHash() const
+{
+    // FNV-1a.
+    auto mix = [](std::uint64_t hash, const std::string& text) {
+        for (const unsigned char c : text) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    };
+    auto mixHash = [](std::uint64_t hash, std::uint64_t value) {
+        for (int byte = 0; byte < 8; ++byte) {
+            hash ^= (value >> (8 * byte)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    };
+
+    if (!_localStructuralHashValid) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        hash = mix(hash, getConcreteClassName());
+        hash = mix(hash, getName());
+        for (int i = 0; i < _propertyTable.getNumProperties(); ++i) {
+            const AbstractProperty& prop =
+                    _propertyTable.getAbstractPropertyByIndex(i);
+            hash = mix(hash, prop.getName());
+            if (!prop.isObjectProperty())
+                hash = mix(hash, prop.toString());
+        }
+        _localStructuralHash = hash;
+        _localStructuralHashValid = true;
+    }
+
+    // Object-valued properties are combined on every query: a mutation deep
+    // in the tree cannot invalidate its owners' caches from below, so only
+    // the local content above is cached.
+    std::uint64_t hash = _localStructuralHash;
+    for (int i = 0; i < _propertyTable.getNumProperties(); ++i) {
+        const AbstractProperty& prop =
+                _propertyTable.getAbstractPropertyByIndex(i);
+        if (!prop.isObjectProperty()) continue;
+        for (int j = 0; j < prop.size(); ++j)
+            hash = mixHash(hash, prop.getValueAsObject(j).getStructuralHash());
+    }
+    return hash;
+}
+
 void Object::updateFromXMLDocument()
 {
     assert(_document != nullptr);
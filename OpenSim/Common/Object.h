@@ -40,8 +40,10 @@
 #include "PropertyTable.h"
 #include "Property.h"
 
+#include <cstdint>
 #include <cstring>
 #include <cassert>
+#include <vector>
 
 // DISABLES MULTIPLE INSTANTIATION WARNINGS
 
@@ -82,6 +84,58 @@ const char ObjectDEFAULT_NAME[] = "default";
 
 class XMLDocument;
 
+//==============================================================================
+//                        OBJECT ALLOCATION ARENA
+//==============================================================================
+/** Opt-in pooled allocation for %Object and property trees.
+
+Deserializing a large model allocates hundreds of thousands of small %Object
+and AbstractProperty nodes individually, so allocator overhead and heap
+fragmentation dominate load time when many models are loaded in one process.
+While an %ObjectAllocationArena is alive on a thread, every %Object and
+AbstractProperty created on that thread is carved out of a pool of large,
+size-bucketed chunks instead of being heap-allocated individually:
+
+@code
+{
+    ObjectAllocationArena arena;
+    Model model("subject01_scaled.osim");
+    // ... the model's object/property tree was pool-allocated
+}
+@endcode
+
+Objects allocated from the pool may safely outlive the arena and may be
+deleted from any thread; deletion returns their storage to the pool for reuse
+by later arenas. The pool's backing chunks are released only at process exit.
+Arenas may be nested; pooling is active until the outermost arena on the
+thread is destroyed. **/
+class OSIMCOMMON_API ObjectAllocationArena {
+public:
+    /** Activate pooled allocation on the calling thread. **/
+    ObjectAllocationArena();
+    /** Deactivate pooled allocation (if this is the outermost arena on the
+    calling thread). **/
+    ~ObjectAllocationArena();
+
+    ObjectAllocationArena(const ObjectAllocationArena&) = delete;
+    ObjectAllocationArena& operator=(const ObjectAllocationArena&) = delete;
+
+    /** Whether an arena is active on the calling thread. **/
+    static bool isActive();
+
+private:
+    friend class Object;
+    friend class AbstractProperty;
+
+    // Allocation entry points used by the class-level operator new/delete of
+    // Object and AbstractProperty. allocate() falls back to the global heap
+    // when no arena is active on the calling thread (or the request is too
+    // large for the pool); deallocate() routes each block back to wherever it
+    // came from.
+    static void* allocate(std::size_t numBytes);
+    static void deallocate(void* ptr);
+};
+
 //==============================================================================
 //                                 OBJECT
 //==============================================================================
@@ -204,6 +258,23 @@ public:
      */
     virtual ~Object();
 
+#ifndef SWIG
+    /** All single-object allocations of %Object-derived classes are routed
+    through the (possibly pool-backed) ObjectAllocationArena machinery; see
+    ObjectAllocationArena for details. When no arena is active on the calling
+    thread this behaves like the global operator new. **/
+    void* operator new(std::size_t numBytes)
+    {   return ObjectAllocationArena::allocate(numBytes); }
+    /** Return storage obtained from operator new; blocks are routed back to
+    the pool or the global heap, whichever they came from. **/
+    void operator delete(void* ptr)
+    {   ObjectAllocationArena::deallocate(ptr); }
+    /** Placement new passes through unchanged. **/
+    void* operator new(std::size_t, void* ptr) noexcept { return ptr; }
+    /** Placement delete counterpart (called only if a constructor throws). **/
+    void operator delete(void*, void*) noexcept {}
+#endif
+
     /** Create a new heap-allocated copy of the concrete object to which this 
     %Object refers. It is up to the caller to delete the returned object
     when no longer needed. Every concrete object deriving from %Object 
@@ -352,6 +423,17 @@ public:
     setObjectIsUpToDateWithProperties() was called. **/
     bool isObjectUpToDateWithProperties() const {return _objectIsUpToDate;}
 
+    /** A 64-bit hash of this object's structural content: its concrete class
+    name, its name, and every property's value, recursing into object-valued
+    properties. Two objects with equal hashes are structurally identical for
+    caching purposes (up to hash collisions), without serializing either one
+    to XML for comparison. Each object caches the hash of its own local
+    content and invalidates it when a property may have changed, so querying
+    an unmodified tree costs one shallow traversal that combines cached
+    per-object values; only subtrees that were actually mutated are
+    re-hashed. **/
+    std::uint64_t getStructuralHash() const;
+
     /** Dump formatted property information to a given output stream, useful
     for creating a "help" facility for registered objects. Object name, 
     property name, and property comment are output. Input is a
@@ -468,12 +550,13 @@ public:
     (concrete) %Object types that derive from a given %Object-derived type 
     that does not have to be concrete. This is useful, for example, to find 
     all Joints, Constraints, ModelComponents, Analyses, etc. **/
-    template<class T> static void 
+    template<class T> static void
     getRegisteredObjectsOfGivenType(ArrayPtrs<T>& rArray) {
         rArray.setSize(0);
         rArray.setMemoryOwner(false);
-        for(int i=0; i<_registeredTypes.getSize(); i++) {
-            T* obj = dynamic_cast<T*>(_registeredTypes[i]);
+        const std::vector<Object*> defaults = getRegisteredTypeDefaults();
+        for(size_t i=0; i<defaults.size(); i++) {
+            T* obj = dynamic_cast<T*>(defaults[i]);
             if (obj) rArray.append(obj);
         }
     }
@@ -494,6 +577,42 @@ public:
     uses the defaults table to get an instance. **/
     static Object* makeObjectFromFile(const std::string& fileName);
 
+    /** Write this object, including all its contained objects, to a file in
+    the %OpenSim binary object format. The binary format snapshots the
+    property tree as-is with no DOM construction or text parsing, so reading
+    it back with makeObjectFromBinaryFile() is much faster than XML
+    deserialization; use it as a load-time cache for models that are opened
+    repeatedly. The format is versioned but records values in the machine's
+    native layout, so treat the files as same-architecture caches rather
+    than archives; ".osim" XML remains the interchange format. Converting
+    between the formats is a read with one method followed by a write with
+    the other. Objects still carrying deprecated (PropertySet) properties
+    cannot be written in the binary format and cause an exception. **/
+    void printBinary(const std::string& fileName) const;
+
+    /** Create an %OpenSim object from a file written by printBinary(). The
+    object's concrete type is recorded in the file; as with XML
+    deserialization, that type must have been registered. Throws if the file
+    cannot be opened, is not a binary object file, or was written by an
+    incompatible (newer) format version. The caller owns the returned
+    object. **/
+    static Object* makeObjectFromBinaryFile(const std::string& fileName);
+
+#ifndef SWIG
+    /** (Advanced) Write this object to an already-open stream in the binary
+    object format, without the file header. This is the recursion step used
+    by printBinary() and by object-valued properties; most callers want
+    printBinary(). **/
+    void writeObjectToBinaryStream(std::ostream& out) const;
+
+    /** (Advanced) Instantiate and read the next object from a binary stream
+    positioned at an object record written by writeObjectToBinaryStream().
+    The caller owns the returned object. Most callers want
+    makeObjectFromBinaryFile(). **/
+    static Object* newObjectFromBinaryStream(std::istream& in,
+                                             int formatVersion);
+#endif
+
     /** We're given an XML element from which we are to populate this %Object.
     If the element has a \c file attribute, we'll instead read the %Object from
     that file. Otherwise we'll invoke updateFromXMLNode() to read the %Object
@@ -556,6 +675,7 @@ protected:
     however, see setObjectIsUpToDateWithProperties(). **/
     void clearObjectIsUpToDateWithProperties() {
         _objectIsUpToDate = false;
+        _localStructuralHashValid = false;
     }
 
     /** Make sure the name of an object is consistent with its property type. A
@@ -829,7 +949,17 @@ protected:
 private:
     void setNull();
 
-    // Functions to support deserialization. 
+    // Returns a copy of the default instances of all registered types, in
+    // registration order, taken from the current registry snapshot (the
+    // registry itself lives in Object.cpp; see the TypeRegistry comments
+    // there for the copy-on-write scheme that makes reads lock-free).
+    static std::vector<Object*> getRegisteredTypeDefaults();
+
+    // Reads the body of an object record (everything after the concrete
+    // class name) from a binary stream; see newObjectFromBinaryStream().
+    void readObjectFromBinaryStream(std::istream& in, int formatVersion);
+
+    // Functions to support deserialization.
     void generateXMLDocument();
 
     void updateDefaultObjectsFromXMLNode();
@@ -857,28 +987,13 @@ protected:
     PropertySet _propertySet;
 
 private:
-    // Array holding a default value for each of the registered object types. 
-    // Each object type only appears once in this array. Renamed types usually
-    // do not have separate registered objects; they are just used to locate 
-    // one of the current ones.
-    static ArrayPtrs<Object>                    _registeredTypes;
-
-    // Map from concrete object class name string to a default object of that 
-    // type kept in the above array of registered types. Renamed types are *not* 
-    // normally entered here; the names are mapped separately using the map 
-    // below.
-    static std::map<std::string,Object*>        _mapTypesToDefaultObjects;
-
-    // Map types that have been renamed to their new names, which can
-    // then be used to find them in the default object map. This lets us 
-    // recognize the old names while converting to the new ones internally
-    // so that they will be updated when written out. It also allows one 
-    // to map one registered type to a different one programmatically, because
-    // we'll look up the name in the rename table first prior to searching
-    // the registered types list.
-    static std::map<std::string,std::string>    _renamedTypesMap;
-
-    // Global flag to indicate if all registered objects are to be written in 
+    // The tables of registered types, their default instances, and renamed
+    // type names live in Object.cpp as an immutable, atomically-published
+    // snapshot that is copied and replaced on each registration or rename,
+    // so that lookups (notably newInstanceOfType() during deserialization)
+    // never need to lock.
+
+    // Global flag to indicate if all registered objects are to be written in
     // a "defaults" section.
     static bool _serializeAllDefaults;
 
@@ -894,10 +1009,19 @@ private:
 
     // Property table for serializable properties of this and derived classes.
     PropertyTable   _propertyTable;
-    // This flag is cleared automatically whenever a property is changed. It 
+    // This flag is cleared automatically whenever a property is changed. It
     // is initialized to false and is only set manually.
     bool            _objectIsUpToDate;
 
+    // Cached hash of this object's local structural content (class name,
+    // name, and non-object property values); invalidated alongside
+    // _objectIsUpToDate whenever a property may have changed. Subtree hashes
+    // of object-valued properties are combined on the fly by
+    // getStructuralHash(), since a child cannot invalidate its owner's cache
+    // from below.
+    mutable std::uint64_t   _localStructuralHash;
+    mutable bool            _localStructuralHashValid;
+
     // The XML document, if any, associated with this object.
     // This is mutable since it's cached on deserialization and is 
     // kept up to date to maintain "defaults" and document file path
@@ -940,6 +1064,7 @@ getProperty(const PropertyIndex& index) const {
 template <class T> Property<T>& Object::
 updProperty(const PropertyIndex& index) {
     _objectIsUpToDate = false; // property may be changed
+    _localStructuralHashValid = false;
     return _propertyTable.updProperty<T>(index);
 }
 
@@ -1428,14 +1553,51 @@ ObjectProperty<T>::readFromXMLElement
 
 // Each object value serializes itself into a subelement of the given
 // property element.
-template <class T> inline void 
+template <class T> inline void
 ObjectProperty<T>::writeToXMLElement
-    (SimTK::Xml::Element& propertyElement) const 
+    (SimTK::Xml::Element& propertyElement) const
 {
     for (int i=0; i < objects.size(); ++i)
         (objects[i])->updateXMLNode(propertyElement);
 }
 
+#ifndef SWIG
+// Binary format: a value count followed by each object's record, written
+// recursively.
+template <class T> inline void
+ObjectProperty<T>::writeToBinaryStream(std::ostream& out) const
+{
+    writeBinaryRaw(out, int(objects.size()));
+    for (int i=0; i < objects.size(); ++i)
+        objects[i]->writeObjectToBinaryStream(out);
+}
+
+template <class T> inline void
+ObjectProperty<T>::readFromBinaryStream(std::istream& in, int formatVersion)
+{
+    clearValues();
+    int n = 0;
+    readBinaryRaw(in, n);
+    if (!in || n < this->getMinListSize() || n > this->getMaxListSize())
+        throw OpenSim::Exception(
+            "ObjectProperty<T>::readFromBinaryStream(): corrupt value "
+            "count for property " + this->getName() + ".");
+    for (int i=0; i < n; ++i) {
+        Object* object = Object::newObjectFromBinaryStream(in, formatVersion);
+        T* objectT = dynamic_cast<T*>(object);
+        if (objectT == NULL) {
+            const std::string className = object->getConcreteClassName();
+            delete object;
+            throw OpenSim::Exception(
+                "ObjectProperty<T>::readFromBinaryStream(): object of type "
+                + className + " can't be stored in this " + objectClassName
+                + " property " + this->getName() + ".");
+        }
+        adoptAndAppendValueVirtual(objectT); // don't copy
+    }
+}
+#endif // SWIG
+
 
 template <class T> inline void 
 ObjectProperty<T>::setValueAsObject(const Object& obj, int index) {
@@ -0,0 +1,322 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  ParquetFileAdapter.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ParquetFileAdapter.h"
+
+#ifdef WITH_ARROW
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/statistics.h>
+
+namespace OpenSim {
+
+namespace {
+
+const std::string theTimeLabel{"time"};
+
+void throwIfNotOk(const arrow::Status& status, const std::string& fileName) {
+    OPENSIM_THROW_IF(!status.ok(),
+                     IOError,
+                     "Error accessing file '" + fileName + "': " +
+                             status.ToString());
+}
+
+// Wrap a contiguous column of doubles as an Arrow array without copying.
+// The wrapped memory must stay alive until the array has been written out.
+std::shared_ptr<arrow::Array> wrapColumn(const double* data, size_t numRows) {
+    return std::make_shared<arrow::DoubleArray>(
+            static_cast<int64_t>(numRows),
+            arrow::Buffer::Wrap(data, numRows));
+}
+
+// Append the values of one (possibly chunked) float64 column to dest.
+void flattenColumn(const arrow::ChunkedArray& column,
+                   std::vector<double>& dest,
+                   const std::string& fileName) {
+    for(int c = 0; c < column.num_chunks(); ++c) {
+        const auto& chunk = *column.chunk(c);
+        OPENSIM_THROW_IF(chunk.type_id() != arrow::Type::DOUBLE,
+                         IOError,
+                         "File '" + fileName +
+                                 "': expected a float64 column but found " +
+                                 chunk.type()->ToString() + ".");
+        const auto& values = static_cast<const arrow::DoubleArray&>(chunk);
+        dest.insert(dest.end(),
+                    values.raw_values(),
+                    values.raw_values() + values.length());
+    }
+}
+
+} // anonymous namespace
+
+ParquetFileAdapter*
+ParquetFileAdapter::clone() const {
+    return new ParquetFileAdapter{*this};
+}
+
+const std::string
+ParquetFileAdapter::tableString() {
+    return "table";
+}
+
+void
+ParquetFileAdapter::write(const TimeSeriesTable& table,
+                          const std::string& fileName,
+                          unsigned rowsPerRowGroup) {
+    InputTables tables{};
+    tables.emplace(tableString(), &table);
+    ParquetFileAdapter adapter{};
+    adapter.setRowsPerRowGroup(rowsPerRowGroup);
+    adapter.extendWrite(tables, fileName);
+}
+
+TimeSeriesTable
+ParquetFileAdapter::readTable(const std::string& fileName,
+                              const std::vector<std::string>& columns) {
+    ParquetFileAdapter adapter{};
+    adapter.setColumnsToRead(columns);
+    auto tables = adapter.extendRead(fileName);
+    return static_cast<const TimeSeriesTable&>(*tables.at(tableString()));
+}
+
+void
+ParquetFileAdapter::setColumnsToRead(const std::vector<std::string>& labels) {
+    _columnsToRead = labels;
+}
+
+const std::vector<std::string>&
+ParquetFileAdapter::getColumnsToRead() const {
+    return _columnsToRead;
+}
+
+void
+ParquetFileAdapter::setTimeRange(double startTime, double endTime) {
+    OPENSIM_THROW_IF(startTime > endTime,
+                     InvalidArgument,
+                     "Start time must not exceed end time.");
+    _startTime = startTime;
+    _endTime = endTime;
+}
+
+void
+ParquetFileAdapter::setRowsPerRowGroup(unsigned rowsPerRowGroup) {
+    OPENSIM_THROW_IF(rowsPerRowGroup == 0,
+                     InvalidArgument,
+                     "Rows per row group must be at least 1.");
+    _rowsPerRowGroup = rowsPerRowGroup;
+}
+
+unsigned
+ParquetFileAdapter::getRowsPerRowGroup() const {
+    return _rowsPerRowGroup;
+}
+
+DataAdapter::OutputTables
+ParquetFileAdapter::extendRead(const std::string& fileName) const {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+
+    auto inputResult = arrow::io::ReadableFile::Open(fileName);
+    throwIfNotOk(inputResult.status(), fileName);
+
+    std::unique_ptr<parquet::arrow::FileReader> reader{};
+    throwIfNotOk(parquet::arrow::OpenFile(*inputResult,
+                                          arrow::default_memory_pool(),
+                                          &reader),
+                 fileName);
+
+    std::shared_ptr<arrow::Schema> schema{};
+    throwIfNotOk(reader->GetSchema(&schema), fileName);
+
+    const int timeIndex = schema->GetFieldIndex(theTimeLabel);
+    OPENSIM_THROW_IF(timeIndex < 0,
+                     IOError,
+                     "File '" + fileName + "' has no '" + theTimeLabel +
+                             "' column.");
+
+    // Map the requested labels (or, by default, every non-time column in
+    // file order) to column indices.
+    std::vector<int> selected{timeIndex};
+    std::vector<std::string> selectedLabels{};
+    if(_columnsToRead.empty()) {
+        for(int i = 0; i < schema->num_fields(); ++i) {
+            if(i == timeIndex)
+                continue;
+            selected.push_back(i);
+            selectedLabels.push_back(schema->field(i)->name());
+        }
+    } else {
+        for(const auto& label : _columnsToRead) {
+            const int index = schema->GetFieldIndex(label);
+            OPENSIM_THROW_IF(index < 0,
+                             KeyNotFound,
+                             label);
+            selected.push_back(index);
+            selectedLabels.push_back(label);
+        }
+    }
+
+    // Predicate pushdown on the time range: skip row groups whose time
+    // statistics show they cannot contain any row in [startTime, endTime].
+    const auto fileMetaData = reader->parquet_reader()->metadata();
+    std::vector<int> rowGroups{};
+    for(int rg = 0; rg < fileMetaData->num_row_groups(); ++rg) {
+        const auto columnChunk =
+                fileMetaData->RowGroup(rg)->ColumnChunk(timeIndex);
+        if(columnChunk->is_stats_set()) {
+            const auto stats =
+                    std::static_pointer_cast<parquet::DoubleStatistics>(
+                            columnChunk->statistics());
+            if(stats->HasMinMax() &&
+                    (stats->max() < _startTime || stats->min() > _endTime))
+                continue;
+        }
+        rowGroups.push_back(rg);
+    }
+
+    std::shared_ptr<arrow::Table> arrowTable{};
+    throwIfNotOk(reader->ReadRowGroups(rowGroups, selected, &arrowTable),
+                 fileName);
+
+    // The columns of arrowTable follow the order of `selected`: the time
+    // column first, then the dependent columns.
+    std::vector<double> times{};
+    flattenColumn(*arrowTable->column(0), times, fileName);
+
+    // Row groups overlapping the range can still contain rows outside it;
+    // filter the surviving rows exactly.
+    std::vector<size_t> keptRows{};
+    keptRows.reserve(times.size());
+    for(size_t r = 0; r < times.size(); ++r) {
+        if(times[r] >= _startTime && times[r] <= _endTime)
+            keptRows.push_back(r);
+    }
+
+    std::shared_ptr<TimeSeriesTable> table{};
+    if(keptRows.empty()) {
+        table = std::make_shared<TimeSeriesTable>();
+        table->setColumnLabels(selectedLabels);
+    } else {
+        std::vector<double> keptTimes(keptRows.size());
+        for(size_t r = 0; r < keptRows.size(); ++r)
+            keptTimes[r] = times[keptRows[r]];
+
+        SimTK::Matrix_<double> depData{static_cast<int>(keptRows.size()),
+                                       static_cast<int>(selectedLabels.size())};
+        std::vector<double> columnValues{};
+        for(size_t j = 0; j < selectedLabels.size(); ++j) {
+            columnValues.clear();
+            flattenColumn(*arrowTable->column(static_cast<int>(j) + 1),
+                          columnValues,
+                          fileName);
+            for(size_t r = 0; r < keptRows.size(); ++r)
+                depData.updElt(static_cast<int>(r), static_cast<int>(j)) =
+                        columnValues[keptRows[r]];
+        }
+
+        table = std::make_shared<TimeSeriesTable>(keptTimes,
+                                                  depData,
+                                                  selectedLabels);
+    }
+
+    if(schema->metadata() != nullptr) {
+        const auto& metadata = *schema->metadata();
+        for(int64_t i = 0; i < metadata.size(); ++i)
+            table->updTableMetaData().setValueForKey(metadata.key(i),
+                                                     metadata.value(i));
+    }
+
+    OutputTables output_tables{};
+    output_tables.emplace(tableString(), table);
+    return output_tables;
+}
+
+void
+ParquetFileAdapter::extendWrite(const InputTables& absTables,
+                                const std::string& fileName) const {
+    OPENSIM_THROW_IF(absTables.empty(),
+                     NoTableFound);
+
+    const TimeSeriesTable* table{};
+    try {
+        auto abs_table = absTables.at(tableString());
+        table = dynamic_cast<const TimeSeriesTable*>(abs_table);
+    } catch(std::out_of_range&) {
+        OPENSIM_THROW(KeyMissing,
+                      tableString());
+    }
+    OPENSIM_THROW_IF(table == nullptr,
+                     IncorrectTableType);
+
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+
+    const size_t numRows = table->getNumRows();
+    const size_t numCols = table->getNumColumns();
+
+    // Key-value metadata of the table. As with the .sto header, only
+    // string-valued entries are serialized.
+    auto keyValueMetaData = std::make_shared<arrow::KeyValueMetadata>();
+    const auto& metadata = table->getTableMetaData();
+    for(const auto& key : metadata.getKeys()) {
+        const auto* value = dynamic_cast<const SimTK::Value<std::string>*>(
+                &metadata.getValueForKey(key));
+        if(value != nullptr)
+            keyValueMetaData->Append(key, value->get());
+    }
+
+    arrow::FieldVector fields{};
+    fields.push_back(arrow::field(theTimeLabel, arrow::float64(), false));
+    for(const auto& label : table->getColumnLabels())
+        fields.push_back(arrow::field(label, arrow::float64(), false));
+    const auto schema = arrow::schema(fields, keyValueMetaData);
+
+    // The time column and each dependent column are contiguous runs of
+    // doubles in the table's column-major storage; wrap them in place so
+    // the write is zero-copy.
+    std::vector<std::shared_ptr<arrow::Array>> arrays{};
+    arrays.push_back(wrapColumn(table->getIndependentColumn().data(),
+                                numRows));
+    for(size_t i = 0; i < numCols; ++i)
+        arrays.push_back(wrapColumn(table->getDependentColumnSpan(i).cbegin(),
+                                    numRows));
+
+    const auto arrowTable = arrow::Table::Make(schema,
+                                               arrays,
+                                               static_cast<int64_t>(numRows));
+
+    auto outputResult = arrow::io::FileOutputStream::Open(fileName);
+    throwIfNotOk(outputResult.status(), fileName);
+
+    throwIfNotOk(parquet::arrow::WriteTable(*arrowTable,
+                                            arrow::default_memory_pool(),
+                                            *outputResult,
+                                            _rowsPerRowGroup),
+                 fileName);
+    throwIfNotOk((*outputResult)->Close(), fileName);
+}
+
+} // namespace OpenSim
+
+#endif // WITH_ARROW
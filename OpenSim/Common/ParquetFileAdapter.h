@@ -0,0 +1,112 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  ParquetFileAdapter.h                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_PARQUET_FILE_ADAPTER_H_
+#define OPENSIM_PARQUET_FILE_ADAPTER_H_
+
+#if defined (WITH_ARROW)
+
+#include "FileAdapter.h"
+#include "TimeSeriesTable.h"
+
+namespace OpenSim {
+
+/** ParquetFileAdapter reads/writes Apache Parquet (.parquet) files for
+TimeSeriesTable_<double>, so simulation outputs can land in a columnar data
+lake without going through text formats:
+
+ - The time column is written as a float64 column named "time" and each
+   dependent column as a float64 column named by its label. The dependent
+   columns of a table are contiguous in memory, so write() hands each one
+   to Arrow without copying.
+ - String-valued table metadata is stored as Parquet key-value metadata,
+   equivalent to the header of a .sto file.
+ - Reads support column selection and a time-range predicate: only the
+   requested columns are fetched, and row groups whose time statistics fall
+   entirely outside the requested range are skipped without being read.
+
+The adapter is only available when OpenSim is compiled with Arrow/Parquet
+support (CMake variable OPENSIM_WITH_ARROW). It is registered with extension
+"parquet", so FileAdapter::createAdapterFromExtension() and the
+TimeSeriesTable filename constructor both work with these files.            */
+class OSIMCOMMON_API ParquetFileAdapter : public FileAdapter {
+public:
+    ParquetFileAdapter()                                     = default;
+    ParquetFileAdapter(const ParquetFileAdapter&)            = default;
+    ParquetFileAdapter(ParquetFileAdapter&&)                 = default;
+    ParquetFileAdapter& operator=(const ParquetFileAdapter&) = default;
+    ParquetFileAdapter& operator=(ParquetFileAdapter&&)      = default;
+    ~ParquetFileAdapter()                                    = default;
+
+    ParquetFileAdapter* clone() const override;
+
+    /** Key of the table in the OutputTables container returned by read().   */
+    static const std::string tableString();
+
+    /** Write a Parquet file. rowsPerRowGroup is the number of rows per
+    Parquet row group; it trades file overhead (smaller groups) against the
+    granularity of time-range reads.                                         */
+    static
+    void write(const TimeSeriesTable& table,
+               const std::string& fileName,
+               unsigned rowsPerRowGroup = 65536);
+
+    /** Read a Parquet file. If columns is non-empty, only the columns with
+    the given labels are read (in the given order); the time column is
+    always read.
+
+    \throws KeyNotFound If a requested column label is not in the file.      */
+    static
+    TimeSeriesTable readTable(const std::string& fileName,
+                              const std::vector<std::string>& columns = {});
+
+    /** Restrict read() to the columns with the given labels. An empty list
+    (the default) reads all columns.                                         */
+    void setColumnsToRead(const std::vector<std::string>& labels);
+    const std::vector<std::string>& getColumnsToRead() const;
+
+    /** Restrict read() to rows with startTime <= time <= endTime. Row
+    groups whose time statistics lie entirely outside the range are skipped
+    without being read or decompressed.                                      */
+    void setTimeRange(double startTime, double endTime);
+
+    /** Set the number of rows per Parquet row group used by write().        */
+    void setRowsPerRowGroup(unsigned rowsPerRowGroup);
+    unsigned getRowsPerRowGroup() const;
+
+protected:
+    OutputTables extendRead(const std::string& fileName) const override;
+
+    void extendWrite(const InputTables& tables,
+                     const std::string& fileName) const override;
+
+private:
+    std::vector<std::string> _columnsToRead{};
+    double _startTime{-SimTK::Infinity};
+    double _endTime{SimTK::Infinity};
+    unsigned _rowsPerRowGroup{65536};
+};
+
+} // namespace OpenSim
+
+#endif // WITH_ARROW
+
+#endif // OPENSIM_PARQUET_FILE_ADAPTER_H_
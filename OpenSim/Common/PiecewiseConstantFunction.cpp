@@ -119,6 +119,7 @@ PiecewiseConstantFunction::PiecewiseConstantFunction(const PiecewiseConstantFunc
  */
 void PiecewiseConstantFunction::setNull()
 {
+       _lastInterval = 0;
        setupProperties();
 }
 //_____________________________________________________________________________
@@ -399,17 +400,20 @@ int PiecewiseConstantFunction::addPoint(double aX, double aY)
        return i;
 }
 
-double PiecewiseConstantFunction::calcValue(const Vector& x) const
+int PiecewiseConstantFunction::findInterval(double aX, int aHint) const
 {
     int n = _x.getSize();
-    double aX = x[0];
 
-    if (aX < _x[0] || EQUAL_WITHIN_ERROR(aX,_x[0]))
-        return _y[0];
-    if (aX > _x[n-1] || EQUAL_WITHIN_ERROR(aX,_x[n-1]))
-        return _y[n-1];
+    // Try the hinted interval first, then its successor: evaluations that
+    // repeat an abscissa or sweep it forward resolve without a search.
+    if (aHint >= 0 && aHint < n-1 && aX >= _x[aHint]) {
+        if (aX <= _x[aHint+1])
+            return aHint;
+        if (aHint+2 < n && aX <= _x[aHint+2])
+            return aHint+1;
+    }
 
-   // Do a binary search to find which two points the abscissa is between.
+    // Do a binary search to find which two points the abscissa is between.
     int k, i = 0;
     int j = n;
     while (1)
@@ -423,9 +427,56 @@ double PiecewiseConstantFunction::calcValue(const Vector& x) const
             break;
     }
 
+    return k;
+}
+
+double PiecewiseConstantFunction::calcValue(const Vector& x) const
+{
+    int n = _x.getSize();
+    double aX = x[0];
+
+    if (aX < _x[0] || EQUAL_WITHIN_ERROR(aX,_x[0]))
+        return _y[0];
+    if (aX > _x[n-1] || EQUAL_WITHIN_ERROR(aX,_x[n-1]))
+        return _y[n-1];
+
+    int k = findInterval(aX, _lastInterval.load(std::memory_order_relaxed));
+    _lastInterval.store(k, std::memory_order_relaxed);
+
     return _y[k];
 }
 
+void PiecewiseConstantFunction::calcValues(int aDerivOrder,
+    const SimTK::Vector& aX, SimTK::Vector& rY) const
+{
+    OPENSIM_THROW_IF(aDerivOrder < 0,
+                     Exception,
+                     "Derivative order must be non-negative.");
+
+    rY.resize(aX.size());
+    int n = _x.getSize();
+
+    // The function is piecewise constant, so all derivatives are zero.
+    if (aDerivOrder > 0) {
+        rY = 0.0;
+        return;
+    }
+
+    // Hint local to this call, so calls may run concurrently.
+    int interval = 0;
+    for (int i = 0; i < aX.size(); ++i) {
+        double aXi = aX[i];
+        if (aXi < _x[0] || EQUAL_WITHIN_ERROR(aXi, _x[0])) {
+            rY[i] = _y[0];
+        } else if (aXi > _x[n-1] || EQUAL_WITHIN_ERROR(aXi, _x[n-1])) {
+            rY[i] = _y[n-1];
+        } else {
+            int k = interval = findInterval(aXi, interval);
+            rY[i] = _y[k];
+        }
+    }
+}
+
 double PiecewiseConstantFunction::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
 {
     return 0.0;
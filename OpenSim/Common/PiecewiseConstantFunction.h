@@ -26,6 +26,7 @@
 
 // INCLUDES
 #include "osimCommonDLL.h"
+#include <atomic>
 #include <string>
 #include "Function.h"
 #include "PropertyDblArray.h"
@@ -63,6 +64,13 @@ protected:
        PropertyDblArray _propY;
        Array<double> &_y;
 
+private:
+       /** Knot interval used by the most recent evaluation.  A hint only:
+       repeated and advancing queries resolve without a binary search.
+       Relaxed atomic so concurrent const evaluations of a shared function
+       stay race-free; a stale hint merely costs a binary search. */
+       mutable std::atomic<int> _lastInterval{0};
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -82,6 +90,10 @@ private:
     void setNull();
     void setupProperties();
     void setEqual(const PiecewiseConstantFunction &aFunction);
+    /** Find the knot interval k with _x[k] <= aX <= _x[k+1], trying the
+    hinted interval and its successor before falling back to a binary
+    search.  The abscissa must lie strictly inside the knot range. */
+    int findInterval(double aX, int aHint) const;
 
     //--------------------------------------------------------------------------
     // OPERATORS
@@ -116,6 +128,21 @@ public:
     virtual double evaluateTotalSecondDerivative(double aX,double aDxdt,double aD2xdt2) const;
     double calcValue(const SimTK::Vector& x) const override;
     double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const override;
+    /**
+     * Evaluate the function, or one of its derivatives, at many abscissae
+     * in one call.  The knot interval found for one query seeds the search
+     * for the next one, so sorted queries locate their interval in
+     * amortized constant time.  The interval hint is local to each call,
+     * so this method may be called concurrently on the same function.
+     *
+     * @param aDerivOrder Order of the derivative to evaluate; 0 evaluates
+     *                    the function itself; all derivatives are zero.
+     * @param aX Query abscissae.  They need not be sorted, but sorted
+     *           queries evaluate fastest.
+     * @param rY Resized to aX.size() and filled with the results.
+     */
+    void calcValues(int aDerivOrder, const SimTK::Vector& aX,
+                    SimTK::Vector& rY) const;
     int getArgumentSize() const override;
     int getMaxDerivativeOrder() const override;
     SimTK::Function* createSimTKFunction() const override;
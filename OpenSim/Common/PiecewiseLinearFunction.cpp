@@ -25,6 +25,7 @@
 // C++ INCLUDES
 #include "PiecewiseLinearFunction.h"
 #include "Constant.h"
+#include "HotPathCounters.h"
 #include "FunctionAdapter.h"
 #include "SimmMacros.h"
 #include "XYFunctionInterface.h"
@@ -127,6 +128,7 @@ PiecewiseLinearFunction::PiecewiseLinearFunction(const PiecewiseLinearFunction &
  */
 void PiecewiseLinearFunction::setNull()
 {
+    _lastInterval = 0;
     setupProperties();
 }
 //_____________________________________________________________________________
@@ -427,8 +429,40 @@ void PiecewiseLinearFunction::calcCoefficients()
     _b[n-1] = _b[n-2];
 }
 
+int PiecewiseLinearFunction::findInterval(double aX, int aHint) const
+{
+    int n = _x.getSize();
+
+    // Try the hinted interval first, then its successor: evaluations that
+    // repeat an abscissa or sweep it forward resolve without a search.
+    if (aHint >= 0 && aHint < n-1 && aX >= _x[aHint]) {
+        if (aX <= _x[aHint+1])
+            return aHint;
+        if (aHint+2 < n && aX <= _x[aHint+2])
+            return aHint+1;
+    }
+
+    // Do a binary search to find which two points the abscissa is between.
+    int k, i = 0;
+    int j = n;
+    while (1)
+    {
+        k = (i+j)/2;
+        if (aX < _x[k])
+            j = k;
+        else if (aX > _x[k+1])
+            i = k;
+        else
+            break;
+    }
+
+    return k;
+}
+
 double PiecewiseLinearFunction::calcValue(const Vector& x) const
 {
+    HotPathCounters::increment(HotPathCounters::SplineEvaluations);
+
     int n = _x.getSize();
     double aX = x[0];
 
@@ -446,19 +480,8 @@ double PiecewiseLinearFunction::calcValue(const Vector& x) const
     else if (EQUAL_WITHIN_ERROR(aX,_x[n-1]))
         return _y[n-1];
 
-    // Do a binary search to find which two points the abscissa is between.
-    int k, i = 0;
-    int j = n;
-    while (1)
-    {
-        k = (i+j)/2;
-        if (aX < _x[k])
-            j = k;
-        else if (aX > _x[k+1])
-            i = k;
-        else
-            break;
-    }
+    int k = findInterval(aX, _lastInterval.load(std::memory_order_relaxed));
+    _lastInterval.store(k, std::memory_order_relaxed);
 
     return _y[k] + (aX - _x[k]) * _b[k];
 }
@@ -489,23 +512,51 @@ double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComp
         return _b[n-1];
     }
 
-    // Do a binary search to find which two points the abscissa is between.
-    int k, i = 0;
-    int j = n;
-    while (1)
-    {
-        k = (i+j)/2;
-        if (aX < _x[k])
-            j = k;
-        else if (aX > _x[k+1])
-            i = k;
-        else
-            break;
-    }
+    int k = findInterval(aX, _lastInterval.load(std::memory_order_relaxed));
+    _lastInterval.store(k, std::memory_order_relaxed);
 
     return _b[k];
 }
 
+void PiecewiseLinearFunction::calcValues(int aDerivOrder,
+    const SimTK::Vector& aX, SimTK::Vector& rY) const
+{
+    OPENSIM_THROW_IF(aDerivOrder < 0,
+                     Exception,
+                     "Derivative order must be non-negative.");
+
+    rY.resize(aX.size());
+    int n = _x.getSize();
+
+    // The function is piecewise linear, so all derivatives beyond the
+    // slope are identically zero.
+    if (aDerivOrder > 1) {
+        rY = 0.0;
+        return;
+    }
+
+    // Hint local to this call, so calls may run concurrently.
+    int interval = 0;
+    for (int i = 0; i < aX.size(); ++i) {
+        double aXi = aX[i];
+        if (aXi < _x[0]) {
+            rY[i] = (aDerivOrder == 1) ? _b[0]
+                    : _y[0] + (aXi - _x[0]) * _b[0];
+        } else if (aXi > _x[n-1]) {
+            rY[i] = (aDerivOrder == 1) ? _b[n-1]
+                    : _y[n-1] + (aXi - _x[n-1]) * _b[n-1];
+        } else if (EQUAL_WITHIN_ERROR(aXi, _x[0])) {
+            rY[i] = (aDerivOrder == 1) ? _b[0] : _y[0];
+        } else if (EQUAL_WITHIN_ERROR(aXi, _x[n-1])) {
+            rY[i] = (aDerivOrder == 1) ? _b[n-1] : _y[n-1];
+        } else {
+            int k = interval = findInterval(aXi, interval);
+            rY[i] = (aDerivOrder == 1) ? _b[k]
+                    : _y[k] + (aXi - _x[k]) * _b[k];
+        }
+    }
+}
+
 int PiecewiseLinearFunction::getArgumentSize() const
 {
     return 1;
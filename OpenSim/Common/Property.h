@@ -797,6 +797,97 @@ writeSimplePropertyToStreamForDisplay(std::ostream& o,
         writeSimplePropertyToStreamForDisplay(o, v[i], precision);
     }
 }
+
+//==============================================================================
+//               HELPERS FOR BINARY PROPERTY SERIALIZATION
+//==============================================================================
+// Codec used by the binary object format (see Object::printBinary()): one
+// read/write overload pair per simple property type, plus raw helpers for
+// fixed-layout scalars. Values are written in the machine's native layout;
+// the binary format is a same-architecture load-time cache, not an archival
+// format, and is guarded by the format version in the file header.
+
+template <class X> inline void
+writeBinaryRaw(std::ostream& o, const X& x)
+{   o.write(reinterpret_cast<const char*>(&x), sizeof(X)); }
+
+template <class X> inline void
+readBinaryRaw(std::istream& in, X& x)
+{   in.read(reinterpret_cast<char*>(&x), sizeof(X)); }
+
+inline void writeBinaryPropertyValue(std::ostream& o, bool v)
+{   const char c = v ? 1 : 0; writeBinaryRaw(o, c); }
+inline void readBinaryPropertyValue(std::istream& in, bool& v)
+{   char c = 0; readBinaryRaw(in, c); v = (c != 0); }
+
+inline void writeBinaryPropertyValue(std::ostream& o, int v)
+{   writeBinaryRaw(o, v); }
+inline void readBinaryPropertyValue(std::istream& in, int& v)
+{   readBinaryRaw(in, v); }
+
+inline void writeBinaryPropertyValue(std::ostream& o, double v)
+{   writeBinaryRaw(o, v); }
+inline void readBinaryPropertyValue(std::istream& in, double& v)
+{   readBinaryRaw(in, v); }
+
+inline void writeBinaryPropertyValue(std::ostream& o, const std::string& v)
+{
+    writeBinaryRaw(o, int(v.size()));
+    o.write(v.data(), v.size());
+}
+inline void readBinaryPropertyValue(std::istream& in, std::string& v)
+{
+    int n = 0;
+    readBinaryRaw(in, n);
+    if (!in || n < 0) {
+        in.setstate(std::ios::failbit);
+        v.clear();
+        return;
+    }
+    v.resize(n);
+    if (n > 0) in.read(&v[0], n);
+}
+
+template <int M> inline void
+writeBinaryPropertyValue(std::ostream& o, const SimTK::Vec<M>& v)
+{   for (int i = 0; i < M; ++i) writeBinaryRaw(o, v[i]); }
+template <int M> inline void
+readBinaryPropertyValue(std::istream& in, SimTK::Vec<M>& v)
+{   for (int i = 0; i < M; ++i) readBinaryRaw(in, v[i]); }
+
+inline void writeBinaryPropertyValue(std::ostream& o, const SimTK::Vector& v)
+{
+    writeBinaryRaw(o, int(v.size()));
+    for (int i = 0; i < v.size(); ++i) writeBinaryRaw(o, v[i]);
+}
+inline void readBinaryPropertyValue(std::istream& in, SimTK::Vector& v)
+{
+    int n = 0;
+    readBinaryRaw(in, n);
+    if (!in || n < 0) {
+        in.setstate(std::ios::failbit);
+        return;
+    }
+    v.resize(n);
+    for (int i = 0; i < n; ++i) readBinaryRaw(in, v[i]);
+}
+
+// Transforms use the same convention as XML serialization: body-fixed X-Y-Z
+// Euler angles followed by the position vector.
+inline void writeBinaryPropertyValue(std::ostream& o,
+                                     const SimTK::Transform& X)
+{
+    writeBinaryPropertyValue(o, X.R().convertRotationToBodyFixedXYZ());
+    writeBinaryPropertyValue(o, X.p());
+}
+inline void readBinaryPropertyValue(std::istream& in, SimTK::Transform& X)
+{
+    SimTK::Vec3 angles, pos;
+    readBinaryPropertyValue(in, angles);
+    readBinaryPropertyValue(in, pos);
+    X.updR().setRotationToBodyFixedXYZ(angles);
+    X.updP() = pos;
+}
 #endif // SWIG
 
 //==============================================================================
@@ -856,12 +947,15 @@ public:
 
     bool isUnnamedProperty() const override final {return false;}
     bool isObjectProperty() const override final {return false;}
-    bool isAcceptableObjectTag(const std::string&) const override final 
+    bool isAcceptableObjectTag(const std::string&) const override final
     {   return false; }
 
     int getNumValues() const override final {return values.size(); }
     void clearValues() override final {values.clear();}
 
+    std::size_t getMemorySizeEstimate() const override final
+    {   return sizeof(*this) + values.capacity()*sizeof(T); }
+
     bool isEqualTo(const AbstractProperty& other) const override final {
         // Check here rather than in base class because the old
         // Property_Deprecated implementation can't copy this flag right.
@@ -924,14 +1018,40 @@ public:
     }
 
     // Property element will be just a value element. We'll serialize it
-    // using an unformatted write to produce a series of blank-separated 
+    // using an unformatted write to produce a series of blank-separated
     // tokens.
     void writeToXMLElement
        (SimTK::Xml::Element& propertyElement) const override final {
         std::ostringstream valstream;
         writeSimplePropertyToStream(valstream);
-        propertyElement.setValue(valstream.str()); 
-    } 
+        propertyElement.setValue(valstream.str());
+    }
+
+#ifndef SWIG
+    // Binary format: a value count followed by each value through the
+    // fixed-layout codec above.
+    void writeToBinaryStream(std::ostream& out) const override final {
+        writeBinaryRaw(out, int(values.size()));
+        for (int i = 0; i < values.size(); ++i)
+            writeBinaryPropertyValue(out, values[i]);
+    }
+
+    void readFromBinaryStream(std::istream& in, int formatVersion)
+            override final {
+        int n = 0;
+        readBinaryRaw(in, n);
+        if (!in || n < this->getMinListSize() || n > this->getMaxListSize())
+            throw OpenSim::Exception(
+                "SimpleProperty<T>::readFromBinaryStream(): corrupt value "
+                "count for property " + this->getName() + ".");
+        values.clear();
+        for (int i = 0; i < n; ++i) {
+            T value;
+            readBinaryPropertyValue(in, value);
+            values.push_back(value);
+        }
+    }
+#endif
 
 
     const Object& getValueAsObject(int index=-1) const override final {
@@ -1129,6 +1249,11 @@ public:
         int                  versionNumber) override final;
     void writeToXMLElement
        (SimTK::Xml::Element& propertyElement) const override final;
+#ifndef SWIG
+    void writeToBinaryStream(std::ostream& out) const override final;
+    void readFromBinaryStream(std::istream& in, int formatVersion)
+        override final;
+#endif
     void setValueAsObject(const Object& obj, int index=-1) override final;
 
     bool isUnnamedProperty() const override final {return isUnnamed;}
@@ -1137,6 +1262,11 @@ public:
     int getNumValues() const override final {return objects.size();}
     void clearValues() override final {objects.clear();}
 
+    // Only this property's own overhead; the contained objects are accounted
+    // for separately by the memory footprint report.
+    std::size_t getMemorySizeEstimate() const override final
+    {   return sizeof(*this) + objects.capacity()*sizeof(objects[0]); }
+
     const Object& getValueAsObject(int index=-1) const override final {
         if (index < 0 && this->getMinListSize()==1 && this->getMaxListSize()==1)
             index = 0;
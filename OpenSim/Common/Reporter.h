@@ -24,8 +24,14 @@
  * -------------------------------------------------------------------------- */
 // INCLUDE
 #include <OpenSim/Common/Component.h>
+#include <OpenSim/Common/DataQueue.h>
+#include <OpenSim/Common/STOStreamWriter.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 namespace OpenSim {
 
 /**
@@ -180,13 +186,64 @@ class TableReporter_ : public Reporter<InputT> {
 OpenSim_DECLARE_CONCRETE_OBJECT_T(TableReporter_, InputT, Reporter<InputT>);
 public:
     TableReporter_() = default;
-    virtual ~TableReporter_() = default;
+    virtual ~TableReporter_() { stopStreaming(); }
 
-    /** Retrieve the report as a TimeSeriesTable.                             */
+    /** Retrieve the report as a TimeSeriesTable. When streamToFile() is
+    active, rows go to the file instead and this table stays empty.          */
     const TimeSeriesTable_<ValueT>& getTable() const {
         return _outputTable;
     }
 
+    /** Stream reported rows to an STO file instead of accumulating them in
+    the in-memory table. Rows pass through a preallocated ring buffer of
+    numRingSlots rows to a background thread that writes them with
+    STOStreamWriter_, so memory stays flat for arbitrarily long runs and
+    the file I/O cost stays off the simulation thread: reporting only
+    stalls if the disk thread falls numRingSlots rows behind. The file is
+    opened (and the flush thread started) at the first report after the
+    reporter's connections are finalized; call stopStreaming() to drain
+    pending rows and close the file.                                        */
+    void streamToFile(const std::string& fileName, int numRingSlots = 256) {
+        OPENSIM_THROW_IF(isStreaming(), Exception,
+                "TableReporter is already streaming; call stopStreaming() "
+                "first.");
+        OPENSIM_THROW_IF(fileName.empty(), Exception,
+                "streamToFile() requires a file name.");
+        OPENSIM_THROW_IF(numRingSlots < 1, Exception,
+                "streamToFile() requires at least one ring slot, but {} "
+                "was provided.", numRingSlots);
+        _streamFileName = fileName;
+        _numRingSlots = numRingSlots;
+    }
+
+    /** Drain any rows still in the ring buffer, close the streamed file,
+    and return to in-memory capture. Safe to call when not streaming.       */
+    void stopStreaming() {
+        _streamFileName.clear();
+        if (!_flusher) return;
+        _flusher->stop = true;
+        if (_flusher->thread.joinable())
+            _flusher->thread.join();
+        _flusher.reset();
+        _streamWriter.reset();
+    }
+
+    /** Whether reported rows are currently being streamed to a file.       */
+    bool isStreaming() const { return _flusher != nullptr; }
+
+    /** Record only every numReports-th report (1 records every report, the
+    default). Decimation applies to both in-memory and streamed capture,
+    letting instrumented runs report at every integrator step while keeping
+    only as much resolution as the analysis needs.                          */
+    void setReportDecimation(int numReports) {
+        OPENSIM_THROW_IF(numReports < 1, Exception,
+                "Report decimation must be a positive number of reports, "
+                "but {} was provided.", numReports);
+        _reportDecimation = numReports;
+    }
+    /** The decimation set by setReportDecimation().                        */
+    int getReportDecimation() const { return _reportDecimation; }
+
     /** Clear the report. This can be used for example in loops performing 
     simulation. Each new iteration should start with an empty report and so this
     function can be used to clear the report at the end of each iteration.    */
@@ -204,6 +261,7 @@ public:
 
 protected:
     void implementReport(const SimTK::State& state) const override {
+        if (!passesDecimation()) return;
         const auto& input = this->template getInput<InputT>("inputs");
         SimTK::RowVector_<ValueT> result;
         result.resize(int(input.getNumConnectees()));
@@ -213,16 +271,7 @@ protected:
               const auto& value = chan.getValue(state);
               result[idx] = value;
         }
-        try {
-            const_cast<Self*>(this)->_outputTable.appendRow(state.getTime(),
-                                                            result);
-        } catch(const InvalidTimestamp& exception) {
-            OPENSIM_THROW(Exception,
-                          "Attempting to update reporter with rows having "
-                          "invalid timestamps. Hint: If running simulation in "
-                          "a loop, use clearTable() to clear table at the end "
-                          "of each loop.\n\n" + std::string{exception.what()});
-        }
+        recordRow(state.getTime(), result);
     }
 
     void extendFinalizeConnections(Component& root) override {
@@ -246,11 +295,87 @@ protected:
     }
 
 private:
+    // Apply the report decimation; true when this report should be
+    // recorded.
+    bool passesDecimation() const {
+        return (_reportCount++ % _reportDecimation) == 0;
+    }
+
+    // Deliver one reported row: into the streaming ring buffer when
+    // streamToFile() is active, into the in-memory table otherwise.
+    void recordRow(double time, const SimTK::RowVector_<ValueT>& row) const {
+        if (!_streamFileName.empty() && !_flusher)
+            startFlusher((int)row.size());
+        if (_flusher) {
+            // Bounded ring; blocks (yielding) only if the flush thread has
+            // fallen _numRingSlots rows behind.
+            _streamQueue.push_back(time, row(0, row.size()));
+            return;
+        }
+        try {
+            const_cast<Self*>(this)->_outputTable.appendRow(time, row);
+        } catch(const InvalidTimestamp& exception) {
+            OPENSIM_THROW(Exception,
+                          "Attempting to update reporter with rows having "
+                          "invalid timestamps. Hint: If running simulation in "
+                          "a loop, use clearTable() to clear table at the end "
+                          "of each loop.\n\n" + std::string{exception.what()});
+        }
+    }
+
+    // Open the stream writer with the table's column labels, size the ring
+    // buffer, and start the background flush thread.
+    void startFlusher(int numColumns) const {
+        std::vector<std::string> labels;
+        if (_outputTable.hasColumnLabels())
+            labels = _outputTable.getColumnLabels();
+        OPENSIM_THROW_IF((int)labels.size() != numColumns, Exception,
+                "TableReporter '{}' cannot stream to file: {} column "
+                "label(s) for {} reported value(s).",
+                this->getName(), labels.size(), numColumns);
+        _streamWriter.reset(
+                new STOStreamWriter_<ValueT>(_streamFileName, labels));
+        _streamQueue.setRingBufferSize(_numRingSlots, numColumns);
+        _flusher.reset(new Flusher());
+        Flusher* flusher = _flusher.get();
+        STOStreamWriter_<ValueT>* writer = _streamWriter.get();
+        flusher->thread = std::thread([this, flusher, writer]() {
+            double time(SimTK::NaN);
+            SimTK::RowVector_<ValueT> row;
+            while (true) {
+                if (_streamQueue.tryPopFront(time, row)) {
+                    writer->appendRow(time, row);
+                    continue;
+                }
+                // Drained; exit only once asked to stop.
+                if (flusher->stop) break;
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    // Background flush thread; heap-held and reset on copy so the Object
+    // copy constructor stays valid and a copy never inherits a running
+    // thread.
+    struct Flusher {
+        std::thread thread;
+        std::atomic<bool> stop{false};
+    };
 
     // Hold the output values in a table with values as columns and time rows
     // We write to this table in const methods, but only because we ensure
     // those const methods are never called with trial integrator states.
     TimeSeriesTable_<ValueT> _outputTable;
+    // Streaming state (streamToFile()). The file name resets on copy so a
+    // copied reporter never truncates the original's file.
+    SimTK::ResetOnCopy<std::string> _streamFileName;
+    int _reportDecimation = 1;
+    int _numRingSlots = 256;
+    mutable unsigned _reportCount = 0;
+    mutable DataQueue_<ValueT> _streamQueue;
+    mutable SimTK::ResetOnCopy<std::unique_ptr<STOStreamWriter_<ValueT>>>
+        _streamWriter;
+    mutable SimTK::ResetOnCopy<std::unique_ptr<Flusher>> _flusher;
 };
 
 /** A reporter that simply prints quantities to the console
@@ -347,10 +472,13 @@ template<>
 inline void TableReporter_<SimTK::Vector, SimTK::Real>::
     implementReport(const SimTK::State& state) const
 {
+    if (!passesDecimation()) return;
     const auto& input = getInput<SimTK::Vector>("inputs");
     const SimTK::Vector& result = input.getValue(state, 0);
-    
-    if (_outputTable.getNumRows() == 0) {
+
+    // Per-element labels are derived from the first reported row; when
+    // streaming, the writer has not been opened yet at that point.
+    if (_outputTable.getNumRows() == 0 && !_streamWriter) {
         std::vector<std::string> labels;
         const std::string& base = input.getLabel(0);
         for (int ix = 0; ix < result.size(); ++ix) {
@@ -359,8 +487,7 @@ inline void TableReporter_<SimTK::Vector, SimTK::Real>::
         const_cast<Self*>(this)->_outputTable.setColumnLabels(labels);
     }
 
-    const_cast<Self*>(this)->_outputTable.appendRow(state.getTime(), 
-                                                    (~result).getAsRowVector());
+    recordRow(state.getTime(), (~result).getAsRowVector());
 }
 
 /** @name Commonly used concrete TableReporters */
@@ -0,0 +1,215 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  STOStreamWriter.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_STO_STREAM_WRITER_H_
+#define OPENSIM_STO_STREAM_WRITER_H_
+
+#include "DelimFileAdapter.h"
+
+#include <fstream>
+#include <limits>
+
+namespace OpenSim {
+
+/** STOStreamWriter_ writes an STO file one row at a time with constant
+memory, unlike STOFileAdapter which requires the complete TimeSeriesTable in
+memory before writing. The header, metadata and column labels are written
+when the writer is constructed; rows are then appended with appendRow() and
+flushed through an ordinary buffered stream, so unbounded-duration loggers
+(week-long forward simulations, real-time streaming sessions) never hold
+more than the current row.
+
+The STO header carries no row count, so no part of the file needs
+back-patching when logging ends: close() (or destruction) simply flushes
+and closes the stream, and the file is a valid STO file after every
+appended row. Files produced by this writer read back through
+STOFileAdapter and the TimeSeriesTable_ file constructors.
+
+The writer privately reuses DelimFileAdapter's element formatting, so the
+same data types are supported (double, Vec3, Quaternion, etc.) with the
+same delimiters and precision as STOFileAdapter::write().                   */
+template<typename T>
+class STOStreamWriter_ : DelimFileAdapter<T> {
+public:
+    STOStreamWriter_()                                   = delete;
+    STOStreamWriter_(const STOStreamWriter_&)            = delete;
+    STOStreamWriter_(STOStreamWriter_&&)                 = delete;
+    STOStreamWriter_& operator=(const STOStreamWriter_&) = delete;
+    STOStreamWriter_& operator=(STOStreamWriter_&&)      = delete;
+
+    /** Open the given file for writing and emit the header and the line of
+    column labels. The time column label is added automatically and must not
+    appear in columnLabels. Metadata are written as "key=value" lines as in
+    STOFileAdapter; only string-valued entries are written.                   */
+    STOStreamWriter_(const std::string& fileName,
+                     const std::vector<std::string>& columnLabels,
+                     const ValueArrayDictionary& metaData
+                         = ValueArrayDictionary{});
+
+    /** Flushes and closes the stream.                                        */
+    ~STOStreamWriter_();
+
+    /** Append one data row. The row must have as many elements as there are
+    column labels and its time must be greater than that of the previously
+    appended row.                                                             */
+    void appendRow(double time, const SimTK::RowVector_<T>& row);
+
+    /** Push buffered rows to disk. Useful for loggers that must keep the
+    file consistent while still running (e.g. so it can be tailed).           */
+    void flush();
+
+    /** Flush and close the stream; appendRow() is invalid afterwards.
+    Called by the destructor if not called explicitly.                        */
+    void close();
+
+    /** Number of data rows appended so far.                                  */
+    size_t getNumRowsWritten() const;
+
+private:
+    std::ofstream _stream;
+    size_t        _numColumns;
+    size_t        _numRows;
+    double        _lastTime;
+};
+
+template<typename T>
+STOStreamWriter_<T>::STOStreamWriter_(
+        const std::string& fileName,
+        const std::vector<std::string>& columnLabels,
+        const ValueArrayDictionary& metaData) :
+    DelimFileAdapter<T>("\t", // delimiter for read between elements
+                        "\t", // delimiter for write between elements
+                        ",",  // delim for reading components(within element)
+                        ","   // delim for writing components(within element)
+                        ),
+    _numColumns{columnLabels.size()},
+    _numRows{0},
+    _lastTime{-std::numeric_limits<double>::infinity()} {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+    OPENSIM_THROW_IF(columnLabels.empty(),
+                     InvalidArgument,
+                     "At least one column label is required.");
+
+    _stream.open(fileName, std::ios::trunc);
+    OPENSIM_THROW_IF(!_stream.good(),
+                     Exception,
+                     "Failed to open file '" + fileName + "' for writing.");
+
+    // First line of the stream is the header, as in
+    // DelimFileAdapter::extendWrite(). Only string-valued metadata can be
+    // represented in the key=value header lines; other values are skipped,
+    // as they are by STOFileAdapter.
+    auto asString = [](const SimTK::AbstractValue& value) {
+        return dynamic_cast<const SimTK::Value<std::string>*>(&value);
+    };
+    if (metaData.hasKey("header")) {
+        const auto* header = asString(metaData.getValueForKey("header"));
+        if(header != nullptr)
+            _stream << header->get() << "\n";
+    }
+    // Write rest of the key-value pairs and end the header.
+    for(const auto& key : metaData.getKeys()) {
+        if(key == "header")
+            continue;
+        const auto* value = asString(metaData.getValueForKey(key));
+        if(value != nullptr)
+            _stream << key << "=" << value->get() << "\n";
+    }
+    // Write name of the data-type -- vec3, vec6, etc.
+    _stream << this->_dataTypeString << "="
+            << this->dataTypeName() << "\n";
+    // Write version number.
+    _stream << this->_versionString << "="
+            << this->_versionNumber << "\n";
+    _stream << this->_opensimVersionString << "=" << GetVersion() << "\n";
+    _stream << this->_endHeaderString << "\n";
+
+    // Line containing column labels.
+    _stream << this->_timeColumnLabel;
+    for(const auto& label : columnLabels)
+        _stream << this->_delimiterWrite << label;
+    _stream << "\n";
+}
+
+template<typename T>
+STOStreamWriter_<T>::~STOStreamWriter_() {
+    close();
+}
+
+template<typename T>
+void
+STOStreamWriter_<T>::appendRow(double time,
+                               const SimTK::RowVector_<T>& row) {
+    OPENSIM_THROW_IF(!_stream.is_open(),
+                     InvalidCall,
+                     "appendRow() called on a closed STOStreamWriter.");
+    OPENSIM_THROW_IF(static_cast<size_t>(row.size()) != _numColumns,
+                     InvalidArgument,
+                     "Row has " + std::to_string(row.size()) +
+                     " elements; expected " + std::to_string(_numColumns) +
+                     ".");
+    OPENSIM_THROW_IF(time <= _lastTime,
+                     InvalidArgument,
+                     "Time " + std::to_string(time) + " is not greater than "
+                     "the previously appended time " +
+                     std::to_string(_lastTime) + ".");
+
+    constexpr auto prec = std::numeric_limits<double>::digits10 + 1;
+    _stream << std::setprecision(prec) << time;
+    for(int col = 0; col < row.size(); ++col) {
+        _stream << this->_delimiterWrite;
+        this->writeElem(_stream, row[col], prec);
+    }
+    _stream << "\n";
+
+    _lastTime = time;
+    ++_numRows;
+}
+
+template<typename T>
+void
+STOStreamWriter_<T>::flush() {
+    if(_stream.is_open())
+        _stream.flush();
+}
+
+template<typename T>
+void
+STOStreamWriter_<T>::close() {
+    if(_stream.is_open())
+        _stream.close();
+}
+
+template<typename T>
+size_t
+STOStreamWriter_<T>::getNumRowsWritten() const {
+    return _numRows;
+}
+
+typedef STOStreamWriter_<double> STOStreamWriter;
+typedef STOStreamWriter_<SimTK::Vec3> STOStreamWriterVec3;
+typedef STOStreamWriter_<SimTK::Quaternion> STOStreamWriterQuaternion;
+
+} // namespace OpenSim
+
+#endif // OPENSIM_STO_STREAM_WRITER_H_
@@ -0,0 +1,215 @@
+#include <cstring>
+#include <fstream>
+#include "Simbody.h"
+#include "Exception.h"
+#include "FileAdapter.h"
+#include "TimeSeriesTable.h"
+#include "SensorStreamReader.h"
+
+namespace {
+// All multi-byte fields are little-endian; memcpy through these helpers
+// keeps the codec free of alignment assumptions.
+template <class T>
+void packField(unsigned char*& cursor, const T& value) {
+    std::memcpy(cursor, &value, sizeof(T));
+    cursor += sizeof(T);
+}
+template <class T>
+T unpackField(const unsigned char*& cursor) {
+    T value;
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return value;
+}
+template <class T>
+void writeField(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+template <class T>
+T readField(std::istream& in) {
+    T value{};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+} // anonymous namespace
+
+namespace OpenSim {
+
+// 'OSNS' (OpenSim eNcoded Sensor stream).
+const unsigned int SensorStreamReader::MagicNumber = 0x4F534E53;
+const unsigned int SensorStreamReader::FormatVersion = 1;
+
+SensorStreamReader* SensorStreamReader::clone() const {
+    return new SensorStreamReader{*this};
+}
+
+SensorStreamReader::StreamHeader SensorStreamReader::makeHeader(
+        const std::vector<ExperimentalSensor>& sensors, double dataRate) {
+    StreamHeader header;
+    header.dataRate = dataRate;
+    for (const auto& sensor : sensors)
+        header.sensorNames.push_back(sensor.get_name_in_model());
+    return header;
+}
+
+void SensorStreamReader::encodeFrame(double timestamp,
+        const SimTK::Quaternion_<double>* quaternions, int numSensors,
+        unsigned char* buffer) {
+    unsigned char* cursor = buffer;
+    packField(cursor, timestamp);
+    for (int i = 0; i < numSensors; ++i) {
+        const SimTK::Vec4& q = quaternions[i].asVec4();
+        packField(cursor, float(q[0]));
+        packField(cursor, float(q[1]));
+        packField(cursor, float(q[2]));
+        packField(cursor, float(q[3]));
+    }
+}
+
+double SensorStreamReader::decodeFrame(const unsigned char* buffer,
+        int numSensors, SimTK::Quaternion_<double>* quaternions) {
+    const unsigned char* cursor = buffer;
+    const double timestamp = unpackField<double>(cursor);
+    for (int i = 0; i < numSensors; ++i) {
+        const double w = unpackField<float>(cursor);
+        const double x = unpackField<float>(cursor);
+        const double y = unpackField<float>(cursor);
+        const double z = unpackField<float>(cursor);
+        // The Quaternion constructor normalizes, absorbing the 4-byte
+        // floats' rounding.
+        quaternions[i] = SimTK::Quaternion(w, x, y, z);
+    }
+    return timestamp;
+}
+
+void SensorStreamReader::writeHeader(
+        std::ostream& out, const StreamHeader& header) {
+    writeField(out, MagicNumber);
+    writeField(out, FormatVersion);
+    writeField(out, (unsigned int)header.sensorNames.size());
+    writeField(out, header.dataRate);
+    for (const auto& name : header.sensorNames) {
+        writeField(out, (unsigned int)name.size());
+        out.write(name.data(), name.size());
+    }
+}
+
+SensorStreamReader::StreamHeader SensorStreamReader::readHeader(
+        std::istream& in) {
+    OPENSIM_THROW_IF(readField<unsigned int>(in) != MagicNumber, Exception,
+            "SensorStreamReader: stream does not start with the 'OSNS' "
+            "magic number.");
+    const unsigned int version = readField<unsigned int>(in);
+    OPENSIM_THROW_IF(version != FormatVersion, Exception,
+            "SensorStreamReader: unsupported stream format version " +
+            std::to_string(version) + ".");
+    const unsigned int numSensors = readField<unsigned int>(in);
+    StreamHeader header;
+    header.dataRate = readField<double>(in);
+    for (unsigned int i = 0; i < numSensors; ++i) {
+        const unsigned int nameLength = readField<unsigned int>(in);
+        std::string name(nameLength, '\0');
+        in.read(&name[0], nameLength);
+        header.sensorNames.push_back(std::move(name));
+    }
+    OPENSIM_THROW_IF(!in.good(), Exception,
+            "SensorStreamReader: stream ended inside the header.");
+    return header;
+}
+
+void SensorStreamReader::writeFrame(std::ostream& out, double timestamp,
+        const SimTK::Quaternion_<double>* quaternions, int numSensors) {
+    std::vector<unsigned char> buffer(getFrameSizeInBytes(numSensors));
+    encodeFrame(timestamp, quaternions, numSensors, buffer.data());
+    out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+DataAdapter::OutputTables
+SensorStreamReader::extendRead(const std::string& fileName) const {
+
+    OPENSIM_THROW_IF(fileName.empty(),
+        EmptyFileName);
+
+    std::ifstream in_stream{ fileName, std::ios::binary };
+    OPENSIM_THROW_IF(!in_stream.good(),
+        FileDoesNotExist,
+        fileName);
+
+    const StreamHeader header = readHeader(in_stream);
+    const int n_imus = int(header.sensorNames.size());
+    OPENSIM_THROW_IF(n_imus < 1, Exception,
+            "SensorStreamReader: '" + fileName + "' names no sensors.");
+
+    // Frames are fixed size, so the frame count follows from the bytes
+    // remaining after the header and the matrices are sized exactly once.
+    const std::streampos dataStart = in_stream.tellg();
+    in_stream.seekg(0, std::ios::end);
+    const long long dataBytes = (long long)(in_stream.tellg() - dataStart);
+    in_stream.seekg(dataStart);
+    const int frameSize = getFrameSizeInBytes(n_imus);
+    // A trailing partial frame (recorder killed mid-write) ends the stream.
+    const int numRows = int(dataBytes / frameSize);
+
+    SimTK::Matrix_<SimTK::Quaternion> rotationsData{ numRows, n_imus };
+    // This format carries orientations only; the companion tables that
+    // other IMU readers may populate come back empty.
+    SimTK::Matrix_<SimTK::Vec3> linearAccelerationData{ 0, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> magneticHeadingData{ 0, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> angularVelocityData{ 0, n_imus };
+    std::vector<double> times;
+    times.resize(numRows);
+
+    std::vector<unsigned char> frame(frameSize);
+    std::vector<SimTK::Quaternion> quaternions(n_imus);
+    for (int rowNumber = 0; rowNumber < numRows; ++rowNumber) {
+        in_stream.read(reinterpret_cast<char*>(frame.data()), frameSize);
+        times[rowNumber] =
+                decodeFrame(frame.data(), n_imus, quaternions.data());
+        for (int imu_index = 0; imu_index < n_imus; ++imu_index)
+            rotationsData(rowNumber, imu_index) = quaternions[imu_index];
+    }
+
+    // Prefer the negotiated rate; fall back to the recorded timestamps.
+    double dataRate = header.dataRate;
+    if (dataRate <= 0 && numRows > 1 && times[numRows - 1] > times[0])
+        dataRate = (numRows - 1) / (times[numRows - 1] - times[0]);
+
+    DataAdapter::OutputTables tables = createTablesFromMatrices(dataRate,
+        header.sensorNames, times, rotationsData, linearAccelerationData,
+        magneticHeadingData, angularVelocityData);
+    return tables;
+}
+
+void SensorStreamReader::extendWrite(const DataAdapter::InputTables& tables,
+        const std::string& sinkName) const {
+
+    OPENSIM_THROW_IF(tables.count(Orientations) == 0, Exception,
+            "SensorStreamReader: no '" + Orientations + "' table to write.");
+    const auto& quatTable = dynamic_cast<const TimeSeriesTableQuaternion&>(
+            *tables.at(Orientations));
+
+    StreamHeader header;
+    header.sensorNames = quatTable.getColumnLabels();
+    if (quatTable.hasTableMetaDataKey("DataRate")) {
+        header.dataRate = std::stod(quatTable.getTableMetaData()
+                .getValueForKey("DataRate").getValue<std::string>());
+    }
+
+    std::ofstream out_stream{ sinkName, std::ios::binary };
+    OPENSIM_THROW_IF(!out_stream.good(), Exception,
+            "SensorStreamReader: could not open '" + sinkName +
+            "' for writing.");
+    writeHeader(out_stream, header);
+
+    const auto& times = quatTable.getIndependentColumn();
+    std::vector<SimTK::Quaternion> quaternions(quatTable.getNumColumns());
+    for (size_t row = 0; row < quatTable.getNumRows(); ++row) {
+        const auto rowView = quatTable.getRowAtIndex(row);
+        for (int i = 0; i < int(quaternions.size()); ++i)
+            quaternions[i] = rowView[i];
+        writeFrame(out_stream, times[row], quaternions.data(),
+                int(quaternions.size()));
+    }
+}
+
+} // namespace OpenSim
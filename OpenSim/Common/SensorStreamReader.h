@@ -0,0 +1,147 @@
+#ifndef OPENSIM_SENSOR_STREAM_READER_H_
+#define OPENSIM_SENSOR_STREAM_READER_H_
+
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  SensorStreamReader.h                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ExperimentalSensor.h"
+#include "IMUDataReader.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/** @file
+* This file defines the compact binary wire/stream format for framed sensor
+* orientation data and the DataAdapter that reads recorded streams.
+*/
+
+namespace OpenSim {
+
+/** SensorStreamReader defines a compact framed binary format for streams of
+    sensor (IMU) orientation frames and reads recorded streams into
+    datatables like the other IMU readers.
+
+    The format front-loads all string handling into a header that is
+    written (negotiated) once per stream, so that steady-state frames are
+    fixed-size binary records a network ingester can parse with no string
+    handling at all:
+
+    Header (variable size, once per stream):
+    - magic 'OSNS' and format version, each 4-byte unsigned
+    - 4-byte unsigned sensor count
+    - 8-byte double nominal data rate in Hz (0 if unknown)
+    - sensor id table: for each wire id 0..n-1, a 4-byte unsigned name
+      length followed by that many name bytes. The position in the table is
+      the sensor's id; frames never carry names.
+
+    Frame (fixed size, 8 + 16*n bytes):
+    - 8-byte double timestamp in seconds
+    - per sensor, in id order: quaternion (w, x, y, z) as 4-byte floats.
+
+    All fields are little-endian. Quaternions are normalized on decode so
+    the 4-byte floats' rounding never produces an invalid rotation.
+
+    The frame codec (getFrameSizeInBytes()/encodeFrame()/decodeFrame()) is
+    usable on raw network buffers independent of any file, for feeding
+    frames straight into a live pipeline (e.g. IMUStreamReceiver). extendRead()
+    reads a recorded stream into an orientations table; the companion
+    signal tables the other IMU readers produce come back empty. */
+class OSIMCOMMON_API SensorStreamReader : public IMUDataReader {
+public:
+
+    SensorStreamReader() = default;
+    SensorStreamReader(const SensorStreamReader&)            = default;
+    SensorStreamReader(SensorStreamReader&&)                 = default;
+    SensorStreamReader& operator=(const SensorStreamReader&) = default;
+    SensorStreamReader& operator=(SensorStreamReader&&)      = default;
+    virtual ~SensorStreamReader() = default;
+
+    SensorStreamReader* clone() const override;
+
+    /** 'OSNS', written first so a receiver can reject foreign data. */
+    static const unsigned int MagicNumber;
+    /** Version of the format this reader writes and accepts. */
+    static const unsigned int FormatVersion;
+
+    /** In-memory form of the stream header: the sensor id table (a
+    sensor's wire id is its index in sensorNames) and the nominal data
+    rate in Hz (0 if unknown). */
+    struct StreamHeader {
+        double dataRate{0};
+        std::vector<std::string> sensorNames;
+    };
+
+    /** Build a header from an ExperimentalSensor list: wire ids follow the
+    list order and names are the sensors' name_in_model, matching the
+    column labels the file-based readers produce. */
+    static StreamHeader makeHeader(
+            const std::vector<ExperimentalSensor>& sensors, double dataRate);
+
+    /// @name Frame codec
+    /// Fixed-size frame encoding/decoding on raw buffers; no allocation,
+    /// no string handling. Suitable for a per-datagram receive path.
+    /// @{
+    /** Size of one frame for numSensors sensors: 8 + 16*numSensors. */
+    static int getFrameSizeInBytes(int numSensors) {
+        return 8 + 16 * numSensors;
+    }
+    /** Encode one frame into buffer, which must hold
+    getFrameSizeInBytes(numSensors) bytes. */
+    static void encodeFrame(double timestamp,
+            const SimTK::Quaternion_<double>* quaternions, int numSensors,
+            unsigned char* buffer);
+    /** Decode one frame from buffer into numSensors quaternions
+    (normalized); returns the frame timestamp. */
+    static double decodeFrame(const unsigned char* buffer, int numSensors,
+            SimTK::Quaternion_<double>* quaternions);
+    /// @}
+
+    /// @name Stream I/O
+    /// Header negotiation and frame records on binary streams.
+    /// @{
+    static void writeHeader(std::ostream& out, const StreamHeader& header);
+    /** Read and validate a header; throws if the magic number or version
+    does not match. */
+    static StreamHeader readHeader(std::istream& in);
+    static void writeFrame(std::ostream& out, double timestamp,
+            const SimTK::Quaternion_<double>* quaternions, int numSensors);
+    /// @}
+
+protected:
+    /** Read a recorded stream file: header, then frames to end of file
+    (a trailing partial frame, e.g. from a recorder killed mid-write, ends
+    the stream). Produces the usual table set; only orientations is
+    populated.
+    @see IMUDataReader class for utilities to extract/access specific
+    table(s) */
+    DataAdapter::OutputTables extendRead(
+            const std::string& fileName) const override;
+
+    /** Write the orientations table of tables as a stream file, taking the
+    data rate from the table's DataRate metadata when present. */
+    void extendWrite(const DataAdapter::InputTables& tables,
+            const std::string& sinkName) const override;
+};
+
+} // OpenSim namespace
+
+#endif // OPENSIM_SENSOR_STREAM_READER_H_
@@ -25,6 +25,7 @@
 // C++ INCLUDES
 #include "SimmSpline.h"
 #include "Constant.h"
+#include "HotPathCounters.h"
 #include "SimmMacros.h"
 #include "XYFunctionInterface.h"
 #include "FunctionAdapter.h"
@@ -510,6 +511,8 @@ int SimmSpline::addPoint(double aX, double aY)
 
 double SimmSpline::calcValue(const Vector& x) const
 {
+    HotPathCounters::increment(HotPathCounters::SplineEvaluations);
+
     // NOT A NUMBER
     if(!_y.getSize()) return(SimTK::NaN);
     if(!_b.getSize()) return(SimTK::NaN);
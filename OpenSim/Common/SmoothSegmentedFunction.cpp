@@ -95,7 +95,9 @@ SmoothSegmentedFunction::
           double x0, double x1, double y0, double y1,double dydx0, double dydx1,
           bool computeIntegral, bool intx0x1, const std::string& name):
 _x0(x0),_x1(x1),_y0(y0),_y1(y1),_dydx0(dydx0),_dydx1(dydx1),
-     _computeIntegral(computeIntegral),_intx0x1(intx0x1),_name(name)
+     _computeIntegral(computeIntegral),_intx0x1(intx0x1),_name(name),
+     _useLookupTable(false),_lutDx(SimTK::NaN),_lutNumIntervals(0),
+     _lutMaxError(SimTK::NaN)
 {
     
 
@@ -166,14 +168,16 @@ _x0(x0),_x1(x1),_y0(y0),_y1(y1),_dydx0(dydx0),_dydx1(dydx1),
  SmoothSegmentedFunction::SmoothSegmentedFunction():
  _x0(SimTK::NaN),_x1(SimTK::NaN),_y0(SimTK::NaN)
      ,_y1(SimTK::NaN),_dydx0(SimTK::NaN),_dydx1(SimTK::NaN),
-     _computeIntegral(false),_intx0x1(false),_name("NOT_YET_SET")
+     _computeIntegral(false),_intx0x1(false),_name("NOT_YET_SET"),
+     _useLookupTable(false),_lutDx(SimTK::NaN),_lutNumIntervals(0),
+     _lutMaxError(SimTK::NaN)
  {
-        _arraySplineUX.resize(0);        
+        _arraySplineUX.resize(0);
         _mXVec.resize(0);
         _mYVec.resize(0);
         _splineYintX = SimTK::Spline();
         _numBezierSections = (int)SimTK::NaN;
-       
+
  }
 
  /*Detailed Computational Costs
@@ -202,6 +206,9 @@ double SmoothSegmentedFunction::calcValue(double x) const
     double yVal = 0;
     if(x >= _x0 && x <= _x1 )
     {
+        if(_useLookupTable){
+            return calcLookupTableValue(x,0);
+        }
         int idx  = SegmentedQuinticBezierToolkit::calcIndex(x,_mXVec);
         double u = SegmentedQuinticBezierToolkit::
                  calcU(x,_mXVec[idx], _arraySplineUX[idx], UTOL,MAXITER);
@@ -269,7 +276,10 @@ double SmoothSegmentedFunction::calcDerivative(double x, int order) const
     if(order==0){
                 yVal = calcValue(x);
     }else{
-            if(x >= _x0 && x <= _x1){        
+            if(x >= _x0 && x <= _x1){
+                if(_useLookupTable && order <= 2){
+                    return calcLookupTableValue(x,order);
+                }
                 int idx  = SegmentedQuinticBezierToolkit::calcIndex(x,_mXVec);
                 double u = SegmentedQuinticBezierToolkit::
                                 calcU(x,_mXVec[idx], _arraySplineUX[idx], 
@@ -323,6 +333,130 @@ double SmoothSegmentedFunction::
     return calcDerivative(ax(0), derivComponents.size());
 }
 
+void SmoothSegmentedFunction::fillLookupTable(int numIntervals)
+{
+    _lutNumIntervals = numIntervals;
+    _lutDx = (_x1-_x0)/numIntervals;
+    _lutNodes.resize(numIntervals+1);
+    for(int i=0; i<=numIntervals; i++){
+        //Guard against rounding drift at the right end of the domain
+        double x = (i<numIntervals) ? _x0 + i*_lutDx : _x1;
+        _lutNodes[i] = SimTK::Vec4(calcValue(x),
+                                   calcDerivative(x,1),
+                                   calcDerivative(x,2),
+                                   calcDerivative(x,3));
+    }
+}
+
+/*
+On the grid interval [xk, xk+1] with t = (x-xk)/h, the cubic Hermite
+interpolant of a quantity f with nodal slopes g is
+
+    f(t) = (2t^3-3t^2+1) f(xk)   + (t^3-2t^2+t) h g(xk)
+         + (-2t^3+3t^2)  f(xk+1) + (t^3-t^2)    h g(xk+1).
+
+The value uses (y, dy/dx) and each supported derivative order d uses
+(d^d y, d^(d+1) y), so every supported order interpolates with O(h^4)
+error and matches the exact curve at the grid points.
+*/
+double SmoothSegmentedFunction::calcLookupTableValue(double x, int order) const
+{
+    double s = (x-_x0)/_lutDx;
+    int k = (int)s;
+    if(k >= _lutNumIntervals)
+        k = _lutNumIntervals-1; //x == _x1
+    double t = s-k;
+
+    const SimTK::Vec4& n0 = _lutNodes[k];
+    const SimTK::Vec4& n1 = _lutNodes[k+1];
+    double f0 = n0[order];
+    double g0 = n0[order+1];
+    double f1 = n1[order];
+    double g1 = n1[order+1];
+
+    double t2 = t*t;
+    double t3 = t2*t;
+    return   (2.0*t3 - 3.0*t2 + 1.0)*f0 + (t3 - 2.0*t2 + t)*_lutDx*g0
+           + (-2.0*t3 + 3.0*t2)*f1     + (t3 - t2)*_lutDx*g1;
+}
+
+void SmoothSegmentedFunction::buildLookupTable(double tolerance)
+{
+    SimTK_ERRCHK1_ALWAYS(tolerance > 0,
+        "SmoothSegmentedFunction::buildLookupTable",
+        "%s: tolerance must be greater than zero",_name.c_str());
+    SimTK_ERRCHK1_ALWAYS(!(SimTK::isNaN(_x0) || SimTK::isNaN(_x1)),
+        "SmoothSegmentedFunction::buildLookupTable",
+        "%s: curve has not been initialized",_name.c_str());
+
+    //The exact path must be used both to fill the table and to measure
+    //its error.
+    _useLookupTable = false;
+
+    static const int minIntervals = 128;
+    static const int maxIntervals = 65536;
+
+    int numIntervals = minIntervals;
+    double maxError = SimTK::Infinity;
+    while(true){
+        fillLookupTable(numIntervals);
+
+        //Measure the value and first-derivative errors at the interval
+        //midpoints, where the Hermite interpolation error peaks.
+        maxError = 0;
+        for(int k=0; k<_lutNumIntervals; k++){
+            double xmid = _x0 + (k+0.5)*_lutDx;
+            double errY = abs(calcLookupTableValue(xmid,0)
+                              - calcValue(xmid));
+            double errDY = abs(calcLookupTableValue(xmid,1)
+                               - calcDerivative(xmid,1));
+            if(errY > maxError)
+                maxError = errY;
+            if(errDY > maxError)
+                maxError = errDY;
+        }
+
+        if(maxError <= tolerance || numIntervals >= maxIntervals)
+            break;
+        numIntervals *= 2;
+    }
+
+    _lutMaxError = maxError;
+    _useLookupTable = true;
+}
+
+bool SmoothSegmentedFunction::isLookupTableInUse() const
+{
+    return _useLookupTable;
+}
+
+double SmoothSegmentedFunction::getLookupTableMaxError() const
+{
+    return _lutMaxError;
+}
+
+void SmoothSegmentedFunction::clearLookupTable()
+{
+    _useLookupTable = false;
+    _lutNodes.clear();
+    _lutDx = SimTK::NaN;
+    _lutNumIntervals = 0;
+    _lutMaxError = SimTK::NaN;
+}
+
+void SmoothSegmentedFunction::calcValues(int order, const SimTK::Vector& x,
+    SimTK::Vector& y) const
+{
+    y.resize(x.size());
+    if(order == 0){
+        for(int i=0; i<x.size(); i++)
+            y[i] = calcValue(x[i]);
+    }else{
+        for(int i=0; i<x.size(); i++)
+            y[i] = calcDerivative(x[i],order);
+    }
+}
+
 /*Detailed Computational Costs
 ________________________________________________________________________
 If x is in the Bezier Curve, and dy/dx is being evaluated
@@ -413,11 +547,36 @@ std::string SmoothSegmentedFunction::getName() const
     return _name;
 }
 
-void SmoothSegmentedFunction::setName(std::string &name) 
+void SmoothSegmentedFunction::setName(std::string &name)
 {
     _name = name;
 }
 
+std::size_t SmoothSegmentedFunction::getMemorySizeEstimate() const
+{
+    std::size_t bytes = sizeof(*this);
+
+    //Bezier control points: a pair of 6x1 Vectors per section
+    for (int i = 0; i < (int)_mXVec.size(); ++i) {
+        bytes += (_mXVec[i].size() + _mYVec[i].size())*sizeof(double);
+    }
+
+    //The spline fits store their sample abscissae, ordinates and derivative
+    //coefficients. Each x(u) inverse fit covers NUM_SAMPLE_PTS samples; the
+    //integral fit covers NUM_SAMPLE_PTS samples per Bezier section.
+    const std::size_t perSample = 3*sizeof(double);
+    bytes += _arraySplineUX.size()*NUM_SAMPLE_PTS*perSample;
+    if (_computeIntegral && _numBezierSections > 0) {
+        bytes += (NUM_SAMPLE_PTS*_numBezierSections-(_numBezierSections-1))
+                 *perSample;
+    }
+
+    //Lookup-table nodes: value and first three derivatives per grid point
+    bytes += _lutNodes.size()*sizeof(SimTK::Vec4);
+
+    return bytes;
+}
+
 SimTK::Vec2 SmoothSegmentedFunction::getCurveDomain() const
 {
     SimTK::Vec2 xrange;
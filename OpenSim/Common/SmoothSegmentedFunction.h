@@ -25,6 +25,8 @@
 #include "osimCommonDLL.h"
 #include "SegmentedQuinticBezierToolkit.h"
 
+#include <cstddef>
+
 namespace OpenSim { 
 
     /**
@@ -132,6 +134,57 @@ namespace OpenSim {
        using Function_<double>::calcDerivative;
 #endif
 
+       /**Builds, and enables, a dense lookup-table approximation of this
+       curve. The curve domain is sampled on a uniform grid, storing the
+       value and first three derivatives at each grid point, and
+       calcValue(double) and calcDerivative(double,int) (orders 1 and 2)
+       subsequently evaluate a cubic Hermite interpolation of the
+       surrounding grid interval: a handful of multiplications and
+       additions from two adjacent table entries, rather than the index
+       search, iterative inversion of x(u), and Bezier evaluation of the
+       exact path. Derivatives of order 3 and above, calcIntegral(), and
+       points outside the curve domain always use the exact path.
+
+       The grid is refined (doubling the number of intervals, starting from
+       128 and stopping at 65536) until the value and first-derivative
+       errors, measured against the exact curve at every interval midpoint,
+       are no larger than tolerance; the achieved bound is available from
+       getLookupTableMaxError(). A tolerance of 1e-8 is reached by typical
+       muscle curves with a few hundred intervals.
+
+       @param tolerance the maximum permissible absolute error in the value
+              and first derivative of the lookup table, measured at the
+              interval midpoints.
+       */
+       void buildLookupTable(double tolerance);
+
+       /**@return true if buildLookupTable() has been called, so that
+       calcValue(double) and calcDerivative(double,int) evaluate the
+       lookup table rather than the exact Bezier path*/
+       bool isLookupTableInUse() const;
+
+       /**@return the maximum absolute error of the lookup table's value
+       and first derivative measured at the interval midpoints, or NaN if
+       no lookup table has been built*/
+       double getLookupTableMaxError() const;
+
+       /**Discards the lookup table, returning this curve to the exact
+       evaluation path.*/
+       void clearLookupTable();
+
+       /**Evaluates the curve, or one of its derivatives, at a batch of
+       domain points in one call.
+
+       @param order the derivative order: 0 evaluates the value, as
+              calcValue(double); higher orders evaluate derivatives, as
+              calcDerivative(double,int).
+       @param x the domain points of interest
+       @param y resized to x.size() and populated with the evaluations,
+              using the lookup table when one has been built
+       */
+       void calcValues(int order, const SimTK::Vector& x,
+                       SimTK::Vector& y) const;
+
 
        /**This will return the value of the integral of this objects curve 
        evaluated at x. 
@@ -185,6 +238,15 @@ namespace OpenSim {
 
        void setName(std::string &name);
 
+       /**
+       Returns an estimate, in bytes, of the heap storage this curve holds:
+       the Bezier control points, the spline fits, and the lookup-table
+       nodes when the lookup table is enabled. Components that own one of
+       these curves can add this to their memory footprint report.
+
+       @return the estimated size of this curve's storage, in bytes*/
+       std::size_t getMemorySizeEstimate() const;
+
        /**
        This function returns a SimTK::Vec2 that contains in its 0th element
        the lowest value of the curve domain, and in its 1st element the highest
@@ -344,7 +406,32 @@ namespace OpenSim {
         bool _intx0x1;
         /**The name of the function**/
         std::string _name;
-            
+
+        /**When true, calcValue(double) and calcDerivative(double,int)
+        (orders 1 and 2) evaluate the lookup table below instead of the
+        exact Bezier path*/
+        bool _useLookupTable;
+        /**Lookup-table grid entries: the value and first three derivatives
+        of the curve at each of the uniformly spaced grid points spanning
+        [_x0,_x1]*/
+        SimTK::Array_<SimTK::Vec4> _lutNodes;
+        /**The uniform grid spacing of the lookup table*/
+        double _lutDx;
+        /**The number of grid intervals in the lookup table*/
+        int _lutNumIntervals;
+        /**The maximum midpoint error of the lookup table's value and first
+        derivative; see buildLookupTable()*/
+        double _lutMaxError;
+
+        /**Populates _lutNodes with numIntervals+1 uniformly spaced samples
+        of the exact curve*/
+        void fillLookupTable(int numIntervals);
+
+        /**Cubic Hermite interpolation of derivative order (0, 1, or 2)
+        from the lookup-table interval containing x, which must lie in
+        [_x0,_x1]*/
+        double calcLookupTableValue(double x, int order) const;
+
         /**No human should be constructing a SmoothSegmentedFunction, so the
         constructor is made private so that mere mortals cannot look at it. 
         SmoothSegmentedFunctionFactory should be used to create MuscleCurveFunctions
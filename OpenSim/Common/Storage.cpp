@@ -2475,10 +2475,10 @@ lowpassFIR(int aOrder,double aCutoffFrequency)
  * Find the index of the storage element that occurred immediately before
  * or at time aT ( aT <= getTime(index) ).
  *
- * This method can be much more efficient than findIndex(aT) if a good guess
+ * This method can be more efficient than findIndex(aT) if a good guess
  * is made for aI.
- * If aI corresponds to a state which occurred later than aT, an exhaustive
- * search is performed by calling findIndex(aT).
+ * If aI corresponds to a state which occurred later than aT, or aT is well
+ * past aI, the search falls back to findIndex(aT).
  *
  * @param aI Index at which to start searching.
  * @param aT Time.
@@ -2491,14 +2491,19 @@ findIndex(int aI,double aT) const
     // MAKE SURE aI IS VALID
     if(_storage.getSize()<=0) return(-1);
     if((aI>=_storage.getSize())||(aI<0)) aI=0;
-    if(getStateVector(aI)->getTime()>aT) aI=0;
+    if(getStateVector(aI)->getTime()>aT) return(findIndex(aT));
 
     // SEARCH
-    //cout << "Storage.findIndex: starting at " << aI << endl;
+    // Sequential access usually advances by a frame or two, so scan a few
+    // elements past the guess before falling back to a binary search.
+    int windowEnd = aI + 8;
+    if(windowEnd>_storage.getSize()) windowEnd = _storage.getSize();
     int i;
-    for(i=aI;i<_storage.getSize();i++) {
+    for(i=aI;i<windowEnd;i++) {
         if(aT<getStateVector(i)->getTime()) break;
     }
+    if((i==windowEnd)&&(windowEnd<_storage.getSize()))
+        return(findIndex(aT));
     _lastI = i-1;
     if(_lastI<0) _lastI=0;
     return(_lastI);
@@ -2508,8 +2513,8 @@ findIndex(int aI,double aT) const
  * Find the index of the storage element that occurred immediately before
  * or at a specified time ( getTime(index) <= aT ).
  *
- * This method is not very efficient because it always starts its search
- * with the first stored state.
+ * This method performs a binary search over the stored times, which are
+ * nondecreasing.
  *
  * @param aT Time.
  * @return Index preceding or at time aT.  If aT is less than the earliest
@@ -2519,11 +2524,17 @@ int Storage::
 findIndex(double aT) const
 {
     if(_storage.getSize()<=0) return(-1);
-    int i;
-    for(i=0;i<_storage.getSize();i++) {
-        if(aT<getStateVector(i)->getTime()) break;
-    }
-    _lastI = i-1;
+    // Binary search for the first element with time greater than aT; the
+    // element before it is the answer. Storage times are nondecreasing, so
+    // this matches the linear scan it replaces at O(log n) cost.
+    int lo = 0;
+    int hi = _storage.getSize();
+    while(lo<hi) {
+        int mid = lo + (hi-lo)/2;
+        if(aT<getStateVector(mid)->getTime()) hi = mid;
+        else lo = mid+1;
+    }
+    _lastI = lo-1;
     if(_lastI<0) _lastI=0;
     return(_lastI);
 }
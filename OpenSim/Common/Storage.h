@@ -378,6 +378,14 @@ private:
 //=============================================================================
 };  // END of class Storage
 
+/** Fill an existing Storage with the contents of a data table, flattening
+non-scalar tables (TimeSeriesTable_<SimTK::Vec3>, etc.) to scalar columns.
+This is the conversion that the Storage file-reading constructor performs
+internally; it is exposed so code that already holds a TimeSeriesTable can
+cross into Storage-based APIs without a round trip through a file.           */
+OSIMCOMMON_API void convertTableToStorage(const AbstractDataTable* table,
+                                          Storage& sto);
+
 }; //namespace
 //=============================================================================
 //=============================================================================
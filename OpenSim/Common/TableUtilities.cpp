@@ -219,20 +219,55 @@ inline std::unique_ptr<FunctionSet> createFunctionSet<GCVSpline>(
 template <typename TimeVector, typename FunctionType>
 TimeSeriesTable TableUtilities::resample(
         const TimeSeriesTable& in, const TimeVector& newTime) {
+    return TableResampler<FunctionType>(in).resample(newTime);
+}
 
-    const auto& time = in.getIndependentColumn();
+template <typename FunctionType>
+TimeSeriesTable TableUtilities::resampleWithInterval(
+        const TimeSeriesTable& in, double interval) {
+    return TableResampler<FunctionType>(in).resampleWithInterval(interval);
+}
+
+template <typename FunctionType>
+TimeSeriesTable TableUtilities::resampleWithIntervalBounded(
+        const TimeSeriesTable& in, double interval) {
+    return TableResampler<FunctionType>(in).resampleWithIntervalBounded(
+            interval);
+}
 
+template <typename FunctionType>
+TableResampler<FunctionType>::TableResampler(const TimeSeriesTable& in) {
+    const auto& time = in.getIndependentColumn();
     OPENSIM_THROW_IF(time.size() < 2, Exception,
             "Cannot resample if number of times is 0 or 1.");
-    OPENSIM_THROW_IF(newTime[0] < time[0], Exception,
+    m_initialTime = time.front();
+    m_finalTime = time.back();
+
+    // Keep the metadata and labels, but none of the rows.
+    m_prototype = in;
+    for (int irow = (int)m_prototype.getNumRows() - 1; irow >= 0; --irow) {
+        m_prototype.removeRowAtIndex(irow);
+    }
+
+    m_functions = createFunctionSet<FunctionType>(in);
+    m_evaluator.reset(new FunctionSetEvaluator(*m_functions));
+}
+
+template <typename FunctionType>
+TableResampler<FunctionType>::~TableResampler() = default;
+
+template <typename FunctionType>
+template <typename TimeVector>
+TimeSeriesTable TableResampler<FunctionType>::resampleInternal(
+        const TimeVector& newTime) const {
+    OPENSIM_THROW_IF(newTime[0] < m_initialTime, Exception,
             "New initial time ({}) cannot be less than existing initial time "
             "({})",
-            newTime[0], time[0]);
-    OPENSIM_THROW_IF(newTime[newTime.size() - 1] > time[time.size() - 1],
-            Exception,
+            newTime[0], m_initialTime);
+    OPENSIM_THROW_IF(newTime[newTime.size() - 1] > m_finalTime, Exception,
             "New final time ({}) cannot be greater than existing final time "
             "({})",
-            newTime[newTime.size() - 1], time[time.size() - 1]);
+            newTime[newTime.size() - 1], m_finalTime);
     for (int itime = 1; itime < (int)newTime.size(); ++itime) {
         OPENSIM_THROW_IF(newTime[itime] < newTime[itime - 1], Exception,
                 "New times must be non-decreasing, but "
@@ -240,45 +275,48 @@ TimeSeriesTable TableUtilities::resample(
                 itime, itime - 1, newTime[itime], newTime[itime - 1]);
     }
 
-    // Copy over metadata.
-    TimeSeriesTable out = in;
-    for (int irow = (int)out.getNumRows() - 1; irow >= 0; --irow) {
-        out.removeRowAtIndex(irow);
-    }
-
-    std::unique_ptr<FunctionSet> functions =
-            createFunctionSet<FunctionType>(in);
-    SimTK::Vector curTime(1);
-    SimTK::RowVector row(functions->getSize());
+    TimeSeriesTable out = m_prototype;
+    const int numColumns = m_functions->getSize();
+    SimTK::Vector values(numColumns);
+    SimTK::RowVector row(numColumns);
     for (int itime = 0; itime < (int)newTime.size(); ++itime) {
-        curTime[0] = newTime[itime];
-        for (int icol = 0; icol < functions->getSize(); ++icol) {
-            row(icol) = functions->get(icol).calcValue(curTime);
+        m_evaluator->calcValues(0, newTime[itime], values);
+        for (int icol = 0; icol < numColumns; ++icol) {
+            row(icol) = values[icol];
         }
-        // Not efficient!
-        out.appendRow(curTime[0], row);
+        out.appendRow(newTime[itime], row);
     }
     return out;
 }
 
 template <typename FunctionType>
-TimeSeriesTable TableUtilities::resampleWithInterval(
-        const TimeSeriesTable& in, double interval) {
+TimeSeriesTable TableResampler<FunctionType>::resample(
+        const std::vector<double>& newTime) const {
+    return resampleInternal(newTime);
+}
+
+template <typename FunctionType>
+TimeSeriesTable TableResampler<FunctionType>::resample(
+        const SimTK::Vector& newTime) const {
+    return resampleInternal(newTime);
+}
+
+template <typename FunctionType>
+TimeSeriesTable TableResampler<FunctionType>::resampleWithInterval(
+        double interval) const {
     std::vector<double> time;
-    double t = in.getIndependentColumn().front();
-    double finalTime = in.getIndependentColumn().back();
-    while (t <= finalTime) {
+    double t = m_initialTime;
+    while (t <= m_finalTime) {
         time.push_back(t);
         t += interval;
     }
-    return resample<std::vector<double>, FunctionType>(in, time);
+    return resampleInternal(time);
 }
 
 template <typename FunctionType>
-TimeSeriesTable TableUtilities::resampleWithIntervalBounded(
-        const TimeSeriesTable& in, double interval) {
-    const auto& time = in.getIndependentColumn();
-    double duration = time.back() - time.front();
+TimeSeriesTable TableResampler<FunctionType>::resampleWithIntervalBounded(
+        double interval) const {
+    double duration = m_finalTime - m_initialTime;
     if (duration / interval > Storage::MAX_RESAMPLE_SIZE) {
         double newInterval = duration / Storage::MAX_RESAMPLE_SIZE;
         log_warn("Requested resampling time interval {} leads to more than {} "
@@ -286,7 +324,7 @@ TimeSeriesTable TableUtilities::resampleWithIntervalBounded(
                 interval, Storage::MAX_RESAMPLE_SIZE, newInterval);
         interval = newInterval;
     }
-    return resampleWithInterval<FunctionType>(in, interval);
+    return resampleWithInterval(interval);
 }
 TimeSeriesTable_<SimTK::Vec3> TableUtilities::convertRotationsToEulerAngles(
         const TimeSeriesTable_<SimTK::Rotation>& rotTable) {
@@ -337,4 +375,7 @@ template OSIMCOMMON_API TimeSeriesTable TableUtilities::resampleWithIntervalBoun
 template OSIMCOMMON_API TimeSeriesTable
 TableUtilities::resampleWithIntervalBounded<PiecewiseLinearFunction>(
         const TimeSeriesTable&, double);
+
+template class OSIMCOMMON_API TableResampler<GCVSpline>;
+template class OSIMCOMMON_API TableResampler<PiecewiseLinearFunction>;
 } // namespace OpenSim
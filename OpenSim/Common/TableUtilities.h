@@ -29,6 +29,8 @@
 #include "TimeSeriesTable.h"
 #include "osimCommonDLL.h"
 
+#include <memory>
+
 namespace OpenSim {
 
 class OSIMCOMMON_API TableUtilities {
@@ -109,6 +111,64 @@ private:
             const std::string* end, const std::string& desired);
 };
 
+class FunctionSet;
+class FunctionSetEvaluator;
+
+/// Holds the fitted interpolant of a table so that repeated resample
+/// requests -- different rates or different time grids over the same data --
+/// reuse a single fit instead of refitting the interpolant per call, as the
+/// one-shot TableUtilities::resample() does. The fit is performed once at
+/// construction; each resample call only evaluates it.
+///
+/// As with TableUtilities::resample(), a 5th-order GCVSpline is used as the
+/// interpolant by default (a lower order if the table has too few points),
+/// and PiecewiseLinearFunction is the other supported function type.
+///
+/// @code
+/// TableResampler<> resampler(ikResults);
+/// auto at100Hz = resampler.resampleWithInterval(0.01);
+/// auto at200Hz = resampler.resampleWithInterval(0.005);
+/// auto custom  = resampler.resample(customTimeGrid);
+/// @endcode
+template <typename FunctionType = GCVSpline>
+class OSIMCOMMON_API TableResampler {
+public:
+    /// Fit the interpolant to the table. The table's metadata and column
+    /// labels are kept and copied into every resampled table.
+    /// @throws Exception if getNumTimes() < 2.
+    explicit TableResampler(const TimeSeriesTable& in);
+    ~TableResampler();
+
+    TableResampler(const TableResampler&) = delete;
+    TableResampler& operator=(const TableResampler&) = delete;
+
+    /// Resample (interpolate) at the provided times.
+    /// @throws Exception if new times are not within existing initial and
+    /// final times, or if the new times are decreasing.
+    TimeSeriesTable resample(const std::vector<double>& newTime) const;
+    /// @copydoc resample()
+    TimeSeriesTable resample(const SimTK::Vector& newTime) const;
+    /// Resample using the given time interval (using resample()). The new
+    /// final time is not guaranteed to match the original final time.
+    TimeSeriesTable resampleWithInterval(double interval) const;
+    /// Same as resampleWithInterval() but the interval may be reduced
+    /// to ensure the number of sampling points does not exceed
+    /// Storage::MAX_RESAMPLE_SIZE.
+    TimeSeriesTable resampleWithIntervalBounded(double interval) const;
+
+private:
+    template <typename TimeVector>
+    TimeSeriesTable resampleInternal(const TimeVector& newTime) const;
+
+    /// Copy of the input table with all rows removed; provides the metadata
+    /// and column labels of the resampled tables.
+    TimeSeriesTable m_prototype;
+    double m_initialTime;
+    double m_finalTime;
+    std::unique_ptr<FunctionSet> m_functions;
+    std::unique_ptr<FunctionSetEvaluator> m_evaluator;
+};
+
 } // namespace OpenSim
 
 #endif // OPENSIM_TABLEUTILITIES_H_
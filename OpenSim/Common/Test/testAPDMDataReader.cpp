@@ -28,6 +28,7 @@
 
 using namespace OpenSim;
 void testAPDMFormat7();
+void testAPDMSignalSelection();
 
 int main() {
 
@@ -96,7 +97,9 @@ int main() {
         ASSERT_EQUAL(quatFromTable, quatFromFile, tolerance);
         // Now test new Fromat=7
         testAPDMFormat7();
-        
+        // Selecting only the needed signals at read time
+        testAPDMSignalSelection();
+
      }
     catch (const std::exception& ex) {
         std::cout << "testAPDMDataReader FAILED: " << ex.what() << std::endl;
@@ -130,6 +133,40 @@ void testAPDMFormat7() {
     ASSERT_EQUAL(refGyro, fromFileGyro, tolerance);
     // Magnetometer data on a different imu from the last row
     const SimTK::Vec3 refMagneto{ -55.436261,-1.704153,16.382336 };
-    const SimTK::Vec3 fromFileMagneto = reader.getMagneticHeadingTable(tables).getRowAtIndex(2)[1]; 
+    const SimTK::Vec3 fromFileMagneto = reader.getMagneticHeadingTable(tables).getRowAtIndex(2)[1];
     ASSERT_EQUAL(refMagneto, fromFileMagneto, tolerance);
 }
+
+void testAPDMSignalSelection() {
+    // When only orientations are requested, the other signal tables come
+    // back empty and their columns are never decoded.
+    APDMDataReaderSettings readerSettings;
+    std::vector<std::string> imu_names{ "torso", "pelvis", "shank" };
+    std::vector<std::string> names_in_experiment{ "Static", "Upper", "Middle" };
+    for (int index = 0; index < (int)imu_names.size(); ++index) {
+        ExperimentalSensor nextSensor(names_in_experiment[index], imu_names[index]);
+        readerSettings.append_ExperimentalSensors(nextSensor);
+    }
+    readerSettings.set_read_linear_accelerations(false);
+    readerSettings.set_read_magnetic_heading(false);
+    readerSettings.set_read_angular_velocity(false);
+    APDMDataReader reader(readerSettings);
+    DataAdapter::OutputTables tables = reader.read("imuData01.csv");
+
+    ASSERT(reader.getLinearAccelerationsTable(tables).getNumRows() == 0);
+    ASSERT(reader.getMagneticHeadingTable(tables).getNumRows() == 0);
+    ASSERT(reader.getAngularVelocityTable(tables).getNumRows() == 0);
+
+    // Orientations are decoded as usual.
+    const TimeSeriesTableQuaternion& quatTableTyped =
+        reader.getOrientationsTable(tables);
+    size_t numRows = quatTableTyped.getNumRows();
+    ASSERT(numRows == 1024);
+    double tolerance = SimTK::Eps;
+    SimTK::Quaternion quatFromTable = quatTableTyped.getRowAtIndex(0)[0];
+    SimTK::Quaternion quatFromFile = SimTK::Quaternion(0.979286375, 0.000865605, -0.005158994, -0.202412525);
+    ASSERT_EQUAL(quatFromTable, quatFromFile, tolerance);
+    quatFromTable = quatTableTyped.getRowAtIndex(numRows - 1)[0];
+    quatFromFile = SimTK::Quaternion(0.979175344,0.00110321,-0.005109196,-0.202949069);
+    ASSERT_EQUAL(quatFromTable, quatFromFile, tolerance);
+}
@@ -188,9 +188,91 @@ void test(const std::string filename) {
     cout << "\tcop_" << forces_file << " is equivalent to its standard."<< endl;
 }
 
+void testDecimationAndSelection(const std::string filename) {
+    using namespace OpenSim;
+    using namespace std;
+
+    // Read the full file once as the reference.
+    C3DFileAdapter fullAdapter{};
+    auto fullTables = fullAdapter.read(filename);
+    auto full_markers = fullAdapter.getMarkersTable(fullTables);
+    auto full_forces = fullAdapter.getForcesTable(fullTables);
+
+    // Re-read keeping every 4th frame and only the first two markers.
+    const int decimation = 4;
+    const auto& fullLabels = full_markers->getColumnLabels();
+    ASSERT(fullLabels.size() >= 2, __FILE__, __LINE__,
+        "Expected at least two markers in " + filename);
+    std::vector<std::string> subset{fullLabels[0], fullLabels[1]};
+
+    C3DFileAdapter decimatingAdapter{};
+    decimatingAdapter.setReadDecimationFactor(decimation);
+    decimatingAdapter.setMarkersToRead(subset);
+    auto tables = decimatingAdapter.read(filename);
+    auto markers = decimatingAdapter.getMarkersTable(tables);
+    auto forces = decimatingAdapter.getForcesTable(tables);
+
+    // The decimated tables contain every 4th frame of the full tables with
+    // the original time stamps, and only the requested marker columns.
+    ASSERT(markers->getColumnLabels() == subset, __FILE__, __LINE__,
+        "Marker selection did not produce the requested columns.");
+    ASSERT(markers->getNumRows() ==
+               (full_markers->getNumRows() + decimation - 1) / decimation,
+        __FILE__, __LINE__, "Unexpected number of decimated marker rows.");
+    ASSERT(forces->getNumRows() ==
+               (full_forces->getNumRows() + decimation - 1) / decimation,
+        __FILE__, __LINE__, "Unexpected number of decimated force rows.");
+
+    for(size_t r = 0; r < markers->getNumRows(); ++r) {
+        const size_t fullRow = r * decimation;
+        ASSERT_EQUAL(markers->getIndependentColumn()[r],
+                     full_markers->getIndependentColumn()[fullRow],
+                     SimTK::SignificantReal, __FILE__, __LINE__,
+                     "Decimated marker times do not match the full read.");
+        for(int c = 0; c < 2; ++c) {
+            const auto& elt = markers->getMatrix().getElt((int)r, c);
+            const auto& fullElt =
+                    full_markers->getMatrix().getElt((int)fullRow, c);
+            // NaNs mark occluded markers; compare only observed frames.
+            if(SimTK::isNaN(fullElt[0])) {
+                ASSERT(SimTK::isNaN(elt[0]), __FILE__, __LINE__,
+                    "Expected occluded marker frame after decimation.");
+                continue;
+            }
+            ASSERT_EQUAL(elt, fullElt, SimTK::SignificantReal,
+                __FILE__, __LINE__,
+                "Decimated marker data do not match the full read.");
+        }
+    }
+
+    for(size_t r = 0; r < forces->getNumRows(); ++r) {
+        const size_t fullRow = r * decimation;
+        ASSERT_EQUAL(forces->getIndependentColumn()[r],
+                     full_forces->getIndependentColumn()[fullRow],
+                     SimTK::SignificantReal, __FILE__, __LINE__,
+                     "Decimated force times do not match the full read.");
+    }
+
+    // Requesting a marker that is not in the file fails.
+    C3DFileAdapter badAdapter{};
+    badAdapter.setMarkersToRead({"no_such_marker"});
+    bool threw = false;
+    try {
+        badAdapter.read(filename);
+    } catch (const OpenSim::Exception&) {
+        threw = true;
+    }
+    ASSERT(threw, __FILE__, __LINE__,
+        "Expected an exception for an unknown marker name.");
+
+    cout << "\tDecimation/selection read of " << filename
+         << " matches the full read." << endl;
+}
+
 int main() {
     SimTK_START_TEST("testC3DFileAdapter");
         SimTK_SUBTEST1(test, "walking2.c3d");
         SimTK_SUBTEST1(test, "walking5.c3d");
+        SimTK_SUBTEST1(testDecimationAndSelection, "walking2.c3d");
     SimTK_END_TEST();
 }
@@ -21,6 +21,13 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <OpenSim/Common/AllocationTracker.h>
+#include <OpenSim/Common/HotPathCounters.h>
 #include <OpenSim/Common/Component.h>
 #include <OpenSim/Common/Reporter.h>
 #include <OpenSim/Common/TableSource.h>
@@ -1240,6 +1247,724 @@ void testGetStateVariableValue() {
             OpenSim::Exception);
 }
 
+void testBinaryObjectFormat() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo1 = new Foo();
+    foo1->setName("foo1");
+    foo1->set_mass(2.5);
+    Foo* foo2 = new Foo();
+    foo2->setName("foo2");
+    Bar* bar = new Bar();
+    bar->setName("bar");
+    world.add(foo1);
+    world.add(foo2);
+    world.add(bar);
+    bar->connectSocket_parentFoo(*foo1);
+    bar->connectSocket_childFoo(*foo2);
+    world.connect(); // record connectee paths in the socket properties
+
+    world.printBinary("testBinaryFormat.osimbin");
+
+    std::unique_ptr<Object> loadedObj(
+            Object::makeObjectFromBinaryFile("testBinaryFormat.osimbin"));
+    TheWorld* loaded = dynamic_cast<TheWorld*>(loadedObj.get());
+    SimTK_TEST(loaded != nullptr);
+
+    // the property tree roundtrips exactly
+    SimTK_TEST(*loaded == world);
+
+    // and the loaded tree is fully functional
+    loaded->finalizeFromProperties();
+    loaded->connect();
+    SimTK_TEST(loaded->getComponent<Foo>("foo1").get_mass() == 2.5);
+    const Bar& loadedBar = loaded->getComponent<Bar>("bar");
+    SimTK_TEST(&loadedBar.getConnectee<Foo>("parentFoo") ==
+            &loaded->getComponent<Foo>("foo1"));
+
+    // files that are not binary object files are rejected up front
+    {
+        std::ofstream bad("testBinaryFormat_bad.osimbin", std::ios::binary);
+        bad << "<OpenSimDocument/>";
+    }
+    SimTK_TEST_MUST_THROW_EXC(
+            Object::makeObjectFromBinaryFile("testBinaryFormat_bad.osimbin"),
+            OpenSim::Exception);
+}
+
+void testIncrementalFinalizeFromProperties() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo1 = new Foo();
+    foo1->setName("foo1");
+    Foo* foo2 = new Foo();
+    foo2->setName("foo2");
+    world.add(foo1);
+    world.add(foo2);
+
+    world.finalizeFromProperties();
+    SimTK_TEST(world.isComponentTreeUpToDateWithProperties());
+
+    // calling the incremental variant on an up-to-date tree is a no-op
+    world.finalizeFromPropertiesIfNeeded();
+    SimTK_TEST(world.isComponentTreeUpToDateWithProperties());
+
+    // editing one property marks only the owning component out of date
+    foo2->set_mass(3.0);
+    SimTK_TEST(!world.isComponentTreeUpToDateWithProperties());
+    SimTK_TEST(world.isObjectUpToDateWithProperties());
+    SimTK_TEST(foo1->isObjectUpToDateWithProperties());
+    SimTK_TEST(!foo2->isObjectUpToDateWithProperties());
+
+    // incremental finalization brings just the stale subtree up to date
+    world.finalizeFromPropertiesIfNeeded();
+    SimTK_TEST(foo2->isObjectUpToDateWithProperties());
+    SimTK_TEST(world.isComponentTreeUpToDateWithProperties());
+    SimTK_TEST(foo2->get_mass() == 3.0);
+}
+
+void testStructuralHash() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo = new Foo();
+    foo->setName("foo");
+    foo->set_mass(1.0);
+    world.add(foo);
+
+    TheWorld twin;
+    twin.setName("world");
+    Foo* twinFoo = new Foo();
+    twinFoo->setName("foo");
+    twinFoo->set_mass(1.0);
+    twin.add(twinFoo);
+
+    // structurally identical trees hash identically, and repeated queries
+    // are stable
+    const std::uint64_t hash = world.getStructuralHash();
+    SimTK_TEST(hash == world.getStructuralHash());
+    SimTK_TEST(hash == twin.getStructuralHash());
+
+    // a mutation deep in the tree changes the root hash; restoring the
+    // value restores it
+    foo->set_mass(2.0);
+    SimTK_TEST(world.getStructuralHash() != hash);
+    foo->set_mass(1.0);
+    SimTK_TEST(world.getStructuralHash() == hash);
+
+    // renaming is a structural change too
+    world.setName("world2");
+    SimTK_TEST(world.getStructuralHash() != hash);
+}
+
+void testParallelFinalizeFromProperties() {
+
+    TheWorld world;
+    world.setName("world");
+    const int numComponents = 20;
+    for (int i = 0; i < numComponents; ++i) {
+        Foo* foo = new Foo();
+        foo->setName("foo" + std::to_string(i));
+        foo->set_mass(i + 1.0);
+        world.add(foo);
+    }
+
+    Component::setParallelFinalizeFromPropertiesEnabled(true);
+    SimTK_TEST(Component::getParallelFinalizeFromPropertiesEnabled());
+    world.finalizeFromProperties();
+    Component::setParallelFinalizeFromPropertiesEnabled(false);
+
+    // the parallel traversal must produce the same finalized tree as the
+    // serial one
+    SimTK_TEST(world.isComponentTreeUpToDateWithProperties());
+    int count = 0;
+    for (auto& foo : world.getComponentList<Foo>()) {
+        SimTK_TEST(foo.isObjectUpToDateWithProperties());
+        ++count;
+    }
+    SimTK_TEST(count == numComponents);
+    SimTK_TEST(world.getComponent<Foo>("foo7").get_mass() == 8.0);
+}
+
+void testMemoryFootprintReport() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo = new Foo();
+    foo->setName("foo");
+    foo->set_mass(1.0);
+    world.add(foo);
+    world.finalizeFromProperties();
+
+    // every component's property storage occupies at least a few bytes
+    SimTK_TEST(world.getMemoryFootprint() > 0);
+    SimTK_TEST(foo->getMemoryFootprint() > 0);
+
+    auto report = world.getMemoryFootprintReport();
+    SimTK_TEST(report.getNumRows() == 1);
+    const auto& labels = report.getColumnLabels();
+    // at least the world and foo, with self and subtree entries each
+    SimTK_TEST(labels.size() >= 4);
+
+    // the root's slots come first, and its subtree total covers everything
+    SimTK_TEST(labels[0] == world.getAbsolutePathString() + "|self");
+    SimTK_TEST(labels[1] == world.getAbsolutePathString() + "|subtree");
+    const auto row = report.getRowAtIndex(0);
+    SimTK_TEST(row[0] == double(world.getMemoryFootprint()));
+    SimTK_TEST(row[1] >= row[0] + double(foo->getMemoryFootprint()));
+
+    // the subcomponent reports its own self bytes under its path
+    const auto& fooSelf = report.getDependentColumn(
+            foo->getAbsolutePathString() + "|self");
+    SimTK_TEST(fooSelf[0] == double(foo->getMemoryFootprint()));
+}
+
+void testRealizeProfiler() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo = new Foo();
+    foo->setName("foo");
+    world.add(foo);
+    world.connect();
+
+    MultibodySystem system;
+    world.buildUpSystem(system);
+    State s = system.realizeTopology();
+
+    SimTK_TEST(!Component::isRealizeProfilingEnabled());
+
+    Component::startRealizeProfiling();
+    SimTK_TEST(Component::isRealizeProfilingEnabled());
+    system.realize(s, Stage::Dynamics);
+    system.realize(s, Stage::Dynamics); // no-op: already realized
+    Component::stopRealizeProfiling();
+    SimTK_TEST(!Component::isRealizeProfilingEnabled());
+
+    TimeSeriesTable profile = Component::getRealizeProfile();
+    // one row per profiled stage: Position, Velocity, Dynamics
+    SimTK_TEST(profile.getNumRows() == 3);
+    SimTK_TEST(profile.getIndependentColumn()[0] == double(Stage::Position));
+    SimTK_TEST(profile.getIndependentColumn()[2] == double(Stage::Dynamics));
+
+    // every profiled component reports wall time and call counts
+    const auto& fooCalls = profile.getDependentColumn("/foo|calls");
+    const auto& fooSeconds = profile.getDependentColumn("/foo|seconds");
+    for (int i = 0; i < 3; ++i) {
+        SimTK_TEST(fooCalls[i] == 1);
+        SimTK_TEST(fooSeconds[i] >= 0);
+    }
+
+    // realizing with profiling off must not record anything new
+    Component::startRealizeProfiling();
+    Component::stopRealizeProfiling();
+    s = system.realizeTopology();
+    system.realize(s, Stage::Dynamics);
+    SimTK_TEST(Component::getRealizeProfile().getNumRows() == 0);
+}
+
+void testRealizeTracer() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo = new Foo();
+    foo->setName("foo");
+    world.add(foo);
+    world.connect();
+
+    MultibodySystem system;
+    world.buildUpSystem(system);
+    State s = system.realizeTopology();
+
+    SimTK_TEST(!Component::isRealizeTracingEnabled());
+
+    Component::startRealizeTracing();
+    SimTK_TEST(Component::isRealizeTracingEnabled());
+    {
+        // a nested scope must show up as its own event
+        Component::RealizeTraceScope scope(*foo, "customScope");
+        system.realize(s, Stage::Dynamics);
+    }
+    Component::stopRealizeTracing();
+    SimTK_TEST(!Component::isRealizeTracingEnabled());
+
+    const std::string traceFile = "testComponentInterface_trace.json";
+    const size_t numEvents = Component::writeRealizeTrace(traceFile);
+    // at least the custom scope plus foo's Position/Velocity/Dynamics
+    SimTK_TEST(numEvents >= 4);
+
+    std::ifstream trace(traceFile);
+    SimTK_TEST(trace.good());
+    std::stringstream contents;
+    contents << trace.rdbuf();
+    const std::string json = contents.str();
+    SimTK_TEST(json.find("\"traceEvents\"") != std::string::npos);
+    SimTK_TEST(json.find("/foo|realizeDynamics") != std::string::npos);
+    SimTK_TEST(json.find("/foo|customScope") != std::string::npos);
+
+    // writing drains the buffer, and tracing off records nothing new
+    SimTK_TEST(Component::writeRealizeTrace(traceFile) == 0);
+    s = system.realizeTopology();
+    system.realize(s, Stage::Dynamics);
+    SimTK_TEST(Component::writeRealizeTrace(traceFile) == 0);
+    std::remove(traceFile.c_str());
+}
+
+void testAllocationTracker() {
+
+    AllocationTracker::resetCounts();
+    SimTK_TEST(!AllocationTracker::isEnabled());
+    SimTK_TEST(AllocationTracker::getNumAllocations() == 0);
+
+    AllocationTracker::setEnabled(true);
+    SimTK_TEST(AllocationTracker::isEnabled());
+    {
+        AllocationTracker::Scope scope("testScope");
+        auto* vec = new std::vector<double>(1000);
+        delete vec;
+        if (AllocationTracker::isAvailable()) {
+            SimTK_TEST(scope.getNumAllocations() >= 1);
+            SimTK_TEST(AllocationTracker::getNumDeallocations() >= 1);
+            SimTK_TEST(AllocationTracker::getNumBytesAllocated() >=
+                1000*sizeof(double));
+        } else {
+            // without OPENSIM_TRACK_ALLOCATIONS the API works but every
+            // count reads zero
+            SimTK_TEST(scope.getNumAllocations() == 0);
+            SimTK_TEST(AllocationTracker::getNumAllocations() == 0);
+        }
+    }
+    AllocationTracker::setEnabled(false);
+    SimTK_TEST(!AllocationTracker::isEnabled());
+    AllocationTracker::resetCounts();
+    SimTK_TEST(AllocationTracker::getNumAllocations() == 0);
+    SimTK_TEST(AllocationTracker::getNumDeallocations() == 0);
+    SimTK_TEST(AllocationTracker::getNumBytesAllocated() == 0);
+
+    // A Scope that ends while the realize tracer is recording contributes a
+    // counter event to the trace, in every build flavor.
+    Component::startRealizeTracing();
+    {
+        AllocationTracker::Scope scope("allocCounterScope");
+    }
+    Component::stopRealizeTracing();
+
+    const std::string traceFile = "testComponentInterface_alloc_trace.json";
+    SimTK_TEST(Component::writeRealizeTrace(traceFile) == 1);
+    std::ifstream trace(traceFile);
+    SimTK_TEST(trace.good());
+    std::stringstream contents;
+    contents << trace.rdbuf();
+    const std::string json = contents.str();
+    SimTK_TEST(json.find("allocCounterScope") != std::string::npos);
+    SimTK_TEST(json.find("\"ph\":\"C\"") != std::string::npos);
+    std::remove(traceFile.c_str());
+}
+
+void testHotPathCounters() {
+
+    HotPathCounters::resetCounts();
+    SimTK_TEST(!HotPathCounters::isEnabled());
+
+    // increments are discarded while counting is off
+    HotPathCounters::increment(HotPathCounters::SplineEvaluations);
+    SimTK_TEST(HotPathCounters::getCount(
+            HotPathCounters::SplineEvaluations) == 0);
+
+    HotPathCounters::setEnabled(true);
+    SimTK_TEST(HotPathCounters::isEnabled());
+    HotPathCounters::increment(HotPathCounters::PathRecomputes);
+    HotPathCounters::increment(HotPathCounters::WrapSolves, 3);
+    HotPathCounters::increment(HotPathCounters::SplineEvaluations, 5);
+    SimTK_TEST(HotPathCounters::getCount(
+            HotPathCounters::PathRecomputes) == 1);
+    SimTK_TEST(HotPathCounters::getCount(
+            HotPathCounters::WrapSolves) == 3);
+    SimTK_TEST(HotPathCounters::getCount(
+            HotPathCounters::SplineEvaluations) == 5);
+    SimTK_TEST(HotPathCounters::getCount(
+            HotPathCounters::StateCopies) == 0);
+
+    SimTK_TEST(std::string(HotPathCounters::getCounterName(
+            HotPathCounters::PathRecomputes)) == "path_recomputes");
+    SimTK_TEST(std::string(HotPathCounters::getCounterName(
+            HotPathCounters::StateCopies)) == "state_copies");
+
+    // the snapshot record goes through the Logger; just exercise it
+    HotPathCounters::logSnapshot();
+
+    SimTK_TEST(HotPathCounters::getLoggingInterval() <= 0);
+    HotPathCounters::setLoggingInterval(10);
+    SimTK_TEST(HotPathCounters::getLoggingInterval() == 10);
+    HotPathCounters::setLoggingInterval(0);
+
+    HotPathCounters::setEnabled(false);
+    HotPathCounters::resetCounts();
+    SimTK_TEST(HotPathCounters::getCount(
+            HotPathCounters::PathRecomputes) == 0);
+    SimTK_TEST(HotPathCounters::getCount(
+            HotPathCounters::WrapSolves) == 0);
+}
+
+void testScopedTimer() {
+
+    ScopedTimer::resetBuckets();
+    SimTK_TEST(!ScopedTimer::isEnabled());
+
+    // a timer constructed while timing is disabled records nothing
+    {
+        ScopedTimer timer("testScopedTimer.disabled");
+    }
+    SimTK_TEST(ScopedTimer::getBucketCount("testScopedTimer.disabled") == 0);
+    SimTK_TEST(ScopedTimer::getBucketNames().empty());
+
+    ScopedTimer::setEnabled(true);
+    SimTK_TEST(ScopedTimer::isEnabled());
+    for (int i = 0; i < 3; ++i) {
+        ScopedTimer timer("testScopedTimer.b");
+    }
+    {
+        ScopedTimer timer("testScopedTimer.a");
+    }
+    SimTK_TEST(ScopedTimer::getBucketCount("testScopedTimer.b") == 3);
+    SimTK_TEST(ScopedTimer::getBucketCount("testScopedTimer.a") == 1);
+    SimTK_TEST(ScopedTimer::getBucketSeconds("testScopedTimer.b") >= 0);
+    SimTK_TEST(ScopedTimer::getBucketSeconds("nonexistent bucket") == 0);
+
+    // bucket names come back sorted
+    const auto names = ScopedTimer::getBucketNames();
+    SimTK_TEST(names.size() == 2);
+    SimTK_TEST(names[0] == "testScopedTimer.a");
+    SimTK_TEST(names[1] == "testScopedTimer.b");
+
+    // the timing_bucket records go through the Logger; just exercise it
+    ScopedTimer::logBuckets();
+
+    ScopedTimer::setEnabled(false);
+    ScopedTimer::resetBuckets();
+    SimTK_TEST(ScopedTimer::getBucketNames().empty());
+}
+
+void testSocketResolutionCacheAcrossCopies() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo1 = new Foo();
+    foo1->setName("foo1");
+    Foo* foo2 = new Foo();
+    foo2->setName("foo2");
+    Bar* bar = new Bar();
+    bar->setName("bar");
+
+    world.add(foo1);
+    world.add(foo2);
+    world.add(bar);
+
+    bar->connectSocket_parentFoo(*foo1);
+    bar->connectSocket_childFoo(*foo2);
+    world.connect();
+
+    SimTK_TEST(&bar->getConnectee<Foo>("parentFoo") == foo1);
+    SimTK_TEST(&bar->getConnectee<Foo>("childFoo") == foo2);
+
+    // Copying an already-connected tree carries the sockets' cached
+    // resolution routes: re-finalizing the copy must connect to the copy's
+    // own components, never back into the original tree.
+    TheWorld worldCopy(world);
+    worldCopy.finalizeFromProperties();
+    worldCopy.connect();
+
+    const Foo& foo1Copy = worldCopy.getComponent<Foo>("foo1");
+    const Foo& foo2Copy = worldCopy.getComponent<Foo>("foo2");
+    const Bar& barCopy = worldCopy.getComponent<Bar>("bar");
+
+    SimTK_TEST(&foo1Copy != foo1 && &foo2Copy != foo2);
+    SimTK_TEST(&barCopy.getConnectee<Foo>("parentFoo") == &foo1Copy);
+    SimTK_TEST(&barCopy.getConnectee<Foo>("childFoo") == &foo2Copy);
+
+    // A structurally edited copy must not trust a stale route: swap the
+    // connectee path and check that re-finalization follows the new path.
+    TheWorld worldEdited(world);
+    worldEdited.finalizeFromProperties();
+    Bar& barEdited = worldEdited.updComponent<Bar>("bar");
+    barEdited.updSocket<Foo>("childFoo").setConnecteePath("/foo1");
+    barEdited.updSocket<Foo>("parentFoo").setConnecteePath("/foo2");
+    worldEdited.connect();
+    SimTK_TEST(&barEdited.getConnectee<Foo>("parentFoo") ==
+            &worldEdited.getComponent<Foo>("foo2"));
+    SimTK_TEST(&barEdited.getConnectee<Foo>("childFoo") ==
+            &worldEdited.getComponent<Foo>("foo1"));
+}
+
+namespace {
+// Counts how often its connections are finalized, to observe which
+// components an incremental finalizeConnections() sweep actually revisits.
+class ConnectionCounter : public Component {
+    OpenSim_DECLARE_CONCRETE_OBJECT(ConnectionCounter, Component);
+public:
+    OpenSim_DECLARE_SOCKET(foo, Foo, "");
+    static int numFinalizeCalls;
+protected:
+    void extendFinalizeConnections(Component& root) override {
+        Super::extendFinalizeConnections(root);
+        ++numFinalizeCalls;
+    }
+};
+int ConnectionCounter::numFinalizeCalls = 0;
+}
+
+void testLazyFinalizeConnections() {
+
+    TheWorld world;
+    world.setName("world");
+    Foo* foo1 = new Foo();
+    foo1->setName("foo1");
+    Foo* foo2 = new Foo();
+    foo2->setName("foo2");
+    auto* counter1 = new ConnectionCounter();
+    counter1->setName("counter1");
+    auto* counter2 = new ConnectionCounter();
+    counter2->setName("counter2");
+
+    world.add(foo1);
+    world.add(foo2);
+    world.add(counter1);
+    world.add(counter2);
+
+    counter1->connectSocket_foo(*foo1);
+    counter2->connectSocket_foo(*foo2);
+
+    ConnectionCounter::numFinalizeCalls = 0;
+    world.connect();
+    SimTK_TEST(ConnectionCounter::numFinalizeCalls == 2);
+
+    // reconnecting an unedited tree revisits nothing
+    world.connect();
+    SimTK_TEST(ConnectionCounter::numFinalizeCalls == 2);
+
+    // rewiring one component's socket revalidates that component only
+    counter1->updSocket<Foo>("foo").disconnect();
+    counter1->updSocket<Foo>("foo").setConnecteePath("/foo2");
+    world.connect();
+    SimTK_TEST(ConnectionCounter::numFinalizeCalls == 3);
+    SimTK_TEST(&counter1->getConnectee<Foo>("foo") == foo2);
+
+    // a property edit elsewhere leaves the counters untouched
+    foo1->set_mass(3.0);
+    world.connect();
+    SimTK_TEST(ConnectionCounter::numFinalizeCalls == 3);
+    SimTK_TEST(foo1->isObjectUpToDateWithProperties());
+
+    // Mimic Model::setup(): finalizeFromProperties() runs first and restores
+    // every up-to-date flag, so by the time the sweep's skip check runs, a
+    // rename must still be evidenced. Both counters resolved "/foo2", which
+    // no longer exists; a silently skipped sweep would leave them connected
+    // to the renamed component where a fresh connect throws.
+    foo2->setName("foo2renamed");
+    world.finalizeFromProperties();
+    SimTK_TEST(foo2->isObjectUpToDateWithProperties());
+    SimTK_TEST_MUST_THROW(world.connect());
+
+    // Same hole with an outright removal: the removed component is simply
+    // absent from the traversal, every survivor is up to date, and only the
+    // tree snapshot can tell the sweep that the counter's connectee died.
+    TheWorld outer;
+    outer.setName("outer");
+    TheWorld* inner = new TheWorld();
+    inner->setName("inner");
+    Foo* innerFoo = new Foo();
+    innerFoo->setName("foo");
+    inner->add(innerFoo);
+    auto* outerCounter = new ConnectionCounter();
+    outerCounter->setName("counter");
+    outer.add(inner);
+    outer.add(outerCounter);
+    outerCounter->connectSocket_foo(*innerFoo);
+    outer.connect();
+    SimTK_TEST(&outerCounter->getConnectee<Foo>("foo") == innerFoo);
+
+    inner->updPropertyByName("components").clear();
+    outer.finalizeFromProperties();
+    SimTK_TEST(inner->isObjectUpToDateWithProperties());
+    SimTK_TEST_MUST_THROW(outer.connect());
+}
+
+void testOutputBatch() {
+
+    TheWorld theWorld;
+    theWorld.setName("world");
+    Foo* foo = new Foo();
+    foo->setName("foo");
+    theWorld.add(foo);
+
+    MultibodySystem system;
+    theWorld.buildUpSystem(system);
+    State s = system.realizeTopology();
+
+    OutputBatch batch;
+    batch.addOutput(foo->getOutput("Output1")); // double
+    batch.addOutput(foo->getOutput("Output2")); // Vec3
+    batch.addOutput(foo->getOutput("Output3")); // double
+
+    SimTK_TEST(batch.getNumOutputs() == 3);
+    SimTK_TEST(batch.getNumScalars() == 5);
+    SimTK_TEST(batch.getDependsOnStage() == Stage::Time);
+
+    std::vector<std::string> labels = batch.getScalarLabels();
+    SimTK_TEST(labels.size() == 5);
+    SimTK_TEST(labels[0] == "/foo|Output1");
+    SimTK_TEST(labels[1] == "/foo|Output2_0");
+    SimTK_TEST(labels[3] == "/foo|Output2_2");
+    SimTK_TEST(labels[4] == "/foo|Output3");
+
+    // evaluating below the batch's dependsOnStage throws
+    Vector buffer;
+    SimTK_TEST_MUST_THROW(batch.evaluateInto(s, buffer));
+
+    s.setTime(1.44);
+    system.realize(s, Stage::Time);
+    batch.evaluateInto(s, buffer);
+
+    const double t = s.getTime();
+    SimTK_TEST(buffer.size() == 5);
+    SimTK_TEST(buffer[0] == t);
+    SimTK_TEST(buffer[1] == t && buffer[2] == t*t && buffer[3] == sqrt(t));
+    SimTK_TEST(buffer[4] == 1.618);
+
+    // batched values match the per-output virtual getValue path
+    const auto& output2 =
+            Output<Vec3>::downcast(foo->getOutput("Output2"));
+    Vec3 value2 = output2.getValue(s);
+    SimTK_TEST(buffer[1] == value2[0] && buffer[2] == value2[1] &&
+               buffer[3] == value2[2]);
+
+    // outputs whose type has no fixed scalar flattening cannot be batched
+    SimTK_TEST_MUST_THROW_EXC(batch.addOutput(foo->getOutput("Qs")),
+            OpenSim::Exception);
+}
+
+void testFlattenedComponentList() {
+
+    TheWorld top;
+    top.setName("top");
+    Sub* a = new Sub();
+    a->setName("a");
+    Sub* b = new Sub();
+    b->setName("b");
+
+    top.add(a);
+    a->addComponent(b);
+    top.finalizeFromProperties();
+    top.finalizeConnections(top);
+
+    // the flat index must visit the same components, in the same pre-order,
+    // as the linked-list traversal
+    std::vector<const Component*> expected;
+    for (const Component& comp : top.getComponentList<Component>()) {
+        expected.push_back(&comp);
+    }
+    const std::vector<const Component*>& flat =
+            top.getFlattenedComponentList<Component>();
+    SimTK_TEST(flat == expected);
+
+    // type-segregated sub-lists only contain components of the given type
+    const std::vector<const Sub*>& subs = top.getFlattenedComponentList<Sub>();
+    SimTK_TEST(subs.size() == 3); // internalSub, a, b
+    SimTK_TEST(std::find(subs.begin(), subs.end(), a) != subs.end());
+    SimTK_TEST(std::find(subs.begin(), subs.end(), b) != subs.end());
+
+    // repeated calls return the same cached list
+    SimTK_TEST(&top.getFlattenedComponentList<Sub>() == &subs);
+
+    // editing the tree invalidates the index; it is rebuilt on next use
+    Sub* c = new Sub();
+    c->setName("c");
+    top.add(c);
+    top.finalizeFromProperties();
+    top.finalizeConnections(top);
+    const std::vector<const Sub*>& subsAfterEdit =
+            top.getFlattenedComponentList<Sub>();
+    SimTK_TEST(subsAfterEdit.size() == 4);
+    SimTK_TEST(std::find(subsAfterEdit.begin(), subsAfterEdit.end(), c) !=
+            subsAfterEdit.end());
+}
+
+void testStateVariableHandle() {
+
+    TheWorld top;
+    top.setName("top");
+    Sub* a = new Sub();
+    a->setName("a");
+    Sub* b = new Sub();
+    b->setName("b");
+
+    top.add(a);
+    a->addComponent(b);
+
+    // Handles cannot be resolved before a System exists.
+    SimTK_TEST_MUST_THROW_EXC(
+            top.getStateVariableHandle("a/subState"),
+            OpenSim::ComponentHasNoSystem);
+
+    MultibodySystem system;
+    top.buildUpSystem(system);
+    State s = system.realizeTopology();
+
+    SimTK_TEST(s.getNY() == 3);
+    s.updY()[0] = 10; // "top/internalSub/subState"
+    s.updY()[1] = 20; // "top/a/subState"
+    s.updY()[2] = 30; // "top/a/b/subState"
+
+    // Resolve once; access repeatedly without string lookups.
+    auto h0 = top.getStateVariableHandle("internalSub/subState");
+    auto h1 = top.getStateVariableHandle("a/subState");
+    auto h2 = top.getStateVariableHandle("a/b/subState");
+
+    SimTK_TEST(h0.isValid() && h1.isValid() && h2.isValid());
+    SimTK_TEST(top.getStateVariableValue(s, h0) == 10);
+    SimTK_TEST(top.getStateVariableValue(s, h1) == 20);
+    SimTK_TEST(top.getStateVariableValue(s, h2) == 30);
+
+    top.setStateVariableValue(s, h1, 25);
+    SimTK_TEST(top.getStateVariableValue(s, "a/subState") == 25);
+
+    // Batched access through spans of handles.
+    std::vector<Component::StateVariableHandle> handles{h2, h0, h1};
+    Vector values = top.getStateVariableValues(s, handles);
+    SimTK_TEST(values.size() == 3);
+    SimTK_TEST(values[0] == 30 && values[1] == 10 && values[2] == 25);
+
+    values[0] = 33; values[1] = 11; values[2] = 22;
+    top.setStateVariableValues(s, handles, values);
+    SimTK_TEST(top.getStateVariableValue(s, "a/b/subState") == 33);
+    SimTK_TEST(top.getStateVariableValue(s, "internalSub/subState") == 11);
+    SimTK_TEST(top.getStateVariableValue(s, "a/subState") == 22);
+
+    // In-place overloads fill (and resize if necessary) a reused buffer.
+    Vector buffer;
+    top.getStateVariableValues(s, handles, buffer);
+    SimTK_TEST(buffer.size() == 3);
+    SimTK_TEST(buffer[0] == 33 && buffer[1] == 11 && buffer[2] == 22);
+
+    top.getStateVariableValues(s, buffer);
+    SimTK_TEST(buffer.size() == top.getNumStateVariables());
+    SimTK_TEST(buffer[0] == 11 && buffer[1] == 22 && buffer[2] == 33);
+
+    // Unknown names fail at resolution time, not at access time.
+    SimTK_TEST_MUST_THROW_EXC(
+            top.getStateVariableHandle("typo/b/subState"),
+            OpenSim::Exception);
+
+    // Default-constructed handles are invalid and cannot be dereferenced.
+    Component::StateVariableHandle invalid;
+    SimTK_TEST(!invalid.isValid());
+    SimTK_TEST_MUST_THROW_EXC(
+            top.getStateVariableValue(s, invalid),
+            OpenSim::Exception);
+}
+
 void testGetStateVariableValueComponentPath() {
     using CP = ComponentPath;
 
@@ -2555,6 +3280,21 @@ int main() {
         SimTK_SUBTEST(testFindComponent);
         SimTK_SUBTEST(testTraversePathToComponent);
         SimTK_SUBTEST(testGetStateVariableValue);
+        SimTK_SUBTEST(testStateVariableHandle);
+        SimTK_SUBTEST(testFlattenedComponentList);
+        SimTK_SUBTEST(testOutputBatch);
+        SimTK_SUBTEST(testBinaryObjectFormat);
+        SimTK_SUBTEST(testIncrementalFinalizeFromProperties);
+        SimTK_SUBTEST(testStructuralHash);
+        SimTK_SUBTEST(testParallelFinalizeFromProperties);
+        SimTK_SUBTEST(testMemoryFootprintReport);
+        SimTK_SUBTEST(testRealizeProfiler);
+        SimTK_SUBTEST(testRealizeTracer);
+        SimTK_SUBTEST(testAllocationTracker);
+        SimTK_SUBTEST(testHotPathCounters);
+        SimTK_SUBTEST(testScopedTimer);
+        SimTK_SUBTEST(testSocketResolutionCacheAcrossCopies);
+        SimTK_SUBTEST(testLazyFinalizeConnections);
         SimTK_SUBTEST(testGetStateVariableValueComponentPath);
         SimTK_SUBTEST(testInputOutputConnections);
         SimTK_SUBTEST(testInputConnecteePaths);
@@ -785,6 +785,131 @@ TEST_CASE("DataTable") {
     }
 }
 
+TEST_CASE("DataTable span views") {
+    TimeSeriesTable table{};
+    table.setColumnLabels({"a", "b"});
+    for(int i = 0; i < 4; ++i)
+        table.appendRow(0.1 * i, SimTK::RowVector_<double>{2, double(i)});
+
+    SECTION("spans alias the table's storage") {
+        auto span = table.getDependentColumnSpan(1);
+        REQUIRE(span.size() == 4);
+        for(int i = 0; i < 4; ++i)
+            CHECK(span[i] == double(i));
+        // A writable span writes through to the table.
+        auto mutSpan = table.updDependentColumnSpan(0);
+        mutSpan[2] = 42;
+        CHECK(table.getDependentColumnAtIndex(0)[2] == 42);
+        // The read-only span sees the change too: no data were copied.
+        CHECK(table.getDependentColumnSpan(0)[2] == 42);
+    }
+
+    SECTION("scalar span over a double column is the column itself") {
+        auto span = table.getDependentColumnScalarSpan(0);
+        REQUIRE(span.size() == 4);
+        for(int i = 0; i < 4; ++i)
+            CHECK(span[i] == double(i));
+    }
+
+    SECTION("scalar span flattens Vec3 columns") {
+        TimeSeriesTable_<SimTK::Vec3> vec3Table{};
+        vec3Table.setColumnLabels({"marker"});
+        for(int i = 0; i < 3; ++i)
+            vec3Table.appendRow(0.1 * i,
+                    SimTK::RowVector_<SimTK::Vec3>{1,
+                            SimTK::Vec3{3. * i, 3. * i + 1, 3. * i + 2}});
+
+        auto span = vec3Table.getDependentColumnScalarSpan(0);
+        REQUIRE(span.size() == 9);
+        for(int i = 0; i < 9; ++i)
+            CHECK(span[i] == double(i));
+
+        auto mutSpan = vec3Table.updDependentColumnScalarSpan(0);
+        mutSpan[4] = 100;
+        CHECK(vec3Table.getDependentColumnAtIndex(0)[1][1] == 100);
+    }
+
+    SECTION("exceptions") {
+        CHECK_THROWS_AS(table.getDependentColumnSpan(10),
+                        OpenSim::ColumnIndexOutOfRange);
+        CHECK_THROWS_AS(table.updDependentColumnScalarSpan(10),
+                        OpenSim::ColumnIndexOutOfRange);
+        TimeSeriesTable empty{};
+        CHECK_THROWS_AS(empty.getDependentColumnSpan(0),
+                        OpenSim::EmptyTable);
+    }
+}
+
+TEST_CASE("DataTable concatenation") {
+    auto makeTable = [](double t0, int numRows, double elt0) {
+        TimeSeriesTable table{};
+        table.setColumnLabels({"a", "b"});
+        for(int i = 0; i < numRows; ++i)
+            table.appendRow(t0 + 0.1 * i,
+                            SimTK::RowVector_<double>{2, elt0 + i});
+        return table;
+    };
+
+    SECTION("concatenateRows") {
+        auto head = makeTable(0.0, 3, 0);
+        auto tail = makeTable(0.3, 2, 3);
+        head.concatenateRows(std::move(tail));
+        REQUIRE(head.getNumRows() == 5);
+        for(int i = 0; i < 5; ++i) {
+            CHECK(head.getIndependentColumn()[i] == Approx(0.1 * i));
+            CHECK(head.getRowAtIndex(i)[0] == double(i));
+        }
+        CHECK(tail.getNumRows() == 0);
+    }
+
+    SECTION("concatenateRows into a default-constructed table") {
+        TimeSeriesTable empty{};
+        empty.concatenateRows(makeTable(0.0, 3, 0));
+        REQUIRE(empty.getNumRows() == 3);
+        CHECK(empty.getColumnLabels() ==
+              std::vector<std::string>{"a", "b"});
+    }
+
+    SECTION("concatenateRows enforces derived-class invariants") {
+        auto head = makeTable(0.0, 3, 0);
+        // Times of the second table overlap the first; TimeSeriesTable must
+        // reject the concatenation and leave the destination untouched.
+        CHECK_THROWS_AS(head.concatenateRows(makeTable(0.1, 2, 3)),
+                        OpenSim::InvalidRow);
+        REQUIRE(head.getNumRows() == 3);
+        CHECK(head.getRowAtIndex(2)[0] == 2);
+    }
+
+    SECTION("concatenateRows rejects mismatched labels") {
+        auto head = makeTable(0.0, 3, 0);
+        TimeSeriesTable other{};
+        other.setColumnLabels({"c", "d"});
+        other.appendRow(0.3, SimTK::RowVector_<double>{2, 3.});
+        CHECK_THROWS_AS(head.concatenateRows(std::move(other)),
+                        OpenSim::InvalidArgument);
+    }
+
+    SECTION("concatenateColumns") {
+        auto left = makeTable(0.0, 3, 0);
+        TimeSeriesTable right{};
+        right.setColumnLabels({"c"});
+        for(int i = 0; i < 3; ++i)
+            right.appendRow(0.1 * i, SimTK::RowVector_<double>{1, 10. + i});
+        left.concatenateColumns(std::move(right));
+        REQUIRE(left.getNumColumns() == 3);
+        CHECK(left.getColumnLabels() ==
+              std::vector<std::string>{"a", "b", "c"});
+        for(int i = 0; i < 3; ++i)
+            CHECK(left.getDependentColumn("c")[i] == 10. + i);
+    }
+
+    SECTION("concatenateColumns rejects mismatched independent columns") {
+        auto left = makeTable(0.0, 3, 0);
+        CHECK_THROWS_AS(left.concatenateColumns(makeTable(0.05, 3, 0)),
+                        OpenSim::InvalidArgument);
+    }
+}
+
 TEST_CASE("TableUtilities::checkNonUniqueLabels") {
     CHECK_THROWS_AS(TableUtilities::checkNonUniqueLabels({"a", "a"}),
                     NonUniqueLabels);
@@ -916,3 +1041,55 @@ TEST_CASE("TableUtilities::resample") {
         CHECK(column[5] == Approx(0.0).margin(1e-10));
     }
 }
+
+TEST_CASE("TableResampler") {
+    const int numRows = 50;
+    std::vector<double> time(numRows);
+    for (int i = 0; i < numRows; ++i) time[i] = 0.02 * i;
+    TimeSeriesTable table(time);
+    table.appendColumn("a", SimTK::Test::randVector(numRows));
+    table.appendColumn("b", SimTK::Test::randVector(numRows));
+    table.addTableMetaData("units", std::string("furlongs"));
+
+    // One fit answers requests at several rates; each result matches the
+    // one-shot TableUtilities call.
+    TableResampler<> resampler(table);
+    for (double interval : {0.05, 0.013, 0.11}) {
+        TimeSeriesTable fromResampler =
+                resampler.resampleWithInterval(interval);
+        TimeSeriesTable fromUtilities =
+                TableUtilities::resampleWithInterval(table, interval);
+        REQUIRE(fromResampler.getNumRows() == fromUtilities.getNumRows());
+        REQUIRE(fromResampler.getColumnLabels() ==
+                fromUtilities.getColumnLabels());
+        for (int irow = 0; irow < (int)fromResampler.getNumRows(); ++irow) {
+            for (int icol = 0; icol < 2; ++icol) {
+                CHECK(fromResampler.getMatrix().getElt(irow, icol) ==
+                        Approx(fromUtilities.getMatrix().getElt(irow, icol)));
+            }
+        }
+    }
+
+    // Metadata is carried into the resampled table.
+    TimeSeriesTable windowed = resampler.resample({0.1, 0.2, 0.3});
+    CHECK(windowed.getTableMetaData<std::string>("units") == "furlongs");
+    REQUIRE(windowed.getNumRows() == 3);
+
+    // The same bounds checks as the one-shot call apply.
+    CHECK_THROWS_WITH(resampler.resample({-1.0}),
+            Catch::Contains("cannot be less than existing initial time"));
+    CHECK_THROWS_WITH(resampler.resample({5.0}),
+            Catch::Contains("cannot be greater than existing final time"));
+    CHECK_THROWS_AS(TableResampler<>{TimeSeriesTable()}, OpenSim::Exception);
+
+    // The linear interpolant is supported as well.
+    TableResampler<PiecewiseLinearFunction> linear(table);
+    TimeSeriesTable linearOut = linear.resampleWithInterval(0.05);
+    TimeSeriesTable linearExpected =
+            TableUtilities::resampleWithInterval<PiecewiseLinearFunction>(
+                    table, 0.05);
+    for (int irow = 0; irow < (int)linearOut.getNumRows(); ++irow) {
+        CHECK(linearOut.getMatrix().getElt(irow, 0) ==
+                Approx(linearExpected.getMatrix().getElt(irow, 0)));
+    }
+}
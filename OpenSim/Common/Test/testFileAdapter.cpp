@@ -0,0 +1,106 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  testFileAdapter.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/Adapters.h"
+#include <algorithm>
+#include <cstdio>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+namespace {
+
+// Write one small .sto file per trial; each trial's values are offset by its
+// index so reads can be matched back to the right file.
+std::vector<std::string> writeTrialFiles(size_t numTrials) {
+    std::vector<std::string> fileNames{};
+    for(size_t trial = 0; trial < numTrials; ++trial) {
+        TimeSeriesTable table{};
+        table.setColumnLabels({"a", "b"});
+        for(int r = 0; r < 10; ++r) {
+            SimTK::RowVector_<double> row{2, 100. * trial + r};
+            table.appendRow(0.1 * r, row);
+        }
+        const std::string fileName{"testFileAdapter_trial" +
+                                   std::to_string(trial) + ".sto"};
+        STOFileAdapter::write(table, fileName);
+        fileNames.push_back(fileName);
+    }
+    return fileNames;
+}
+
+void removeFiles(const std::vector<std::string>& fileNames) {
+    for(const auto& fileName : fileNames)
+        std::remove(fileName.c_str());
+}
+
+} // namespace
+
+TEST_CASE("FileAdapter::readFiles") {
+    const auto fileNames = writeTrialFiles(8);
+
+    SECTION("map overload reads every file") {
+        auto results = FileAdapter::readFiles(fileNames);
+        REQUIRE(results.size() == fileNames.size());
+        for(size_t trial = 0; trial < fileNames.size(); ++trial) {
+            const auto& tables = results.at(fileNames[trial]);
+            REQUIRE(tables.size() == 1);
+            const auto& table = dynamic_cast<const TimeSeriesTable&>(
+                    *tables.at("table"));
+            REQUIRE(table.getNumRows() == 10);
+            CHECK(table.getRowAtIndex(0)[0] == 100. * trial);
+        }
+    }
+
+    SECTION("callback overload delivers each file exactly once") {
+        std::vector<std::string> delivered{};
+        FileAdapter::readFiles(fileNames,
+                [&delivered](const std::string& fileName,
+                             const DataAdapter::OutputTables&) {
+                    // Invocations are serialized; no locking needed here.
+                    delivered.push_back(fileName);
+                },
+                2);
+        REQUIRE(delivered.size() == fileNames.size());
+        std::sort(delivered.begin(), delivered.end());
+        CHECK(delivered == fileNames);
+    }
+
+    SECTION("a failing file does not abort the others") {
+        auto withBadFile = fileNames;
+        withBadFile.push_back("testFileAdapter_missing.sto");
+        size_t numDelivered = 0;
+        CHECK_THROWS(FileAdapter::readFiles(withBadFile,
+                [&numDelivered](const std::string&,
+                                const DataAdapter::OutputTables&) {
+                    ++numDelivered;
+                }));
+        CHECK(numDelivered == fileNames.size());
+    }
+
+    SECTION("empty manifest is a no-op") {
+        CHECK(FileAdapter::readFiles({}).empty());
+    }
+
+    removeFiles(fileNames);
+}
@@ -24,7 +24,12 @@
 #include "ComponentsForTesting.h"
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/FunctionSet.h>
+#include <OpenSim/Common/GCVSpline.h>
 #include <OpenSim/Common/MultivariatePolynomialFunction.h>
+#include <OpenSim/Common/PiecewiseConstantFunction.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
 #include <OpenSim/Common/Reporter.h>
 #include <OpenSim/Common/SignalGenerator.h>
 #include <OpenSim/Common/Sine.h>
@@ -92,6 +97,56 @@ TEST_CASE("Interpolate using PiecewiseLinearFunction") {
     SimTK_TEST(SimTK::isNaN(newY[3]));
 }
 
+TEST_CASE("Piecewise function batch evaluation") {
+    const int n = 20;
+    double px[n], py[n];
+    for (int i = 0; i < n; ++i) {
+        px[i] = 0.1 * i;
+        py[i] = std::sin(px[i]) + 0.05 * i;
+    }
+    // Queries inside, between, outside, and exactly on the knots, in
+    // non-monotone order to exercise the interval hint fallback.
+    SimTK::Vector queries(2 * n + 4);
+    for (int i = 0; i < 2 * n; ++i)
+        queries[i] = 0.05 * i + 0.013;
+    queries[2 * n]     = -0.5;
+    queries[2 * n + 1] = 3.7;
+    queries[2 * n + 2] = px[7];
+    queries[2 * n + 3] = px[3];
+
+    SECTION("PiecewiseLinearFunction") {
+        PiecewiseLinearFunction func(n, px, py);
+        SimTK::Vector batch;
+        SimTK::Vector t(1, 0.0);
+        for (int deriv = 0; deriv <= 2; ++deriv) {
+            func.calcValues(deriv, queries, batch);
+            REQUIRE(batch.size() == queries.size());
+            std::vector<int> components(deriv, 0);
+            for (int i = 0; i < queries.size(); ++i) {
+                t[0] = queries[i];
+                const double expected = (deriv == 0)
+                        ? func.calcValue(t)
+                        : func.calcDerivative(components, t);
+                CHECK(batch[i] == expected);
+            }
+        }
+    }
+
+    SECTION("PiecewiseConstantFunction") {
+        PiecewiseConstantFunction func(n, px, py);
+        SimTK::Vector batch;
+        SimTK::Vector t(1, 0.0);
+        func.calcValues(0, queries, batch);
+        for (int i = 0; i < queries.size(); ++i) {
+            t[0] = queries[i];
+            CHECK(batch[i] == func.calcValue(t));
+        }
+        func.calcValues(1, queries, batch);
+        for (int i = 0; i < queries.size(); ++i)
+            CHECK(batch[i] == 0.0);
+    }
+}
+
 TEST_CASE("MultivariatePolynomialFunction") {
     SECTION("Input errors") {
         {
@@ -151,6 +206,90 @@ TEST_CASE("MultivariatePolynomialFunction") {
                           c[3] * input[1] + c[4] * input[0];
         CHECK(f.calcValue(input) == expected);
     }
+    SECTION("Batch evaluation matches per-point evaluation") {
+        SimTK::Vector c = SimTK::Test::randVector(35);
+        MultivariatePolynomialFunction f(c, 3, 4);
+        const int numPoints = 7;
+        SimTK::Matrix points(numPoints, 3);
+        for (int r = 0; r < numPoints; ++r)
+            for (int i = 0; i < 3; ++i)
+                points(r, i) = 0.1 * (r + 1) + 0.3 * i;
+        SimTK::Vector values;
+        f.calcValues(points, values);
+        REQUIRE(values.size() == numPoints);
+        for (int r = 0; r < numPoints; ++r) {
+            SimTK::Vector input = points.row(r).transpose();
+            CHECK(values[r] == f.calcValue(input));
+        }
+        for (int d = 0; d < 3; ++d) {
+            SimTK::Vector derivatives;
+            f.calcDerivatives(d, points, derivatives);
+            std::vector<int> component(1, d);
+            for (int r = 0; r < numPoints; ++r) {
+                SimTK::Vector input = points.row(r).transpose();
+                CHECK(derivatives[r] == f.calcDerivative(component, input));
+            }
+        }
+        SimTK::Vector unused;
+        CHECK_THROWS_WITH(f.calcValues(SimTK::Matrix(2, 2), unused),
+                Catch::Contains("Expected one column per dimension"));
+        CHECK_THROWS_WITH(f.calcDerivatives(3, points, unused),
+                Catch::Contains("Expected derivComponent"));
+    }
+}
+
+TEST_CASE("FunctionSetEvaluator") {
+    const int n = 15;
+    double px[n], py[n];
+    for (int i = 0; i < n; ++i) {
+        px[i] = 0.1 * i;
+        py[i] = std::cos(2.0 * px[i]);
+    }
+
+    SECTION("Heterogeneous set matches per-function evaluation") {
+        FunctionSet set;
+        set.adoptAndAppend(new Constant(2.5));
+        set.adoptAndAppend(new PiecewiseConstantFunction(n, px, py));
+        set.adoptAndAppend(new PiecewiseLinearFunction(n, px, py));
+        set.adoptAndAppend(new GCVSpline(5, n, px, py));
+        set.adoptAndAppend(new Sine(1.5, 3.1, 0.3));
+
+        FunctionSetEvaluator evaluator(set);
+        REQUIRE(evaluator.getNumFunctions() == set.getSize());
+        SimTK::Vector values;
+        OpenSim::Array<double> expected;
+        for (int deriv = 0; deriv <= 1; ++deriv) {
+            for (double x = -0.1; x < 1.6; x += 0.07) {
+                evaluator.calcValues(deriv, x, values);
+                set.evaluate(expected, deriv, x);
+                for (int i = 0; i < set.getSize(); ++i)
+                    CHECK(values[i] == Approx(expected[i]).margin(1e-10));
+            }
+        }
+    }
+
+    SECTION("All-spline set uses the shared-knot path") {
+        FunctionSet set;
+        for (int k = 0; k < 3; ++k) {
+            double shifted[n];
+            for (int i = 0; i < n; ++i) shifted[i] = py[i] + 0.5 * k;
+            set.adoptAndAppend(new GCVSpline(5, n, px, shifted));
+        }
+        FunctionSetEvaluator evaluator(set);
+        SimTK::Vector values;
+        OpenSim::Array<double> expected;
+        for (double x = 0.0; x < 1.4; x += 0.11) {
+            evaluator.calcValues(0, x, values);
+            set.evaluate(expected, 0, x);
+            for (int i = 0; i < set.getSize(); ++i)
+                CHECK(values[i] == Approx(expected[i]).margin(1e-10));
+        }
+    }
+
+    SECTION("Empty set is rejected") {
+        FunctionSet empty;
+        CHECK_THROWS_AS(FunctionSetEvaluator{empty}, OpenSim::Exception);
+    }
 }
 
 TEST_CASE("solveBisection()") {
@@ -82,6 +82,102 @@ int main() {
                 SimTK::Eps, __FILE__, __LINE__,
                 "Duplicate GCVSpline failed to reproduce identical first derivative.");
         }
+
+        // Batch evaluation must agree with per-point evaluation, for the
+        // value and for derivatives.
+        SimTK::Vector queries(2*size - 1), batch;
+        for (int i = 0; i < queries.size(); ++i)
+            queries[i] = dt / 2 * i;
+        spline.calcValues(0, queries, batch);
+        for (int i = 0; i < queries.size(); ++i) {
+            t[0] = queries[i];
+            ASSERT_EQUAL(spline.calcValue(t), batch[i],
+                1.0e-12, __FILE__, __LINE__,
+                "GCVSpline::calcValues disagreed with calcValue.");
+        }
+        spline.calcValues(1, queries, batch);
+        for (int i = 0; i < queries.size(); ++i) {
+            t[0] = queries[i];
+            ASSERT_EQUAL(spline.calcDerivative(derivComponents, t), batch[i],
+                1.0e-10, __FILE__, __LINE__,
+                "GCVSpline::calcValues disagreed with calcDerivative.");
+        }
+        // Unsorted queries give the same answers as sorted ones: the
+        // interval hint is only a starting guess for the search.
+        SimTK::Vector reversedQueries(queries.size()), reversedBatch;
+        for (int i = 0; i < queries.size(); ++i)
+            reversedQueries[i] = queries[queries.size() - 1 - i];
+        spline.calcValues(0, reversedQueries, reversedBatch);
+        spline.calcValues(0, queries, batch);
+        for (int i = 0; i < queries.size(); ++i) {
+            ASSERT_EQUAL(batch[i], reversedBatch[queries.size() - 1 - i],
+                SimTK::Eps, __FILE__, __LINE__,
+                "GCVSpline::calcValues depended on query order.");
+        }
+        cout << "GCVSpline batch evaluation agreed with per-point "
+                "evaluation." << endl;
+
+        // Shared-knot evaluation of a whole set must agree with evaluating
+        // each spline individually.
+        TimeSeriesTable table;
+        table.setColumnLabels({"sin", "cos", "ramp"});
+        for (int i = 0; i < size; ++i) {
+            SimTK::RowVector_<double> row(3);
+            row[0] = sin(omega*x[i]);
+            row[1] = cos(omega*x[i]);
+            row[2] = 2.0*x[i] - 1.0;
+            table.appendRow(x[i], row);
+        }
+        GCVSplineSet splineSet(table);
+        // The set is fit in parallel on construction; every column must
+        // still reproduce its input samples.
+        for (int i = 0; i < size; ++i) {
+            t[0] = x[i];
+            for (int k = 0; k < 3; ++k) {
+                ASSERT_EQUAL(table.getMatrix().getElt(i, k),
+                    splineSet.getGCVSpline(k)->calcValue(t),
+                    SimTK::SignificantReal, __FILE__, __LINE__,
+                    "GCVSplineSet failed to reproduce input data points.");
+            }
+        }
+        GCVSplineSetEvaluator evaluator(splineSet);
+        ASSERT(evaluator.getNumSplines() == 3);
+        SimTK::Vector setValues;
+        for (int deriv = 0; deriv <= 1; ++deriv) {
+            std::vector<int> components(deriv, 0);
+            for (int i = 0; i < (2*size - 1); ++i) {
+                t[0] = dt / 2 * i;
+                evaluator.calcValues(deriv, t[0], setValues);
+                for (int k = 0; k < 3; ++k) {
+                    const GCVSpline* spl = splineSet.getGCVSpline(k);
+                    const double expected = (deriv == 0)
+                            ? spl->calcValue(t)
+                            : spl->calcDerivative(components, t);
+                    ASSERT_EQUAL(expected, setValues[k],
+                        1.0e-10, __FILE__, __LINE__,
+                        "GCVSplineSetEvaluator disagreed with per-spline "
+                        "evaluation.");
+                }
+            }
+        }
+        cout << "GCVSplineSetEvaluator agreed with per-spline evaluation."
+             << endl;
+
+        // A set whose splines do not share knots cannot be packed.
+        GCVSplineSet mismatched;
+        mismatched.adoptAndAppend(new GCVSpline(5, size, x, y));
+        double xShifted[size];
+        for (int i = 0; i < size; ++i)
+            xShifted[i] = x[i] + 0.5*dt;
+        mismatched.adoptAndAppend(new GCVSpline(5, size, xShifted, y));
+        bool threw = false;
+        try {
+            GCVSplineSetEvaluator bad(mismatched);
+        } catch (const Exception&) {
+            threw = true;
+        }
+        ASSERT(threw, __FILE__, __LINE__,
+            "GCVSplineSetEvaluator failed to reject mismatched knots.");
     }
     catch(const Exception& e) {
         e.print(cerr);
@@ -0,0 +1,162 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  testH5FileAdapter.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/Adapters.h"
+#include <cmath>
+#include <cstdio>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+namespace {
+
+// A smooth multi-column table resembling simulation output.
+TimeSeriesTable makeTestTable(size_t numRows, size_t numCols) {
+    std::vector<std::string> labels{};
+    for(size_t c = 0; c < numCols; ++c)
+        labels.push_back("col" + std::to_string(c));
+
+    TimeSeriesTable table{};
+    table.setColumnLabels(labels);
+    for(size_t r = 0; r < numRows; ++r) {
+        SimTK::RowVector_<double> row{static_cast<int>(numCols)};
+        for(size_t c = 0; c < numCols; ++c)
+            row[static_cast<int>(c)] = std::sin(0.01 * r + c);
+        table.appendRow(0.01 * r, row);
+    }
+    return table;
+}
+
+void checkTablesEqual(const TimeSeriesTable& expected,
+                      const TimeSeriesTable& actual) {
+    REQUIRE(actual.getNumRows() == expected.getNumRows());
+    REQUIRE(actual.getNumColumns() == expected.getNumColumns());
+    CHECK(actual.getColumnLabels() == expected.getColumnLabels());
+    for(size_t r = 0; r < expected.getNumRows(); ++r) {
+        CHECK(actual.getIndependentColumn()[r] ==
+              expected.getIndependentColumn()[r]);
+        for(size_t c = 0; c < expected.getNumColumns(); ++c)
+            CHECK(actual.getRowAtIndex(r)[static_cast<int>(c)] ==
+                  expected.getRowAtIndex(r)[static_cast<int>(c)]);
+    }
+}
+
+} // namespace
+
+TEST_CASE("H5FileAdapter roundtrip") {
+    const std::string filename{"testH5FileAdapter_roundtrip.h5"};
+    auto table = makeTestTable(100, 5);
+    table.addTableMetaData("units", std::string{"rad"});
+    H5FileAdapter::write(table, filename);
+
+    SECTION("readTable reproduces the table bit-for-bit") {
+        auto copy = H5FileAdapter::readTable(filename);
+        checkTablesEqual(table, copy);
+        CHECK(copy.getTableMetaData<std::string>("units") == "rad");
+    }
+
+    SECTION("read through the registered extension") {
+        TimeSeriesTable copy{filename};
+        checkTablesEqual(table, copy);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("H5FileAdapter multi-table bundle") {
+    const std::string filename{"testH5FileAdapter_bundle.h5"};
+    auto states = makeTestTable(100, 4);
+    auto controls = makeTestTable(100, 2);
+
+    DataAdapter::InputTables tables{};
+    tables.emplace("states", &states);
+    tables.emplace("controls", &controls);
+    FileAdapter::writeFile(tables, filename);
+
+    CHECK(H5FileAdapter::getTableNames(filename) ==
+          std::vector<std::string>{"controls", "states"});
+    checkTablesEqual(states, H5FileAdapter::readTable(filename, "states"));
+    checkTablesEqual(controls,
+                     H5FileAdapter::readTable(filename, "controls"));
+
+    // Reading through the generic interface yields every table.
+    H5FileAdapter adapter{};
+    auto bundle = adapter.read(filename);
+    REQUIRE(bundle.size() == 2);
+    checkTablesEqual(states,
+                     static_cast<const TimeSeriesTable&>(
+                             *bundle.at("states")));
+
+    CHECK_THROWS_AS(H5FileAdapter::readTable(filename, "no-such-table"),
+                    KeyNotFound);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("H5FileAdapter column projection") {
+    const std::string filename{"testH5FileAdapter_projection.h5"};
+    auto table = makeTestTable(50, 10);
+    H5FileAdapter::write(table, filename);
+
+    auto subset = H5FileAdapter::readTable(filename,
+                                           H5FileAdapter::tableString(),
+                                           {"col7", "col2"});
+    REQUIRE(subset.getNumRows() == table.getNumRows());
+    REQUIRE(subset.getNumColumns() == 2);
+    CHECK(subset.getColumnLabels() ==
+          std::vector<std::string>{"col7", "col2"});
+    for(size_t r = 0; r < table.getNumRows(); ++r) {
+        CHECK(subset.getIndependentColumn()[r] ==
+              table.getIndependentColumn()[r]);
+        CHECK(subset.getDependentColumn("col7")[static_cast<int>(r)] ==
+              table.getDependentColumn("col7")[static_cast<int>(r)]);
+        CHECK(subset.getDependentColumn("col2")[static_cast<int>(r)] ==
+              table.getDependentColumn("col2")[static_cast<int>(r)]);
+    }
+
+    CHECK_THROWS_AS(H5FileAdapter::readTable(filename,
+                                             H5FileAdapter::tableString(),
+                                             {"no-such-column"}),
+                    KeyNotFound);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("H5FileAdapter edge cases") {
+    SECTION("table with no rows") {
+        const std::string filename{"testH5FileAdapter_empty.h5"};
+        TimeSeriesTable table{};
+        table.setColumnLabels({"a", "b"});
+        H5FileAdapter::write(table, filename);
+        auto copy = H5FileAdapter::readTable(filename);
+        CHECK(copy.getNumRows() == 0);
+        CHECK(copy.getColumnLabels() ==
+              std::vector<std::string>{"a", "b"});
+        std::remove(filename.c_str());
+    }
+
+    SECTION("invalid rows per chunk") {
+        H5FileAdapter adapter{};
+        CHECK_THROWS_AS(adapter.setRowsPerChunk(0), InvalidArgument);
+    }
+}
@@ -0,0 +1,125 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  testIndexedSTOReader.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/IndexedSTOReader.h"
+#include "OpenSim/Common/STOFileAdapter.h"
+#include <algorithm>
+#include <cstdio>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+TEST_CASE("IndexedSTOReader") {
+    // Write a scalar table with enough rows to span several index chunks.
+    const std::string filename{"testIndexedSTOReader.sto"};
+    const int numRows = 50;
+    const std::vector<std::string> labels{"col0", "col1", "col2"};
+    TimeSeriesTable_<double> table{};
+    table.setColumnLabels(labels);
+    table.updTableMetaData().setValueForKey("units", std::string{"m"});
+    for(int r = 0; r < numRows; ++r) {
+        SimTK::RowVector_<double> row(3);
+        for(int c = 0; c < 3; ++c)
+            row[c] = r + 0.1 * c;
+        table.appendRow(0.01 * r, row);
+    }
+    STOFileAdapter::write(table, filename);
+
+    // Use a small chunk size so the windowed reads below cross chunk
+    // boundaries.
+    IndexedSTOReader reader{filename, 8};
+
+    CHECK(reader.getFileName() == filename);
+    CHECK(reader.getColumnLabels() == labels);
+    CHECK(reader.getNumRows() == size_t(numRows));
+    CHECK(reader.getFirstTime() == Approx(0.0));
+    CHECK(reader.getLastTime() == Approx(0.01 * (numRows - 1)));
+    CHECK(reader.getNumChunks() == size_t(7));
+
+    // A window in the middle of the file contains exactly the rows whose
+    // times lie within it, with the data intact.
+    auto window = reader.readTimeRange(0.1, 0.2);
+    CHECK(window.getNumRows() == size_t(11));
+    CHECK(window.getColumnLabels() == labels);
+    CHECK(window.getTableMetaDataAsString("units") == "m");
+    for(size_t r = 0; r < window.getNumRows(); ++r) {
+        const int fileRow = static_cast<int>(r) + 10;
+        CHECK(window.getIndependentColumn()[r] == Approx(0.01 * fileRow));
+        for(int c = 0; c < 3; ++c)
+            CHECK(window.getMatrix()[static_cast<int>(r)][c] ==
+                  Approx(fileRow + 0.1 * c));
+    }
+
+    // A window covering the whole time range reproduces the full table.
+    auto whole = reader.readTimeRange(reader.getFirstTime(),
+                                      reader.getLastTime());
+    CHECK(whole.getNumRows() == table.getNumRows());
+    for(size_t r = 0; r < whole.getNumRows(); ++r)
+        CHECK(whole.getIndependentColumn()[r] ==
+              Approx(table.getIndependentColumn()[r]));
+
+    // Windows that miss the data entirely come back empty (but carry the
+    // labels and metadata).
+    auto before = reader.readTimeRange(-2.0, -1.0);
+    CHECK(before.getNumRows() == size_t(0));
+    CHECK(before.getColumnLabels() == labels);
+    auto after = reader.readTimeRange(10.0, 20.0);
+    CHECK(after.getNumRows() == size_t(0));
+
+    // Reversed windows are rejected.
+    CHECK_THROWS_AS(reader.readTimeRange(0.2, 0.1), InvalidArgument);
+
+    // findRowIndex() matches Storage::findIndex(): the last row at or before
+    // the given time, clamped to the ends of the file.
+    CHECK(reader.findRowIndex(-1.0) == size_t(0));
+    CHECK(reader.findRowIndex(0.0) == size_t(0));
+    CHECK(reader.findRowIndex(0.125) == size_t(12));
+    CHECK(reader.findRowIndex(0.13) == size_t(13));
+    CHECK(reader.findRowIndex(10.0) == size_t(numRows - 1));
+
+    // Row ranges address rows exactly; consecutive non-overlapping ranges
+    // partition the file.
+    size_t streamed = 0;
+    for(size_t first = 0; first < size_t(numRows); first += 13) {
+        const size_t last =
+                std::min(size_t(numRows) - 1, first + 13 - 1);
+        auto rows = reader.readRowRange(first, last);
+        CHECK(rows.getNumRows() == last - first + 1);
+        for(size_t r = 0; r < rows.getNumRows(); ++r) {
+            const int fileRow = static_cast<int>(first + r);
+            CHECK(rows.getIndependentColumn()[r] == Approx(0.01 * fileRow));
+            for(int c = 0; c < 3; ++c)
+                CHECK(rows.getMatrix()[static_cast<int>(r)][c] ==
+                      Approx(fileRow + 0.1 * c));
+        }
+        streamed += rows.getNumRows();
+    }
+    CHECK(streamed == size_t(numRows));
+
+    // Reversed and out-of-range row ranges are rejected.
+    CHECK_THROWS_AS(reader.readRowRange(5, 4), InvalidArgument);
+    CHECK_THROWS_AS(reader.readRowRange(0, size_t(numRows)), InvalidArgument);
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,147 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  testOSTBFileAdapter.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/Adapters.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+namespace {
+
+// A smooth multi-column table resembling simulation output.
+TimeSeriesTable makeTestTable(size_t numRows, size_t numCols) {
+    std::vector<std::string> labels{};
+    for(size_t c = 0; c < numCols; ++c)
+        labels.push_back("col" + std::to_string(c));
+
+    TimeSeriesTable table{};
+    table.setColumnLabels(labels);
+    for(size_t r = 0; r < numRows; ++r) {
+        SimTK::RowVector_<double> row{static_cast<int>(numCols)};
+        for(size_t c = 0; c < numCols; ++c)
+            row[static_cast<int>(c)] = std::sin(0.01 * r + c);
+        table.appendRow(0.01 * r, row);
+    }
+    return table;
+}
+
+void checkTablesEqual(const TimeSeriesTable& expected,
+                      const TimeSeriesTable& actual) {
+    REQUIRE(actual.getNumRows() == expected.getNumRows());
+    REQUIRE(actual.getNumColumns() == expected.getNumColumns());
+    CHECK(actual.getColumnLabels() == expected.getColumnLabels());
+    for(size_t r = 0; r < expected.getNumRows(); ++r) {
+        CHECK(actual.getIndependentColumn()[r] ==
+              expected.getIndependentColumn()[r]);
+        for(size_t c = 0; c < expected.getNumColumns(); ++c)
+            CHECK(actual.getRowAtIndex(r)[static_cast<int>(c)] ==
+                  expected.getRowAtIndex(r)[static_cast<int>(c)]);
+    }
+}
+
+} // namespace
+
+TEST_CASE("OSTBFileAdapter roundtrip") {
+    const std::string filename{"testOSTBFileAdapter_roundtrip.ostb"};
+    // Use a small block size so the file has multiple blocks per column.
+    auto table = makeTestTable(100, 5);
+    table.addTableMetaData("units", std::string{"rad"});
+    OSTBFileAdapter::write(table, filename, 16);
+
+    SECTION("readTable reproduces the table bit-for-bit") {
+        auto copy = OSTBFileAdapter::readTable(filename);
+        checkTablesEqual(table, copy);
+        CHECK(copy.getTableMetaData<std::string>("units") == "rad");
+    }
+
+    SECTION("binary file is smaller than the .sto equivalent") {
+        const std::string stoFilename{"testOSTBFileAdapter_roundtrip.sto"};
+        STOFileAdapter::write(table, stoFilename);
+        std::ifstream ostb{filename, std::ios::binary | std::ios::ate};
+        std::ifstream sto{stoFilename, std::ios::binary | std::ios::ate};
+        CHECK(ostb.tellg() < sto.tellg());
+        std::remove(stoFilename.c_str());
+    }
+
+    SECTION("read through the registered extension") {
+        TimeSeriesTable copy{filename};
+        checkTablesEqual(table, copy);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("OSTBFileAdapter column projection") {
+    const std::string filename{"testOSTBFileAdapter_projection.ostb"};
+    auto table = makeTestTable(50, 10);
+    OSTBFileAdapter::write(table, filename, 16);
+
+    auto subset = OSTBFileAdapter::readTable(filename, {"col7", "col2"});
+    REQUIRE(subset.getNumRows() == table.getNumRows());
+    REQUIRE(subset.getNumColumns() == 2);
+    CHECK(subset.getColumnLabels() ==
+          std::vector<std::string>{"col7", "col2"});
+    for(size_t r = 0; r < table.getNumRows(); ++r) {
+        CHECK(subset.getIndependentColumn()[r] ==
+              table.getIndependentColumn()[r]);
+        CHECK(subset.getDependentColumn("col7")[static_cast<int>(r)] ==
+              table.getDependentColumn("col7")[static_cast<int>(r)]);
+        CHECK(subset.getDependentColumn("col2")[static_cast<int>(r)] ==
+              table.getDependentColumn("col2")[static_cast<int>(r)]);
+    }
+
+    CHECK_THROWS_AS(OSTBFileAdapter::readTable(filename, {"no-such-column"}),
+                    KeyNotFound);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("OSTBFileAdapter edge cases") {
+    SECTION("table with no rows") {
+        const std::string filename{"testOSTBFileAdapter_empty.ostb"};
+        TimeSeriesTable table{};
+        table.setColumnLabels({"a", "b"});
+        OSTBFileAdapter::write(table, filename);
+        auto copy = OSTBFileAdapter::readTable(filename);
+        CHECK(copy.getNumRows() == 0);
+        CHECK(copy.getColumnLabels() ==
+              std::vector<std::string>{"a", "b"});
+        std::remove(filename.c_str());
+    }
+
+    SECTION("file that is not an OSTB file") {
+        const std::string filename{"testOSTBFileAdapter_bogus.ostb"};
+        std::ofstream{filename} << "endheader\ntime\n0.0\n";
+        CHECK_THROWS_AS(OSTBFileAdapter::readTable(filename),
+                        OSTBFormatError);
+        std::remove(filename.c_str());
+    }
+
+    SECTION("invalid rows per block") {
+        OSTBFileAdapter adapter{};
+        CHECK_THROWS_AS(adapter.setRowsPerBlock(0), InvalidArgument);
+    }
+}
@@ -0,0 +1,166 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  testParquetFileAdapter.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/Adapters.h"
+#include <cmath>
+#include <cstdio>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+namespace {
+
+// A smooth multi-column table resembling simulation output.
+TimeSeriesTable makeTestTable(size_t numRows, size_t numCols) {
+    std::vector<std::string> labels{};
+    for(size_t c = 0; c < numCols; ++c)
+        labels.push_back("col" + std::to_string(c));
+
+    TimeSeriesTable table{};
+    table.setColumnLabels(labels);
+    for(size_t r = 0; r < numRows; ++r) {
+        SimTK::RowVector_<double> row{static_cast<int>(numCols)};
+        for(size_t c = 0; c < numCols; ++c)
+            row[static_cast<int>(c)] = std::sin(0.01 * r + c);
+        table.appendRow(0.01 * r, row);
+    }
+    return table;
+}
+
+void checkTablesEqual(const TimeSeriesTable& expected,
+                      const TimeSeriesTable& actual) {
+    REQUIRE(actual.getNumRows() == expected.getNumRows());
+    REQUIRE(actual.getNumColumns() == expected.getNumColumns());
+    CHECK(actual.getColumnLabels() == expected.getColumnLabels());
+    for(size_t r = 0; r < expected.getNumRows(); ++r) {
+        CHECK(actual.getIndependentColumn()[r] ==
+              expected.getIndependentColumn()[r]);
+        for(size_t c = 0; c < expected.getNumColumns(); ++c)
+            CHECK(actual.getRowAtIndex(r)[static_cast<int>(c)] ==
+                  expected.getRowAtIndex(r)[static_cast<int>(c)]);
+    }
+}
+
+} // namespace
+
+TEST_CASE("ParquetFileAdapter roundtrip") {
+    const std::string filename{"testParquetFileAdapter_roundtrip.parquet"};
+    // Use a small row-group size so the file has multiple row groups.
+    auto table = makeTestTable(100, 5);
+    table.addTableMetaData("units", std::string{"rad"});
+    ParquetFileAdapter::write(table, filename, 16);
+
+    SECTION("readTable reproduces the table bit-for-bit") {
+        auto copy = ParquetFileAdapter::readTable(filename);
+        checkTablesEqual(table, copy);
+        CHECK(copy.getTableMetaData<std::string>("units") == "rad");
+    }
+
+    SECTION("read through the registered extension") {
+        TimeSeriesTable copy{filename};
+        checkTablesEqual(table, copy);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("ParquetFileAdapter column projection") {
+    const std::string filename{"testParquetFileAdapter_projection.parquet"};
+    auto table = makeTestTable(50, 10);
+    ParquetFileAdapter::write(table, filename, 16);
+
+    auto subset = ParquetFileAdapter::readTable(filename, {"col7", "col2"});
+    REQUIRE(subset.getNumRows() == table.getNumRows());
+    REQUIRE(subset.getNumColumns() == 2);
+    CHECK(subset.getColumnLabels() ==
+          std::vector<std::string>{"col7", "col2"});
+    for(size_t r = 0; r < table.getNumRows(); ++r) {
+        CHECK(subset.getIndependentColumn()[r] ==
+              table.getIndependentColumn()[r]);
+        CHECK(subset.getDependentColumn("col7")[static_cast<int>(r)] ==
+              table.getDependentColumn("col7")[static_cast<int>(r)]);
+        CHECK(subset.getDependentColumn("col2")[static_cast<int>(r)] ==
+              table.getDependentColumn("col2")[static_cast<int>(r)]);
+    }
+
+    CHECK_THROWS_AS(
+            ParquetFileAdapter::readTable(filename, {"no-such-column"}),
+            KeyNotFound);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("ParquetFileAdapter time-range predicate") {
+    const std::string filename{"testParquetFileAdapter_timerange.parquet"};
+    auto table = makeTestTable(100, 3);
+    ParquetFileAdapter::write(table, filename, 16);
+
+    ParquetFileAdapter adapter{};
+    adapter.setTimeRange(0.25, 0.50);
+    auto tables = adapter.read(filename);
+    const auto& subset = static_cast<const TimeSeriesTable&>(
+            *tables.at(ParquetFileAdapter::tableString()));
+
+    // Rows 25..50 inclusive satisfy 0.25 <= 0.01*r <= 0.50.
+    REQUIRE(subset.getNumRows() == 26);
+    for(size_t r = 0; r < subset.getNumRows(); ++r) {
+        CHECK(subset.getIndependentColumn()[r] ==
+              table.getIndependentColumn()[r + 25]);
+        CHECK(subset.getRowAtIndex(r)[0] ==
+              table.getRowAtIndex(r + 25)[0]);
+    }
+
+    SECTION("range beyond the data yields an empty table") {
+        adapter.setTimeRange(10.0, 20.0);
+        auto emptyTables = adapter.read(filename);
+        const auto& empty = static_cast<const TimeSeriesTable&>(
+                *emptyTables.at(ParquetFileAdapter::tableString()));
+        CHECK(empty.getNumRows() == 0);
+        CHECK(empty.getColumnLabels() == table.getColumnLabels());
+    }
+
+    SECTION("invalid time range") {
+        CHECK_THROWS_AS(adapter.setTimeRange(1.0, 0.0), InvalidArgument);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("ParquetFileAdapter edge cases") {
+    SECTION("table with no rows") {
+        const std::string filename{"testParquetFileAdapter_empty.parquet"};
+        TimeSeriesTable table{};
+        table.setColumnLabels({"a", "b"});
+        ParquetFileAdapter::write(table, filename);
+        auto copy = ParquetFileAdapter::readTable(filename);
+        CHECK(copy.getNumRows() == 0);
+        CHECK(copy.getColumnLabels() ==
+              std::vector<std::string>{"a", "b"});
+        std::remove(filename.c_str());
+    }
+
+    SECTION("invalid rows per row group") {
+        ParquetFileAdapter adapter{};
+        CHECK_THROWS_AS(adapter.setRowsPerRowGroup(0), InvalidArgument);
+    }
+}
@@ -326,10 +326,58 @@ void testComponentPath() {
     }
 }
 
+void testComponentPathAtoms()
+{
+    // interning the same element twice yields the same Atom
+    ComponentPath::Atom a1 = ComponentPath::intern("femur_r");
+    ComponentPath::Atom a2 = ComponentPath::intern("femur_r");
+    ComponentPath::Atom b = ComponentPath::intern("tibia_r");
+    SimTK_TEST(a1 == a2);
+    SimTK_TEST(a1 != b);
+    SimTK_TEST(ComponentPath::getAtomString(a1) == "femur_r");
+    SimTK_TEST(ComponentPath::getAtomString(b) == "tibia_r");
+
+    // invalid elements are rejected at interning time
+    SimTK_TEST_MUST_THROW_EXC(ComponentPath::intern("foo*bar"),
+            OpenSim::Exception);
+
+    // a path's atoms match its (normalized) elements, in order
+    ComponentPath path{"/bodyset//femur_r/./geometry"};
+    const std::vector<ComponentPath::Atom>& atoms = path.getAtoms();
+    SimTK_TEST(atoms.size() == path.getNumPathLevels());
+    SimTK_TEST(atoms.size() == 3);
+    SimTK_TEST(path.getAtomStringAtLevel(0) == "bodyset");
+    SimTK_TEST(path.getAtomAtLevel(1) == a1);
+    SimTK_TEST(path.getAtomStringAtLevel(2) == "geometry");
+    SimTK_TEST_MUST_THROW_EXC(path.getAtomAtLevel(3), OpenSim::Exception);
+
+    // equal elements in different paths map to equal Atoms
+    ComponentPath other{"femur_r/geometry"};
+    SimTK_TEST(other.getAtomAtLevel(0) == path.getAtomAtLevel(1));
+    SimTK_TEST(other.getAtomAtLevel(1) == path.getAtomAtLevel(2));
+
+    // leading ".." elements of a relative path are interned as atoms too
+    ComponentPath relative{"../../femur_r"};
+    SimTK_TEST(relative.getAtomAtLevel(0) == ComponentPath::intern(".."));
+    SimTK_TEST(relative.getAtomAtLevel(2) == a1);
+
+    // pushBack invalidates the cached interned form
+    ComponentPath grows{"/a"};
+    SimTK_TEST(grows.getAtoms().size() == 1);
+    grows.pushBack("b");
+    SimTK_TEST(grows.getAtoms().size() == 2);
+    SimTK_TEST(grows.getAtomStringAtLevel(1) == "b");
+
+    // the empty and root paths have no atoms
+    SimTK_TEST(ComponentPath{""}.getAtoms().empty());
+    SimTK_TEST(ComponentPath{"/"}.getAtoms().empty());
+}
+
 int main()
 {
     SimTK_START_TEST("testPath");
         SimTK_SUBTEST(testComponentPath);
+        SimTK_SUBTEST(testComponentPathAtoms);
     SimTK_END_TEST();
 
     return 0;
@@ -22,6 +22,7 @@
 
 #include "OpenSim/Common/Adapters.h"
 #include "OpenSim/Common/CommonUtilities.h"
+#include "OpenSim/Common/STOStreamWriter.h"
 #include <cstdio>
 #include <fstream>
 #include <unordered_set>
@@ -350,6 +351,70 @@ TEST_CASE("Trimming whitespace in metadata values") {
     CHECK(table.getTableMetaDataAsString("inDegrees") == "yes");
 }
 
+TEST_CASE("STOStreamWriter") {
+    const std::string filename = "testSTOStreamWriter.sto";
+    const std::vector<std::string> labels{"c1", "c2", "c3"};
+    const int numRows = 10;
+
+    // Stream rows one at a time; the file is complete once the writer is
+    // closed, with no whole-table buffering.
+    {
+        ValueArrayDictionary metaData{};
+        metaData.setValueForKey("units", std::string{"m"});
+        STOStreamWriter writer{filename, labels, metaData};
+        SimTK::RowVector_<double> row(3);
+        for(int r = 0; r < numRows; ++r) {
+            for(int c = 0; c < 3; ++c)
+                row[c] = r + 0.25 * c;
+            writer.appendRow(0.1 * r, row);
+        }
+        CHECK(writer.getNumRowsWritten() == size_t(numRows));
+
+        // Rows must grow the time column and match the label count.
+        CHECK_THROWS_AS(writer.appendRow(0.1 * (numRows - 1), row),
+                        InvalidArgument);
+        SimTK::RowVector_<double> shortRow(2, 0.0);
+        CHECK_THROWS_AS(writer.appendRow(1.0 + 0.1 * numRows, shortRow),
+                        InvalidArgument);
+
+        writer.close();
+        CHECK_THROWS_AS(writer.appendRow(2.0, row), InvalidCall);
+    }
+
+    // The streamed file reads back like one written by STOFileAdapter.
+    TimeSeriesTable table{filename};
+    CHECK(table.getNumRows() == size_t(numRows));
+    CHECK(table.getColumnLabels() == labels);
+    CHECK(table.getTableMetaDataAsString("units") == "m");
+    for(int r = 0; r < numRows; ++r) {
+        CHECK(table.getIndependentColumn()[r] == Approx(0.1 * r));
+        for(int c = 0; c < 3; ++c)
+            CHECK(table.getMatrix()[r][c] == Approx(r + 0.25 * c));
+    }
+    std::remove(filename.c_str());
+
+    // Non-scalar element types stream with the same component delimiters
+    // STOFileAdapter uses.
+    const std::string vec3File = "testSTOStreamWriterVec3.sto";
+    {
+        STOStreamWriterVec3 writer{vec3File, {"p1", "p2"}};
+        SimTK::RowVector_<SimTK::Vec3> row(2);
+        for(int r = 0; r < 3; ++r) {
+            row[0] = SimTK::Vec3{r + 0.1, r + 0.2, r + 0.3};
+            row[1] = SimTK::Vec3{r + 0.4, r + 0.5, r + 0.6};
+            writer.appendRow(0.5 * r, row);
+        }
+    }
+    TimeSeriesTable_<SimTK::Vec3> vec3Table{vec3File};
+    CHECK(vec3Table.getNumRows() == size_t(3));
+    for(int r = 0; r < 3; ++r)
+        for(int c = 0; c < 2; ++c)
+            for(int i = 0; i < 3; ++i)
+                CHECK(vec3Table.getMatrix()[r][c][i] ==
+                      Approx(r + 0.1 * (3 * c + i + 1)));
+    std::remove(vec3File.c_str());
+}
+
 
 
 
@@ -0,0 +1,133 @@
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  testSensorStreamReader.cpp                   *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/DataAdapter.h"
+#include "OpenSim/Common/SensorStreamReader.h"
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+
+#include <fstream>
+
+using namespace OpenSim;
+
+// 4-byte floats on the wire.
+const double tolerance = 1e-6;
+
+void testFrameCodec();
+void testFileRoundTrip();
+
+int main() {
+    try {
+        testFrameCodec();
+        testFileRoundTrip();
+    }
+    catch (const std::exception& ex) {
+        std::cout << "testSensorStreamReader FAILED: " << ex.what() << std::endl;
+        return 1;
+    }
+    std::cout << "\n All testSensorStreamReader cases passed." << std::endl;
+    return 0;
+}
+
+void testFrameCodec() {
+    const int numSensors = 3;
+    std::vector<SimTK::Quaternion> quaternions(numSensors);
+    quaternions[0] = SimTK::Quaternion(
+            SimTK::Rotation(0.3, SimTK::XAxis).convertRotationToQuaternion());
+    quaternions[1] = SimTK::Quaternion(
+            SimTK::Rotation(-1.1, SimTK::YAxis).convertRotationToQuaternion());
+    quaternions[2] = SimTK::Quaternion(
+            SimTK::Rotation(2.4, SimTK::ZAxis).convertRotationToQuaternion());
+
+    std::vector<unsigned char> buffer(
+            SensorStreamReader::getFrameSizeInBytes(numSensors));
+    ASSERT(buffer.size() == 8 + 16 * numSensors);
+    SensorStreamReader::encodeFrame(
+            0.0425, quaternions.data(), numSensors, buffer.data());
+
+    std::vector<SimTK::Quaternion> decoded(numSensors);
+    double timestamp = SensorStreamReader::decodeFrame(
+            buffer.data(), numSensors, decoded.data());
+    // Timestamps are 8-byte doubles and round-trip exactly.
+    ASSERT(timestamp == 0.0425);
+    for (int i = 0; i < numSensors; ++i)
+        for (int k = 0; k < 4; ++k)
+            ASSERT_EQUAL(quaternions[i][k], decoded[i][k], tolerance);
+}
+
+void testFileRoundTrip() {
+    const std::string fileName = "sensorStream.osns";
+    const int numSensors = 2;
+    const int numFrames = 5;
+    const double dataRate = 400.0;
+
+    std::vector<ExperimentalSensor> sensors;
+    sensors.push_back(ExperimentalSensor("00B42D4D", "pelvis_imu"));
+    sensors.push_back(ExperimentalSensor("00B42D4E", "torso_imu"));
+    SensorStreamReader::StreamHeader header =
+            SensorStreamReader::makeHeader(sensors, dataRate);
+    ASSERT(header.sensorNames[0] == "pelvis_imu");
+    ASSERT(header.sensorNames[1] == "torso_imu");
+
+    std::vector<SimTK::Quaternion> quaternions(numSensors);
+    {
+        std::ofstream out{fileName, std::ios::binary};
+        SensorStreamReader::writeHeader(out, header);
+        for (int frame = 0; frame < numFrames; ++frame) {
+            for (int i = 0; i < numSensors; ++i)
+                quaternions[i] = SimTK::Rotation(0.1 * (frame + i),
+                        SimTK::ZAxis).convertRotationToQuaternion();
+            SensorStreamReader::writeFrame(
+                    out, frame / dataRate, quaternions.data(), numSensors);
+        }
+        // A trailing partial frame must be tolerated as end-of-stream.
+        const char garbage[3] = {1, 2, 3};
+        out.write(garbage, sizeof(garbage));
+    }
+
+    SensorStreamReader reader;
+    DataAdapter::OutputTables tables = reader.read(fileName);
+    const TimeSeriesTableQuaternion& quatTable =
+            reader.getOrientationsTable(tables);
+    ASSERT(quatTable.getNumRows() == size_t(numFrames));
+    ASSERT(quatTable.getNumColumns() == size_t(numSensors));
+    ASSERT(quatTable.getColumnLabels() == header.sensorNames);
+    std::string rateString = quatTable.getTableMetaData()
+            .getValueForKey("DataRate").getValue<std::string>();
+    ASSERT_EQUAL(std::stod(rateString), dataRate, tolerance);
+    for (int frame = 0; frame < numFrames; ++frame) {
+        ASSERT_EQUAL(quatTable.getIndependentColumn()[frame],
+                frame / dataRate, SimTK::Eps);
+        for (int i = 0; i < numSensors; ++i) {
+            const SimTK::Quaternion expected = SimTK::Rotation(
+                    0.1 * (frame + i), SimTK::ZAxis)
+                    .convertRotationToQuaternion();
+            const SimTK::Quaternion& actual =
+                    quatTable.getRowAtIndex(frame)[i];
+            for (int k = 0; k < 4; ++k)
+                ASSERT_EQUAL(expected[k], actual[k], tolerance);
+        }
+    }
+    // Only orientations travel on the wire; companion tables come back empty.
+    ASSERT(reader.getLinearAccelerationsTable(tables).getNumRows() == 0);
+    ASSERT(reader.getMagneticHeadingTable(tables).getNumRows() == 0);
+    ASSERT(reader.getAngularVelocityTable(tables).getNumRows() == 0);
+}
@@ -32,12 +32,15 @@
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/Object.h>
 #include <OpenSim/Common/Set.h>
+#include <OpenSim/Common/XMLDocument.h>
 
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include "SimTKcommon.h"
 
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include "SerializableObject.h"
 #include "SerializableObject2.h"
@@ -279,6 +282,12 @@ int main()
         SerializableObject obj1;
         obj1.setName("TestObject");
         obj1.print("obj1.xml");
+
+        // The version sniff reads the document version straight off the
+        // file head, without parsing the document.
+        SimTK_TEST(XMLDocument::sniffDocumentVersion("obj1.xml") ==
+                   XMLDocument::getLatestVersion());
+        SimTK_TEST(XMLDocument::sniffDocumentVersion("noSuchFile.xml") == -1);
         SerializableObject obj1copy(obj1);
         obj1copy.setAllPropertiesUseDefault(true);
         obj1copy.set_Test_Bool_2(false);
@@ -380,6 +389,76 @@ int main()
         int notFound = objWithListProp.getProperty_list_SerializableObject().findIndexForName("Third");
         ASSERT(notFound == -1);
         SimTK_TEST_MUST_THROW(SerializableObject bad("obj1Bad.xml"));
+
+        // Deserializing inside an ObjectAllocationArena must produce the
+        // same object tree as heap allocation, and pooled objects must
+        // remain usable (and deletable) after the arena is gone.
+        SimTK_TEST(!ObjectAllocationArena::isActive());
+        Object* pooledObj = NULL;
+        {
+            ObjectAllocationArena arena;
+            SimTK_TEST(ObjectAllocationArena::isActive());
+            {
+                // nesting keeps the arena active
+                ObjectAllocationArena nested;
+                SimTK_TEST(ObjectAllocationArena::isActive());
+            }
+            SimTK_TEST(ObjectAllocationArena::isActive());
+
+            SerializableObject pooledRoundtrip("obj1.xml");
+            ASSERT(obj2 == pooledRoundtrip, __FILE__, __LINE__,
+                "arena-allocated roundtrip");
+
+            pooledObj = pooledRoundtrip.clone();
+        }
+        SimTK_TEST(!ObjectAllocationArena::isActive());
+
+        // the pooled clone outlives the arena
+        ASSERT(*pooledObj == obj2, __FILE__, __LINE__,
+            "pooled object after arena destruction");
+        delete pooledObj;
+
+        // a second arena reuses the pool
+        {
+            ObjectAllocationArena arena;
+            SerializableObject again("obj1.xml");
+            ASSERT(obj2 == again, __FILE__, __LINE__,
+                "second arena roundtrip");
+        }
+
+        // The type registry is copy-on-write: readers must be able to
+        // create instances concurrently, even while another thread is
+        // registering (replacing) types.
+        {
+            std::atomic<bool> stopWriting(false);
+            std::atomic<bool> readerFailed(false);
+            std::vector<std::thread> readers;
+            for (int t = 0; t < 4; ++t) {
+                readers.push_back(std::thread([&]() {
+                    for (int i = 0; i < 1000; ++i) {
+                        Object* instance =
+                            Object::newInstanceOfType("SerializableObject");
+                        if (instance == NULL ||
+                                instance->getConcreteClassName() !=
+                                        "SerializableObject") {
+                            readerFailed = true;
+                            return;
+                        }
+                        delete instance;
+                    }
+                }));
+            }
+            std::thread writer([&]() {
+                while (!stopWriting)
+                    Object::registerType(SerializableObject3());
+            });
+            for (unsigned t = 0; t < readers.size(); ++t)
+                readers[t].join();
+            stopWriting = true;
+            writer.join();
+            ASSERT(!readerFailed, __FILE__, __LINE__,
+                "concurrent newInstanceOfType");
+        }
     }
     catch(const std::exception& e) {
         cerr << "EXCEPTION: " << e.what() << endl;
@@ -170,6 +170,64 @@ void testStorageGetStateIndexBackwardsCompatibility() {
     // TODO: Put XML document version in Storage header.
 }
 
+void testFindIndex() {
+    Storage sto{};
+    Array<std::string> labels("", 2);
+    labels[0] = "time";
+    labels[1] = "v";
+    sto.setColumnLabels(labels);
+    // Irregular (but increasing) times so index and time do not coincide.
+    const double times[] = {0.0, 0.1, 0.15, 0.4, 0.41, 1.0, 2.5};
+    const int numRows = 7;
+    for(int i = 0; i < numRows; ++i) {
+        SimTK::Vector row(1, double(i));
+        sto.append(times[i], row);
+    }
+
+    // Before the first time and at the first time.
+    SimTK_TEST(sto.findIndex(-1.0) == 0);
+    SimTK_TEST(sto.findIndex(0.0) == 0);
+    // Exact hits and times between samples.
+    for(int i = 0; i < numRows; ++i)
+        SimTK_TEST(sto.findIndex(times[i]) == i);
+    SimTK_TEST(sto.findIndex(0.12) == 1);
+    SimTK_TEST(sto.findIndex(0.5) == 4);
+    // Past the last time.
+    SimTK_TEST(sto.findIndex(10.0) == numRows - 1);
+
+    // Hinted variant: good hints, stale-low hints (beyond the sequential
+    // scan window) and hints past the answer must all agree.
+    SimTK_TEST(sto.findIndex(3, 0.4) == 3);
+    SimTK_TEST(sto.findIndex(0, 2.5) == numRows - 1);
+    SimTK_TEST(sto.findIndex(6, 0.12) == 1);
+    SimTK_TEST(sto.findIndex(-1, 0.5) == 4);
+
+    // Empty storage.
+    Storage empty{};
+    SimTK_TEST(empty.findIndex(0.0) == -1);
+}
+
+void testConvertTableToStorage() {
+    TimeSeriesTable table{};
+    table.setColumnLabels({"v1", "v2"});
+    for(int i = 0; i < 5; ++i) {
+        SimTK::RowVector_<double> row(2);
+        row[0] = i;
+        row[1] = 10. + i;
+        table.appendRow(0.1 * i, row);
+    }
+
+    Storage sto{};
+    convertTableToStorage(&table, sto);
+    SimTK_TEST(sto.getSize() == 5);
+    SimTK_TEST(sto.getColumnLabels().size() == 3);
+    SimTK_TEST(sto.getColumnLabels()[1] == "v1");
+    for(int i = 0; i < 5; ++i) {
+        SimTK_TEST_EQ(sto.getStateVector(i)->getTime(), 0.1 * i);
+        SimTK_TEST_EQ(sto.getStateVector(i)->getData()[1], 10. + i);
+    }
+}
+
 int main() {
     SimTK_START_TEST("testStorage");
 
@@ -193,6 +251,10 @@ int main() {
 
         SimTK_SUBTEST(testStorageLegacy);
 
+        SimTK_SUBTEST(testFindIndex);
+
+        SimTK_SUBTEST(testConvertTableToStorage);
+
         SimTK_SUBTEST(testStorageGetStateIndexBackwardsCompatibility);
     SimTK_END_TEST();
 }
@@ -31,6 +31,8 @@
 //-----------------------------------------------------------------------------
 #include "XMLDocument.h"
 #include "Object.h"
+#include <cstdlib>
+#include <fstream>
 #include <functional>
 
 
@@ -247,6 +249,40 @@ updateDocumentVersion()
     assert(_documentVersion >= 10500 && _documentVersion <= LatestVersion);
 }
 //_____________________________________________________________________________
+/**
+ * Extract the Version attribute of a file's OpenSimDocument root element
+ * from the head of the file, without building a DOM.
+ */
+int XMLDocument::
+sniffDocumentVersion(const std::string& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file)
+        return -1;
+    // The OpenSimDocument root element opens within the first few hundred
+    // bytes of any file we write; 4 KB leaves room for license comments.
+    char head[4096];
+    file.read(head, sizeof(head));
+    const std::string buffer(head, (size_t)file.gcount());
+
+    const std::string::size_type root = buffer.find("<OpenSimDocument");
+    if (root == std::string::npos)
+        return -1;
+    const std::string::size_type tagEnd = buffer.find('>', root);
+    std::string::size_type pos = buffer.find("Version", root);
+    if (pos == std::string::npos || (tagEnd != std::string::npos
+                                     && pos > tagEnd))
+        return -1;
+    pos = buffer.find_first_of("\"'", pos);
+    if (pos == std::string::npos)
+        return -1;
+    const std::string::size_type end =
+        buffer.find_first_not_of("0123456789", ++pos);
+    if (end == pos || end == std::string::npos)
+        return -1;
+    return atoi(buffer.substr(pos, end - pos).c_str());
+}
+//_____________________________________________________________________________
 /**
  * getRootDataElement returns a pointer to the real root node that contains objects 
  * works as a wrapper to get around the new root node <OpenSimDocument introduced in 1.6
@@ -89,6 +89,15 @@ public:
     static const int& getLatestVersion() { return LatestVersion; };
     static void renameChildNode(SimTK::Xml::Element& aNode, std::string oldElementName, std::string newElementName);
     const int& getDocumentVersion() const { return _documentVersion; };
+    /** Peek at an XML file's document version without parsing it: read the
+        head of the file and extract the Version attribute of its
+        OpenSimDocument root element. Returns -1 when the version cannot be
+        determined this cheaply (missing file, non-XML content, a pre-1.6
+        file with no OpenSimDocument element, or an unusually long
+        preamble); fall back to a full parse in that case. Comparing the
+        result against getLatestVersion() lets batch converters skip the
+        migration machinery for files that are already current. */
+    static int sniffDocumentVersion(const std::string& fileName);
     static void getVersionAsString(const int aVersion, std::string& aString); 
     SimTK::Xml::Element getRootDataElement();
     bool isEqualTo(XMLDocument& aOtherDocument, double toleranceForDoubles=1e-6, 
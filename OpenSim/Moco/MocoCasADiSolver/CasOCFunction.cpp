@@ -77,6 +77,39 @@ casadi::Sparsity Function::get_jacobian_sparsity() const {
     using casadi::DM;
     using casadi::Slice;
 
+    if (m_fullPointsForSparsityDetection->empty()) {
+        // No points for numerical sparsity detection were provided; declare
+        // only the block sparsity known from the problem structure: columns
+        // for the Lagrange multipliers and/or the generalized accelerations
+        // are structural zeros if this term's stage dependency guarantees
+        // they cannot affect the outputs.
+        std::vector<casadi::Sparsity> blocks;
+        const casadi_int numRows = this->nnz_out();
+        const casadi_int numAccels = m_casProblem->getNumAccelerations();
+        for (casadi_int iin = 0; iin < this->n_in(); ++iin) {
+            const std::string inputName = this->name_in(iin);
+            const casadi_int numCols = this->size1_in(iin);
+            const bool multipliersInput =
+                    inputName.find("multipliers") != std::string::npos;
+            const bool derivativesInput =
+                    inputName.find("derivatives") != std::string::npos;
+            if (multipliersInput && !m_dependsOnMultipliers) {
+                blocks.push_back(casadi::Sparsity(numRows, numCols));
+            } else if (derivativesInput && !m_dependsOnAccelerations &&
+                       numAccels) {
+                // Only the leading entries of the derivatives input hold the
+                // generalized accelerations; the remaining entries hold the
+                // auxiliary derivative variables, which may affect any term.
+                blocks.push_back(casadi::Sparsity(numRows, numAccels));
+                blocks.push_back(
+                        casadi::Sparsity::dense(numRows, numCols - numAccels));
+            } else {
+                blocks.push_back(casadi::Sparsity::dense(numRows, numCols));
+            }
+        }
+        return casadi::Sparsity::horzcat(blocks);
+    }
+
     auto function = [this](const casadi::DM& x, casadi::DM& y) {
         // Split input into separate DMs.
         std::vector<casadi::DM> in(this->n_in());
@@ -142,11 +175,11 @@ VectorDM PathConstraint::eval(const VectorDM& args) const {
     return out;
 }
 
-VectorDM CostIntegrand::eval(const VectorDM& args) const {
+VectorDM CostIntegrands::eval(const VectorDM& args) const {
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
-    VectorDM out{casadi::DM(casadi::Sparsity::scalar())};
-    m_casProblem->calcCostIntegrand(m_index, input, *out[0].ptr());
+    VectorDM out{casadi::DM(casadi::Sparsity::dense(m_numIntegrands, 1))};
+    m_casProblem->calcCostIntegrands(input, out.at(0));
     return out;
 }
 
@@ -324,11 +357,148 @@ VectorDM MultibodySystemImplicit<CalcKCErrors>::eval(
         out[i] = casadi::DM(sparsity_out(i));
     }
 
-    Problem::MultibodySystemImplicitOutput output{out[0], out[1], out[2], 
+    Problem::MultibodySystemImplicitOutput output{out[0], out[1], out[2],
             out[3]};
     m_casProblem->calcMultibodySystemImplicit(input, CalcKCErrors, output);
     return out;
 }
 
+namespace {
+
+/// Forward-mode derivative callback for MultibodySystemImplicit. Following
+/// CasADi's convention for derivative functions, the inputs are the parent's
+/// inputs, the parent's nominal outputs (unused), and one seed per parent
+/// input holding one column per forward direction; the outputs are the
+/// forward sensitivities of the parent's outputs.
+class MultibodySystemImplicitForward : public casadi::Callback {
+public:
+    MultibodySystemImplicitForward(const std::string& name,
+            const CasOC::Function* parent, const Problem* casProblem,
+            casadi_int nfwd, const casadi::Dict& opts)
+            : m_parent(parent), m_casProblem(casProblem), m_nfwd(nfwd) {
+        construct(name, opts);
+    }
+    casadi_int get_n_in() override {
+        return 2 * m_parent->n_in() + m_parent->n_out();
+    }
+    casadi_int get_n_out() override { return m_parent->n_out(); }
+    casadi::Sparsity get_sparsity_in(casadi_int i) override {
+        const casadi_int numIn = m_parent->n_in();
+        const casadi_int numOut = m_parent->n_out();
+        if (i < numIn) {
+            return m_parent->sparsity_in(i);
+        } else if (i < numIn + numOut) {
+            return m_parent->sparsity_out(i - numIn);
+        } else {
+            return casadi::Sparsity::dense(
+                    m_parent->size1_in(i - numIn - numOut), m_nfwd);
+        }
+    }
+    casadi::Sparsity get_sparsity_out(casadi_int i) override {
+        return casadi::Sparsity::dense(m_parent->size1_out(i), m_nfwd);
+    }
+    VectorDM eval(const VectorDM& args) const override {
+        using casadi::DM;
+        using casadi::Slice;
+        const casadi_int numIn = m_parent->n_in();
+        const casadi_int numOut = m_parent->n_out();
+        const int numAccels = m_casProblem->getNumAccelerations();
+        // The index of the parent's "derivatives" input, whose leading
+        // entries are the generalized accelerations.
+        const casadi_int idxDerivatives = 4;
+
+        const VectorDM nominal(args.begin(), args.begin() + numIn);
+
+        VectorDM out((int)numOut);
+        for (casadi_int iout = 0; iout < numOut; ++iout) {
+            out[iout] = DM(sparsity_out(iout));
+        }
+
+        VectorDM seeds((int)numIn);
+        for (casadi_int d = 0; d < m_nfwd; ++d) {
+            // Extract this direction's seeds, zeroing the acceleration
+            // portion, which is handled exactly below.
+            double seedNormNoAccel = 0;
+            for (casadi_int iin = 0; iin < numIn; ++iin) {
+                seeds[iin] = args.at(numIn + numOut + iin)(Slice(), d);
+                if (iin == idxDerivatives && numAccels) {
+                    seeds[iin](Slice(0, numAccels)) = 0;
+                }
+                const double norm = DM::norm_inf(seeds[iin]).scalar();
+                if (norm > seedNormNoAccel) seedNormNoAccel = norm;
+            }
+
+            // Central finite differences along the remaining seed direction,
+            // matching what CasADi's enable_fd would perform.
+            if (seedNormNoAccel) {
+                const double step = 1e-5 /
+                        (seedNormNoAccel > 1 ? seedNormNoAccel : 1.0);
+                VectorDM perturbed((int)numIn);
+                for (casadi_int iin = 0; iin < numIn; ++iin) {
+                    perturbed[iin] = nominal[iin] + step * seeds[iin];
+                }
+                const VectorDM outPlus = m_parent->eval(perturbed);
+                for (casadi_int iin = 0; iin < numIn; ++iin) {
+                    perturbed[iin] = nominal[iin] - step * seeds[iin];
+                }
+                const VectorDM outMinus = m_parent->eval(perturbed);
+                for (casadi_int iout = 0; iout < numOut; ++iout) {
+                    if (!out[iout].numel()) continue;
+                    out[iout](Slice(), d) =
+                            (outPlus.at(iout) - outMinus.at(iout)) /
+                            (2 * step);
+                }
+            }
+
+            // The multibody residuals are affine in the accelerations with
+            // Jacobian M(q): add the exact contribution M(q) * seed.
+            if (numAccels) {
+                const DM accelSeed =
+                        args.at(numIn + numOut + idxDerivatives)(
+                                Slice(0, numAccels), d);
+                if (DM::norm_inf(accelSeed).scalar() != 0) {
+                    DM product = DM::zeros(
+                            m_casProblem->getNumMultibodyDynamicsEquations(),
+                            1);
+                    m_casProblem->calcMassMatrixProduct(nominal.at(0).scalar(),
+                            nominal.at(1), nominal.at(5), accelSeed, product);
+                    out[0](Slice(), d) = out[0](Slice(), d) + product;
+                }
+            }
+        }
+        return out;
+    }
+
+private:
+    const CasOC::Function* m_parent;
+    const Problem* m_casProblem;
+    casadi_int m_nfwd;
+};
+
+} // namespace
+
+template <bool CalcKCErrors>
+bool MultibodySystemImplicit<CalcKCErrors>::has_forward(casadi_int) const {
+    // The forward callback pays off only when acceleration variables exist
+    // (i.e., kinematics are not prescribed); otherwise, let CasADi fall back
+    // to its own finite differences (enable_fd).
+    return m_casProblem->getNumAccelerations() > 0;
+}
+
+template <bool CalcKCErrors>
+casadi::Function MultibodySystemImplicit<CalcKCErrors>::get_forward(
+        casadi_int nfwd, const std::string& name,
+        const std::vector<std::string>& /*inames*/,
+        const std::vector<std::string>& /*onames*/,
+        const casadi::Dict& opts) const {
+    // Let CasADi differentiate the forward callback itself by finite
+    // differences if higher-order derivatives are ever requested.
+    casadi::Dict fwdOpts = opts;
+    fwdOpts["enable_fd"] = true;
+    m_forwardCallbacks.emplace_back(new MultibodySystemImplicitForward(
+            name, this, m_casProblem, nfwd, fwdOpts));
+    return *m_forwardCallbacks.back();
+}
+
 template class CasOC::MultibodySystemImplicit<false>;
 template class CasOC::MultibodySystemImplicit<true>;
@@ -20,6 +20,8 @@
 
 #include "CasOCIterate.h"
 
+#include <memory>
+
 #include <OpenSim/Common/Exception.h>
 
 namespace CasOC {
@@ -59,13 +61,24 @@ public:
     }
     casadi::Sparsity get_sparsity_in(casadi_int i) override;
     bool has_jacobian_sparsity() const override {
-        return !m_fullPointsForSparsityDetection->empty();
+        return !m_fullPointsForSparsityDetection->empty() ||
+               !m_dependsOnMultipliers || !m_dependsOnAccelerations;
     }
     casadi::Sparsity get_jacobian_sparsity() const override;
 
 protected:
     const Problem* m_casProblem;
 
+    /// Structural dependencies known a priori from the term's stage
+    /// dependency: a term whose stage dependency is below
+    /// SimTK::Stage::Dynamics cannot depend on the Lagrange multipliers, and a
+    /// term below SimTK::Stage::Acceleration cannot depend on the generalized
+    /// accelerations. When either flag is false, get_jacobian_sparsity()
+    /// declares the corresponding columns as structural zeros even without
+    /// points for numerical sparsity detection.
+    bool m_dependsOnMultipliers = true;
+    bool m_dependsOnAccelerations = true;
+
 private:
     /// Here, "point" refers to a vector of all variables in the optimization
     /// problem.
@@ -98,9 +111,13 @@ public:
     void constructFunction(const Problem* casProblem, const std::string& name,
             int index, int numEquations, const std::string& finiteDiffScheme,
             std::shared_ptr<const std::vector<VariablesDM>>
-                    pointsForSparsityDetection) {
+                    pointsForSparsityDetection,
+            bool dependsOnMultipliers = true,
+            bool dependsOnAccelerations = true) {
         m_index = index;
         m_numEquations = numEquations;
+        m_dependsOnMultipliers = dependsOnMultipliers;
+        m_dependsOnAccelerations = dependsOnAccelerations;
         Function::constructFunction(
                 casProblem, name, finiteDiffScheme, pointsForSparsityDetection);
     }
@@ -129,8 +146,12 @@ public:
     void constructFunction(const Problem* casProblem, const std::string& name,
             int index, const std::string& finiteDiffScheme,
             std::shared_ptr<const std::vector<VariablesDM>>
-                    pointsForSparsityDetection) {
+                    pointsForSparsityDetection,
+            bool dependsOnMultipliers = true,
+            bool dependsOnAccelerations = true) {
         m_index = index;
+        m_dependsOnMultipliers = dependsOnMultipliers;
+        m_dependsOnAccelerations = dependsOnAccelerations;
         Function::constructFunction(
                 casProblem, name, finiteDiffScheme, pointsForSparsityDetection);
     }
@@ -152,9 +173,41 @@ protected:
     int m_index = -1;
 };
 
-class CostIntegrand : public Integrand {
+/// This invokes CasOC::Problem::calcCostIntegrands(), which computes the
+/// integrands of *all* integral costs at once. Fusing the costs into a single
+/// function means the model's state is converted and realized once per grid
+/// point for all costs, rather than once per cost per grid point.
+class CostIntegrands : public Function {
 public:
+    void constructFunction(const Problem* casProblem, const std::string& name,
+            int numIntegrands, const std::string& finiteDiffScheme,
+            std::shared_ptr<const std::vector<VariablesDM>>
+                    pointsForSparsityDetection,
+            bool dependsOnMultipliers = true,
+            bool dependsOnAccelerations = true) {
+        m_numIntegrands = numIntegrands;
+        m_dependsOnMultipliers = dependsOnMultipliers;
+        m_dependsOnAccelerations = dependsOnAccelerations;
+        Function::constructFunction(
+                casProblem, name, finiteDiffScheme, pointsForSparsityDetection);
+    }
+    casadi_int get_n_out() override final { return 1; }
+    std::string get_name_out(casadi_int i) override final {
+        switch (i) {
+        case 0: return "integrands";
+        default: OPENSIM_THROW(OpenSim::Exception, "Internal error.");
+        }
+    }
+    casadi::Sparsity get_sparsity_out(casadi_int i) override final {
+        if (i == 0)
+            return casadi::Sparsity::dense(m_numIntegrands, 1);
+        else
+            return casadi::Sparsity(0, 0);
+    }
     VectorDM eval(const VectorDM& args) const override;
+
+protected:
+    int m_numIntegrands = -1;
 };
 
 class EndpointConstraintIntegrand : public Integrand {
@@ -171,9 +224,13 @@ public:
             int numEquations,
             const std::string& finiteDiffScheme,
             std::shared_ptr<const std::vector<VariablesDM>>
-            pointsForSparsityDetection) {
+            pointsForSparsityDetection,
+            bool dependsOnMultipliers = true,
+            bool dependsOnAccelerations = true) {
         m_index = index;
         m_numEquations = numEquations;
+        m_dependsOnMultipliers = dependsOnMultipliers;
+        m_dependsOnAccelerations = dependsOnAccelerations;
         Function::constructFunction(
                 casProblem, name, finiteDiffScheme, pointsForSparsityDetection);
     }
@@ -300,6 +357,23 @@ public:
 template <bool CalcKCErrors>
 class MultibodySystemImplicit : public Function {
     casadi_int get_n_out() override final { return 4; }
+    /// The multibody residuals are affine in the generalized accelerations
+    /// with Jacobian M(q), so we supply a forward-mode (directional
+    /// derivative) callback: seed directions that lie purely along the
+    /// accelerations are handled exactly with Simbody's mass matrix operator
+    /// (Problem::calcMassMatrixProduct()), avoiding any model realizations;
+    /// all other directions use central finite differences, as CasADi's
+    /// enable_fd would. With the Jacobian sparsity provided by this class,
+    /// CasADi's graph coloring produces one pure-acceleration seed per
+    /// generalized speed, so the dense M(q) block of the Jacobian is computed
+    /// exactly and without finite-difference evaluations.
+    /// We assume the auxiliary dynamics and residuals do not depend on the
+    /// generalized accelerations, which holds for OpenSim's muscle models.
+    bool has_forward(casadi_int nfwd) const override final;
+    casadi::Function get_forward(casadi_int nfwd, const std::string& name,
+            const std::vector<std::string>& inames,
+            const std::vector<std::string>& onames,
+            const casadi::Dict& opts) const override final;
     std::string get_name_out(casadi_int i) override final {
         switch (i) {
         case 0: return "multibody_residuals";
@@ -311,6 +385,11 @@ class MultibodySystemImplicit : public Function {
     }
     casadi::Sparsity get_sparsity_out(casadi_int i) override final;
     VectorDM eval(const VectorDM& args) const override;
+
+    /// CasADi requires the Callback object backing a derivative Function to
+    /// outlive the returned Function handle, so we own the forward callbacks
+    /// created by get_forward() here (one per requested number of seeds).
+    mutable std::vector<std::unique_ptr<casadi::Callback>> m_forwardCallbacks;
 };
 
 } // namespace CasOC
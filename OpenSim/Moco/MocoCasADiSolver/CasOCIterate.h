@@ -62,6 +62,13 @@ struct Iterate {
     std::vector<std::string> derivative_names;
     std::vector<std::string> parameter_names;
     int iteration = -1;
+    /// Optional warm-start values for the NLP multipliers associated with the
+    /// variable bounds (lam_x) and constraints (lam_g), typically taken from
+    /// the Solution of a previous, nearly identical problem. These are used
+    /// only if their lengths match the NLP created during transcription (the
+    /// multipliers cannot be resampled onto a different mesh).
+    casadi::DM nlp_multipliers_x;
+    casadi::DM nlp_multipliers_g;
     /// Return a new iterate in which the data is resampled at the times in
     /// newTimes.
     Iterate resample(const casadi::DM& newTimes) const;
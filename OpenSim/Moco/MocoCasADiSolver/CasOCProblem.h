@@ -82,29 +82,44 @@ struct ParameterInfo {
 
 struct EndpointInfo {
     EndpointInfo(std::string name, int num_outputs,
-            std::unique_ptr<Integrand> ifunc, std::unique_ptr<Endpoint> efunc)
+            std::unique_ptr<Integrand> ifunc, std::unique_ptr<Endpoint> efunc,
+            bool depends_on_multipliers, bool depends_on_accelerations)
             : name(std::move(name)), num_outputs(num_outputs),
               integrand_function(std::move(ifunc)),
-              endpoint_function(std::move(efunc)) {}
+              endpoint_function(std::move(efunc)),
+              depends_on_multipliers(depends_on_multipliers),
+              depends_on_accelerations(depends_on_accelerations) {}
     std::string name;
     int num_outputs;
+    // For costs, this is null: all integral costs share the fused
+    // CostIntegrands function (see Problem::getCostIntegrandsFunction()) and
+    // num_integrals records whether this term has an integral.
     std::unique_ptr<Integrand> integrand_function;
     std::unique_ptr<Endpoint> endpoint_function;
+    int num_integrals = 0;
+    // Structural dependencies derived from the term's stage dependency; used
+    // to declare a priori Jacobian sparsity (see CasOC::Function).
+    bool depends_on_multipliers = true;
+    bool depends_on_accelerations = true;
 };
 
 struct CostInfo : EndpointInfo {
     CostInfo(std::string name, int num_outputs,
-            std::unique_ptr<Integrand> ifunc, std::unique_ptr<Endpoint> efunc)
+            std::unique_ptr<Integrand> ifunc, std::unique_ptr<Endpoint> efunc,
+            bool depends_on_multipliers, bool depends_on_accelerations)
             : EndpointInfo(std::move(name), num_outputs, std::move(ifunc),
-                      std::move(efunc)) {}
+                      std::move(efunc), depends_on_multipliers,
+                      depends_on_accelerations) {}
 };
 
 struct EndpointConstraintInfo : EndpointInfo {
     EndpointConstraintInfo(std::string name, int num_outputs,
             std::unique_ptr<Integrand> ifunc, std::unique_ptr<Endpoint> efunc,
-            casadi::DM lowerBounds, casadi::DM upperBounds)
+            casadi::DM lowerBounds, casadi::DM upperBounds,
+            bool depends_on_multipliers, bool depends_on_accelerations)
             : EndpointInfo(std::move(name), num_outputs, std::move(ifunc),
-                      std::move(efunc)),
+                      std::move(efunc), depends_on_multipliers,
+                      depends_on_accelerations),
               lowerBounds(std::move(lowerBounds)),
               upperBounds(std::move(upperBounds)) {}
     // The number of rows in these bounds must be num_outputs.
@@ -120,6 +135,10 @@ struct PathConstraintInfo {
     casadi::DM lowerBounds;
     casadi::DM upperBounds;
     std::unique_ptr<PathConstraint> function;
+    // Structural dependencies derived from the constraint's stage dependency;
+    // used to declare a priori Jacobian sparsity (see CasOC::Function).
+    bool depends_on_multipliers = true;
+    bool depends_on_accelerations = true;
 };
 
 class Solver;
@@ -244,21 +263,28 @@ protected:
     void addParameter(std::string name, Bounds bounds) {
         m_paramInfos.push_back({std::move(name), std::move(bounds)});
     }
-    /// Add a cost term to the problem.
-    void addCost(std::string name, int numIntegrals, int numOutputs) {
+    /// Add a cost term to the problem. The dependsOnMultipliers and
+    /// dependsOnAccelerations flags declare whether the cost may depend on
+    /// the Lagrange multipliers and the generalized accelerations; passing
+    /// false allows declaring structural Jacobian sparsity.
+    void addCost(std::string name, int numIntegrals, int numOutputs,
+            bool dependsOnMultipliers = true,
+            bool dependsOnAccelerations = true) {
         OPENSIM_THROW_IF(numIntegrals < 0 || numIntegrals > 1,
                 OpenSim::Exception, "numIntegrals must be 0 or 1.");
-        std::unique_ptr<CostIntegrand> integrand_function;
-        if (numIntegrals) {
-            integrand_function = OpenSim::make_unique<CostIntegrand>();
-        }
-        m_costInfos.emplace_back(std::move(name), numOutputs,
-                std::move(integrand_function),
-                OpenSim::make_unique<Cost>());
-    }
-    /// Add an endpoint constraint to the problem.
+        // Integral costs share the fused CostIntegrands function created in
+        // initialize(), so no per-cost integrand function is created here.
+        m_costInfos.emplace_back(std::move(name), numOutputs, nullptr,
+                OpenSim::make_unique<Cost>(), dependsOnMultipliers,
+                dependsOnAccelerations);
+        m_costInfos.back().num_integrals = numIntegrals;
+    }
+    /// Add an endpoint constraint to the problem. See addCost() for the
+    /// meaning of dependsOnMultipliers and dependsOnAccelerations.
     void addEndpointConstraint(
-            std::string name, int numIntegrals, std::vector<Bounds> bounds) {
+            std::string name, int numIntegrals, std::vector<Bounds> bounds,
+            bool dependsOnMultipliers = true,
+            bool dependsOnAccelerations = true) {
         OPENSIM_THROW_IF(numIntegrals < 0 || numIntegrals > 1,
                 OpenSim::Exception, "numIntegrals must be 0 or 1.");
         std::unique_ptr<EndpointConstraintIntegrand> integrand_function;
@@ -275,10 +301,15 @@ protected:
         m_endpointConstraintInfos.emplace_back(std::move(name),
                 (int)bounds.size(), std::move(integrand_function),
                 OpenSim::make_unique<EndpointConstraint>(), std::move(lower),
-                std::move(upper));
+                std::move(upper), dependsOnMultipliers,
+                dependsOnAccelerations);
     }
     /// The size of bounds must match the number of outputs in the function.
-    void addPathConstraint(std::string name, std::vector<Bounds> bounds) {
+    /// See addCost() for the meaning of dependsOnMultipliers and
+    /// dependsOnAccelerations.
+    void addPathConstraint(std::string name, std::vector<Bounds> bounds,
+            bool dependsOnMultipliers = true,
+            bool dependsOnAccelerations = true) {
         casadi::DM lower(bounds.size(), 1);
         casadi::DM upper(bounds.size(), 1);
         for (int ibound = 0; ibound < (int)bounds.size(); ++ibound) {
@@ -286,7 +317,8 @@ protected:
             upper(ibound, 0) = bounds[ibound].upper;
         }
         m_pathInfos.push_back({std::move(name), std::move(lower),
-                std::move(upper), OpenSim::make_unique<PathConstraint>()});
+                std::move(upper), OpenSim::make_unique<PathConstraint>(),
+                dependsOnMultipliers, dependsOnAccelerations});
     }
     void setDynamicsMode(std::string dynamicsMode) {
         OPENSIM_THROW_IF(
@@ -316,9 +348,21 @@ public:
             const casadi::DM& multibody_states, const casadi::DM& slacks,
             const casadi::DM& parameters,
             casadi::DM& velocity_correction) const = 0;
+    /// Compute the product of the system mass matrix M(q) with the provided
+    /// vector of generalized accelerations. The implicit multibody residuals
+    /// are affine in the accelerations with Jacobian M(q), so this operator
+    /// provides the exact directional derivative of the residuals along
+    /// acceleration seed directions (see MultibodySystemImplicit).
+    virtual void calcMassMatrixProduct(const double& time,
+            const casadi::DM& states, const casadi::DM& parameters,
+            const casadi::DM& accelerations, casadi::DM& product) const = 0;
 
-    virtual void calcCostIntegrand(int /*costIndex*/,
-            const ContinuousInput& /*input*/, double& /*integrand*/) const {}
+    /// Compute the integrands of all integral costs at a single point: one
+    /// entry of `integrands` per index in getIntegralCostIndices(), in order.
+    /// Fusing the costs into one evaluation lets implementations convert and
+    /// realize the model's state once per point for all costs.
+    virtual void calcCostIntegrands(const ContinuousInput& /*input*/,
+            casadi::DM& /*integrands*/) const {}
     virtual void calcCost(int /*costIndex*/, const CostInput& /*input*/,
             casadi::DM& /*cost*/) const {}
     virtual void calcEndpointConstraintIntegrand(int /*index*/,
@@ -390,14 +434,39 @@ public:
                 costInfo.endpoint_function->constructFunction(this,
                         "cost_" + costInfo.name + "_endpoint", index,
                         costInfo.num_outputs, finiteDiffScheme,
-                        pointsForSparsityDetection);
-                if (costInfo.integrand_function) {
-                    costInfo.integrand_function->constructFunction(this,
-                            "cost_" + costInfo.name + "_integrand", index,
-                            finiteDiffScheme, pointsForSparsityDetection);
+                        pointsForSparsityDetection,
+                        costInfo.depends_on_multipliers,
+                        costInfo.depends_on_accelerations);
+                ++index;
+            }
+        }
+        {
+            // Fuse the integrands of all integral costs into a single function
+            // so the model's state is converted and realized once per grid
+            // point for all costs. The fused function's structural
+            // dependencies are the union of those of the fused costs.
+            std::vector<int> integralCostIndices;
+            bool dependsOnMultipliers = false;
+            bool dependsOnAccelerations = false;
+            int index = 0;
+            for (const auto& costInfo : mutThis->m_costInfos) {
+                if (costInfo.num_integrals) {
+                    integralCostIndices.push_back(index);
+                    dependsOnMultipliers |= costInfo.depends_on_multipliers;
+                    dependsOnAccelerations |= costInfo.depends_on_accelerations;
                 }
                 ++index;
             }
+            mutThis->m_integralCostIndices = std::move(integralCostIndices);
+            if (!mutThis->m_integralCostIndices.empty()) {
+                mutThis->m_costIntegrandsFunction =
+                        OpenSim::make_unique<CostIntegrands>();
+                mutThis->m_costIntegrandsFunction->constructFunction(this,
+                        "cost_integrands",
+                        (int)mutThis->m_integralCostIndices.size(),
+                        finiteDiffScheme, pointsForSparsityDetection,
+                        dependsOnMultipliers, dependsOnAccelerations);
+            }
         }
         {
             int index = 0;
@@ -405,11 +474,14 @@ public:
                 info.endpoint_function->constructFunction(this,
                         "endpoint_constraint_" + info.name + "_endpoint", index,
                         info.num_outputs, finiteDiffScheme,
-                        pointsForSparsityDetection);
+                        pointsForSparsityDetection, info.depends_on_multipliers,
+                        info.depends_on_accelerations);
                 if (info.integrand_function) {
                     info.integrand_function->constructFunction(this,
                             "endpoint_constraint_" + info.name + "_integrand", index,
-                            finiteDiffScheme, pointsForSparsityDetection);
+                            finiteDiffScheme, pointsForSparsityDetection,
+                            info.depends_on_multipliers,
+                            info.depends_on_accelerations);
                 }
                 ++index;
             }
@@ -420,7 +492,9 @@ public:
                 pathInfo.function->constructFunction(this,
                         "path_constraint_" + pathInfo.name, index,
                         (int)pathInfo.lowerBounds.size1(), finiteDiffScheme,
-                        pointsForSparsityDetection);
+                        pointsForSparsityDetection,
+                        pathInfo.depends_on_multipliers,
+                        pathInfo.depends_on_accelerations);
                 ++index;
             }
         }
@@ -560,6 +634,16 @@ public:
         return m_paramInfos;
     }
     const std::vector<CostInfo>& getCostInfos() const { return m_costInfos; }
+    /// The indices (into getCostInfos()) of the costs with an integral, in the
+    /// order their integrands appear in getCostIntegrandsFunction()'s output.
+    const std::vector<int>& getIntegralCostIndices() const {
+        return m_integralCostIndices;
+    }
+    /// The fused function computing the integrands of all integral costs;
+    /// only valid if getIntegralCostIndices() is non-empty.
+    const CostIntegrands& getCostIntegrandsFunction() const {
+        return *m_costIntegrandsFunction;
+    }
     const std::vector<EndpointConstraintInfo>&
     getEndpointConstraintInfos() const {
         return m_endpointConstraintInfos;
@@ -624,6 +708,8 @@ private:
     std::vector<SlackInfo> m_slackInfos;
     std::vector<ParameterInfo> m_paramInfos;
     std::vector<CostInfo> m_costInfos;
+    std::vector<int> m_integralCostIndices;
+    std::unique_ptr<CostIntegrands> m_costIntegrandsFunction;
     std::vector<EndpointConstraintInfo> m_endpointConstraintInfos;
     std::vector<PathConstraintInfo> m_pathInfos;
     std::unique_ptr<MultibodySystemExplicit<true>> m_multibodyFunc;
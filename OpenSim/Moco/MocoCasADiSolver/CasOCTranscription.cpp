@@ -515,21 +515,30 @@ void Transcription::setObjectiveAndEndpointConstraints() {
     }
     m_objectiveTerms = MX::zeros((int)m_objectiveTermNames.size(), 1);
 
+    // Here, we include evaluations of the integral cost integrands into the
+    // symbolic expression graph for the integral costs. We are *not*
+    // numerically evaluating the integrands here--that occurs when the
+    // function created by casadi::nlpsol() is evaluated. The integrands of
+    // all integral costs are computed by a single fused function, with one
+    // output row per integral cost.
+    MX costIntegrandsTraj;
+    if (!m_problem.getIntegralCostIndices().empty()) {
+        costIntegrandsTraj =
+                evalOnTrajectory(m_problem.getCostIntegrandsFunction(),
+                        {states, controls, multipliers, derivatives},
+                        m_gridIndices)
+                        .at(0);
+    }
+
     int iterm = 0;
+    int iintegral = 0;
     for (int ic = 0; ic < m_problem.getNumCosts(); ++ic) {
         const auto& info = m_problem.getCostInfos()[ic];
 
         MX integral;
-        if (info.integrand_function) {
-            // Here, we include evaluations of the integral cost
-            // integrand into the symbolic expression graph for the integral
-            // cost. We are *not* numerically evaluating the integral cost
-            // integrand here--that occurs when the function by casadi::nlpsol()
-            // is evaluated.
-            MX integrandTraj = evalOnTrajectory(*info.integrand_function,
-                    {states, controls, multipliers, derivatives}, m_gridIndices)
-                    .at(0);
-
+        if (info.num_integrals) {
+            MX integrandTraj = costIntegrandsTraj(iintegral, Slice());
+            ++iintegral;
             integral = m_duration * dot(quadCoeffs.T(), integrandTraj);
         } else {
             integral = MX::nan(1, 1);
@@ -727,12 +736,21 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     // Run the optimization (evaluate the CasADi NLP function).
     // --------------------------------------------------------
     // The inputs and outputs of nlpFunc are numeric (casadi::DM).
-    const casadi::DMDict nlpResult = nlpFunc(casadi::DMDict{
-                    {"x0", flattenVariables(scaleVariables(guess.variables))},
-                    {"lbx", flattenVariables(scaleVariables(m_lowerBounds))},
-                    {"ubx", flattenVariables(scaleVariables(m_upperBounds))},
-                    {"lbg", flattenConstraints(m_constraintsLowerBounds)},
-                    {"ubg", flattenConstraints(m_constraintsUpperBounds)}});
+    casadi::DMDict nlpInput{
+            {"x0", flattenVariables(scaleVariables(guess.variables))},
+            {"lbx", flattenVariables(scaleVariables(m_lowerBounds))},
+            {"ubx", flattenVariables(scaleVariables(m_upperBounds))},
+            {"lbg", flattenConstraints(m_constraintsLowerBounds)},
+            {"ubg", flattenConstraints(m_constraintsUpperBounds)}};
+    // Warm-start the NLP multipliers if the guess provides them and they
+    // match this transcription (multipliers from a different mesh cannot be
+    // resampled, so we silently ignore mismatched lengths).
+    if (guessOrig.nlp_multipliers_x.numel() == numVariables &&
+            guessOrig.nlp_multipliers_g.numel() == numConstraints) {
+        nlpInput.emplace("lam_x0", guessOrig.nlp_multipliers_x);
+        nlpInput.emplace("lam_g0", guessOrig.nlp_multipliers_g);
+    }
+    const casadi::DMDict nlpResult = nlpFunc(nlpInput);
 
     // Create a CasOC::Solution.
     // -------------------------
@@ -750,6 +768,10 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     solution.times = createTimes(
             solution.variables[initial_time], solution.variables[final_time]);
     solution.stats = nlpFunc.stats();
+    // Save the NLP multipliers so a subsequent, nearly identical problem can
+    // warm-start from this solution.
+    solution.nlp_multipliers_x = nlpResult.at("lam_x");
+    solution.nlp_multipliers_g = nlpResult.at("lam_g");
 
     // Print breakdown of objective.
     printObjectiveBreakdown(solution, objectiveOut[0]);
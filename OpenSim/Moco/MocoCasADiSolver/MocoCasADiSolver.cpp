@@ -25,6 +25,7 @@
     #include "MocoCasOCProblem.h"
     #include <casadi/casadi.hpp>
 
+    #include <OpenSim/Common/CommonUtilities.h>
     #include <OpenSim/Common/Stopwatch.h>
 
     using casadi::Callback;
@@ -54,6 +55,9 @@ void MocoCasADiSolver::constructProperties() {
     constructProperty_implicit_auxiliary_derivatives_weight(1.0);
 
     constructProperty_enforce_path_constraint_midpoints(false);
+
+    constructProperty_reuse_nlp_multipliers(false);
+    constructProperty_reuse_casadi_problem(false);
 }
 
 bool MocoCasADiSolver::isAvailable() {
@@ -340,7 +344,7 @@ std::unique_ptr<CasOC::Solver> MocoCasADiSolver::createCasOCSolver(
 #endif
 }
 
-MocoSolution MocoCasADiSolver::solveImpl() const {
+MocoSolution MocoCasADiSolver::solveTranscriptionImpl() const {
 #ifdef OPENSIM_WITH_CASADI
     const Stopwatch stopwatch;
 
@@ -351,7 +355,26 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
         log_info(std::string(72, '-'));
         getProblemRep().printDescription();
     }
-    auto casProblem = createCasOCProblem();
+    std::shared_ptr<const MocoCasOCProblem> casProblem;
+    if (get_reuse_casadi_problem()) {
+        // The key captures everything the converted problem depends on: the
+        // MocoProblem (including the model) and this solver's settings.
+        // Programmatic (non-property) changes to custom goals or constraints
+        // are not captured; see the property's description.
+        const std::string key = getProblem().dump() + dump();
+        if (m_cachedCasProblem && m_cachedCasProblemKey == key) {
+            log_info("MocoCasADiSolver: reusing the CasADi problem from the "
+                     "previous solve.");
+        } else {
+            m_cachedCasProblem = std::shared_ptr<const MocoCasOCProblem>(
+                    createCasOCProblem());
+            m_cachedCasProblemKey = key;
+        }
+        casProblem = m_cachedCasProblem;
+    } else {
+        casProblem = std::shared_ptr<const MocoCasOCProblem>(
+                createCasOCProblem());
+    }
     auto casSolver = createCasOCSolver(*casProblem);
     if (get_verbosity()) {
         log_info("Number of threads: {}", casProblem->getJarSize());
@@ -364,6 +387,14 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
     } else {
         casGuess = convertToCasOCIterate(guess);
     }
+    if (get_reuse_nlp_multipliers() && !m_lastNlpMultipliersX.empty()) {
+        // The transcription ignores these if their lengths do not match the
+        // NLP (e.g., the mesh changed since the previous solve).
+        const std::vector<double>& lamX = m_lastNlpMultipliersX;
+        const std::vector<double>& lamG = m_lastNlpMultipliersG;
+        casGuess.nlp_multipliers_x = casadi::DM(lamX);
+        casGuess.nlp_multipliers_g = casadi::DM(lamG);
+    }
 
     // Temporarily disable printing of negative muscle force warnings so the
     // log isn't flooded while computing finite differences.
@@ -371,6 +402,7 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
     Logger::setLevel(Logger::Level::Warn);
     CasOC::Solution casSolution;
     try {
+        ScopedTimer timer("MocoCasADiSolver::solveTranscription");
         casSolution = casSolver->solve(casGuess);
     } catch (...) {
         OpenSim::Logger::setLevel(origLoggerLevel);
@@ -380,6 +412,12 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
     MocoSolution mocoSolution =
             convertToMocoTrajectory<MocoSolution>(casSolution);
 
+    if (get_reuse_nlp_multipliers() && casSolution.stats.count("success") &&
+            (bool)casSolution.stats.at("success")) {
+        m_lastNlpMultipliersX = casSolution.nlp_multipliers_x.get_elements();
+        m_lastNlpMultipliersG = casSolution.nlp_multipliers_g.get_elements();
+    }
+
     // If enforcing model constraints and not minimizing Lagrange multipliers,
     // check the rank of the constraint Jacobian and if rank-deficient, print
     // recommendation to the user to enable Lagrange multiplier minimization.
@@ -431,6 +469,69 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
             casSolution.stats.at("iter_count"), SimTK::nsToSec(elapsed),
             casSolution.objective_breakdown);
 
+    // Attach per-iteration convergence telemetry so dashboards can diagnose
+    // a slow batch (more iterations? costlier function evaluations?) without
+    // re-running with debug logging. Ipopt reports its full iteration
+    // history through the CasADi stats; if another NLP solver does not, the
+    // telemetry table is simply left empty.
+    if (casSolution.stats.count("iterations") &&
+            casSolution.stats.at("iterations").is_dict()) {
+        const casadi::Dict iterations =
+                casSolution.stats.at("iterations").to_dict();
+        std::vector<std::string> labels;
+        std::vector<std::vector<double>> columns;
+        size_t numRows = 0;
+        for (const auto& entry : iterations) {
+            std::vector<double> column;
+            if (entry.second.is_double_vector()) {
+                column = entry.second.to_double_vector();
+            } else if (entry.second.is_int_vector()) {
+                for (casadi_int value : entry.second.to_int_vector()) {
+                    column.push_back((double)value);
+                }
+            } else {
+                continue;
+            }
+            if (column.size() > numRows) numRows = column.size();
+            labels.push_back(entry.first);
+            columns.push_back(std::move(column));
+        }
+        TimeSeriesTable telemetry;
+        if (!labels.empty() && numRows) {
+            telemetry.setColumnLabels(labels);
+            for (size_t irow = 0; irow < numRows; ++irow) {
+                SimTK::RowVector row((int)labels.size(), SimTK::NaN);
+                for (int icol = 0; icol < (int)columns.size(); ++icol) {
+                    if (irow < columns[icol].size()) {
+                        row[icol] = columns[icol][irow];
+                    }
+                }
+                // Rows are keyed by NLP iteration number.
+                telemetry.appendRow((double)irow, row);
+            }
+        }
+        // Function-evaluation counts and timings are per-solve scalars;
+        // carry them in the table's metadata.
+        for (const auto& entry : casSolution.stats) {
+            const std::string& key = entry.first;
+            if (key.compare(0, 7, "n_call_") != 0 &&
+                    key.compare(0, 7, "t_wall_") != 0 &&
+                    key.compare(0, 7, "t_proc_") != 0) {
+                continue;
+            }
+            double value;
+            if (entry.second.is_double()) {
+                value = entry.second.to_double();
+            } else if (entry.second.is_int()) {
+                value = (double)entry.second.to_int();
+            } else {
+                continue;
+            }
+            telemetry.updTableMetaData().setValueForKey(key, value);
+        }
+        setSolutionTelemetry(mocoSolution, std::move(telemetry));
+    }
+
     if (get_verbosity()) {
         log_info(std::string(72, '-'));
         log_info("Elapsed real time: {}.", stopwatch.formatNs(elapsed));
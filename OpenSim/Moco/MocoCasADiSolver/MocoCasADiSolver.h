@@ -176,6 +176,25 @@ public:
             "enable this property to enforce MocoPathConstraints at mesh "
             "interval midpoints. Default: false.");
 
+    OpenSim_DECLARE_PROPERTY(reuse_nlp_multipliers, bool,
+            "Warm-start each solve with the NLP multipliers (lam_x, lam_g) "
+            "from the previous successful solve performed by this solver. "
+            "The multipliers are reused only if the transcription dimensions "
+            "match (e.g., the mesh is unchanged); this is intended for "
+            "solving sequences of nearly identical problems, such as "
+            "parameter sweeps (see MocoStudy::solveSweep()). Default: false.");
+
+    OpenSim_DECLARE_PROPERTY(reuse_casadi_problem, bool,
+            "Reuse the CasADi problem (model copies and CasADi function "
+            "callbacks) from the previous solve performed by this solver, if "
+            "the MocoProblem and the solver's settings are unchanged. This "
+            "skips the expensive problem conversion when repeatedly solving "
+            "structurally identical problems (e.g., mesh refinement, "
+            "MocoStudy::solveSweep()). Changes are detected by comparing XML "
+            "serializations, so modifications made to custom goals or "
+            "constraints through means other than properties are *not* "
+            "detected; leave this disabled in that case. Default: false.");
+
     MocoCasADiSolver();
 
     /// Returns true if Moco was compiled with the CasADi library; returns false
@@ -205,7 +224,7 @@ public:
     /// may need to invoke MocoSolver::resetProblem() for the provided guess to
     /// be recognized as compatible with the problem.
     /// This clears the `guess_file`, if one exists.
-    void setGuess(MocoTrajectory guess);
+    void setGuess(MocoTrajectory guess) override;
     /// Use this convenience function if you want to choose the type of guess
     /// used, but do not want to modify it first.
     void setGuess(const std::string& type) { setGuess(createGuess(type)); }
@@ -226,7 +245,7 @@ public:
     /// @}
 
 protected:
-    MocoSolution solveImpl() const override;
+    MocoSolution solveTranscriptionImpl() const override;
 
     std::unique_ptr<MocoCasOCProblem> createCasOCProblem() const;
     std::unique_ptr<CasOC::Solver> createCasOCSolver(
@@ -244,6 +263,21 @@ private:
     MocoTrajectory m_guessFromAPI;
     mutable SimTK::ResetOnCopy<MocoTrajectory> m_guessFromFile;
     mutable SimTK::ReferencePtr<const MocoTrajectory> m_guessToUse;
+
+    // NLP multipliers cached from the previous successful solve, for use with
+    // the reuse_nlp_multipliers property. We store plain doubles so this
+    // header does not depend on CasADi.
+    mutable SimTK::ResetOnCopy<std::vector<double>> m_lastNlpMultipliersX;
+    mutable SimTK::ResetOnCopy<std::vector<double>> m_lastNlpMultipliersG;
+
+    // CasADi problem cached from the previous solve, for use with the
+    // reuse_casadi_problem property, along with the XML serializations of the
+    // MocoProblem and this solver from which it was created. We use shared_ptr
+    // so this header does not require a complete MocoCasOCProblem type (the
+    // type is only available when building with CasADi).
+    mutable SimTK::ResetOnCopy<std::shared_ptr<const MocoCasOCProblem>>
+            m_cachedCasProblem;
+    mutable SimTK::ResetOnCopy<std::string> m_cachedCasProblemKey;
 };
 
 } // namespace OpenSim
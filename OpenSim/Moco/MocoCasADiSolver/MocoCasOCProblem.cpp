@@ -225,7 +225,12 @@ MocoCasOCProblem::MocoCasOCProblem(const MocoCasADiSolver& mocoCasADiSolver,
     const auto costNames = problemRep.createCostNames();
     for (const auto& name : costNames) {
         const auto& cost = problemRep.getCost(name);
-        addCost(name, cost.getNumIntegrals(), cost.getNumOutputs());
+        // The stage dependency tells us which optimizer variables cannot
+        // affect this cost, allowing structural derivative sparsity.
+        const auto stageDep = cost.getStageDependency();
+        addCost(name, cost.getNumIntegrals(), cost.getNumOutputs(),
+                stageDep >= SimTK::Stage::Dynamics,
+                stageDep >= SimTK::Stage::Acceleration);
     }
 
     const auto endpointConNames =
@@ -236,7 +241,10 @@ MocoCasOCProblem::MocoCasOCProblem(const MocoCasADiSolver& mocoCasADiSolver,
         for (const auto& bounds : ec.getConstraintInfo().getBounds()) {
             casBounds.push_back(convertBounds(bounds));
         }
-        addEndpointConstraint(name, ec.getNumIntegrals(), casBounds);
+        const auto stageDep = ec.getStageDependency();
+        addEndpointConstraint(name, ec.getNumIntegrals(), casBounds,
+                stageDep >= SimTK::Stage::Dynamics,
+                stageDep >= SimTK::Stage::Acceleration);
     }
 
     const auto pathConstraintNames = problemRep.createPathConstraintNames();
@@ -246,7 +254,10 @@ MocoCasOCProblem::MocoCasOCProblem(const MocoCasADiSolver& mocoCasADiSolver,
         for (const auto& bounds : pathCon.getConstraintInfo().getBounds()) {
             casBounds.push_back(convertBounds(bounds));
         }
-        addPathConstraint(name, casBounds);
+        const auto stageDep = pathCon.getStageDependency();
+        addPathConstraint(name, casBounds,
+                stageDep >= SimTK::Stage::Dynamics,
+                stageDep >= SimTK::Stage::Acceleration);
     }
 
     m_fileDeletionThrower = OpenSim::make_unique<FileDeletionThrower>(
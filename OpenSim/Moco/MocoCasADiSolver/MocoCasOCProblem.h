@@ -23,7 +23,7 @@
 
 #include <OpenSim/Moco/Components/AccelerationMotion.h>
 #include <OpenSim/Moco/Components/DiscreteController.h>
-#include <OpenSim/Moco/Components/DiscreteForces.h>
+#include <OpenSim/Simulation/Model/DiscreteForces.h>
 #include <OpenSim/Moco/MocoBounds.h>
 #include <OpenSim/Moco/MocoProblemRep.h>
 
@@ -331,12 +331,48 @@ private:
 
         m_jar->leave(std::move(mocoProblemRep));
     }
-    void calcCostIntegrand(int index, const ContinuousInput& input,
-            double& integrand) const override {
+    void calcMassMatrixProduct(const double& time, const casadi::DM& states,
+            const casadi::DM& parameters, const casadi::DM& accelerations,
+            casadi::DM& product) const override {
         auto mocoProblemRep = m_jar->take();
 
-        const auto& mocoCost = mocoProblemRep->getCostByIndex(index);
-        const auto stageDep = mocoCost.getStageDependency();
+        // The implicit multibody residuals are computed from the model with
+        // disabled constraints, so use that model's mass matrix here.
+        const auto& modelDisabledConstraints =
+                mocoProblemRep->getModelDisabledConstraints();
+        auto& simtkStateDisabledConstraints =
+                mocoProblemRep->updStateDisabledConstraints();
+
+        // The mass matrix depends only on the coordinates (and parameters).
+        applyParametersToModelProperties(parameters, *mocoProblemRep);
+        convertStatesToSimTKState(SimTK::Stage::Position, time, states,
+                modelDisabledConstraints, simtkStateDisabledConstraints, false);
+        modelDisabledConstraints.realizePosition(
+                simtkStateDisabledConstraints);
+
+        const SimTK::SimbodyMatterSubsystem& matterDisabledConstraints =
+                modelDisabledConstraints.getMatterSubsystem();
+        SimTK::Vector simtkAccel(
+                (int)accelerations.size1(), accelerations.ptr(), true);
+        SimTK::Vector simtkProduct((int)product.rows(), product.ptr(), true);
+        matterDisabledConstraints.multiplyByM(
+                simtkStateDisabledConstraints, simtkAccel, simtkProduct);
+
+        m_jar->leave(std::move(mocoProblemRep));
+    }
+    void calcCostIntegrands(const ContinuousInput& input,
+            casadi::DM& integrands) const override {
+        auto mocoProblemRep = m_jar->take();
+
+        // Apply the input once at the strictest stage dependency of all
+        // integral costs; realization results are shared across the costs.
+        const auto& costIndices = getIntegralCostIndices();
+        SimTK::Stage stageDep = SimTK::Stage::Topology;
+        for (int index : costIndices) {
+            const auto dep =
+                    mocoProblemRep->getCostByIndex(index).getStageDependency();
+            if (dep > stageDep) stageDep = dep;
+        }
 
         applyInput(stageDep, input.time, input.states, input.controls,
                 input.multipliers, input.derivatives, input.parameters,
@@ -350,8 +386,12 @@ private:
         const auto& rawControls = discreteController.getDiscreteControls(
                 simtkStateDisabledConstraints);
 
-        integrand = mocoCost.calcIntegrand(
-                {input.time, simtkStateDisabledConstraints, rawControls});
+        for (int i = 0; i < (int)costIndices.size(); ++i) {
+            const auto& mocoCost =
+                    mocoProblemRep->getCostByIndex(costIndices[i]);
+            integrands(i, 0) = mocoCost.calcIntegrand(
+                    {input.time, simtkStateDisabledConstraints, rawControls});
+        }
 
         m_jar->leave(std::move(mocoProblemRep));
     }
@@ -464,18 +504,16 @@ private:
     void calcPathConstraint(int constraintIndex, const ContinuousInput& input,
             casadi::DM& path_constraint) const override {
         auto mocoProblemRep = m_jar->take();
-        // Not all path constraints require realizing to Acceleration. We could
-        // add a stage dependency for path constraints, but we have yet to
-        // conduct profiling to indicate that such an optimization is necessary.
-        applyInput(SimTK::Stage::Acceleration,
+        const auto& mocoPathCon =
+                mocoProblemRep->getPathConstraintByIndex(constraintIndex);
+        // Not all path constraints require realizing to Acceleration; the
+        // constraint's stage dependency tells us how much information from
+        // the optimizer must be applied to the state.
+        applyInput(mocoPathCon.getStageDependency(),
                 input.time, input.states, input.controls, input.multipliers,
                 input.derivatives, input.parameters, mocoProblemRep);
         auto& simtkStateDisabledConstraints =
                 mocoProblemRep->updStateDisabledConstraints();
-
-        // Compute path constraint errors.
-        const auto& mocoPathCon =
-                mocoProblemRep->getPathConstraintByIndex(constraintIndex);
         SimTK::Vector errors(
                 (int)path_constraint.rows(), path_constraint.ptr(), true);
         mocoPathCon.calcPathConstraintErrors(
@@ -170,6 +170,12 @@ public:
         return m_path_constraint_index;
     }
 
+    /** Obtain the stage that the constraint errors depend on. Solvers can use
+    this to more efficiently decide how much information must be applied to
+    the state before computing constraint errors, and to declare structural
+    sparsity of derivatives. See setStageDependency(). */
+    SimTK::Stage getStageDependency() const { return m_stageDependency; }
+
     /** Calculate errors in the path constraint equations. The *errors* argument
     represents the error vector for this MocoPathConstraint. The errors vector
     is passed to calcPathConstraintErrorsImpl(), which is defined by derived
@@ -232,6 +238,15 @@ protected:
                 ->updConstraintInfo()
                 .setNumEquations(numEqs);
     }
+    /// Set the highest stage on which the constraint errors depend (default:
+    /// SimTK::Stage::Acceleration). Set this within initializeOnModelImpl()
+    /// if your constraint does not require realizing to Acceleration; solvers
+    /// use this to avoid unnecessary computations and to declare structural
+    /// sparsity of derivatives. Do not realize to a stage higher than the
+    /// stage dependency within calcPathConstraintErrorsImpl().
+    void setStageDependency(SimTK::Stage stageDependency) const {
+        m_stageDependency = stageDependency;
+    }
     /// @precondition The state is realized to SimTK::Stage::Position.
     /// If you need access to the controls, you must realize to Velocity:
     /// @code
@@ -253,6 +268,7 @@ private:
 
     mutable SimTK::ReferencePtr<const Model> m_model;
     mutable int m_path_constraint_index = -1;
+    mutable SimTK::Stage m_stageDependency = SimTK::Stage::Acceleration;
 };
 
 } // namespace OpenSim
@@ -126,6 +126,9 @@ void MocoControlBoundConstraint::initializeOnModelImpl(
     }
     info.setBounds(bounds);
     const_cast<MocoControlBoundConstraint*>(this)->setConstraintInfo(info);
+
+    // The constraint errors depend only on time and the controls.
+    setStageDependency(SimTK::Stage::Velocity);
 }
 
 void MocoControlBoundConstraint::calcPathConstraintErrorsImpl(
@@ -18,6 +18,13 @@
 
 #include "MocoDirectCollocationSolver.h"
 
+#include "Components/DiscreteController.h"
+
+#include <algorithm>
+
+#include <OpenSim/Simulation/SimulationUtilities.h>
+#include <OpenSim/Simulation/StatesTrajectory.h>
+
 using namespace OpenSim;
 
 void MocoDirectCollocationSolver::constructProperties() {
@@ -40,8 +47,165 @@ void MocoDirectCollocationSolver::constructProperties() {
     constructProperty_implicit_auxiliary_derivative_bounds({-1000, 1000});
     constructProperty_minimize_lagrange_multipliers(false);
     constructProperty_lagrange_multiplier_weight(1.0);
+    constructProperty_mesh_refinement(false);
+    constructProperty_mesh_refinement_tolerance(1e-3);
+    constructProperty_mesh_refinement_iteration_limit(5);
 }
 
 void MocoDirectCollocationSolver::setMesh(const std::vector<double>& mesh) {
     for (int i = 0; i < (int)mesh.size(); ++i) { set_mesh(i, mesh[i]); }
 }
+
+MocoSolution MocoDirectCollocationSolver::solveImpl() const {
+    MocoSolution solution = solveTranscriptionImpl();
+    if (!get_mesh_refinement()) { return solution; }
+
+    OPENSIM_THROW_IF_FRMOBJ(get_mesh_refinement_tolerance() <= 0, Exception,
+            "Expected a positive mesh_refinement_tolerance, but got {}.",
+            get_mesh_refinement_tolerance());
+    OPENSIM_THROW_IF_FRMOBJ(get_mesh_refinement_iteration_limit() < 1,
+            Exception,
+            "Expected mesh_refinement_iteration_limit to be 1 or greater, but "
+            "got {}.",
+            get_mesh_refinement_iteration_limit());
+
+    // The normalized mesh used by the solve above.
+    std::vector<double> mesh;
+    if (getProperty_mesh().empty()) {
+        const int numMeshIntervals = get_num_mesh_intervals();
+        for (int i = 0; i <= numMeshIntervals; ++i) {
+            mesh.push_back(i / (double)numMeshIntervals);
+        }
+    } else {
+        for (int i = 0; i < getProperty_mesh().size(); ++i) {
+            mesh.push_back(get_mesh(i));
+        }
+    }
+
+    const double tolerance = get_mesh_refinement_tolerance();
+    auto* mutThis = const_cast<MocoDirectCollocationSolver*>(this);
+    for (int iteration = 1;
+            iteration <= get_mesh_refinement_iteration_limit(); ++iteration) {
+        if (!solution.success()) {
+            log_warn("Mesh refinement: stopping because the previous solve "
+                     "was unsuccessful.");
+            break;
+        }
+        const SimTK::Vector errors = calcMeshIntervalErrors(solution, mesh);
+        double maxError = 0;
+        int numExceeding = 0;
+        for (int imesh = 0; imesh < errors.size(); ++imesh) {
+            maxError = std::max(maxError, errors[imesh]);
+            if (errors[imesh] > tolerance) { ++numExceeding; }
+        }
+        log_info("Mesh refinement iteration {}: maximum transcription error "
+                 "is {} ({} of {} mesh intervals exceed tolerance {}).",
+                iteration, maxError, numExceeding, errors.size(), tolerance);
+        if (!numExceeding) { break; }
+
+        // Split each offending interval in half; intervals within tolerance
+        // are left untouched.
+        std::vector<double> refinedMesh;
+        for (int imesh = 0; imesh < (int)mesh.size() - 1; ++imesh) {
+            refinedMesh.push_back(mesh[imesh]);
+            if (errors[imesh] > tolerance) {
+                refinedMesh.push_back(0.5 * (mesh[imesh] + mesh[imesh + 1]));
+            }
+        }
+        refinedMesh.push_back(mesh.back());
+        mesh = refinedMesh;
+
+        // Warm-start the refined transcription from the previous solution;
+        // the transcription resamples the guess onto the new mesh.
+        mutThis->updProperty_mesh().clear();
+        mutThis->setMesh(mesh);
+        mutThis->setGuess(solution);
+        solution = solveTranscriptionImpl();
+    }
+    return solution;
+}
+
+SimTK::Vector MocoDirectCollocationSolver::calcMeshIntervalErrors(
+        const MocoTrajectory& trajectory,
+        const std::vector<double>& mesh) const {
+    const auto& rep = getProblemRep();
+    const auto& model = rep.getModelBase();
+
+    // Apply any optimized parameter values to the model before realizing.
+    if (!trajectory.getParameterNames().empty()) {
+        SimTK::Vector parameters(trajectory.getParameters().transpose());
+        rep.applyParametersToModelProperties(parameters, true);
+    }
+
+    // Sample the trajectory at the mesh points and the quarter points of each
+    // mesh interval; the interior samples feed the quadrature below.
+    const double initialTime = trajectory.getInitialTime();
+    const double duration = trajectory.getFinalTime() - initialTime;
+    const int numIntervals = (int)mesh.size() - 1;
+    SimTK::Vector sampleTimes(4 * numIntervals + 1);
+    for (int imesh = 0; imesh < numIntervals; ++imesh) {
+        const double t0 = initialTime + duration * mesh[imesh];
+        const double t1 = initialTime + duration * mesh[imesh + 1];
+        for (int j = 0; j < 4; ++j) {
+            sampleTimes[4 * imesh + j] = t0 + 0.25 * j * (t1 - t0);
+        }
+    }
+    sampleTimes[4 * numIntervals] = trajectory.getFinalTime();
+    MocoTrajectory sampled(trajectory);
+    sampled.resample(sampleTimes);
+
+    const auto statesTable = sampled.exportToStatesTable();
+    auto statesTraj =
+            StatesTrajectory::createFromStatesTable(model, statesTable);
+
+    // Map the trajectory's control columns into the model's control vector.
+    auto systemControlIndexMap = createSystemControlIndexMap(model);
+    std::vector<int> controlIndices;
+    for (const auto& controlName : sampled.getControlNames()) {
+        controlIndices.push_back(systemControlIndexMap[controlName]);
+    }
+    const auto& controlsTrajectory = sampled.getControlsTrajectory();
+    const auto& discreteController = rep.getDiscreteControllerBase();
+
+    // Realize each sampled state to acceleration to obtain the model's state
+    // derivatives along the trajectory.
+    const int numSamples = (int)statesTraj.getSize();
+    const int ny = model.getWorkingState().getNY();
+    SimTK::Vector controls(model.getNumControls(), 0.0);
+    SimTK::Matrix y(numSamples, ny);
+    SimTK::Matrix ydot(numSamples, ny);
+    for (int itime = 0; itime < numSamples; ++itime) {
+        SimTK::State state = statesTraj[itime];
+        for (int ic = 0; ic < (int)controlIndices.size(); ++ic) {
+            controls[controlIndices[ic]] = controlsTrajectory(itime, ic);
+        }
+        discreteController.setDiscreteControls(state, controls);
+        model.realizeAcceleration(state);
+        y.updRow(itime) = ~state.getY();
+        ydot.updRow(itime) = ~state.getYDot();
+    }
+
+    // Betts' relative error estimate (Practical Methods, chapter 4): compare
+    // the change in each state variable across a mesh interval to a
+    // composite-Simpson quadrature of the model's state derivatives.
+    SimTK::Vector errors(numIntervals, 0.0);
+    for (int imesh = 0; imesh < numIntervals; ++imesh) {
+        const int i0 = 4 * imesh;
+        const double h = sampleTimes[i0 + 4] - sampleTimes[i0];
+        for (int iy = 0; iy < ny; ++iy) {
+            const double quadrature =
+                    (h / 12.0) * (ydot(i0, iy) + 4.0 * ydot(i0 + 1, iy) +
+                                         2.0 * ydot(i0 + 2, iy) +
+                                         4.0 * ydot(i0 + 3, iy) +
+                                         ydot(i0 + 4, iy));
+            // Skip empty slots in Simbody's Y vector.
+            if (!SimTK::isFinite(quadrature)) { continue; }
+            const double defect =
+                    std::abs(y(i0, iy) + quadrature - y(i0 + 4, iy));
+            const double scale = 1.0 +
+                    std::max(std::abs(y(i0, iy)), std::abs(y(i0 + 4, iy)));
+            errors[imesh] = std::max(errors[imesh], defect / scale);
+        }
+    }
+    return errors;
+}
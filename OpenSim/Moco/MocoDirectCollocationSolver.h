@@ -85,7 +85,23 @@ the minimization of all Lagrange multipliers associated with kinematic
 constraints in the problem. The `velocity_correction_bounds` setting allows you
 to set the bounds on the velocity correction variables that project state
 variables onto the constraint manifold when necessary to properly enforce defect
-constraints (see Posa et al. 2016 for details). */
+constraints (see Posa et al. 2016 for details).
+
+Mesh refinement
+---------------
+Enable the `mesh_refinement` setting to refine the mesh automatically instead
+of hand-iterating from a coarse mesh to a fine one. After each solve, the
+local transcription error of every mesh interval is estimated by comparing
+the change in the solution's state variables across the interval to a
+Simpson quadrature of the model's state derivatives sampled within the
+interval (see chapter 4 of the Betts textbook). Any interval whose relative
+error exceeds `mesh_refinement_tolerance` is split in half, and the problem
+is solved again using the previous solution as the initial guess. This
+repeats until all intervals are within tolerance or
+`mesh_refinement_iteration_limit` refinement passes have been performed.
+Intervals that are already within tolerance are left untouched, so only the
+offending portions of the mesh are refined. The refined mesh and the guess
+from the final pass remain set on the solver after solving. */
 class OSIMMOCO_API MocoDirectCollocationSolver : public MocoSolver {
     OpenSim_DECLARE_ABSTRACT_OBJECT(MocoDirectCollocationSolver, MocoSolver);
 
@@ -153,6 +169,17 @@ public:
     OpenSim_DECLARE_PROPERTY(implicit_auxiliary_derivative_bounds, MocoBounds,
             "Bounds on derivative variables for components with auxiliary "
             "dynamics in implicit form. Default: [-1000, 1000]");
+    OpenSim_DECLARE_PROPERTY(mesh_refinement, bool,
+            "Whether to iteratively split mesh intervals whose estimated "
+            "local transcription error exceeds mesh_refinement_tolerance and "
+            "re-solve, warm-started from the previous solution "
+            "(default: false).");
+    OpenSim_DECLARE_PROPERTY(mesh_refinement_tolerance, double,
+            "If mesh_refinement is enabled, the relative local transcription "
+            "error allowed in each mesh interval (default: 1e-3).");
+    OpenSim_DECLARE_PROPERTY(mesh_refinement_iteration_limit, int,
+            "If mesh_refinement is enabled, the maximum number of refinement "
+            "passes performed after the initial solve (default: 5).");
 
     MocoDirectCollocationSolver() { constructProperties(); }
 
@@ -162,6 +189,11 @@ public:
      * increasing (no duplicate entries), and end with 1. */
     void setMesh(const std::vector<double>& mesh);
 
+    /** %Set the single MocoTrajectory to use as the initial guess for the
+     * next solve; see the concrete solvers for the requirements on the guess.
+     * This is also how mesh refinement warm-starts each refinement pass. */
+    virtual void setGuess(MocoTrajectory guess) = 0;
+
 protected:
     OpenSim_DECLARE_PROPERTY(guess_file, std::string,
             "A MocoTrajectory file storing an initial guess.");
@@ -169,6 +201,21 @@ protected:
             "Usually non-uniform, user-defined list of mesh points to sample. "
             "Takes precedence over uniform mesh with num_mesh_intervals.");
     void constructProperties();
+
+    /** Transcribe and solve the problem once on the current mesh. Concrete
+     * solvers implement this instead of solveImpl() so that this class can
+     * drive mesh refinement around repeated transcriptions. */
+    virtual MocoSolution solveTranscriptionImpl() const = 0;
+
+    /** Estimate the relative local transcription error in each interval of
+     * the provided normalized mesh by comparing the trajectory's change in
+     * state variables across the interval to a Simpson quadrature of the
+     * model's state derivatives sampled at the interval's quarter points. */
+    SimTK::Vector calcMeshIntervalErrors(const MocoTrajectory& trajectory,
+            const std::vector<double>& mesh) const;
+
+private:
+    MocoSolution solveImpl() const override;
 };
 
 } // namespace OpenSim
@@ -63,6 +63,19 @@ are set to NaN.
 The provided trajectory is altered to satisfy any enabled kinematic
 constraints in the model.
 
+# Reduced optimization problem
+Because the kinematics are prescribed (via PositionMotion), the multibody
+states are eliminated from the optimization problem: coordinate values,
+speeds, and accelerations are not optimization variables, and no defect or
+kinematic constraint equations are enforced for them. Only auxiliary states
+(e.g., muscle activations and normalized tendon forces) and controls remain
+as variables, so the problem size scales with the number of actuators and
+mesh intervals, not with the number of degrees of freedom. The prescribed
+coordinate values and speeds are computed by Simbody when realizing the
+model's state, and the multibody dynamics appear only as the implicit
+residual equations relating the applied forces to the prescribed
+accelerations.
+
 # Cost
 By default, MocoInverse minimizes the sum of squared controls and
 constrains initial activation to be equal to initial excitation (to avoid
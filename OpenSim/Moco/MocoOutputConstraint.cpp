@@ -90,6 +90,7 @@ void MocoOutputConstraint::initializeOnModelImpl(const Model&,
     // Set the "depends-on stage", the SimTK::Stage we must realize to
     // in order to calculate values from this output.
     m_dependsOnStage = m_output->getDependsOnStage();
+    setStageDependency(m_dependsOnStage);
 
     // There is only one scalar constraint per Output.
     setNumEquations(1);
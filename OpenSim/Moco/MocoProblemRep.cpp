@@ -20,7 +20,7 @@
 
 #include "Components/AccelerationMotion.h"
 #include "Components/DiscreteController.h"
-#include "Components/DiscreteForces.h"
+#include <OpenSim/Simulation/Model/DiscreteForces.h>
 #include "MocoProblem.h"
 #include "MocoProblemInfo.h"
 #include "MocoScaleFactor.h"
@@ -374,10 +374,14 @@ void MocoProblemRep::initialize() {
     }
 
     if (!m_prescribedKinematics) {
-        for (const auto& coord : m_model_base.getComponentList<Coordinate>()) {
-            const auto stateVarNames = coord.getStateVariableNames();
+        // Read the contiguous per-coordinate snapshot instead of issuing
+        // per-coordinate property queries.
+        const auto& coordSnapshot = m_model_base.getCoordinateSnapshot();
+        for (int icoord = 0; icoord < (int)coordSnapshot.paths.size();
+                ++icoord) {
             {
-                const std::string coordValueName = stateVarNames[0];
+                const std::string coordValueName =
+                        coordSnapshot.paths[icoord] + "/value";
                 // TODO document: Range used even if not clamped.
                 if (m_state_infos.count(coordValueName) == 0) {
                     const auto info =
@@ -386,11 +390,13 @@ void MocoProblemRep::initialize() {
                 }
                 if (!m_state_infos[coordValueName].getBounds().isSet()) {
                     m_state_infos[coordValueName].setBounds(
-                            {coord.getRangeMin(), coord.getRangeMax()});
+                            {coordSnapshot.rangeMin[icoord],
+                                    coordSnapshot.rangeMax[icoord]});
                 }
             }
             {
-                const std::string coordSpeedName = stateVarNames[1];
+                const std::string coordSpeedName =
+                        coordSnapshot.paths[icoord] + "/speed";
                 if (m_state_infos.count(coordSpeedName) == 0) {
                     const auto info =
                             MocoVariableInfo(coordSpeedName, {}, {}, {});
@@ -19,6 +19,10 @@
 
 #include "MocoProblem.h"
 
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include <OpenSim/Simulation/Manager/Manager.h>
 
 using namespace OpenSim;
@@ -101,11 +105,35 @@ void MocoSolver::setSolutionStats(MocoSolution& sol, bool success,
     sol.setObjectiveBreakdown(std::move(objectiveBreakdown));
 }
 
+void MocoSolver::setSolutionTelemetry(
+        MocoSolution& sol, TimeSeriesTable telemetry) {
+    sol.setSolverTelemetry(std::move(telemetry));
+}
+
 std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
         MocoSolver::createProblemRepJar(int size) const {
     auto jar = OpenSim::make_unique<ThreadsafeJar<const MocoProblemRep>>();
+    // Each rep is created from a const reference to the problem and owns all
+    // of its mutable data (models, states, goals), so the reps can be created
+    // concurrently. For heavy models, replicating the problem serially can
+    // dominate solver startup when many threads are requested.
+    std::vector<std::unique_ptr<MocoProblemRep>> reps(size);
+    std::vector<std::thread> threads;
+    std::exception_ptr firstException = nullptr;
+    std::mutex exceptionMutex;
     for (int i = 0; i < size; ++i) {
-        jar->leave(std::unique_ptr<MocoProblemRep>(m_problem->createRepHeap()));
+        threads.emplace_back([&, i]() {
+            try {
+                reps[i] = std::unique_ptr<MocoProblemRep>(
+                        m_problem->createRepHeap());
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!firstException) firstException = std::current_exception();
+            }
+        });
     }
+    for (auto& thread : threads) { thread.join(); }
+    if (firstException) std::rethrow_exception(firstException);
+    for (auto& rep : reps) { jar->leave(std::move(rep)); }
     return jar;
 }
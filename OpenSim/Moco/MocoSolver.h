@@ -89,10 +89,18 @@ protected:
             std::vector<std::pair<std::string, double>> objectiveBreakdown =
                     {});
 
+    /// Attach the solver's per-iteration convergence telemetry to the
+    /// solution; see MocoSolution::getSolverTelemetry().
+    static void setSolutionTelemetry(MocoSolution&, TimeSeriesTable telemetry);
+
     const MocoProblemRep& getProblemRep() const {
         return m_problemRep;
     }
 
+    /// Get the MocoProblem set via resetProblem().
+    /// @precondition You must have called resetProblem().
+    const MocoProblem& getProblem() const { return m_problem.getRef(); }
+
     /// Create a library of MocoProblemRep%s for use in parallelized code.
     // TODO SWIG ignore.
     std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
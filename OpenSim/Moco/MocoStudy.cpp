@@ -101,6 +101,50 @@ MocoSolution MocoStudy::solve() const {
     return solution;
 }
 
+std::vector<MocoSolution> MocoStudy::solveSweep(
+        const std::function<void(MocoProblem&, int)>& configureProblem,
+        int numProblems) {
+    OPENSIM_THROW_IF(numProblems < 1, Exception,
+            "Expected numProblems to be 1 or greater, but got {}.",
+            numProblems);
+    std::vector<MocoSolution> solutions;
+    for (int iproblem = 0; iproblem < numProblems; ++iproblem) {
+        configureProblem(upd_problem(), iproblem);
+        initSolverInternal();
+
+        // Warm-start from the most recent successful solution. The solver
+        // retains the guess across solves, so an unsuccessful solve does not
+        // discard the warm start for subsequent problems in the sweep.
+        if (!solutions.empty() && solutions.back().success()) {
+            if (auto* dircol = dynamic_cast<MocoDirectCollocationSolver*>(
+                        &upd_solver())) {
+                dircol->setGuess(solutions.back());
+            }
+        }
+
+        MocoSolution solution = get_solver().solve();
+
+        if (get_write_solution()) {
+            OpenSim::IO::makeDir(get_results_directory());
+            std::string prefix = getName().empty() ? "MocoStudy" : getName();
+            bool originallySealed = solution.isSealed();
+            solution.unseal();
+            const std::string filename =
+                    get_results_directory() +
+                    SimTK::Pathname::getPathSeparator() + prefix +
+                    "_solution_" + std::to_string(iproblem) + ".sto";
+            try {
+                solution.write(filename);
+            } catch (const TimestampGreaterThanEqualToNext&) {
+                log_warn("Could not write solution to file...skipping.");
+            }
+            if (originallySealed) solution.seal();
+        }
+        solutions.push_back(std::move(solution));
+    }
+    return solutions;
+}
+
 void MocoStudy::visualize(const MocoTrajectory& it) const {
     // TODO this does not need the Solver at all, so this could be moved to
     // MocoProblem.
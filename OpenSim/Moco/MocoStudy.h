@@ -20,6 +20,8 @@
 
 #include "MocoSolver.h"
 
+#include <functional>
+
 #include <OpenSim/Common/Object.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
@@ -149,6 +151,26 @@ public:
     /// until you acknowledge the failure by invoking MocoSolution::unseal().
     MocoSolution solve() const;
 
+    /// Solve a family of nearly identical problems sequentially (e.g., a
+    /// parameter sweep), warm-starting each solve from the previous solution.
+    /// Before each of the numProblems solves, configureProblem is invoked with
+    /// the study's problem and the index of the upcoming solve (starting at
+    /// 0) so you can adjust weights, bounds, etc.; then, if the previous solve
+    /// succeeded, its solution is set as the guess for this solve. The
+    /// trajectory is resampled if the mesh has changed. When using
+    /// MocoCasADiSolver, enable the solver's `reuse_nlp_multipliers` property
+    /// to also warm-start the NLP multipliers across the sweep.
+    /// If the write_solution property is true, each solution is written to
+    /// the results_directory with the solve's index in the file name.
+    /// Solutions from unsuccessful solves are sealed, as with solve(), and
+    /// the sweep continues from the most recent successful solution.
+    /// @note This function is not available through the command-line tool or
+    /// scripting; use a loop around solve() there instead.
+    // TODO SWIG ignore.
+    std::vector<MocoSolution> solveSweep(
+            const std::function<void(MocoProblem&, int)>& configureProblem,
+            int numProblems);
+
     /// Interactively visualize a trajectory using the simbody-visualizer. The
     /// trajectory could be an initial guess, a solution, etc.
     /// @precondition
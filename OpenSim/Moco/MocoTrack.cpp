@@ -29,7 +29,6 @@
 
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Common/GCVSpline.h>
-#include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Simulation/MarkersReference.h>
 
 using namespace OpenSim;
@@ -145,11 +144,23 @@ MocoSolution MocoTrack::solveInternal(bool visualize) {
 TimeSeriesTable MocoTrack::configureStateTracking(
         MocoProblem& problem, Model& model) {
 
-    // Read in the states reference data and spline.
+    // Read in the states reference data. If this tool was initialized
+    // previously with the same states_reference and model settings (compared
+    // via XML serialization), reuse the processed reference from that call:
+    // filtering and splining long recordings can dominate setup time when
+    // solving multiple variants of the same tracking problem. The reference
+    // file itself is assumed not to change on disk between calls.
     // TODO convert Degrees to Radians.
-    TimeSeriesTable states = get_states_reference().processAndConvertToRadians(
-            getDocumentDirectory(), model);
-    auto stateSplines = GCVSplineSet(states, states.getColumnLabels());
+    const std::string referenceKey =
+            get_states_reference().dump() + get_model().dump();
+    TimeSeriesTable states;
+    if (!m_statesReferenceCacheKey.empty() &&
+            m_statesReferenceCacheKey == referenceKey) {
+        states = m_statesReferenceCache;
+    } else {
+        states = get_states_reference().processAndConvertToRadians(
+                getDocumentDirectory(), model);
+    }
 
     // Loop through all coordinates and compare labels in the reference data
     // to coordinate variable names.
@@ -179,11 +190,15 @@ TimeSeriesTable MocoTrack::configureStateTracking(
         // value to the tracking reference.
         if (trackingValue && !trackingSpeed &&
                 get_track_reference_position_derivatives()) {
-            auto value = states.getDependentColumnAtIndex(valueIdx);
-            auto* valueSpline = stateSplines.getGCVSpline(valueIdx);
+            // Fit a spline to only this column; most columns do not need a
+            // derivative, so fitting splines to the entire reference up
+            // front is wasteful.
+            SimTK::Vector value(states.getDependentColumnAtIndex(valueIdx));
+            GCVSpline valueSpline(5, (int)time.size(), time.data(), &value[0],
+                    labels[valueIdx]);
             SimTK::Vector speed((int)time.size());
             for (int j = 0; j < (int)time.size(); ++j) {
-                speed[j] = valueSpline->calcDerivative(
+                speed[j] = valueSpline.calcDerivative(
                         {0}, SimTK::Vector(1, time[j]));
             }
             states.appendColumn(speedName, speed);
@@ -228,6 +243,11 @@ TimeSeriesTable MocoTrack::configureStateTracking(
     // occurred.
     STOFileAdapter::write(states, getName() + "_tracked_states.sto");
 
+    // Cache the processed reference (including any appended speed columns)
+    // for future initialize() calls.
+    m_statesReferenceCache = states;
+    m_statesReferenceCacheKey = referenceKey;
+
     // Return tracked states to possibly include in the guess.
     return states;
 }
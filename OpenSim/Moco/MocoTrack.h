@@ -258,6 +258,11 @@ public:
                               TabOpLowPassFilter(lowpassFilterFreq));
     }
 
+    /// Generate the MocoStudy from this tool's properties without solving,
+    /// so you can further customize the problem.
+    /// Repeated calls reuse the processed states reference from the previous
+    /// call if the states_reference and model properties are unchanged; the
+    /// reference file is assumed not to change on disk between calls.
     MocoStudy initialize();
     /// Solve the MocoTrack problem and obtain the solution.
     MocoSolution solve() { return solveInternal(false); }
@@ -268,6 +273,11 @@ public:
 private:
     Model m_model;
     TimeInfo m_timeInfo;
+    // Processed states reference (including any appended speed columns)
+    // cached by configureStateTracking(), along with the XML serializations
+    // of the properties it was created from.
+    TimeSeriesTable m_statesReferenceCache;
+    std::string m_statesReferenceCacheKey;
 
     void constructProperties();
 
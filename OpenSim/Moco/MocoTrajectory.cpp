@@ -20,6 +20,10 @@
 #include "MocoProblem.h"
 #include "MocoUtilities.h"
 
+#include <cstdint>
+#include <fstream>
+
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Simulation/Model/Model.h>
@@ -687,6 +691,10 @@ void MocoTrajectory::resample(SimTK::Vector time) {
 }
 
 MocoTrajectory::MocoTrajectory(const std::string& filepath) {
+    if (IO::EndsWith(filepath, ".mocobin")) {
+        *this = readBinary(filepath);
+        return;
+    }
     TimeSeriesTable table(filepath);
     const auto& metadata = table.getTableMetaData();
     // TODO: bug with file adapters.
@@ -806,7 +814,253 @@ MocoTrajectory::MocoTrajectory(const std::string& filepath) {
 
 void MocoTrajectory::write(const std::string& filepath) const {
     ensureUnsealed();
-    STOFileAdapter::write(convertToTable(), filepath);
+    // Dispatch on the extension so a trajectory can land directly in any
+    // registered table format (e.g., ".h5" when OpenSim is built with HDF5
+    // support); ".sto" remains the default.
+    const std::string extension = FileAdapter::findExtension(filepath);
+    if (extension == "sto" || extension.empty()) {
+        STOFileAdapter::write(convertToTable(), filepath);
+    } else {
+        const TimeSeriesTable table = convertToTable();
+        DataAdapter::InputTables tables{};
+        tables.emplace("table", &table);
+        FileAdapter::writeFile(tables, filepath);
+    }
+}
+
+namespace {
+// Helpers for the binary trajectory format; see
+// MocoTrajectory::writeBinary(). All values are written in the machine's
+// native byte order.
+const char binaryTrajectoryMagic[] = "MOCOBIN";
+const int binaryTrajectoryMagicLength = 7;
+const int32_t binaryTrajectoryVersion = 1;
+
+void writeBinaryInt(std::ofstream& out, int32_t value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+int32_t readBinaryInt(std::ifstream& in) {
+    int32_t value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    OPENSIM_THROW_IF(!in, OpenSim::Exception,
+            "Unexpected end of binary trajectory file.");
+    return value;
+}
+void writeBinaryString(std::ofstream& out, const std::string& str) {
+    writeBinaryInt(out, (int32_t)str.size());
+    out.write(str.data(), (std::streamsize)str.size());
+}
+std::string readBinaryString(std::ifstream& in) {
+    const int32_t length = readBinaryInt(in);
+    OPENSIM_THROW_IF(length < 0, OpenSim::Exception,
+            "Invalid string length in binary trajectory file.");
+    std::string str((size_t)length, '\0');
+    in.read(&str[0], length);
+    OPENSIM_THROW_IF(!in, OpenSim::Exception,
+            "Unexpected end of binary trajectory file.");
+    return str;
+}
+} // namespace
+
+void MocoTrajectory::writeBinary(const std::string& filepath) const {
+    ensureUnsealed();
+    std::ofstream out(filepath, std::ios::binary);
+    OPENSIM_THROW_IF(!out, Exception,
+            "Could not open file '{}' for writing.", filepath);
+
+    // Header: magic, format version, counts, then the names for each group
+    // of columns.
+    out.write(binaryTrajectoryMagic, binaryTrajectoryMagicLength);
+    writeBinaryInt(out, binaryTrajectoryVersion);
+    writeBinaryInt(out, (int32_t)m_time.size());
+    writeBinaryInt(out, (int32_t)m_state_names.size());
+    writeBinaryInt(out, (int32_t)m_control_names.size());
+    writeBinaryInt(out, (int32_t)m_multiplier_names.size());
+    writeBinaryInt(out, (int32_t)m_derivative_names.size());
+    writeBinaryInt(out, (int32_t)m_slack_names.size());
+    writeBinaryInt(out, (int32_t)m_parameter_names.size());
+    for (const auto* names : {&m_state_names, &m_control_names,
+                 &m_multiplier_names, &m_derivative_names, &m_slack_names,
+                 &m_parameter_names}) {
+        for (const auto& name : *names) { writeBinaryString(out, name); }
+    }
+
+    // Data: the time vector followed by each group's matrix, one contiguous
+    // column at a time, so readBinary() can seek directly to any column.
+    std::vector<double> column((size_t)m_time.size());
+    for (int itime = 0; itime < m_time.size(); ++itime) {
+        column[itime] = m_time[itime];
+    }
+    out.write(reinterpret_cast<const char*>(column.data()),
+            (std::streamsize)(column.size() * sizeof(double)));
+    for (const auto* matrix : {&m_states, &m_controls, &m_multipliers,
+                 &m_derivatives, &m_slacks}) {
+        for (int icol = 0; icol < matrix->ncol(); ++icol) {
+            for (int irow = 0; irow < matrix->nrow(); ++irow) {
+                column[irow] = (*matrix)(irow, icol);
+            }
+            out.write(reinterpret_cast<const char*>(column.data()),
+                    (std::streamsize)(column.size() * sizeof(double)));
+        }
+    }
+    for (int iparam = 0; iparam < m_parameters.size(); ++iparam) {
+        const double value = m_parameters[iparam];
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    OPENSIM_THROW_IF(!out, Exception,
+            "Error writing binary trajectory to file '{}'.", filepath);
+}
+
+int MocoTrajectory::getNumBlockColumns() const {
+    ensureUnsealed();
+    return 1 + (int)m_state_names.size() + (int)m_control_names.size() +
+           (int)m_multiplier_names.size() + (int)m_derivative_names.size();
+}
+
+SimTK::Matrix MocoTrajectory::exportToBlock() const {
+    ensureUnsealed();
+    const int numRows = m_time.size();
+    SimTK::Matrix block((int)numRows, getNumBlockColumns());
+    block.updCol(0) = m_time;
+    int offset = 1;
+    for (const auto* matrix :
+            {&m_states, &m_controls, &m_multipliers, &m_derivatives}) {
+        if (matrix->ncol()) {
+            block.updBlock(0, offset, numRows, matrix->ncol()) = *matrix;
+            offset += matrix->ncol();
+        }
+    }
+    return block;
+}
+
+void MocoTrajectory::setFromBlock(const SimTK::Matrix& block) {
+    ensureUnsealed();
+    OPENSIM_THROW_IF(block.ncol() != getNumBlockColumns(), Exception,
+            "Expected a block with {} columns, but it has {}.",
+            getNumBlockColumns(), block.ncol());
+    const int numRows = block.nrow();
+    m_time = block.col(0);
+    int offset = 1;
+    for (auto* matrix :
+            {&m_states, &m_controls, &m_multipliers, &m_derivatives}) {
+        const int numCols = matrix->ncol();
+        if (numCols) {
+            *matrix = block.block(0, offset, numRows, numCols);
+            offset += numCols;
+        } else {
+            matrix->resize(numRows, 0);
+        }
+    }
+    // Slacks are not part of the block; keep them consistent with the new
+    // number of rows.
+    if (m_slacks.nrow() != numRows) {
+        m_slacks.resize(numRows, (int)m_slack_names.size());
+        m_slacks.setToZero();
+    }
+}
+
+MocoTrajectory MocoTrajectory::readBinary(const std::string& filepath,
+        const std::vector<std::string>& columnPatterns) {
+    std::ifstream in(filepath, std::ios::binary);
+    OPENSIM_THROW_IF(!in, Exception,
+            "Could not open file '{}' for reading.", filepath);
+
+    char magic[binaryTrajectoryMagicLength];
+    in.read(magic, binaryTrajectoryMagicLength);
+    OPENSIM_THROW_IF(!in || std::string(magic, binaryTrajectoryMagicLength) !=
+                                    binaryTrajectoryMagic,
+            Exception,
+            "File '{}' is not a binary MocoTrajectory file.", filepath);
+    const int32_t version = readBinaryInt(in);
+    OPENSIM_THROW_IF(version != binaryTrajectoryVersion, Exception,
+            "Unrecognized binary MocoTrajectory format version {} in file "
+            "'{}'.",
+            version, filepath);
+    const int numTimes = readBinaryInt(in);
+    OPENSIM_THROW_IF(numTimes < 0, Exception, "Invalid number of times.");
+    std::vector<int> counts(6);
+    for (auto& count : counts) {
+        count = readBinaryInt(in);
+        OPENSIM_THROW_IF(count < 0, Exception, "Invalid number of columns.");
+    }
+    std::vector<std::vector<std::string>> names(6);
+    for (int igroup = 0; igroup < 6; ++igroup) {
+        for (int i = 0; i < counts[igroup]; ++i) {
+            names[igroup].push_back(readBinaryString(in));
+        }
+    }
+
+    std::vector<std::regex> regexes;
+    for (const auto& pattern : columnPatterns) { regexes.emplace_back(pattern); }
+    auto selectColumn = [&regexes](const std::string& name) {
+        if (regexes.empty()) return true;
+        for (const auto& regex : regexes) {
+            if (std::regex_match(name, regex)) return true;
+        }
+        return false;
+    };
+
+    // The data region is laid out as contiguous columns of numTimes doubles:
+    // time first, then each group's columns; the parameter values follow.
+    const std::int64_t dataStart = (std::int64_t)in.tellg();
+    const std::int64_t columnBytes =
+            (std::int64_t)numTimes * (std::int64_t)sizeof(double);
+    std::vector<double> column((size_t)numTimes);
+    auto readColumn = [&](std::int64_t icolumn) -> const std::vector<double>& {
+        in.seekg(dataStart + icolumn * columnBytes);
+        in.read(reinterpret_cast<char*>(column.data()),
+                (std::streamsize)(column.size() * sizeof(double)));
+        OPENSIM_THROW_IF(!in, Exception,
+                "Unexpected end of binary trajectory file.");
+        return column;
+    };
+
+    MocoTrajectory traj;
+    traj.m_time.resize(numTimes);
+    if (numTimes) {
+        const auto& time = readColumn(0);
+        for (int itime = 0; itime < numTimes; ++itime) {
+            traj.m_time[itime] = time[itime];
+        }
+    }
+
+    std::vector<std::string>* groupNames[] = {&traj.m_state_names,
+            &traj.m_control_names, &traj.m_multiplier_names,
+            &traj.m_derivative_names, &traj.m_slack_names};
+    SimTK::Matrix* groupData[] = {&traj.m_states, &traj.m_controls,
+            &traj.m_multipliers, &traj.m_derivatives, &traj.m_slacks};
+    std::int64_t firstColumn = 1;
+    for (int igroup = 0; igroup < 5; ++igroup) {
+        std::vector<int> keep;
+        for (int i = 0; i < counts[igroup]; ++i) {
+            if (selectColumn(names[igroup][i])) { keep.push_back(i); }
+        }
+        groupData[igroup]->resize(numTimes, (int)keep.size());
+        for (int ikeep = 0; ikeep < (int)keep.size(); ++ikeep) {
+            groupNames[igroup]->push_back(names[igroup][keep[ikeep]]);
+            const auto& data = readColumn(firstColumn + keep[ikeep]);
+            for (int itime = 0; itime < numTimes; ++itime) {
+                (*groupData[igroup])(itime, ikeep) = data[itime];
+            }
+        }
+        firstColumn += counts[igroup];
+    }
+
+    // Parameters are always read; they are scalars, not columns.
+    const int numParameters = counts[5];
+    traj.m_parameter_names = names[5];
+    traj.m_parameters.resize(numParameters);
+    if (numParameters) {
+        in.seekg(dataStart + firstColumn * columnBytes);
+        for (int iparam = 0; iparam < numParameters; ++iparam) {
+            double value;
+            in.read(reinterpret_cast<char*>(&value), sizeof(value));
+            traj.m_parameters[iparam] = value;
+        }
+        OPENSIM_THROW_IF(!in, Exception,
+                "Unexpected end of binary trajectory file.");
+    }
+    return traj;
 }
 
 TimeSeriesTable MocoTrajectory::convertToTable() const {
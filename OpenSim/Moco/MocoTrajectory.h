@@ -21,6 +21,7 @@
 #include "osimMocoDLL.h"
 
 #include <OpenSim/Common/Storage.h>
+#include <OpenSim/Common/TimeSeriesTable.h>
 #include <OpenSim/Simulation/StatesTrajectory.h>
 
 namespace OpenSim {
@@ -163,7 +164,8 @@ public:
             const NamesAndData<SimTK::RowVector>& parameters = {});
 #endif
     /// Read a MocoTrajectory from an STO file (see STOFileAdapter). See output
-    /// of write() for the correct format.
+    /// of write() for the correct format. If the file name ends with
+    /// ".mocobin", the file is read with readBinary() instead.
     explicit MocoTrajectory(const std::string& filepath);
 
     virtual ~MocoTrajectory() = default;
@@ -698,9 +700,54 @@ public:
     /// @name Convert to other formats
     /// @{
 
-    /// Save the trajectory to a STO file. Use the ."sto" file extension.
+    /// Save the trajectory to a file. The format is chosen by the file
+    /// extension: ".sto" (the default) writes a STO file, and any other
+    /// extension is dispatched to the file adapter registered for it
+    /// (e.g., ".h5" when OpenSim is built with HDF5 support).
     void write(const std::string& filepath) const;
 
+    /// Save the trajectory to a binary file holding the same information as
+    /// the STO file written by write(). Reading the binary format back does
+    /// not parse text, and each column's data is stored contiguously so
+    /// readBinary() can read a subset of columns without loading the rest of
+    /// the file; prefer this format for large trajectory archives that are
+    /// re-read often (e.g., for warm starts). Use the ".mocobin" file
+    /// extension; the MocoTrajectory(filepath) constructor and the solvers'
+    /// guess_file property recognize this extension. The data are written in
+    /// the machine's native byte order, so the file is not portable between
+    /// machines of different endianness.
+    void writeBinary(const std::string& filepath) const;
+
+    /// Number of columns in the block exchanged by exportToBlock() and
+    /// setFromBlock(): one time column plus the states, controls,
+    /// multipliers, and derivatives.
+    int getNumBlockColumns() const;
+
+    /// Export the whole trajectory as one contiguous matrix: column 0 is
+    /// time, followed by the states, controls, multipliers, and derivatives,
+    /// each group in the order of the corresponding name list. This is the
+    /// cheapest way to move a full trajectory across a language boundary;
+    /// the name lists (getStateNames(), etc.) describe the columns.
+    /// Parameters are time-invariant and not part of the block; use
+    /// getParameters().
+    SimTK::Matrix exportToBlock() const;
+
+    /// Overwrite the time, states, controls, multipliers, and derivatives
+    /// from a block laid out as described for exportToBlock(). The column
+    /// names are unchanged, so the block must have getNumBlockColumns()
+    /// columns; the number of rows may differ from getNumTimes(). Use this
+    /// to inject a warm start produced elsewhere in one call.
+    void setFromBlock(const SimTK::Matrix& block);
+
+    /// Read a trajectory written by writeBinary(). If columnPatterns is
+    /// non-empty, only the columns (states, controls, multipliers,
+    /// derivatives, and slacks) whose entire name matches one of the provided
+    /// regular expression patterns are read; the time vector and parameters
+    /// are always read. Convert the result with convertToTable() or the
+    /// exportTo functions to use it in table-based workflows.
+    static MocoTrajectory readBinary(const std::string& filepath,
+            const std::vector<std::string>& columnPatterns = {});
+
     /// This table can be saved as a Storage file that can be used in the
     /// OpenSim GUI to visualize a motion, or as input to OpenSim's conventional
     /// tools (e.g., AnalyzeTool).
@@ -981,6 +1028,25 @@ public:
     void printObjectiveBreakdown() const;
     /// @}
 
+    /// @name Solver convergence telemetry
+    /// @{
+
+    /// Per-iteration telemetry recorded by the solver: one row per NLP
+    /// iteration, keyed by iteration number, with columns such as the
+    /// objective value, primal/dual infeasibilities, and step sizes (the
+    /// exact columns are those the underlying NLP solver reports; for Ipopt
+    /// via MocoCasADiSolver: "obj", "inf_pr", "inf_du", "mu", "d_norm",
+    /// "alpha_pr", "alpha_du", "ls_trials", "regularization_size").
+    /// Per-solve function-evaluation counts and timings are in the table's
+    /// metadata ("n_call_*", "t_wall_*", "t_proc_*" keys). The table is
+    /// empty if the solver does not provide an iteration history (e.g.,
+    /// MocoTropterSolver).
+    const TimeSeriesTable& getSolverTelemetry() const {
+        ensureUnsealed();
+        return m_solverTelemetry;
+    }
+    /// @}
+
     /// @name Access control
     /// @{
 
@@ -1022,6 +1088,9 @@ private:
         m_numIterations = numIterations;
     };
     void setSolverDuration(double duration) { m_solverDuration = duration; }
+    void setSolverTelemetry(TimeSeriesTable telemetry) {
+        m_solverTelemetry = std::move(telemetry);
+    }
     void convertToTableImpl(TimeSeriesTable&) const override;
     bool m_success = true;
     double m_objective = -1;
@@ -1029,6 +1098,7 @@ private:
     std::string m_status;
     int m_numIterations = -1;
     double m_solverDuration = -1;
+    TimeSeriesTable m_solverTelemetry;
     // Allow solvers to set success, status, and construct a solution.
     friend class MocoSolver;
 };
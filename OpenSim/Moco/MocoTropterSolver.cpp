@@ -34,6 +34,7 @@ void MocoTropterSolver::constructProperties() {
     constructProperty_optim_jacobian_approximation("exact");
     constructProperty_optim_sparsity_detection("random");
     constructProperty_exact_hessian_block_sparsity_mode();
+    constructProperty_optim_warm_start(false);
 }
 
 bool MocoTropterSolver::isAvailable() {
@@ -202,6 +203,24 @@ MocoTropterSolver::createTropterSolver(
             {"random", "initial-guess"});
     optsolver.set_sparsity_detection(get_optim_sparsity_detection());
 
+    if (get_optim_warm_start()) {
+        OPENSIM_THROW_IF(get_optim_solver() != "ipopt", Exception,
+                "Property 'optim_warm_start' was enabled, but is only "
+                "supported when using IPOPT.");
+        optsolver.set_warm_start(true);
+        // Provide the multipliers saved from the previous solve, if any.
+        if (!m_warmStartConstraintMultipliers.empty()) {
+            auto toVectorXd = [](const std::vector<double>& v) {
+                return Eigen::Map<const Eigen::VectorXd>(
+                        v.data(), (int)v.size()).eval();
+            };
+            optsolver.set_warm_start_multipliers(
+                    toVectorXd(m_warmStartConstraintMultipliers),
+                    toVectorXd(m_warmStartBoundMultipliersLower),
+                    toVectorXd(m_warmStartBoundMultipliersUpper));
+        }
+    }
+
     // Set advanced settings.
     // for (int i = 0; i < getProperty_optim_solver_options(); ++i) {
     //    optsolver.set_advanced_option(TODO);
@@ -313,7 +332,7 @@ void MocoTropterSolver::printOptimizationSolverOptions(std::string solver) {
 #endif
 }
 
-MocoSolution MocoTropterSolver::solveImpl() const {
+MocoSolution MocoTropterSolver::solveTranscriptionImpl() const {
 #ifdef OPENSIM_WITH_TROPTER
     const Stopwatch stopwatch;
 
@@ -353,6 +372,20 @@ MocoSolution MocoTropterSolver::solveImpl() const {
 
     if (get_verbosity()) { dircol->print_constraint_values(tropSolution); }
 
+    // Save the multipliers so that the next solve performed by this solver
+    // can warm-start from them.
+    if (get_optim_warm_start() && tropSolution.constraint_multipliers.size()) {
+        auto toStdVector = [](const Eigen::VectorXd& v) {
+            return std::vector<double>(v.data(), v.data() + v.size());
+        };
+        m_warmStartConstraintMultipliers =
+                toStdVector(tropSolution.constraint_multipliers);
+        m_warmStartBoundMultipliersLower =
+                toStdVector(tropSolution.bound_multipliers_lower);
+        m_warmStartBoundMultipliersUpper =
+                toStdVector(tropSolution.bound_multipliers_upper);
+    }
+
     MocoSolution mocoSolution = ocp->convertToMocoSolution(tropSolution);
 
     // If enforcing model constraints and not minimizing Lagrange
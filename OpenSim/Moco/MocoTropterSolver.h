@@ -84,6 +84,12 @@ public:
             "property must be set. Note: this option only takes effect when "
             "using "
             "IPOPT.");
+    OpenSim_DECLARE_PROPERTY(optim_warm_start, bool,
+            "Warm-start each solve from the constraint and bound multipliers "
+            "saved from the previous solve performed by this solver instance "
+            "(e.g., during a continuation sweep). The problem structure and "
+            "mesh must not change between solves. Note: this option only "
+            "takes effect when using IPOPT (default: false).");
 
     MocoTropterSolver();
 
@@ -114,7 +120,7 @@ public:
     /// may need to invoke MocoSolver::resetProblem() for the provided guess to
     /// be recognized as compatible with the problem.
     /// This clears the `guess_file`, if one exists.
-    void setGuess(MocoTrajectory guess);
+    void setGuess(MocoTrajectory guess) override;
     /// Use this convenience function if you want to choose the type of guess
     /// used, but do not want to modify it first.
     void setGuess(const std::string& type) { setGuess(createGuess(type)); }
@@ -156,7 +162,7 @@ protected:
             std::shared_ptr<const TropterProblemBase<double>>
                     ocp) const;
 
-    MocoSolution solveImpl() const override;
+    MocoSolution solveTranscriptionImpl() const override;
 
     /// Check that the provided guess is compatible with the problem and this
     /// solver.
@@ -170,6 +176,16 @@ private:
     MocoTrajectory m_guessFromAPI;
     mutable SimTK::ResetOnCopy<MocoTrajectory> m_guessFromFile;
     mutable SimTK::ReferencePtr<const MocoTrajectory> m_guessToUse;
+
+    // Multipliers saved from the previous solve so that the next solve
+    // performed by this solver instance can warm-start (see the
+    // optim_warm_start property). Discarded when the solver is copied.
+    mutable SimTK::ResetOnCopy<std::vector<double>>
+            m_warmStartConstraintMultipliers;
+    mutable SimTK::ResetOnCopy<std::vector<double>>
+            m_warmStartBoundMultipliersLower;
+    mutable SimTK::ResetOnCopy<std::vector<double>>
+            m_warmStartBoundMultipliersUpper;
 };
 
 } // namespace OpenSim
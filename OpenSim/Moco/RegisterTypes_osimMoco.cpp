@@ -18,7 +18,6 @@
 #include "RegisterTypes_osimMoco.h"
 
 #include "Components/AccelerationMotion.h"
-#include "Components/DiscreteForces.h"
 #include "Components/StationPlaneContactForce.h"
 #include "MocoBounds.h"
 #include "MocoScaleFactor.h"
@@ -121,7 +120,6 @@ OSIMMOCO_API void RegisterTypes_osimMoco() {
         Object::registerType(MeyerFregly2016Force());
         Object::registerType(EspositoMiller2018Force());
 
-        Object::registerType(DiscreteForces());
         Object::registerType(AccelerationMotion());
 
     } catch (const std::exception& e) {
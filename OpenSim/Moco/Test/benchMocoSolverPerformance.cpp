@@ -0,0 +1,247 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim Moco: benchMocoSolverPerformance.cpp                               *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2024 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and       *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// This is a benchmark, not a test: it compares the performance of
+// MocoTropterSolver and MocoCasADiSolver across transcription schemes on a
+// fixed set of production-like problems (tracking, predictive, and
+// inverse-style implicit dynamics), and records setup time, solve time,
+// per-iteration time, and convergence for each combination. The results are
+// written as CSV so they can be ingested by plotting/regression tooling.
+//
+// Usage: benchMocoSolverPerformance [output.csv]
+//
+// This executable is not registered with CTest; run it manually (or from a
+// performance-tracking script) on a quiet machine.
+
+#include <OpenSim/Actuators/ModelFactory.h>
+#include <OpenSim/Actuators/ModelOperators.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Moco/osimMoco.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+using namespace OpenSim;
+
+namespace {
+
+struct BenchmarkResult {
+    std::string problem;
+    std::string solver;
+    std::string transcription;
+    std::string dynamics_mode;
+    int num_mesh_intervals = -1;
+    bool success = false;
+    std::string status;
+    double objective = SimTK::NaN;
+    int num_iterations = -1;
+    double setup_time_s = SimTK::NaN;
+    double solve_time_s = SimTK::NaN;
+    double time_per_iteration_s = SimTK::NaN;
+};
+
+struct BenchmarkProblem {
+    std::string name;
+    // Each run gets a fresh study so that solvers cannot share caches.
+    std::function<MocoStudy()> create_study;
+    // "explicit" or "implicit" (the latter mimics inverse-style problems).
+    std::string dynamics_mode = "explicit";
+};
+
+// Predictive: double pendulum swing-up with minimum control effort.
+MocoStudy createPredictiveStudy() {
+    MocoStudy study;
+    study.setName("predictive_swingup");
+    MocoProblem& problem = study.updProblem();
+    problem.setModelAsCopy(ModelFactory::createDoublePendulum());
+    problem.setTimeBounds(0, 1);
+    problem.setStateInfo("/jointset/j0/q0/value", {-10, 10}, 0, SimTK::Pi);
+    problem.setStateInfo("/jointset/j0/q0/speed", {-50, 50}, 0, 0);
+    problem.setStateInfo("/jointset/j1/q1/value", {-10, 10}, 0, 0);
+    problem.setStateInfo("/jointset/j1/q1/speed", {-50, 50}, 0, 0);
+    problem.setControlInfo("/tau0", {-100, 100});
+    problem.setControlInfo("/tau1", {-100, 100});
+    problem.addGoal<MocoControlGoal>("effort");
+    return study;
+}
+
+// Tracking: double pendulum tracking a smooth coordinate reference, with a
+// small effort term for regularization.
+MocoStudy createTrackingStudy() {
+    MocoStudy study;
+    study.setName("tracking");
+    MocoProblem& problem = study.updProblem();
+    problem.setModelAsCopy(ModelFactory::createDoublePendulum());
+    problem.setTimeBounds(0, 1);
+    problem.setStateInfo("/jointset/j0/q0/value", {-10, 10}, 0);
+    problem.setStateInfo("/jointset/j0/q0/speed", {-50, 50}, 0);
+    problem.setStateInfo("/jointset/j1/q1/value", {-10, 10}, 0);
+    problem.setStateInfo("/jointset/j1/q1/speed", {-50, 50}, 0);
+    problem.setControlInfo("/tau0", {-100, 100});
+    problem.setControlInfo("/tau1", {-100, 100});
+
+    // A smooth reference that starts and ends at rest.
+    const int numTimes = 101;
+    std::vector<double> time(numTimes);
+    SimTK::Matrix ref(numTimes, 2);
+    for (int i = 0; i < numTimes; ++i) {
+        time[i] = i / double(numTimes - 1);
+        ref(i, 0) = 0.25 * SimTK::Pi * (1 - cos(SimTK::Pi * time[i]));
+        ref(i, 1) = 0.10 * SimTK::Pi * (1 - cos(SimTK::Pi * time[i]));
+    }
+    TimeSeriesTable reference(time, ref,
+            {"/jointset/j0/q0/value", "/jointset/j1/q1/value"});
+    auto* tracking = problem.addGoal<MocoStateTrackingGoal>("tracking");
+    tracking->setReference(reference);
+    problem.addGoal<MocoControlGoal>("effort", 0.001);
+    return study;
+}
+
+// Corpus-backed: torque-driven short-horizon effort minimization on the
+// contact-heavy grade of the reference-model performance corpus
+// (OpenSim/Tests/shared/PerformanceCorpus). Unlike the synthetic pendulum
+// problems above, this exercises the solvers on a production-class model:
+// 4 smooth-contact forces and a full planar gait skeleton.
+MocoStudy createCorpusContactStudy() {
+    MocoStudy study;
+    study.setName("corpus_2dgait_contact");
+    MocoProblem& problem = study.updProblem();
+    ModelProcessor modelProcessor = ModelProcessor("2D_gait.osim") |
+            ModOpRemoveMuscles() | ModOpAddReserves(250);
+    problem.setModelProcessor(modelProcessor);
+    problem.setTimeBounds(0, 0.2);
+    problem.addGoal<MocoControlGoal>("effort");
+    return study;
+}
+
+BenchmarkResult runBenchmark(const BenchmarkProblem& benchProblem,
+        const std::string& solverName, const std::string& transcription,
+        int numMeshIntervals) {
+    BenchmarkResult result;
+    result.problem = benchProblem.name;
+    result.solver = solverName;
+    result.transcription = transcription;
+    result.dynamics_mode = benchProblem.dynamics_mode;
+    result.num_mesh_intervals = numMeshIntervals;
+    try {
+        MocoStudy study = benchProblem.create_study();
+        MocoDirectCollocationSolver* solver = nullptr;
+        if (solverName == "casadi") {
+            solver = &study.initCasADiSolver();
+        } else {
+            solver = &study.initTropterSolver();
+        }
+        solver->set_transcription_scheme(transcription);
+        solver->set_num_mesh_intervals(numMeshIntervals);
+        solver->set_multibody_dynamics_mode(benchProblem.dynamics_mode);
+        solver->set_verbosity(0);
+
+        const Stopwatch stopwatch;
+        MocoSolution solution = study.solve();
+        const double total_time_s =
+                SimTK::nsToSec(stopwatch.getElapsedTimeInNs());
+
+        result.success = solution.success();
+        // Inspecting a failed solution would throw; unseal so that we can
+        // still record its stats.
+        solution.unseal();
+        result.status = solution.getStatus();
+        result.objective = solution.getObjective();
+        result.num_iterations = solution.getNumIterations();
+        result.solve_time_s = solution.getSolverDuration();
+        result.setup_time_s = total_time_s - result.solve_time_s;
+        if (result.num_iterations > 0) {
+            result.time_per_iteration_s =
+                    result.solve_time_s / result.num_iterations;
+        }
+    } catch (const std::exception& e) {
+        result.status = e.what();
+    }
+    return result;
+}
+
+void writeResults(
+        const std::vector<BenchmarkResult>& results, std::ostream& stream) {
+    stream << "problem,solver,transcription,dynamics_mode,"
+              "num_mesh_intervals,success,status,objective,num_iterations,"
+              "setup_time_s,solve_time_s,time_per_iteration_s\n";
+    for (const auto& r : results) {
+        // Commas in solver status messages would corrupt the CSV.
+        std::string status = r.status;
+        std::replace(status.begin(), status.end(), ',', ';');
+        stream << r.problem << "," << r.solver << "," << r.transcription << ","
+               << r.dynamics_mode << "," << r.num_mesh_intervals << ","
+               << r.success << "," << status << "," << r.objective << ","
+               << r.num_iterations << "," << r.setup_time_s << ","
+               << r.solve_time_s << "," << r.time_per_iteration_s << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::string outputFile =
+            argc > 1 ? argv[1] : "benchMocoSolverPerformance.csv";
+    const int numMeshIntervals = 50;
+
+    std::vector<BenchmarkProblem> problems;
+    problems.push_back({"predictive", createPredictiveStudy, "explicit"});
+    problems.push_back({"tracking", createTrackingStudy, "explicit"});
+    // Inverse-style: the same task solved with implicit multibody dynamics,
+    // which is how MocoInverse poses its problems.
+    problems.push_back({"inverse", createPredictiveStudy, "implicit"});
+    problems.push_back(
+            {"corpus_2dgait_contact", createCorpusContactStudy, "explicit"});
+
+    std::vector<std::string> solvers;
+    if (MocoCasADiSolver::isAvailable()) solvers.push_back("casadi");
+    if (MocoTropterSolver::isAvailable()) solvers.push_back("tropter");
+    if (solvers.empty()) {
+        std::cerr << "Neither MocoCasADiSolver nor MocoTropterSolver is "
+                     "available; nothing to benchmark."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& problem : problems) {
+        for (const auto& solver : solvers) {
+            for (const std::string& transcription :
+                    {"trapezoidal", "hermite-simpson"}) {
+                std::cout << "Running " << problem.name << " with " << solver
+                          << ", " << transcription << "..." << std::endl;
+                results.push_back(runBenchmark(
+                        problem, solver, transcription, numMeshIntervals));
+                const auto& r = results.back();
+                std::cout << "  success: " << r.success
+                          << "; iterations: " << r.num_iterations
+                          << "; solve time: " << r.solve_time_s << " s"
+                          << std::endl;
+            }
+        }
+    }
+
+    writeResults(results, std::cout);
+    std::ofstream file(outputFile);
+    writeResults(results, file);
+    std::cout << "Results written to " << outputFile << "." << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -2055,6 +2055,24 @@ TEST_CASE("Objective breakdown", "[casadi]") {
     CHECK(solution.getObjectiveTerm("goal_b") == Approx(0.01 * 7.3));
 }
 
+TEST_CASE("Solver convergence telemetry", "[casadi]") {
+    MocoStudy study = createSlidingMassMocoStudy();
+    MocoSolution solution = study.solve();
+
+    // One row per NLP iteration (Ipopt also reports the starting point, so
+    // expect at least getNumIterations() rows), keyed by iteration number.
+    const TimeSeriesTable& telemetry = solution.getSolverTelemetry();
+    CHECK((int)telemetry.getNumRows() >= solution.getNumIterations());
+    CHECK(telemetry.hasColumn("obj"));
+    CHECK(telemetry.hasColumn("inf_pr"));
+    CHECK(telemetry.hasColumn("inf_du"));
+    CHECK(telemetry.getIndependentColumn().front() == 0);
+
+    // Per-solve function-evaluation counts and timings ride in the
+    // metadata.
+    CHECK(telemetry.hasTableMetaDataKey("n_call_nlp_f"));
+}
+
 TEST_CASE("generateAccelerationsFromXXX() does not overwrite existing "
           "non-accleration derivatives.") {
     int N = 20;
@@ -19,7 +19,7 @@
  * -------------------------------------------------------------------------- */
 
 #include "About.h"
-#include "Components/DiscreteForces.h"
+#include <OpenSim/Simulation/Model/DiscreteForces.h>
 #include "Components/StationPlaneContactForce.h"
 #include "MocoBounds.h"
 #include "MocoCasADiSolver/MocoCasADiSolver.h"
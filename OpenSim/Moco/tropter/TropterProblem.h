@@ -22,7 +22,7 @@
 
 #include <OpenSim/Moco/Components/AccelerationMotion.h>
 #include <OpenSim/Moco/Components/DiscreteController.h>
-#include <OpenSim/Moco/Components/DiscreteForces.h>
+#include <OpenSim/Simulation/Model/DiscreteForces.h>
 #include <OpenSim/Moco/MocoBounds.h>
 #include <OpenSim/Moco/MocoTropterSolver.h>
 #include <OpenSim/Moco/MocoUtilities.h>
@@ -26,6 +26,8 @@
 #include <OpenSim/Common/Constant.h>
 #include "simbody/internal/AssemblyCondition_QValue.h"
 
+#include <chrono>
+
 using namespace std;
 using namespace SimTK;
 
@@ -42,9 +44,18 @@ AssemblySolver::AssemblySolver
 {
     setAuthors("Ajay Seth");
     _assembler = NULL;
-    
+    _goalsAreStale = true;
+
     _constraintWeight = constraintWeight;
 
+    _recordTelemetry = false;
+    _lastNumGoalEvals = 0;
+    _lastNumGoalGradientEvals = 0;
+    _lastNumErrorEvals = 0;
+    _lastNumErrorJacobianEvals = 0;
+    _lastNumAssemblySteps = 0;
+    _lastNumInitializations = 0;
+
     // default accuracy
     _accuracy = 1e-4;
 
@@ -76,6 +87,7 @@ void AssemblySolver::setAccuracy(double accuracy)
     _accuracy = accuracy;
     // Changing the accuracy invalidates the existing SimTK::Assembler
     _assembler.reset();
+    _goalsAreStale = true;
 }
 
 /* Internal method to convert the CoordinateReferences into goals of the 
@@ -94,6 +106,7 @@ void AssemblySolver::setupGoals(SimTK::State &s)
 
     // clear any old coordinate goals
     _coordinateAssemblyConditions.clear();
+    _lockedCoordinates.clear();
 
     // Get model coordinates
     const CoordinateSet& modelCoordSet = getModel().getCoordinateSet();
@@ -120,6 +133,9 @@ void AssemblySolver::setupGoals(SimTK::State &s)
                 _assembler->lockQ(coord.getBodyIndex(), SimTK::MobilizerQIndex(coord.getMobilizerQIndex()));
                 //No longer need the lock on
                 coord.setLocked(s, false);
+                // remember so the lock can be disabled again when the
+                // assembler is reused without a fresh setupGoals()
+                _lockedCoordinates.push_back(&coord);
                 
                 //Get rid of the corresponding reference too
                 _coordinateReferencesp.erase(p);
@@ -155,6 +171,13 @@ void AssemblySolver::updateCoordinateReference(const std::string &coordName, dou
         p != _coordinateReferencesp.end(); p++) {
         if(p->getName() == coordName){
             p->setValueFunction(Constant(value));
+            // The weight enters the problem when the goal is adopted, so a
+            // changed weight requires the goals to be reconstructed; the
+            // value itself is picked up by updateGoals(). Note the weight of
+            // a CoordinateReference does not depend on the state.
+            const SimTK::State dummy;
+            if (p->getWeight(dummy) != weight)
+                _goalsAreStale = true;
             p->setWeight(weight);
             return;
         }
@@ -175,10 +198,33 @@ void AssemblySolver::updateGoals(SimTK::State &s)
     }
 }
 
+/* Determine whether the existing goals can be reused for the given state:
+   the pattern of locked coordinates must match the one the goals were
+   constructed for, since locks shape the goal structure. */
+bool AssemblySolver::goalsAreValid(const SimTK::State& s) const
+{
+    // coordinates locked at setup must still be locked
+    for (unsigned int i = 0; i < _lockedCoordinates.size(); ++i) {
+        if (!_lockedCoordinates[i]->getLocked(s))
+            return false;
+    }
+
+    // coordinates with references were unlocked at setup and must remain so
+    const CoordinateSet& modelCoordSet = getModel().getCoordinateSet();
+    SimTK::Array_<CoordinateReference>::const_iterator p;
+    for (p = _coordinateReferencesp.begin();
+        p != _coordinateReferencesp.end(); p++) {
+        if (modelCoordSet.get(p->getName()).getLocked(s))
+            return false;
+    }
+
+    return true;
+}
+
 //______________________________________________________________________________
 /*
  * Assemble the model such that it satisfies configuration goals and constraints
- * The input state is used to initialize the assembly and then is updated to 
+ * The input state is used to initialize the assembly and then is updated to
  * return the resulting assembled configuration.
  */
 void AssemblySolver::assemble(SimTK::State &state)
@@ -188,13 +234,28 @@ void AssemblySolver::assemble(SimTK::State &state)
     // redundant constraints, but do not want this to affect the state of 
     // constraints the user expects
     SimTK::State s = state;
-    
-    // Make sure goals are up-to-date.
-    setupGoals(s);
 
-    // Let assembler perform some internal setup
-    _assembler->initialize(s);
-    
+    if (!_assembler || !_assembler->isInitialized() || _goalsAreStale ||
+            !goalsAreValid(s)) {
+        // Make sure goals are up-to-date.
+        setupGoals(s);
+
+        // Let assembler perform some internal setup
+        _assembler->initialize(s);
+        _goalsAreStale = false;
+    }
+    else {
+        // The structure of the assembly problem is unchanged: reuse the
+        // assembler and its internal workspaces, updating only the goal
+        // values and the starting configuration. Locks on coordinates with
+        // references are enforced through the assembler, so disable them on
+        // the working copy as setupGoals() would.
+        for (unsigned int i = 0; i < _lockedCoordinates.size(); ++i)
+            _lockedCoordinates[i]->setLocked(s, false);
+        updateGoals(s);
+        _assembler->setInternalState(s);
+    }
+
     // Useful to include through debug message/log in the future
     log_debug("UNASSEMBLED CONFIGURATION (normerr={}, maxerr={}, cost={})",
         _assembler->calcCurrentErrorNorm(),
@@ -205,7 +266,10 @@ void AssemblySolver::assemble(SimTK::State &state)
 
     try{
         // Now do the assembly and return the updated state.
+        const auto solveStart = std::chrono::steady_clock::now();
         _assembler->assemble();
+        const double solveTimeS = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - solveStart).count();
         // Update the q's in the state passed in
         _assembler->updateFromInternalState(s);
         state.updQ() = s.getQ();
@@ -229,6 +293,9 @@ void AssemblySolver::assemble(SimTK::State &state)
         log_debug(" evals: goal={} grad={} error={} jac={}",
             _assembler->getNumGoalEvals(), _assembler->getNumGoalGradientEvals(),
             _assembler->getNumErrorEvals(), _assembler->getNumErrorJacobianEvals());
+
+        if (_recordTelemetry)
+            recordTelemetry(state, solveTimeS, true);
     }
     catch (const std::exception& ex)
     {
@@ -267,11 +334,17 @@ void AssemblySolver::track(SimTK::State &s)
 
     try{
         // Now do the assembly and return the updated state.
+        const auto solveStart = std::chrono::steady_clock::now();
         _assembler->track(s.getTime());
+        const double solveTimeS = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - solveStart).count();
 
-        // update the state from the result of the assembler 
+        // update the state from the result of the assembler
         _assembler->updateFromInternalState(s);
-        
+
+        if (_recordTelemetry)
+            recordTelemetry(s, solveTimeS, false);
+
         // TODO: Useful to include through debug message/log in the future
         log_debug("Tracking: t= {} (acc={} tol={} normerr={}, maxerr={}, cost={})", 
             s.getTime(),
@@ -286,6 +359,49 @@ void AssemblySolver::track(SimTK::State &s)
     }
 }
 
+void AssemblySolver::clearTelemetry()
+{
+    _telemetry = TimeSeriesTable();
+}
+
+void AssemblySolver::recordTelemetry(const SimTK::State& s, double solveTimeS,
+        bool isAssemble)
+{
+    if (_telemetry.getNumColumns() == 0) {
+        _telemetry.setColumnLabels({"time_s", "is_assemble", "solve_time_s",
+            "goal_cost", "error_norm", "goal_evals", "goal_gradient_evals",
+            "error_evals", "error_jacobian_evals", "assembly_steps",
+            "initializations"});
+    }
+
+    // The counters accumulate for the life of the assembler and restart when
+    // it is rebuilt; report what this call consumed.
+    auto delta = [](int current, int& previous) {
+        const int consumed = current >= previous ? current - previous : current;
+        previous = current;
+        return double(consumed);
+    };
+
+    SimTK::RowVector row(int(_telemetry.getNumColumns()));
+    row[0] = s.getTime();
+    row[1] = isAssemble ? 1.0 : 0.0;
+    row[2] = solveTimeS;
+    row[3] = _assembler->calcCurrentGoal();
+    row[4] = _assembler->calcCurrentErrorNorm();
+    row[5] = delta(_assembler->getNumGoalEvals(), _lastNumGoalEvals);
+    row[6] = delta(_assembler->getNumGoalGradientEvals(),
+        _lastNumGoalGradientEvals);
+    row[7] = delta(_assembler->getNumErrorEvals(), _lastNumErrorEvals);
+    row[8] = delta(_assembler->getNumErrorJacobianEvals(),
+        _lastNumErrorJacobianEvals);
+    row[9] = delta(_assembler->getNumAssemblySteps(), _lastNumAssemblySteps);
+    row[10] = delta(_assembler->getNumInitializations(),
+        _lastNumInitializations);
+
+    // Rows are keyed by call index: times may repeat across calls.
+    _telemetry.appendRow(double(_telemetry.getNumRows()), row);
+}
+
 const SimTK::Assembler& AssemblySolver::getAssembler() const
 {
     OPENSIM_THROW_IF(!_assembler, Exception,
@@ -24,6 +24,7 @@
  * -------------------------------------------------------------------------- */
 
 #include "Solver.h"
+#include "OpenSim/Common/TimeSeriesTable.h"
 #include "OpenSim/Simulation/CoordinateReference.h"
 #include "simbody/internal/Assembler.h"
 
@@ -35,6 +36,7 @@ class State;
 namespace OpenSim {
 
 class Model;
+class Coordinate;
 
 //=============================================================================
 //=============================================================================
@@ -85,11 +87,17 @@ public:
         must call assemble() before being able to track().*/
     void setAccuracy(double accuracy);
 
+    /** The unitless accuracy of the assembly solution. */
+    double getAccuracy() const { return _accuracy; }
+
     /** %Set the relative weighting for constraints. Use Infinity to identify the 
         strict enforcement of constraints, otherwise any positive weighting will
         append the constraint errors to the assembly cost which the solver will
         minimize.*/
-    void setConstraintWeight(double weight) {_constraintWeight = weight; }
+    void setConstraintWeight(double weight) {
+        _constraintWeight = weight;
+        invalidateGoals();
+    }
     
     /** Specify which coordinates to match, each with a desired value and a
         relative weighting. */
@@ -100,9 +108,19 @@ public:
     void updateCoordinateReference(const std::string &coordName, double value, 
                                    double weight=1.0);
 
-    /** Assemble a model configuration that meets the assembly conditions 
+    /** Force the next call to assemble() to reconstruct the underlying
+        SimTK::Assembler and its goals from scratch. Call this after any
+        change that alters the structure of the assembly problem (e.g.
+        locking or clamping a coordinate), as opposed to a change in goal
+        values, which assemble() and track() pick up automatically. */
+    void invalidateGoals() { _goalsAreStale = true; }
+
+    /** Assemble a model configuration that meets the assembly conditions
         (desired values and constraints) and accuracy, starting from an initial
-        state that does not have to satisfy the constraints. */
+        state that does not have to satisfy the constraints. Repeated calls
+        reuse the underlying SimTK::Assembler and its workspaces as long as
+        the structure of the problem is unchanged; only the goal values and
+        starting configuration are updated. See invalidateGoals(). */
     virtual void assemble(SimTK::State &s);
 
     /** Obtain a model configuration that meets the assembly conditions 
@@ -118,6 +136,28 @@ public:
     /** Read access to the underlying SimTK::Assembler. */
     const SimTK::Assembler& getAssembler() const;
 
+    /** @name Convergence telemetry
+    An opt-in record of the underlying SimTK::Assembler's work: one table
+    row per assemble() or track() call with the call's wall time, the final
+    goal cost and constraint error norm, and the function-evaluation counts
+    the call consumed. Because repeated calls may revisit the same time
+    (and frames from a file may repeat times), rows are keyed by call index
+    and the state's time is the "time_s" column. Use this to see where a
+    tracking run (e.g. InverseKinematicsSolver's per-frame loop) spends its
+    evaluations without re-running at debug log level. */
+    /// @{
+    void setRecordTelemetry(bool record) { _recordTelemetry = record; }
+    bool getRecordTelemetry() const { return _recordTelemetry; }
+    /** The telemetry recorded so far. Columns: "time_s", "is_assemble"
+        (1 for assemble() calls, 0 for track()), "solve_time_s",
+        "goal_cost", "error_norm", "goal_evals", "goal_gradient_evals",
+        "error_evals", "error_jacobian_evals", "assembly_steps", and
+        "initializations". Empty until a call is recorded. */
+    const TimeSeriesTable& getTelemetryTable() const { return _telemetry; }
+    /** Discard all recorded telemetry rows. */
+    void clearTelemetry();
+    /// @}
+
 protected:
     /** Internal method to convert the CoordinateReferences into goals of the 
         assembly solver. Subclasses, can add and override to include other goals  
@@ -132,6 +172,10 @@ protected:
     /** Write access to the underlying SimTK::Assembler. */
     SimTK::Assembler& updAssembler();
 
+    /** Whether the underlying SimTK::Assembler and its goals can be reused
+        for the given state, or must be reconstructed by setupGoals(). */
+    bool goalsAreValid(const SimTK::State& s) const;
+
 private:
 
     // The assembly solution accuracy
@@ -147,6 +191,35 @@ private:
     SimTK::ResetOnCopy< std::unique_ptr<SimTK::Assembler>> _assembler;
 
     SimTK::Array_<SimTK::QValue*> _coordinateAssemblyConditions;
+
+    // Whether the goals must be reconstructed before the next assembly,
+    // because the structure of the problem (not just goal values) changed.
+    bool _goalsAreStale;
+
+    // Coordinates that were locked when the goals were set up. Their locks
+    // are enforced through the assembler, so they are unlocked on the
+    // working state whenever the assembler is reused.
+    SimTK::Array_<const Coordinate*> _lockedCoordinates;
+
+    // Whether assemble()/track() append a row to the telemetry table.
+    bool _recordTelemetry;
+
+    // One row per recorded assemble()/track() call; see getTelemetryTable().
+    TimeSeriesTable _telemetry;
+
+    // The assembler's evaluation counters accumulate across calls (and reset
+    // when the assembler is rebuilt); these snapshots turn them into
+    // per-call deltas.
+    int _lastNumGoalEvals;
+    int _lastNumGoalGradientEvals;
+    int _lastNumErrorEvals;
+    int _lastNumErrorJacobianEvals;
+    int _lastNumAssemblySteps;
+    int _lastNumInitializations;
+
+    // Append one telemetry row for the call that just completed.
+    void recordTelemetry(const SimTK::State& s, double solveTimeS,
+                         bool isAssemble);
 //=============================================================================
 };  // END of class AssemblySolver
 //=============================================================================
@@ -0,0 +1,120 @@
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  BufferedMarkersReference.cpp                   *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): Ayman Habib                                                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include "BufferedMarkersReference.h"
+#include "MarkersReference.h"
+
+using namespace std;
+using namespace SimTK;
+
+namespace OpenSim {
+
+BufferedMarkersReference::BufferedMarkersReference()
+        : MarkersReference() {
+    setAuthors("Ayman Habib");
+}
+
+/** get the values of the MarkersReference */
+void BufferedMarkersReference::getValuesAtTime(
+        double time, SimTK::Array_<Vec3> &values) const
+{
+    if (_prefetch) {
+        // A replay prefetch is running; serve the next queued frame. Frames
+        // are queued in table order so callers must request times in order.
+        double poppedTime(SimTK::NaN);
+        SimTK::RowVector_<SimTK::Vec3> nextRow;
+        _markerDataQueue.pop_front(poppedTime, nextRow);
+        int n = nextRow.size();
+        values.resize(n);
+        for (int i = 0; i < n; ++i) { values[i] = nextRow[i]; }
+        return;
+    }
+
+    const auto& times = getMarkerTable().getIndependentColumn();
+
+    if (time >= times.front() && time <= times.back()) {
+        Super::getValuesAtTime(time, values);
+    } else {
+        double poppedTime(SimTK::NaN);
+        SimTK::RowVector_<SimTK::Vec3> nextRow;
+        _markerDataQueue.pop_front(poppedTime, nextRow);
+        int n = nextRow.size();
+        values.resize(n);
+        for (int i = 0; i < n; ++i) { values[i] = nextRow[i]; }
+    }
+}
+
+double BufferedMarkersReference::getNextValuesAndTime(
+        SimTK::Array_<SimTK::Vec3>& values) {
+
+    double returnTime;
+    SimTK::RowVector_<SimTK::Vec3> nextRow;
+    _markerDataQueue.pop_front(returnTime, nextRow);
+    int n = nextRow.size();
+    values.resize(n);
+
+    for (int i = 0; i < n; ++i) { values[i] = nextRow[i]; }
+    return returnTime;
+}
+
+void BufferedMarkersReference::putValues(
+        double time, const SimTK::RowVector_<SimTK::Vec3>& dataRow) {
+    _markerDataQueue.push_back(time, dataRow);
+}
+
+void BufferedMarkersReference::startPrefetch()
+{
+    stopPrefetch();
+
+    OPENSIM_THROW_IF(getMarkerTable().getNumRows() < 1, Exception,
+            "BufferedMarkersReference::startPrefetch() requires loaded "
+            "marker data to replay.");
+
+    setFinished(false);
+    _prefetch.reset(new Prefetch());
+    Prefetch* prefetch = _prefetch.get();
+    prefetch->thread = std::thread([this, prefetch]() {
+        const auto& table = getMarkerTable();
+        const auto& times = table.getIndependentColumn();
+        const int numRows = (int)table.getNumRows();
+        for (int i = 0; i < numRows && !prefetch->stop; ++i) {
+            const auto row = table.getRowAtIndex(i);
+            // Wait for the consumer to drain a slot, but stay responsive
+            // to stopPrefetch().
+            while (!prefetch->stop &&
+                   !_markerDataQueue.tryPushBack(times[i], row))
+                std::this_thread::yield();
+        }
+        setFinished(true);
+    });
+}
+
+void BufferedMarkersReference::stopPrefetch()
+{
+    if (!_prefetch) return;
+    _prefetch->stop = true;
+    if (_prefetch->thread.joinable())
+        _prefetch->thread.join();
+    _prefetch.reset();
+}
+
+} // end of namespace OpenSim
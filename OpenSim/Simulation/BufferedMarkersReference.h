@@ -0,0 +1,139 @@
+#ifndef OPENSIM_BUFFERED_MARKERS_REFERENCE_H_
+#define OPENSIM_BUFFERED_MARKERS_REFERENCE_H_
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  BufferedMarkersReference.h                   *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): Ayman Habib                                                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MarkersReference.h"
+#include <OpenSim/Common/DataQueue.h>
+#include <memory>
+#include <thread>
+#include <atomic>
+
+namespace OpenSim {
+
+
+//=============================================================================
+//=============================================================================
+/**
+ * Subclass of MarkersReference that handles live data by providing a DataQueue
+ * that allows clients to push data into and allows the InverseKinematicsSolver
+ * to draw data from for solving, analogous to BufferedOrientationsReference
+ * for orientation data.
+ *
+ * In addition to live streaming, startPrefetch() replays the loaded marker
+ * table through the queue on a background thread, so that row lookup and
+ * copying overlap with solving on the consumer thread.
+ *
+ * @author Ayman Habib
+ */
+
+class OSIMSIMULATION_API BufferedMarkersReference
+        : public MarkersReference {
+    OpenSim_DECLARE_CONCRETE_OBJECT(
+            BufferedMarkersReference, MarkersReference);
+ //=============================================================================
+// METHODS
+//=============================================================================
+public:
+    //--------------------------------------------------------------------------
+    // CONSTRUCTION
+    //--------------------------------------------------------------------------
+    BufferedMarkersReference();
+    BufferedMarkersReference(const BufferedMarkersReference&) = default;
+    BufferedMarkersReference(BufferedMarkersReference&&) = default;
+    BufferedMarkersReference& operator=(
+            const BufferedMarkersReference&) = default;
+
+    // Use MarkersReference convenience constructors from file/TimeSeriesTable
+    using MarkersReference::MarkersReference;
+
+    virtual ~BufferedMarkersReference() { stopPrefetch(); }
+
+    //--------------------------------------------------------------------------
+    // Reference Interface
+    //--------------------------------------------------------------------------
+    /** get the time range for which this Reference values are valid,
+        based on the loaded marker data.*/
+    SimTK::Vec2 getValidTimeRange() const override {
+        SimTK::Vec2 tableRange = Super::getValidTimeRange();
+        return SimTK::Vec2(tableRange[0], SimTK::Infinity);
+    };
+
+    /** get the values from the base MarkersReference, or from the client
+     * provided data that was queued earlier using putValues call. While a
+     * prefetch is running (startPrefetch()) values are served from the queue
+     * in table order, so callers must request times in that same order. */
+    void getValuesAtTime(double time,
+            SimTK::Array_<SimTK::Vec3>& values) const override;
+
+    /** add passed in values to data processing Queue */
+    void putValues(double time, const SimTK::RowVector_<SimTK::Vec3>& dataRow);
+
+    /** Switch the underlying DataQueue to its lock-free single-producer
+     * single-consumer ring buffer with numSlots preallocated rows, so the
+     * thread calling putValues(), or the prefetch thread, does not contend
+     * on a mutex with the solver thread. Call once before streaming or
+     * prefetching begins; see DataQueue_::setRingBufferSize(). */
+    void setQueueRingBufferSize(int numSlots) {
+        _markerDataQueue.setRingBufferSize(numSlots, getNumRefs());
+    }
+
+    /** Replay the loaded marker table through the queue on a background
+     * thread, pushing one row at a time in time order so that data
+     * preparation overlaps with solving on the consumer thread. Size the
+     * prefetch window with setQueueRingBufferSize() beforehand; without a
+     * ring buffer the queue is unbounded and the whole table is queued as
+     * fast as the thread can push it. */
+    void startPrefetch();
+    /** Stop the background prefetch thread, if one is running. Called
+     * automatically on destruction. */
+    void stopPrefetch();
+
+    /** get the next frame from the data processing Queue along with its
+     * time stamp; blocks until one is available. */
+    double getNextValuesAndTime(SimTK::Array_<SimTK::Vec3>& values);
+
+    virtual bool hasNext() const override { return !_finished; };
+
+    void setFinished(bool finished) {
+        _finished = finished;
+    };
+private:
+    // State of the background replay thread (startPrefetch()). Held through
+    // a pointer that resets on copy so that copies of this Object never
+    // inherit a running thread.
+    struct Prefetch {
+        std::thread thread;
+        std::atomic<bool> stop{false};
+    };
+
+    // Use a specialized data structure for holding the marker data
+    mutable DataQueue_<SimTK::Vec3> _markerDataQueue;
+    bool _finished{false};
+    SimTK::ResetOnCopy<std::unique_ptr<Prefetch>> _prefetch;
+    //=============================================================================
+};  // END of class BufferedMarkersReference
+//=============================================================================
+} // namespace
+
+#endif // OPENSIM_BUFFERED_MARKERS_REFERENCE_H_
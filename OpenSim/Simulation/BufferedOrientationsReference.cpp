@@ -22,6 +22,7 @@
  * -------------------------------------------------------------------------- */
 #include "BufferedOrientationsReference.h"
 #include "OrientationsReference.h"
+#include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Common/Units.h>
 #include <OpenSim/Common/TRCFileAdapter.h>
 #include <SimTKcommon/internal/State.h>
@@ -36,6 +37,42 @@ BufferedOrientationsReference::BufferedOrientationsReference()
     setAuthors("Ayman Habib");
 }
 
+BufferedOrientationsReference::BufferedOrientationsReference(
+        const BufferedOrientationsReference& other)
+        : OrientationsReference(other),
+          _orientationDataQueue(other._orientationDataQueue),
+          _finished(other._finished.load()),
+          _dropOnOverflow(other._dropOnOverflow) {}
+
+BufferedOrientationsReference::BufferedOrientationsReference(
+        BufferedOrientationsReference&& other)
+        : OrientationsReference(other),
+          _orientationDataQueue(other._orientationDataQueue),
+          _finished(other._finished.load()),
+          _dropOnOverflow(other._dropOnOverflow) {}
+
+BufferedOrientationsReference& BufferedOrientationsReference::operator=(
+        const BufferedOrientationsReference& other) {
+    OrientationsReference::operator=(other);
+    _orientationDataQueue = other._orientationDataQueue;
+    _finished = other._finished.load();
+    _dropOnOverflow = other._dropOnOverflow;
+    return *this;
+}
+
+BufferedOrientationsReference::BufferedOrientationsReference(
+        const std::vector<std::string>& sensorNames,
+        const Set<OrientationWeight>* orientationWeightSet)
+        : OrientationsReference() {
+    setAuthors("Ayman Habib");
+    // No rows are appended: the table only carries the sensor names (and
+    // their order) while all values are served from the queue.
+    _orientationData.setColumnLabels(sensorNames);
+    if (orientationWeightSet != nullptr)
+        upd_orientation_weights() = *orientationWeightSet;
+    populateFromOrientationData();
+}
+
 /** get the values of the OrientationsReference */
 void BufferedOrientationsReference::getValuesAtTime(
         double time, SimTK::Array_<Rotation> &values) const
@@ -43,9 +80,17 @@ void BufferedOrientationsReference::getValuesAtTime(
     auto& times = _orientationData.getIndependentColumn();
     SimTK::RowVector_<SimTK::Rotation> nextRow;
 
-    if (time >= times.front() && time <= times.back()) {
+    if (_prefetch) {
+        // A replay prefetch is running; serve the next queued frame. Frames
+        // are queued in table order so callers must request times in order.
+        double poppedTime(SimTK::NaN);
+        _orientationDataQueue.pop_front(poppedTime, nextRow);
+    } else if (!times.empty() &&
+               time >= times.front() && time <= times.back()) {
         nextRow = _orientationData.getRow(time);
     } else {
+        // No loaded data covers this time (or this is a live reference with
+        // no table at all); serve the next queued frame.
         _orientationDataQueue.pop_front(time, nextRow);
     }
     int n = nextRow.size();
@@ -59,18 +104,77 @@ void BufferedOrientationsReference::getValuesAtTime(
 double BufferedOrientationsReference::getNextValuesAndTime(
         SimTK::Array_<SimTK::Rotation_<double>>& values) {
 
-    double returnTime;
-    SimTK::RowVector_<SimTK::Rotation> nextRow;
-    _orientationDataQueue.pop_front(returnTime, nextRow);
-    int n = nextRow.size();
+    double returnTime(SimTK::NaN);
+    _lastQueueDepth = _orientationDataQueue.getNumQueued();
+    Stopwatch watch;
+    // Wait for the producer, but give up once the stream is marked finished
+    // and the queue has drained so consumers do not wait forever on a
+    // producer that has shut down.
+    while (!_orientationDataQueue.tryPopFront(returnTime, _poppedRow)) {
+        if (_finished && _orientationDataQueue.isEmpty()) {
+            values.clear();
+            return SimTK::NaN;
+        }
+        std::this_thread::yield();
+    }
+    const double waited = watch.getElapsedTime();
+    _lastWaitTime = waited;
+    _totalWaitTime += waited;
+    if (waited > _peakWaitTime) _peakWaitTime = waited;
+    ++_numFramesPopped;
+    int n = _poppedRow.size();
     values.resize(n);
 
-    for (int i = 0; i < n; ++i) { values[i] = nextRow[i]; }
+    for (int i = 0; i < n; ++i) { values[i] = _poppedRow[i]; }
     return returnTime;
 }
 
 void BufferedOrientationsReference::putValues(
         double time, const SimTK::RowVector_<SimTK::Rotation_<double>>& dataRow) {
+    if (_dropOnOverflow) {
+        // Keep the acquisition thread real-time: a full ring means the
+        // consumer is behind, so shed this frame and count it rather than
+        // stall the producer.
+        if (!_orientationDataQueue.tryPushBack(time, dataRow))
+            ++_numDroppedFrames;
+        return;
+    }
     _orientationDataQueue.push_back(time, dataRow);
 }
+
+void BufferedOrientationsReference::startPrefetch()
+{
+    stopPrefetch();
+
+    OPENSIM_THROW_IF(_orientationData.getNumRows() < 1, Exception,
+            "BufferedOrientationsReference::startPrefetch() requires loaded "
+            "orientation data to replay.");
+
+    setFinished(false);
+    _prefetch.reset(new Prefetch());
+    Prefetch* prefetch = _prefetch.get();
+    prefetch->thread = std::thread([this, prefetch]() {
+        const auto& times = _orientationData.getIndependentColumn();
+        const int numRows = (int)_orientationData.getNumRows();
+        for (int i = 0; i < numRows && !prefetch->stop; ++i) {
+            const auto row = _orientationData.getRowAtIndex(i);
+            // Wait for the consumer to drain a slot, but stay responsive
+            // to stopPrefetch().
+            while (!prefetch->stop &&
+                   !_orientationDataQueue.tryPushBack(times[i], row))
+                std::this_thread::yield();
+        }
+        setFinished(true);
+    });
+}
+
+void BufferedOrientationsReference::stopPrefetch()
+{
+    if (!_prefetch) return;
+    _prefetch->stop = true;
+    if (_prefetch->thread.joinable())
+        _prefetch->thread.join();
+    _prefetch.reset();
+}
+
 } // end of namespace OpenSim
\ No newline at end of file
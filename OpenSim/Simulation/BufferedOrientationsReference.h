@@ -25,6 +25,9 @@
 
 #include "OrientationsReference.h"
 #include <OpenSim/Common/DataQueue.h>
+#include <memory>
+#include <thread>
+#include <atomic>
 
 namespace OpenSim {
 
@@ -52,47 +55,165 @@ public:
     // CONSTRUCTION
     //--------------------------------------------------------------------------
     BufferedOrientationsReference();
-    BufferedOrientationsReference(
-            const BufferedOrientationsReference&) = default;
-    BufferedOrientationsReference(BufferedOrientationsReference&&) = default;
+    BufferedOrientationsReference(const BufferedOrientationsReference&);
+    BufferedOrientationsReference(BufferedOrientationsReference&&);
     BufferedOrientationsReference& operator=(
-            const BufferedOrientationsReference&) = default;
+            const BufferedOrientationsReference&);
+
+    /** Construct a purely live reference that has no backing data table:
+     * the named sensors are served exclusively from frames pushed into the
+     * queue (putValues()). Use this for real-time tracking where no file is
+     * loaded; pair with setQueueRingBufferSize() and
+     * InverseKinematicsSolver::setAdvanceTimeFromReference() so frames flow
+     * from the acquisition thread to the solver without any intermediate
+     * TimeSeriesTable construction. */
+    explicit BufferedOrientationsReference(
+            const std::vector<std::string>& sensorNames,
+            const Set<OrientationWeight>* orientationWeightSet = nullptr);
 
     // Use OrientationsReference convenience costructor from TimeSeriesTable
     using OrientationsReference::OrientationsReference;
 
-    virtual ~BufferedOrientationsReference() {}
+    virtual ~BufferedOrientationsReference() { stopPrefetch(); }
 
     //--------------------------------------------------------------------------
     // Reference Interface
     //--------------------------------------------------------------------------
+    /** Number of orientation sensors served by this reference. Based on
+        the sensor names rather than the table contents so that a live
+        reference (constructed from names only) reports its sensor count
+        before any data has been queued. */
+    int getNumRefs() const override { return int(getNames().size()); }
+
     /** get the time range for which this Reference values are valid,
         based on the loaded orientation data.*/
     SimTK::Vec2 getValidTimeRange() const override{
+        if (_orientationData.getNumRows() < 1)
+            return SimTK::Vec2(-SimTK::Infinity, SimTK::Infinity);
         SimTK::Vec2 tableRange = Super::getValidTimeRange();
         return SimTK::Vec2(tableRange[0], SimTK::Infinity);
     };
 
-    /** get the values from the base OrientationsReference, or from
-     * the client provided data that was queued earlier using putValues call. */
+    /** get the values from the base OrientationsReference, or from the
+     * client provided data that was queued earlier using putValues call.
+     * While a prefetch is running (startPrefetch()) values are served from
+     * the queue in table order, so callers must request times in that same
+     * order. */
     void getValuesAtTime(double time,
             SimTK::Array_<SimTK::Rotation_<double>>& values) const override;
 
     /** add passed in values to data procesing Queue */
     void putValues(double time, const SimTK::RowVector_<SimTK::Rotation>& dataRow);
 
+    /** Switch the underlying DataQueue to its lock-free single-producer
+     * single-consumer ring buffer with numSlots preallocated rows, so the
+     * streaming thread calling putValues(), or the prefetch thread, does
+     * not contend on a mutex with the solver thread. Call once before
+     * streaming or prefetching begins; see DataQueue_::setRingBufferSize(). */
+    void setQueueRingBufferSize(int numSlots) {
+        _orientationDataQueue.setRingBufferSize(numSlots, getNumRefs());
+    }
+
+    /** Replay the loaded orientation table through the queue on a background
+     * thread, pushing one row at a time in time order so that data
+     * preparation overlaps with solving on the consumer thread. Size the
+     * prefetch window with setQueueRingBufferSize() beforehand; without a
+     * ring buffer the queue is unbounded and the whole table is queued as
+     * fast as the thread can push it. */
+    void startPrefetch();
+    /** Stop the background prefetch thread, if one is running. Called
+     * automatically on destruction. */
+    void stopPrefetch();
+
+    /** Pop the next queued frame, blocking until one is available. If
+     * setFinished(true) is called (e.g. by the stream producer shutting
+     * down) while waiting and the queue has drained, returns SimTK::NaN
+     * with values left empty so a consumer loop can terminate instead of
+     * waiting on a stream that will never deliver another frame. */
     double getNextValuesAndTime(
             SimTK::Array_<SimTK::Rotation_<double>>& values) override;
 
     virtual bool hasNext() const override { return !_finished; };
 
-    void setFinished(bool finished) { 
+    /** Whether any frames are currently waiting in the queue. Together
+     * with hasNext() this lets a consumer drain frames that were queued
+     * before the producer marked the stream finished. */
+    bool hasQueuedData() const { return !_orientationDataQueue.isEmpty(); }
+
+    void setFinished(bool finished) {
         _finished = finished;
     };
+
+    /** @name Streaming diagnostics
+    Live counters for locating where a real-time tracking loop loses time,
+    updated as frames flow through the queue. Queue depth and wait times
+    are recorded by the consumer as it pops (getNextValuesAndTime());
+    dropped frames are counted by the producer (putValues()) when
+    setDropFramesOnOverflow(true) is in effect. Sample these between
+    frames, or let InverseKinematicsSolver::setTrackingDiagnosticsEnabled()
+    collect them into a per-frame table alongside solve times. */
+    /// @{
+    /** Number of frames currently waiting in the queue. */
+    int getQueueDepth() const { return _orientationDataQueue.getNumQueued(); }
+    /** Queue depth observed when the consumer last asked for a frame; the
+    per-frame backlog between acquisition and solving. */
+    int getLastQueueDepth() const { return _lastQueueDepth; }
+    /** Time, in seconds, the consumer waited for its most recent frame. */
+    double getLastWaitTime() const { return _lastWaitTime; }
+    /** Total time, in seconds, the consumer has spent waiting for frames
+    since the diagnostics were last reset. */
+    double getTotalWaitTime() const { return _totalWaitTime; }
+    /** Longest single wait, in seconds, for any frame. */
+    double getPeakWaitTime() const { return _peakWaitTime; }
+    /** Number of frames the consumer has popped. */
+    long long getNumFramesPopped() const { return _numFramesPopped; }
+
+    /** When the ring buffer is full, drop the incoming frame in putValues()
+    (and count it) instead of blocking the acquisition thread until the
+    consumer catches up. Dropping keeps the producer real-time at the cost
+    of serving the solver older frames; the counter shows how often that
+    trade was taken. Default is false (block). */
+    void setDropFramesOnOverflow(bool drop) { _dropOnOverflow = drop; }
+    /** Number of frames dropped by putValues() because the ring buffer was
+    full while setDropFramesOnOverflow(true) was in effect. */
+    long long getNumDroppedFrames() const { return _numDroppedFrames; }
+
+    /** Clear the wait-time, queue-depth and dropped-frame counters. */
+    void resetStreamingDiagnostics() {
+        _lastQueueDepth = 0;
+        _lastWaitTime = _totalWaitTime = _peakWaitTime = 0;
+        _numFramesPopped = 0;
+        _numDroppedFrames = 0;
+    }
+    /// @}
 private:
+    // State of the background replay thread (startPrefetch()). Held through
+    // a pointer that resets on copy so that copies of this Object never
+    // inherit a running thread.
+    struct Prefetch {
+        std::thread thread;
+        std::atomic<bool> stop{false};
+    };
+
     // Use a specialized data structure for holding the orientation data
     mutable DataQueue_<SimTK::Rotation> _orientationDataQueue;
-    bool _finished{false};
+    // Written by the producer thread (setFinished) and read by the consumer,
+    // so atomic; forces the hand-written copy operations above.
+    std::atomic<bool> _finished{false};
+    // Reused target for rows popped off the queue so streaming consumption
+    // does not allocate per frame.
+    mutable SimTK::RowVector_<SimTK::Rotation> _poppedRow;
+    SimTK::ResetOnCopy<std::unique_ptr<Prefetch>> _prefetch;
+    // Streaming diagnostics. The wait/depth counters are written only by
+    // the consumer thread as it pops; the dropped-frame counter only by the
+    // producer as it pushes, so it is atomic for cross-thread reads.
+    int _lastQueueDepth{0};
+    double _lastWaitTime{0};
+    double _totalWaitTime{0};
+    double _peakWaitTime{0};
+    long long _numFramesPopped{0};
+    bool _dropOnOverflow{false};
+    std::atomic<long long> _numDroppedFrames{0};
     //=============================================================================
 };  // END of class BufferedOrientationsReference
 //=============================================================================
@@ -0,0 +1,92 @@
+/* -------------------------------------------------------------------------- *
+ *                  OpenSim:  CompactStatesTrajectory.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "CompactStatesTrajectory.h"
+
+#include "StatesTrajectory.h"
+
+using namespace OpenSim;
+
+const SimTK::State& CompactStatesTrajectory::get(size_t index) const {
+    OPENSIM_THROW_IF(index >= m_times.size(),
+            IndexOutOfRange,
+            index, 0, static_cast<unsigned>(m_times.size() - 1));
+    return reconstitute(index);
+}
+
+double CompactStatesTrajectory::getTime(size_t index) const {
+    OPENSIM_THROW_IF(index >= m_times.size(),
+            IndexOutOfRange,
+            index, 0, static_cast<unsigned>(m_times.size() - 1));
+    return m_times[index];
+}
+
+void CompactStatesTrajectory::clear() {
+    m_times.clear();
+    m_y.clear();
+    m_numY = -1;
+    m_prototype = SimTK::State();
+    m_workingState = SimTK::State();
+}
+
+void CompactStatesTrajectory::append(const SimTK::State& state) {
+    if (m_numY < 0) {
+        // The first state becomes the prototype; its discrete variables are
+        // shared by every time point in the trajectory.
+        m_prototype = state;
+        m_workingState = state;
+        m_numY = state.getNY();
+    } else {
+        SimTK_APIARGCHECK2_ALWAYS(m_times.back() <= state.getTime(),
+                "CompactStatesTrajectory", "append",
+                "New state's time (%f) must be equal to or greater than the "
+                "time for the last state in the trajectory (%f).",
+                state.getTime(), m_times.back());
+
+        OPENSIM_THROW_IF(state.getNY() != m_numY,
+                InconsistentState, state.getTime());
+    }
+
+    m_times.push_back(state.getTime());
+    const SimTK::Vector& y = state.getY();
+    const size_t offset = m_y.size();
+    m_y.resize(offset + m_numY);
+    for (int i = 0; i < m_numY; ++i)
+        m_y[offset + i] = y[i];
+}
+
+StatesTrajectory CompactStatesTrajectory::expand() const {
+    StatesTrajectory states;
+    for (size_t i = 0; i < m_times.size(); ++i)
+        states.append(reconstitute(i));
+    return states;
+}
+
+const SimTK::State& CompactStatesTrajectory::reconstitute(size_t index) const {
+    m_workingState.setTime(m_times[index]);
+    SimTK::Vector& y = m_workingState.updY();
+    const double* src = &m_y[index * m_numY];
+    for (int i = 0; i < m_numY; ++i)
+        y[i] = src[i];
+    return m_workingState;
+}
+
@@ -0,0 +1,155 @@
+#ifndef OPENSIM_COMPACT_STATES_TRAJECTORY_H_
+#define OPENSIM_COMPACT_STATES_TRAJECTORY_H_
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  CompactStatesTrajectory.h                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <vector>
+
+#include <OpenSim/Common/Exception.h>
+#include <SimTKcommon.h>
+
+#include "osimSimulationDLL.h"
+
+namespace OpenSim {
+
+class StatesTrajectory;
+
+/**
+ * A memory-efficient sequence of SimTK::State%s sampled during a simulation.
+ *
+ * A StatesTrajectory stores a full deep copy of the SimTK::State at every
+ * time point. Each copy carries not only the continuous state variables (Y)
+ * but also every discrete variable, modeling option, and per-subsystem cache
+ * allocation -- typically an order of magnitude more memory than the Y
+ * vector itself, which is what makes dense reporting of long simulations
+ * exhaust RAM.
+ *
+ * This class instead stores one full prototype state (the first state
+ * appended) and, for every time point, only the time and the packed Y
+ * vector. The discrete variables and modeling options of the prototype are
+ * shared by all time points. Accessing a state reconstitutes it on demand
+ * into an internal working state.
+ *
+ * \section cst_limits Limitations
+ * - The discrete variables and modeling options must not change over the
+ *   trajectory; only the first state's values are kept. This holds for
+ *   ordinary forward simulations. If your simulation changes discrete
+ *   variables mid-run (e.g., event handlers that re-parameterize contact),
+ *   use StatesTrajectory instead.
+ * - get() and operator[] return a reference to the internal working state;
+ *   the reference is overwritten by the next access. Copy the state if you
+ *   need two time points at once.
+ * - The reconstituted state is realized only through SimTK::Stage::Time;
+ *   realize it with your model's system before computing cache-dependent
+ *   quantities, as you would for a deserialized state.
+ *
+ * @see StatesTrajectory
+ */
+class OSIMSIMULATION_API CompactStatesTrajectory {
+public:
+    /** The number of states in the trajectory. */
+    size_t getSize() const { return m_times.size(); }
+
+    /// @name Accessing individual SimTK::State%s
+    /// @{
+    /** Reconstitute the state at a given index in the trajectory. The
+     * returned reference points to an internal working state and is
+     * overwritten by the next access; copy it if it must outlive that.
+     * This function does not check if the index is larger than the size of
+     * the trajectory; see get() if you want this check. */
+    const SimTK::State& operator[](size_t index) const {
+        return reconstitute(index);
+    }
+    /** Reconstitute the state at a given index in the trajectory. The
+     * returned reference points to an internal working state and is
+     * overwritten by the next access; copy it if it must outlive that.
+     *
+     * @throws IndexOutOfRange If the index is greater than the size of the
+     *                         trajectory.
+     */
+    const SimTK::State& get(size_t index) const;
+    /** The time of the state at a given index, without reconstituting it.
+     *
+     * @throws IndexOutOfRange If the index is greater than the size of the
+     *                         trajectory.
+     */
+    double getTime(size_t index) const;
+    /// @}
+
+    /// @name Modify the contents of the trajectory
+    /// @{
+    /** Clear all the states in the trajectory. */
+    void clear();
+    /** Append a SimTK::State to this trajectory. The first state appended
+     * becomes the prototype that provides the discrete variables for the
+     * whole trajectory; subsequent states contribute only their time and
+     * continuous state variables.
+     *
+     * This function ensures that the time in the new SimTK::State is greater
+     * than or equal to the time in the last SimTK::State in the trajectory,
+     * and that the number of continuous state variables matches the
+     * prototype.
+     */
+    void append(const SimTK::State& state);
+    /// @}
+
+    /** Expand into a StatesTrajectory holding a full deep copy of every
+     * state, for use with APIs that require one. This reintroduces the
+     * per-state memory cost that this class avoids. */
+    StatesTrajectory expand() const;
+
+    /** Thrown when trying to append a state whose number of continuous
+     * state variables differs from the prototype's. */
+    class InconsistentState : public OpenSim::Exception {
+    public:
+        InconsistentState(const std::string& file, size_t line,
+                const std::string& func, const double& stateTime) :
+                OpenSim::Exception(file, line, func) {
+            std::ostringstream msg;
+            msg << "Cannot append the provided state (at time = " <<
+                stateTime << " seconds) to the trajectory because it is " <<
+                "inconsistent with the trajectory.";
+            addMessage(msg.str());
+        }
+    };
+
+private:
+    const SimTK::State& reconstitute(size_t index) const;
+
+    /** Times, one per state. */
+    std::vector<double> m_times;
+    /** Continuous state variables, packed one state after another;
+    m_y.size() == m_times.size() * m_numY. */
+    std::vector<double> m_y;
+    /** Number of continuous state variables per state; -1 until the first
+    state is appended. */
+    int m_numY = -1;
+    /** Deep copy of the first appended state; provides the discrete
+    variables and modeling options for every reconstituted state. */
+    SimTK::State m_prototype;
+    /** The state handed out by get(); rebuilt on each access. */
+    mutable SimTK::State m_workingState;
+};
+
+} // namespace
+
+#endif // OPENSIM_COMPACT_STATES_TRAJECTORY_H_
@@ -0,0 +1,96 @@
+/* -------------------------------------------------------------------------- *
+ *                  OpenSim:  ExternalInputController.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+//=============================================================================
+// INCLUDES
+//=============================================================================
+#include "ExternalInputController.h"
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/Actuator.h>
+
+using namespace OpenSim;
+
+//=============================================================================
+// CONSTRUCTOR(S) AND DESTRUCTOR
+//=============================================================================
+ExternalInputController::ExternalInputController() :
+    Controller()
+{
+}
+
+ExternalInputController::~ExternalInputController()
+{
+}
+
+void ExternalInputController::extendConnectToModel(Model& model)
+{
+    Super::extendConnectToModel(model);
+
+    // (Re)allocate one slot per controlled actuator, initially zero.
+    const int numActuators = getActuatorSet().getSize();
+    _slots.reset(new std::atomic<double>[numActuators]);
+    for (int i = 0; i < numActuators; ++i)
+        _slots[i].store(0.0, std::memory_order_relaxed);
+    _numSlots = numActuators;
+}
+
+//=============================================================================
+// CONTROL
+//=============================================================================
+void ExternalInputController::computeControls(const SimTK::State& s,
+        SimTK::Vector& controls) const
+{
+    if (!_slots)
+        return;
+
+    SimTK::Vector actControls(1, 0.0);
+    const Set<const Actuator>& actuators = getActuatorSet();
+    for (int i = 0; i < actuators.getSize(); ++i) {
+        actControls[0] = _slots[i].load(std::memory_order_acquire);
+        actuators[i].addInControls(actControls, controls);
+    }
+}
+
+//=============================================================================
+// GET AND SET
+//=============================================================================
+void ExternalInputController::setInputValue(int index, double value)
+{
+    checkSlotIndex(index);
+    _slots[index].store(value, std::memory_order_release);
+}
+
+double ExternalInputController::getInputValue(int index) const
+{
+    checkSlotIndex(index);
+    return _slots[index].load(std::memory_order_acquire);
+}
+
+void ExternalInputController::checkSlotIndex(int index) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!_slots, Exception,
+            "ExternalInputController has no input slots; connect the "
+            "controller to a model first.");
+    OPENSIM_THROW_IF_FRMOBJ(index < 0 || index >= _numSlots,
+            Exception, "Slot index was {} but must be in [0, {}).",
+            index, (int)_numSlots);
+}
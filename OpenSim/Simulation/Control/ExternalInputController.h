@@ -0,0 +1,118 @@
+#ifndef OPENSIM_EXTERNAL_INPUT_CONTROLLER_H_
+#define OPENSIM_EXTERNAL_INPUT_CONTROLLER_H_
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  ExternalInputController.h                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Controller.h"
+
+#include <atomic>
+#include <memory>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * ExternalInputController feeds live, externally produced control values to
+ * its actuators while an integration is running.
+ *
+ * Each controlled actuator gets a lock-free input slot. An external thread
+ * (for example, one reading sensor torques from hardware) writes the latest
+ * value with setInputValue(); every time the integrator computes controls,
+ * computeControls() reads whatever each slot currently holds. There is no
+ * need to stop the Manager, mutate the model, and restart it: the writer and
+ * the simulation thread never block each other.
+ *
+ * Each slot is individually atomic, so a reader never sees a torn value, but
+ * no snapshot is taken across slots: controls written while computeControls()
+ * is sweeping the slots may mix old and new values across channels within
+ * one evaluation. For control inputs updated much faster than they change
+ * meaningfully, this is the behavior hardware-in-the-loop setups want.
+ *
+ * The slots exist once the controller is connected to its model; writing
+ * before then throws.
+ */
+//=============================================================================
+
+class OSIMSIMULATION_API ExternalInputController : public Controller {
+OpenSim_DECLARE_CONCRETE_OBJECT(ExternalInputController, Controller);
+
+//=============================================================================
+// METHODS
+//=============================================================================
+public:
+    /** Default constructor */
+    ExternalInputController();
+
+    /** Destructor */
+    virtual ~ExternalInputController();
+
+    //--------------------------------------------------------------------------
+    // CONTROL
+    //--------------------------------------------------------------------------
+    /**
+     * Read the current slot values and apply them as the controls for this
+     * controller's actuators.
+     *
+     * @param s             system state
+     * @param controls      model controls
+     */
+    void computeControls(const SimTK::State& s,
+                         SimTK::Vector& controls) const override;
+
+    /**
+     * Write the control value for the actuator at `index` (the actuator's
+     * index in this controller's actuator set). Lock-free and safe to call
+     * from a thread other than the one driving the integration.
+     * @throws Exception if the controller is not yet connected to a model or
+     *         the index is out of range.
+     */
+    void setInputValue(int index, double value);
+
+    /** The value the slot at `index` currently holds. */
+    double getInputValue(int index) const;
+
+    /** Number of input slots; equals the number of controlled actuators
+    once the controller is connected, zero before. */
+    int getNumInputSlots() const { return _numSlots; }
+
+protected:
+    /** Model component interface */
+    void extendConnectToModel(Model& model) override;
+
+private:
+    void checkSlotIndex(int index) const;
+
+    // One lock-free slot per controlled actuator, allocated at connect.
+    // Heap-held and reset on copy (atomics are not copyable); a copied
+    // controller re-allocates its slots when it is connected.
+    SimTK::ResetOnCopy<std::unique_ptr<std::atomic<double>[]>> _slots;
+    SimTK::ResetOnCopy<int> _numSlots{0};
+
+//=============================================================================
+};  // END of class ExternalInputController
+
+}; //namespace
+//=============================================================================
+//=============================================================================
+
+#endif // OPENSIM_EXTERNAL_INPUT_CONTROLLER_H_
@@ -161,16 +161,48 @@ void PrescribedController::extendConnectToModel(Model& model)
 }
 
 
+void PrescribedController::extendRealizeTopology(SimTK::State& state) const
+{
+    Super::extendRealizeTopology(state);
+
+    // Compile the controls plan: resolve each actuator's control function
+    // once, here, so computeControls() is a flat sweep over cached pointers
+    // instead of per-call property and Set lookups. If the functions don't
+    // cover the actuators yet, leave the plan empty and let the fallback
+    // path report the problem as before.
+    _controlPlan.clear();
+    const FunctionSet& controlFuncs = get_ControlFunctions();
+    const Set<const Actuator>& actuators = getActuatorSet();
+    if(controlFuncs.getSize() < actuators.getSize())
+        return;
+    _controlPlan.reserve(actuators.getSize());
+    for(int i=0; i<actuators.getSize(); i++)
+        _controlPlan.emplace_back(&controlFuncs[i], &actuators[i]);
+    _planTime.resize(1);
+    _planControl.resize(1);
+}
+
 // compute the control value for an actuator
 void PrescribedController::computeControls(const SimTK::State& s, SimTK::Vector& controls) const
 {
+    // Fast path: the plan compiled at realizeTopology. No allocations, no
+    // property lookups, no virtual Set indexing.
+    if(!_controlPlan.empty()){
+        _planTime[0] = s.getTime();
+        for(const auto& entry : _controlPlan){
+            _planControl[0] = entry.first->calcValue(_planTime);
+            entry.second->addInControls(_planControl, controls);
+        }
+        return;
+    }
+
     SimTK::Vector actControls(1, 0.0);
     SimTK::Vector time(1, s.getTime());
 
     for(int i=0; i<getActuatorSet().getSize(); i++){
         actControls[0] = get_ControlFunctions()[i].calcValue(time);
         getActuatorSet()[i].addInControls(actControls, controls);
-    }  
+    }
 }
 
 
@@ -190,7 +222,10 @@ void PrescribedController::
 
     if(index >= get_ControlFunctions().getSize())
         upd_ControlFunctions().setSize(index+1);
-    upd_ControlFunctions().set(index, prescribedFunction);  
+    upd_ControlFunctions().set(index, prescribedFunction);
+    // The replaced function may have been cached in the controls plan;
+    // recompiled at the next realizeTopology.
+    _controlPlan.clear();
 }
 
 void PrescribedController::
@@ -26,6 +26,9 @@
 #include "Controller.h"
 #include <OpenSim/Common/FunctionSet.h>
 
+#include <utility>
+#include <vector>
+
 
 namespace OpenSim { 
 
@@ -119,6 +122,9 @@ public:
 protected:
     /** Model component interface */
     void extendConnectToModel(Model& model) override;
+    /** Compile the controls plan once the underlying system is built so
+    computeControls() does no property lookups or Set dispatch per call. */
+    void extendRealizeTopology(SimTK::State& state) const override;
 private:
     // construct and initialize properties
     void constructProperties();
@@ -130,6 +136,20 @@ private:
     // This method sets all member variables to default (e.g., NULL) values.
     void setNull();
 
+    // Controls plan compiled by extendRealizeTopology(): one entry per
+    // actuator pairing its control function with the actuator it drives.
+    // Cleared whenever a control function is (re)assigned so stale pointers
+    // are never evaluated; computeControls() falls back to the property
+    // lookups until the plan is recompiled. ResetOnCopy so a copy never
+    // points into the original's function and actuator sets.
+    mutable SimTK::ResetOnCopy<
+            std::vector<std::pair<const Function*, const Actuator*>>>
+        _controlPlan;
+    // Scratch vectors reused by computeControls() to avoid allocating on
+    // every call.
+    mutable SimTK::Vector _planTime;
+    mutable SimTK::Vector _planControl;
+
 //=============================================================================
 };  // END of class PrescribedController
 
@@ -25,6 +25,10 @@
 #include "Model/Model.h"
 #include <OpenSim/Common/FunctionSet.h>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 using namespace std;
 using namespace SimTK;
 
@@ -195,4 +199,87 @@ void InverseDynamicsSolver::solve(SimTK::State& s, const FunctionSet& Qs,
     }
 }
 
+/** Solve a full trajectory of known kinematics, parallelizing across frames. */
+void InverseDynamicsSolver::solveTrajectory(const std::vector<double>& times,
+        const SimTK::Matrix& q, const SimTK::Matrix& u,
+        const SimTK::Matrix& udot, TimeSeriesTable& genForcesTable) const
+{
+    const int nt = (int)times.size();
+    const int nq = getModel().getNumCoordinates();
+    const int nu = getModel().getNumSpeeds();
+
+    if (q.nrow() != nt || u.nrow() != nt || udot.nrow() != nt) {
+        throw Exception("InverseDynamicsSolver::solveTrajectory q, u and "
+                        "udot must have one row per time.");
+    }
+    if (q.ncol() != nq || u.ncol() != nu || udot.ncol() != nu) {
+        throw Exception("InverseDynamicsSolver::solveTrajectory q, u and "
+                        "udot have invalid numbers of columns.");
+    }
+
+    SimTK::Matrix results(nt, nu);
+
+    std::atomic<int> nextFrame(0);
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    // Frames are independent; each worker solves them with its own copy of
+    // the model and its own state so no solver data is shared.
+    auto worker = [&]() {
+        try {
+            Model threadModel(getModel());
+            SimTK::State ts = threadModel.initSystem();
+            InverseDynamicsSolver threadSolver(threadModel);
+            Vector udotFrame(nu);
+            while (true) {
+                const int i = nextFrame++;
+                if (i >= nt)
+                    break;
+                ts.updTime() = times[i];
+                ts.updQ() = ~q.row(i);
+                ts.updU() = ~u.row(i);
+                udotFrame = ~udot.row(i);
+                results.updRow(i) = ~threadSolver.solve(ts, udotFrame);
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError)
+                firstError = std::current_exception();
+        }
+    };
+
+    int numThreads = (int)std::thread::hardware_concurrency();
+    if (numThreads < 1)
+        numThreads = 1;
+    if (numThreads > nt)
+        numThreads = nt;
+
+    if (numThreads <= 1) {
+        worker();
+    }
+    else {
+        std::vector<std::thread> threads;
+        for (int i = 1; i < numThreads; ++i)
+            threads.emplace_back(worker);
+        worker();
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    if (firstError)
+        std::rethrow_exception(firstError);
+
+    // Label the generalized forces by the model's coordinate names, as the
+    // InverseDynamicsTool does; fall back to mobility indices when the
+    // coordinates do not map one-to-one onto the speeds.
+    std::vector<std::string> labels(nu);
+    const CoordinateSet& coords = getModel().getCoordinateSet();
+    for (int i = 0; i < nu; ++i)
+        labels[i] = (nq == nu) ? coords[i].getName()
+                               : "mobility_force_" + std::to_string(i);
+
+    genForcesTable = TimeSeriesTable(times, results, labels);
+}
+
 } // end of namespace OpenSim
\ No newline at end of file
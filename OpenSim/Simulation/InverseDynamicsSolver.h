@@ -25,6 +25,7 @@
 
 #include "Solver.h"
 #include "SimTKcommon/internal/State.h"
+#include <OpenSim/Common/TimeSeriesTable.h>
 
 namespace OpenSim {
 
@@ -117,10 +118,24 @@ public:
        This adds an extra vector, coordinatesToSpeedsIndexMap, which is the length of number of
        u's in the SimTK::State, and whose i'th index is the index of the
        FunctionSet Qs from which each 'u' and 'udot' will be calculated. */ 
-    virtual void solve(SimTK::State& s, const FunctionSet& Qs, 
+    virtual void solve(SimTK::State& s, const FunctionSet& Qs,
             const std::vector<int> coordinatesToSpeedsIndexMap,
             const SimTK::Array_<double>& times,
             SimTK::Array_<SimTK::Vector>& genForceTrajectory);
+
+    /** Solve inverse dynamics for a full trajectory of known kinematics and
+        write the generalized forces into the provided TimeSeriesTable (its
+        previous contents are replaced; column labels are the model's
+        coordinate names). Row i of q, u and udot holds the generalized
+        coordinates, speeds and accelerations at times[i], each in the order
+        of the SimTK::State. Frames are independent, so they are solved in
+        parallel on as many threads as the hardware provides, each with its
+        own copy of the model and its own state (initialized to the model's
+        default state; see the NOTE on the function-based solve above). */
+    virtual void solveTrajectory(const std::vector<double>& times,
+            const SimTK::Matrix& q, const SimTK::Matrix& u,
+            const SimTK::Matrix& udot,
+            TimeSeriesTable& genForcesTable) const;
 #endif
 //=============================================================================
 };  // END of class InverseDynamicsSolver
@@ -25,6 +25,11 @@
 #include "Model/Model.h"
 #include "Model/MarkerSet.h"
 
+#include <OpenSim/Common/Stopwatch.h>
+
+#include <algorithm>
+#include <cmath>
+
 #include "simbody/internal/AssemblyCondition_Markers.h"
 #include "simbody/internal/AssemblyCondition_OrientationSensors.h"
 
@@ -228,9 +233,31 @@ SimTK::Vec3 InverseKinematicsSolver::computeCurrentMarkerLocation(int markerInde
 /* Compute and return the spatial locations of all markers in ground. */
 void InverseKinematicsSolver::computeCurrentMarkerLocations(SimTK::Array_<SimTK::Vec3> &markerLocations)
 {
-    markerLocations.resize(_markerAssemblyCondition->getNumMarkers());
+    // Use the cached parent mobilized bodies and station vectors to compute
+    // all marker locations in one pass over the assembled configuration,
+    // rather than querying the assembly condition one marker at a time.
+    const SimTK::State& state = getAssembler().getInternalState();
+    getModel().getMultibodySystem().realize(state, SimTK::Stage::Position);
+    const SimTK::SimbodyMatterSubsystem& matter =
+        getModel().getMatterSubsystem();
+
+    markerLocations.resize(_markerMobodIndices.size());
     for(unsigned int i=0; i<markerLocations.size(); i++)
-        markerLocations[i] = _markerAssemblyCondition->findCurrentMarkerLocation(SimTK::Markers::MarkerIx(i));
+        markerLocations[i] = matter.getMobilizedBody(_markerMobodIndices[i])
+            .findStationLocationInGround(state, _markerStations[i]);
+}
+
+/* Compute the locations of all markers in ground along with the station
+   Jacobian mapping generalized speeds to marker velocities in ground. */
+void InverseKinematicsSolver::computeCurrentMarkerLocationsAndJacobian(
+        SimTK::Array_<SimTK::Vec3>& markerLocations,
+        SimTK::Matrix& stationJacobian)
+{
+    computeCurrentMarkerLocations(markerLocations);
+    // Batched station Jacobian for all cached marker stations at once.
+    getModel().getMatterSubsystem().calcStationJacobian(
+        getAssembler().getInternalState(),
+        _markerMobodIndices, _markerStations, stationJacobian);
 }
 
 
@@ -314,14 +341,23 @@ SimTK::Rotation InverseKinematicsSolver::computeCurrentSensorOrientation(int ose
         throw Exception("InverseKinematicsSolver::computeCurrentOSensorOrientation: invalid osensorIndex.");
 }
 
-/* Compute and return the spatial locations of all markers in ground. */
+/* Compute and return the spatial orientations of all o-sensors in ground. */
 void InverseKinematicsSolver::computeCurrentSensorOrientations(
         SimTK::Array_<SimTK::Rotation>& osensorOrientations)
 {
-    osensorOrientations.resize(_orientationAssemblyCondition->getNumOSensors());
-    for (unsigned int i = 0; i< osensorOrientations.size(); i++)
+    osensorOrientations.resize(_osensorMobodIndices.size());
+
+    // All sensor orientations are composed from the same realization of the
+    // assembled configuration, rather than realizing per sensor.
+    const SimTK::State& state = getAssembler().getInternalState();
+    getModel().getMultibodySystem().realize(state, SimTK::Stage::Position);
+
+    const SimTK::SimbodyMatterSubsystem& matter = getModel().getMatterSubsystem();
+    for (unsigned int i = 0; i < osensorOrientations.size(); ++i) {
         osensorOrientations[i] =
-            _orientationAssemblyCondition->findCurrentOSensorOrientation(SimTK::OrientationSensors::OSensorIx(i));
+            matter.getMobilizedBody(_osensorMobodIndices[i])
+                .getBodyRotation(state) * _osensorRotationsInBody[i];
+    }
 }
 
 
@@ -349,14 +385,43 @@ double InverseKinematicsSolver::computeCurrentOrientationError(int osensorIndex)
             "invalid sensor Index." );
 }
 
-/* Compute and return the distance between all model o-sensors and their observations. */
+/* Compute and return the angles between all model o-sensors and their observations. */
 void InverseKinematicsSolver::computeCurrentOrientationErrors(
                                           SimTK::Array_<double>& osensorErrors)
 {
-    osensorErrors.resize(_orientationAssemblyCondition->getNumOSensors());
-    for (unsigned int i = 0; i<osensorErrors.size(); i++)
-        osensorErrors[i] = _orientationAssemblyCondition->
-        findCurrentOSensorError(OrientationSensors::OSensorIx(i));
+    SimTK::Array_<SimTK::Rotation> osensorOrientations;
+    computeCurrentSensorOrientationsAndErrors(
+        osensorOrientations, osensorErrors);
+}
+
+/* Compute the orientations of all o-sensors and their errors in one batched
+   pass over the cached sensor bank. */
+void InverseKinematicsSolver::computeCurrentSensorOrientationsAndErrors(
+        SimTK::Array_<SimTK::Rotation>& osensorOrientations,
+        SimTK::Array_<double>& osensorErrors)
+{
+    computeCurrentSensorOrientations(osensorOrientations);
+
+    const int numOSensors = (int)osensorOrientations.size();
+    osensorErrors.resize(numOSensors);
+
+    for (int i = 0; i < numOSensors; ++i) {
+        const int ox = _osensorObservationIxs[i];
+        if (ox < 0) { // no observation for this o-sensor
+            osensorErrors[i] = 0;
+            continue;
+        }
+        const Rotation& R_GO = _orientationAssemblyCondition->getObservation(
+            SimTK::OrientationSensors::ObservationIx(ox));
+        if (!R_GO.asMat33().isFinite()) { // NaN observation; error is ignored
+            osensorErrors[i] = 0;
+            continue;
+        }
+        // angle of the relative rotation between the model sensor and its
+        // observation, as the assembly condition defines the sensor error
+        const Rotation R_SO = ~osensorOrientations[i]*R_GO;
+        osensorErrors[i] = std::abs(R_SO.convertRotationToAngleAxis()[0]);
+    }
 }
 
 /* Orientation errors may be reported in an order that may be different from
@@ -403,6 +468,8 @@ void InverseKinematicsSolver::setupMarkersGoal(SimTK::State &s)
 
     int index = -1;
     SimTK::Transform X_BF;
+    _markerMobodIndices.clear();
+    _markerStations.clear();
     //Loop through all markers in the reference
     for (unsigned int i = 0; i < markerNames.size(); ++i) {
         // Check if we have this marker in the model, else ignore it
@@ -413,9 +480,13 @@ void InverseKinematicsSolver::setupMarkersGoal(SimTK::State &s)
                 marker.getParentFrame().getMobilizedBody();
 
             X_BF = marker.getParentFrame().findTransformInBaseFrame();
+            const SimTK::Vec3 station = X_BF*marker.get_location();
             _markerAssemblyCondition->
-                addMarker(marker.getName(), mobod, X_BF*marker.get_location(),
-                    markerWeights[i]);
+                addMarker(marker.getName(), mobod, station, markerWeights[i]);
+            // Cache the marker's parent mobilized body and station vector so
+            // marker queries can be computed in a single batched pass.
+            _markerMobodIndices.push_back(mobod.getMobilizedBodyIndex());
+            _markerStations.push_back(station);
         }
     }
 
@@ -446,28 +517,161 @@ void InverseKinematicsSolver::setupOrientationsGoal(SimTK::State &s)
 
     SimTK::Array_<double> orientationWeights;
     _orientationsReference->getWeights(s, orientationWeights);
-    // get orientation sensors defined by the model 
+    // get orientation sensors defined by the model
     const auto onFrames = getModel().getComponentList<PhysicalFrame>();
 
+    _osensorMobodIndices.clear();
+    _osensorRotationsInBody.clear();
     for (const auto& modelFrame : onFrames) {
         const std::string& modelFrameName = modelFrame.getName();
         auto found = std::find(osensorNames.begin(), osensorNames.end(), modelFrameName);
         if (found != osensorNames.end()) {
             int index = (int)std::distance(osensorNames.begin(), found);
+            const SimTK::Rotation R_BS =
+                modelFrame.findTransformInBaseFrame().R();
             _orientationAssemblyCondition->addOSensor(modelFrameName,
-                modelFrame.getMobilizedBodyIndex(),
-                modelFrame.findTransformInBaseFrame().R(),
+                modelFrame.getMobilizedBodyIndex(), R_BS,
                 orientationWeights[index]);
+            // Cache the sensor's parent mobilized body and fixed rotation so
+            // sensor queries can be computed in a single batched pass.
+            _osensorMobodIndices.push_back(modelFrame.getMobilizedBodyIndex());
+            _osensorRotationsInBody.push_back(R_BS);
         }
     }
 
-    // Add orientations goal to the ik objective and transfer ownership of the 
+    // Add orientations goal to the ik objective and transfer ownership of the
     // goal (AssemblyCondition) to Assembler
     updAssembler().adoptAssemblyGoal(condOwner.release());
     // lock-in the order that the observations (orientations) are in and this
     // cannot change from frame to frame and we can use an array of just the
     // data for updating
     _orientationAssemblyCondition->defineObservationOrder(osensorNames);
+
+    // With the observation order locked in, cache each sensor's observation
+    // index so the batched error kernel does not look it up per sensor.
+    const int numOSensors = _orientationAssemblyCondition->getNumOSensors();
+    _osensorObservationIxs.clear();
+    for (int i = 0; i < numOSensors; ++i) {
+        const SimTK::OrientationSensors::ObservationIx ox =
+            _orientationAssemblyCondition->getObservationIxForOSensor(
+                SimTK::OrientationSensors::OSensorIx(i));
+        _osensorObservationIxs.push_back(ox.isValid() ? (int)ox : -1);
+    }
+}
+
+/* Set the real-time latency budget for track(); 0 disables it. */
+void InverseKinematicsSolver::setTrackingLatencyBudget(double seconds)
+{
+    OPENSIM_THROW_IF(seconds < 0, Exception,
+        "InverseKinematicsSolver::setTrackingLatencyBudget: "
+        "budget cannot be negative.");
+    _latencyBudget = seconds;
+    _workingAccuracy = getAccuracy();
+    resetTrackingStatistics();
+}
+
+double InverseKinematicsSolver::getMeanTrackingTime() const
+{
+    return _numTrackedFrames > 0 ? _sumTrackingTime/_numTrackedFrames : 0;
+}
+
+double InverseKinematicsSolver::getTrackingTimeJitter() const
+{
+    if (_numTrackedFrames < 2)
+        return 0;
+    const double mean = _sumTrackingTime/_numTrackedFrames;
+    const double variance =
+        _sumSquaredTrackingTime/_numTrackedFrames - mean*mean;
+    return variance > 0 ? std::sqrt(variance) : 0;
+}
+
+void InverseKinematicsSolver::resetTrackingStatistics()
+{
+    _numTrackedFrames = 0;
+    _numBudgetOverruns = 0;
+    _sumTrackingTime = 0;
+    _sumSquaredTrackingTime = 0;
+    _peakTrackingTime = 0;
+}
+
+/* Enable or disable per-frame diagnostics recording; enabling (re)starts
+   an empty table. */
+void InverseKinematicsSolver::setTrackingDiagnosticsEnabled(bool enabled)
+{
+    _recordDiagnostics = enabled;
+    _diagnosticsTable = TimeSeriesTable();
+    if (enabled) {
+        _diagnosticsTable.setColumnLabels({"time", "queue_depth",
+                "wait_time", "solve_time", "working_accuracy",
+                "dropped_frames"});
+    }
+}
+
+/* Track the references, respecting the latency budget when one is set. */
+void InverseKinematicsSolver::track(SimTK::State& s)
+{
+    if (_latencyBudget <= 0 && !_recordDiagnostics) {
+        AssemblySolver::track(s);
+        return;
+    }
+
+    // Never let the working accuracy get looser than this, or the solution
+    // drifts too far to be refined within a frame or two.
+    const double loosestAccuracy = 1e-2;
+
+    if (_latencyBudget > 0)
+        updAssembler().setAccuracy(_workingAccuracy);
+    Stopwatch watch;
+    AssemblySolver::track(s);
+    const double elapsed = watch.getElapsedTime();
+
+    ++_numTrackedFrames;
+    _sumTrackingTime += elapsed;
+    _sumSquaredTrackingTime += elapsed*elapsed;
+    if (elapsed > _peakTrackingTime)
+        _peakTrackingTime = elapsed;
+
+    if (_latencyBudget > 0 && elapsed > _latencyBudget) {
+        ++_numBudgetOverruns;
+        // Loosen so the following frames return within budget; they start
+        // from this frame's solution and refine it once the budget allows.
+        _workingAccuracy = std::min(10*_workingAccuracy, loosestAccuracy);
+        log_debug("InverseKinematicsSolver::track at time {} took {}ms "
+                  "(budget {}ms); working accuracy loosened to {}.",
+            s.getTime(), 1000*elapsed, 1000*_latencyBudget, _workingAccuracy);
+    }
+    else if (_latencyBudget > 0 && elapsed < 0.5*_latencyBudget &&
+             _workingAccuracy > getAccuracy()) {
+        // Comfortably inside the budget: spend the slack refining the
+        // solution carried over from the frames solved coarsely above.
+        _workingAccuracy = std::max(0.1*_workingAccuracy, getAccuracy());
+    }
+
+    if (_recordDiagnostics) {
+        // Queue metrics come from the streaming reference when one is in
+        // use; a plain (table-backed) reference has no queue to report.
+        int queueDepth = 0;
+        double waitTime = 0;
+        long long droppedFrames = 0;
+        if (const auto* buffered =
+                dynamic_cast<const BufferedOrientationsReference*>(
+                        _orientationsReference.get())) {
+            queueDepth = buffered->getLastQueueDepth();
+            waitTime = buffered->getLastWaitTime();
+            droppedFrames = buffered->getNumDroppedFrames();
+        }
+        SimTK::RowVector row(6);
+        row[0] = s.getTime();
+        row[1] = queueDepth;
+        row[2] = waitTime;
+        row[3] = elapsed;
+        row[4] = _latencyBudget > 0 ? _workingAccuracy : getAccuracy();
+        row[5] = (double)droppedFrames;
+        // Frames are numbered rather than time-stamped so the table stays
+        // valid even if a frame repeats or rewinds the solve time.
+        _diagnosticsTable.appendRow(
+                (double)_diagnosticsTable.getNumRows(), row);
+    }
 }
 
 /* Internal method to update the time, reference values and/or their weights based
@@ -481,12 +685,17 @@ void InverseKinematicsSolver::updateGoals(SimTK::State &s)
         double nextTime = NaN;
         if (_orientationsReference &&
                 _orientationsReference->getNumRefs() > 0) {
-            SimTK::Array_<SimTK::Rotation> orientationValues;
             nextTime = _orientationsReference->getNextValuesAndTime(
-                    orientationValues);
-            s.setTime(nextTime);
-            _orientationAssemblyCondition->moveAllObservations(
-                    orientationValues);
+                    _orientationObservationsScratch);
+            // A streaming reference returns NaN once its producer has
+            // finished and the queue has drained; keep the previous
+            // observations (and time) so the caller can notice the stream
+            // ended without the solve blowing up.
+            if (!SimTK::isNaN(nextTime)) {
+                s.setTime(nextTime);
+                _orientationAssemblyCondition->moveAllObservations(
+                        _orientationObservationsScratch);
+            }
         }
         // update coordinates if any based on new time
         AssemblySolver::updateGoals(s);
@@ -496,18 +705,22 @@ void InverseKinematicsSolver::updateGoals(SimTK::State &s)
     AssemblySolver::updateGoals(s);
 
     double nextTime = s.getTime();
-    // specify the marker observations to be matched
+    // specify the marker observations to be matched; observations are staged
+    // through member scratch arrays so tracking at high rates does not
+    // reallocate them every frame
     if (_markersReference && _markersReference->getNumRefs() > 0) {
-        SimTK::Array_<SimTK::Vec3> markerValues;
-        _markersReference->getValuesAtTime(nextTime, markerValues);
-        _markerAssemblyCondition->moveAllObservations(markerValues);
+        _markersReference->getValuesAtTime(
+                nextTime, _markerObservationsScratch);
+        _markerAssemblyCondition->moveAllObservations(
+                _markerObservationsScratch);
     }
 
     // specify the orientation observations to be matched
     if (_orientationsReference && _orientationsReference->getNumRefs() > 0) {
-        SimTK::Array_<SimTK::Rotation> orientationValues;
-        _orientationsReference->getValuesAtTime(nextTime, orientationValues);
-        _orientationAssemblyCondition->moveAllObservations(orientationValues);
+        _orientationsReference->getValuesAtTime(
+                nextTime, _orientationObservationsScratch);
+        _orientationAssemblyCondition->moveAllObservations(
+                _orientationObservationsScratch);
     }
 }
 
@@ -168,9 +168,21 @@ public:
         given the marker's index. */
     SimTK::Vec3 computeCurrentMarkerLocation(int markerIndex);
     /** Compute and return the spatial locations of all markers, expressed in
-        the ground frame. */
+        the ground frame. All locations are computed in a single pass over
+        the marker stations cached when the solver was assembled, which is
+        cheaper than querying the markers one at a time. */
     void computeCurrentMarkerLocations(SimTK::Array_<SimTK::Vec3> &markerLocations);
 
+    /** Compute the spatial locations of all markers in the ground frame
+        together with the station Jacobian that maps generalized speeds to
+        marker velocities in ground (3*numMarkers X nu). Both quantities are
+        evaluated in one batched pass over the marker stations cached when
+        the solver was assembled. Markers appear in the same order as in
+        computeCurrentMarkerLocations(); see getMarkerNameForIndex(). */
+    void computeCurrentMarkerLocationsAndJacobian(
+        SimTK::Array_<SimTK::Vec3>& markerLocations,
+        SimTK::Matrix& stationJacobian);
+
     /** Compute and return the distance error between a model marker and its
         observation, given the marker's name. */
     double computeCurrentMarkerError(const std::string &markerName);
@@ -221,6 +233,17 @@ public:
     sensors and their observations. */
     void computeCurrentOrientationErrors(SimTK::Array_<double>& osensorErrors);
 
+    /** Compute the ground-frame orientations of all o-sensors and their
+    orientation errors (angles, in radians, to their observations) in one
+    batched pass over the sensor bank. The solver's current configuration
+    is realized once and every sensor orientation is composed from flat
+    arrays of cached parent mobilized bodies and fixed sensor rotations,
+    instead of querying the assembly condition one sensor at a time, so
+    per-frame reporting of a full IMU suit costs a single sweep. */
+    void computeCurrentSensorOrientationsAndErrors(
+        SimTK::Array_<SimTK::Rotation>& osensorOrientations,
+        SimTK::Array_<double>& osensorErrors);
+
     /** Orientation sensor locations and errors may be computed in an order that
     may be different from tasks file or listed in the model. Return the 
     corresponding orientation sensor name for an index in the list of
@@ -231,6 +254,63 @@ public:
         _advanceTimeFromReference = newValue;
     };
 
+    /** %Set the real-time latency budget, in seconds, for each call to
+    track(). Zero (the default) disables the budget and track() always
+    solves to the accuracy set by setAccuracy(). With a budget, track()
+    times each solve and adapts a working accuracy between the accuracy
+    set by setAccuracy() and a loose ceiling: a frame that overruns the
+    budget loosens it, so subsequent frames return quickly and refine the
+    carried-over solution; a frame that finishes comfortably inside the
+    budget tightens it back. This bounds the worst-case per-frame cost of
+    live tracking (e.g. when streaming orientations through a
+    BufferedOrientationsReference) at the price of temporarily coarser
+    solutions after a spike. Setting the budget resets the tracking-time
+    statistics. */
+    void setTrackingLatencyBudget(double seconds);
+    double getTrackingLatencyBudget() const { return _latencyBudget; }
+
+    /** Number of track() calls timed since the latency budget was set or
+    resetTrackingStatistics() was called. */
+    int getNumTrackedFrames() const { return _numTrackedFrames; }
+    /** Mean per-frame solve time, in seconds, of the timed track() calls. */
+    double getMeanTrackingTime() const;
+    /** Largest per-frame solve time, in seconds, of the timed track()
+    calls. */
+    double getPeakTrackingTime() const { return _peakTrackingTime; }
+    /** Standard deviation (jitter), in seconds, of the per-frame solve
+    times of the timed track() calls. */
+    double getTrackingTimeJitter() const;
+    /** Number of timed track() calls whose solve time exceeded the latency
+    budget. */
+    int getNumBudgetOverruns() const { return _numBudgetOverruns; }
+    /** Clear the tracking-time statistics. */
+    void resetTrackingStatistics();
+
+    /** Record a per-frame diagnostics row on every track() call, so that
+    latency spikes in a deployed live rig can be located after the fact
+    instead of reproduced in the lab. Each row captures where that frame's
+    time went: the backlog between acquisition and solving (queue depth at
+    the pop, time spent waiting for the frame, cumulative dropped frames —
+    taken from the BufferedOrientationsReference when one is in use, zero
+    otherwise) and the solve itself (solve time and the working accuracy it
+    ran at). Enabling (re)starts an empty table; rows accumulate until
+    disabled, so budget memory for long deployments (one row of six doubles
+    per frame). */
+    void setTrackingDiagnosticsEnabled(bool enabled);
+    bool getTrackingDiagnosticsEnabled() const { return _recordDiagnostics; }
+    /** The per-frame diagnostics recorded since diagnostics were enabled:
+    one row per track() call, numbered frames as the independent column,
+    with columns time, queue_depth, wait_time, solve_time,
+    working_accuracy and dropped_frames (times in seconds). */
+    const TimeSeriesTable& getTrackingDiagnosticsTable() const {
+        return _diagnosticsTable;
+    }
+
+    /** Obtain a model configuration that tracks the references, respecting
+    the latency budget when one has been set. See AssemblySolver::track()
+    and setTrackingLatencyBudget(). */
+    void track(SimTK::State& s) override;
+
 protected:
     /** Override to include point of interest matching (Marker tracking)
         as well ad Frame orientation (OSensor) tracking.
@@ -258,14 +338,48 @@ private:
     // SimTK::Assembler and the memory is managed by the Assembler
     SimTK::ReferencePtr<SimTK::Markers> _markerAssemblyCondition;
 
+    // Parent mobilized-body indices and station vectors of the markers in
+    // use, cached (in the order markers were added to the assembly
+    // condition) when the markers goal is set up, so that marker queries
+    // do not have to go back through the generic Component interface.
+    SimTK::Array_<SimTK::MobilizedBodyIndex> _markerMobodIndices;
+    SimTK::Array_<SimTK::Vec3> _markerStations;
+
     // OrientationSensors collectively form a single assembly condition for
     // the SimTK::Assembler and the memory is managed by the Assembler
     SimTK::ReferencePtr<SimTK::OrientationSensors> _orientationAssemblyCondition;
 
+    // Parent mobilized-body indices, fixed sensor rotations in those bodies
+    // and observation indices of the o-sensors in use, cached (in the order
+    // sensors were added to the assembly condition) when the orientations
+    // goal is set up, so that batched sensor queries sweep flat arrays.
+    SimTK::Array_<SimTK::MobilizedBodyIndex> _osensorMobodIndices;
+    SimTK::Array_<SimTK::Rotation> _osensorRotationsInBody;
+    SimTK::Array_<int> _osensorObservationIxs;
+
+    // Per-frame scratch for moving the reference observations into the
+    // assembly conditions without reallocating at every frame.
+    SimTK::Array_<SimTK::Vec3> _markerObservationsScratch;
+    SimTK::Array_<SimTK::Rotation> _orientationObservationsScratch;
+
     // internal flag indicating whether time is advanced based on live data or
     // controlled by the driver porgram (typically based on pre-recorded data).
     bool _advanceTimeFromReference{false};
 
+    // Real-time latency budget for track() in seconds (0 disables), the
+    // working accuracy it adapts, and the per-frame timing statistics.
+    double _latencyBudget{0};
+    double _workingAccuracy{SimTK::NaN};
+    int _numTrackedFrames{0};
+    int _numBudgetOverruns{0};
+    double _sumTrackingTime{0};
+    double _sumSquaredTrackingTime{0};
+    double _peakTrackingTime{0};
+
+    // Per-frame diagnostics recording (setTrackingDiagnosticsEnabled()).
+    bool _recordDiagnostics{false};
+    TimeSeriesTable _diagnosticsTable;
+
 //=============================================================================
 };  // END of class InverseKinematicsSolver
 //=============================================================================
@@ -0,0 +1,134 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  EnsembleSimulator.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+//=============================================================================
+// INCLUDES
+//=============================================================================
+#include "EnsembleSimulator.h"
+
+#include <OpenSim/Common/Storage.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace OpenSim;
+using namespace std;
+
+//=============================================================================
+// CONSTRUCTION
+//=============================================================================
+EnsembleSimulator::EnsembleSimulator(const Model& model) :
+    _model(model),
+    _integratorMethod(Manager::IntegratorMethod::RungeKuttaMerson),
+    _accuracy(-1.0),
+    _numThreads(0)
+{}
+
+//=============================================================================
+// SIMULATE
+//=============================================================================
+std::vector<StatesTrajectory> EnsembleSimulator::simulate(int numSamples,
+        double finalTime, const SampleInitializer& initializeSample) const
+{
+    std::vector<StatesTrajectory> trajectories(
+        numSamples > 0 ? numSamples : 0);
+    if (numSamples <= 0)
+        return trajectories;
+
+    int numThreads = _numThreads;
+    if (numThreads <= 0)
+        numThreads = (int)std::thread::hardware_concurrency();
+    numThreads = std::max(1, std::min(numThreads, numSamples));
+
+    std::atomic<int> nextSample(0);
+    std::atomic<int> numCompleted(0);
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        try {
+            // One model copy, one initialized system and one Manager per
+            // worker, reused for every sample this worker processes.
+            Model workerModel(_model);
+            const SimTK::State baseState = workerModel.initSystem();
+
+            Manager manager(workerModel);
+            manager.setIntegratorMethod(_integratorMethod);
+            if (_accuracy > 0)
+                manager.setIntegratorAccuracy(_accuracy);
+            manager.setPerformAnalyses(false);
+
+            while (true) {
+                const int i = nextSample++;
+                if (i >= numSamples)
+                    break;
+                try {
+                    SimTK::State s = baseState;
+                    if (initializeSample)
+                        initializeSample(workerModel, s, i);
+
+                    // Rewind the worker's Manager to this sample's start
+                    // state; the integrator's allocations are reused.
+                    manager.reinitialize(s);
+                    manager.integrate(finalTime);
+
+                    trajectories[i] =
+                        StatesTrajectory::createFromStatesStorage(
+                            workerModel, manager.getStateStorage());
+                    ++numCompleted;
+                }
+                catch (const std::exception& ex) {
+                    // A bad sample is logged and left empty; it does not
+                    // stop the ensemble.
+                    log_error("EnsembleSimulator failed on sample {}: {}",
+                        i, ex.what());
+                }
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError)
+                firstError = std::current_exception();
+        }
+    };
+
+    if (numThreads <= 1) {
+        worker();
+    }
+    else {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i)
+            threads.emplace_back(worker);
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    if (firstError)
+        std::rethrow_exception(firstError);
+
+    log_info("EnsembleSimulator completed {} of {} sample(s).",
+        (int)numCompleted, numSamples);
+
+    return trajectories;
+}
@@ -0,0 +1,113 @@
+#ifndef OPENSIM_ENSEMBLE_SIMULATOR_H_
+#define OPENSIM_ENSEMBLE_SIMULATOR_H_
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  EnsembleSimulator.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/StatesTrajectory.h>
+
+#include <functional>
+#include <vector>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * Run many forward simulations of one model in parallel without paying the
+ * model loading and Model::initSystem() cost per sample. Each worker thread
+ * copies the prototype model and initializes its system once, then reuses a
+ * single Manager (rewound per sample with Manager::reinitialize()) for every
+ * sample that worker draws from a shared counter, so N samples cost as many
+ * system initializations as there are threads rather than N processes.
+ *
+ * A per-sample callback receives the worker's own Model and start state so
+ * the caller can distribute initial conditions, controls, or parameter
+ * perturbations across the ensemble. The callback must not alter the system
+ * topology (no adding or removing components); values the model reads during
+ * computation, such as controller functions or state variable values, take
+ * effect immediately.
+ */
+class OSIMSIMULATION_API EnsembleSimulator {
+//=============================================================================
+// METHODS
+//=============================================================================
+public:
+    /** Called on a worker's own Model copy and the sample's start state
+        (a copy of the worker model's default state) before sample `sample`
+        is integrated. Use it to apply that sample's initial coordinate
+        values and speeds, controls, or parameter perturbations, and to set
+        the sample's start time. */
+    using SampleInitializer =
+        std::function<void(Model& model, SimTK::State& state, int sample)>;
+
+    /** Construct an ensemble around a prototype model. The model is copied
+        here, and again per worker when simulate() runs; later changes to
+        the caller's model do not affect the ensemble. */
+    explicit EnsembleSimulator(const Model& model);
+
+    /** Sets the integrator method every worker's Manager uses. The default
+        is Manager's default (Runge-Kutta-Merson). */
+    void setIntegratorMethod(Manager::IntegratorMethod method)
+    {   _integratorMethod = method; }
+
+    /** Sets the accuracy of every worker's integrator; unset leaves the
+        integrator's default accuracy in place. */
+    void setIntegratorAccuracy(double accuracy) { _accuracy = accuracy; }
+
+    /** Number of worker threads simulate() spawns. Zero or negative (the
+        default) resolves to the hardware concurrency; the count is always
+        clamped to the number of samples. */
+    void setNumThreads(int numThreads) { _numThreads = numThreads; }
+    int getNumThreads() const { return _numThreads; }
+
+    /** Run numSamples forward simulations to finalTime and return one
+        StatesTrajectory per sample, in sample order. initializeSample is
+        called on the worker's model and start state before each sample is
+        integrated. A sample that fails is logged and leaves an empty
+        trajectory; it does not stop the ensemble. */
+    std::vector<StatesTrajectory> simulate(int numSamples, double finalTime,
+            const SampleInitializer& initializeSample) const;
+
+//=============================================================================
+// DATA
+//=============================================================================
+private:
+    /** Prototype model copied per worker. */
+    Model _model;
+    /** Integrator method shared by every worker's Manager. */
+    Manager::IntegratorMethod _integratorMethod;
+    /** Integrator accuracy; non-positive leaves the default in place. */
+    double _accuracy;
+    /** Worker thread count; <= 0 resolves to hardware concurrency. */
+    int _numThreads;
+
+//=============================================================================
+};  // END of class EnsembleSimulator
+
+} //namespace
+//=============================================================================
+//=============================================================================
+
+#endif  // OPENSIM_ENSEMBLE_SIMULATOR_H_
@@ -24,12 +24,19 @@
 /* Note: This code was originally developed by Realistic Dynamics Inc.
  * Author: Frank C. Anderson
  */
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include "Manager.h"
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Model/AnalysisSet.h>
 #include <OpenSim/Simulation/Model/ControllerSet.h>
+#include <OpenSim/Simulation/Model/ExternalForce.h>
+#include <OpenSim/Common/AllocationTracker.h>
 #include <OpenSim/Common/Array.h>
+#include <OpenSim/Common/CommonUtilities.h>
 
 
 using namespace OpenSim;
@@ -97,6 +104,19 @@ setNull()
     _dt = 1.0e-4;
     _performAnalyses=true;
     _writeToStorage=true;
+    _reportingInterval = 1;
+    _recordAllocationsPerStep = false;
+    _assertZeroSteadyStateAllocations = false;
+    _allocationWarmupSteps = 10;
+    _reportTiming = false;
+    _lastIntegrationWallTime = 0.0;
+    _lastIntegrationSimTime = 0.0;
+    _lastNumStepsTaken = 0;
+    _lastRealizeStageSeconds.assign(3, 0.0);
+    _recordReplay = false;
+    _replayInitialTime = SimTK::NaN;
+    _replayFinalTime = SimTK::NaN;
+    _integratorMethod = IntegratorMethod::RungeKuttaMerson;
     _tArray.setSize(0);
     _dtArray.setSize(0);
 }
@@ -259,6 +279,62 @@ getUseConstantDT() const
     return(_constantDT);
 }
 //-----------------------------------------------------------------------------
+// REPORTING INTERVAL
+//-----------------------------------------------------------------------------
+//_____________________________________________________________________________
+/**
+ * Set how many integration steps are taken between recordings of the states
+ * and steppings of the Analyses. The initial and final states of an
+ * integration are always recorded.
+ *
+ * @param numSteps Number of steps between recordings; 1 records every step.
+ */
+void Manager::
+setReportingInterval(int numSteps)
+{
+    OPENSIM_THROW_IF(numSteps < 1, Exception,
+        "Manager::setReportingInterval(): the reporting interval must be a "
+        "positive number of steps, but {} was provided.", numSteps);
+    _reportingInterval = numSteps;
+}
+//_____________________________________________________________________________
+/**
+ * Make integrate() throw if a steady-state integration step allocates.
+ *
+ * @param assertZero Whether to enable the assertion.
+ * @param numWarmupSteps Initial steps exempt from the assertion.
+ */
+void Manager::
+setAssertZeroSteadyStateAllocations(bool assertZero, int numWarmupSteps)
+{
+    OPENSIM_THROW_IF(numWarmupSteps < 0, Exception,
+        "Manager::setAssertZeroSteadyStateAllocations(): the number of "
+        "warm-up steps must be nonnegative, but {} was provided.",
+        numWarmupSteps);
+    _assertZeroSteadyStateAllocations = assertZero;
+    _allocationWarmupSteps = numWarmupSteps;
+}
+//_____________________________________________________________________________
+/**
+ * Simulated seconds per wall-clock second of the most recent integrate().
+ */
+double Manager::getLastRealTimeFactor() const
+{
+    if (_lastIntegrationWallTime <= 0 || _lastIntegrationSimTime <= 0)
+        return SimTK::NaN;
+    return _lastIntegrationSimTime / _lastIntegrationWallTime;
+}
+//_____________________________________________________________________________
+/**
+ * Integration steps per wall-clock second of the most recent integrate().
+ */
+double Manager::getLastStepsPerSecond() const
+{
+    if (_lastIntegrationWallTime <= 0 || _lastNumStepsTaken <= 0)
+        return SimTK::NaN;
+    return _lastNumStepsTaken / _lastIntegrationWallTime;
+}
+//-----------------------------------------------------------------------------
 // DT ARRAY
 //-----------------------------------------------------------------------------
 //_____________________________________________________________________________
@@ -509,6 +585,8 @@ void Manager::setIntegratorMethod(IntegratorMethod integMethod)
         OPENSIM_THROW(Exception, msg);
     }
 
+    _integratorMethod = integMethod;
+
     auto& sys = _model->getMultibodySystem();
     switch (integMethod) {
         //case IntegratorMethod::CPodes:
@@ -643,6 +721,32 @@ hasStateStorage() const
 // INTEGRATION
 //-----------------------------------------------------------------------------
 
+namespace {
+// Total wall seconds per profiled realize stage (Position, Velocity,
+// Dynamics in row order), summed across all components; zeros when the
+// realize-cost profiler is off.
+std::vector<double> sumRealizeStageSeconds()
+{
+    std::vector<double> totals(3, 0.0);
+    if (!Component::isRealizeProfilingEnabled())
+        return totals;
+    const TimeSeriesTable_<double> profile = Component::getRealizeProfile();
+    const auto& labels = profile.getColumnLabels();
+    const int numRows =
+        std::min(3, static_cast<int>(profile.getNumRows()));
+    for (int r = 0; r < numRows; ++r) {
+        const auto row = profile.getRowAtIndex(r);
+        for (int c = 0; c < static_cast<int>(labels.size()); ++c) {
+            const std::string& label = labels[c];
+            if (label.size() >= 8 &&
+                    label.compare(label.size() - 8, 8, "|seconds") == 0)
+                totals[r] += row[c];
+        }
+    }
+    return totals;
+}
+} // namespace
+
 const SimTK::State& Manager::integrate(double finalTime)
 {
     int step = 1; // for AnalysisSet::step()
@@ -652,6 +756,44 @@ const SimTK::State& Manager::integrate(double finalTime)
             "initialized. Call Manager::initialize() first.");
     }
 
+    ScopedTimer scopedTimer("Manager::integrate");
+
+    // Integration timing (see setReportTiming()); finalizeTiming runs at
+    // every return below so the getters always describe the last call.
+    const auto timingWallStart = std::chrono::steady_clock::now();
+    const int timingStepsBefore = _integ->getNumStepsTaken();
+    const double timingSimStart = _integ->getState().getTime();
+    const std::vector<double> timingRealizeBefore = sumRealizeStageSeconds();
+    auto finalizeTiming = [&]() {
+        _lastIntegrationWallTime = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - timingWallStart).count();
+        _lastIntegrationSimTime =
+            _integ->getState().getTime() - timingSimStart;
+        _lastNumStepsTaken = _integ->getNumStepsTaken() - timingStepsBefore;
+        const std::vector<double> realizeAfter = sumRealizeStageSeconds();
+        for (int i = 0; i < 3; ++i)
+            _lastRealizeStageSeconds[i] =
+                realizeAfter[i] - timingRealizeBefore[i];
+        if (!_reportTiming)
+            return;
+        std::string record = fmt::format(
+            "Manager timing: wall_time_s={:.6g} sim_time_s={:.6g} "
+            "real_time_factor={:.6g} steps={} steps_per_s={:.6g}",
+            _lastIntegrationWallTime, _lastIntegrationSimTime,
+            getLastRealTimeFactor(), _lastNumStepsTaken,
+            getLastStepsPerSecond());
+        if (Component::isRealizeProfilingEnabled() &&
+                _lastIntegrationWallTime > 0) {
+            record += fmt::format(
+                " realize_position_pct={:.1f} realize_velocity_pct={:.1f}"
+                " realize_dynamics_pct={:.1f}",
+                100*_lastRealizeStageSeconds[0]/_lastIntegrationWallTime,
+                100*_lastRealizeStageSeconds[1]/_lastIntegrationWallTime,
+                100*_lastRealizeStageSeconds[2]/_lastIntegrationWallTime);
+        }
+        log_info("{}", record);
+    };
+
     // Get the internal state
     const SimTK::State& s = _integ->getState();
 
@@ -692,13 +834,29 @@ const SimTK::State& Manager::integrate(double finalTime)
 
     auto status = SimTK::Integrator::InvalidSuccessfulStepStatus;
 
+    // Only return control after every internal step when there is reporting
+    // work to do; otherwise let the integrator run straight to the requested
+    // time so there is zero per-step reporting overhead.
+    const bool recording = _performAnalyses || _writeToStorage;
     if (!fixedStep) {
-        _integ->setReturnEveryInternalStep(true);
+        _integ->setReturnEveryInternalStep(recording);
     }
 
     _model->realizeVelocity(s);
     initializeStorageAndAnalyses(s);
 
+    if (_recordReplay) {
+        _replayInitialTime = initialTime;
+        _replayFinalTime = finalTime;
+        _replayStateNames = _model->getStateVariableNames();
+        const SimTK::Vector values = _model->getStateVariableValues(s);
+        _replayInitialState.assign(values.size(), 0.0);
+        for (int i = 0; i < values.size(); ++i)
+            _replayInitialState[i] = values[i];
+        _replayControls = TimeSeriesTable();
+        recordReplayControls(s);
+    }
+
     if (fixedStep) {
         _model->realizeAcceleration(s);
         record(s, step);
@@ -709,9 +867,35 @@ const SimTK::State& Manager::integrate(double finalTime)
 
     if (time >= stepToTime) {
         // No integration can be performed.
+        finalizeTiming();
         return getState();
     }
 
+    // Per-step allocation accounting. The counting brackets only the
+    // _timeStepper->stepTo() calls below; recording to storage and stepping
+    // Analyses are deliberately outside the brackets.
+    const bool countAllocations =
+        _recordAllocationsPerStep || _assertZeroSteadyStateAllocations;
+    const bool wasTrackingEnabled = AllocationTracker::isEnabled();
+    if (countAllocations) {
+        OPENSIM_THROW_IF(_assertZeroSteadyStateAllocations && !fixedStep,
+            Exception,
+            "Manager::integrate(): asserting zero steady-state allocations "
+            "requires fixed-step integration; call setUseConstantDT() or "
+            "setUseSpecifiedDT() first.");
+        OPENSIM_THROW_IF(_assertZeroSteadyStateAllocations &&
+                !AllocationTracker::isAvailable(), Exception,
+            "Manager::integrate(): asserting zero steady-state allocations "
+            "requires a build configured with OPENSIM_TRACK_ALLOCATIONS; "
+            "this build does not intercept the heap.");
+        if (!AllocationTracker::isAvailable())
+            log_warn("Manager::integrate(): allocation counts were requested "
+                "but this build does not intercept the heap (configure with "
+                "OPENSIM_TRACK_ALLOCATIONS); all counts will be zero.");
+        _allocationsPerStep.clear();
+        AllocationTracker::setEnabled(true);
+    }
+
     // This should use: status != SimTK::Integrator::EndOfSimulation
     // but if we do that then repeated calls to integrate (and thus stepTo)
     // fail to continue on integrating. This seems to be a bug in TimeStepper
@@ -725,12 +909,44 @@ const SimTK::State& Manager::integrate(double finalTime)
             stepToTime = time + fixedStepSize;
         }
 
+        unsigned long long allocationsBefore = 0;
+        if (countAllocations)
+            allocationsBefore = AllocationTracker::getNumAllocations();
+
         status = _timeStepper->stepTo(stepToTime);
 
+        if (countAllocations) {
+            const unsigned long long stepAllocations =
+                AllocationTracker::getNumAllocations() - allocationsBefore;
+            // The push_back below may itself allocate; that happens outside
+            // the bracket sampled above, so it cannot pollute any step's
+            // count.
+            _allocationsPerStep.push_back(stepAllocations);
+            Component::appendRealizeTraceCounter("Manager|allocationsPerStep",
+                static_cast<double>(stepAllocations));
+            if (_assertZeroSteadyStateAllocations &&
+                    static_cast<int>(_allocationsPerStep.size()) >
+                        _allocationWarmupSteps &&
+                    stepAllocations > 0) {
+                AllocationTracker::setEnabled(wasTrackingEnabled);
+                OPENSIM_THROW(Exception,
+                    "Manager::integrate(): integration step {} made {} heap "
+                    "allocation(s) after the {}-step warm-up; the simulation "
+                    "has not reached an allocation-free steady state.",
+                    static_cast<int>(_allocationsPerStep.size()),
+                    stepAllocations, _allocationWarmupSteps);
+            }
+        }
+
         if ( (status == SimTK::Integrator::TimeHasAdvanced) ||
              (status == SimTK::Integrator::ReachedScheduledEvent) ) {
             const SimTK::State& s = _integ->getState();
-            record(s, step);
+            if (_recordReplay)
+                recordReplayControls(s);
+            // decimate reporting: only record every _reportingInterval-th
+            // step; the final state is always recorded below
+            if (_reportingInterval <= 1 || step % _reportingInterval == 0)
+                record(s, step);
             step++;
         }
         // Check if simulation has terminated for some reason
@@ -739,6 +955,9 @@ const SimTK::State& Manager::integrate(double finalTime)
                         SimTK::Integrator::ReachedFinalTime) {
             log_error("Integration failed due to the following reason: {}",
                 _integ->getTerminationReasonString(_integ->getTerminationReason()));
+            if (countAllocations)
+                AllocationTracker::setEnabled(wasTrackingEnabled);
+            finalizeTiming();
             return getState();
         }
 
@@ -747,11 +966,21 @@ const SimTK::State& Manager::integrate(double finalTime)
         if (checkHalt()) break;
     }
 
+    if (countAllocations)
+        AllocationTracker::setEnabled(wasTrackingEnabled);
+
     // CLEAR ANY INTERRUPT
     clearHalt();
 
+    // The last step may end the simulation without reporting TimeHasAdvanced;
+    // the monotonic-time guard drops this sample if it was already captured.
+    if (_recordReplay)
+        recordReplayControls(_integ->getState());
+
     record(_integ->getState(), -1);
 
+    finalizeTiming();
+
     return getState();
 }
 
@@ -830,6 +1059,347 @@ void Manager::initialize(const SimTK::State& s)
     if( _writeToStorage && _model->isControlled())
         _controllerSet->constructStorage();
 }
+//_____________________________________________________________________________
+/**
+* Rewind the existing SimTK::TimeStepper to a new start state so the same
+* Manager can be reused for another simulation.
+*/
+void Manager::reinitialize(const SimTK::State& s)
+{
+    if (!_timeStepper) {
+        // Nothing to reuse yet; behave exactly like a first initialization.
+        initialize(s);
+        return;
+    }
+
+    // TimeStepper::initialize() reinitializes the integrator in place,
+    // reusing its internal allocations, so rewinding costs little more than
+    // the state copy.
+    _timeStepper->initialize(s);
+    _timeStepper->setReportAllSignificantStates(true);
+
+    // Restart the step bookkeeping for a fresh session. A dt array supplied
+    // via setDTArray() is user-provided, so it is left alone.
+    if (!_specifiedDT) {
+        _tArray.setSize(0);
+        _dtArray.setSize(0);
+    }
+    clearHalt();
+
+    // Begin fresh states and controls storage for the new session.
+    if (_writeToStorage) {
+        if (hasStateStorage())
+            getStateStorage().purge();
+        if (_model->isControlled())
+            _controllerSet->constructStorage();
+    }
+}
+
+//_____________________________________________________________________________
+/**
+* Write the current time, step-size hint and model state variables to a
+* checkpoint file so the simulation can be resumed by restoreCheckpoint().
+*/
+void Manager::writeCheckpoint(const std::string& fileName) const
+{
+    OPENSIM_THROW_IF(_timeStepper == nullptr, Exception,
+        "Manager::writeCheckpoint(): Manager has not been initialized. "
+        "Call Manager::initialize() first.");
+
+    const SimTK::State& s = getState();
+    const Array<std::string> names = _model->getStateVariableNames();
+    const SimTK::Vector values = _model->getStateVariableValues(s);
+
+    std::ofstream file(fileName);
+    OPENSIM_THROW_IF(!file.good(), Exception,
+        "Manager::writeCheckpoint(): cannot write to '{}'.", fileName);
+
+    // 17 significant digits so every double round-trips exactly.
+    file << "OpenSimManagerCheckpoint version=1\n";
+    file << std::setprecision(17);
+    file << "time " << s.getTime() << "\n";
+    file << "nextStepSize " << _integ->getPredictedNextStepSize() << "\n";
+    file << "numStateVariables " << values.size() << "\n";
+    for (int i = 0; i < values.size(); ++i)
+        file << names[i] << " " << values[i] << "\n";
+
+    OPENSIM_THROW_IF(!file.good(), Exception,
+        "Manager::writeCheckpoint(): failed while writing '{}'.", fileName);
+}
+//_____________________________________________________________________________
+/**
+* Restore a checkpoint written by writeCheckpoint() and rewind this Manager
+* to it so integrate() continues the simulation from the checkpointed time.
+*/
+void Manager::restoreCheckpoint(const std::string& fileName)
+{
+    std::ifstream file(fileName);
+    OPENSIM_THROW_IF(!file.good(), Exception,
+        "Manager::restoreCheckpoint(): cannot open '{}'.", fileName);
+
+    std::string header, versionTag;
+    file >> header >> versionTag;
+    OPENSIM_THROW_IF(header != "OpenSimManagerCheckpoint", Exception,
+        "Manager::restoreCheckpoint(): '{}' is not a Manager checkpoint.",
+        fileName);
+
+    std::string key;
+    double time = SimTK::NaN;
+    double nextStepSize = 0.0;
+    int numStateVariables = -1;
+    file >> key >> time;
+    file >> key >> nextStepSize;
+    file >> key >> numStateVariables;
+    OPENSIM_THROW_IF(!file.good() || numStateVariables < 0, Exception,
+        "Manager::restoreCheckpoint(): '{}' has a malformed header.",
+        fileName);
+
+    SimTK::State s = _model->getWorkingState();
+    for (int i = 0; i < numStateVariables; ++i) {
+        std::string name;
+        double value = SimTK::NaN;
+        file >> name >> value;
+        OPENSIM_THROW_IF(file.fail(), Exception,
+            "Manager::restoreCheckpoint(): '{}' ended after {} of {} state "
+            "variables.", fileName, i, numStateVariables);
+        _model->setStateVariableValue(s, name, value);
+    }
+    s.setTime(time);
+
+    // Seed the step-size controller with the checkpointed step before the
+    // integrator is reinitialized.
+    if (nextStepSize > 0)
+        _integ->setInitialStepSize(nextStepSize);
+
+    reinitialize(s);
+}
+
+/**
+* Append the model's controls at this state to the captured control
+* trajectory. Events (and repeated reporting of the final state) can present
+* the same time twice; only strictly advancing rows are kept.
+*/
+void Manager::recordReplayControls(const SimTK::State& s)
+{
+    const int numControls = _model->getNumControls();
+    if (numControls == 0)
+        return;
+    if (_replayControls.getNumRows() > 0 &&
+            s.getTime() <= _replayControls.getIndependentColumn().back())
+        return;
+    if (_replayControls.getNumRows() == 0) {
+        // Label columns by index into the model's controls vector; actuator
+        // names are not unique across sets and the order is what matters.
+        std::vector<std::string> labels(numControls);
+        for (int i = 0; i < numControls; ++i)
+            labels[i] = "control_" + std::to_string(i);
+        _replayControls.setColumnLabels(labels);
+    }
+    const SimTK::Vector& controls = _model->getControls(s);
+    SimTK::RowVector row(numControls);
+    for (int i = 0; i < numControls; ++i)
+        row[i] = controls[i];
+    _replayControls.appendRow(s.getTime(), row);
+}
+
+/**
+* Write the inputs captured by the most recent integrate() call to a replay
+* file; see setRecordReplay().
+*/
+void Manager::writeReplay(const std::string& fileName) const
+{
+    OPENSIM_THROW_IF(SimTK::isNaN(_replayInitialTime), Exception,
+        "Manager::writeReplay(): no replay has been captured. Call "
+        "setRecordReplay(true) before integrate().");
+
+    // 0 = variable step, 1 = constant dt, 2 = specified step times.
+    const int steppingMode = _specifiedDT ? 2 : (_constantDT ? 1 : 0);
+
+    std::ofstream file(fileName);
+    OPENSIM_THROW_IF(!file.good(), Exception,
+        "Manager::writeReplay(): cannot write to '{}'.", fileName);
+
+    // 17 significant digits so every double round-trips exactly.
+    file << "OpenSimManagerReplay version=1\n";
+    file << std::setprecision(17);
+    file << "initialTime " << _replayInitialTime << "\n";
+    file << "finalTime " << _replayFinalTime << "\n";
+    file << "integratorMethod " << static_cast<int>(_integratorMethod) << "\n";
+    file << "accuracy " << _integ->getAccuracyInUse() << "\n";
+    file << "steppingMode " << steppingMode << "\n";
+    file << "constantDT " << _dt << "\n";
+    const int numStepTimes = (steppingMode == 2) ? _tArray.getSize() : 0;
+    file << "numStepTimes " << numStepTimes << "\n";
+    for (int i = 0; i < numStepTimes; ++i)
+        file << _tArray[i] << "\n";
+    file << "numStateVariables "
+         << static_cast<int>(_replayInitialState.size()) << "\n";
+    for (int i = 0; i < static_cast<int>(_replayInitialState.size()); ++i)
+        file << _replayStateNames[i] << " " << _replayInitialState[i] << "\n";
+
+    const int numControls = static_cast<int>(_replayControls.getNumColumns());
+    const int numControlRows = static_cast<int>(_replayControls.getNumRows());
+    file << "numControls " << numControls << "\n";
+    file << "numControlRows " << numControlRows << "\n";
+    for (int r = 0; r < numControlRows; ++r) {
+        file << _replayControls.getIndependentColumn()[r];
+        const auto row = _replayControls.getRowAtIndex(r);
+        for (int c = 0; c < numControls; ++c)
+            file << " " << row[c];
+        file << "\n";
+    }
+
+    // External forces are driven by data files; record their provenance so a
+    // replay on another machine can confirm the same inputs are in place.
+    std::vector<std::pair<std::string, std::string>> externalForces;
+    for (const auto& force : _model->getComponentList<ExternalForce>()) {
+        const std::string dataSource = force.getDataSourceName();
+        externalForces.emplace_back(force.getAbsolutePathString(),
+            dataSource.empty() ? "-" : dataSource);
+    }
+    file << "numExternalForces "
+         << static_cast<int>(externalForces.size()) << "\n";
+    for (const auto& entry : externalForces)
+        file << entry.first << " " << entry.second << "\n";
+
+    OPENSIM_THROW_IF(!file.good(), Exception,
+        "Manager::writeReplay(): failed while writing '{}'.", fileName);
+}
+
+/**
+* Re-execute a simulation from a replay file written by writeReplay() and
+* report how faithfully the recorded control trajectory was reproduced.
+*/
+SimTK::State Manager::replay(Model& model, const std::string& fileName)
+{
+    std::ifstream file(fileName);
+    OPENSIM_THROW_IF(!file.good(), Exception,
+        "Manager::replay(): cannot open '{}'.", fileName);
+
+    std::string header, versionTag;
+    file >> header >> versionTag;
+    OPENSIM_THROW_IF(header != "OpenSimManagerReplay", Exception,
+        "Manager::replay(): '{}' is not a Manager replay file.", fileName);
+
+    std::string key;
+    double initialTime = SimTK::NaN, finalTime = SimTK::NaN;
+    int integratorMethod = -1, steppingMode = -1;
+    double accuracy = -1, constantDT = 0;
+    int numStepTimes = -1;
+    file >> key >> initialTime;
+    file >> key >> finalTime;
+    file >> key >> integratorMethod;
+    file >> key >> accuracy;
+    file >> key >> steppingMode;
+    file >> key >> constantDT;
+    file >> key >> numStepTimes;
+    OPENSIM_THROW_IF(!file.good() || numStepTimes < 0, Exception,
+        "Manager::replay(): '{}' has a malformed header.", fileName);
+    std::vector<double> stepTimes(numStepTimes);
+    for (int i = 0; i < numStepTimes; ++i)
+        file >> stepTimes[i];
+
+    int numStateVariables = -1;
+    file >> key >> numStateVariables;
+    OPENSIM_THROW_IF(!file.good() || numStateVariables < 0, Exception,
+        "Manager::replay(): '{}' has a malformed state section.", fileName);
+
+    SimTK::State s = model.initSystem();
+    for (int i = 0; i < numStateVariables; ++i) {
+        std::string name;
+        double value = SimTK::NaN;
+        file >> name >> value;
+        OPENSIM_THROW_IF(file.fail(), Exception,
+            "Manager::replay(): '{}' ended after {} of {} state variables.",
+            fileName, i, numStateVariables);
+        model.setStateVariableValue(s, name, value);
+    }
+    s.setTime(initialTime);
+
+    int numControls = -1, numControlRows = -1;
+    file >> key >> numControls;
+    file >> key >> numControlRows;
+    OPENSIM_THROW_IF(file.fail() || numControls < 0 || numControlRows < 0,
+        Exception,
+        "Manager::replay(): '{}' has a malformed controls section.",
+        fileName);
+    std::vector<double> controlTimes(numControlRows);
+    std::vector<std::vector<double>> controlRows(numControlRows,
+        std::vector<double>(numControls));
+    for (int r = 0; r < numControlRows; ++r) {
+        file >> controlTimes[r];
+        for (int c = 0; c < numControls; ++c)
+            file >> controlRows[r][c];
+    }
+    OPENSIM_THROW_IF(numControlRows > 0 && file.fail(), Exception,
+        "Manager::replay(): '{}' has a truncated controls section.",
+        fileName);
+
+    int numExternalForces = -1;
+    file >> key >> numExternalForces;
+    for (int i = 0; i < numExternalForces; ++i) {
+        std::string path, dataSource;
+        file >> path >> dataSource;
+        if (!model.hasComponent<ExternalForce>(path))
+            log_warn("Manager::replay(): the captured run applied an "
+                "ExternalForce at '{}' (data source '{}') that this model "
+                "does not have.", path, dataSource);
+    }
+
+    Manager manager(model);
+    manager.setIntegratorMethod(
+        static_cast<IntegratorMethod>(integratorMethod));
+    if (accuracy > 0)
+        manager.setIntegratorAccuracy(accuracy);
+    if (steppingMode == 1) {
+        // There is no public setter for the constant step size, so rebuild
+        // the same step grid as an explicit dt array.
+        stepTimes.clear();
+        for (double t = initialTime; t < finalTime; t += constantDT)
+            stepTimes.push_back(t);
+        stepTimes.push_back(finalTime);
+    }
+    if (steppingMode >= 1 && stepTimes.size() > 1) {
+        SimTK::Vector dts(static_cast<int>(stepTimes.size()) - 1);
+        for (int i = 0; i < dts.size(); ++i)
+            dts[i] = stepTimes[i + 1] - stepTimes[i];
+        manager.setDTArray(dts, stepTimes[0]);
+        manager.setUseSpecifiedDT(true);
+    }
+
+    // Capture the re-run with the same machinery so the recorded and
+    // replayed control trajectories can be compared row for row.
+    manager.setRecordReplay(true);
+    manager.initialize(s);
+    manager.integrate(finalTime);
+
+    const TimeSeriesTable& replayed = manager.getReplayControls();
+    if (numControlRows != static_cast<int>(replayed.getNumRows())) {
+        log_warn("Manager::replay(): the re-run took {} control samples "
+            "where the captured run took {}; the integrations stepped "
+            "differently.", replayed.getNumRows(), numControlRows);
+    } else if (numControlRows > 0) {
+        double maxDeviation = 0;
+        for (int r = 0; r < numControlRows; ++r) {
+            const auto row = replayed.getRowAtIndex(r);
+            for (int c = 0; c < numControls; ++c) {
+                const double deviation =
+                    std::abs(row[c] - controlRows[r][c]);
+                if (deviation > maxDeviation) maxDeviation = deviation;
+            }
+        }
+        if (maxDeviation == 0)
+            log_info("Manager::replay(): reproduced the captured control "
+                "trajectory bit-identically ({} samples).", numControlRows);
+        else
+            log_warn("Manager::replay(): the re-run deviates from the "
+                "captured control trajectory by up to {}; the replayed "
+                "simulation is not the one that was captured.",
+                maxDeviation);
+    }
+
+    return manager.getState();
+}
 
 void Manager::record(const SimTK::State& s, const int& step)
 {
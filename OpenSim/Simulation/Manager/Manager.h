@@ -29,6 +29,8 @@
 
 
 // INCLUDES
+#include <vector>
+
 #include <OpenSim/Common/Array.h>
 #include "OpenSim/Common/TimeSeriesTable.h"
 #include <OpenSim/Simulation/osimSimulationDLL.h>
@@ -62,9 +64,11 @@ class ControllerSet;
  * that editing the SimTK::State after calling initialize()
  * will not affect the simulation.
  *
- * Note that this interface means that you cannot "reinitialize" a Manager.
- * If you make changes to the SimTK::State, a new Manager must be created
- * before integrating again.
+ * Note that this interface means that you cannot call initialize() on a
+ * Manager more than once. If you make changes to the SimTK::State, either
+ * create a new Manager before integrating again, or rewind the same Manager
+ * to the new start state with reinitialize(), which reuses the existing
+ * TimeStepper and integrator.
  */
 class OSIMSIMULATION_API Manager
 {
@@ -115,6 +119,44 @@ private:
     /** flag indicating if manager should write to storage  each step */
     bool _writeToStorage;
 
+    /** record states/analyses only every _reportingInterval-th step */
+    int _reportingInterval;
+
+    /** flag indicating if integrate() should count heap allocations made by
+    each integration step (requires a build with OPENSIM_TRACK_ALLOCATIONS) */
+    bool _recordAllocationsPerStep;
+
+    /** flag indicating if integrate() should throw when a steady-state step
+    of a fixed-step integration allocates from the heap */
+    bool _assertZeroSteadyStateAllocations;
+
+    /** number of initial steps exempt from the zero-allocation assertion;
+    caches warm up during these */
+    int _allocationWarmupSteps;
+
+    /** per-step allocation counts collected by the most recent integrate() */
+    std::vector<unsigned long long> _allocationsPerStep;
+
+    /** flag indicating if integrate() should log its timing record */
+    bool _reportTiming;
+
+    /** timing of the most recent integrate() call */
+    double _lastIntegrationWallTime;
+    double _lastIntegrationSimTime;
+    int _lastNumStepsTaken;
+    std::vector<double> _lastRealizeStageSeconds;
+
+    /** flag indicating if integrate() should capture its inputs (initial
+    state, stepping scheme, per-step controls) for writeReplay() */
+    bool _recordReplay;
+
+    /** inputs captured by the most recent integrate() with replay capture */
+    double _replayInitialTime;
+    double _replayFinalTime;
+    Array<std::string> _replayStateNames;
+    std::vector<double> _replayInitialState;
+    TimeSeriesTable _replayControls;
+
     /** controllerSet used for the integration */
     SimTK::ReferencePtr<ControllerSet> _controllerSet;
 
@@ -163,6 +205,91 @@ public:
     void setWriteToStorage(bool writeToStorage)
     { _writeToStorage =  writeToStorage; }
 
+    /** Record states and step Analyses only every numSteps-th completed
+    integration step; the initial and final states are always recorded. The
+    default, 1, records every step. Combined with a fixed step size
+    (setUseConstantDT() or setDTArray()) and a decimated reporting interval,
+    the integration loop does a deterministic amount of work per step, which
+    suits real-time use. To remove reporting work entirely, additionally call
+    setPerformAnalyses(false) and setWriteToStorage(false); with reporting
+    fully disabled a variable-step integrator no longer returns control after
+    every internal step. */
+    void setReportingInterval(int numSteps);
+    int getReportingInterval() const { return _reportingInterval; }
+
+    /** Count the heap allocations made by each integration step of the next
+    integrate() call; retrieve the counts with getAllocationsPerStep(). The
+    counts come from AllocationTracker, so they are all zero (and a warning
+    is logged) unless OpenSim was built with the CMake option
+    OPENSIM_TRACK_ALLOCATIONS. Only the integrator's work is counted;
+    recording to storage and stepping Analyses are excluded. When
+    realize-stage tracing is active (Component::startRealizeTracing()), the
+    per-step counts also appear in the trace as a "Manager|allocationsPerStep"
+    counter track. */
+    void setRecordAllocationsPerStep(bool record)
+    { _recordAllocationsPerStep = record; }
+    bool getRecordAllocationsPerStep() const
+    { return _recordAllocationsPerStep; }
+    /** Heap allocation count of each integration step taken by the most
+    recent integrate() call with setRecordAllocationsPerStep(true) or
+    setAssertZeroSteadyStateAllocations(true). */
+    const std::vector<unsigned long long>& getAllocationsPerStep() const
+    { return _allocationsPerStep; }
+
+    /** Make integrate() throw if any steady-state integration step touches
+    the heap. This is the regression guard for real-time use: once caches are
+    warm, a fixed-step forward simulation should run allocation-free, and
+    this mode turns any new per-step allocation into a hard failure naming
+    the offending step. The first `numWarmupSteps` steps are exempt so that
+    lazily-allocated caches (path wrapping results, integrator scratch
+    space) can reach steady state. Requires fixed-step integration
+    (setUseConstantDT() or setUseSpecifiedDT()) and a build with
+    OPENSIM_TRACK_ALLOCATIONS; integrate() throws if either is missing
+    rather than passing vacuously. */
+    void setAssertZeroSteadyStateAllocations(bool assertZero,
+            int numWarmupSteps = 10);
+    bool getAssertZeroSteadyStateAllocations() const
+    { return _assertZeroSteadyStateAllocations; }
+
+    /** @name Integration timing
+    Every integrate() call times itself; these getters report on the most
+    recent call so throughput is measured the same way everywhere instead of
+    each caller hand-rolling a stopwatch around integrate(). Timing costs
+    two clock reads per integrate() call and is always on.
+    @{ */
+
+    /** Also write the measurements below to the log, at info level, as one
+    structured record when integrate() returns. When the realize-cost
+    profiler (Component::startRealizeProfiling()) is recording, the record
+    additionally breaks the wall time down into the percentage spent in the
+    Position, Velocity, and Dynamics realize stages. Off by default. */
+    void setReportTiming(bool report) { _reportTiming = report; }
+    bool getReportTiming() const { return _reportTiming; }
+
+    /** Wall-clock seconds spent inside the most recent integrate() call. */
+    double getLastIntegrationWallTime() const
+    { return _lastIntegrationWallTime; }
+    /** Simulated seconds advanced by the most recent integrate() call. */
+    double getLastIntegrationSimTime() const
+    { return _lastIntegrationSimTime; }
+    /** Simulated seconds per wall-clock second of the most recent
+    integrate() call: above 1 the simulation ran faster than real time.
+    NaN if no time was integrated. */
+    double getLastRealTimeFactor() const;
+    /** Integration steps taken by the most recent integrate() call. */
+    int getLastNumStepsTaken() const { return _lastNumStepsTaken; }
+    /** Integration steps per wall-clock second of the most recent
+    integrate() call. NaN if no time was integrated. */
+    double getLastStepsPerSecond() const;
+    /** Wall-clock seconds the most recent integrate() call spent in the
+    profiled realize stages, indexed 0 = Position, 1 = Velocity,
+    2 = Dynamics. All zero unless the realize-cost profiler
+    (Component::startRealizeProfiling()) was recording during the call. */
+    const std::vector<double>& getLastRealizeStageSeconds() const
+    { return _lastRealizeStageSeconds; }
+
+    /** @} */
+
     /** @name Configure the Integrator
       * @note Call these functions before calling `Manager::initialize()`.
       * @{ */
@@ -270,7 +397,115 @@ public:
     * initialize() may not have any effect.
     */
     void initialize(const SimTK::State& s);
-    
+
+    /**
+    * Reinitializes an already-initialized Manager so the same instance can
+    * be reused for another simulation without constructing a new Manager.
+    * The existing SimTK::TimeStepper and Integrator, along with their
+    * internal allocations, are reused and simply rewound to the provided
+    * state, so repeated short simulations from stored states (e.g. episodic
+    * rollouts on the same model) pay only the cost of copying the state
+    * rather than that of rebuilding the integration machinery.
+    *
+    * The recorded time and dt arrays and the states storage are cleared so
+    * that each session starts fresh; a dt array installed with setDTArray()
+    * is preserved. If the Manager has not been initialized yet, this is
+    * equivalent to calling initialize().
+    *
+    * As with initialize(), subsequent changes to the State passed in here
+    * will not affect the simulation.
+    *
+    * Example: Simulating many episodes from stored initial states
+    * @code
+    * SimTK::State state = model.initSystem();
+    * Manager manager(model);
+    * manager.initialize(state);
+    * for (int episode = 0; episode < numEpisodes; ++episode) {
+    *     state = initialStates[episode];
+    *     manager.reinitialize(state);
+    *     state = manager.integrate(state.getTime() + episodeDuration);
+    * }
+    * @endcode
+    */
+    void reinitialize(const SimTK::State& s);
+
+    /**
+    * Writes a checkpoint of this Manager's simulation to a file so that a
+    * preempted job can later resume with restoreCheckpoint() instead of
+    * recomputing from the start. The checkpoint holds the current time, the
+    * integrator's predicted next step size, and the value of every model
+    * state variable, all at full precision so each double round-trips
+    * exactly. The Manager must have been initialized.
+    */
+    void writeCheckpoint(const std::string& fileName) const;
+
+    /**
+    * Restores a checkpoint written by writeCheckpoint(): the model state
+    * variables and the time are restored exactly, the integrator's initial
+    * step size is set to the checkpointed step size, and the Manager is
+    * rewound with reinitialize(). Continue the simulation by calling
+    * integrate() with the desired final time. This Manager must wrap the
+    * same model (same state variables) that the checkpoint was written
+    * from.
+    *
+    * The state itself is restored bit-exactly. A variable-step integrator,
+    * however, restarts its step-size controller from the checkpointed step,
+    * so the resumed trajectory matches an uninterrupted run to within the
+    * integrator's accuracy rather than bit-for-bit.
+    */
+    void restoreCheckpoint(const std::string& fileName);
+
+    /**
+    * Capture the inputs of the next integrate() call -- the initial value of
+    * every state variable, the stepping scheme, and the model's control
+    * vector at every completed step -- so they can be written to a replay
+    * file with writeReplay(). Capturing costs one state-variable read at the
+    * start of the run and one controls read per step; it is off by default.
+    *
+    * Together with writeReplay() and replay() this makes a run reproducible
+    * on another machine: a slow or divergent simulation on a compute farm
+    * can be re-executed on a workstation from exactly the same inputs, which
+    * is the precondition for profiling it meaningfully.
+    */
+    void setRecordReplay(bool record) { _recordReplay = record; }
+    bool getRecordReplay() const { return _recordReplay; }
+
+    /** The control trajectory captured by the most recent integrate() call
+    * with setRecordReplay(true): one row per completed integration step,
+    * one column per entry of the model's controls vector. */
+    const TimeSeriesTable& getReplayControls() const { return _replayControls; }
+
+    /**
+    * Writes the inputs captured by the most recent integrate() call (see
+    * setRecordReplay()) to a replay file. The file holds the initial time
+    * and final time, the integrator method and accuracy, the stepping
+    * scheme (including the realized step times of a fixed-step run), the
+    * initial value of every state variable, the captured control
+    * trajectory, and the data-source names of any ExternalForce components,
+    * all doubles at full precision so each round-trips exactly.
+    */
+    void writeReplay(const std::string& fileName) const;
+
+    /**
+    * Re-executes a simulation from a replay file written by writeReplay()
+    * and returns the final state. The model must be structurally the same
+    * model the replay was captured from (same state variables and
+    * controls); initSystem() is called on it here. A new Manager is
+    * configured with the recorded integrator method, accuracy, and stepping
+    * scheme, the recorded initial state is restored exactly, and the run is
+    * re-integrated to the recorded final time.
+    *
+    * The re-run's controls are captured and compared against the recorded
+    * control trajectory: a bit-identical match is logged at info level and
+    * any deviation is logged as a warning with its magnitude, so a replay
+    * that fails to reproduce the original run announces itself rather than
+    * silently profiling a different trajectory. On one machine and build,
+    * the same inputs make the integration deterministic; across machines,
+    * deviations beyond integrator accuracy indicate a divergence worth
+    * investigating on its own.
+    */
+    static SimTK::State replay(Model& model, const std::string& fileName);
+
     /**
     * Integrate the equations of motion for the specified model, given the current
     * state (at which the integration will start) and a finalTime. You must call
@@ -363,6 +598,15 @@ private:
     // step = 0 is the beginning, step = -1 used to denote the end/final step
     void record(const SimTK::State& s, const int& step);
 
+    // The integrator method most recently set via setIntegratorMethod(),
+    // recorded into replay files so replay() can reconstruct the same
+    // integrator. Declared here because the IntegratorMethod enum is not
+    // yet visible in the data section above.
+    IntegratorMethod _integratorMethod;
+
+    // Append the model's controls at this state to _replayControls.
+    void recordReplayControls(const SimTK::State& s);
+
 //=============================================================================
 };  // END of class Manager
 
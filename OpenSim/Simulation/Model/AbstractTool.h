@@ -45,6 +45,15 @@ class ForceSet;
 /**
  * An abstract class for specifying the interface for an investigation.
  *
+ * Thread safety: distinct tool instances may run() concurrently provided
+ * each instance, and the Model it operates on, is confined to one thread.
+ * The output number format (IO::SetPrecision() and friends) is kept
+ * per-thread for this reason. The process working directory is not
+ * per-thread, however: a tool loaded from a setup file changes into the
+ * setup file's directory while it runs, so such runs must not overlap runs
+ * that depend on a different working directory. ToolJobPool arranges all
+ * of this when running tool configurations in parallel.
+ *
  * @author Frank C. Anderson
  * @version 1.0
  */
@@ -252,6 +261,10 @@ public:
     */
     virtual Model& getModel() const;
 
+    /** Whether a model has been set with setModel() or loaded; getModel()
+        throws when this is false. */
+    bool hasModel() const { return _model != NULL; }
+
     bool getReplaceForceSet() const { return _replaceForceSet; }
     void setReplaceForceSet(bool aReplace) { _replaceForceSet = aReplace; }
 
@@ -30,6 +30,11 @@
 // INCLUDES
 //=============================================================================
 #include "AnalysisSet.h"
+#include "Model.h"
+
+#include <exception>
+#include <thread>
+#include <vector>
 
 
 using namespace OpenSim;
@@ -105,6 +110,7 @@ void AnalysisSet::
 setNull()
 {
     _enable = true;
+    _parallel = false;
 }
 void AnalysisSet::
 setupProperties() {
@@ -120,6 +126,7 @@ operator=(const  AnalysisSet &aSet)
      Set<Analysis>::operator=(aSet);
  
      _enable = aSet._enable;
+     _parallel = aSet._parallel;
      return(*this);
 }
 //=============================================================================
@@ -184,6 +191,33 @@ getOn() const
     return on;
 }
 
+//-----------------------------------------------------------------------------
+// PARALLEL EXECUTION
+//-----------------------------------------------------------------------------
+//_____________________________________________________________________________
+/**
+ * Set whether step() invokes the enabled analyses concurrently, each on its
+ * own thread, rather than one after another.  Analyses record their results
+ * into their own storage objects, so their outputs do not conflict; however,
+ * it is only safe to enable this option when every analysis in the set merely
+ * reads the realized state (e.g., BodyKinematics, ForceReporter,
+ * JointReaction).  Analyses that modify the model or share working memory
+ * must be run serially.  This setting is not serialized.
+ *
+ * @param aTrueFalse If true, step() runs the analyses concurrently.
+ */
+void AnalysisSet::
+setParallel(bool aTrueFalse)
+{
+    _parallel = aTrueFalse;
+}
+
+bool AnalysisSet::
+getParallel() const
+{
+    return(_parallel);
+}
+
 
 //=============================================================================
 // CALLBACKS
@@ -210,15 +244,50 @@ void AnalysisSet::begin(const SimTK::State& s )
  * after each successful integration time step and is intended to be used for
  * conducting analyses, driving animations, etc.
  *
- * @param s Current state 
+ * If parallel execution has been enabled (see setParallel()), each enabled
+ * analysis runs on its own thread.  The state is realized to the acceleration
+ * stage up front so that the analyses, which each record into their own
+ * storage, only read from the shared state.
+ *
+ * @param s Current state
  */
 void AnalysisSet::
 step( const SimTK::State& s, int stepNumber )
 {
     int i;
+    Array<int> onIndices(-1,0);
     for(i=0;i<getSize();i++) {
-        Analysis& analysis = get(i);
-        if (analysis.getOn()) analysis.step(s, stepNumber);
+        if (get(i).getOn()) onIndices.append(i);
+    }
+
+    if (_parallel && onIndices.getSize() > 1 && _model) {
+
+        // Realize once so the analyses need not trigger realization (which
+        // writes to the state's cache and is not thread safe) themselves.
+        _model->getMultibodySystem().realize(s, SimTK::Stage::Acceleration);
+
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> exceptions(onIndices.getSize());
+        for(i=0;i<onIndices.getSize();i++) {
+            Analysis& analysis = get(onIndices[i]);
+            std::exception_ptr& exception = exceptions[i];
+            threads.emplace_back([&analysis, &exception, &s, stepNumber]() {
+                try {
+                    analysis.step(s, stepNumber);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+            });
+        }
+        for(auto& thread : threads) thread.join();
+        for(const auto& exception : exceptions) {
+            if (exception) std::rethrow_exception(exception);
+        }
+
+    } else {
+        for(i=0;i<onIndices.getSize();i++) {
+            get(onIndices[i]).step(s, stepNumber);
+        }
     }
 }
 //_____________________________________________________________________________
@@ -65,6 +65,10 @@ protected:
     // testing for memory free error
     OpenSim::PropertyBool _enableProp;
     bool &_enable;
+
+    /** Whether step() runs the enabled analyses concurrently. Not
+    serialized; see setParallel(). */
+    bool _parallel;
 //
 //=============================================================================
 // METHODS
@@ -92,6 +96,8 @@ public:
     void setOn(bool aTrueFalse);
     void setOn(const Array<bool> &aOn);
     Array<bool> getOn() const;
+    void setParallel(bool aTrueFalse);
+    bool getParallel() const;
 
     //--------------------------------------------------------------------------
     // CALLBACKS
@@ -129,14 +129,18 @@ void Bhargava2004MuscleMetabolicsProbe::constructProperties()
 void Bhargava2004MuscleMetabolicsProbe::extendConnectToModel(Model& aModel)
 {
     Super::extendConnectToModel(aModel);
+    _muscleParameters.clear();
     if (!isEnabled()) return;   // Nothing to connect
 
-    const int nM = 
+    const int nM =
         get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
         .getSize();
+    _muscleParameters.reserve(nM);
     for (int i=0; i<nM; ++i) {
-        connectIndividualMetabolicMuscle(aModel, 
-            upd_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i]);
+        Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter& mm =
+            upd_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i];
+        connectIndividualMetabolicMuscle(aModel, mm);
+        _muscleParameters.push_back(&mm);
     }
 }
 
@@ -254,44 +258,63 @@ computeProbeInputs(const State& s) const
     Vector EdotOutput(getNumProbeInputs());
     EdotOutput = 0;
 
+    // Hoist the loop-invariant property values out of the muscle loop; the
+    // property lookups are not free and this method is called at every
+    // reported time step.
+    const double effortScalingFactor = get_muscle_effort_scaling_factor();
+    const bool activationRateOn = get_activation_rate_on();
+    const bool maintenanceRateOn = get_maintenance_rate_on();
+    const bool shorteningRateOn = get_shortening_rate_on();
+    const bool workRateOn = get_mechanical_work_rate_on();
+    const bool forbidNegativeTotalPower = get_forbid_negative_total_power();
+    const bool includeNegativeMechanicalWork =
+        get_include_negative_mechanical_work();
+    const bool useForceDependentShorteningPropConstant =
+        get_use_force_dependent_shortening_prop_constant();
+    const bool enforceMinimumHeatRatePerMuscle =
+        get_enforce_minimum_heat_rate_per_muscle();
+    const bool reportTotalMetabolicsOnly = get_report_total_metabolics_only();
+    const PiecewiseLinearFunction& fiberLengthDependenceFunc =
+        get_normalized_fiber_length_dependence_on_maintenance_rate();
+
 
     // BASAL METABOLIC RATE (W) (based on whole body mass, not muscle mass)
     // so do outside of muscle loop.
     // TODO: system mass should be precalculated.
     // ------------------------------------------------------------------
     if (get_basal_rate_on()) {
-        Bdot = get_basal_coefficient() 
+        Bdot = get_basal_coefficient()
             * pow(_model->getMatterSubsystem().calcSystemMass(s), get_basal_exponent());
-        if (isNaN(Bdot)) 
+        if (isNaN(Bdot))
             log_warn("{}: Bdot = NaN!", getName());
     }
     EdotOutput(0) += Bdot;       // TOTAL metabolic power storage
-    
-    if (!get_report_total_metabolics_only())
+
+    if (!reportTotalMetabolicsOnly)
         EdotOutput(1) = Bdot;    // BASAL metabolic power storage
 
 
-    // Loop through each muscle in the MetabolicMuscleParameterSet
-    const int nM = 
-        get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
-        .getSize();
+    // Loop through each muscle using the flat parameter list cached on
+    // connect; this avoids a MetabolicMuscleParameterSet lookup per muscle.
+    const int nM = (int)_muscleParameters.size();
+    Vector fiberLengthInput(1, 0.0);    // reused Function argument
     for (int i=0; i<nM; i++)
     {
-        // Get the current muscle parameters from the MetabolicMuscleParameterSet
-        // and the corresponding OpenSim::Muscle pointer from the muscleMap.
-        Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter& mm = 
-            get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i];   
+        // Get the current muscle parameters and the corresponding
+        // OpenSim::Muscle pointer (both resolved in extendConnectToModel()).
+        Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter& mm =
+            *_muscleParameters[i];
         const Muscle* m = mm.getMuscle();
 
         // Get important muscle values at the current time state
         const double max_isometric_force = m->getMaxIsometricForce();
         //const double max_shortening_velocity = m->getMaxContractionVelocity();
-        const double activation = get_muscle_effort_scaling_factor()
+        const double activation = effortScalingFactor
                                   * m->getActivation(s);
-        const double excitation = get_muscle_effort_scaling_factor()
+        const double excitation = effortScalingFactor
                                   * m->getControl(s);
         const double fiber_force_passive = m->getPassiveFiberForce(s);
-        const double fiber_force_active = get_muscle_effort_scaling_factor()
+        const double fiber_force_active = effortScalingFactor
                                           * m->getActiveFiberForce(s);
         const double fiber_force_total = fiber_force_active     // Scaled.
                                          + fiber_force_passive;
@@ -316,7 +339,7 @@ computeProbeInputs(const State& s) const
 
         // ACTIVATION HEAT RATE for muscle i (W)
         // ------------------------------------------
-        if (get_forbid_negative_total_power() || get_activation_rate_on())
+        if (forbidNegativeTotalPower || activationRateOn)
         {
             const double decay_function_value = 1.0;    // This value is set to 1.0, as used by Anderson & Pandy (1999), however, in
                                                         // Bhargava et al., (2004) they assume a function here. We will ignore this
@@ -329,11 +352,11 @@ computeProbeInputs(const State& s) const
 
         // MAINTENANCE HEAT RATE for muscle i (W)
         // ------------------------------------------
-        if (get_forbid_negative_total_power() || get_maintenance_rate_on())
+        if (forbidNegativeTotalPower || maintenanceRateOn)
         {
-            Vector tmp(1, fiber_length_normalized);
-            fiber_length_dependence = get_normalized_fiber_length_dependence_on_maintenance_rate().calcValue(tmp);
-            
+            fiberLengthInput[0] = fiber_length_normalized;
+            fiber_length_dependence = fiberLengthDependenceFunc.calcValue(fiberLengthInput);
+
             Mdot = mm.getMuscleMass() * fiber_length_dependence * 
                 ( (mm.get_maintenance_constant_slow_twitch() * slow_twitch_excitation) + (mm.get_maintenance_constant_fast_twitch() * fast_twitch_excitation) );
         }
@@ -343,9 +366,9 @@ computeProbeInputs(const State& s) const
         // SHORTENING HEAT RATE for muscle i (W)
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening
         // -----------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_shortening_rate_on())
+        if (forbidNegativeTotalPower || shorteningRateOn)
         {
-            if (get_use_force_dependent_shortening_prop_constant())
+            if (useForceDependentShorteningPropConstant)
             {
                 if (fiber_velocity <= 0)    // concentric contraction, Vm<0
                     alpha = (0.16 * F_iso) + (0.18 * fiber_force_total);
@@ -367,9 +390,9 @@ computeProbeInputs(const State& s) const
         // MECHANICAL WORK RATE for the contractile element of muscle i (W).
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening.
         // -------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_mechanical_work_rate_on())
+        if (forbidNegativeTotalPower || workRateOn)
         {
-            if (get_include_negative_mechanical_work() || fiber_velocity <= 0)
+            if (includeNegativeMechanicalWork || fiber_velocity <= 0)
                 Wdot = -fiber_force_active*fiber_velocity;
             else
                 Wdot = 0;
@@ -390,7 +413,7 @@ computeProbeInputs(const State& s) const
 
         // If necessary, increase the shortening heat rate so that the total
         // power is non-negative.
-        if (get_forbid_negative_total_power()) {
+        if (forbidNegativeTotalPower) {
             const double Edot_W_beforeClamp = Adot + Mdot + Sdot + Wdot;
             if (Edot_W_beforeClamp < 0)
                 Sdot -= Edot_W_beforeClamp;
@@ -402,10 +425,10 @@ computeProbeInputs(const State& s) const
         // -----------------------------------------------------------------------
         double totalHeatRate = Adot + Mdot + Sdot;      // (W)
 
-        if(get_enforce_minimum_heat_rate_per_muscle() && totalHeatRate < 1.0 * mm.getMuscleMass()
-            && get_activation_rate_on() 
-            && get_maintenance_rate_on() 
-            && get_shortening_rate_on()) {
+        if(enforceMinimumHeatRatePerMuscle && totalHeatRate < 1.0 * mm.getMuscleMass()
+            && activationRateOn
+            && maintenanceRateOn
+            && shorteningRateOn) {
                 //cout << "WARNING: " << getName() 
                 //    << "  (t = " << s.getTime() 
                 //    << "), the muscle '" << mm.getName() 
@@ -418,23 +441,23 @@ computeProbeInputs(const State& s) const
         // ------------------------------------------
         double Edot = 0;
 
-        if (get_activation_rate_on() && get_maintenance_rate_on()
-            && get_shortening_rate_on())
+        if (activationRateOn && maintenanceRateOn
+            && shorteningRateOn)
         {
             Edot += totalHeatRate;      // May have been clamped to 1.0 W/kg.
         } else {
-            if (get_activation_rate_on())
+            if (activationRateOn)
                 Edot += Adot;
-            if (get_maintenance_rate_on())
+            if (maintenanceRateOn)
                 Edot += Mdot;
-            if (get_shortening_rate_on())
+            if (shorteningRateOn)
                 Edot += Sdot;
         }
-        if (get_mechanical_work_rate_on())
+        if (workRateOn)
             Edot += Wdot;
 
         EdotOutput(0) += Edot;       // Add to TOTAL metabolic power storage
-        if (!get_report_total_metabolics_only()) {
+        if (!reportTotalMetabolicsOnly) {
             // Metabolic power storage for muscle i
             EdotOutput(i+2) = Edot;  
         }  
@@ -28,6 +28,8 @@
 #include <OpenSim/Common/PiecewiseLinearFunction.h>
 #include <OpenSim/Common/Set.h>
 
+#include <vector>
+
 namespace OpenSim {
 
 class Muscle;
@@ -444,6 +446,13 @@ private:
     //--------------------------------------------------------------------------
     MuscleMap _muscleMap;
 
+    // Flat list of the metabolic muscle parameters, in
+    // MetabolicMuscleParameterSet order, rebuilt on connect so that
+    // computeProbeInputs() can evaluate every muscle in one loop without
+    // repeated set lookups.
+    std::vector<Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter*>
+        _muscleParameters;
+
 
     //--------------------------------------------------------------------------
     // ModelComponent Interface
@@ -108,6 +108,15 @@ void Blankevoort1991Ligament::extendFinalizeFromProperties() {
             getProperty_transition_strain().getName(),
             "Transistion Strain cannot be less than 0");
 
+    // Precompute the piecewise spring-curve constants so the per-evaluation
+    // force computation reads no properties.  The curve stays exact in
+    // every region.
+    _transitionStrain = get_transition_strain();
+    _linearStiffness = get_linear_stiffness();
+    _toeStiffness = (_transitionStrain > 0)
+            ? 0.5 * _linearStiffness / _transitionStrain : 0.0;
+    _linearOffset = _linearStiffness * _transitionStrain / 2;
+
     // Set Default Ligament Color
     GeometryPath& path = upd_GeometryPath();
     path.setDefaultColor(SimTK::Vec3(0.1202, 0.7054, 0.1318));
@@ -282,8 +291,6 @@ double Blankevoort1991Ligament::calcSpringForce(
         const SimTK::State& state) const {
 
     double strain = getStrain(state);
-    double k = get_linear_stiffness();
-    double e_t = get_transition_strain();
 
     double force_spring;
     // slack region
@@ -291,12 +298,12 @@ double Blankevoort1991Ligament::calcSpringForce(
         force_spring = 0.0;
     }
     // toe region F = 1/2 * k / e_t * e^2
-    else if ((strain > 0) && (strain < e_t)) {        
-        force_spring = 0.5 * k / e_t * SimTK::square(strain);
+    else if (strain < _transitionStrain) {
+        force_spring = _toeStiffness * SimTK::square(strain);
     }
     // linear region F = k * (e-e_t/2)
-    else {//strain >= e_t 
-        force_spring = k * (strain - e_t / 2); 
+    else {//strain >= e_t
+        force_spring = _linearStiffness * strain - _linearOffset;
     }
     return force_spring;
 }
@@ -315,10 +322,13 @@ double Blankevoort1991Ligament::calcDampingForce(const SimTK::State& s) const {
     }
 
     //Phase-out damping as strain goes to zero with smooth-step function
-    SimTK::Function::Step step(0, 1, 0, 0.01);
-    SimTK::Vector in_vec(1, strain);
-    force_damping = force_damping * step.calcValue(in_vec);
-    
+    //(the same quintic SimTK::Function::Step evaluates, computed inline so
+    //no function object or argument Vector is built per evaluation).
+    const double phaseOutStrain = 0.01;
+    if (strain < phaseOutStrain) {
+        force_damping = force_damping * SimTK::stepUp(strain / phaseOutStrain);
+    }
+
     return force_damping;
 }
 
@@ -217,6 +217,14 @@ private:
     mutable CacheVariable<double> _forceDampingCV;
     mutable CacheVariable<double> _forceTotalCV;
 
+    // Spring-curve constants precomputed in extendFinalizeFromProperties()
+    // so the piecewise force evaluation reads no properties: toe region
+    // F = _toeStiffness*e^2, linear region F = k*e - _linearOffset.
+    double _transitionStrain;
+    double _linearStiffness;
+    double _toeStiffness;
+    double _linearOffset;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -152,6 +152,25 @@ void ConditionalPathPoint::setRangeMax(double maxVal)
     set_range(1, maxVal);
 }
 
+//_____________________________________________________________________________
+/*
+ * Cache the coordinate and the padded activation range at connect time so
+ * that isActive() does no socket lookups or property accesses inside the
+ * path assembly loop.
+ */
+void ConditionalPathPoint::extendConnectToModel(Model& model)
+{
+    Super::extendConnectToModel(model);
+
+    if (getSocket<Coordinate>("coordinate").isConnected())
+        _coordinate.reset(&getConnectee<Coordinate>("coordinate"));
+    else
+        _coordinate.reset(nullptr);
+
+    _rangeMinThreshold = get_range(0) - 1e-5;
+    _rangeMaxThreshold = get_range(1) + 1e-5;
+}
+
 //_____________________________________________________________________________
 /*
  * Determine if this point is active by checking the value of the
@@ -159,11 +178,8 @@ void ConditionalPathPoint::setRangeMax(double maxVal)
  */
 bool ConditionalPathPoint::isActive(const SimTK::State& s) const
 {
-    if (getSocket<Coordinate>("coordinate").isConnected()) {
-        double value = getConnectee<Coordinate>("coordinate").getValue(s);
-        if (value >= get_range(0) - 1e-5 &&
-             value <= get_range(1) + 1e-5)
-            return true;
-    }
-    return false;
+    if (_coordinate.empty())
+        return false;
+    const double value = _coordinate->getValue(s);
+    return value >= _rangeMinThreshold && value <= _rangeMaxThreshold;
 }
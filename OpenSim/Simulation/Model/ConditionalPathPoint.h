@@ -77,7 +77,16 @@ public:
 
 private:
     void constructProperties();
+    void extendConnectToModel(Model& model) override;
     void updateFromXMLNode(SimTK::Xml::Element& node, int versionNumber) override;
+
+private:
+    SimTK::ReferencePtr<const Coordinate> _coordinate;
+    // Activation thresholds (the range property padded by the activation
+    // tolerance), precomputed at connect time so that isActive() is a
+    // coordinate value lookup and two comparisons.
+    double _rangeMinThreshold{-SimTK::Infinity};
+    double _rangeMaxThreshold{SimTK::Infinity};
 //=============================================================================
 };  // END of class ConditionalPathPoint
 //=============================================================================
@@ -22,10 +22,55 @@
  * -------------------------------------------------------------------------- */
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <OpenSim/Common/IO.h>
+#include <SimTKcommon/internal/Pathname.h>
 #include "ContactMesh.h"
 #include "Model.h"
 
+namespace {
+
+// Building a SimTK::ContactGeometry::TriangleMesh computes the mesh's
+// bounding-volume hierarchy, which takes seconds for the dense (~100k
+// triangle) meshes used in articular-cartilage models.  ContactMesh
+// discards its geometry on every finalizeFromProperties(), so without a
+// cache each initSystem() -- and each model clone made by the analysis
+// tools -- re-parses the file and rebuilds the hierarchy.  Cache the built
+// mesh per absolute file name for the life of the process; at run time
+// Simbody places the prebuilt hierarchy using the body transforms, so
+// nothing is rebuilt per frame.
+struct CachedContactMesh {
+    SimTK::PolygonalMesh polygonalMesh;
+    std::shared_ptr<SimTK::ContactGeometry::TriangleMesh> triangleMesh;
+};
+
+std::mutex meshCacheMutex;
+
+std::shared_ptr<CachedContactMesh>
+loadCachedContactMesh(const std::string& filename)
+{
+    static std::map<std::string, std::shared_ptr<CachedContactMesh>> cache;
+
+    // Resolve relative to the current working directory, which the caller
+    // has already pointed at the model directory if one is known.
+    const std::string key = SimTK::Pathname::getAbsolutePathname(filename);
+
+    std::lock_guard<std::mutex> lock(meshCacheMutex);
+    auto it = cache.find(key);
+    if (it != cache.end())
+        return it->second;
+
+    auto entry = std::make_shared<CachedContactMesh>();
+    entry->polygonalMesh.loadFile(filename);
+    entry->triangleMesh.reset(
+        new SimTK::ContactGeometry::TriangleMesh(entry->polygonalMesh));
+    cache[key] = entry;
+    return entry;
+}
+
+} // namespace
+
 namespace OpenSim {
 
 ContactMesh::ContactMesh() 
@@ -49,10 +94,10 @@ ContactMesh::ContactMesh(const std::string& filename,
         if (file.fail())
             throw Exception("Error loading mesh file: "+filename+". The file should exist in same folder with model.\n Model loading is aborted.");
         file.close();
-        SimTK::PolygonalMesh mesh;
-        mesh.loadFile(filename);
-        _geometry.reset(new SimTK::ContactGeometry::TriangleMesh(mesh));
-        _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
+        auto cached = loadCachedContactMesh(filename);
+        _geometry = cached->triangleMesh;
+        _decorativeGeometry.reset(
+                new SimTK::DecorativeMesh(cached->polygonalMesh));
     }
 }
 
@@ -93,10 +138,9 @@ void ContactMesh::setFilename(const std::string& filename)
     _decorativeGeometry.reset();
 }
 
-SimTK::ContactGeometry::TriangleMesh* ContactMesh::
+std::shared_ptr<SimTK::ContactGeometry::TriangleMesh> ContactMesh::
     loadMesh(const std::string& filename) const
 {
-    SimTK::PolygonalMesh mesh;
     std::ifstream file;
     assert (_model);
 
@@ -113,18 +157,32 @@ SimTK::ContactGeometry::TriangleMesh* ContactMesh::
                 "Loading is aborted.");
     }
     file.close();
-    mesh.loadFile(filename);
-    _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
-    return new SimTK::ContactGeometry::TriangleMesh(mesh);
+    auto cached = loadCachedContactMesh(filename);
+    _decorativeGeometry.reset(
+            new SimTK::DecorativeMesh(cached->polygonalMesh));
+    return cached->triangleMesh;
 }
 
 SimTK::ContactGeometry ContactMesh::createSimTKContactGeometry() const
 {
     if (!_geometry)
-        _geometry.reset(loadMesh(get_filename()));
+        _geometry = loadMesh(get_filename());
     return *_geometry;
 }
 
+std::size_t ContactMesh::extendGetMemoryFootprint() const
+{
+    std::size_t bytes = Super::extendGetMemoryFootprint();
+    if (_geometry) {
+        const auto& mesh = *_geometry;
+        // Vertices, face vertex indices, and roughly one OBB tree node per
+        // face for the bounding-volume hierarchy.
+        bytes += mesh.getNumVertices()*sizeof(SimTK::Vec3);
+        bytes += mesh.getNumFaces()*(3*sizeof(int) + sizeof(SimTK::OrientedBoundingBox));
+    }
+    return bytes;
+}
+
 //=============================================================================
 // VISUALIZER GEOMETRY
 //=============================================================================
@@ -25,6 +25,8 @@
 // INCLUDE
 #include "ContactGeometry.h"
 
+#include <memory>
+
 namespace OpenSim {
 
 // TODO update doxygen comments to mention socket.
@@ -98,20 +100,31 @@ public:
     void generateDecorations(bool fixed, const ModelDisplayHints& hints,
         const SimTK::State& s,
         SimTK::Array_<SimTK::DecorativeGeometry>& geometry) const override;
+protected:
+    /** Adds the decoded triangle mesh (vertices, faces, and the per-face
+    bounding-volume hierarchy estimate) to the memory footprint report. */
+    std::size_t extendGetMemoryFootprint() const override;
+
 private:
     // INITIALIZATION
     void setNull();
     void constructProperties();
     void extendFinalizeFromProperties() override;
 
-    /** Load the mesh from a file.
+    /** Load the mesh from a file, consulting a process-wide cache of built
+    meshes so the triangle hierarchy for a dense mesh is constructed only
+    once per file rather than on every model finalize.
     @param filename   string containing the file to be loaded
-    @return SimTK::ContactGeometry::TriangleMesh* heap allocated Contact mesh */
-    SimTK::ContactGeometry::TriangleMesh* loadMesh(const std::string& filename) const;
+    @return shared Contact mesh, owned jointly with the cache */
+    std::shared_ptr<SimTK::ContactGeometry::TriangleMesh>
+        loadMesh(const std::string& filename) const;
 //=============================================================================
 // DATA
 //=============================================================================
-    mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::ContactGeometry::TriangleMesh>>
+    // The triangle mesh (with its internal bounding-volume hierarchy) is
+    // shared with the cache and with any other ContactMesh instances --
+    // including model clones -- that reference the same file.
+    mutable SimTK::ResetOnCopy<std::shared_ptr<SimTK::ContactGeometry::TriangleMesh>>
         _geometry;
     mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::DecorativeMesh>>
         _decorativeGeometry;
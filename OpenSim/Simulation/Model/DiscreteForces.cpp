@@ -1,5 +1,5 @@
 /* -------------------------------------------------------------------------- *
- * OpenSim Moco: DiscreteForces.cpp                                           *
+ * OpenSim: DiscreteForces.cpp                                                *
  * -------------------------------------------------------------------------- *
  * Copyright (c) 2019 Stanford University and the Authors                     *
  *                                                                            *
@@ -17,26 +17,54 @@
  * -------------------------------------------------------------------------- */
 
 #include "DiscreteForces.h"
-#include <OpenSim/Simulation/Model/Model.h>
+#include "Model.h"
+
+#include <algorithm>
 
 using namespace OpenSim;
 
 void DiscreteForces::extendAddToSystem(SimTK::MultibodySystem& system) const {
     Super::extendAddToSystem(system);
 
-    SimTK::SubsystemIndex forcesIdx = 
+    SimTK::SubsystemIndex forcesIdx =
         getModel().getForceSubsystem().getMySubsystemIndex();
-    SimTK::ForceSubsystem& forces = 
+    SimTK::ForceSubsystem& forces =
         SimTK::ForceSubsystem::updDowncast(system.updSubsystem(forcesIdx));
     m_discrete_forces = SimTK::Force::DiscreteForces(
         SimTK::GeneralForceSubsystem::updDowncast(forces),
         system.getMatterSubsystem());
 }
 
-void DiscreteForces::setAllForces(SimTK::State& s, 
+void DiscreteForces::setAllForces(SimTK::State& s,
         const SimTK::Vector& generalizedForces,
         const SimTK::Vector_<SimTK::SpatialVec>& bodyForcesInG) const {
 
     m_discrete_forces.setAllMobilityForces(s, generalizedForces);
     m_discrete_forces.setAllBodyForces(s, bodyForcesInG);
 }
+
+void DiscreteForces::setAllForces(SimTK::State& s,
+        const double* generalizedForces, int numMobilities,
+        const SimTK::SpatialVec* bodyForcesInG, int numBodies) const {
+
+    // Stage the raw values through buffers that keep their allocation
+    // between calls.
+    if (m_generalizedForcesBuffer.size() != numMobilities)
+        m_generalizedForcesBuffer.resize(numMobilities);
+    if (numMobilities > 0)
+        std::copy(generalizedForces, generalizedForces + numMobilities,
+                &m_generalizedForcesBuffer[0]);
+
+    if (m_bodyForcesBuffer.size() != numBodies)
+        m_bodyForcesBuffer.resize(numBodies);
+    if (numBodies > 0)
+        std::copy(bodyForcesInG, bodyForcesInG + numBodies,
+                &m_bodyForcesBuffer[0]);
+
+    m_discrete_forces.setAllMobilityForces(s, m_generalizedForcesBuffer);
+    m_discrete_forces.setAllBodyForces(s, m_bodyForcesBuffer);
+}
+
+void DiscreteForces::clearAllForces(SimTK::State& s) const {
+    m_discrete_forces.clearAllForces(s);
+}
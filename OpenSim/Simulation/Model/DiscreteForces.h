@@ -18,11 +18,9 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
-#include <OpenSim/Simulation/Model/ModelComponent.h>
+#include "ModelComponent.h"
 #include <simbody/internal/Force_DiscreteForces.h>
 
-#include <OpenSim/Moco/osimMocoDLL.h>
-
 namespace OpenSim {
 
 /** This class is a thin wrapper to Simbody's SimTK::Force::DiscreteForces
@@ -31,27 +29,46 @@ State for discrete variables holding the most recent value of the forces set
 through the component. Discrete variables are *not* updated through the same
 realization mechanisms as typical continuous variables are, and so must be
 manually updated before realizing to acceleration whenever their values
-change. However, this class is mainly used within MocoProblemRep and classes
-derived from MocoSolver to handle constraint forces, and is not intended for
-use outside of Moco. The wrapper to OpenSim is necessary so that the
-discrete variables appear in the State whenever initSystem() is called on
-a model. */
-class OSIMMOCO_API DiscreteForces : public ModelComponent {
+change. The wrapper to OpenSim is necessary so that the discrete variables
+appear in the State whenever initSystem() is called on a model.
+
+This component is used within MocoProblemRep and classes derived from
+MocoSolver to handle constraint forces, and is also suitable for general
+external-force injection (e.g. from an estimator or controller running
+alongside the simulation). Callers updating the forces at solver iteration
+rates can use the raw-array overload of setAllForces(), which copies through
+preallocated buffers and performs no per-call allocation. */
+class OSIMSIMULATION_API DiscreteForces : public ModelComponent {
     OpenSim_DECLARE_CONCRETE_OBJECT(DiscreteForces, ModelComponent);
 
 public:
     DiscreteForces() : ModelComponent() {}
 
-    void setAllForces(SimTK::State& s, 
+    void setAllForces(SimTK::State& s,
             const SimTK::Vector& generalizedForces,
             const SimTK::Vector_<SimTK::SpatialVec>& bodyForcesInG) const;
 
+    /** Set the forces from raw arrays. `generalizedForces` must hold one
+    entry per mobility and `bodyForcesInG` one SpatialVec per mobilized body
+    (including ground). The values are staged through buffers that are
+    allocated once and reused, so repeated calls do not allocate. */
+    void setAllForces(SimTK::State& s,
+            const double* generalizedForces, int numMobilities,
+            const SimTK::SpatialVec* bodyForcesInG, int numBodies) const;
+
+    /** Zero out all the forces previously set. */
+    void clearAllForces(SimTK::State& s) const;
+
 protected:
     void extendAddToSystem(SimTK::MultibodySystem& system) const override;
 
 private:
     mutable SimTK::Force::DiscreteForces m_discrete_forces;
 
+    // preallocated staging buffers for the raw-array setter
+    mutable SimTK::Vector m_generalizedForcesBuffer;
+    mutable SimTK::Vector_<SimTK::SpatialVec> m_bodyForcesBuffer;
+
 }; // class DiscreteForces
 
 } // namespace OpenSim
@@ -42,6 +42,23 @@ std::string to_string(T const& value) {
     return sstr.str();
 }
 
+namespace {
+// Cache the locations of a compiled expression's deflection variables so
+// evaluating the expression requires no lookups. The optimizer may have
+// eliminated a variable (e.g., for a constant expression); leave the
+// corresponding entry null in that case.
+void bindDeflectionVariables(Lepton::CompiledExpression& expr,
+        std::array<double*, 6>& vars) {
+    static const std::string names[6] = {"theta_x", "theta_y", "theta_z",
+            "delta_x", "delta_y", "delta_z"};
+    for (int i = 0; i < 6; ++i) {
+        vars[i] = expr.getVariables().count(names[i])
+                          ? &expr.getVariableReference(names[i])
+                          : nullptr;
+    }
+}
+} // namespace
+
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
 //=============================================================================
@@ -208,6 +225,19 @@ void ExpressionBasedBushingForce::extendFinalizeFromProperties()
     setFyExpression(get_Fy_expression());
     setFzExpression(get_Fz_expression());
 
+    // compile all six expressions as one fused program so that
+    // subexpressions shared between components (e.g., common stiffness
+    // terms) are evaluated only once per force evaluation
+    std::vector<Lepton::ParsedExpression> expressions;
+    for (const std::string& expression :
+            {get_Mx_expression(), get_My_expression(), get_Mz_expression(),
+                    get_Fx_expression(), get_Fy_expression(),
+                    get_Fz_expression()}) {
+        expressions.push_back(Lepton::Parser::parse(expression).optimize());
+    }
+    _forceProg = Lepton::CompiledExpression(expressions);
+    bindDeflectionVariables(_forceProg, _deflectionVars);
+
     // fill damping matrix with damping from vector property
     for (int i = 0; i<3; i++) {
         _dampingMatrix[i][i] = get_rotational_damping(0)[i];
@@ -215,59 +245,59 @@ void ExpressionBasedBushingForce::extendFinalizeFromProperties()
     }
 }
 
-/** Set the expression for the Mx function and create it's lepton program */
-void ExpressionBasedBushingForce::setMxExpression(std::string expression) 
+/** Set the expression for the Mx function; it is compiled into the fused
+force program in extendFinalizeFromProperties() */
+void ExpressionBasedBushingForce::setMxExpression(std::string expression)
 {
-    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
+    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace),
                         expression.end() );
     set_Mx_expression(expression);
-    MxProg = Lepton::Parser::parse(expression).optimize().createProgram();
 }
 
-/** Set the expression for the My function and create it's lepton program */
-void ExpressionBasedBushingForce::setMyExpression(std::string expression) 
+/** Set the expression for the My function; it is compiled into the fused
+force program in extendFinalizeFromProperties() */
+void ExpressionBasedBushingForce::setMyExpression(std::string expression)
 {
-    
-    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
+
+    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace),
                         expression.end() );
     set_My_expression(expression);
-    MyProg = Lepton::Parser::parse(expression).optimize().createProgram();
 }
 
-/** Set the expression for the Mz function and create it's lepton program */
-void ExpressionBasedBushingForce::setMzExpression(std::string expression) 
+/** Set the expression for the Mz function; it is compiled into the fused
+force program in extendFinalizeFromProperties() */
+void ExpressionBasedBushingForce::setMzExpression(std::string expression)
 {
-    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
+    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace),
                         expression.end() );
     set_Mz_expression(expression);
-    MzProg = Lepton::Parser::parse(expression).optimize().createProgram();
 }
 
-/** Set the expression for the Fx function and create it's lepton program */
-void ExpressionBasedBushingForce::setFxExpression(std::string expression) 
+/** Set the expression for the Fx function; it is compiled into the fused
+force program in extendFinalizeFromProperties() */
+void ExpressionBasedBushingForce::setFxExpression(std::string expression)
 {
-    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
+    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace),
                         expression.end() );
     set_Fx_expression(expression);
-    FxProg = Lepton::Parser::parse(expression).optimize().createProgram();
 }
 
-/** Set the expression for the Fy function and create it's lepton program */
-void ExpressionBasedBushingForce::setFyExpression(std::string expression) 
+/** Set the expression for the Fy function; it is compiled into the fused
+force program in extendFinalizeFromProperties() */
+void ExpressionBasedBushingForce::setFyExpression(std::string expression)
 {
-    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
+    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace),
                         expression.end() );
     set_Fy_expression(expression);
-    FyProg = Lepton::Parser::parse(expression).optimize().createProgram();
 }
 
-/** Set the expression for the Fz function and create it's lepton program */
-void ExpressionBasedBushingForce::setFzExpression(std::string expression) 
+/** Set the expression for the Fz function; it is compiled into the fused
+force program in extendFinalizeFromProperties() */
+void ExpressionBasedBushingForce::setFzExpression(std::string expression)
 {
-    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
+    expression.erase( remove_if(expression.begin(), expression.end(), ::isspace),
                         expression.end() );
     set_Fz_expression(expression);
-    FzProg = Lepton::Parser::parse(expression).optimize().createProgram();
 }
 //=============================================================================
 // COMPUTATION
@@ -282,21 +312,9 @@ SimTK::Vec6 ExpressionBasedBushingForce::
 
     Vec6 fk = Vec6(0.0);
 
-    std::map<std::string, double> deflectionVars;
-    deflectionVars["theta_x"] = dq[0];
-    deflectionVars["theta_y"] = dq[1];
-    deflectionVars["theta_z"] = dq[2];
-    deflectionVars["delta_x"] = dq[3];
-    deflectionVars["delta_y"] = dq[4];
-    deflectionVars["delta_z"] = dq[5];
-
-
-    fk[0] = MxProg.evaluate(deflectionVars);
-    fk[1] = MyProg.evaluate(deflectionVars);
-    fk[2] = MzProg.evaluate(deflectionVars);
-    fk[3] = FxProg.evaluate(deflectionVars);
-    fk[4] = FyProg.evaluate(deflectionVars);
-    fk[5] = FzProg.evaluate(deflectionVars);
+    for (int ivar = 0; ivar < 6; ++ivar)
+        if (_deflectionVars[ivar]) *_deflectionVars[ivar] = dq[ivar];
+    _forceProg.evaluate(&fk[0]);
 
     return -fk;
 }
@@ -312,21 +330,27 @@ SimTK::Vec6 ExpressionBasedBushingForce::
 
 /* Compute the force contribution to the system and add in to appropriate
 * bodyForce and/or system generalizedForce. */
-void ExpressionBasedBushingForce::computeForce(const SimTK::State& s, 
-                              SimTK::Vector_<SimTK::SpatialVec>& bodyForces, 
+void ExpressionBasedBushingForce::computeForce(const SimTK::State& s,
+                              SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
                               SimTK::Vector& generalizedForces) const
 {
-    // stiffness force
-    Vec6 fk = calcStiffnessForce(s);
-    // damping force
-    Vec6 fv = calcDampingForce(s);
+    // evaluate the frame deflection, deflection rate and the frame
+    // kinematics needed to apply the resulting force in a single pass
+    FrameDeflection def;
+    computeFrameDeflection(s, def);
 
-    // total bushing force in the internal basis of the deflection (dq) 
-    Vec6 f = fk + fv;
+    // stiffness force via the fused force program
+    for (int ivar = 0; ivar < 6; ++ivar)
+        if (_deflectionVars[ivar]) *_deflectionVars[ivar] = def.dq[ivar];
+    Vec6 fk;
+    _forceProg.evaluate(&fk[0]);
+
+    // total bushing force in the internal basis of the deflection (dq)
+    Vec6 f = -fk - _dampingMatrix * def.dqdot;
 
     // convert internal forces to spatial and add then add to system
     // physical (body) forces
-    addInPhysicalForcesFromInternal(s, f, bodyForces);
+    addInPhysicalForcesFromInternal(def, f, bodyForces);
 }
 
 //=============================================================================
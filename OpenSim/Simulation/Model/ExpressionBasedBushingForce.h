@@ -27,6 +27,8 @@
 // INCLUDE
 #include "Force.h"
 #include <OpenSim/Simulation/Model/TwoFrameLinker.h>
+#include <lepton/CompiledExpression.h>
+#include <array>
 
 namespace OpenSim {
 
@@ -272,8 +274,16 @@ private:
 
     SimTK::Mat66 _dampingMatrix{ 0.0 };
 
-    // parser programs for efficiently evaluating the expressions
-    Lepton::ExpressionProgram MxProg, MyProg, MzProg, FxProg, FyProg, FzProg;
+    // fused compiled expression that evaluates Mx, My, Mz, Fx, Fy, and Fz at
+    // once, sharing subexpressions that appear in more than one of them
+    Lepton::CompiledExpression _forceProg;
+    // Pointers to the deflection variables (theta_x, theta_y, theta_z,
+    // delta_x, delta_y, delta_z, in that order) inside _forceProg, cached so
+    // that evaluating the forces does not require any lookups; an entry is
+    // null if none of the optimized expressions use that variable. Rebound
+    // whenever the expressions are compiled in
+    // extendFinalizeFromProperties().
+    std::array<double*, 6> _deflectionVars{};
 
 //==============================================================================
 };  // END of class ExpressionBasedBushingForce
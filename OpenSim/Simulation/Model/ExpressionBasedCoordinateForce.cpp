@@ -97,7 +97,17 @@ void ExpressionBasedCoordinateForce::extendConnectToModel(Model& aModel)
             remove_if(expression.begin(), expression.end(), ::isspace), 
                       expression.end() );
     
-    _forceProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    _forceProg = Lepton::Parser::parse(expression).optimize()
+                         .createCompiledExpression();
+    // Cache the locations of the expression's variables so evaluating the
+    // force requires no lookups. The optimizer may have eliminated a variable
+    // (e.g., for a constant expression); leave the pointer null in that case.
+    _forceProgQ = _forceProg.getVariables().count("q")
+                          ? &_forceProg.getVariableReference("q")
+                          : nullptr;
+    _forceProgQdot = _forceProg.getVariables().count("qdot")
+                             ? &_forceProg.getVariableReference("qdot")
+                             : nullptr;
 
     // Look up the coordinate
     if (!_model->updCoordinateSet().contains(coordName)) {
@@ -135,12 +145,9 @@ void ExpressionBasedCoordinateForce::computeForce(const SimTK::State& s,
 double ExpressionBasedCoordinateForce::calcExpressionForce(const SimTK::State& s ) const
 {
     using namespace SimTK;
-    double q = _coord->getValue(s);
-    double qdot = _coord->getSpeedValue(s);
-    std::map<std::string, double> forceVars;
-    forceVars["q"] = q;
-    forceVars["qdot"] = qdot;
-    double forceMag = _forceProg.evaluate(forceVars);
+    if (_forceProgQ) *_forceProgQ = _coord->getValue(s);
+    if (_forceProgQdot) *_forceProgQdot = _coord->getSpeedValue(s);
+    double forceMag = _forceProg.evaluate();
     setCacheVariableValue(s, _forceMagnitudeCV, forceMag);
     return forceMag;
 }
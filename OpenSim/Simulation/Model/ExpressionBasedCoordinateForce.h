@@ -24,7 +24,7 @@
  * -------------------------------------------------------------------------- */
 // INCLUDE
 #include "Force.h"
-#include <lepton/ExpressionProgram.h>
+#include <lepton/CompiledExpression.h>
 
 namespace OpenSim {
 
@@ -126,8 +126,14 @@ private:
     void setNull();
     void constructProperties();
 
-    // parser programs for efficiently evaluating the expressions
-    Lepton::ExpressionProgram _forceProg;
+    // compiled expression for efficiently evaluating the force expression
+    Lepton::CompiledExpression _forceProg;
+    // Pointers to the "q" and "qdot" variables inside _forceProg, cached so
+    // that evaluating the force does not require any lookups; null if the
+    // optimized expression does not use the variable. Rebound whenever the
+    // expression is compiled in extendConnectToModel().
+    double* _forceProgQ{nullptr};
+    double* _forceProgQdot{nullptr};
 
     // Corresponding generalized coordinate to which the force
     // is applied.
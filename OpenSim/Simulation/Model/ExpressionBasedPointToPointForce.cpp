@@ -137,7 +137,17 @@ void ExpressionBasedPointToPointForce::extendConnectToModel(Model& model)
             remove_if(expression.begin(), expression.end(), ::isspace), 
                       expression.end() );
     
-    _forceProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    _forceProg = Lepton::Parser::parse(expression).optimize()
+                         .createCompiledExpression();
+    // Cache the locations of the expression's variables so evaluating the
+    // force requires no lookups. The optimizer may have eliminated a variable
+    // (e.g., for a constant expression); leave the pointer null in that case.
+    _forceProgD = _forceProg.getVariables().count("d")
+                          ? &_forceProg.getVariableReference("d")
+                          : nullptr;
+    _forceProgDdot = _forceProg.getVariables().count("ddot")
+                             ? &_forceProg.getVariableReference("ddot")
+                             : nullptr;
 }
 
 //=============================================================================
@@ -187,11 +197,10 @@ void ExpressionBasedPointToPointForce::computeForce(const SimTK::State& s,
     //speed along the line connecting the two bodies
     const double ddot = dot(vRel, r_G)/d;
 
-    std::map<std::string, double> forceVars;
-    forceVars["d"] = d;
-    forceVars["ddot"] = ddot;
+    if (_forceProgD) *_forceProgD = d;
+    if (_forceProgDdot) *_forceProgDdot = ddot;
 
-    double forceMag = _forceProg.evaluate(forceVars);
+    double forceMag = _forceProg.evaluate();
     setCacheVariableValue(s, _forceMagnitudeCV, forceMag);
 
     const Vec3 f1_G = (forceMag/d) * r_G;
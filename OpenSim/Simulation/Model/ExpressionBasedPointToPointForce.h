@@ -24,7 +24,7 @@
  * -------------------------------------------------------------------------- */
 
 #include "Force.h"
-#include <lepton/ExpressionProgram.h>
+#include <lepton/CompiledExpression.h>
 
 namespace SimTK {
 class MobilizedBody;
@@ -169,8 +169,14 @@ private:
     void setNull();
     void constructProperties();
 
-    // parser programs for efficiently evaluating the expressions
-    Lepton::ExpressionProgram _forceProg;
+    // compiled expression for efficiently evaluating the force expression
+    Lepton::CompiledExpression _forceProg;
+    // Pointers to the "d" and "ddot" variables inside _forceProg, cached so
+    // that evaluating the force does not require any lookups; null if the
+    // optimized expression does not use the variable. Rebound whenever the
+    // expression is compiled in extendConnectToModel().
+    double* _forceProgD{nullptr};
+    double* _forceProgDdot{nullptr};
 
     // Temporary solution until implemented with Sockets
     SimTK::ReferencePtr<const PhysicalFrame> _body1;
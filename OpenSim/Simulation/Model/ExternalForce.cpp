@@ -200,6 +200,11 @@ void ExternalForce::extendConnectToModel(Model& model)
         _pointExpressedInBody = &_model->getGround();
     }
 
+    // bind the channel-to-body application once so computeForce() can skip
+    // re-expressing data already in ground
+    _forceExpressedInGround =
+        (_forceExpressedInBody.get() == &_model->getGround());
+
     if(!_dataSource){
         throw Exception("ExternalForce: No Data source has been set.");
         // TODO: Load the data from dataSourceProp. Currently this is overly
@@ -337,7 +342,8 @@ void ExternalForce::computeForce(const SimTK::State& state,
 
     if (_appliesForce) {
         Vec3 force = getForceAtTime(time);
-        force = _forceExpressedInBody->expressVectorInGround(state, force);
+        if (!_forceExpressedInGround)
+            force = _forceExpressedInBody->expressVectorInGround(state, force);
         Vec3 point(0); // Default is body origin.
         if (_specifiesPoint) {
             point = getPointAtTime(time);
@@ -349,7 +355,8 @@ void ExternalForce::computeForce(const SimTK::State& state,
 
     if (_appliesTorque) {
         Vec3 torque = getTorqueAtTime(time);
-        torque = _forceExpressedInBody->expressVectorInGround(state, torque);
+        if (!_forceExpressedInGround)
+            torque = _forceExpressedInBody->expressVectorInGround(state, torque);
         applyTorque(state, *_appliedToBody, torque, bodyForces);
     }
 }
@@ -359,7 +366,9 @@ void ExternalForce::computeForce(const SimTK::State& state,
  */
 Vec3 ExternalForce::getForceAtTime(double aTime) const  
 {
-    SimTK::Vector timeAsVector(1, aTime);
+    // reuse the member buffer; one allocation for the life of the force
+    SimTK::Vector& timeAsVector = _timeAsVector;
+    timeAsVector[0] = aTime;
     const Function* forceX=NULL;
     const Function* forceY=NULL;
     const Function* forceZ=NULL;
@@ -374,7 +383,8 @@ Vec3 ExternalForce::getForceAtTime(double aTime) const
 
 Vec3 ExternalForce::getPointAtTime(double aTime) const
 {
-    SimTK::Vector timeAsVector(1, aTime);
+    SimTK::Vector& timeAsVector = _timeAsVector;
+    timeAsVector[0] = aTime;
     const Function* pointX=NULL;
     const Function* pointY=NULL;
     const Function* pointZ=NULL;
@@ -389,7 +399,8 @@ Vec3 ExternalForce::getPointAtTime(double aTime) const
 
 Vec3 ExternalForce::getTorqueAtTime(double aTime) const
 {
-    SimTK::Vector timeAsVector(1, aTime);
+    SimTK::Vector& timeAsVector = _timeAsVector;
+    timeAsVector[0] = aTime;
     const Function* torqueX=NULL;
     const Function* torqueY=NULL;
     const Function* torqueZ=NULL;
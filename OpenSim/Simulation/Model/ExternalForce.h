@@ -259,6 +259,14 @@ private:
     ArrayPtrs<Function> _torqueFunctions;
     ArrayPtrs<Function> _pointFunctions;
 
+    /** whether the force/torque data are already expressed in ground, so
+        re-expression can be skipped during application */
+    bool _forceExpressedInGround {false};
+
+    /** reused argument buffer for evaluating the data functions, so force
+        application does not allocate every step */
+    mutable SimTK::Vector _timeAsVector{1, 0.0};
+
     friend class ExternalLoads;
 //==============================================================================
 };  // END of class ExternalForce
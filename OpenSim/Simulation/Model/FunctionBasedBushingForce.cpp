@@ -201,21 +201,31 @@ SimTK::Vec6 FunctionBasedBushingForce::
 
 /* Compute the force contribution to the system and add in to appropriate
  * bodyForce and/or system generalizedForce. */
-void FunctionBasedBushingForce::computeForce(const SimTK::State& s, 
-                              SimTK::Vector_<SimTK::SpatialVec>& bodyForces, 
+void FunctionBasedBushingForce::computeForce(const SimTK::State& s,
+                              SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
                               SimTK::Vector& generalizedForces) const
 {
-    // stiffness force
-    Vec6 fk = calcStiffnessForce(s);
-    // damping force
-    Vec6 fv = calcDampingForce(s);
-
-    // total bushing force in the internal basis of the deflection (dq) 
-    Vec6 f = fk + fv;
+    // evaluate the frame deflection, deflection rate and the frame
+    // kinematics needed to apply the resulting force in a single pass
+    FrameDeflection def;
+    computeFrameDeflection(s, def);
+
+    // stiffness force, reusing one argument Vector for all six evaluations
+    SimTK::Vector x(1, 0.0);
+    Vec6 fk;
+    x[0] = def.dq[0]; fk[0] = get_m_x_theta_x_function().calcValue(x);
+    x[0] = def.dq[1]; fk[1] = get_m_y_theta_y_function().calcValue(x);
+    x[0] = def.dq[2]; fk[2] = get_m_z_theta_z_function().calcValue(x);
+    x[0] = def.dq[3]; fk[3] = get_f_x_delta_x_function().calcValue(x);
+    x[0] = def.dq[4]; fk[4] = get_f_y_delta_y_function().calcValue(x);
+    x[0] = def.dq[5]; fk[5] = get_f_z_delta_z_function().calcValue(x);
+
+    // total bushing force in the internal basis of the deflection (dq)
+    Vec6 f = -fk - _dampingMatrix * def.dqdot;
 
     // convert internal forces to spatial and add then add to system
     // physical (body) forces
-    addInPhysicalForcesFromInternal(s, f, bodyForces);
+    addInPhysicalForcesFromInternal(def, f, bodyForces);
 }
 
 //=============================================================================
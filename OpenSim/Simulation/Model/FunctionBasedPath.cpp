@@ -0,0 +1,193 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  FunctionBasedPath.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+//=============================================================================
+// INCLUDES
+//=============================================================================
+#include "FunctionBasedPath.h"
+#include "Model.h"
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Simulation/SimbodyEngine/Coordinate.h>
+
+//=============================================================================
+// STATICS
+//=============================================================================
+using namespace std;
+using namespace OpenSim;
+using SimTK::Vec3;
+
+//=============================================================================
+// CONSTRUCTOR(S) AND DESTRUCTOR
+//=============================================================================
+/*
+ * Default constructor.
+ */
+FunctionBasedPath::FunctionBasedPath() : GeometryPath()
+{
+    setAuthors("OpenSim Development Team");
+    constructProperties();
+}
+
+void FunctionBasedPath::constructProperties()
+{
+    constructProperty_coordinate_paths();
+    constructProperty_length_function(Constant(0.0));
+}
+
+void FunctionBasedPath::setLengthFunction(const Function& lengthFunction)
+{
+    set_length_function(lengthFunction);
+}
+
+void FunctionBasedPath::appendCoordinatePath(const std::string& coordinatePath)
+{
+    append_coordinate_paths(coordinatePath);
+}
+
+//_____________________________________________________________________________
+/*
+ * Perform set up functions after model has been deserialized or copied.
+ */
+void FunctionBasedPath::extendConnectToModel(Model& aModel)
+{
+    // Deliberately skip GeometryPath's connect step: this path has no
+    // PathPointSet to validate or number. ModelComponent's step still runs.
+    ModelComponent::extendConnectToModel(aModel);
+
+    _coordinates.clear();
+    _coordinates.reserve(getProperty_coordinate_paths().size());
+    for (int i = 0; i < getProperty_coordinate_paths().size(); ++i) {
+        _coordinates.emplace_back(
+            &aModel.getComponent<Coordinate>(get_coordinate_paths(i)));
+    }
+}
+
+//=============================================================================
+// GET
+//=============================================================================
+void FunctionBasedPath::calcCoordinateValues(const SimTK::State& s,
+                                             SimTK::Vector& values) const
+{
+    const int nc = (int)_coordinates.size();
+    values.resize(nc);
+    for (int i = 0; i < nc; ++i)
+        values[i] = _coordinates[i]->getValue(s);
+}
+
+double FunctionBasedPath::getLength(const SimTK::State& s) const
+{
+    SimTK::Vector values;
+    calcCoordinateValues(s, values);
+    return get_length_function().calcValue(values);
+}
+
+double FunctionBasedPath::getLengtheningSpeed(const SimTK::State& s) const
+{
+    SimTK::Vector values;
+    calcCoordinateValues(s, values);
+
+    // ldot = sum_i dl/dq_i * qdot_i
+    const Function& lengthFunction = get_length_function();
+    std::vector<int> derivComponent(1);
+    double speed = 0.0;
+    for (int i = 0; i < (int)_coordinates.size(); ++i) {
+        derivComponent[0] = i;
+        speed += lengthFunction.calcDerivative(derivComponent, values)
+                 * _coordinates[i]->getSpeedValue(s);
+    }
+    return speed;
+}
+
+void FunctionBasedPath::getPointForceDirections(const SimTK::State& s,
+    OpenSim::Array<PointForceDirection*> *rPFDs) const
+{
+    OPENSIM_THROW_FRMOBJ(Exception,
+        "A FunctionBasedPath has no path points, so it cannot provide "
+        "PointForceDirections.");
+}
+
+void FunctionBasedPath::getPointForceDirections(const SimTK::State& s,
+    std::vector<PointForceDirection>& rPFDs) const
+{
+    OPENSIM_THROW_FRMOBJ(Exception,
+        "A FunctionBasedPath has no path points, so it cannot provide "
+        "PointForceDirections.");
+}
+
+//_____________________________________________________________________________
+/*
+ * A tension along the path produces the generalized force
+ * tau_i = -tension * dl/dq_i on each coordinate the length function depends
+ * on; there are no path points to load the bodies through.
+ */
+void FunctionBasedPath::addInEquivalentForces(const SimTK::State& s,
+    const double& tension,
+    SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+    SimTK::Vector& mobilityForces) const
+{
+    SimTK::Vector values;
+    calcCoordinateValues(s, values);
+
+    const SimTK::SimbodyMatterSubsystem& matter =
+                                        getModel().getMatterSubsystem();
+
+    const Function& lengthFunction = get_length_function();
+    std::vector<int> derivComponent(1);
+    for (int i = 0; i < (int)_coordinates.size(); ++i) {
+        derivComponent[0] = i;
+        const double dldq =
+            lengthFunction.calcDerivative(derivComponent, values);
+        if (dldq == 0.0)
+            continue;
+
+        const Coordinate& coord = *_coordinates[i];
+        const SimTK::MobilizedBody& mobod =
+            matter.getMobilizedBody(coord.getBodyIndex());
+        const int uIndex =
+            mobod.getFirstUIndex(s) + coord.getMobilizerQIndex();
+        mobilityForces[uIndex] -= tension * dldq;
+    }
+}
+
+//=============================================================================
+// COMPUTATIONS
+//=============================================================================
+//_____________________________________________________________________________
+/*
+ * Compute the path's moment arm for the specified coordinate as the negated
+ * partial derivative of the length function. Coordinates the length function
+ * does not depend on have a moment arm of zero.
+ */
+double FunctionBasedPath::computeMomentArm(const SimTK::State& s,
+                                           const Coordinate& aCoord) const
+{
+    for (int i = 0; i < (int)_coordinates.size(); ++i) {
+        if (_coordinates[i].get() == &aCoord) {
+            SimTK::Vector values;
+            calcCoordinateValues(s, values);
+            std::vector<int> derivComponent(1, i);
+            return -get_length_function().calcDerivative(derivComponent,
+                                                         values);
+        }
+    }
+    return 0.0;
+}
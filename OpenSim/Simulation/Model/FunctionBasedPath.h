@@ -0,0 +1,146 @@
+#ifndef OPENSIM_FUNCTION_BASED_PATH_H_
+#define OPENSIM_FUNCTION_BASED_PATH_H_
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  FunctionBasedPath.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+
+// INCLUDE
+#include "GeometryPath.h"
+#include <OpenSim/Common/Function.h>
+
+namespace OpenSim {
+
+class Coordinate;
+
+//=============================================================================
+//=============================================================================
+/**
+ * A path whose length is an explicit function of a set of the model's
+ * coordinates rather than the geometry of path points and wrap surfaces.
+ * The length function is typically a polynomial fitted to a sampled
+ * GeometryPath (see PolynomialPathFitter), which makes evaluating the path
+ * orders of magnitude cheaper than solving the wrapping geometry.
+ *
+ * Moment arms are the negated partial derivatives of the length function
+ * with respect to the coordinates, the lengthening speed follows from the
+ * chain rule, and a tension along the path is applied directly as
+ * generalized forces on the coordinates the path depends on. Because this
+ * path has no points, the point-based interface (path points, wrapping,
+ * visualization) is unavailable.
+ */
+class OSIMSIMULATION_API FunctionBasedPath : public GeometryPath {
+OpenSim_DECLARE_CONCRETE_OBJECT(FunctionBasedPath, GeometryPath);
+
+//=============================================================================
+// DATA
+//=============================================================================
+public:
+    OpenSim_DECLARE_LIST_PROPERTY(coordinate_paths, std::string,
+        "The model paths of the coordinates the length function depends on, "
+        "in the order of the function's input arguments.");
+
+    OpenSim_DECLARE_PROPERTY(length_function, Function,
+        "The total path length as a function of the values of the "
+        "coordinates named in 'coordinate_paths'.");
+
+//=============================================================================
+// METHODS
+//=============================================================================
+    //--------------------------------------------------------------------------
+    // CONSTRUCTION
+    //--------------------------------------------------------------------------
+public:
+    FunctionBasedPath();
+
+    /** %Set the function giving the path length in terms of the values of
+    the coordinates named in the coordinate_paths property. The function is
+    copied into the length_function property. */
+    void setLengthFunction(const Function& lengthFunction);
+    const Function& getLengthFunction() const { return get_length_function(); }
+
+    /** Append the model path of a coordinate the length function depends
+    on. Coordinate paths must be appended in the order of the length
+    function's input arguments. */
+    void appendCoordinatePath(const std::string& coordinatePath);
+
+    //--------------------------------------------------------------------------
+    // GET
+    //--------------------------------------------------------------------------
+    double getLength(const SimTK::State& s) const override;
+    double getLengtheningSpeed(const SimTK::State& s) const override;
+
+    /** This path has no points; throws an Exception. */
+    void getPointForceDirections(const SimTK::State& s,
+        OpenSim::Array<PointForceDirection*> *rPFDs) const override;
+
+    /** This path has no points; throws an Exception. */
+    void getPointForceDirections(const SimTK::State& s,
+        std::vector<PointForceDirection>& rPFDs) const override;
+
+    void addInEquivalentForces(const SimTK::State& state,
+                               const double& tension,
+                               SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+                               SimTK::Vector& mobilityForces) const override;
+
+    //--------------------------------------------------------------------------
+    // COMPUTATIONS
+    //--------------------------------------------------------------------------
+    double computeMomentArm(const SimTK::State& s,
+                            const Coordinate& aCoord) const override;
+
+    //--------------------------------------------------------------------------
+    // Visualization Support
+    //--------------------------------------------------------------------------
+    // There is no geometry to update or draw.
+    void updateGeometry(const SimTK::State& s) const override {}
+
+protected:
+    // ModelComponent interface.
+    void extendConnectToModel(Model& aModel) override;
+
+    void generateDecorations(
+            bool                                        fixed,
+            const ModelDisplayHints&                    hints,
+            const SimTK::State&                         state,
+            SimTK::Array_<SimTK::DecorativeGeometry>&   appendToThis) const
+            override {}
+
+private:
+    void constructProperties();
+
+    // Collect the current values of the path's coordinates, ordered as the
+    // length function's input arguments.
+    void calcCoordinateValues(const SimTK::State& s,
+                              SimTK::Vector& values) const;
+
+    // Coordinates the length function depends on, resolved from the
+    // coordinate_paths property on connect.
+    std::vector<SimTK::ReferencePtr<const Coordinate>> _coordinates;
+
+//=============================================================================
+};  // END of class FunctionBasedPath
+//=============================================================================
+//=============================================================================
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_FUNCTION_BASED_PATH_H_
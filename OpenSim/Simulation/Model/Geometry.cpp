@@ -25,6 +25,9 @@
 // INCLUDES
 //=============================================================================
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include "Frame.h"
 #include "Geometry.h"
 #include "Model.h"
@@ -216,106 +219,144 @@ void FrameGeometry::implementCreateDecorativeGeometry(SimTK::Array_<SimTK::Decor
     decoGeoms.push_back(deco);
 }
 
+namespace {
+// Process-wide cache of loaded mesh files, keyed by the resolved file path.
+// Entries are held weakly so a mesh unloads once the last Mesh referencing
+// it is gone, while concurrent models (or many copies of one model) that
+// resolve to the same file share a single loaded mesh.
+std::mutex& getMeshFileCacheMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+std::map<std::string, std::weak_ptr<const SimTK::DecorativeMeshFile>>&
+getMeshFileCache() {
+    static std::map<std::string,
+                    std::weak_ptr<const SimTK::DecorativeMeshFile>> cache;
+    return cache;
+}
+} // anonymous namespace
+
 void Mesh::extendFinalizeFromProperties() {
 
     if (!isObjectUpToDateWithProperties()) {
-        const Component* rootModel = nullptr;
-        if (!hasOwner()) {
-            log_error("Mesh {} not connected to model...ignoring",
-                    get_mesh_file());
-            return;   // Orphan Mesh not part of a model yet
-        }
-        const Component* owner = &getOwner();
-        while (owner != nullptr) {
-            if (dynamic_cast<const Model*>(owner) != nullptr) {
-                rootModel = owner;
-                break;
-            }
-            if (owner->hasOwner())
-                owner = &(owner->getOwner()); // traverse up Component tree
-            else
-                break; // can't traverse up.
-        }
+        // Loading is deferred until decorative geometry is first generated
+        // (i.e., first visualization), so headless runs perform no mesh I/O.
+        // Drop any previously cached mesh so edits to the properties (e.g.,
+        // a new mesh_file) take effect on the next visualization.
+        cachedMesh = nullptr;
+        meshLoadAttempted = false;
+        warningGiven = false;
+    }
+}
 
-        if (rootModel == nullptr) {
-            log_error("Mesh {} not connected to model...ignoring",
-                    get_mesh_file());
-            return;   // Orphan Mesh not descendant of a model
-        }
+std::shared_ptr<const SimTK::DecorativeMeshFile>
+Mesh::loadSharedMeshFile(const std::string& resolvedPath) {
+    std::lock_guard<std::mutex> lock(getMeshFileCacheMutex());
+    auto& cache = getMeshFileCache();
+    auto found = cache.find(resolvedPath);
+    if (found != cache.end()) {
+        if (auto existing = found->second.lock())
+            return existing;
+    }
+    auto fresh = std::make_shared<SimTK::DecorativeMeshFile>(
+            resolvedPath.c_str());
+    // Force the load here -- once per process and under the cache lock --
+    // both to surface bad contents (e.g., binary vtp) immediately and so
+    // that concurrent first uses don't race inside getMesh().
+    fresh->getMesh();
+    cache[resolvedPath] = fresh;
+    return fresh;
+}
 
-        // Current interface to Visualizer calls generateDecorations on every
-        // frame. On first time through, load file and create DecorativeMeshFile
-        // and cache it so we don't load files from disk during live rendering.
-        const Model* mdl = dynamic_cast<const Model*>(rootModel);
-        const std::string& file = get_mesh_file();
-        if (file.empty() || file.compare(PropertyStr::getDefaultStr()) == 0 ||
-            !mdl->getDisplayHints().isVisualizationEnabled())
-            return;  // Return immediately if no file has been specified
-                     // or display is disabled altogether.
-
-        bool isAbsolutePath; string directory, fileName, extension;
-        SimTK::Pathname::deconstructPathname(file,
-            isAbsolutePath, directory, fileName, extension);
-        const string lowerExtension = SimTK::String::toLower(extension);
-        if (lowerExtension != ".vtp" && lowerExtension != ".obj" && lowerExtension != ".stl") {
-            log_error("ModelVisualizer ignoring '{}'; only .vtp, .stl, and "
-                      ".obj files currently supported.",
-                    file);
-            return;
-        }
+void Mesh::loadMeshFile() const {
+    meshLoadAttempted = true;
 
-        // File is a .vtp, .stl, or .obj; attempt to find it.
-        Array_<string> attempts;
-        const Model& model = dynamic_cast<const Model&>(*rootModel);
-        bool foundIt = ModelVisualizer::findGeometryFile(model, file, isAbsolutePath, attempts);
-
-        if (!foundIt) {
-            if (!warningGiven) {
-                log_warn("Couldn't find file '{}'.", file);
-                warningGiven = true;
-            }
-            
-            log_debug( "The following locations were tried:");
-            for (unsigned i = 0; i < attempts.size(); ++i)
-                log_debug(attempts[i]);
-            
+    const Component* rootModel = nullptr;
+    if (!hasOwner()) {
+        log_error("Mesh {} not connected to model...ignoring",
+                get_mesh_file());
+        return;   // Orphan Mesh not part of a model yet
+    }
+    const Component* owner = &getOwner();
+    while (owner != nullptr) {
+        if (dynamic_cast<const Model*>(owner) != nullptr) {
+            rootModel = owner;
+            break;
         }
+        if (owner->hasOwner())
+            owner = &(owner->getOwner()); // traverse up Component tree
+        else
+            break; // can't traverse up.
+    }
 
-        try {
-            std::ifstream objFile;
-            objFile.open(attempts.back().c_str());
-            // objFile closes when destructed
-            // if the file can be opened but had bad contents e.g. binary vtp 
-            // it will be handled downstream 
-        }
-        catch (const std::exception& e) {
-            log_warn("Visualizer couldn't open {} because: {}",
-                attempts.back(), e.what());
-            return;
+    if (rootModel == nullptr) {
+        log_error("Mesh {} not connected to model...ignoring",
+                get_mesh_file());
+        return;   // Orphan Mesh not descendant of a model
+    }
+
+    const Model* mdl = dynamic_cast<const Model*>(rootModel);
+    const std::string& file = get_mesh_file();
+    if (file.empty() || file.compare(PropertyStr::getDefaultStr()) == 0 ||
+        !mdl->getDisplayHints().isVisualizationEnabled())
+        return;  // Return immediately if no file has been specified
+                 // or display is disabled altogether.
+
+    bool isAbsolutePath; string directory, fileName, extension;
+    SimTK::Pathname::deconstructPathname(file,
+        isAbsolutePath, directory, fileName, extension);
+    const string lowerExtension = SimTK::String::toLower(extension);
+    if (lowerExtension != ".vtp" && lowerExtension != ".obj" && lowerExtension != ".stl") {
+        log_error("ModelVisualizer ignoring '{}'; only .vtp, .stl, and "
+                  ".obj files currently supported.",
+                file);
+        return;
+    }
+
+    // File is a .vtp, .stl, or .obj; attempt to find it.
+    Array_<string> attempts;
+    const Model& model = dynamic_cast<const Model&>(*rootModel);
+    bool foundIt = ModelVisualizer::findGeometryFile(model, file, isAbsolutePath, attempts);
+
+    if (!foundIt) {
+        if (!warningGiven) {
+            log_warn("Couldn't find file '{}'.", file);
+            warningGiven = true;
         }
 
-        cachedMesh.reset(new DecorativeMeshFile(attempts.back().c_str()));
+        log_debug( "The following locations were tried:");
+        for (unsigned i = 0; i < attempts.size(); ++i)
+            log_debug(attempts[i]);
+
+    }
+
+    try {
+        cachedMesh = loadSharedMeshFile(attempts.back());
+    }
+    catch (const std::exception& e) {
+        log_warn("Visualizer couldn't open {} because: {}",
+            attempts.back(), e.what());
+        // cachedMesh stays empty; we will not try again until the
+        // properties change.
     }
 }
 
 
 void Mesh::implementCreateDecorativeGeometry(SimTK::Array_<SimTK::DecorativeGeometry>& decoGeoms) const
 {
-    if (cachedMesh.get() != nullptr) {
-        try {
-            // Force the loading of the mesh to see if it has bad contents
-            // (e.g., binary vtp).
-            // We do not want to do this in extendFinalizeFromProperties b/c
-            // it's expensive to repeatedly load meshes.
-            cachedMesh->getMesh();
-        } catch (const std::exception& e) {
-            log_warn("Visualizer couldn't open {} because: {}",
-                get_mesh_file(), e.what());
-            // No longer try to visualize this mesh.
-            cachedMesh.reset();
-            return;
-        }
-        cachedMesh->setScaleFactors(get_scale_factors());
-        decoGeoms.push_back(*cachedMesh);
+    // On first time through, locate and load the file (or fetch it from the
+    // process-wide cache) so we don't load files from disk during live
+    // rendering; the current interface to Visualizer calls
+    // generateDecorations on every frame.
+    if (!meshLoadAttempted)
+        loadMeshFile();
+
+    if (cachedMesh != nullptr) {
+        // The cached mesh is shared across models and threads, so apply
+        // this Mesh's scale factors to a local copy rather than mutating
+        // the shared object.
+        SimTK::DecorativeMeshFile deco(*cachedMesh);
+        deco.setScaleFactors(get_scale_factors());
+        decoGeoms.push_back(deco);
     }
 }
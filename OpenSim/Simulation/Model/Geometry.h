@@ -546,7 +546,14 @@ protected:
 };
 /**
 * A class to represent Mesh geometry that comes from a file.
-* Supported file formats .vtp, .stl, .obj but will grow over time
+* Supported file formats .vtp, .stl, .obj but will grow over time.
+*
+* The mesh file is not read until decorative geometry is first generated
+* (i.e., on first visualization); headless runs that never visualize a
+* model perform no mesh I/O. Loaded meshes are shared through a
+* process-wide cache keyed by the resolved file path, so many models (or
+* copies of one model) referencing the same file share a single loaded
+* mesh.
 */
 class OSIMSIMULATION_API Mesh : public Geometry
 {
@@ -589,10 +596,26 @@ protected:
     void implementCreateDecorativeGeometry(
         SimTK::Array_<SimTK::DecorativeGeometry>& decoGeoms) const override;
 private:
-    // We cache the DecorativeMeshFile if we successfully
-    // load the mesh from file so we don't try loading from disk every frame.
-    // This is mutable since it is not part of the public interface.
-    mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::DecorativeMeshFile>> cachedMesh;
+    // Locate the mesh file and populate cachedMesh from the process-wide
+    // mesh cache, loading the file if no other Mesh has loaded it yet.
+    // Called at most once between property changes; failures are logged and
+    // leave cachedMesh empty.
+    void loadMeshFile() const;
+
+    // Fetch (or load and insert) the shared mesh for the given resolved
+    // file path. Throws if the file contents cannot be parsed.
+    static std::shared_ptr<const SimTK::DecorativeMeshFile>
+    loadSharedMeshFile(const std::string& resolvedPath);
+
+    // We cache the (shared) DecorativeMeshFile once loaded so we don't go
+    // through the cache lookup on every frame. Mutable since the cache is
+    // not part of the public interface; reset on copy (and by property
+    // changes) so stale meshes are never reused.
+    mutable SimTK::ResetOnCopy<std::shared_ptr<const SimTK::DecorativeMeshFile>>
+        cachedMesh;
+    // Whether loadMeshFile() already ran for the current properties; reset
+    // on copy along with cachedMesh.
+    mutable SimTK::ResetOnCopy<bool> meshLoadAttempted;
     mutable bool warningGiven;
 };
 
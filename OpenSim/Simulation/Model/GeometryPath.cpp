@@ -29,6 +29,7 @@
 #include "MovingPathPoint.h"
 #include "PointForceDirection.h"
 #include <OpenSim/Simulation/Wrap/PathWrap.h>
+#include <OpenSim/Common/HotPathCounters.h>
 #include "Model.h"
 
 //=============================================================================
@@ -146,6 +147,15 @@ GeometryPath::GeometryPath() :
 * Perform set up functions after model has been deserialized or copied.
 *
 */
+std::size_t GeometryPath::extendGetMemoryFootprint() const
+{
+    std::size_t bytes = Super::extendGetMemoryFootprint();
+    if (_maSolver)
+        bytes += sizeof(MomentArmSolver);
+    bytes += _currentPathPtrsCache.getCapacity()*sizeof(AbstractPathPoint*);
+    return bytes;
+}
+
 void GeometryPath::extendFinalizeFromProperties()
 {
     Super::extendFinalizeFromProperties();
@@ -191,6 +201,11 @@ void GeometryPath::extendConnectToModel(Model& aModel)
     // Cache the set of points currently defining this path.
     this->_currentPathCV = addCacheVariable("current_path", std::vector<PathElementLookup>{}, SimTK::Stage::Position);
 
+    // Cache the ground poses the current path was computed from, so that an
+    // unmoved path can be revalidated without recomputing the wrapping.
+    this->_dependencySignatureCV = addCacheVariable("dependency_signature",
+        SimTK::Vector(), SimTK::Stage::Position);
+
     // We consider this cache entry valid any time after it has been created
     // and first marked valid, and we won't ever invalidate it.
     this->_colorCV = addCacheVariable("color", get_Appearance().get_color(), SimTK::Stage::Topology);
@@ -321,12 +336,29 @@ getCurrentPath(const SimTK::State& s)  const
     return _currentPathPtrsCache;
 }
 
-// get the path as PointForceDirections directions 
-// CAUTION: the return points are heap allocated; you must delete them yourself! 
+// get the path as PointForceDirections directions
+// CAUTION: the return points are heap allocated; you must delete them yourself!
 // (TODO: that is really lame)
 void GeometryPath::
-getPointForceDirections(const SimTK::State& s, 
+getPointForceDirections(const SimTK::State& s,
                         OpenSim::Array<PointForceDirection*> *rPFDs) const
+{
+    std::vector<PointForceDirection> pfds;
+    getPointForceDirections(s, pfds);
+
+    rPFDs->ensureCapacity((int)pfds.size());
+    for (PointForceDirection& pfd : pfds) {
+        rPFDs->append(new PointForceDirection(pfd.point(), pfd.frame(),
+                                              pfd.direction(), pfd.scale()));
+    }
+}
+
+// get the path as PointForceDirections stored by value in caller-provided
+// storage; reusing the same vector across calls performs no heap allocation
+// once it has grown to the path's size.
+void GeometryPath::
+getPointForceDirections(const SimTK::State& s,
+                        std::vector<PointForceDirection>& rPFDs) const
 {
     int i;
     AbstractPathPoint* start;
@@ -336,13 +368,12 @@ getPointForceDirections(const SimTK::State& s,
     const Array<AbstractPathPoint*>& currentPath = getCurrentPath(s);
 
     int np = currentPath.getSize();
-    rPFDs->ensureCapacity(np);
-    
+    rPFDs.clear();
+    rPFDs.reserve(np);
+
     for (i = 0; i < np; i++) {
-        PointForceDirection *pfd = 
-            new PointForceDirection(currentPath[i]->getLocation(s), 
-                                    currentPath[i]->getParentFrame(), Vec3(0));
-        rPFDs->append(pfd);
+        rPFDs.emplace_back(currentPath[i]->getLocation(s),
+                           currentPath[i]->getParentFrame(), Vec3(0));
     }
 
     for (i = 0; i < np-1; i++) {
@@ -378,9 +409,9 @@ getPointForceDirections(const SimTK::State& s,
                 direction = direction.normalize();
             }
 
-            // Get resultant direction at each point 
-            rPFDs->get(i)->addToDirection(direction);
-            rPFDs->get(i+1)->addToDirection(-direction);
+            // Get resultant direction at each point
+            rPFDs[i].addToDirection(direction);
+            rPFDs[i+1].addToDirection(-direction);
         }
     }
 }
@@ -885,6 +916,9 @@ void GeometryPath::
 extendPostScale(const SimTK::State& s, const ScaleSet& scaleSet)
 {
     Super::extendPostScale(s, scaleSet);
+    // Scaling can change wrap geometry and point placement without moving any
+    // frame, so discard the dependency signature to force a full recompute.
+    updCacheVariableValue(s, _dependencySignatureCV).resize(0);
     computePath(s);
 }
 
@@ -913,6 +947,42 @@ void GeometryPath::computePath(const SimTK::State& s) const
         return;
     }
 
+    // Contributes a nested event to the opt-in realize trace, so the cost of
+    // recomputing this path shows up under whichever realize call forced it.
+    Component::RealizeTraceScope traceScope(*this, "computePath");
+
+    // The Position stage was invalidated, but this path may not actually have
+    // moved (e.g. only a coordinate distal to every frame the path touches
+    // changed). Compare the ground poses of the frames and points the path
+    // depends on against those captured when the stored path was computed
+    // and, when they are bit-for-bit unchanged, revalidate the stored path
+    // and length instead of re-running the wrapping computation.
+    SimTK::Vector signature;
+    calcPathDependencySignature(s, signature);
+    {
+        const SimTK::Vector& storedSignature =
+            updCacheVariableValue(s, _dependencySignatureCV);
+        if (storedSignature.size() == signature.size()
+            && storedSignature.size() > 0) {
+            bool unchanged = true;
+            for (int i = 0; i < signature.size() && unchanged; ++i)
+                unchanged = (storedSignature[i] == signature[i]);
+            if (unchanged) {
+                PopulatePathPointersCache(get_PathPointSet(),
+                                          get_PathWrapSet(),
+                                          updCacheVariableValue(s, _currentPathCV),
+                                          _currentPathPtrsCache);
+                markCacheVariableValid(s, _currentPathCV);
+                markCacheVariableValid(s, _dependencySignatureCV);
+                markCacheVariableValid(s, _lengthCV);
+                return;
+            }
+        }
+    }
+
+    // The cached path really is stale; count the recomputation.
+    HotPathCounters::increment(HotPathCounters::PathRecomputes);
+
     // Clear the current path.
     _currentPathPtrsCache.setSize(0);
 
@@ -943,6 +1013,50 @@ void GeometryPath::computePath(const SimTK::State& s) const
                               *this,
                               lookups);
     markCacheVariableValid(s, _currentPathCV);
+
+    updCacheVariableValue(s, _dependencySignatureCV) = signature;
+    markCacheVariableValid(s, _dependencySignatureCV);
+}
+
+//_____________________________________________________________________________
+/*
+ * Capture the ground poses this path's geometry depends on: for each path
+ * point, whether it is active and its location in ground (which accounts for
+ * frame motion, moving-path-point coordinates, and conditional-path-point
+ * switching); and for each wrap, the ground transform of the wrap object's
+ * frame. Two states with identical signatures yield identical paths.
+ */
+void GeometryPath::calcPathDependencySignature(const SimTK::State& s,
+                                               SimTK::Vector& signature) const
+{
+    const PathPointSet& pathPoints = get_PathPointSet();
+    const PathWrapSet& pathWraps = get_PathWrapSet();
+    const int np = pathPoints.getSize();
+    const int nw = pathWraps.getSize();
+
+    signature.resize(4*np + 12*nw);
+
+    int k = 0;
+    for (int i = 0; i < np; ++i) {
+        const AbstractPathPoint& point = pathPoints[i];
+        signature[k++] = point.isActive(s) ? 1.0 : 0.0;
+        const SimTK::Vec3 location = point.getLocationInGround(s);
+        signature[k++] = location[0];
+        signature[k++] = location[1];
+        signature[k++] = location[2];
+    }
+    for (int i = 0; i < nw; ++i) {
+        const SimTK::Transform& X_GF =
+            pathWraps[i].getWrapObject()->getFrame().getTransformInGround(s);
+        const SimTK::Vec3& p = X_GF.p();
+        const SimTK::Rotation& R = X_GF.R();
+        signature[k++] = p[0];
+        signature[k++] = p[1];
+        signature[k++] = p[2];
+        for (int row = 0; row < 3; ++row)
+            for (int col = 0; col < 3; ++col)
+                signature[k++] = R(row, col);
+    }
 }
 
 //_____________________________________________________________________________
@@ -1003,6 +1117,10 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
             best_wrap.wrap_pts.setSize(0);
             double min_length_change = SimTK::Infinity;
 
+            // Attribute this wrap object's share of the path computation in
+            // the realize trace.
+            Component::RealizeTraceScope traceScope(*wo, "wrap");
+
             // First remove this object's wrapping points from the current path.
             for (int j = 0; j <path.getSize(); j++) {
                 if( path.get(j) == &ws.getWrapPoint1()) {
@@ -1265,6 +1383,19 @@ computeMomentArm(const SimTK::State& s, const Coordinate& aCoord) const
     return _maSolver->solve(s, aCoord,  *this);
 }
 
+//_____________________________________________________________________________
+/*
+ * Compute the path's moment arms for all of the model's coordinates in one
+ * sweep.
+ */
+SimTK::Vector GeometryPath::computeMomentArms(const SimTK::State& s) const
+{
+    if (!_maSolver)
+        const_cast<Self*>(this)->_maSolver.reset(new MomentArmSolver(*_model));
+
+    return _maSolver->solveMomentArms(s, *this);
+}
+
 //_____________________________________________________________________________
 // Override default implementation by object to intercept and fix the XML node
 // underneath the model to match current version.
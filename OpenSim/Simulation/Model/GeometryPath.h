@@ -30,6 +30,7 @@
 #include "PathPointSet.h"
 #include <OpenSim/Simulation/Wrap/PathWrapSet.h>
 #include <OpenSim/Simulation/MomentArmSolver.h>
+#include <vector>
 
 
 #ifdef SWIG
@@ -98,6 +99,12 @@ public:
 private:
     mutable CacheVariable<std::vector<PathElementLookup>> _currentPathCV;
     mutable CacheVariable<SimTK::Vec3> _colorCV;
+
+    // Ground poses of the frames and points this path depends on, captured
+    // when the path stored in _currentPathCV was last computed. computePath()
+    // compares against this to skip re-running the wrapping computation when
+    // a Position-stage invalidation did not actually move this path.
+    mutable CacheVariable<SimTK::Vector> _dependencySignatureCV;
     
 //=============================================================================
 // METHODS
@@ -162,20 +169,28 @@ public:
     @see setDefaultColor() **/
     SimTK::Vec3 getColor(const SimTK::State& s) const;
 
-    double getLength( const SimTK::State& s) const;
+    virtual double getLength( const SimTK::State& s) const;
     void setLength( const SimTK::State& s, double length) const;
     double getPreScaleLength( const SimTK::State& s) const;
     void setPreScaleLength( const SimTK::State& s, double preScaleLength);
     const Array<AbstractPathPoint*>& getCurrentPath( const SimTK::State& s) const;
 
-    double getLengtheningSpeed(const SimTK::State& s) const;
+    virtual double getLengtheningSpeed(const SimTK::State& s) const;
     void setLengtheningSpeed( const SimTK::State& s, double speed ) const;
 
     /** get the path as PointForceDirections directions, which can be used
         to apply tension to bodies the points are connected to.*/
-    void getPointForceDirections(const SimTK::State& s, 
+    virtual void getPointForceDirections(const SimTK::State& s,
         OpenSim::Array<PointForceDirection*> *rPFDs) const;
 
+    /** get the path as PointForceDirections directions, filling the
+        caller-provided vector (which is cleared first). Unlike the
+        pointer-based overload above, this stores the PointForceDirections
+        by value, so a vector reused across calls performs no heap
+        allocation once it has grown to the path's size. */
+    virtual void getPointForceDirections(const SimTK::State& s,
+        std::vector<PointForceDirection>& rPFDs) const;
+
     /** add in the equivalent body and generalized forces to be applied to the 
         multibody system resulting from a tension along the GeometryPath 
     @param state    state used to evaluate forces
@@ -183,8 +198,8 @@ public:
     @param[in,out] bodyForces   Vector of SpatialVec's (torque, force) on bodies
     @param[in,out] mobilityForces  Vector of generalized forces, one per mobility   
     */
-    void addInEquivalentForces(const SimTK::State& state,
-                               const double& tension, 
+    virtual void addInEquivalentForces(const SimTK::State& state,
+                               const double& tension,
                                SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
                                SimTK::Vector& mobilityForces) const;
 
@@ -194,6 +209,11 @@ public:
     //--------------------------------------------------------------------------
     virtual double computeMomentArm(const SimTK::State& s, const Coordinate& aCoord) const;
 
+    /** Compute the path's moment arms about every coordinate of the model in
+    one sweep, sharing the intermediate force computation across coordinates.
+    The result is ordered as the model's CoordinateSet. */
+    SimTK::Vector computeMomentArms(const SimTK::State& s) const;
+
     //--------------------------------------------------------------------------
     // SCALING
     //--------------------------------------------------------------------------
@@ -230,6 +250,11 @@ protected:
 
     void extendFinalizeFromProperties() override;
 
+    // Adds the moment-arm solver and current-path scratch arrays to the
+    // memory footprint report; the path points themselves are subcomponents
+    // and report their own footprints.
+    std::size_t extendGetMemoryFootprint() const override;
+
 private:
 
     void computePath(const SimTK::State& s ) const;
@@ -240,6 +265,8 @@ private:
                                 const Array<AbstractPathPoint*>& path) const; 
     double calcLengthAfterPathComputation
        (const SimTK::State& s, const Array<AbstractPathPoint*>& currentPath) const;
+    void calcPathDependencySignature(const SimTK::State& s,
+                                     SimTK::Vector& signature) const;
 
     void constructProperties();
     void namePathPoints(int aStartingIndex);
@@ -0,0 +1,373 @@
+/* -------------------------------------------------------------------------- *
+ *                OpenSim:  HuntCrossleyContactManager.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "HuntCrossleyContactManager.h"
+#include "ContactHalfSpace.h"
+#include "ContactSphere.h"
+#include "Model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+using SimTK::Vec3;
+
+namespace {
+
+// Pack a 3-D grid cell coordinate into one key for the spatial hash. Each
+// coordinate gets 21 bits, which covers +/- a million cells.
+inline long long packCellKey(long long ix, long long iy, long long iz)
+{
+    const long long offset = 1LL << 20;
+    return ((ix + offset) << 42) | ((iy + offset) << 21) | (iz + offset);
+}
+
+// Combine two surfaces' friction coefficients the way Simbody's
+// HuntCrossleyForce does (harmonic mean; zero if both are zero).
+inline double combineFriction(double mu1, double mu2)
+{
+    return (mu1 + mu2 > 0) ? 2*mu1*mu2/(mu1 + mu2) : 0.0;
+}
+
+} // namespace
+
+namespace OpenSim {
+
+//==============================================================================
+//                      HUNT CROSSLEY CONTACT MANAGER
+//==============================================================================
+// Uses default (compiler-generated) destructor, copy constructor, copy
+// assignment operator.
+
+// Default constructor.
+HuntCrossleyContactManager::HuntCrossleyContactManager()
+{
+    constructProperties();
+}
+
+void HuntCrossleyContactManager::constructProperties()
+{
+    constructProperty_contact_parameters(
+        HuntCrossleyForce::ContactParametersSet());
+    constructProperty_transition_velocity(0.01);
+}
+
+void HuntCrossleyContactManager::
+addContactParameters(HuntCrossleyForce::ContactParameters* params)
+{
+    upd_contact_parameters().adoptAndAppend(params);
+}
+
+double HuntCrossleyContactManager::getTransitionVelocity() const
+{
+    return get_transition_velocity();
+}
+
+void HuntCrossleyContactManager::setTransitionVelocity(double velocity)
+{
+    set_transition_velocity(velocity);
+}
+
+void HuntCrossleyContactManager::resetContactStatistics() const
+{
+    _numBroadPhaseChecks = 0;
+    _numNarrowPhaseEvals = 0;
+    _numAvoidedNarrowPhaseEvals = 0;
+}
+
+void HuntCrossleyContactManager::extendConnectToModel(Model& model)
+{
+    Super::extendConnectToModel(model);
+
+    _surfaces.clear();
+    _sphereIndices.clear();
+    _halfSpaceIndices.clear();
+    _maxRadius = 0;
+    resetContactStatistics();
+
+    const HuntCrossleyForce::ContactParametersSet& contactParametersSet =
+        get_contact_parameters();
+
+    for (int i = 0; i < contactParametersSet.getSize(); ++i)
+    {
+        HuntCrossleyForce::ContactParameters& params =
+            contactParametersSet.get(i);
+        for (int j = 0; j < params.getGeometry().size(); ++j) {
+            // TODO: Dependency of HuntCrossleyContactManager on
+            // ContactGeometry should be handled by Sockets.
+            const ContactGeometry* contactGeom = nullptr;
+            if (model.hasComponent<ContactGeometry>(params.getGeometry()[j]))
+                contactGeom = &model.getComponent<ContactGeometry>(
+                    params.getGeometry()[j]);
+            else
+                contactGeom = &model.getComponent<ContactGeometry>(
+                    "./contactgeometryset/" + params.getGeometry()[j]);
+
+            const ContactGeometry& geom = *contactGeom;
+
+            ContactSurface surface;
+            surface.frame = &geom.getFrame();
+            surface.X_FP = geom.getTransform();
+            surface.stiffness = params.getStiffness();
+            surface.dissipation = params.getDissipation();
+            surface.staticFriction = params.getStaticFriction();
+            surface.dynamicFriction = params.getDynamicFriction();
+            surface.viscousFriction = params.getViscousFriction();
+
+            if (const ContactSphere* sphere =
+                    dynamic_cast<const ContactSphere*>(&geom)) {
+                surface.radius = sphere->getRadius();
+                _maxRadius = std::max(_maxRadius, surface.radius);
+                _sphereIndices.push_back((int)_surfaces.size());
+            }
+            else if (dynamic_cast<const ContactHalfSpace*>(&geom)) {
+                surface.isHalfSpace = true;
+                _halfSpaceIndices.push_back((int)_surfaces.size());
+            }
+            else {
+                OPENSIM_THROW_FRMOBJ(Exception,
+                    "Contact geometry '" + geom.getName() + "' is a " +
+                    geom.getConcreteClassName() + "; only ContactSphere and "
+                    "ContactHalfSpace are supported. Use "
+                    "ElasticFoundationForce for meshes.");
+            }
+            _surfaces.push_back(surface);
+        }
+    }
+}
+
+//==============================================================================
+// COMPUTATION
+//==============================================================================
+/* Broad phase: hash the sphere centers into a uniform grid sized to the
+ * largest bounding sphere, then run the narrow phase only for pairs whose
+ * bounding spheres overlap. Half spaces are infinite, so each is tested
+ * against every sphere, but that test is a single dot product. */
+void HuntCrossleyContactManager::computeForce(const SimTK::State& s,
+    SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+    SimTK::Vector& generalizedForces) const
+{
+    const int numSpheres = (int)_sphereIndices.size();
+    const int numHalfSpaces = (int)_halfSpaceIndices.size();
+    if (numSpheres == 0)
+        return;
+
+    // Locate every surface in ground once.
+    std::vector<SimTK::Transform> X_GP(_surfaces.size());
+    for (int i = 0; i < (int)_surfaces.size(); ++i) {
+        X_GP[i] = _surfaces[i].frame->getTransformInGround(s)
+                  * _surfaces[i].X_FP;
+    }
+
+    long long narrowEvals = 0;
+
+    // Hash the sphere centers. With cells as large as the largest bounding
+    // sphere's diameter, every overlapping pair is found among the 27 cells
+    // around either sphere.
+    const double cellSize = (_maxRadius > 0) ? 2*_maxRadius : 1.0;
+    std::unordered_map<long long, std::vector<int>> grid;
+    grid.reserve(numSpheres);
+    std::vector<SimTK::Vec3> cellCoords(numSpheres);
+    for (int a = 0; a < numSpheres; ++a) {
+        const Vec3& center = X_GP[_sphereIndices[a]].p();
+        cellCoords[a] = Vec3(std::floor(center[0]/cellSize),
+                             std::floor(center[1]/cellSize),
+                             std::floor(center[2]/cellSize));
+        grid[packCellKey((long long)cellCoords[a][0],
+                         (long long)cellCoords[a][1],
+                         (long long)cellCoords[a][2])].push_back(a);
+    }
+
+    // Sphere-sphere pairs from the hash.
+    for (int a = 0; a < numSpheres; ++a) {
+        const int i = _sphereIndices[a];
+        const ContactSurface& surf1 = _surfaces[i];
+        const Vec3& c1 = X_GP[i].p();
+        for (long long dx = -1; dx <= 1; ++dx)
+        for (long long dy = -1; dy <= 1; ++dy)
+        for (long long dz = -1; dz <= 1; ++dz) {
+            const auto cell = grid.find(
+                packCellKey((long long)cellCoords[a][0] + dx,
+                            (long long)cellCoords[a][1] + dy,
+                            (long long)cellCoords[a][2] + dz));
+            if (cell == grid.end())
+                continue;
+            for (int b : cell->second) {
+                if (b <= a) // each pair once
+                    continue;
+                ++_numBroadPhaseChecks;
+                const int jj = _sphereIndices[b];
+                const ContactSurface& surf2 = _surfaces[jj];
+                const Vec3& c2 = X_GP[jj].p();
+                const Vec3 delta = c2 - c1;
+                const double sumRadii = surf1.radius + surf2.radius;
+                if (delta.normSqr() >= sumRadii*sumRadii)
+                    continue;
+                // narrow phase
+                ++narrowEvals;
+                const double dist = delta.norm();
+                const double depth = sumRadii - dist;
+                const SimTK::UnitVec3 normal(delta/dist, true);
+                const Vec3 contactPoint =
+                    c1 + (surf1.radius - 0.5*depth)*normal;
+                const double effectiveRadius =
+                    surf1.radius*surf2.radius/sumRadii;
+                applyHuntCrossleyForce(s, surf1, surf2, contactPoint, normal,
+                    depth, effectiveRadius, bodyForces);
+            }
+        }
+    }
+
+    // Half spaces are unbounded; test every sphere against each plane.
+    for (int h = 0; h < numHalfSpaces; ++h) {
+        const int i = _halfSpaceIndices[h];
+        const ContactSurface& surf1 = _surfaces[i];
+        // material fills local x>0, so the outward surface normal is -x
+        const SimTK::UnitVec3 normal(-X_GP[i].R().x());
+        const Vec3& planePoint = X_GP[i].p();
+        for (int a = 0; a < numSpheres; ++a) {
+            ++_numBroadPhaseChecks;
+            const int jj = _sphereIndices[a];
+            const ContactSurface& surf2 = _surfaces[jj];
+            const Vec3& center = X_GP[jj].p();
+            const double height = SimTK::dot(center - planePoint, normal);
+            if (height >= surf2.radius)
+                continue;
+            // narrow phase
+            ++narrowEvals;
+            const double depth = surf2.radius - height;
+            const Vec3 contactPoint = center - (surf2.radius - 0.5*depth)*normal;
+            applyHuntCrossleyForce(s, surf1, surf2, contactPoint, normal,
+                depth, surf2.radius, bodyForces);
+        }
+    }
+
+    const long long declaredPairs =
+        (long long)numSpheres*(numSpheres - 1)/2
+        + (long long)numSpheres*numHalfSpaces;
+    _numNarrowPhaseEvals += narrowEvals;
+    _numAvoidedNarrowPhaseEvals += declaredPairs - narrowEvals;
+}
+
+/* Evaluate the Hunt-Crossley force law for one contact and apply the equal
+ * and opposite forces at the contact point. Material combination and the
+ * force law follow Simbody's HuntCrossleyForce: series stiffness,
+ * stiffness-weighted dissipation, Hertz force
+ * fH = (4/3) k x sqrt(R k x) scaled by (1 + 3/2 c xdot), and friction
+ * following Michael Hollars' transition-velocity model. */
+void HuntCrossleyContactManager::applyHuntCrossleyForce(const SimTK::State& s,
+    const ContactSurface& surf1, const ContactSurface& surf2,
+    const Vec3& contactPoint_G, const SimTK::UnitVec3& normal_G,
+    double depth, double effectiveRadius,
+    SimTK::Vector_<SimTK::SpatialVec>& bodyForces) const
+{
+    // Combine the materials.
+    const double k1 = surf1.stiffness;
+    const double k2 = surf2.stiffness;
+    const double s1 = (k1 + k2 > 0) ? k2/(k1 + k2) : 0.5;
+    const double s2 = 1 - s1;
+    const double k = k1*s1;
+    const double c = surf1.dissipation*s1 + surf2.dissipation*s2;
+    const double us = combineFriction(surf1.staticFriction,
+                                      surf2.staticFriction);
+    const double ud = combineFriction(surf1.dynamicFriction,
+                                      surf2.dynamicFriction);
+    const double uv = combineFriction(surf1.viscousFriction,
+                                      surf2.viscousFriction);
+
+    // Velocity of surface 2's body relative to surface 1's body at the
+    // contact point.
+    const SimTK::MobilizedBody& mb1 = surf1.frame->getMobilizedBody();
+    const SimTK::MobilizedBody& mb2 = surf2.frame->getMobilizedBody();
+    const SimTK::Transform& X_GB1 = mb1.getBodyTransform(s);
+    const SimTK::Transform& X_GB2 = mb2.getBodyTransform(s);
+    const SimTK::SpatialVec& V_GB1 = mb1.getBodyVelocity(s);
+    const SimTK::SpatialVec& V_GB2 = mb2.getBodyVelocity(s);
+    const Vec3 v1 = V_GB1[1] + V_GB1[0] % (contactPoint_G - X_GB1.p());
+    const Vec3 v2 = V_GB2[1] + V_GB2[0] % (contactPoint_G - X_GB2.p());
+    const Vec3 vrel = v2 - v1;
+    const double vnormal = SimTK::dot(vrel, normal_G);
+    // penetration grows as body 2 moves against the outward normal
+    const double xdot = -vnormal;
+
+    // Normal force: Hertz with Hunt-Crossley dissipation.
+    const double fH = (4.0/3.0)*k*depth
+                      *std::sqrt(effectiveRadius*k*depth);
+    const double fn = fH*(1 + 1.5*c*xdot);
+    if (fn <= 0)
+        return; // dissipation cannot pull the surfaces together
+
+    Vec3 force = fn*normal_G;
+
+    // Friction force opposing the tangential slip velocity.
+    const Vec3 vtangent = vrel - vnormal*normal_G;
+    const double vslip = vtangent.norm();
+    if (vslip > SimTK::SignificantReal) {
+        const double vrelative = vslip/get_transition_velocity();
+        const double ffriction =
+            fn*(std::min(vrelative, 1.0)
+                *(ud + 2*(us - ud)/(1 + vrelative*vrelative))
+               + uv*vslip);
+        force -= (ffriction/vslip)*vtangent;
+    }
+
+    // Equal and opposite forces at the contact point; applyForceToPoint
+    // wants the point expressed in each frame.
+    applyForceToPoint(s, *surf2.frame,
+        ~surf2.frame->getTransformInGround(s)*contactPoint_G,
+        force, bodyForces);
+    applyForceToPoint(s, *surf1.frame,
+        ~surf1.frame->getTransformInGround(s)*contactPoint_G,
+        -force, bodyForces);
+}
+
+//=============================================================================
+// Reporting
+//=============================================================================
+/* Provide names of the quantities (column labels) of the force value(s)
+ * to be reported. */
+OpenSim::Array<std::string> HuntCrossleyContactManager::getRecordLabels() const
+{
+    OpenSim::Array<std::string> labels("");
+
+    labels.append(getName() + ".broad_phase_checks");
+    labels.append(getName() + ".narrow_phase_evals");
+    labels.append(getName() + ".avoided_narrow_phase_evals");
+
+    return labels;
+}
+/**
+ * Provide the value(s) to be reported that correspond to the labels
+ */
+OpenSim::Array<double> HuntCrossleyContactManager::
+getRecordValues(const SimTK::State& state) const
+{
+    OpenSim::Array<double> values(1);
+
+    values.append((double)_numBroadPhaseChecks);
+    values.append((double)_numNarrowPhaseEvals);
+    values.append((double)_numAvoidedNarrowPhaseEvals);
+
+    return values;
+}
+
+}// end of namespace OpenSim
@@ -0,0 +1,172 @@
+#ifndef OPENSIM_HUNT_CROSSLEY_CONTACT_MANAGER_H_
+#define OPENSIM_HUNT_CROSSLEY_CONTACT_MANAGER_H_
+/* -------------------------------------------------------------------------- *
+ *                 OpenSim:  HuntCrossleyContactManager.h                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+// INCLUDE
+#include "Force.h"
+#include "HuntCrossleyForce.h"
+
+#include <SimTKcommon/internal/ReferencePtr.h>
+
+#include <vector>
+
+namespace OpenSim {
+
+class PhysicalFrame;
+
+//==============================================================================
+//                      HUNT CROSSLEY CONTACT MANAGER
+//==============================================================================
+/** A Hunt-Crossley contact force over many geometries with a spatial-hash
+broad phase.
+
+A HuntCrossleyForce hands its declared geometries to Simbody's
+GeneralContactSubsystem, which considers every pair of surfaces in the set at
+every step. For scenes with many contacting objects the pair count grows
+quadratically while most pairs are nowhere near each other. This component
+evaluates the same Hunt-Crossley force law itself: each step it hashes the
+bounding spheres of its geometries into a uniform grid and runs the narrow
+phase only for pairs whose cells and bounding spheres overlap. Counters of
+candidate and avoided narrow-phase evaluations are maintained for
+instrumentation and exposed through the reporting interface.
+
+Materials are declared with the same ContactParameters grouping used by
+HuntCrossleyForce, and two surfaces' materials are combined following
+Simbody's rules (series stiffness; stiffness-weighted dissipation; harmonic
+mean of friction coefficients). Only ContactSphere and ContactHalfSpace
+geometries are supported; meshes should continue to use ElasticFoundationForce.
+
+@see HuntCrossleyForce */
+class OSIMSIMULATION_API HuntCrossleyContactManager : public Force {
+OpenSim_DECLARE_CONCRETE_OBJECT(HuntCrossleyContactManager, Force);
+public:
+//==============================================================================
+// PROPERTIES
+//==============================================================================
+    OpenSim_DECLARE_PROPERTY(contact_parameters,
+        HuntCrossleyForce::ContactParametersSet,
+        "Material properties.");
+    OpenSim_DECLARE_PROPERTY(transition_velocity, double,
+        "Slip velocity (creep) at which peak static friction occurs.");
+
+//==============================================================================
+// PUBLIC METHODS
+//==============================================================================
+    HuntCrossleyContactManager();
+
+    /** Takes over ownership of the passed-in object. **/
+    void addContactParameters(HuntCrossleyForce::ContactParameters* params);
+    /**
+     * Get the transition velocity for switching between static and dynamic friction.
+     */
+    double getTransitionVelocity() const;
+    /**
+     * %Set the transition velocity for switching between static and dynamic friction.
+     */
+    void setTransitionVelocity(double velocity);
+
+    /** Number of contact surfaces managed by this force (resolved at
+    connect time). */
+    int getNumSurfaces() const { return (int)_surfaces.size(); }
+
+    //--------------------------------------------------------------------------
+    // Instrumentation
+    //--------------------------------------------------------------------------
+    /** Number of candidate pairs whose bounding volumes were tested by the
+    broad phase, accumulated since the last resetContactStatistics(). */
+    long long getNumBroadPhaseChecks() const { return _numBroadPhaseChecks; }
+    /** Number of pairs that passed the broad phase and were evaluated by
+    the narrow phase, accumulated since the last resetContactStatistics(). */
+    long long getNumNarrowPhaseEvals() const { return _numNarrowPhaseEvals; }
+    /** Number of declared pairs the broad phase pruned away (declared pairs
+    minus narrow-phase evaluations), accumulated since the last
+    resetContactStatistics(). */
+    long long getNumAvoidedNarrowPhaseEvals() const
+    {   return _numAvoidedNarrowPhaseEvals; }
+    /** Reset the broad-phase instrumentation counters to zero. */
+    void resetContactStatistics() const;
+
+    void computeForce(const SimTK::State& s,
+        SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+        SimTK::Vector& generalizedForces) const override;
+
+    //-----------------------------------------------------------------------------
+    // Reporting
+    //-----------------------------------------------------------------------------
+    /** The reported quantities are the broad-phase instrumentation counters:
+    bounding-volume checks, narrow-phase evaluations, and narrow-phase
+    evaluations avoided. */
+    OpenSim::Array<std::string> getRecordLabels() const override;
+    OpenSim::Array<double> getRecordValues(const SimTK::State& state) const override;
+
+protected:
+    void extendConnectToModel(Model& model) override;
+
+private:
+    // INITIALIZATION
+    void constructProperties();
+
+    // A contact surface resolved at connect time: its frame, its (fixed)
+    // placement in that frame, its bounding radius and its material.
+    struct ContactSurface {
+        SimTK::ReferencePtr<const PhysicalFrame> frame;
+        SimTK::Transform X_FP;
+        double radius{0};       // sphere radius; unused for half spaces
+        bool isHalfSpace{false};
+        double stiffness{0};
+        double dissipation{0};
+        double staticFriction{0};
+        double dynamicFriction{0};
+        double viscousFriction{0};
+    };
+
+    // Narrow phase: evaluate the Hunt-Crossley force between two surfaces
+    // given the contact point, outward normal (from surface 1 into surface
+    // 2), penetration depth and effective radius of curvature, and add the
+    // resulting spatial forces to bodyForces.
+    void applyHuntCrossleyForce(const SimTK::State& s,
+        const ContactSurface& surf1, const ContactSurface& surf2,
+        const SimTK::Vec3& contactPoint_G, const SimTK::UnitVec3& normal_G,
+        double depth, double effectiveRadius,
+        SimTK::Vector_<SimTK::SpatialVec>& bodyForces) const;
+
+    // Surfaces resolved from the contact_parameters property at connect
+    // time; spheres and half spaces are indexed separately so the broad
+    // phase can hash the spheres and test each half space against them.
+    std::vector<ContactSurface> _surfaces;
+    std::vector<int> _sphereIndices;
+    std::vector<int> _halfSpaceIndices;
+    double _maxRadius{0};
+
+    // broad-phase instrumentation; mutated during (const) force evaluation
+    mutable long long _numBroadPhaseChecks{0};
+    mutable long long _numNarrowPhaseEvals{0};
+    mutable long long _numAvoidedNarrowPhaseEvals{0};
+
+//==============================================================================
+};  // END of class HuntCrossleyContactManager
+//==============================================================================
+//==============================================================================
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_HUNT_CROSSLEY_CONTACT_MANAGER_H_
@@ -243,14 +243,11 @@ void Ligament::computeForce(const SimTK::State& s,
         SimTK::Vector(1, path.getLength(s)/restingLength))* pcsaForce;
     setCacheVariableValue(s, _tensionCV, force);
 
-    OpenSim::Array<PointForceDirection*> PFDs;
-    path.getPointForceDirections(s, &PFDs);
+    path.getPointForceDirections(s, _pfds);
 
-    for (int i=0; i < PFDs.getSize(); i++) {
-        applyForceToPoint(s, PFDs[i]->frame(), PFDs[i]->point(), 
-                          force*PFDs[i]->direction(), bodyForces);
+    for (PointForceDirection& pfd : _pfds) {
+        applyForceToPoint(s, pfd.frame(), pfd.point(),
+                          force*pfd.direction(), bodyForces);
     }
-    for(int i=0; i < PFDs.getSize(); i++)
-        delete PFDs[i];
 }
 
@@ -28,6 +28,9 @@
 // INCLUDES
 //=============================================================================
 #include "Force.h"
+#include "PointForceDirection.h"
+
+#include <vector>
 
 #ifdef SWIG
     #ifdef OSIMACTUATORS_API
@@ -168,6 +171,10 @@ private:
     mutable CacheVariable<double> _tensionCV;
     mutable CacheVariable<double> _strainCV;
 
+    // Scratch storage reused across computeForce() calls so distributing
+    // the tension along the path is allocation-free.
+    mutable std::vector<PointForceDirection> _pfds;
+
 //=============================================================================
 };  // END of class Ligament
 //=============================================================================
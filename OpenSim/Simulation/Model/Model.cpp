@@ -36,12 +36,16 @@
 #include "ControllerSet.h"
 #include "CoordinateSet.h"
 #include "ForceSet.h"
+#include "GeometryPath.h"
 #include "Ligament.h"
 #include "MarkerSet.h"
 #include "ProbeSet.h"
 #include "SimTKcommon/internal/SystemGuts.h"
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <OpenSim/Common/Constant.h>
 #include <OpenSim/Common/IO.h>
@@ -79,6 +83,7 @@ Model::Model() : ModelComponent(),
     _coordinateSet(CoordinateSet()),
     _workingState(),
     _useVisualizer(false),
+    _useParallelPathComputation(false),
     _allControllersEnabled(true)
 {
     constructProperties();
@@ -96,6 +101,7 @@ Model::Model(const string &aFileName) :
     _coordinateSet(CoordinateSet()),
     _workingState(),
     _useVisualizer(false),
+    _useParallelPathComputation(false),
     _allControllersEnabled(true)
 {   
     constructProperties();
@@ -125,6 +131,11 @@ Model::Model(const string &aFileName) :
 
 Model* Model::clone() const
 {
+    // Pool-allocate the clone's entire object/property tree: replicating a
+    // full-body model node-by-node otherwise costs one heap round trip per
+    // Object/property, which dominates per-thread replication time.
+    ObjectAllocationArena arena;
+
     // Invoke default copy constructor.
     Model* clone = new Model(*this);
 
@@ -317,6 +328,7 @@ void Model::updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNumber)
 void Model::setNull()
 {
     _useVisualizer = false;
+    _useParallelPathComputation = false;
     _allControllersEnabled = true;
 
     _validationLog="";
@@ -407,6 +419,29 @@ void Model::buildSystem() {
 }
 
 
+//------------------------------------------------------------------------------
+//                         INIT SYSTEM IF NEEDED
+//------------------------------------------------------------------------------
+// Rebuild the System only if it is missing or some component in the tree has
+// been edited through the component interface since the last build.
+SimTK::State& Model::initSystemIfNeeded() {
+    bool needsRebuild = !isValidSystem();
+    if (!needsRebuild) {
+        // The Model's own flag is blind to edits made through a retained
+        // reference to a subcomponent, so check every component in the tree.
+        for (const Component& comp : getComponentList()) {
+            if (!comp.isObjectUpToDateWithProperties()) {
+                needsRebuild = true;
+                break;
+            }
+        }
+    }
+    if (needsRebuild)
+        buildSystem();
+    return initializeState();
+}
+
+
 //------------------------------------------------------------------------------
 //                            INITIALIZE STATE
 //------------------------------------------------------------------------------
@@ -453,9 +488,42 @@ SimTK::State& Model::initializeState() {
     if (getUseVisualizer())
         _modelViz->collectFixedGeometry(_workingState);
 
+    // Snapshot the per-coordinate bounds and defaults into contiguous
+    // arrays; see getCoordinateSnapshot().
+    {
+        const CoordinateSet& coords = getCoordinateSet();
+        const int nc = coords.getSize();
+        _coordinateSnapshot.paths.resize(nc);
+        _coordinateSnapshot.rangeMin.resize(nc);
+        _coordinateSnapshot.rangeMax.resize(nc);
+        _coordinateSnapshot.defaultValues.resize(nc);
+        _coordinateSnapshot.defaultSpeeds.resize(nc);
+        _coordinateSnapshot.clamped.resize(nc);
+        _coordinateSnapshot.locked.resize(nc);
+        for (int i = 0; i < nc; ++i) {
+            const Coordinate& coord = coords[i];
+            _coordinateSnapshot.paths[i] = coord.getAbsolutePathString();
+            _coordinateSnapshot.rangeMin[i] = coord.getRangeMin();
+            _coordinateSnapshot.rangeMax[i] = coord.getRangeMax();
+            _coordinateSnapshot.defaultValues[i] = coord.getDefaultValue();
+            _coordinateSnapshot.defaultSpeeds[i] =
+                coord.getDefaultSpeedValue();
+            _coordinateSnapshot.clamped[i] = coord.getDefaultClamped();
+            _coordinateSnapshot.locked[i] = coord.getDefaultLocked();
+        }
+    }
+
     return _workingState;
 }
 
+const Model::CoordinateSnapshot& Model::getCoordinateSnapshot() const
+{
+    if (!isValidSystem())
+        throw Exception("Model::getCoordinateSnapshot(): "
+            "call initializeState() first.");
+    return _coordinateSnapshot;
+}
+
 
 SimTK::State& Model::updWorkingState()
 {
@@ -1206,10 +1274,53 @@ void Model::equilibrateMuscles(SimTK::State& state)
         }
     }
 
-    if(failed) // Notify the caller of the failure to equilibrate 
+    if(failed) // Notify the caller of the failure to equilibrate
         throw Exception("Model::equilibrateMuscles() "+errorMsg, __FILE__, __LINE__);
 }
 
+void Model::equilibrateMusclesSinglePass(SimTK::State& state)
+{
+    bool failed = false;
+    string errorMsg = "";
+
+    // Solve every muscle against the same realized state on a working copy.
+    // Equilibration modifies only the muscles' auxiliary (Z) state
+    // variables, so the kinematic realization of the copy stays valid for
+    // the whole pass and the provided state is untouched until the solved
+    // values are written back below.
+    SimTK::State workingState = state;
+    getMultibodySystem().realize(workingState, Stage::Velocity);
+
+    auto muscles = getComponentList<Muscle>();
+
+    for (auto& muscle : muscles) {
+        if (muscle.appliesForce(workingState)){
+            try{
+                muscle.computeEquilibrium(workingState);
+            }
+            catch (const std::exception& e) {
+                if(!failed){ // haven't failed to equilibrate other muscles yet
+                    errorMsg = e.what();
+                    failed = true;
+                }
+                // just because one muscle failed to equilibrate doesn't mean
+                // it isn't still useful to have remaining muscles equilibrate
+                // in an analysis, for example, we might not be reporting about
+                // all muscles, so continue with the rest.
+                continue;
+            }
+        }
+    }
+
+    // Write the solved auxiliary states back in bulk. Muscles that failed
+    // (or do not apply force) retain their original values in the copy.
+    state.updZ() = workingState.getZ();
+
+    if(failed) // Notify the caller of the failure to equilibrate
+        throw Exception("Model::equilibrateMusclesSinglePass() "+errorMsg,
+            __FILE__, __LINE__);
+}
+
 //=============================================================================
 // GRAVITY
 //=============================================================================
@@ -1740,7 +1851,17 @@ void Model::createAssemblySolver(const SimTK::State& s)
 
 void Model::updateAssemblyConditions(SimTK::State& s)
 {
-    createAssemblySolver(s);    
+    createAssemblySolver(s);
+}
+
+const MomentArmSolver& Model::getMomentArmSolver() const
+{
+    if (!_momentArmSolver) {
+        // MomentArmSolver initializes from the working state, so the system
+        // must already have been created.
+        _momentArmSolver.reset(new MomentArmSolver(*this));
+    }
+    return *_momentArmSolver;
 }
 //--------------------------------------------------------------------------
 // MARKERS
@@ -2122,6 +2243,58 @@ void Model::realizeTime(const SimTK::State& state) const
 void Model::realizePosition(const SimTK::State& state) const
 {
     getSystem().realize(state, Stage::Position);
+    if (_useParallelPathComputation)
+        computeGeometryPathsInParallel(state);
+}
+
+void Model::computeGeometryPathsInParallel(const SimTK::State& state) const
+{
+    std::vector<const GeometryPath*> paths;
+    for (const GeometryPath& path : getComponentList<GeometryPath>())
+        paths.push_back(&path);
+    const int numPaths = (int)paths.size();
+    if (numPaths < 2)
+        return;
+
+    // Frame transforms are computed lazily into cache entries shared by all
+    // paths; fill them on this thread so the workers only read them.
+    for (const Frame& frame : getComponentList<Frame>())
+        frame.getTransformInGround(state);
+
+    // Each path writes only its own cache entries, so the paths can be
+    // computed concurrently once the shared kinematics above are in place.
+    std::atomic<int> nextPath(0);
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+    auto worker = [&]() {
+        while (true) {
+            const int i = nextPath++;
+            if (i >= numPaths)
+                break;
+            try {
+                paths[i]->getLength(state);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError)
+                    firstError = std::current_exception();
+            }
+        }
+    };
+
+    int numThreads = (int)std::thread::hardware_concurrency();
+    numThreads = std::max(1, std::min(numThreads, numPaths));
+    if (numThreads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        for (int i = 0; i < numThreads; ++i)
+            threads.emplace_back(worker);
+        for (auto& thread : threads)
+            thread.join();
+    }
+    if (firstError)
+        std::rethrow_exception(firstError);
 }
 
 void Model::realizeVelocity(const SimTK::State& state) const
@@ -29,6 +29,7 @@
 #include <OpenSim/Common/Units.h>
 #include <OpenSim/Common/ModelDisplayHints.h>
 #include <OpenSim/Simulation/AssemblySolver.h>
+#include <OpenSim/Simulation/MomentArmSolver.h>
 #include <OpenSim/Simulation/Model/AnalysisSet.h>
 #include <OpenSim/Simulation/Model/BodySet.h>
 #include <OpenSim/Simulation/Model/ComponentSet.h>
@@ -145,8 +146,15 @@ related objects are maintained in a runtime section of the Model object. You
 can also ask a Model to provide visualization using the setUseVisualizer()
 method, in which case it will allocate and maintain a ModelVisualizer.
 
+Once initSystem() has been called, a Model whose structure is left alone can
+be treated as a frozen, immutable core and shared by several threads: its
+const computational methods write only into the SimTK::State they are given.
+Give each thread its own State — conveniently packaged by a
+ModelWorkingContext — instead of cloning the Model per thread; see
+ModelWorkingContext for the few shared-mutable exceptions to this rule.
+
 @authors Frank Anderson, Peter Loan, Ayman Habib, Ajay Seth, Michael Sherman
-@see ModelComponent, ModelVisualizer, SimTK::System
+@see ModelComponent, ModelVisualizer, ModelWorkingContext, SimTK::System
 **/
 
 class OSIMSIMULATION_API Model  : public ModelComponent {
@@ -290,8 +298,12 @@ public:
      */
     void cleanup();
 
-    /** Model clone() override that invokes finalizeFromProperties() 
-        on a default copy constructed Model, prior to returning the Model. */
+    /** Model clone() override that invokes finalizeFromProperties()
+        on a default copy constructed Model, prior to returning the Model.
+        The clone's object/property tree is pool-allocated through an
+        ObjectAllocationArena, which keeps per-thread replicas (ensemble and
+        Moco parallel evaluation) cache-dense and cheap to build and to
+        destroy. */
     Model* clone() const override;
     
     const std::string& getConcreteClassName() const override
@@ -333,6 +345,21 @@ public:
     take effect at the next call to initSystem() on this %Model. **/
     bool getUseVisualizer() const {return _useVisualizer;}
 
+    /** Request that realizePosition() compute the model's GeometryPaths in
+    parallel across hardware threads after the underlying system has been
+    realized to SimTK::Stage::Position. The path and wrapping computations of
+    distinct paths are independent given the kinematics, so models with many
+    muscles and wrap surfaces can fill their position-stage path caches
+    concurrently instead of one muscle at a time. The default is off. When
+    this flag is set, no other thread may touch the state passed to
+    realizePosition() for the duration of the call. **/
+    void setUseParallelPathComputation(bool useParallel)
+    {   _useParallelPathComputation = useParallel; }
+    /** Return the current setting of the "parallel path computation" flag.
+    @see setUseParallelPathComputation() **/
+    bool getUseParallelPathComputation() const
+    {   return _useParallelPathComputation; }
+
     /** Test whether a ModelVisualizer has been created for this Model. Even
     if visualization has been requested there will be no visualizer present
     until initSystem() has been successfully invoked. Use this method prior
@@ -386,15 +413,31 @@ public:
     SimTK::State& initializeState();
 
     
-    /** Convenience method that invokes buildSystem() and then 
+    /** Convenience method that invokes buildSystem() and then
     initializeState(). This returns a reference to the writable internally-
-    maintained model State. Note that this does not affect the 
+    maintained model State. Note that this does not affect the
     system's default state (which is part of the model and hence read-only). **/
     SimTK::State& initSystem() SWIG_DECLARE_EXCEPTION {
         buildSystem();
         return initializeState();
     }
 
+    /** Like initSystem(), but reuse the existing System when nothing has
+    changed since it was built: if the Model has a valid System and every
+    component in the tree is up to date with its properties, skip
+    buildSystem() and only reinitialize the state, so repeated calls in a
+    loop cost a state initialization rather than a full System rebuild.
+    Any property edit made through the component interface (upd_*,
+    updPropertyByName(), adding or removing components) marks the edited
+    component and triggers a genuine rebuild on the next call.
+
+    The staleness check sees only edits made through the component
+    interface. Writes that bypass it -- through a cached AbstractProperty
+    pointer, or directly into the SimTK::System -- leave every up-to-date
+    flag intact and would be silently ignored here; callers making such
+    edits must use initSystem() instead. **/
+    SimTK::State& initSystemIfNeeded() SWIG_DECLARE_EXCEPTION;
+
 
     /** Convenience method that returns a reference to the model's 'working'
     state. This is just returning the reference that was returned by 
@@ -443,6 +486,15 @@ public:
      * Update the AssemblySolver to the latest coordinate locking/constraints
      */
     void updateAssemblyConditions(SimTK::State& s);
+    /**
+     * Obtain the Model's shared moment-arm solver, creating it on demand.
+     * The solver caches the full path-by-coordinate moment-arm matrix keyed
+     * on the pose (see MomentArmSolver::solveMomentArmsCached), so consumers
+     * that need moment arms at the same state (e.g. analyses run together
+     * over a trial) share one computation rather than each recomputing it.
+     * The system must have been created (by initSystem()) beforehand.
+     */
+    const MomentArmSolver& getMomentArmSolver() const;
     /**
      * Find the kinematic state of the model that satisfies constraints and coordinate goals
      * If assemble is being called due to a coordinate set value, provide the option
@@ -456,6 +508,23 @@ public:
      */
     void equilibrateMuscles(SimTK::State& state);
 
+    /**
+     * Update the state of all Muscles so they are in equilibrium, realizing
+     * the model to SimTK::Stage::Velocity exactly once. Each muscle's
+     * equilibrium depends only on the coordinates, the speeds, and the
+     * muscle's own state variables, so all muscles are solved against the
+     * same realized state on a working copy and the solved auxiliary state
+     * variables are then written back to the provided state in bulk. This
+     * avoids the per-muscle state invalidation performed by
+     * equilibrateMuscles() and is the preferred entry point when
+     * equilibration is on the critical path (e.g., at the start of every
+     * trial of a batch of forward simulations). As with
+     * equilibrateMuscles(), muscles that fail to equilibrate are left at
+     * their current state values and an Exception describing the first
+     * failure is thrown after all muscles have been attempted.
+     */
+    void equilibrateMusclesSinglePass(SimTK::State& state);
+
     //--------------------------------------------------------------------------
     /**@name       Access to the Simbody System and components
 
@@ -872,6 +941,28 @@ public:
     std::vector<SimTK::ReferencePtr<const Coordinate>>
         getCoordinatesInMultibodyTreeOrder() const;
 
+    /** Contiguous snapshot of per-coordinate information, in CoordinateSet
+        order, rebuilt each time the state is initialized. Loops that query
+        bounds or defaults for every coordinate (problem construction, state
+        clamping) can read these arrays instead of issuing per-coordinate
+        property reads and Simbody index lookups. */
+    struct CoordinateSnapshot {
+        /** Absolute path of each coordinate, for mapping entries back to
+            components. */
+        std::vector<std::string> paths;
+        SimTK::Vector rangeMin;
+        SimTK::Vector rangeMax;
+        SimTK::Vector defaultValues;
+        SimTK::Vector defaultSpeeds;
+        std::vector<bool> clamped;
+        std::vector<bool> locked;
+    };
+
+    /** The CoordinateSnapshot built by the last initializeState(); reflects
+        the coordinate properties as of that call. Throws if the model does
+        not have a valid system. */
+    const CoordinateSnapshot& getCoordinateSnapshot() const;
+
     /** Get a warning message if any Coordinates have a MotionType that is NOT
         consistent with its previous user-specified value that existed in 
         Model files prior to OpenSim 4.0 */
@@ -1093,6 +1184,11 @@ private:
 
     void createAssemblySolver(const SimTK::State& s);
 
+    // Fill the position-stage caches of all GeometryPaths across hardware
+    // threads. Called by realizePosition() when the "parallel path
+    // computation" flag is set.
+    void computeGeometryPathsInParallel(const SimTK::State& state) const;
+
     // To provide access to private _modelComponents member.
     friend class Component; 
 
@@ -1141,6 +1237,10 @@ private:
     // initializeState() or initSystem() is called.
     SimTK::State _workingState;
 
+    // Contiguous per-coordinate bounds/defaults, rebuilt by
+    // initializeState(); see getCoordinateSnapshot().
+    CoordinateSnapshot _coordinateSnapshot;
+
     // A cached list of `Controller`s that were enabled in the model
     // when `Model::extendConnectToModel(Model&)` was called.
     //
@@ -1162,6 +1262,10 @@ private:
     // a ModelVisualizer for display.
     bool _useVisualizer;
 
+    // If this flag is set, realizePosition() computes all GeometryPaths in
+    // parallel after realizing the underlying system.
+    bool _useParallelPathComputation;
+
     // Global flag used to disable all Controllers.
     bool _allControllersEnabled;
 
@@ -1195,6 +1299,12 @@ private:
     // when the Model is copied.
     SimTK::ResetOnCopy<std::unique_ptr<AssemblySolver>> _assemblySolver;
 
+    // Moment-arm solver shared by consumers that need path moment arms at
+    // the same state; created on demand by getMomentArmSolver(). Owned by
+    // the Model and not copied when the Model is copied.
+    mutable SimTK::ResetOnCopy<std::unique_ptr<MomentArmSolver>>
+        _momentArmSolver;
+
     // Model controls as a shared pool (Vector) of individual Actuator controls
     SimTK::MeasureIndex   _modelControlsIndex;
     // Default values pooled from Actuators upon system creation.
@@ -0,0 +1,44 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  ModelWorkingContext.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ModelWorkingContext.h"
+
+using namespace OpenSim;
+
+ModelWorkingContext::ModelWorkingContext(const Model& model) :
+    _model(&model)
+{
+    OPENSIM_THROW_IF(!model.isValidSystem(), Exception,
+        "ModelWorkingContext requires an initialized model; call "
+        "Model::initSystem() first.");
+    _state = model.getWorkingState();
+}
+
+void ModelWorkingContext::reset()
+{
+    _state = _model->getWorkingState();
+}
+
+void ModelWorkingContext::realize(SimTK::Stage stage)
+{
+    _model->getMultibodySystem().realize(_state, stage);
+}
@@ -0,0 +1,102 @@
+#ifndef OPENSIM_MODEL_WORKING_CONTEXT_H_
+#define OPENSIM_MODEL_WORKING_CONTEXT_H_
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  ModelWorkingContext.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <OpenSim/Simulation/Model/Model.h>
+
+namespace OpenSim {
+
+//==============================================================================
+//                          MODEL WORKING CONTEXT
+//==============================================================================
+/** A lightweight per-thread working context for one shared, initialized
+Model. After Model::initSystem() the Model's structure — its components,
+properties, and the underlying SimTK::MultibodySystem — can be treated as a
+frozen, immutable core: the computations the model performs through its
+const interface write only into the SimTK::State they are given, which is
+where Simbody keeps every position, velocity, force and realization cache.
+A ModelWorkingContext packages such a State (kilobytes) together with the
+model it belongs to, so N threads can share one Model instead of each
+cloning it (megabytes of components plus a System rebuild per clone):
+
+@code
+Model model("subject.osim");
+model.initSystem();
+// ... on each worker thread:
+ModelWorkingContext context(model);
+context.updState().updQ()[0] = 0.3;
+context.realize(SimTK::Stage::Velocity);
+double height = model.calcMassCenterPosition(context.getState())[1];
+@endcode
+
+While any context is alive, use the shared model only through const
+methods, and beware the few entry points that mutate the shared model even
+though they operate on a caller's state:
+ - Model::assemble(), and Coordinate value setters that trigger an
+   assembly, work through the model's single AssemblySolver;
+ - Model::updWorkingState() is the model's own working state, which the
+   contexts exist to replace;
+ - realizing to SimTK::Stage::Report with a visualizer attached draws
+   through the shared ModelVisualizer;
+ - path wrapping: computing a wrapping GeometryPath stores the solution in
+   its PathWrap's previous-wrap record to warm-start the next solve, so
+   realizing two contexts of a model with wrap objects concurrently races
+   on that shared record. A model that wraps must not be shared across
+   threads; give each thread its own Model copy instead.
+Calling initSystem() or initializeState(), or editing the model's
+structure, invalidates every outstanding context.
+
+@see Model, EnsembleSimulator */
+class OSIMSIMULATION_API ModelWorkingContext {
+public:
+    /** Construct a context for a model on which initSystem() (or
+        initializeState()) has already been called; throws otherwise. The
+        context's state starts as a copy of the model's default working
+        state. The model must outlive this context. */
+    explicit ModelWorkingContext(const Model& model);
+
+    const Model& getModel() const { return _model.getRef(); }
+
+    /** This context's own state; pass it to the model's const
+        computational methods. */
+    const SimTK::State& getState() const { return _state; }
+    SimTK::State& updState() { return _state; }
+
+    /** Rewind this context's state to the model's default working
+        state. */
+    void reset();
+
+    /** Realize this context's state to the given stage; equivalent to
+        realizing getState() through the model's system. */
+    void realize(SimTK::Stage stage);
+
+private:
+    SimTK::ReferencePtr<const Model> _model;
+    SimTK::State _state;
+
+};  // END of class ModelWorkingContext
+
+} // namespace
+
+#endif // OPENSIM_MODEL_WORKING_CONTEXT_H_
@@ -49,6 +49,7 @@ using SimTK::Vec3;
 MovingPathPoint::MovingPathPoint() : Super()
 {
     constructProperties();
+    _functionArg.resize(1);
 }
 
 //_____________________________________________________________________________
@@ -126,6 +127,23 @@ void MovingPathPoint::extendConnectToModel(Model& model)
         _zCoordinate.reset(&getConnectee<Coordinate>("z_coordinate"));
     }
 
+    // Precompute the clamp bounds of the location-function inputs and size
+    // the scratch argument so the per-call evaluations below do no property
+    // lookups and no allocation.
+    if (!_xCoordinate.empty()) {
+        _rangeMin[0] = _xCoordinate->getRangeMin();
+        _rangeMax[0] = _xCoordinate->getRangeMax();
+    }
+    if (!_yCoordinate.empty()) {
+        _rangeMin[1] = _yCoordinate->getRangeMin();
+        _rangeMax[1] = _yCoordinate->getRangeMax();
+    }
+    if (!_zCoordinate.empty()) {
+        _rangeMin[2] = _zCoordinate->getRangeMin();
+        _rangeMax[2] = _zCoordinate->getRangeMax();
+    }
+    _functionArg.resize(1);
+
     // As OpenSim 3.2 we correct for the Work along a Coordinate due to
     // the generalized force that enforces the "gearing" that moves the point
     // under tension. The work is attributed to a single Coordinate, so 
@@ -217,31 +235,28 @@ SimTK::Vec3 MovingPathPoint::getLocation(const SimTK::State& s) const
 {
     SimTK::Vec3 pInF(0);
     if (!_xCoordinate.empty()) {
-        const double xval = SimTK::clamp(_xCoordinate->getRangeMin(),
-            _xCoordinate->getValue(s),
-            _xCoordinate->getRangeMax());
-        pInF[0] = get_x_location().calcValue(SimTK::Vector(1, xval));
+        _functionArg[0] = SimTK::clamp(_rangeMin[0],
+            _xCoordinate->getValue(s), _rangeMax[0]);
     }
     else // assume a Constant
-        pInF[0] = get_x_location().calcValue(SimTK::Vector(1, 0.0));
+        _functionArg[0] = 0.0;
+    pInF[0] = get_x_location().calcValue(_functionArg);
 
     if (!_yCoordinate.empty()) {
-        const double yval = SimTK::clamp(_yCoordinate->getRangeMin(),
-            _yCoordinate->getValue(s),
-            _yCoordinate->getRangeMax());
-        pInF[1] = get_y_location().calcValue(SimTK::Vector(1, yval));
+        _functionArg[0] = SimTK::clamp(_rangeMin[1],
+            _yCoordinate->getValue(s), _rangeMax[1]);
     }
     else // type == Constant
-        pInF[1] = get_y_location().calcValue(SimTK::Vector(1, 0.0));
+        _functionArg[0] = 0.0;
+    pInF[1] = get_y_location().calcValue(_functionArg);
 
     if (!_zCoordinate.empty()) {
-        const double zval = SimTK::clamp(_zCoordinate->getRangeMin(),
-            _zCoordinate->getValue(s),
-            _zCoordinate->getRangeMax());
-        pInF[2] = get_z_location().calcValue(SimTK::Vector(1, zval));
+        _functionArg[0] = SimTK::clamp(_rangeMin[2],
+            _zCoordinate->getValue(s), _rangeMax[2]);
     }
     else // type == Constant
-        pInF[2] = get_z_location().calcValue(SimTK::Vector(1, 0.0));
+        _functionArg[0] = 0.0;
+    pInF[2] = get_z_location().calcValue(_functionArg);
 
     return pInF;
 }
@@ -249,34 +264,33 @@ SimTK::Vec3 MovingPathPoint::getLocation(const SimTK::State& s) const
 
 SimTK::Vec3 MovingPathPoint::getVelocity(const SimTK::State& s) const
 {
-    std::vector<int> derivComponents;
-    derivComponents.push_back(0);
+    static const std::vector<int> derivComponents(1, 0);
 
     SimTK::Vec3 vInF(0);
 
     if (!_xCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
+        _functionArg[0] = _xCoordinate->getValue(s);
         vInF[0] = get_x_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _xCoordinate->getValue(s)))*
-                _xCoordinate->getSpeedValue(s);
+            derivComponents, _functionArg) * _xCoordinate->getSpeedValue(s);
     }
     else
         vInF[0] = 0.0;
 
     if (!_yCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
+        _functionArg[0] = _yCoordinate->getValue(s);
         vInF[1] = get_y_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _yCoordinate->getValue(s)))*
-                _yCoordinate->getSpeedValue(s);
+            derivComponents, _functionArg) * _yCoordinate->getSpeedValue(s);
     }
     else
         vInF[1] = 0.0;
 
     if (!_zCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
+        _functionArg[0] = _zCoordinate->getValue(s);
         vInF[2] = get_z_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _zCoordinate->getValue(s)))*
-                _zCoordinate->getSpeedValue(s);
+            derivComponents, _functionArg) * _zCoordinate->getSpeedValue(s);
     }
     else
         vInF[2] = 0.0;
@@ -292,23 +306,25 @@ SimTK::Vec3 MovingPathPoint::getdPointdQ(const SimTK::State& s) const
 {
     SimTK::Vec3 dPdq_B(0);
 
-    std::vector<int> derivComponents;
-    derivComponents.push_back(0);
+    static const std::vector<int> derivComponents(1, 0);
 
     if (!_xCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[0] = get_x_location().calcDerivative(derivComponents, 
-            SimTK::Vector(1, _xCoordinate->getValue(s)));
+        _functionArg[0] = _xCoordinate->getValue(s);
+        dPdq_B[0] = get_x_location().calcDerivative(
+            derivComponents, _functionArg);
     }
     if (!_yCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[1] = get_y_location().calcDerivative(derivComponents,
-            SimTK::Vector(1, _yCoordinate->getValue(s)));
+        _functionArg[0] = _yCoordinate->getValue(s);
+        dPdq_B[1] = get_y_location().calcDerivative(
+            derivComponents, _functionArg);
     }
     if (!_zCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[2] = get_z_location().calcDerivative(derivComponents,
-            SimTK::Vector(1, _zCoordinate->getValue(s)));
+        _functionArg[0] = _zCoordinate->getValue(s);
+        dPdq_B[2] = get_z_location().calcDerivative(
+            derivComponents, _functionArg);
     }
 
     return dPdq_B;
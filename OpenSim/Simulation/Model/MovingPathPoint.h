@@ -124,6 +124,17 @@ private:
     SimTK::ReferencePtr<const Coordinate> _yCoordinate;
     SimTK::ReferencePtr<const Coordinate> _zCoordinate;
 
+    // Coordinate range bounds used to clamp the location-function inputs,
+    // precomputed at connect time so the per-call evaluations avoid
+    // repeated property accesses.
+    SimTK::Vec3 _rangeMin{-SimTK::Infinity};
+    SimTK::Vec3 _rangeMax{SimTK::Infinity};
+
+    // Single-element scratch argument reused across evaluations so the
+    // inner path assembly loop is allocation-free. A path point belongs to
+    // exactly one GeometryPath, which is computed by a single thread.
+    mutable SimTK::Vector _functionArg;
+
 //=============================================================================
 };  // END of class MovingPathPoint
 //=============================================================================
@@ -205,14 +205,10 @@ void PathSpring::computeForce(const SimTK::State& s,
     const GeometryPath& path = getGeometryPath();
     const double& tension = getTension(s);
 
-    OpenSim::Array<PointForceDirection*> PFDs;
-    path.getPointForceDirections(s, &PFDs);
+    path.getPointForceDirections(s, _pfds);
 
-    for (int i=0; i < PFDs.getSize(); i++) {
-        applyForceToPoint(s, PFDs[i]->frame(), PFDs[i]->point(), 
-                          tension*PFDs[i]->direction(), bodyForces);
+    for (PointForceDirection& pfd : _pfds) {
+        applyForceToPoint(s, pfd.frame(), pfd.point(),
+                          tension*pfd.direction(), bodyForces);
     }
-
-    for(int i=0; i < PFDs.getSize(); i++)
-        delete PFDs[i];
 }
@@ -28,6 +28,9 @@
 // INCLUDES
 //=============================================================================
 #include "Force.h"
+#include "PointForceDirection.h"
+
+#include <vector>
 
 namespace OpenSim {
 
@@ -188,6 +191,10 @@ protected:
 private:
     void constructProperties();
 
+    // Scratch storage reused across computeForce() calls so distributing
+    // the tension along the path is allocation-free.
+    mutable std::vector<PointForceDirection> _pfds;
+
 //=============================================================================
 };  // END of class PathSpring
 //=============================================================================
@@ -0,0 +1,165 @@
+/* -------------------------------------------------------------------------- *
+ *                 OpenSim: StationPlaneContactForces.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "StationPlaneContactForces.h"
+
+#include "Model.h"
+
+using namespace OpenSim;
+
+StationPlaneContactForces::StationPlaneContactForces()
+{
+    constructProperties();
+}
+
+void StationPlaneContactForces::constructProperties()
+{
+    constructProperty_stations();
+    constructProperty_stiffness(5e7);
+    constructProperty_dissipation(1.0);
+    constructProperty_friction_coefficient(1.0);
+    constructProperty_tangent_velocity_scaling_factor(0.05);
+}
+
+void StationPlaneContactForces::addStation(const PhysicalFrame& frame,
+        const SimTK::Vec3& location)
+{
+    append_stations(Station(frame, location));
+}
+
+void StationPlaneContactForces::extendConnectToModel(Model& model)
+{
+    Super::extendConnectToModel(model);
+
+    const int numStations = getProperty_stations().size();
+    m_locations.clear();
+    m_frameIndex.clear();
+    m_frames.clear();
+    m_locations.reserve(numStations);
+    m_frameIndex.reserve(numStations);
+
+    for (int i = 0; i < numStations; ++i) {
+        const Station& station = get_stations(i);
+        const PhysicalFrame& frame = station.getParentFrame();
+        int index = -1;
+        for (int k = 0; k < (int)m_frames.size(); ++k) {
+            if (m_frames[k].get() == &frame) { index = k; break; }
+        }
+        if (index < 0) {
+            index = (int)m_frames.size();
+            m_frames.emplace_back(&frame);
+        }
+        m_locations.push_back(station.get_location());
+        m_frameIndex.push_back(index);
+    }
+}
+
+SimTK::Vec3 StationPlaneContactForces::calcSmoothForce(const SimTK::Vec3& pos,
+        const SimTK::Vec3& vel) const
+{
+    // Smooth force law of Ackermann and van den Bogert (2010); identical to
+    // the per-station Moco component so results match station for station.
+    SimTK::Vec3 force(0);
+    const SimTK::Real depth = 0 - pos[1];
+    const SimTK::Real depthRate = 0 - vel[1];
+    const SimTK::Real velSliding = vel[0];
+    const SimTK::Real a = get_stiffness();
+    const SimTK::Real b = get_dissipation();
+    if (depth > 0) {
+        force[1] = fmax(0, a * pow(depth, 3) * (1 + b * depthRate));
+    }
+    const SimTK::Real voidStiffness = 1.0; // N/m
+    force[1] += voidStiffness * depth;
+
+    const SimTK::Real velSlidingScaling =
+            get_tangent_velocity_scaling_factor();
+    const SimTK::Real transition = tanh(velSliding / velSlidingScaling / 2);
+    force[0] = -transition * get_friction_coefficient() * force[1];
+    return force;
+}
+
+SimTK::Vec3 StationPlaneContactForces::calcContactForceOnStation(
+        const SimTK::State& s, int index) const
+{
+    const Station& station = get_stations(index);
+    return calcSmoothForce(station.getLocationInGround(s),
+            station.getVelocityInGround(s));
+}
+
+void StationPlaneContactForces::computeForce(const SimTK::State& s,
+        SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+        SimTK::Vector& /*generalizedForces*/) const
+{
+    const int numStations = (int)m_locations.size();
+    if (numStations == 0) return;
+
+    const Ground& ground = getModel().getGround();
+
+    // One kinematics fetch per distinct parent frame serves all of its
+    // stations; the per-station work below is straight-line arithmetic over
+    // the contiguous location array.
+    const int numFrames = (int)m_frames.size();
+    SimTK::Array_<const SimTK::Transform*> X_GF(numFrames);
+    SimTK::Array_<const SimTK::SpatialVec*> V_GF(numFrames);
+    for (int k = 0; k < numFrames; ++k) {
+        X_GF[k] = &m_frames[k]->getTransformInGround(s);
+        V_GF[k] = &m_frames[k]->getVelocityInGround(s);
+    }
+
+    for (int i = 0; i < numStations; ++i) {
+        const int k = m_frameIndex[i];
+        const SimTK::Vec3 r_G = X_GF[k]->R() * m_locations[i];
+        const SimTK::Vec3 pos = X_GF[k]->p() + r_G;
+        const SimTK::Vec3 vel =
+                (*V_GF[k])[1] + SimTK::cross((*V_GF[k])[0], r_G);
+
+        const SimTK::Vec3 force = calcSmoothForce(pos, vel);
+
+        applyForceToPoint(s, *m_frames[k], m_locations[i], force,
+                bodyForces);
+        applyForceToPoint(s, ground, pos, -force, bodyForces);
+    }
+}
+
+OpenSim::Array<std::string> StationPlaneContactForces::getRecordLabels() const
+{
+    OpenSim::Array<std::string> labels;
+    for (int i = 0; i < getProperty_stations().size(); ++i) {
+        const std::string& stationName = get_stations(i).getName();
+        labels.append(getName() + "." + stationName + ".force.X");
+        labels.append(getName() + "." + stationName + ".force.Y");
+        labels.append(getName() + "." + stationName + ".force.Z");
+    }
+    return labels;
+}
+
+OpenSim::Array<double> StationPlaneContactForces::getRecordValues(
+        const SimTK::State& s) const
+{
+    OpenSim::Array<double> values;
+    for (int i = 0; i < getProperty_stations().size(); ++i) {
+        const SimTK::Vec3 force = calcContactForceOnStation(s, i);
+        values.append(force[0]);
+        values.append(force[1]);
+        values.append(force[2]);
+    }
+    return values;
+}
@@ -0,0 +1,129 @@
+#ifndef OPENSIM_STATION_PLANE_CONTACT_FORCES_H_
+#define OPENSIM_STATION_PLANE_CONTACT_FORCES_H_
+/* -------------------------------------------------------------------------- *
+ *                  OpenSim: StationPlaneContactForces.h                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Force.h"
+#include "Station.h"
+
+#include <SimTKcommon/internal/ReferencePtr.h>
+
+#include <vector>
+
+namespace OpenSim {
+
+/** Smooth compliant contact between a set of body-fixed stations and the
+ground plane y=0, evaluated as one batch.
+
+Each station exerts a normal force following the smooth force law of
+Ackermann and van den Bogert (2010) and a tanh-regularized friction force,
+the same model as the per-station Moco component of similar name. Where the
+per-station components pay a connectee lookup, a virtual dispatch, and a
+frame-kinematics fetch for every station at every evaluation, this component
+evaluates all of its stations in a single pass: the spatial kinematics of
+each distinct parent frame are fetched once per evaluation and all station
+positions, velocities, and forces are computed in tight loops over
+contiguous arrays. Predictive gait problems, which evaluate ground contact
+at every mesh point of every iteration, benefit the most.
+
+Stations typically represent the contact points of one foot and may be fixed
+to different frames (e.g., calcaneus and toes). All stations share one set
+of force-law parameters.
+
+Ackermann, M., & van den Bogert, A. J. (2010). Optimality principles for
+model-based prediction of human gait. Journal of Biomechanics, 43(6),
+1055-1060. */
+class OSIMSIMULATION_API StationPlaneContactForces : public Force {
+    OpenSim_DECLARE_CONCRETE_OBJECT(StationPlaneContactForces, Force);
+
+public:
+    //=========================================================================
+    // PROPERTIES
+    //=========================================================================
+    OpenSim_DECLARE_LIST_PROPERTY(stations, Station,
+            "The body-fixed points that can contact the plane.");
+    OpenSim_DECLARE_PROPERTY(stiffness, double,
+            "Spring stiffness in N/m^3 (default: 5e7).");
+    OpenSim_DECLARE_PROPERTY(dissipation, double,
+            "Dissipation coefficient in s/m (default: 1.0).");
+    OpenSim_DECLARE_PROPERTY(friction_coefficient, double,
+            "Friction coefficient (default: 1.0).");
+    OpenSim_DECLARE_PROPERTY(tangent_velocity_scaling_factor, double,
+            "Governs how rapidly friction develops (default: 0.05).");
+
+    //=========================================================================
+    // PUBLIC METHODS
+    //=========================================================================
+    StationPlaneContactForces();
+
+    /** Convenience: append a station fixed to the provided frame at the
+    provided location (expressed in that frame). */
+    void addStation(const PhysicalFrame& frame, const SimTK::Vec3& location);
+
+    /** Number of stations evaluated by this force. */
+    int getNumStations() const { return getProperty_stations().size(); }
+
+    /** Compute the contact force applied at one station, expressed in
+    ground. Provided for reporting; the force applied during a simulation is
+    computed for all stations at once. */
+    SimTK::Vec3 calcContactForceOnStation(const SimTK::State& s,
+            int index) const;
+
+    void computeForce(const SimTK::State& s,
+            SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+            SimTK::Vector& generalizedForces) const override;
+
+    //=========================================================================
+    // REPORTING
+    //=========================================================================
+    /// The column labels are the force components (XYZ) at each station,
+    /// expressed in the ground frame.
+    OpenSim::Array<std::string> getRecordLabels() const override;
+    OpenSim::Array<double> getRecordValues(
+            const SimTK::State& s) const override;
+
+protected:
+    void extendConnectToModel(Model& model) override;
+
+private:
+    void constructProperties();
+
+    /** The fused smooth force law: contact force at a station with the
+    given position and velocity in ground. */
+    SimTK::Vec3 calcSmoothForce(const SimTK::Vec3& pos,
+            const SimTK::Vec3& vel) const;
+
+    // Batched (structure-of-arrays) view of the stations, rebuilt in
+    // extendConnectToModel(): station locations, each station's index into
+    // the list of distinct parent frames, and the frames themselves, so one
+    // kinematics fetch per frame serves all of its stations.
+    std::vector<SimTK::Vec3> m_locations;
+    std::vector<int> m_frameIndex;
+    std::vector<SimTK::ReferencePtr<const PhysicalFrame>> m_frames;
+
+//=============================================================================
+}; // END of class StationPlaneContactForces
+//=============================================================================
+//=============================================================================
+
+} // namespace OpenSim
+
+#endif // OPENSIM_STATION_PLANE_CONTACT_FORCES_H_
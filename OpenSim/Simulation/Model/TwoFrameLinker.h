@@ -259,6 +259,44 @@ protected:
     void addInPhysicalForcesFromInternal(const SimTK::State& state,
         SimTK::Vec6 f, SimTK::Vector_<SimTK::SpatialVec>& spatialForces) const;
 
+    /** Kinematic quantities relating the two linked frames, evaluated once
+        from the State by computeFrameDeflection() and shared between the
+        deflection-dependent force law and the force application. Using this
+        fused path avoids re-walking the frame hierarchy (four transform
+        evaluations per force evaluation) through the individual
+        computeDeflection()/computeDeflectionRate()/
+        addInPhysicalForcesFromInternal() calls, which matters when a model
+        carries many bushings. */
+    struct FrameDeflection {
+        SimTK::Vec6 dq;       ///< deflection; see computeDeflection()
+        SimTK::Vec6 dqdot;    ///< deflection rate; see computeDeflectionRate()
+        SimTK::Rotation R_GF; ///< orientation of frame1 (F) in ground
+        SimTK::Rotation R_GM; ///< orientation of frame2 (M) in ground
+        SimTK::Mat33 N_FM;    ///< Euler-angle rate matrix for the angular dq
+        SimTK::Vec3 p_FM_G;   ///< M's origin w.r.t. F's origin, in ground
+        SimTK::Vec3 p_B1F_G;  ///< F's origin w.r.t. its base body origin, in ground
+        SimTK::Vec3 p_B2M_G;  ///< M's origin w.r.t. its base body origin, in ground
+    };
+
+    /** Evaluate the deflection, deflection rate and the frame kinematics
+        needed to apply the resulting internal force, in a single pass over
+        the two frames' mobilized bodies. Equivalent to computeDeflection()
+        and computeDeflectionRate() but the relative transform and frame
+        velocities are evaluated once. */
+    void computeFrameDeflection(const SimTK::State& s,
+        FrameDeflection& def) const;
+
+    /** Add in the equivalent system spatial forces for an internal force
+        expressed in the deflection basis, reusing the frame kinematics
+        already evaluated by computeFrameDeflection(). Identical in effect to
+        addInPhysicalForcesFromInternal(state, f, spatialForces).
+    @param[in] def              FrameDeflection from computeFrameDeflection()
+    @param[in] f                Vec6 of forces in the basis of the deflection
+    @param[in,out] spatialForces   Vector of SpatialVec's (torque, force) on
+                                   each PhysicalFrame's base frame. */
+    void addInPhysicalForcesFromInternal(const FrameDeflection& def,
+        SimTK::Vec6 f, SimTK::Vector_<SimTK::SpatialVec>& spatialForces) const;
+
 private:
     // create the frames property
     void constructProperties();
@@ -266,6 +304,11 @@ private:
     //hang on to references to the individual frames for fast access
     mutable SimTK::ReferencePtr<const F> _frame1;
     mutable SimTK::ReferencePtr<const F> _frame2;
+    // each frame's fixed transform in its base (mobilized body) frame,
+    // cached at connect time so the fused deflection path need not rediscover
+    // it every evaluation
+    SimTK::Transform _offsetInBase1;
+    SimTK::Transform _offsetInBase2;
 
 //=============================================================================
 }; // END of class OffsetFrame
@@ -424,6 +467,10 @@ void TwoFrameLinker<C, F>::extendConnectToModel(Model& model)
     // now keep a reference to the frames
     _frame1 = &(this->template getSocket<F>("frame1").getConnectee());
     _frame2 = &(this->template getSocket<F>("frame2").getConnectee());
+    // cache each frame's (fixed) transform in its base frame for the fused
+    // deflection path
+    _offsetInBase1 = _frame1->findTransformInBaseFrame();
+    _offsetInBase2 = _frame2->findTransformInBaseFrame();
 }
 
 
@@ -514,6 +561,55 @@ SimTK::Vec6 TwoFrameLinker<C, F>::computeDeflectionRate(const SimTK::State& s) c
     return dqdot;
 }
 
+template <class C, class F>
+void TwoFrameLinker<C, F>::computeFrameDeflection(const SimTK::State& s,
+    FrameDeflection& def) const
+{
+    const F& frame1 = getFrame1();
+    const F& frame2 = getFrame2();
+
+    const SimTK::Transform& X_GB1 = frame1.getMobilizedBody().getBodyTransform(s);
+    const SimTK::Transform& X_GB2 = frame2.getMobilizedBody().getBodyTransform(s);
+
+    // Locate the two frames in Ground by composing the base body transforms
+    // with the offsets cached at connect time.
+    const SimTK::Transform X_GF = X_GB1 * _offsetInBase1;
+    const SimTK::Transform X_GM = X_GB2 * _offsetInBase2;
+    const SimTK::Transform X_FM = ~X_GF * X_GM;
+
+    def.R_GF = X_GF.R();
+    def.R_GM = X_GM.R();
+
+    // Deflection of frame2 (M) in frame1 (F); see computeDeflection().
+    def.dq.updSubVec<3>(0) = X_FM.R().convertRotationToBodyFixedXYZ();
+    def.dq.updSubVec<3>(3) = X_FM.p();
+    def.N_FM =
+        SimTK::Rotation::calcNForBodyXYZInBodyFrame(def.dq.getSubVec<3>(0));
+
+    // Re-express local vectors in the Ground frame.
+    def.p_B1F_G = X_GB1.R() * _offsetInBase1.p();
+    def.p_B2M_G = X_GB2.R() * _offsetInBase2.p();
+    def.p_FM_G  = X_GF.R() * X_FM.p();
+
+    // Now evaluate velocities; see computeRelativeVelocity().
+    const SimTK::SpatialVec& V_GB1 = frame1.getMobilizedBody().getBodyVelocity(s);
+    const SimTK::SpatialVec& V_GB2 = frame2.getMobilizedBody().getBodyVelocity(s);
+
+    const SimTK::SpatialVec V_GF(V_GB1[0], V_GB1[1] + V_GB1[0] % def.p_B1F_G);
+    const SimTK::SpatialVec V_GM(V_GB2[0], V_GB2[1] + V_GB2[0] % def.p_B2M_G);
+
+    // Velocity of M in F with the derivative taken in F; see
+    // computeRelativeVelocity() for the derivation.
+    const SimTK::SpatialVec V_FM_G = V_GM - V_GF;
+    const SimTK::SpatialVec V_FM = ~X_GF.R() *
+        SimTK::SpatialVec(V_FM_G[0], V_FM_G[1] - V_GF[0] % def.p_FM_G);
+
+    // Need angular velocity in M frame for conversion to qdot.
+    const SimTK::Vec3 w_FM_M = ~X_FM.R() * V_FM[0];
+    def.dqdot.updSubVec<3>(0) = def.N_FM * w_FM_M;
+    def.dqdot.updSubVec<3>(3) = V_FM[1];
+}
+
 template <class C, class F>
 void TwoFrameLinker<C, F>::convertInternalForceToForcesOnFrames(
     const SimTK::State& s,
@@ -591,6 +687,30 @@ void TwoFrameLinker<C, F>::addInPhysicalForcesFromInternal(
     physicalForces[frame1.getMobilizedBodyIndex()] += F_GB1;
 }
 
+template <class C, class F>
+void TwoFrameLinker<C, F>::addInPhysicalForcesFromInternal(
+        const FrameDeflection& def,
+        SimTK::Vec6 f, SimTK::Vector_<SimTK::SpatialVec>& physicalForces) const
+{
+    // internal force on body 2
+    const SimTK::Vec3& fB2_q = f.getSubVec<3>(0); // in q basis
+    const SimTK::Vec3& fM_F = f.getSubVec<3>(3); // acts at M, but exp. in F frame
+
+    // moment = ~N*qforce; see convertInternalForceToForcesOnFrames().
+    const SimTK::Vec3 mB2_G = def.R_GM * (~def.N_FM * fB2_q);
+    const SimTK::Vec3 fM_G = def.R_GF * fM_F;
+
+    const SimTK::SpatialVec F_GM(mB2_G, fM_G);
+    const SimTK::SpatialVec F_GF(-(mB2_G + def.p_FM_G % fM_G), -fM_G);
+
+    // Shift forces to body origins and add them to the system set of
+    // body forces.
+    physicalForces[getFrame2().getMobilizedBodyIndex()] +=
+        SimTK::SpatialVec(F_GM[0] + def.p_B2M_G % F_GM[1], F_GM[1]);
+    physicalForces[getFrame1().getMobilizedBodyIndex()] +=
+        SimTK::SpatialVec(F_GF[0] + def.p_B1F_G % F_GF[1], F_GF[1]);
+}
+
 
 template <class C, class F>
 void TwoFrameLinker<C, F>::updateFromXMLNode(SimTK::Xml::Element& aNode, 
@@ -122,13 +122,17 @@ void Umberger2010MuscleMetabolicsProbe::constructProperties()
 void Umberger2010MuscleMetabolicsProbe::extendConnectToModel(Model& aModel)
 {
     Super::extendConnectToModel(aModel);
+    _muscleParameters.clear();
     if (!isEnabled()) return;   // Nothing to connect
 
-    const int nM = 
+    const int nM =
         get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet().getSize();
+    _muscleParameters.reserve(nM);
     for (int i=0; i<nM; ++i) {
-        connectIndividualMetabolicMuscle(aModel, 
-            upd_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i]);
+        Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter& mm =
+            upd_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i];
+        connectIndividualMetabolicMuscle(aModel, mm);
+        _muscleParameters.push_back(&mm);
     }
 }
 
@@ -240,6 +244,24 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
     Vector EdotOutput(getNumProbeInputs());
     EdotOutput = 0;
 
+    // Hoist the loop-invariant property values out of the muscle loop; the
+    // property lookups are not free and this method is called at every
+    // reported time step.
+    const double effortScalingFactor = get_muscle_effort_scaling_factor();
+    const double aerobicFactor = get_aerobic_factor();
+    const bool activationMaintenanceRateOn =
+        get_activation_maintenance_rate_on();
+    const bool shorteningRateOn = get_shortening_rate_on();
+    const bool workRateOn = get_mechanical_work_rate_on();
+    const bool forbidNegativeTotalPower = get_forbid_negative_total_power();
+    const bool includeNegativeMechanicalWork =
+        get_include_negative_mechanical_work();
+    const bool useBhargavaRecruitmentModel =
+        get_use_Bhargava_recruitment_model();
+    const bool enforceMinimumHeatRatePerMuscle =
+        get_enforce_minimum_heat_rate_per_muscle();
+    const bool reportTotalMetabolicsOnly = get_report_total_metabolics_only();
+
 
     // BASAL METABOLIC RATE (W) (based on whole body mass, not muscle mass)
     // so do outside of muscle loop.
@@ -252,31 +274,30 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
             log_warn("{} : Bdot = NaN!", getName());
     }
     EdotOutput(0) += Bdot;       // TOTAL metabolic power storage
-    
-    if (!get_report_total_metabolics_only())
+
+    if (!reportTotalMetabolicsOnly)
         EdotOutput(1) = Bdot;    // BASAL metabolic power storage
-    
 
-    // Loop through each muscle in the MetabolicMuscleParameterSet
-    const int nM = 
-        get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
-        .getSize();
+
+    // Loop through each muscle using the flat parameter list cached on
+    // connect; this avoids a MetabolicMuscleParameterSet lookup per muscle.
+    const int nM = (int)_muscleParameters.size();
     for (int i=0; i<nM; ++i)
     {
-        // Get the current muscle parameters from the MetabolicMuscleParameterSet
-        // and the corresponding OpenSim::Muscle pointer from the muscleMap.
-        Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter& mm = 
-            get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i];
+        // Get the current muscle parameters and the corresponding
+        // OpenSim::Muscle pointer (both resolved in extendConnectToModel()).
+        Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter& mm =
+            *_muscleParameters[i];
         const Muscle* m = mm.getMuscle();
 
         // Get some muscle properties at the current time state
         //const double max_isometric_force = m->getMaxIsometricForce();
         const double max_shortening_velocity = m->getMaxContractionVelocity();
-        const double activation = get_muscle_effort_scaling_factor()
+        const double activation = effortScalingFactor
                                   * m->getActivation(s);
-        const double excitation = get_muscle_effort_scaling_factor()
+        const double excitation = effortScalingFactor
                                   * m->getControl(s);
-        double fiber_force_active = get_muscle_effort_scaling_factor()
+        double fiber_force_active = effortScalingFactor
                                     * m->getActiveFiberForce(s);
         const double fiber_length_normalized = m->getNormalizedFiberLength(s);
         const double fiber_velocity = m->getFiberVelocity(s);
@@ -318,22 +339,22 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
         // --> depends on the normalized fiber length of the contractile element
         // -----------------------------------------------------------------------
         double slowTwitchRatio = mm.get_ratio_slow_twitch_fibers();
-        if (get_use_Bhargava_recruitment_model()) {
+        if (useBhargavaRecruitmentModel) {
             const double uSlow = slowTwitchRatio * sin(0.5*Pi * excitation);
             const double uFast = (1 - slowTwitchRatio)
                                  * (1 - cos(0.5*Pi * excitation));
             slowTwitchRatio = (excitation == 0) ? 1.0 : uSlow / (uSlow + uFast);
         }
 
-        if (get_forbid_negative_total_power() ||
-            get_activation_maintenance_rate_on())
+        if (forbidNegativeTotalPower ||
+            activationMaintenanceRateOn)
         {
             const double unscaledAMdot = 128*(1 - slowTwitchRatio) + 25;
 
             if (fiber_length_normalized <= 1.0)
-                AMdot = get_aerobic_factor() * std::pow(A, 0.6) * unscaledAMdot;
+                AMdot = aerobicFactor * std::pow(A, 0.6) * unscaledAMdot;
             else
-                AMdot = get_aerobic_factor() * std::pow(A, 0.6) * ((0.4 * unscaledAMdot) + (0.6 * unscaledAMdot * F_iso));
+                AMdot = aerobicFactor * std::pow(A, 0.6) * ((0.4 * unscaledAMdot) + (0.6 * unscaledAMdot * F_iso));
         }
 
 
@@ -342,7 +363,7 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
         // --> depends on the normalized fiber length of the contractile element
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening
         // -----------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_shortening_rate_on())
+        if (forbidNegativeTotalPower || shorteningRateOn)
         {
             const double Vmax_fasttwitch = max_shortening_velocity;
             const double Vmax_slowtwitch = max_shortening_velocity / 2.5;
@@ -366,15 +387,15 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
 
                 tmp_fastTwitch = alpha_shortening_fasttwitch * fiber_velocity_normalized * (1-slowTwitchRatio);
                 unscaledSdot = (tmp_slowTwitch * slowTwitchRatio) - tmp_fastTwitch;   // unscaled shortening heat rate: muscle shortening
-                Sdot = get_aerobic_factor() * std::pow(A, 2.0) * unscaledSdot;                      // scaled shortening heat rate: muscle shortening
+                Sdot = aerobicFactor * std::pow(A, 2.0) * unscaledSdot;                      // scaled shortening heat rate: muscle shortening
             }
 
             else    // eccentric contraction, Vm>0
             {
                 unscaledSdot =
-                    (get_include_negative_mechanical_work() ? 4.0 : 0.3)
+                    (includeNegativeMechanicalWork ? 4.0 : 0.3)
                     * alpha_shortening_slowtwitch * fiber_velocity_normalized;  // unscaled shortening heat rate: muscle lengthening
-                Sdot = get_aerobic_factor() * A * unscaledSdot;                                // scaled shortening heat rate: muscle lengthening
+                Sdot = aerobicFactor * A * unscaledSdot;                                // scaled shortening heat rate: muscle lengthening
             }
 
 
@@ -396,9 +417,9 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
         // MECHANICAL WORK RATE for the contractile element of muscle i (W/kg).
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening.
         // -------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_mechanical_work_rate_on())
+        if (forbidNegativeTotalPower || workRateOn)
         {
-            if (get_include_negative_mechanical_work() || fiber_velocity <= 0)
+            if (includeNegativeMechanicalWork || fiber_velocity <= 0)
                 Wdot = -fiber_force_active*fiber_velocity;
             else
                 Wdot = 0;
@@ -409,7 +430,7 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
 
         // If necessary, increase the shortening heat rate so that the total
         // power is non-negative.
-        if (get_forbid_negative_total_power()) {
+        if (forbidNegativeTotalPower) {
             const double Edot_Wkg_beforeClamp = AMdot + Sdot + Wdot;
             if (Edot_Wkg_beforeClamp < 0)
                 Sdot -= Edot_Wkg_beforeClamp;
@@ -430,9 +451,9 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
         // -----------------------------------------------------------------------
         double totalHeatRate = AMdot + Sdot;
 
-        if(get_enforce_minimum_heat_rate_per_muscle() && totalHeatRate < 1.0 
-            && get_activation_maintenance_rate_on() 
-            && get_shortening_rate_on()) {
+        if(enforceMinimumHeatRatePerMuscle && totalHeatRate < 1.0
+            && activationMaintenanceRateOn
+            && shorteningRateOn) {
                 //cout << "WARNING: " << getName() 
                 //    << "  (t = " << s.getTime() 
                 //    << "), the muscle '" << mm.getName() 
@@ -446,20 +467,20 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
         // ------------------------------------------
         double Edot = 0;
 
-        if (get_activation_maintenance_rate_on() && get_shortening_rate_on())
+        if (activationMaintenanceRateOn && shorteningRateOn)
             Edot += totalHeatRate;      // May have been clamped to 1.0 W/kg.
         else {
-            if (get_activation_maintenance_rate_on())
+            if (activationMaintenanceRateOn)
                 Edot += AMdot;
-            if (get_shortening_rate_on())
+            if (shorteningRateOn)
                 Edot += Sdot;
         }
-        if (get_mechanical_work_rate_on())
+        if (workRateOn)
             Edot += Wdot;
         Edot *= mm.getMuscleMass();
 
         EdotOutput(0) += Edot;       // Add to TOTAL metabolic power storage
-        if (!get_report_total_metabolics_only()) {
+        if (!reportTotalMetabolicsOnly) {
             // Metabolic power storage for muscle i
             EdotOutput(i+2) = Edot;  
         }                          
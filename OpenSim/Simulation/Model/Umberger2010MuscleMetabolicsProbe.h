@@ -27,6 +27,8 @@
 #include "Probe.h"
 #include <OpenSim/Common/Set.h>
 
+#include <vector>
+
 namespace OpenSim {
 
 class Model;
@@ -425,6 +427,13 @@ private:
     //--------------------------------------------------------------------------
     MuscleMap _muscleMap;
 
+    // Flat list of the metabolic muscle parameters, in
+    // MetabolicMuscleParameterSet order, rebuilt on connect so that
+    // computeProbeInputs() can evaluate every muscle in one loop without
+    // repeated set lookups.
+    std::vector<Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter*>
+        _muscleParameters;
+
     //--------------------------------------------------------------------------
     // ModelComponent Interface
     //--------------------------------------------------------------------------
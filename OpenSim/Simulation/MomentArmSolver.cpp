@@ -132,7 +132,89 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     return ~_coupling*_generalizedForces;
 }
 
-SimTK::Vector MomentArmSolver::computeCouplingVector(SimTK::State &state, 
+SimTK::Vector MomentArmSolver::solveMomentArms(const State &state,
+                                               const GeometryPath &path) const
+{
+    std::vector<const GeometryPath*> paths(1, &path);
+    const Matrix momentArms = solveMomentArms(state, paths);
+    return ~momentArms.row(0);
+}
+
+SimTK::Matrix MomentArmSolver::solveMomentArms(const State &state,
+        const std::vector<const GeometryPath*> &paths) const
+{
+    //Local modifiable copy of the state
+    State& s_ma = _stateCopy;
+    s_ma.updQ() = state.getQ();
+
+    const CoordinateSet& coordinates = getModel().getCoordinateSet();
+    const int nCoords = coordinates.getSize();
+    const int nPaths = (int)paths.size();
+
+    // compute the coupling between coordinates due to constraints; each
+    // coordinate's coupling vector depends only on the pose, so compute it
+    // once here and share it across all of the paths. Restore a coordinate's
+    // lock afterwards so that every coupling vector is computed with only its
+    // own coordinate unlocked, just as with a single-coordinate solve().
+    std::vector<Vector> couplings(nCoords);
+    for (int j = 0; j < nCoords; ++j) {
+        const Coordinate& coordinate = coordinates[j];
+        const bool wasLocked = coordinate.getLocked(s_ma);
+        couplings[j] = computeCouplingVector(s_ma, coordinate);
+        if (wasLocked)
+            coordinate.setLocked(s_ma, true);
+    }
+
+    // set speeds to zero
+    s_ma.updU() = 0;
+
+    Matrix momentArms(nPaths, nCoords);
+    Vector pathDependentMobilityForces(s_ma.getNU(), 0.0);
+    for (int i = 0; i < nPaths; ++i) {
+        // zero out all the forces
+        _bodyForces *= 0;
+        _generalizedForces = 0;
+        pathDependentMobilityForces = 0.0;
+
+        // apply a tension of unity to the bodies of the path
+        paths[i]->addInEquivalentForces(s_ma, 1.0, _bodyForces,
+            pathDependentMobilityForces);
+
+        // Convert body spatial forces F to equivalent mobility forces f based
+        // on geometry (no dynamics required): f = ~J(q) * F.
+        getModel().getMultibodySystem().getMatterSubsystem()
+            .multiplyBySystemJacobianTranspose(s_ma, _bodyForces,
+                _generalizedForces);
+
+        _generalizedForces += pathDependentMobilityForces;
+
+        // Each moment arm is the effective torque (since tension is 1) at the
+        // coordinate of interest taking into account the generalized forces
+        // also acting on other coordinates that are coupled via constraint.
+        for (int j = 0; j < nCoords; ++j)
+            momentArms(i, j) = ~couplings[j] * _generalizedForces;
+    }
+
+    return momentArms;
+}
+
+const SimTK::Matrix& MomentArmSolver::solveMomentArmsCached(const State &state,
+        const std::vector<const GeometryPath*> &paths) const
+{
+    const Vector& q = state.getQ();
+    const bool upToDate = _cachedQ.size() == q.size() &&
+        (_cachedQ - q).normInf() == 0 && _cachedPaths == paths;
+
+    if (!upToDate) {
+        _cachedMomentArms = solveMomentArms(state, paths);
+        _cachedQ = q;
+        _cachedPaths = paths;
+    }
+
+    return _cachedMomentArms;
+}
+
+SimTK::Vector MomentArmSolver::computeCouplingVector(SimTK::State &state,
         const Coordinate &coordinate) const
 {
     // make sure copy of the state is realized to at least instance
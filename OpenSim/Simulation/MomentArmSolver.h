@@ -25,6 +25,7 @@
 
 #include "Solver.h"
 #include "SimTKcommon/internal/State.h"
+#include <vector>
 
 namespace OpenSim {
 
@@ -80,9 +81,49 @@ public:
     @param  pfds                PointForceDirections applied to the model
     @return ma                  resulting moment-arm as a double
     */
-    double solve(const SimTK::State& state, const Coordinate &coordinate, 
+    double solve(const SimTK::State& state, const Coordinate &coordinate,
         const Array<PointForceDirection *> &pfds) const;
 
+    /** Solve for the effective moment arms of one GeometryPath about every
+        coordinate of the model in a single sweep. The generalized forces
+        equivalent to a unit tension along the path are computed once and
+        reused for every coordinate, instead of once per coordinate as with
+        repeated calls to solve().
+    @param  state               current state of the model
+    @param  path                GeometryPath for which to calculate moment arms
+    @return row                 moment arms ordered as the model's CoordinateSet
+    */
+    SimTK::Vector solveMomentArms(const SimTK::State& state,
+        const GeometryPath& path) const;
+
+    /** Solve for the effective moment arms of several GeometryPaths about
+        every coordinate of the model in a single sweep. The constraint
+        coupling vector of each coordinate depends only on the pose, so it is
+        computed once and shared across all of the paths, and each path's
+        equivalent generalized forces are computed once and reused for every
+        coordinate.
+    @param  state               current state of the model
+    @param  paths               GeometryPaths for which to calculate moment arms
+    @return matrix              moment arms with one row per path and columns
+                                ordered as the model's CoordinateSet
+    */
+    SimTK::Matrix solveMomentArms(const SimTK::State& state,
+        const std::vector<const GeometryPath*>& paths) const;
+
+    /** Same as above, but serve the moment-arm matrix from a cache keyed on
+        the generalized coordinates (q) of the supplied state. A repeated
+        request for the same list of paths at an identical pose returns the
+        cached matrix, so consumers that need moment arms at the same state
+        (e.g. analyses run together over a trial) share one computation. Any
+        change to q or to the list of paths triggers a fresh solve.
+    @param  state               current state of the model
+    @param  paths               GeometryPaths for which to calculate moment arms
+    @return matrix              moment arms with one row per path and columns
+                                ordered as the model's CoordinateSet
+    */
+    const SimTK::Matrix& solveMomentArmsCached(const SimTK::State& state,
+        const std::vector<const GeometryPath*>& paths) const;
+
 private:
     // Internal state of the solver initialized as a copy of the default state
     mutable SimTK::State _stateCopy;
@@ -96,6 +137,12 @@ private:
     // Keep preallocated vector of the coupling constraint factors
     mutable SimTK::Vector _coupling;
 
+    // Cache for solveMomentArmsCached(): the generalized coordinates and
+    // list of paths of the last solve and the resulting moment-arm matrix.
+    mutable SimTK::Vector _cachedQ;
+    mutable std::vector<const GeometryPath*> _cachedPaths;
+    mutable SimTK::Matrix _cachedMomentArms;
+
     // compute vector of constraint coupling factors
     SimTK::Vector computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const;
@@ -71,19 +71,34 @@ public:
     SimTK::Transform calcTransformInGround(const SimTK::State& s) const {
         return get_frame().getTransformInGround(s);
     }
+    /// The rotation of this IMU in the Ground frame, computed once per
+    /// state and cached so that every signal synthesized or reported from
+    /// this IMU (orientation, gyroscope, accelerometer, tracking-error
+    /// queries) shares one set of frame computations instead of each
+    /// re-deriving the pose.
+    /// @note Requires realizing the State to SimTK::Stage::Position.
+    const SimTK::Rotation& getRotationInGround(const SimTK::State& s) const {
+        if (isCacheVariableValid(s, _rotationInGroundCV)) {
+            return getCacheVariableValue(s, _rotationInGroundCV);
+        }
+        SimTK::Rotation& rotation =
+                updCacheVariableValue(s, _rotationInGroundCV);
+        rotation = get_frame().getTransformInGround(s).R();
+        markCacheVariableValid(s, _rotationInGroundCV);
+        return rotation;
+    }
     /// Report the orientation of this IMU in ground frame expressed as a
     /// Quaternion.
     /// @note Requires realizing the State to SimTK::Stage::Position.
     SimTK::Quaternion calcOrientationAsQuaternion(const SimTK::State& s) const {
-        return SimTK::Quaternion(calcTransformInGround(s).R());
+        return SimTK::Quaternion(getRotationInGround(s));
     }
     /// Report the angular velocity of this IMU in the frame it is attached to.
     /// @note Requires realizing the State to SimTK::Stage::Velocity.
     SimTK::Vec3 calcGyroscopeSignal(const SimTK::State& s) const {
-        const auto& model = getModel();
-        const auto& ground = model.getGround();
-        return ground.expressVectorInAnotherFrame(s,
-            get_frame().getAngularVelocityInGround(s), get_frame());
+        // re-express the ground-frame vector using the cached rotation
+        return ~getRotationInGround(s) *
+               get_frame().getAngularVelocityInGround(s);
     }
     /// Report the linear acceleration of the frame to which this IMU is
     /// attached in the Ground grame. Gravity is subtracted and result expressed
@@ -91,13 +106,9 @@ public:
     /// @note Requires realizing the State to SimTK::Stage::Acceleration.
     SimTK::Vec3 calcAccelerometerSignal(
             const SimTK::State& s) const {
-        const auto& model = getModel();
-        const auto& ground = model.getGround();
-        const auto& gravity = model.getGravity();
-        SimTK::Vec3 linearAcceleration =
-                get_frame().getLinearAccelerationInGround(s);
-        return ground.expressVectorInAnotherFrame(
-                s, linearAcceleration - gravity, get_frame());
+        const auto& gravity = getModel().getGravity();
+        return ~getRotationInGround(s) *
+               (get_frame().getLinearAccelerationInGround(s) - gravity);
     }
     void generateDecorations(bool fixed, const ModelDisplayHints& hints,
         const SimTK::State& state,
@@ -115,11 +126,22 @@ public:
                         .setTransform(relativeXform));
     }
 
+protected:
+    /** Allocate the per-state cache for the ground-frame rotation shared
+    by the signal outputs; see getRotationInGround(). */
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override {
+        Super::extendAddToSystem(system);
+        this->_rotationInGroundCV = addCacheVariable("rotation_in_ground",
+                SimTK::Rotation(), SimTK::Stage::Position);
+    }
+
 private:
- 
+
     const PhysicalFrame& get_frame() const {
         return getSocket<PhysicalFrame>("frame").getConnectee();
     }
+
+    mutable CacheVariable<SimTK::Rotation> _rotationInGroundCV;
 }; // End of class IMU
 
 }
@@ -32,6 +32,9 @@
 #include <OpenSim/Simulation/MarkersReference.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace std;
 using namespace OpenSim;
 using SimTK::Vec3;
@@ -84,14 +87,96 @@ void IMUPlacer::constructProperties() {
  */
 bool IMUPlacer::run(bool visualizeResults) {
 
+    TimeSeriesTable_<SimTK::Quaternion> quatTable(
+            get_orientation_file_for_calibration());
+    return calibrateFromQuaternionTable(quatTable, visualizeResults);
+}
+
+void IMUPlacer::startLiveCalibration(
+        const std::vector<std::string>& imuLabels) {
+    OPENSIM_THROW_IF(imuLabels.empty(), Exception,
+            "IMUPlacer::startLiveCalibration() requires at least one IMU "
+            "label.");
+    _liveLabels = imuLabels;
+    _quaternionSums.assign(imuLabels.size(), SimTK::Vec4(0));
+    _meanQuaternions.assign(imuLabels.size(), SimTK::Quaternion());
+    _framesAccepted = 0;
+    _framesRejected = 0;
+}
+
+bool IMUPlacer::addCalibrationFrame(
+        const SimTK::Quaternion_<double>* quaternions) {
+    OPENSIM_THROW_IF(_liveLabels.empty(), Exception,
+            "IMUPlacer::addCalibrationFrame() called before "
+            "startLiveCalibration().");
+    const int n = int(_liveLabels.size());
+
+    // Reject the whole frame if any sensor strays too far from its running
+    // mean, once enough frames have seeded the mean. The angle between
+    // orientations q and m is 2*acos(|q.m|).
+    const long long minFramesToSeed = 5;
+    if (_framesAccepted >= minFramesToSeed) {
+        for (int i = 0; i < n; ++i) {
+            double cosHalfAngle = 0;
+            for (int k = 0; k < 4; ++k)
+                cosHalfAngle += quaternions[i][k] * _meanQuaternions[i][k];
+            cosHalfAngle = std::min(std::abs(cosHalfAngle), 1.0);
+            if (2 * std::acos(cosHalfAngle) > _outlierThreshold) {
+                ++_framesRejected;
+                return false;
+            }
+        }
+    }
+
+    for (int i = 0; i < n; ++i) {
+        // Flip to the accumulated hemisphere (q and -q are the same
+        // rotation) so the running sum does not cancel.
+        SimTK::Vec4 q = quaternions[i].asVec4();
+        if (SimTK::dot(q, _quaternionSums[i]) < 0) q = -q;
+        _quaternionSums[i] += q;
+        _meanQuaternions[i] = SimTK::Quaternion(_quaternionSums[i][0],
+                _quaternionSums[i][1], _quaternionSums[i][2],
+                _quaternionSums[i][3]);
+    }
+    ++_framesAccepted;
+    return true;
+}
+
+bool IMUPlacer::finishLiveCalibration(bool visualizeResults) {
+    OPENSIM_THROW_IF(_framesAccepted < 1, Exception,
+            "IMUPlacer::finishLiveCalibration() called with no accepted "
+            "calibration frames.");
+    log_info("IMUPlacer: live calibration averaged {} frames ({} rejected "
+             "as outliers).",
+            _framesAccepted, _framesRejected);
+
+    // One averaged frame drives the same placement path as a static-trial
+    // file; no file round-trip is involved.
+    TimeSeriesTable_<SimTK::Quaternion> quatTable;
+    quatTable.setColumnLabels(_liveLabels);
+    SimTK::RowVector_<SimTK::Quaternion> row(int(_liveLabels.size()));
+    for (int i = 0; i < int(_liveLabels.size()); ++i)
+        row[i] = _meanQuaternions[i];
+    quatTable.appendRow(0.0, row);
+
+    // Clear the accumulator so a later re-calibration starts fresh.
+    _liveLabels.clear();
+    _quaternionSums.clear();
+    _meanQuaternions.clear();
+
+    return calibrateFromQuaternionTable(quatTable, visualizeResults);
+}
+
+bool IMUPlacer::calibrateFromQuaternionTable(
+        TimeSeriesTable_<SimTK::Quaternion>& quatTable,
+        bool visualizeResults) {
+
     _calibrated = false;
     // Check there's a model file specified before trying to open it
     if (_model.empty() && get_model_file().size() == 0) {
         OPENSIM_THROW(Exception, "No model or model_file was specified for IMUPlacer.");
     }
     if (_model.empty()) { _model.reset(new Model(get_model_file())); }
-    TimeSeriesTable_<SimTK::Quaternion> quatTable(
-            get_orientation_file_for_calibration());
 
     const SimTK::Vec3& sensor_to_opensim_rotations =
             get_sensor_to_opensim_rotations();
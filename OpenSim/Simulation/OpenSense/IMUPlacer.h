@@ -23,8 +23,13 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 #include <OpenSim/Common/Object.h>
+#include <OpenSim/Common/TimeSeriesTable.h>
 #include <OpenSim/Simulation/osimSimulationDLL.h>
 #include <Simbody.h>
+
+#include <string>
+#include <vector>
+
 namespace OpenSim {
 
 class Model;
@@ -87,17 +92,80 @@ public:
      */
     bool run(bool visualizeResults = false) SWIG_DECLARE_EXCEPTION;
     void setModel(Model& aModel) { _model = &aModel; };
-    /** Retrieve the calibrated model. This method will throw if called before 
+    /** Retrieve the calibrated model. This method will throw if called before
     the run method is invoked.
     */
     Model& getCalibratedModel() const;
 
+    /** @name Online calibration from a live stream
+    Instead of exporting a static trial to file and invoking run(), a live
+    session can calibrate (and mid-session re-calibrate) directly from
+    streamed quaternion frames: call startLiveCalibration() with the sensor
+    labels, feed frames from the acquisition thread with
+    addCalibrationFrame() while the subject holds the calibration pose for
+    a few seconds, then call finishLiveCalibration(). Frames are
+    accumulated into an incremental (sign-aligned) quaternion average, and
+    once the average is seeded any frame in which a sensor deviates from
+    its running mean by more than the outlier threshold is rejected, so a
+    brief wobble does not corrupt the pose. finishLiveCalibration()
+    applies the sensor-to-OpenSim and heading corrections and places the
+    IMU frames exactly as run() does, updating offsets that already exist
+    from an earlier calibration. No file round-trip is involved. */
+    /// @{
+    /** Begin (or restart) accumulating streamed calibration frames for the
+    named sensors; labels must be formatted as (bodyname)_imu, in the order
+    frames will supply them. Any previously accumulated frames are
+    discarded. */
+    void startLiveCalibration(const std::vector<std::string>& imuLabels);
+    /** Accumulate one streamed frame: quaternions must point at one
+    orientation per label passed to startLiveCalibration(), in that order.
+    Returns false if the frame was rejected as an outlier. */
+    bool addCalibrationFrame(const SimTK::Quaternion_<double>* quaternions);
+    /** Place the IMU frames from the accumulated average and clear the
+    accumulator. Throws if no frames were accepted. */
+    bool finishLiveCalibration(bool visualizeResults = false);
+    /** Largest angular deviation (radians) of a sensor from its running
+    mean before the whole frame is rejected; default 0.35 (about 20
+    degrees). */
+    void setCalibrationOutlierThreshold(double radians) {
+        _outlierThreshold = radians;
+    }
+    double getCalibrationOutlierThreshold() const {
+        return _outlierThreshold;
+    }
+    /** Counts of frames accepted into, and rejected from, the running
+    average since startLiveCalibration(). */
+    long long getNumCalibrationFramesAccepted() const {
+        return _framesAccepted;
+    }
+    long long getNumCalibrationFramesRejected() const {
+        return _framesRejected;
+    }
+    /// @}
+
 private:
     void constructProperties();
+    /** Shared placement path: applies the sensor-to-OpenSim and heading
+    corrections to the passed-in quaternions and registers the IMU frames
+    on the model. run() feeds it the calibration file;
+    finishLiveCalibration() feeds it the accumulated average. */
+    bool calibrateFromQuaternionTable(
+            TimeSeriesTable_<SimTK::Quaternion_<double>>& quatTable,
+            bool visualizeResults);
     /** Pointer to the model being _calibrated. */
     SimTK::ReferencePtr<Model> _model;
     /** Flag indicating if Calibration run has been invoked already */
     bool _calibrated;
+
+    // Live calibration accumulator (startLiveCalibration()). Quaternion
+    // sums are kept sign-aligned to their running means so averaging is
+    // well defined for the small deviations of a held pose.
+    std::vector<std::string> _liveLabels;
+    std::vector<SimTK::Vec4> _quaternionSums;
+    std::vector<SimTK::Quaternion> _meanQuaternions;
+    double _outlierThreshold{0.35};
+    long long _framesAccepted{0};
+    long long _framesRejected{0};
 };  // END of class IMUPlacer
 //=============================================================================
 //=============================================================================
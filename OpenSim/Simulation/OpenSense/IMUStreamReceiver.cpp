@@ -0,0 +1,193 @@
+/* -------------------------------------------------------------------------- *
+ *                         IMUStreamReceiver.cpp                              *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include "IMUStreamReceiver.h"
+
+#include <OpenSim/Common/Exception.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <sys/time.h>
+    #include <unistd.h>
+#endif
+
+using namespace SimTK;
+
+namespace {
+// Platform-neutral socket helpers; the handle travels as long long so the
+// header does not need platform socket types.
+#ifdef _WIN32
+using RawSocket = SOCKET;
+void initializeSockets() {
+    static const bool initialized = []() {
+        WSADATA wsaData;
+        WSAStartup(MAKEWORD(2, 2), &wsaData);
+        return true;
+    }();
+    (void)initialized;
+}
+void closeSocket(long long handle) { ::closesocket((RawSocket)handle); }
+#else
+using RawSocket = int;
+void initializeSockets() {}
+void closeSocket(long long handle) { ::close((RawSocket)handle); }
+#endif
+
+// Make blocking receives wake up periodically so the receive thread stays
+// responsive to stop().
+void setReceiveTimeout(long long handle, int milliseconds) {
+#ifdef _WIN32
+    DWORD timeout = (DWORD)milliseconds;
+    ::setsockopt((RawSocket)handle, SOL_SOCKET, SO_RCVTIMEO,
+            (const char*)&timeout, sizeof(timeout));
+#else
+    struct timeval timeout;
+    timeout.tv_sec = milliseconds / 1000;
+    timeout.tv_usec = (milliseconds % 1000) * 1000;
+    ::setsockopt((RawSocket)handle, SOL_SOCKET, SO_RCVTIMEO,
+            &timeout, sizeof(timeout));
+#endif
+}
+} // namespace
+
+namespace OpenSim {
+
+IMUStreamReceiver::IMUStreamReceiver(
+        std::shared_ptr<BufferedOrientationsReference> orientationsRef)
+        : _orientationsRef(std::move(orientationsRef)) {
+    OPENSIM_THROW_IF(!_orientationsRef, Exception,
+            "IMUStreamReceiver requires a BufferedOrientationsReference.");
+    _numSensors = _orientationsRef->getNumRefs();
+    OPENSIM_THROW_IF(_numSensors < 1, Exception,
+            "IMUStreamReceiver: the BufferedOrientationsReference names no "
+            "sensors.");
+    _rotationRow.resize(_numSensors);
+}
+
+IMUStreamReceiver::~IMUStreamReceiver() { stop(); }
+
+void IMUStreamReceiver::setSmoothingTimeConstant(double smoothingTimeConstant) {
+    if (smoothingTimeConstant <= 0) {
+        _filter.reset();
+        return;
+    }
+    _filter.reset(
+            new OrientationStreamFilter(_numSensors, smoothingTimeConstant));
+    _filterScratch.resize(_numSensors);
+}
+
+void IMUStreamReceiver::pushFrame(
+        double timestamp, const SimTK::Quaternion_<double>* quaternions) {
+    if (_filter) {
+        // Filter a copy; the caller's frame stays untouched.
+        std::copy(quaternions, quaternions + _numSensors,
+                _filterScratch.begin());
+        _filter->filterFrame(timestamp, _filterScratch.data());
+        quaternions = _filterScratch.data();
+    }
+    for (int i = 0; i < _numSensors; ++i)
+        _rotationRow[i] = _sensorToOpenSim * Rotation(quaternions[i]);
+    if (!_haveFirstFrame) {
+        _timeOffset = SimTK::isNaN(_alignFirstFrameTo)
+                              ? 0
+                              : _alignFirstFrameTo - timestamp;
+        _haveFirstFrame = true;
+    }
+    _orientationsRef->putValues(timestamp + _timeOffset, _rotationRow);
+    ++_numFramesReceived;
+}
+
+void IMUStreamReceiver::startUDP(int port) {
+    OPENSIM_THROW_IF(isRunning(), Exception,
+            "IMUStreamReceiver::startUDP(): a receiver is already running.");
+
+    initializeSockets();
+    const long long sock = (long long)::socket(AF_INET, SOCK_DGRAM, 0);
+    OPENSIM_THROW_IF(sock < 0, Exception,
+            "IMUStreamReceiver::startUDP(): could not create a UDP socket.");
+
+    struct sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((unsigned short)port);
+    if (::bind((RawSocket)sock, (const struct sockaddr*)&address,
+                sizeof(address)) < 0) {
+        closeSocket(sock);
+        OPENSIM_THROW(Exception,
+                "IMUStreamReceiver::startUDP(): could not bind UDP port " +
+                        std::to_string(port) + ".");
+    }
+    setReceiveTimeout(sock, 100);
+
+    _socket = sock;
+    _stopRequested = false;
+    _orientationsRef->setFinished(false);
+    _receiveThread = std::thread(&IMUStreamReceiver::receiveLoop, this);
+}
+
+void IMUStreamReceiver::receiveLoop() {
+    // One datagram per frame: timestamp then 4 quaternion elements per
+    // sensor, all host-byte-order doubles.
+    const size_t expectedBytes = sizeof(double) * (1 + 4 * _numSensors);
+    std::vector<double> frame(1 + 4 * _numSensors);
+    std::vector<SimTK::Quaternion> quaternions(_numSensors);
+
+    while (!_stopRequested) {
+        const auto received = ::recv((RawSocket)_socket,
+                reinterpret_cast<char*>(frame.data()), (int)expectedBytes, 0);
+        if (received < 0) continue; // timeout; re-check _stopRequested
+        if ((size_t)received != expectedBytes) {
+            ++_numMalformedDatagrams;
+            continue;
+        }
+        for (int i = 0; i < _numSensors; ++i) {
+            // The Quaternion constructor normalizes, absorbing wire
+            // rounding.
+            quaternions[i] = SimTK::Quaternion(frame[1 + 4 * i],
+                    frame[2 + 4 * i], frame[3 + 4 * i], frame[4 + 4 * i]);
+        }
+        pushFrame(frame[0], quaternions.data());
+    }
+}
+
+void IMUStreamReceiver::stop() {
+    if (_receiveThread.joinable()) {
+        _stopRequested = true;
+        _receiveThread.join();
+    }
+    if (_socket >= 0) {
+        closeSocket(_socket);
+        _socket = -1;
+    }
+    _orientationsRef->setFinished(true);
+}
+
+} // end of namespace OpenSim
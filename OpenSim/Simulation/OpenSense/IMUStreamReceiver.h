@@ -0,0 +1,169 @@
+#ifndef OPENSIM_IMU_STREAM_RECEIVER_H_
+#define OPENSIM_IMU_STREAM_RECEIVER_H_
+/* -------------------------------------------------------------------------- *
+ *                          IMUStreamReceiver.h                               *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <OpenSim/Simulation/BufferedOrientationsReference.h>
+#include "OrientationStreamFilter.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * Ingestion adapter that feeds live IMU quaternion frames into a
+ * BufferedOrientationsReference, forming the acquisition end of the
+ * real-time orientation-tracking pipeline:
+ *
+ *     sensors -> IMUStreamReceiver -> BufferedOrientationsReference
+ *             -> InverseKinematicsSolver (setAdvanceTimeFromReference(true))
+ *
+ * Frames enter either in-process, by calling pushFrame() from the
+ * acquisition thread (e.g. a vendor SDK callback or a shared-memory
+ * reader), or over the network, by calling startUDP() to spawn a thread
+ * that receives one frame per UDP datagram. Either way, each frame's
+ * quaternions are converted to Rotations in a preallocated row (applying
+ * the sensor-to-OpenSim rotation) and pushed straight into the reference's
+ * DataQueue; no TimeSeriesTable is ever built. With the reference's
+ * lock-free ring buffer enabled (setQueueRingBufferSize()) the path from
+ * acquisition to solver performs no allocation and takes no lock.
+ *
+ * The UDP wire format is one datagram per frame containing host-byte-order
+ * IEEE doubles: the frame timestamp followed by (q0, qx, qy, qz) for each
+ * sensor, in the order of the reference's sensor names, for a payload of
+ * 8*(1 + 4*numSensors) bytes. Datagrams of any other size are dropped and
+ * counted (getNumMalformedDatagrams()). Quaternions are normalized on
+ * receipt so wire rounding does not produce invalid rotations.
+ *
+ * Sensor clocks rarely match the solve clock; setTimeAlignment() maps the
+ * timestamp of the first received frame to a chosen solve time and shifts
+ * all subsequent frames by the same offset, so a stream stamped with, say,
+ * epoch seconds arrives at the solver starting from t=0.
+ *
+ * The queue is single-producer: push frames from exactly one thread, and
+ * do not mix pushFrame() with a running UDP receiver. Call stop() (also
+ * performed by the destructor) to end the stream; it marks the reference
+ * finished so a consumer loop draining with getNextValuesAndTime() or
+ * hasNext()/hasQueuedData() terminates cleanly.
+ */
+class OSIMSIMULATION_API IMUStreamReceiver {
+public:
+    /** The receiver pushes into the passed-in reference, which defines the
+    number and order of sensors; typically a live reference constructed from
+    sensor names. Enable its ring buffer before streaming begins. */
+    explicit IMUStreamReceiver(
+            std::shared_ptr<BufferedOrientationsReference> orientationsRef);
+    /** Stops any receive thread and marks the stream finished. */
+    ~IMUStreamReceiver();
+
+    // The receiver owns a thread and a socket; copying is not meaningful.
+    IMUStreamReceiver(const IMUStreamReceiver&) = delete;
+    IMUStreamReceiver& operator=(const IMUStreamReceiver&) = delete;
+
+    /** Rotation applied to every incoming sensor orientation to express it
+    in the OpenSim ground frame (e.g. to make Y the up axis), the live
+    equivalent of OpenSenseUtilities::rotateOrientationTable(). Default is
+    identity. Set before streaming begins. */
+    void setSensorToOpenSimRotation(const SimTK::Rotation_<double>& rotation) {
+        _sensorToOpenSim = rotation;
+    }
+
+    /** Map the timestamp of the first received frame to firstFrameTime and
+    shift all subsequent frames by the same offset. Pass SimTK::NaN (the
+    default) to pass sensor timestamps through unchanged. Set before
+    streaming begins. */
+    void setTimeAlignment(double firstFrameTime) {
+        _alignFirstFrameTo = firstFrameTime;
+    }
+
+    /** Smooth incoming frames with an OrientationStreamFilter of the given
+    time constant (in seconds) before they enter the reference, the
+    streaming stand-in for the offline TableUtilities::filterLowpass()
+    pass. Pass 0 (the default) for no filtering. Set before streaming
+    begins. */
+    void setSmoothingTimeConstant(double smoothingTimeConstant);
+
+    /** Push one frame from the acquisition thread: quaternions must point
+    at one quaternion per sensor in the order of the reference's names.
+    Converts, aligns the timestamp, and queues the frame without
+    allocating (once the reference's ring buffer is enabled). */
+    void pushFrame(double timestamp,
+            const SimTK::Quaternion_<double>* quaternions);
+
+    /** Bind a UDP socket on the given port and start a thread that
+    receives one frame per datagram (see the class comment for the wire
+    format) and pushes it into the reference. Throws if a receiver is
+    already running or the socket cannot be bound. */
+    void startUDP(int port);
+
+    /** End the stream: stop the receive thread (if any), close the socket,
+    and mark the reference finished so consumers stop waiting for frames.
+    Safe to call more than once. */
+    void stop();
+
+    /** Whether a UDP receive thread is currently running. */
+    bool isRunning() const { return _receiveThread.joinable(); }
+
+    /** Number of frames pushed into the reference so far. */
+    long long getNumFramesReceived() const { return _numFramesReceived; }
+    /** Number of UDP datagrams dropped because their size did not match
+    the expected frame payload. */
+    long long getNumMalformedDatagrams() const {
+        return _numMalformedDatagrams;
+    }
+
+private:
+    void receiveLoop();
+
+    std::shared_ptr<BufferedOrientationsReference> _orientationsRef;
+    int _numSensors{0};
+    SimTK::Rotation_<double> _sensorToOpenSim;
+    double _alignFirstFrameTo{SimTK::NaN};
+    bool _haveFirstFrame{false};
+    double _timeOffset{0};
+    // Reused conversion target so pushFrame() does not allocate per frame.
+    SimTK::RowVector_<SimTK::Rotation> _rotationRow;
+    // Optional smoothing stage and its reused (mutable) frame copy.
+    std::unique_ptr<OrientationStreamFilter> _filter;
+    std::vector<SimTK::Quaternion_<double>> _filterScratch;
+
+    // UDP receive thread state. The socket handle is kept as a long long so
+    // platform socket headers stay out of this header.
+    long long _socket{-1};
+    std::thread _receiveThread;
+    std::atomic<bool> _stopRequested{false};
+
+    std::atomic<long long> _numFramesReceived{0};
+    std::atomic<long long> _numMalformedDatagrams{0};
+    //=============================================================================
+};  // END of class IMUStreamReceiver
+//=============================================================================
+} // namespace
+
+#endif // OPENSIM_IMU_STREAM_RECEIVER_H_
@@ -0,0 +1,167 @@
+/* -------------------------------------------------------------------------- *
+ *                    IMUTrackingSessionManager.cpp                           *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "IMUTrackingSessionManager.h"
+
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Common/Logger.h>
+
+#include <algorithm>
+#include <thread>
+
+using namespace OpenSim;
+
+int IMUTrackingSessionManager::addSession(const Model& model,
+        std::shared_ptr<BufferedOrientationsReference> orientationsRef,
+        double latencyBudget, double accuracy) {
+
+    OPENSIM_THROW_IF(!orientationsRef || orientationsRef->getNumRefs() < 1,
+            Exception,
+            "IMUTrackingSessionManager::addSession requires a "
+            "BufferedOrientationsReference that names at least one sensor.");
+
+    auto session = std::unique_ptr<Session>(new Session{});
+    session->model = model;
+    session->orientationsRef = std::move(orientationsRef);
+    session->latencyBudget = latencyBudget;
+    session->accuracy = accuracy;
+    _sessions.push_back(std::move(session));
+    return int(_sessions.size()) - 1;
+}
+
+void IMUTrackingSessionManager::run() {
+    OPENSIM_THROW_IF(_sessions.empty(), Exception,
+            "IMUTrackingSessionManager::run called with no sessions; add "
+            "sessions with addSession() first.");
+
+    _numActiveSessions = int(_sessions.size());
+
+    int numThreads = _numThreads;
+    if (numThreads <= 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, int(_sessions.size()));
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < numThreads - 1; ++i)
+        workers.emplace_back(&IMUTrackingSessionManager::workerLoop, this);
+    // The calling thread is the last worker, so a single-threaded run
+    // spawns nothing.
+    workerLoop();
+    for (auto& worker : workers) worker.join();
+}
+
+void IMUTrackingSessionManager::workerLoop() {
+    while (_numActiveSessions.load(std::memory_order_acquire) > 0) {
+        bool solvedAny = false;
+        for (int i = 0; i < int(_sessions.size()); ++i) {
+            Session& session = *_sessions[i];
+            if (session.done.load(std::memory_order_acquire)) continue;
+            // One worker per session at a time.
+            if (session.busy.exchange(true, std::memory_order_acquire))
+                continue;
+            try {
+                solvedAny |= serviceSession(i, session);
+            } catch (const std::exception& ex) {
+                log_warn("IMUTrackingSessionManager: session {} failed and "
+                         "was retired: {}", i, ex.what());
+                retireSession(session);
+            }
+            session.busy.store(false, std::memory_order_release);
+        }
+        // Every stream is idle; let the producers make progress.
+        if (!solvedAny) std::this_thread::yield();
+    }
+}
+
+bool IMUTrackingSessionManager::serviceSession(
+        int sessionIndex, Session& session) {
+    BufferedOrientationsReference& oRefs = *session.orientationsRef;
+
+    if (!oRefs.hasQueuedData()) {
+        // Finished and drained: the session is complete. Otherwise leave
+        // without blocking so the worker can service the other sessions.
+        if (!oRefs.hasNext()) retireSession(session);
+        return false;
+    }
+
+    if (!session.solver) {
+        session.state = session.model.initSystem();
+        SimTK::Array_<CoordinateReference> coordinateReferences;
+        session.solver.reset(new InverseKinematicsSolver(session.model,
+                nullptr, session.orientationsRef, coordinateReferences));
+        session.solver->setAccuracy(session.accuracy);
+        // Frames carry their own timestamps; no table of times exists.
+        session.solver->setAdvanceTimeFromReference(true);
+        if (session.latencyBudget > 0)
+            session.solver->setTrackingLatencyBudget(session.latencyBudget);
+    }
+
+    // Drain at most the frames queued on arrival; frames that arrive while
+    // solving wait for the next visit, so one high-rate stream cannot
+    // monopolize a worker while other sessions have frames waiting.
+    int burst = oRefs.getQueueDepth();
+    bool solvedAny = false;
+    while (burst-- > 0 && oRefs.hasQueuedData()) {
+        if (!session.assembled) {
+            // assemble() consumes the first streamed frame.
+            session.solver->assemble(session.state);
+            session.assembled = true;
+        } else {
+            const double previousTime = session.state.getTime();
+            session.solver->track(session.state);
+            // A drained, finished stream leaves the time unchanged (see
+            // BufferedOrientationsReference).
+            if (session.state.getTime() == previousTime) {
+                retireSession(session);
+                break;
+            }
+        }
+        ++session.framesSolved;
+        solvedAny = true;
+        if (_frameHandler) _frameHandler(sessionIndex, session.state);
+    }
+    return solvedAny;
+}
+
+void IMUTrackingSessionManager::retireSession(Session& session) {
+    if (!session.done.exchange(true, std::memory_order_acq_rel))
+        _numActiveSessions.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+long long IMUTrackingSessionManager::getNumFramesSolved(int session) const {
+    OPENSIM_THROW_IF(session < 0 || session >= int(_sessions.size()),
+            Exception, "IMUTrackingSessionManager: no session " +
+                    std::to_string(session) + ".");
+    return _sessions[session]->framesSolved;
+}
+
+const InverseKinematicsSolver& IMUTrackingSessionManager::getSolver(
+        int session) const {
+    OPENSIM_THROW_IF(session < 0 || session >= int(_sessions.size()),
+            Exception, "IMUTrackingSessionManager: no session " +
+                    std::to_string(session) + ".");
+    OPENSIM_THROW_IF(!_sessions[session]->solver, Exception,
+            "IMUTrackingSessionManager: session " + std::to_string(session) +
+                    " never received a frame; it has no solver.");
+    return *_sessions[session]->solver;
+}
@@ -0,0 +1,165 @@
+#ifndef OPENSIM_IMU_TRACKING_SESSION_MANAGER_H_
+#define OPENSIM_IMU_TRACKING_SESSION_MANAGER_H_
+/* -------------------------------------------------------------------------- *
+ *                     IMUTrackingSessionManager.h                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <OpenSim/Simulation/BufferedOrientationsReference.h>
+#include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Simulation/Model/Model.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * Track orientations for several streamed subjects in one process. The
+ * live tracking path (InverseKinematicsSolver, BufferedOrientationsReference,
+ * its DataQueue, IMUStreamReceiver) carries all of its state per instance,
+ * so running one subject per process buys no isolation; what it costs is a
+ * core per subject even when most streams are idle. This manager owns one
+ * session per subject - a private copy of the subject's model, its own
+ * solver and state, and the caller's live reference - and multiplexes the
+ * sessions across a small pool of worker threads.
+ *
+ * Workers visit sessions round-robin and only solve where frames are
+ * actually queued, so a stalled or slow sensor rig never blocks the other
+ * subjects, and a session is only ever solved by one worker at a time. On
+ * each visit a worker drains at most the frames that were queued when it
+ * arrived, so a high-rate stream cannot monopolize a worker while others
+ * have frames waiting. Each session carries its own latency budget
+ * (InverseKinematicsSolver::setTrackingLatencyBudget()), so a subject that
+ * needs hard real-time response can trade accuracy for latency without
+ * affecting the subjects that do not.
+ *
+ * Typical use for N subjects:
+ * @code
+ * IMUTrackingSessionManager manager;
+ * for (int subject = 0; subject < N; ++subject)
+ *     manager.addSession(models[subject], references[subject],
+ *             latencyBudgets[subject]);
+ * manager.setFrameHandler([&](int session, const SimTK::State& s) {
+ *     // consume the solved pose; called with the session's frames in order
+ * });
+ * manager.run(); // returns when every stream is finished and drained
+ * @endcode
+ *
+ * Each reference is fed by its own producer (typically an
+ * IMUStreamReceiver); run() returns once every producer has marked its
+ * stream finished (BufferedOrientationsReference::setFinished()) and the
+ * queued frames have been solved.
+ */
+class OSIMSIMULATION_API IMUTrackingSessionManager {
+public:
+    /** Called from a worker thread after each solved frame with the session
+    index and the session's state, realized through the solve. Calls for one
+    session arrive in frame order from one worker at a time, but different
+    sessions' calls may run concurrently; the handler must be safe to call
+    from several threads when it touches cross-session data. */
+    using FrameHandler =
+            std::function<void(int session, const SimTK::State& state)>;
+
+    IMUTrackingSessionManager() = default;
+    ~IMUTrackingSessionManager() = default;
+
+    // The manager owns per-session solvers and states; copying is not
+    // meaningful.
+    IMUTrackingSessionManager(const IMUTrackingSessionManager&) = delete;
+    IMUTrackingSessionManager& operator=(
+            const IMUTrackingSessionManager&) = delete;
+
+    /** Add one subject's session and return its session index. The model is
+    copied, so sessions never share model state; the reference is the live
+    queue the subject's producer pushes into. latencyBudget (seconds, 0
+    disables) is this session's real-time budget, and accuracy is its
+    solver accuracy. Add all sessions before calling run(). */
+    int addSession(const Model& model,
+            std::shared_ptr<BufferedOrientationsReference> orientationsRef,
+            double latencyBudget = 0, double accuracy = 1e-4);
+
+    int getNumSessions() const { return int(_sessions.size()); }
+
+    /** Install the per-frame handler invoked by the workers; see
+    FrameHandler for the threading contract. Set before calling run(). */
+    void setFrameHandler(FrameHandler handler) {
+        _frameHandler = std::move(handler);
+    }
+
+    /** Number of worker threads run() spawns. Zero or negative (the
+    default) resolves to the hardware concurrency; the count is always
+    clamped to the number of sessions. */
+    void setNumThreads(int numThreads) { _numThreads = numThreads; }
+    int getNumThreads() const { return _numThreads; }
+
+    /** Service every session until each stream is finished and drained.
+    Blocks the calling thread; frames are solved on the worker pool. A
+    session whose solve throws is logged and retired; the other sessions
+    run on. Call once per set of added sessions. */
+    void run();
+
+    /** Number of frames solved for a session (including the assembled
+    first frame). */
+    long long getNumFramesSolved(int session) const;
+
+    /** The session's solver, for reading tracking statistics or the
+    per-frame diagnostics table after run() returns. Throws if the session
+    never received a frame (its solver was never created). Do not call
+    while run() is in progress. */
+    const InverseKinematicsSolver& getSolver(int session) const;
+
+private:
+    struct Session {
+        Model model;
+        std::shared_ptr<BufferedOrientationsReference> orientationsRef;
+        double latencyBudget{0};
+        double accuracy{1e-4};
+        // Created by the first worker to service the session.
+        std::unique_ptr<InverseKinematicsSolver> solver;
+        SimTK::State state;
+        bool assembled{false};
+        long long framesSolved{0};
+        // One worker at a time; acquired with an atomic exchange.
+        std::atomic<bool> busy{false};
+        std::atomic<bool> done{false};
+    };
+
+    // Returns true if any frame was solved on this visit.
+    bool serviceSession(int sessionIndex, Session& session);
+    void retireSession(Session& session);
+    void workerLoop();
+
+    std::vector<std::unique_ptr<Session>> _sessions;
+    FrameHandler _frameHandler;
+    int _numThreads{0};
+    std::atomic<int> _numActiveSessions{0};
+    //=============================================================================
+};  // END of class IMUTrackingSessionManager
+//=============================================================================
+} // namespace
+
+#endif // OPENSIM_IMU_TRACKING_SESSION_MANAGER_H_
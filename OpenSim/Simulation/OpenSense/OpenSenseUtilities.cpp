@@ -31,6 +31,52 @@ using namespace OpenSim;
 using namespace SimTK;
 using namespace std;
 
+namespace {
+// Hamilton product a*b over the packed (w,x,y,z) scalars; equivalent to
+// composing the rotations but without forming either Mat33.
+inline Quaternion multiplyQuaternions(
+        const Quaternion& a, const Quaternion& b) {
+    return Quaternion(
+            a[0]*b[0] - a[1]*b[1] - a[2]*b[2] - a[3]*b[3],
+            a[0]*b[1] + a[1]*b[0] + a[2]*b[3] - a[3]*b[2],
+            a[0]*b[2] - a[1]*b[3] + a[2]*b[0] + a[3]*b[1],
+            a[0]*b[3] + a[1]*b[2] - a[2]*b[1] + a[3]*b[0]);
+}
+
+// Form the Rotation's Mat33 directly from the quaternion scalars. The 2/n
+// scale tolerates slightly unnormalized input (e.g. wire rounding) and the
+// result is a rotation by construction, so the unchecked setter applies.
+inline void quaternionToRotation(const Quaternion& q, Rotation& rotation) {
+    const double w = q[0], x = q[1], y = q[2], z = q[3];
+    const double s = 2.0 / (w*w + x*x + y*y + z*z);
+    const double xs = x*s,  ys = y*s,  zs = z*s;
+    const double wx = w*xs, wy = w*ys, wz = w*zs;
+    const double xx = x*xs, xy = x*ys, xz = x*zs;
+    const double yy = y*ys, yz = y*zs, zz = z*zs;
+    rotation.setRotationFromMat33TrustMe(Mat33(
+            1 - (yy + zz), xy - wz,       xz + wy,
+            xy + wz,       1 - (xx + zz), yz - wx,
+            xz - wy,       yz + wx,       1 - (xx + yy)));
+}
+} // namespace
+
+void OpenSenseUtilities::rotateQuaternions(
+        const SimTK::Rotation_<double>& rotation,
+        SimTK::Quaternion_<double>* quaternions, int numElements)
+{
+    const Quaternion qRot = rotation.convertRotationToQuaternion();
+    for (int i = 0; i < numElements; ++i)
+        quaternions[i] = multiplyQuaternions(qRot, quaternions[i]);
+}
+
+void OpenSenseUtilities::convertQuaternionsToRotations(
+        const SimTK::Quaternion_<double>* quaternions, int numElements,
+        SimTK::Rotation_<double>* rotations)
+{
+    for (int i = 0; i < numElements; ++i)
+        quaternionToRotation(quaternions[i], rotations[i]);
+}
+
 TimeSeriesTable_<SimTK::Rotation> OpenSenseUtilities::
     convertQuaternionsToRotations(
         const TimeSeriesTableQuaternion& quaternionsTable)
@@ -49,9 +95,11 @@ TimeSeriesTable_<SimTK::Rotation> OpenSenseUtilities::
     for (size_t i = 0; i < nt; ++i) {
         newTimes[cnt] = times[i];
         const auto& quatRow = quaternionsTable.getRowAtIndex(i);
+        // The table's row view is strided, so convert element-wise with
+        // the same direct quaternion->Mat33 kernel as the batched entry
+        // point rather than the checked Rotation(Quaternion) constructor.
         for (int j = 0; j < nc; ++j) {
-            const Quaternion& quatO = quatRow[j];
-            matrix.updElt(cnt, j) = Rotation(quatO);
+            quaternionToRotation(quatRow[j], matrix.updElt(cnt, j));
         }
         cnt++;
     }
@@ -71,7 +119,9 @@ void OpenSim::OpenSenseUtilities::rotateOrientationTable(
                 quaternionsTable,
         const SimTK::Rotation_<double>& rotationMatrix)
 {
-    SimTK::Rotation R_XG = rotationMatrix;
+    // One quaternion product per element replaces the previous
+    // quaternion->matrix->quaternion round trip per element.
+    const Quaternion qRot = rotationMatrix.convertRotationToQuaternion();
 
     int nc = int(quaternionsTable.getNumColumns());
     size_t nt = quaternionsTable.getNumRows();
@@ -79,9 +129,7 @@ void OpenSim::OpenSenseUtilities::rotateOrientationTable(
     for (size_t i = 0; i < nt; ++i) {
         auto quatRow = quaternionsTable.updRowAtIndex(i);
         for (int j = 0; j < nc; ++j) {
-            // This can be done completely in Quaternions but this is easier to debug for now
-            Quaternion quatO = (R_XG * Rotation(quatRow[j])).convertRotationToQuaternion();
-            quatRow[j] = quatO;
+            quatRow[j] = multiplyQuaternions(qRot, quatRow[j]);
         }
     }
     return;
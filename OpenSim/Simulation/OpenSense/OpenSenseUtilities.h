@@ -41,6 +41,25 @@ public:
                     quaternionsTable,
             const SimTK::Rotation_<double>& rotationMatrix);
 
+    /** Batch kernel behind rotateOrientationTable(): re-express
+        numElements contiguous quaternions by a fixed rotation, in place,
+        as a quaternion (Hamilton) product instead of the
+        quaternion->matrix->quaternion round trip. The loop is plain
+        branch-free arithmetic over the packed (w,x,y,z) scalars so the
+        compiler can vectorize it; use this directly when the data is
+        already in a contiguous buffer (e.g. a live streaming path). */
+    static void rotateQuaternions(const SimTK::Rotation_<double>& rotation,
+            SimTK::Quaternion_<double>* quaternions, int numElements);
+
+    /** Batch kernel behind convertQuaternionsToRotations(): convert
+        numElements contiguous quaternions into Rotation matrices by
+        forming each Mat33 directly from the quaternion scalars (tolerating
+        slightly unnormalized input) instead of going through the checked
+        Rotation(Quaternion) constructor per element. */
+    static void convertQuaternionsToRotations(
+            const SimTK::Quaternion_<double>* quaternions, int numElements,
+            SimTK::Rotation_<double>* rotations);
+
     /// @name Convert Table of Quaternions into a Table for Rotations
     /// @{
     /** Convert a TimeSeriesTable with quaternions as data elements into a TimeSeriesTable
@@ -0,0 +1,89 @@
+/* -------------------------------------------------------------------------- *
+ *                      OrientationStreamFilter.cpp                           *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OrientationStreamFilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+using SimTK::Quaternion;
+using SimTK::Vec4;
+
+namespace {
+// Spherical interpolation from a to b by fraction alpha; b must already be
+// in the same hemisphere as a. Falls back to normalized linear
+// interpolation when the quaternions are nearly parallel, where the slerp
+// weights are ill-conditioned and nlerp is indistinguishable.
+inline Quaternion slerp(const Quaternion& a, const Quaternion& b,
+        double alpha) {
+    const Vec4& va = a.asVec4();
+    const Vec4& vb = b.asVec4();
+    const double cosTheta = SimTK::dot(va, vb);
+    Vec4 blended;
+    if (cosTheta > 0.9995) {
+        blended = (1 - alpha) * va + alpha * vb;
+    } else {
+        const double theta = std::acos(std::max(-1.0, std::min(1.0, cosTheta)));
+        const double sinTheta = std::sin(theta);
+        blended = (std::sin((1 - alpha) * theta) / sinTheta) * va +
+                  (std::sin(alpha * theta) / sinTheta) * vb;
+    }
+    // The 4-scalar constructor normalizes, absorbing nlerp shrinkage and
+    // rounding from the slerp weights.
+    return Quaternion(blended[0], blended[1], blended[2], blended[3]);
+}
+} // anonymous namespace
+
+namespace OpenSim {
+
+OrientationStreamFilter::OrientationStreamFilter(
+        int numSensors, double smoothingTimeConstant)
+        : _numSensors(numSensors), _timeConstant(smoothingTimeConstant) {
+    _state.resize(_numSensors);
+}
+
+void OrientationStreamFilter::filterFrame(
+        double time, Quaternion* quaternions) {
+    const double dt = time - _previousTime;
+    if (!_havePreviousFrame || _timeConstant <= 0 || dt <= 0) {
+        // Pass through and (re)seed the state.
+        for (int i = 0; i < _numSensors; ++i) _state[i] = quaternions[i];
+        _havePreviousFrame = true;
+        _previousTime = time;
+        return;
+    }
+    const double alpha = 1 - std::exp(-dt / _timeConstant);
+    for (int i = 0; i < _numSensors; ++i) {
+        Quaternion incoming = quaternions[i];
+        // Keep the blend on the short arc regardless of the sign convention
+        // of the incoming stream.
+        if (SimTK::dot(incoming.asVec4(), _state[i].asVec4()) < 0)
+            incoming = Quaternion(-incoming.asVec4()[0], -incoming.asVec4()[1],
+                    -incoming.asVec4()[2], -incoming.asVec4()[3]);
+        _state[i] = slerp(_state[i], incoming, alpha);
+        quaternions[i] = _state[i];
+    }
+    _previousTime = time;
+}
+
+} // namespace OpenSim
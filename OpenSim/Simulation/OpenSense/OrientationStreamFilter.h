@@ -0,0 +1,100 @@
+#ifndef OPENSIM_ORIENTATION_STREAM_FILTER_H_
+#define OPENSIM_ORIENTATION_STREAM_FILTER_H_
+/* -------------------------------------------------------------------------- *
+ *                       OrientationStreamFilter.h                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <SimTKcommon.h>
+
+#include <vector>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * Causal, per-frame smoothing stage for live orientation streams, sitting
+ * between raw sensor input and a BufferedOrientationsReference:
+ *
+ *     sensors -> IMUStreamReceiver [-> OrientationStreamFilter]
+ *             -> BufferedOrientationsReference -> InverseKinematicsSolver
+ *
+ * The offline path smooths recorded trials with
+ * TableUtilities::filterLowpass(), which needs the full trial in memory and
+ * therefore adds a trial's worth of latency; that is unusable when frames
+ * are consumed as they arrive. This filter is the streaming replacement: a
+ * first-order complementary smoother that blends each incoming frame toward
+ * the previous filtered frame by SLERP, with the blend fraction derived
+ * from the frame interval and a configurable time constant,
+ *
+ *     alpha = 1 - exp(-dt / timeConstant)
+ *     q[k]  = slerp(q[k-1], q_in[k], alpha)
+ *
+ * so the effective cutoff is independent of (possibly irregular) sample
+ * rate. Each frame costs a fixed handful of arithmetic operations per
+ * sensor, performs no allocation after construction, and uses no
+ * look-ahead, so the stage adds no latency beyond its phase lag. Incoming
+ * quaternions are hemisphere-aligned against the filter state before
+ * blending so sign flips in the stream do not produce spurious long-way
+ * interpolation.
+ *
+ * The filter is stateful and single-stream: feed it frames from one thread
+ * in time order. A non-positive time constant, a non-increasing timestamp,
+ * or the first frame after construction/reset() passes the input through
+ * unfiltered and (re)seeds the state.
+ */
+class OSIMSIMULATION_API OrientationStreamFilter {
+public:
+    /** Construct a filter for numSensors parallel orientation channels.
+    smoothingTimeConstant is in seconds; pass 0 for a pass-through stage. */
+    OrientationStreamFilter(int numSensors, double smoothingTimeConstant);
+
+    /** The smoothing time constant, in seconds; larger values smooth more
+    and lag more. Takes effect from the next frame. */
+    void setSmoothingTimeConstant(double smoothingTimeConstant) {
+        _timeConstant = smoothingTimeConstant;
+    }
+    double getSmoothingTimeConstant() const { return _timeConstant; }
+
+    /** Discard the filter state; the next frame passes through unfiltered
+    and reseeds it. Call between trials or after a stream gap. */
+    void reset() { _havePreviousFrame = false; }
+
+    /** Filter one frame in place: quaternions must point at one quaternion
+    per sensor, stamped with the frame time in seconds. On return the
+    buffer holds the smoothed (unit) quaternions. */
+    void filterFrame(double time, SimTK::Quaternion_<double>* quaternions);
+
+private:
+    int _numSensors{0};
+    double _timeConstant{0};
+    bool _havePreviousFrame{false};
+    double _previousTime{0};
+    // Filtered output of the previous frame, one entry per sensor.
+    std::vector<SimTK::Quaternion_<double>> _state;
+    //=============================================================================
+};  // END of class OrientationStreamFilter
+//=============================================================================
+} // namespace
+
+#endif // OPENSIM_ORIENTATION_STREAM_FILTER_H_
@@ -158,9 +158,8 @@ const SimTK::Array_<std::string>& OrientationsReference::getNames() const
 void OrientationsReference::getValuesAtTime(
         double time, SimTK::Array_<Rotation> &values) const
 {
-
-    // get values for time
-    SimTK::RowVector_<Rotation> row = _orientationData.getRow(time);
+    // get values for time as a view into the data; no copy of the row
+    const auto row = _orientationData.getRow(time);
 
     int n = row.size();
     values.resize(n);
@@ -154,9 +154,14 @@ public:
 
 private:
     void constructProperties();
-    void populateFromOrientationData();
 
 protected:
+    /** Rebuild the flat name and weight arrays from the column labels of
+    _orientationData and the orientation_weights property. Derived classes
+    that populate _orientationData themselves (e.g. for live streams) must
+    call this afterwards. */
+    void populateFromOrientationData();
+
     // Use a specialized data structure for holding the orientation data
     TimeSeriesTable_<SimTK::Rotation> _orientationData;
 
@@ -18,7 +18,11 @@
 
 #include "PositionMotion.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <OpenSim/Common/Function.h>
+#include <OpenSim/Common/GCVSpline.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Moco/MocoUtilities.h>
 #include <OpenSim/Simulation/Model/Model.h>
@@ -33,6 +37,17 @@ public:
     void setFunctions(std::vector<Function*> functions) {
         m_functions = std::move(functions);
     }
+    /// Provide dense uniform-grid samples (one row per grid point, one
+    /// column per q) to be interpolated in place of the functions.
+    void setDenseGrid(double startTime, double timeStep, SimTK::Matrix q,
+            SimTK::Matrix qdot, SimTK::Matrix qdotdot) {
+        m_gridStartTime = startTime;
+        m_gridTimeStep = timeStep;
+        m_q = std::move(q);
+        m_qdot = std::move(qdot);
+        m_qdotdot = std::move(qdotdot);
+        m_dense = m_q.nrow() > 1;
+    }
 
     SimTK::Motion::Level getLevel(const SimTK::State&) const override {
         return SimTK::Motion::Level::Position;
@@ -41,7 +56,9 @@ public:
     /// q: The values of the generalized coordinates to set, with length nq.
     void calcPrescribedPosition(
             const SimTK::State& s, int nq, SimTK::Real* q) const override {
-        if (m_functions.size()) {
+        if (m_dense) {
+            interpolateDense(m_q, s.getTime(), nq, q);
+        } else if (m_functions.size()) {
             for (int i = 0; i < nq; ++i) {
                 m_funcArgs[0] = s.getTime();
                 q[i] = m_functions[i]->calcValue(m_funcArgs);
@@ -50,7 +67,9 @@ public:
     }
     void calcPrescribedPositionDot(
             const SimTK::State& s, int nq, SimTK::Real* qdot) const override {
-        if (m_functions.size()) {
+        if (m_dense) {
+            interpolateDense(m_qdot, s.getTime(), nq, qdot);
+        } else if (m_functions.size()) {
             for (int i = 0; i < nq; ++i) {
                 m_funcArgs[0] = s.getTime();
                 qdot[i] = m_functions[i]->calcDerivative(
@@ -60,7 +79,9 @@ public:
     }
     void calcPrescribedPositionDotDot(const SimTK::State& s, int nq,
             SimTK::Real* qdotdot) const override {
-        if (m_functions.size()) {
+        if (m_dense) {
+            interpolateDense(m_qdotdot, s.getTime(), nq, qdotdot);
+        } else if (m_functions.size()) {
             for (int i = 0; i < nq; ++i) {
                 m_funcArgs[0] = s.getTime();
                 qdotdot[i] = m_functions[i]->calcDerivative(
@@ -70,10 +91,33 @@ public:
     }
 
 private:
+    /// One interval lookup serves all of this mobilized body's qs; times
+    /// outside the grid clamp to its ends.
+    void interpolateDense(const SimTK::Matrix& table, double time, int nq,
+            SimTK::Real* out) const {
+        double x = (time - m_gridStartTime) / m_gridTimeStep;
+        int row = (int)std::floor(x);
+        if (row < 0) row = 0;
+        if (row > table.nrow() - 2) row = table.nrow() - 2;
+        double frac = x - row;
+        if (frac < 0) frac = 0;
+        if (frac > 1) frac = 1;
+        for (int i = 0; i < nq; ++i) {
+            out[i] = table(row, i) + frac * (table(row + 1, i) - table(row, i));
+        }
+    }
+
     std::vector<Function*> m_functions;
     mutable SimTK::Vector m_funcArgs = SimTK::Vector(1);
     static const std::vector<int> m_qdotDerivComponents;
     static const std::vector<int> m_qdotdotDerivComponents;
+
+    bool m_dense = false;
+    double m_gridStartTime = 0;
+    double m_gridTimeStep = 0;
+    SimTK::Matrix m_q;
+    SimTK::Matrix m_qdot;
+    SimTK::Matrix m_qdotdot;
 };
 
 const std::vector<int>
@@ -89,6 +133,12 @@ public:
         static_cast<SimTKPositionMotionImplementation&>(updImplementation())
                 .setFunctions(std::move(functions));
     }
+    void setDenseGrid(double startTime, double timeStep, SimTK::Matrix q,
+            SimTK::Matrix qdot, SimTK::Matrix qdotdot) {
+        static_cast<SimTKPositionMotionImplementation&>(updImplementation())
+                .setDenseGrid(startTime, timeStep, std::move(q),
+                        std::move(qdot), std::move(qdotdot));
+    }
 };
 
 void PositionMotion::setPositionForCoordinate(
@@ -206,6 +256,31 @@ void PositionMotion::extendRealizeTopology(SimTK::State& state) const {
         indicesToCoordName[std::make_pair(mbi, qIndex)] = path;
     }
 
+    // If a sampling interval was provided, determine the uniform grid over
+    // the common time range of the coordinate functions so each mobilized
+    // body's dense tables share one interval lookup per evaluation.
+    const double samplingInterval = get_sampling_interval();
+    double gridStartTime = SimTK::Infinity;
+    double gridEndTime = -SimTK::Infinity;
+    int numGridPoints = 0;
+    if (samplingInterval > 0) {
+        for (int i = 0; i < get_functions().getSize(); ++i) {
+            const auto* spline =
+                    dynamic_cast<const GCVSpline*>(&get_functions().get(i));
+            OPENSIM_THROW_IF(!spline, Exception,
+                    "Presampling requires all coordinate functions to be "
+                    "GCVSplines, but the function for coordinate '{}' is a "
+                    "{}.",
+                    get_functions().get(i).getName(),
+                    get_functions().get(i).getConcreteClassName());
+            gridStartTime = std::min(gridStartTime, spline->getMinX());
+            gridEndTime = std::max(gridEndTime, spline->getMaxX());
+        }
+        numGridPoints = std::max(2,
+                (int)std::ceil((gridEndTime - gridStartTime) /
+                        samplingInterval) + 1);
+    }
+
     auto& matter = getSystem().getMatterSubsystem();
     for (SimTK::MobilizedBodyIndex mbi(0); mbi < matter.getNumBodies(); ++mbi) {
         auto& mobod = matter.getMobilizedBody(mbi);
@@ -224,6 +299,28 @@ void PositionMotion::extendRealizeTopology(SimTK::State& state) const {
         }
         auto& motion = const_cast<SimTK::Motion&>(m_motions[mbi]);
         auto& customMotion = static_cast<SimTKPositionMotion&>(motion);
+        if (samplingInterval > 0 && !mobodFunctions.empty()) {
+            // Presample this body's functions on the uniform grid.
+            const double timeStep =
+                    (gridEndTime - gridStartTime) / (numGridPoints - 1);
+            const int nq = (int)mobodFunctions.size();
+            SimTK::Matrix q(numGridPoints, nq);
+            SimTK::Matrix qdot(numGridPoints, nq);
+            SimTK::Matrix qdotdot(numGridPoints, nq);
+            SimTK::Vector thisTime(1);
+            for (int irow = 0; irow < numGridPoints; ++irow) {
+                thisTime[0] = gridStartTime + irow * timeStep;
+                for (int iq = 0; iq < nq; ++iq) {
+                    q(irow, iq) = mobodFunctions[iq]->calcValue(thisTime);
+                    qdot(irow, iq) = mobodFunctions[iq]->calcDerivative(
+                            {0}, thisTime);
+                    qdotdot(irow, iq) = mobodFunctions[iq]->calcDerivative(
+                            {0, 0}, thisTime);
+                }
+            }
+            customMotion.setDenseGrid(gridStartTime, timeStep, std::move(q),
+                    std::move(qdot), std::move(qdotdot));
+        }
         customMotion.setFunctions(std::move(mobodFunctions));
     }
 }
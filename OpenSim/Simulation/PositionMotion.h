@@ -48,10 +48,16 @@ public:
             "true).");
     OpenSim_DECLARE_PROPERTY(functions, FunctionSet,
             "Functions specifying the values of each coordinate.");
+    OpenSim_DECLARE_PROPERTY(sampling_interval, double,
+            "Optional uniform time step (seconds) at which the coordinate "
+            "functions are presampled into dense q/u/udot tables evaluated "
+            "by linear interpolation instead of per-coordinate spline calls "
+            "(default: -1, meaning the splines are evaluated directly).");
 
     PositionMotion() {
         constructProperty_default_enabled(true);
         constructProperty_functions(FunctionSet());
+        constructProperty_sampling_interval(-1);
     }
     PositionMotion(std::string name) : PositionMotion() {
         setName(std::move(name));
@@ -70,6 +76,19 @@ public:
     /// are enforced.
     void setEnabled(SimTK::State& state, bool enabled) const;
     bool getEnabled(const SimTK::State& state) const;
+    /// Presample the coordinate functions on a uniform grid with this time
+    /// step and evaluate the motion by interpolating the resulting dense
+    /// q/u/udot tables across all coordinates at once. This trades a small,
+    /// controllable interpolation error for much cheaper evaluation and is
+    /// intended for fixed-step workflows (e.g. tracking and inverse
+    /// problems) where the step can be chosen at or below the query
+    /// spacing. All coordinate functions must be GCVSplines (as produced by
+    /// createFromTable()). Pass a non-positive value to evaluate the
+    /// splines directly (the default).
+    void setSamplingInterval(double interval) {
+        set_sampling_interval(interval);
+    }
+    double getSamplingInterval() const { return get_sampling_interval(); }
     /// Create a PositionMotion that prescribes kinematics for all coordinates
     /// in a model, given a data table containing coordinate values for all
     /// coordinates using GCVSpline. If the table contains any columns that are
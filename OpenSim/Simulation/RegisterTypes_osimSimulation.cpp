@@ -45,10 +45,13 @@
 #include "Model/ContactMesh.h"
 #include "Model/ContactSphere.h"
 #include "Model/CoordinateLimitForce.h"
+#include "Model/DiscreteForces.h"
 #include "Model/CoordinateSet.h"
 #include "Model/ElasticFoundationForce.h"
 #include "Model/HuntCrossleyForce.h"
+#include "Model/HuntCrossleyContactManager.h"
 #include "Model/SmoothSphereHalfSpaceForce.h"
+#include "Model/StationPlaneContactForces.h"
 #include "Model/Ligament.h"
 #include "Model/Blankevoort1991Ligament.h"
 #include "Model/JointSet.h"
@@ -60,6 +63,7 @@
 #include "Model/ConditionalPathPoint.h"
 #include "Model/MovingPathPoint.h"
 #include "Model/GeometryPath.h"
+#include "Model/FunctionBasedPath.h"
 #include "Model/PrescribedForce.h"
 #include "Model/ExternalForce.h"
 #include "Model/PointToPointSpring.h"
@@ -88,6 +92,7 @@
 #include "Control/ControlSetController.h"
 #include "Control/ControlConstant.h"
 #include "Control/ControlLinear.h"
+#include "Control/ExternalInputController.h"
 #include "Control/PrescribedController.h"
 
 #include "Wrap/PathWrap.h"
@@ -191,6 +196,7 @@ OSIMSIMULATION_API void RegisterTypes_osimSimulation()
     Object::registerType( FrameGeometry());
     Object::registerType( Arrow());
     Object::registerType( GeometryPath());
+    Object::registerType( FunctionBasedPath());
 
     Object::registerType( ControlSet() );
     Object::registerType( ControlConstant() );
@@ -241,8 +247,11 @@ OSIMSIMULATION_API void RegisterTypes_osimSimulation()
     Object::registerType( ContactMesh() );
     Object::registerType( ContactSphere() );
     Object::registerType( CoordinateLimitForce() );
+    Object::registerType( DiscreteForces() );
     Object::registerType( SmoothSphereHalfSpaceForce() );
+    Object::registerType( StationPlaneContactForces() );
     Object::registerType( HuntCrossleyForce() );
+    Object::registerType( HuntCrossleyContactManager() );
     Object::registerType( ElasticFoundationForce() );
     Object::registerType( HuntCrossleyForce::ContactParameters() );
     Object::registerType( HuntCrossleyForce::ContactParametersSet() );
@@ -262,6 +271,7 @@ OSIMSIMULATION_API void RegisterTypes_osimSimulation()
     Object::registerType( ExpressionBasedCoordinateForce() );
 
     Object::registerType( ControlSetController() );
+    Object::registerType( ExternalInputController() );
     Object::registerType( PrescribedController() );
 
     Object::registerType( PathActuator() );
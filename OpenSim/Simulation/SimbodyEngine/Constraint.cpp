@@ -110,6 +110,19 @@ void Constraint::extendConnectToModel(Model& aModel)
     Super::extendConnectToModel(aModel);
 }
 
+void Constraint::extendAddToSystem(SimTK::MultibodySystem& system) const
+{
+    Super::extendAddToSystem(system);
+
+    // Constraint forces depend on the multipliers, which are available once
+    // accelerations have been computed.
+    this->_constraintBodyForcesCV = addCacheVariable("constraint_body_forces",
+        SimTK::Vector_<SimTK::SpatialVec>(), SimTK::Stage::Acceleration);
+    this->_constraintMobilityForcesCV = addCacheVariable(
+        "constraint_mobility_forces", SimTK::Vector(),
+        SimTK::Stage::Acceleration);
+}
+
 void Constraint::extendInitStateFromProperties(SimTK::State& s) const
 {
     Super::extendInitStateFromProperties(s);
@@ -201,15 +214,28 @@ bool Constraint::setIsEnforced(SimTK::State& s, bool isEnforced)
  */
 void Constraint::
 calcConstraintForces(const SimTK::State& s,
-                     SimTK::Vector_<SimTK::SpatialVec>& bodyForcesInAncestor, 
+                     SimTK::Vector_<SimTK::SpatialVec>& bodyForcesInAncestor,
                      SimTK::Vector& mobilityForces) const {
     SimTK::Constraint& simConstraint =
         _model->updMatterSubsystem().updConstraint(_index);
     if(!simConstraint.isDisabled(s)){
+        // Reuse forces already computed at this state by another caller
+        // (e.g. a second reporter in the same analysis pass).
+        if (isCacheVariableValid(s, _constraintBodyForcesCV) &&
+                isCacheVariableValid(s, _constraintMobilityForcesCV)) {
+            bodyForcesInAncestor =
+                getCacheVariableValue(s, _constraintBodyForcesCV);
+            mobilityForces =
+                getCacheVariableValue(s, _constraintMobilityForcesCV);
+            return;
+        }
         SimTK::Vector multipliers = simConstraint.getMultipliersAsVector(s);
         simConstraint.calcConstraintForcesFromMultipliers(s, multipliers,
                                                           bodyForcesInAncestor,
                                                           mobilityForces);
+        setCacheVariableValue(s, _constraintBodyForcesCV,
+                              bodyForcesInAncestor);
+        setCacheVariableValue(s, _constraintMobilityForcesCV, mobilityForces);
     }
 }
 
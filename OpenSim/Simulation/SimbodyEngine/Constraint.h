@@ -109,6 +109,7 @@ public:
 protected:
     // ModelComponent interface.
     void extendConnectToModel(Model& aModel) override;
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
     void extendInitStateFromProperties(SimTK::State& state) const override;
     void extendSetPropertiesFromState(const SimTK::State& state) override;
 
@@ -127,6 +128,16 @@ private:
     /** ID for the constraint in Simbody. */
     SimTK::ResetOnCopy<SimTK::ConstraintIndex> _index;
 
+    // The constraint forces computed by calcConstraintForces() are cached in
+    // the State so that every reporter and analysis querying this constraint
+    // at the same state (e.g. inverse dynamics followed by residual
+    // reporting) shares one evaluation. The cache is invalidated
+    // automatically whenever the state's coordinates, speeds or
+    // accelerations change.
+    mutable CacheVariable<SimTK::Vector_<SimTK::SpatialVec>>
+        _constraintBodyForcesCV;
+    mutable CacheVariable<SimTK::Vector> _constraintMobilityForcesCV;
+
     friend class SimbodyEngine;
 
 //=============================================================================
@@ -25,6 +25,8 @@
 // INCLUDES
 //=============================================================================
 #include "CoordinateCouplerConstraint.h"
+#include <OpenSim/Common/LinearFunction.h>
+#include <OpenSim/Common/PolynomialFunction.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include "simbody/internal/Constraint.h"
 
@@ -38,14 +40,18 @@ class CompoundFunction : public SimTK::Function {
 private:
     std::unique_ptr<const SimTK::Function> f1;
     const double scale;
+    // Reusable argument buffer.  Constraints are realized serially within a
+    // study and each study owns its own function instance, so reusing one
+    // buffer avoids a heap allocation on every evaluation.
+    mutable SimTK::Vector xf;
 
 public:
-    
-    CompoundFunction(const SimTK::Function *cf, double scale) : f1(cf), scale(scale) {
+
+    CompoundFunction(const SimTK::Function *cf, double scale)
+        : f1(cf), scale(scale), xf(1) {
     }
 
     double calcValue(const SimTK::Vector& x) const override {
-        SimTK::Vector xf(1);
         xf[0] = x[0];
         return scale*f1->calcValue(xf)-x[1];
     }
@@ -57,18 +63,16 @@ public:
     double calcDerivative(const SimTK::Array_<int>& derivComponents, const SimTK::Vector& x) const override {
         if (derivComponents.size() == 1){
             if (derivComponents[0]==0){
-                SimTK::Vector x1(1);
-                x1[0] = x[0];
-                return scale*f1->calcDerivative(derivComponents, x1);
+                xf[0] = x[0];
+                return scale*f1->calcDerivative(derivComponents, xf);
             }
             else if (derivComponents[0]==1)
                 return -1;
         }
         else if(derivComponents.size() == 2){
             if (derivComponents[0]==0 && derivComponents[1] == 0){
-                SimTK::Vector x1(1);
-                x1[0] = x[0];
-                return scale*f1->calcDerivative(derivComponents, x1);
+                xf[0] = x[0];
+                return scale*f1->calcDerivative(derivComponents, xf);
             }
         }
         return 0;
@@ -86,6 +90,103 @@ public:
     }
 };
 
+// Flattened coupler for the common case of a linear coupling function,
+// C(q) = scale*(slope*qi + intercept) - qd.  The constraint is evaluated at
+// the innermost frequency of every realize, so avoiding the generic
+// function wrapper (a virtual dispatch plus a heap-allocated argument
+// Vector per call) is worthwhile.
+class LinearCouplerFunction : public SimTK::Function {
+private:
+    const double slope;
+    const double intercept;
+    const double scale;
+
+public:
+    LinearCouplerFunction(double slope, double intercept, double scale)
+        : slope(slope), intercept(intercept), scale(scale) {
+    }
+
+    double calcValue(const SimTK::Vector& x) const override {
+        return scale*(slope*x[0] + intercept) - x[1];
+    }
+
+    double calcDerivative(const SimTK::Array_<int>& derivComponents, const SimTK::Vector& x) const override {
+        if (derivComponents.size() == 1) {
+            if (derivComponents[0] == 0)
+                return scale*slope;
+            else if (derivComponents[0] == 1)
+                return -1;
+        }
+        return 0;
+    }
+
+    int getArgumentSize() const override {
+        return 2;
+    }
+    int getMaxDerivativeOrder() const override {
+        return 2;
+    }
+};
+
+// Flattened coupler for a polynomial coupling function.  Coefficients are
+// stored in order of decreasing power (the SimTK::Function::Polynomial
+// convention); value and analytic first and second derivatives come from
+// one Horner pass with no allocation.
+class PolynomialCouplerFunction : public SimTK::Function {
+private:
+    const SimTK::Vector coefficients;
+    const double scale;
+
+    void evaluate(double x, double& value, double& deriv1,
+            double& deriv2) const {
+        value = coefficients[0];
+        deriv1 = 0;
+        deriv2 = 0;
+        for (int i = 1; i < coefficients.size(); ++i) {
+            deriv2 = deriv2*x + deriv1;
+            deriv1 = deriv1*x + value;
+            value = value*x + coefficients[i];
+        }
+        deriv2 *= 2;
+    }
+
+public:
+    PolynomialCouplerFunction(const SimTK::Vector& coefficients, double scale)
+        : coefficients(coefficients), scale(scale) {
+    }
+
+    double calcValue(const SimTK::Vector& x) const override {
+        double value, deriv1, deriv2;
+        evaluate(x[0], value, deriv1, deriv2);
+        return scale*value - x[1];
+    }
+
+    double calcDerivative(const SimTK::Array_<int>& derivComponents, const SimTK::Vector& x) const override {
+        double value, deriv1, deriv2;
+        if (derivComponents.size() == 1) {
+            if (derivComponents[0] == 0) {
+                evaluate(x[0], value, deriv1, deriv2);
+                return scale*deriv1;
+            }
+            else if (derivComponents[0] == 1)
+                return -1;
+        }
+        else if (derivComponents.size() == 2
+                 && derivComponents[0] == 0 && derivComponents[1] == 0) {
+            evaluate(x[0], value, deriv1, deriv2);
+            return scale*deriv2;
+        }
+        return 0;
+    }
+
+    int getArgumentSize() const override {
+        return 2;
+    }
+    int getMaxDerivativeOrder() const override {
+        return 2;
+    }
+};
+
 
 //=============================================================================
 // STATICS
@@ -222,9 +323,26 @@ void CoordinateCouplerConstraint::extendAddToSystem(SimTK::MultibodySystem& syst
         throw (Exception(errorMessage));
     }
 
-    // Create and set the underlying coupler constraint function;
+    // Create and set the underlying coupler constraint function.  Recognize
+    // the common coupling-function types and install a flattened evaluation
+    // plan with analytic derivatives; everything else (including splines,
+    // whose SimTK counterparts already evaluate natively) goes through the
+    // generic compound wrapper.
     const Function& f = getFunction();
-    SimTK::Function *simtkCouplerFunction = new CompoundFunction(f.createSimTKFunction(), get_scale_factor());
+    SimTK::Function *simtkCouplerFunction = NULL;
+    if (const LinearFunction* linear = dynamic_cast<const LinearFunction*>(&f)) {
+        simtkCouplerFunction = new LinearCouplerFunction(linear->getSlope(),
+                linear->getIntercept(), get_scale_factor());
+    }
+    else if (const PolynomialFunction* polynomial =
+            dynamic_cast<const PolynomialFunction*>(&f)) {
+        simtkCouplerFunction = new PolynomialCouplerFunction(
+                polynomial->getCoefficients(), get_scale_factor());
+    }
+    else {
+        simtkCouplerFunction = new CompoundFunction(f.createSimTKFunction(),
+                get_scale_factor());
+    }
 
 
     // Now create a Simbody Constraint::CoordinateCoupler
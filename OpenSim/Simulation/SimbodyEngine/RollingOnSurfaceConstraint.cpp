@@ -98,6 +98,8 @@ void RollingOnSurfaceConstraint::extendConnectToModel(Model& aModel)
 
 void RollingOnSurfaceConstraint::extendAddToSystem(SimTK::MultibodySystem& system) const
 {
+    Super::extendAddToSystem(system);
+
     // Get underlying mobilized bodies
     SimTK::MobilizedBody roller = _rollingFrame->getMobilizedBody();
     SimTK::MobilizedBody surface = _surfaceFrame->getMobilizedBody();
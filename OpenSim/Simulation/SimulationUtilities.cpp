@@ -248,9 +248,10 @@ std::vector<std::string> OpenSim::createStateVariableNamesInSystemOrder(
     const auto svNames = model.getStateVariableNames();
     s.updY() = 0;
     std::vector<int> yIndices;
+    SimTK::Vector svValues; // reused buffer; filled in place each pass
     for (int iy = 0; iy < s.getNY(); ++iy) {
         s.updY()[iy] = SimTK::NaN;
-        const auto svValues = model.getStateVariableValues(s);
+        model.getStateVariableValues(s, svValues);
         for (int isv = 0; isv < svNames.size(); ++isv) {
             if (SimTK::isNaN(svValues[isv])) {
                 svNamesInSysOrder.push_back(svNames[isv]);
@@ -281,9 +282,10 @@ std::unordered_map<std::string, int> OpenSim::createSystemYIndexMap(
     auto s = model.getWorkingState();
     const auto svNames = model.getStateVariableNames();
     s.updY() = 0;
+    SimTK::Vector svValues; // reused buffer; filled in place each pass
     for (int iy = 0; iy < s.getNY(); ++iy) {
         s.updY()[iy] = SimTK::NaN;
-        const auto svValues = model.getStateVariableValues(s);
+        model.getStateVariableValues(s, svValues);
         for (int isv = 0; isv < svNames.size(); ++isv) {
             if (SimTK::isNaN(svValues[isv])) {
                 sysYIndices[svNames[isv]] = iy;
@@ -0,0 +1,56 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  StatePool.cpp                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "StatePool.h"
+
+#include <OpenSim/Common/Exception.h>
+
+using namespace OpenSim;
+
+SimTK::State& StatePool::acquire(const SimTK::State& source)
+{
+    if (_available.empty())
+        _available.emplace_back(new SimTK::State());
+
+    _outstanding.push_back(std::move(_available.back()));
+    _available.pop_back();
+
+    // Copy-assignment into the recycled slot reuses the slot's existing
+    // allocations; only a cold slot allocates.
+    SimTK::State& slot = *_outstanding.back();
+    slot = source;
+    return slot;
+}
+
+void StatePool::release(const SimTK::State& state)
+{
+    for (auto it = _outstanding.begin(); it != _outstanding.end(); ++it) {
+        if (it->get() == &state) {
+            _available.push_back(std::move(*it));
+            _outstanding.erase(it);
+            return;
+        }
+    }
+    OPENSIM_THROW(Exception,
+            "StatePool::release() was passed a State that is not "
+            "outstanding from this pool.");
+}
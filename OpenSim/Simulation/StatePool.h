@@ -0,0 +1,87 @@
+#ifndef OPENSIM_STATE_POOL_H_
+#define OPENSIM_STATE_POOL_H_
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  StatePool.h                             *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+
+#include <SimTKcommon.h>
+
+#include <memory>
+#include <vector>
+
+namespace OpenSim {
+
+/** A recycler for SimTK::State working copies.
+
+Solvers and tools that copy a State on every evaluation (e.g., CMC's
+per-step control computation) pay a heap allocation for each copy.
+A StatePool hands out reusable State slots instead: acquire() copy-assigns
+the source into a previously released slot, which reuses the slot's
+existing allocations, so steady-state use performs no allocation once the
+pool has warmed up.
+
+Usage is acquire/release:
+@code
+SimTK::State& working = pool.acquire(s);
+// ... use working as a scratch copy of s ...
+pool.release(working);
+@endcode
+
+A slot stays valid until it is released back to the pool; releasing it
+does not destroy its contents, only makes it available for reuse. The
+pool owns every State it hands out and destroys them all when it is
+itself destroyed, so a slot that is never released is not leaked — it is
+merely unavailable for reuse. StatePool is not thread-safe; give each
+thread its own pool (per-thread Model copies, the repository's usual
+parallel idiom, imply per-thread pools naturally). */
+class OSIMSIMULATION_API StatePool {
+public:
+    StatePool() = default;
+    // States are reused, not shared; a copied pool starts empty.
+    StatePool(const StatePool&) = delete;
+    StatePool& operator=(const StatePool&) = delete;
+
+    /** Obtain a State slot holding a copy of `source`. The returned
+    reference remains valid until release() is called with it (or the pool
+    is destroyed). */
+    SimTK::State& acquire(const SimTK::State& source);
+
+    /** Return a slot obtained from acquire() to the pool for reuse.
+    @throws Exception if `state` did not come from this pool or was
+            already released. */
+    void release(const SimTK::State& state);
+
+    /** Number of slots currently available for reuse. */
+    int getNumAvailable() const { return (int)_available.size(); }
+    /** Number of slots handed out by acquire() and not yet released. */
+    int getNumOutstanding() const { return (int)_outstanding.size(); }
+
+private:
+    std::vector<std::unique_ptr<SimTK::State>> _available;
+    std::vector<std::unique_ptr<SimTK::State>> _outstanding;
+
+}; // END of class StatePool
+
+} // namespace OpenSim
+
+#endif // OPENSIM_STATE_POOL_H_
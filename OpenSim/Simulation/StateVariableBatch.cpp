@@ -0,0 +1,59 @@
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  StateVariableBatch.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "StateVariableBatch.h"
+
+using namespace OpenSim;
+
+StateVariableBatch::StateVariableBatch(const Component& component,
+        const std::vector<std::string>& stateVariableNames)
+        : _component(&component), _names(stateVariableNames) {
+    _handles.reserve(_names.size());
+    for (const auto& name : _names)
+        _handles.push_back(component.getStateVariableHandle(name));
+}
+
+StateVariableBatch::StateVariableBatch(const Component& component)
+        : _component(&component) {
+    const Array<std::string> names = component.getStateVariableNames();
+    _names.reserve(names.getSize());
+    _handles.reserve(names.getSize());
+    for (int i = 0; i < names.getSize(); ++i) {
+        _names.push_back(names[i]);
+        _handles.push_back(component.getStateVariableHandle(names[i]));
+    }
+}
+
+SimTK::Vector StateVariableBatch::getValues(const SimTK::State& state) const {
+    return _component->getStateVariableValues(state, _handles);
+}
+
+void StateVariableBatch::getValues(
+        const SimTK::State& state, SimTK::Vector& values) const {
+    _component->getStateVariableValues(state, _handles, values);
+}
+
+void StateVariableBatch::setValues(
+        SimTK::State& state, const SimTK::Vector& values) const {
+    _component->setStateVariableValues(state, _handles, values);
+}
@@ -0,0 +1,102 @@
+#ifndef OPENSIM_STATE_VARIABLE_BATCH_H_
+#define OPENSIM_STATE_VARIABLE_BATCH_H_
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  StateVariableBatch.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ * Author(s): OpenSim Team                                                    *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimSimulationDLL.h"
+
+#include <OpenSim/Common/Component.h>
+
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+/** A named batch of state variables resolved once into
+Component::StateVariableHandle%s, so a driver loop can read or write all of
+them per step with one call and no per-variable string resolution.
+
+Setting state variables one name at a time costs a path split and a
+component-tree traversal per variable per step; across a scripting boundary
+(e.g. the Python bindings driving a reinforcement-learning environment) it
+also costs one language crossing per variable. A batch pays the resolution
+once, at construction, and afterwards moves all of its values in a single
+Vector:
+
+@code
+model.initSystem();
+StateVariableBatch coords(model, coordinatePaths);
+// per step:
+coords.setValues(state, actions);      // one call for all variables
+SimTK::Vector observed = coords.getValues(state);
+@endcode
+
+The order of values in every Vector is the order of the names given at
+construction. Like the handles it holds, a batch is valid only as long as
+the System it was resolved against; rebuild it after any call that
+recreates the System (e.g. Model::initSystem()).
+
+@ingroup simulationutil */
+class OSIMSIMULATION_API StateVariableBatch {
+public:
+    /** Resolve the named state variables (paths as returned by
+    Component::getStateVariableNames()) against the component, typically a
+    Model after initSystem(). Throws if any name does not resolve. */
+    StateVariableBatch(const Component& component,
+            const std::vector<std::string>& stateVariableNames);
+
+    /** Resolve every state variable of the component, in
+    Component::getStateVariableNames() order. */
+    explicit StateVariableBatch(const Component& component);
+
+    /** Number of state variables in this batch. */
+    int getSize() const { return int(_handles.size()); }
+
+    /** The state variable paths, in the order their values appear in the
+    Vectors exchanged by getValues()/setValues(). */
+    const std::vector<std::string>& getStateVariableNames() const {
+        return _names;
+    }
+
+    /** Read all batch values out of the state, in name order. */
+    SimTK::Vector getValues(const SimTK::State& state) const;
+
+    /** Read all batch values into a caller-supplied Vector so repeated
+    calls do not allocate; `values` is resized to getSize() if necessary. */
+    void getValues(const SimTK::State& state, SimTK::Vector& values) const;
+
+    /** Write all batch values into the state, in name order. As with
+    Component::setStateVariableValues(), this only sets the values; invoke
+    Model::assemble() or equilibrateMuscles() afterwards if constraints or
+    equilibrium must hold. */
+    void setValues(SimTK::State& state, const SimTK::Vector& values) const;
+
+private:
+    SimTK::ReferencePtr<const Component> _component;
+    std::vector<Component::StateVariableHandle> _handles;
+    std::vector<std::string> _names;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_STATE_VARIABLE_BATCH_H_
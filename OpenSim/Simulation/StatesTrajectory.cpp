@@ -24,6 +24,7 @@
 #include "StatesTrajectory.h"
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/HotPathCounters.h>
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Common/TableUtilities.h>
 #include <OpenSim/Simulation/Model/Model.h>
@@ -54,6 +55,7 @@ void StatesTrajectory::append(const SimTK::State& state) {
         OPENSIM_THROW_IF(!m_states.back().isConsistent(state),
           InconsistentState, state.getTime());
     }
+    HotPathCounters::increment(HotPathCounters::StateCopies);
     m_states.push_back(state);
 }
 
@@ -140,6 +142,7 @@ TimeSeriesTable StatesTrajectory::exportToTable(const Model& model,
     size_t numDepColumns = stateVars.size();
 
     // Fill up the table with the data.
+    SimTK::Vector stateValues; // reused buffer; filled in place each row
     for (size_t itime = 0; itime < getSize(); ++itime) {
         const auto& state = get(itime);
         TimeSeriesTable::RowVector row(static_cast<int>(numDepColumns));
@@ -147,7 +150,8 @@ TimeSeriesTable StatesTrajectory::exportToTable(const Model& model,
         // Get each state variable's value.
         if (requestedStateVars.empty()) {
             // This is *much* faster than getting the values one-by-one.
-            row = model.getStateVariableValues(state).transpose();
+            model.getStateVariableValues(state, stateValues);
+            row = stateValues.transpose();
         } else {
             for (unsigned icol = 0; icol < numDepColumns; ++icol) {
                 row[static_cast<int>(icol)] =
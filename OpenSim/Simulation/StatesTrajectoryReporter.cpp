@@ -26,14 +26,30 @@
 using namespace OpenSim;
 
 
+StatesTrajectoryReporter::StatesTrajectoryReporter() {
+    constructProperty_compact_storage(false);
+}
+
 void StatesTrajectoryReporter::clear() {
     m_states.clear();
+    m_compactStates.clear();
 }
 
 const StatesTrajectory& StatesTrajectoryReporter::getStates() const {
+    OPENSIM_THROW_IF_FRMOBJ(get_compact_storage(), Exception,
+            "This reporter has compact_storage enabled; "
+            "use getCompactStates() instead.");
     return m_states;
 }
 
+const CompactStatesTrajectory&
+StatesTrajectoryReporter::getCompactStates() const {
+    OPENSIM_THROW_IF_FRMOBJ(!get_compact_storage(), Exception,
+            "This reporter has compact_storage disabled; "
+            "use getStates() instead.");
+    return m_compactStates;
+}
+
 /*
 TODO we have to discuss if the trajectory should be cleared.
 void StatesTrajectoryReporter::extendRealizeInstance(const SimTK::State& state) const {
@@ -43,5 +59,8 @@ void StatesTrajectoryReporter::extendRealizeInstance(const SimTK::State& state)
 */
 
 void StatesTrajectoryReporter::implementReport(const SimTK::State& state) const {
-    m_states.append(state);
+    if (get_compact_storage())
+        m_compactStates.append(state);
+    else
+        m_states.append(state);
 }
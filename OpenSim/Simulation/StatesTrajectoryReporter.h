@@ -23,6 +23,7 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include "CompactStatesTrajectory.h"
 #include "StatesTrajectory.h"
 #include <OpenSim/Common/Reporter.h>
 
@@ -35,15 +36,33 @@ namespace OpenSim {
  * This class was introduced in v4.0 and is intended to replace the
  * StatesReporter analysis.
  *
+ * For long simulations with dense reporting, enable the compact_storage
+ * property to record only the times and continuous state variables (see
+ * CompactStatesTrajectory); access the result with getCompactStates().
+ *
  * @ingroup reporters
  */
 class OSIMSIMULATION_API StatesTrajectoryReporter : public AbstractReporter {
 OpenSim_DECLARE_CONCRETE_OBJECT(StatesTrajectoryReporter, AbstractReporter);
 
 public:
-    /** Access the accumulated states. */
-    const StatesTrajectory& getStates() const; 
-    /** Clear the accumulated states. */ 
+    OpenSim_DECLARE_PROPERTY(compact_storage, bool,
+            "Record only times and continuous state variables, sharing the "
+            "discrete variables across the trajectory (default: false). "
+            "Greatly reduces memory for long simulations; access the result "
+            "with getCompactStates() instead of getStates().");
+
+    StatesTrajectoryReporter();
+
+    /** Access the accumulated states.
+     * @throws Exception If compact_storage is enabled; use
+     *         getCompactStates() instead. */
+    const StatesTrajectory& getStates() const;
+    /** Access the accumulated states when compact_storage is enabled.
+     * @throws Exception If compact_storage is disabled; use getStates()
+     *         instead. */
+    const CompactStatesTrajectory& getCompactStates() const;
+    /** Clear the accumulated states. */
     void clear();
 
 protected:
@@ -59,6 +78,7 @@ private:
     // Mutable because we append during reporting. This is OK to do since
     // reporting never occurs for trial states.
     mutable StatesTrajectory m_states;
+    mutable CompactStatesTrajectory m_compactStates;
 };
 
 } // namespace
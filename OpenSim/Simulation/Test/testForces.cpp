@@ -66,6 +66,8 @@ void testExpressionBasedBushingForceRotational();
 void testElasticFoundation();
 void testHuntCrossleyForce();
 void testSmoothSphereHalfSpaceForce();
+void testStationPlaneContactForces();
+void testHuntCrossleyContactManager();
 void testCoordinateLimitForce();
 void testCoordinateLimitForceRotational();
 void testExpressionBasedPointToPointForce();
@@ -138,6 +140,18 @@ int main() {
         failures.push_back("testSmoothSphereHalfSpaceForce");
     }
 
+    try { testStationPlaneContactForces(); }
+    catch (const std::exception& e){
+        cout << e.what() <<endl;
+        failures.push_back("testStationPlaneContactForces");
+    }
+
+    try { testHuntCrossleyContactManager(); }
+    catch (const std::exception& e){
+        cout << e.what() <<endl;
+        failures.push_back("testHuntCrossleyContactManager");
+    }
+
     try { testCoordinateLimitForce(); }
     catch (const std::exception& e){
         cout << e.what() <<endl; failures.push_back("testCoordinateLimitForce");
@@ -1420,6 +1434,168 @@ void testSmoothSphereHalfSpaceForce()
     ASSERT(isEqual);
 }
 
+void testStationPlaneContactForces()
+{
+    using namespace SimTK;
+
+    Model model;
+    model.setName("StationPlaneContact");
+    model.setGravity(gravity_vec);
+
+    OpenSim::Body* foot = new OpenSim::Body("foot", 1.0, Vec3(0),
+            Inertia::sphere(0.1));
+    model.addBody(foot);
+    FreeJoint* free = new FreeJoint("ground_foot", model.getGround(), *foot);
+    model.addJoint(free);
+
+    StationPlaneContactForces* contact = new StationPlaneContactForces();
+    contact->setName("contact");
+    contact->addStation(*foot, Vec3(0.1, -0.05, 0.0));
+    contact->addStation(*foot, Vec3(-0.1, -0.05, 0.0));
+    model.addForce(contact);
+
+    State& s = model.initSystem();
+
+    // Pose the foot so both stations penetrate the plane while moving
+    // downward and sliding forward.
+    free->updCoordinate(FreeJoint::Coord::TranslationY).setValue(s, 0.02);
+    free->updCoordinate(FreeJoint::Coord::TranslationY).setSpeedValue(s, -0.1);
+    free->updCoordinate(FreeJoint::Coord::TranslationX).setSpeedValue(s, 0.3);
+    model.getMultibodySystem().realize(s, Stage::Velocity);
+
+    // The reported per-station forces must match a direct evaluation of the
+    // published force law from the station kinematics.
+    Array<double> values = contact->getRecordValues(s);
+    ASSERT(values.getSize() == 3*contact->getNumStations());
+    for (int i = 0; i < contact->getNumStations(); ++i) {
+        const Station& station = contact->get_stations(i);
+        const Vec3& pos = station.getLocationInGround(s);
+        const Vec3& vel = station.getVelocityInGround(s);
+        const double depth = -pos[1];
+        const double depthRate = -vel[1];
+        double fy = 0;
+        if (depth > 0)
+            fy = fmax(0, contact->get_stiffness()*pow(depth, 3)
+                    *(1 + contact->get_dissipation()*depthRate));
+        fy += 1.0*depth; // void stiffness
+        const double fx = -tanh(vel[0]
+                /contact->get_tangent_velocity_scaling_factor()/2)
+                *contact->get_friction_coefficient()*fy;
+
+        ASSERT_EQUAL(values[3*i+0], fx, 1e-10);
+        ASSERT_EQUAL(values[3*i+1], fy, 1e-10);
+        ASSERT_EQUAL(values[3*i+2], 0.0, 1e-10);
+
+        const Vec3 force = contact->calcContactForceOnStation(s, i);
+        ASSERT_EQUAL(force[0], fx, 1e-10);
+        ASSERT_EQUAL(force[1], fy, 1e-10);
+    }
+
+    // The batched force application must be consistent with dynamics.
+    model.getMultibodySystem().realize(s, Stage::Acceleration);
+
+    // Copying must preserve the stations.
+    StationPlaneContactForces* copyOfForce = contact->clone();
+    ASSERT(*copyOfForce == *contact);
+    delete copyOfForce;
+}
+
+void testHuntCrossleyContactManager()
+{
+    using namespace SimTK;
+
+    double radius = 0.1;
+    double stiffness = 1e6;
+    double dissipation = 0.5;
+    double mu_static = 0.8;
+    double mu_dynamic = 0.6;
+    double mu_viscous = 0.1;
+
+    Model model;
+    model.setName("ManagedContact");
+    // no gravity, so the only rigid-body forces are the contact forces
+    model.setGravity(Vec3(0));
+
+    OpenSim::Body* ball = new OpenSim::Body("ball", 1.0, Vec3(0),
+            Inertia::sphere(radius));
+    model.addBody(ball);
+    FreeJoint* free = new FreeJoint("ground_ball", model.getGround(), *ball);
+    model.addJoint(free);
+
+    // a second ball far from the floor and from the first ball, so its
+    // contacts should be pruned by the broad phase
+    OpenSim::Body* farBall = new OpenSim::Body("far_ball", 1.0, Vec3(0),
+            Inertia::sphere(radius));
+    model.addBody(farBall);
+    FreeJoint* farFree = new FreeJoint("ground_far_ball", model.getGround(),
+            *farBall);
+    model.addJoint(farFree);
+
+    model.addContactGeometry(new ContactHalfSpace(Vec3(0),
+            Vec3(0, 0, -0.5*Pi), model.updGround(), "floor"));
+    model.addContactGeometry(new ContactSphere(radius, Vec3(0), *ball,
+            "ball_sphere"));
+    model.addContactGeometry(new ContactSphere(radius, Vec3(0), *farBall,
+            "far_ball_sphere"));
+
+    HuntCrossleyContactManager* contact = new HuntCrossleyContactManager();
+    contact->setName("contact");
+    auto* params = new HuntCrossleyForce::ContactParameters(stiffness,
+            dissipation, mu_static, mu_dynamic, mu_viscous);
+    params->addGeometry("floor");
+    params->addGeometry("ball_sphere");
+    params->addGeometry("far_ball_sphere");
+    contact->addContactParameters(params);
+    model.addForce(contact);
+
+    State& s = model.initSystem();
+    ASSERT(contact->getNumSurfaces() == 3);
+
+    // Pose the first ball so it penetrates the floor while moving downward
+    // and sliding; park the second ball well away from everything.
+    free->updCoordinate(FreeJoint::Coord::TranslationY).setValue(s, 0.05);
+    free->updCoordinate(FreeJoint::Coord::TranslationY).setSpeedValue(s, -0.2);
+    free->updCoordinate(FreeJoint::Coord::TranslationX).setSpeedValue(s, 0.5);
+    farFree->updCoordinate(FreeJoint::Coord::TranslationX).setValue(s, 100.0);
+    farFree->updCoordinate(FreeJoint::Coord::TranslationY).setValue(s, 5.0);
+
+    contact->resetContactStatistics();
+    model.getMultibodySystem().realize(s, Stage::Dynamics);
+
+    // Of the three declared pairs, only ball-floor should reach the narrow
+    // phase; ball and far ball land in distant hash cells so their pair is
+    // never even bounding checked.
+    ASSERT(contact->getNumNarrowPhaseEvals() == 1);
+    ASSERT(contact->getNumAvoidedNarrowPhaseEvals() == 2);
+
+    // The applied force must match a direct evaluation of the force law:
+    // materials are identical so the combined stiffness is half of either.
+    double depth = radius - 0.05;
+    double xdot = 0.2;
+    double k = 0.5*stiffness;
+    double fH = (4.0/3.0)*k*depth*sqrt(radius*k*depth);
+    double fn = fH*(1 + 1.5*dissipation*xdot);
+    double vslip = 0.5;
+    double vrel = vslip/contact->getTransitionVelocity();
+    double ffriction = fn*(std::min(vrel, 1.0)
+            *(mu_dynamic + 2*(mu_static - mu_dynamic)/(1 + vrel*vrel))
+            + mu_viscous*vslip);
+
+    const Vector_<SpatialVec>& bodyForces =
+        model.getMultibodySystem().getRigidBodyForces(s, Stage::Dynamics);
+    const Vec3& forceOnBall = bodyForces[ball->getMobilizedBodyIndex()][1];
+    ASSERT_EQUAL(forceOnBall[0], -ffriction, 1e-10*fn);
+    ASSERT_EQUAL(forceOnBall[1], fn, 1e-10*fn);
+    ASSERT_EQUAL(forceOnBall[2], 0.0, 1e-10*fn);
+
+    // No force on the far ball, and the floor reaction balances the ball.
+    ASSERT_EQUAL(bodyForces[farBall->getMobilizedBodyIndex()][1].norm(),
+            0.0, 1e-12);
+    const Vec3& forceOnGround =
+        bodyForces[model.getGround().getMobilizedBodyIndex()][1];
+    ASSERT_EQUAL((forceOnBall + forceOnGround).norm(), 0.0, 1e-10*fn);
+}
+
 void testCoordinateLimitForce() {
     using namespace SimTK;
 
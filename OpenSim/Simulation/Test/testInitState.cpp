@@ -38,10 +38,15 @@ using namespace std;
 //==============================================================================
 void testStates(const string& modelFile);
 //==============================================================================
-// testMemoryUsage tests that repeated initialization of the state does not  
+// testMemoryUsage tests that repeated initialization of the state does not
 // cause the memory footprint of the process to increase significantly.
 //==============================================================================
 void testMemoryUsage(const string& modelFile);
+//==============================================================================
+// testSinglePassEquilibration tests that equilibrateMusclesSinglePass()
+// produces the same equilibrium state as the per-muscle equilibrateMuscles().
+//==============================================================================
+void testSinglePassEquilibration(const string& modelFile);
 
 static const int MAX_N_TRIES = 100;
 
@@ -52,6 +57,7 @@ int main()
         testStates("arm26.osim");
         testMemoryUsage("arm26.osim");
         testMemoryUsage("PushUpToesOnGroundWithMuscles.osim");
+        testSinglePassEquilibration("arm26.osim");
     }
     catch (const Exception& e) {
         cout << "testInitState failed: ";
@@ -186,3 +192,39 @@ void testMemoryUsage(const string& modelFile)
     ASSERT((leak_percent) < 0.5, __FILE__, __LINE__,
         "testMemoryUsage: state initialization leak > 0.5% of model memory footprint.");
 }
+
+void testSinglePassEquilibration(const string& modelFile)
+{
+    using namespace SimTK;
+
+    Model model(modelFile);
+    ControlSetController* controller = new ControlSetController();
+    controller->setControlSetFileName("arm26_StaticOptimization_controls.xml");
+    model.addController(controller);
+
+    State& state = model.initSystem();
+
+    // Equilibrate one copy of the default state per muscle and another copy
+    // in a single pass; the resulting states must agree.
+    State statePerMuscle = state;
+    State stateSinglePass = state;
+
+    model.equilibrateMuscles(statePerMuscle);
+    model.equilibrateMusclesSinglePass(stateSinglePass);
+
+    const Vector& yPerMuscle = statePerMuscle.getY();
+    const Vector& ySinglePass = stateSinglePass.getY();
+    for (int i = 0; i < yPerMuscle.size(); ++i) {
+        ASSERT_EQUAL(yPerMuscle[i], ySinglePass[i], 1e-10, __FILE__, __LINE__,
+            "Single-pass equilibration disagrees with equilibrateMuscles().");
+    }
+
+    // The single-pass variant must leave everything but the muscles'
+    // auxiliary states untouched.
+    ASSERT(max(abs(stateSinglePass.getQ() - state.getQ())) == 0.0,
+        __FILE__, __LINE__,
+        "Single-pass equilibration modified the coordinates.");
+    ASSERT(max(abs(stateSinglePass.getU() - state.getU())) == 0.0,
+        __FILE__, __LINE__,
+        "Single-pass equilibration modified the speeds.");
+}
@@ -29,10 +29,14 @@
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
 #include <OpenSim/Simulation/MarkersReference.h>
 #include <OpenSim/Simulation/BufferedOrientationsReference.h>
+#include <OpenSim/Simulation/BufferedMarkersReference.h>
 #include <OpenSim/Common/MarkerData.h>
 #include <OpenSim/Common/Constant.h>
 #include <OpenSim/Common/STOFileAdapter.h>
+#include <OpenSim/Simulation/OpenSense/IMUStreamReceiver.h>
+#include <OpenSim/Simulation/OpenSense/IMUTrackingSessionManager.h>
 #include <random>
+#include <thread>
 
 using namespace OpenSim;
 using namespace std;
@@ -83,6 +87,49 @@ void testUpdateMarkerWeights();
 // weights and marker error is being reduced as its weighting increases.
 void testTrackWithUpdateMarkerWeights();
 
+// Verify that the batched marker locations and station Jacobian agree
+// with the per-marker queries of the assembly condition.
+void testBatchedMarkerLocations();
+
+// Verify that latency-budgeted tracking accumulates timing statistics
+// and still solves the trial.
+void testLatencyBudgetedTracking();
+
+// Verify the per-frame diagnostics surface: solver-side recording of
+// queue depth, wait time and solve time into a table, and the streaming
+// reference's wait/drop counters.
+void testTrackingDiagnostics();
+
+// Verify the assembler convergence telemetry inherited from
+// AssemblySolver: one row of wall time, cost/error, and evaluation
+// counts per assemble() or track() call.
+void testAssemblerTelemetry();
+
+// Verify that the batched sensor orientations and errors agree with the
+// per-sensor queries of the assembly condition.
+void testBatchedSensorOrientations();
+
+// Verify that replaying loaded reference data through the buffered
+// references' background prefetch thread serves the same frames, in order,
+// as reading the tables directly.
+void testPrefetchedReferences();
+
+// Verify the live streaming pipeline: quaternion frames pushed through an
+// IMUStreamReceiver into a table-less BufferedOrientationsReference arrive
+// at the consumer converted, time-aligned, in order and without loss, and
+// the consumer terminates once the stream is finished and drained.
+void testLiveOrientationStreaming();
+
+// Verify the streaming orientation smoother: causal per-frame SLERP
+// blending with rate-independent time constant, pass-through seeding,
+// hemisphere alignment and exact exponential convergence to a held target.
+void testOrientationStreamFilter();
+
+// Verify that several streamed subjects can be tracked concurrently in one
+// process: sessions share nothing, workers only solve where frames are
+// queued, and each session recovers its own coordinate trajectory.
+void testMultiSessionTracking();
+
 // Verify that solver does not confuse/mismanage markers when reference
 // has more markers than the model, order is changed or marker reference
 // includes intervals with NaNs (no observation)
@@ -119,6 +166,60 @@ int main()
         failures.push_back("testTrackWithUpdateMarkerWeights");
     }
 
+    try { testBatchedMarkerLocations(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testBatchedMarkerLocations");
+    }
+
+    try { testLatencyBudgetedTracking(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testLatencyBudgetedTracking");
+    }
+
+    try { testTrackingDiagnostics(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testTrackingDiagnostics");
+    }
+
+    try { testAssemblerTelemetry(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testAssemblerTelemetry");
+    }
+
+    try { testBatchedSensorOrientations(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testBatchedSensorOrientations");
+    }
+
+    try { testPrefetchedReferences(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testPrefetchedReferences");
+    }
+
+    try { testLiveOrientationStreaming(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testLiveOrientationStreaming");
+    }
+
+    try { testOrientationStreamFilter(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testOrientationStreamFilter");
+    }
+
+    try { testMultiSessionTracking(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testMultiSessionTracking");
+    }
+
     try { testNumberOfMarkersMismatch(); }
     catch (const std::exception& e) {
         cout << e.what() << endl;
@@ -576,6 +677,648 @@ void testTrackWithUpdateMarkerWeights()
     }
 }
 
+void testBatchedMarkerLocations()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testBatchedMarkerLocations()"
+        << endl;
+
+    std::unique_ptr<Model> pendulum{ constructPendulumWithMarkers() };
+    Coordinate& coord = pendulum->getCoordinateSet()[0];
+
+    SimTK::State state = pendulum->initSystem();
+    coord.setValue(state, SimTK::Pi / 4);
+    StatesTrajectory states;
+    states.append(state);
+
+    SimTK::RowVector_<SimTK::Vec3> biases(3, SimTK::Vec3(0));
+    std::shared_ptr<MarkersReference> markersRef(
+            new MarkersReference(generateMarkerDataFromModelAndStates(
+                    *pendulum, states, biases),
+            Set<MarkerWeight>()));
+    markersRef->setDefaultWeight(1.0);
+
+    SimTK::Array_<CoordinateReference> coordRefs;
+    coord.setValue(state, 0.0);
+    InverseKinematicsSolver ikSolver(*pendulum, markersRef, coordRefs);
+    ikSolver.setAccuracy(1e-8);
+    ikSolver.assemble(state);
+
+    const int nm = ikSolver.getNumMarkersInUse();
+
+    // The batched locations must agree with the per-marker queries of the
+    // underlying assembly condition.
+    SimTK::Array_<SimTK::Vec3> batchedLocations;
+    SimTK::Matrix stationJacobian;
+    ikSolver.computeCurrentMarkerLocationsAndJacobian(batchedLocations,
+                                                      stationJacobian);
+
+    SimTK_ASSERT_ALWAYS(int(batchedLocations.size()) == nm,
+        "InverseKinematicsSolver computed wrong number of marker locations.");
+    SimTK_ASSERT_ALWAYS(
+        stationJacobian.nrow() == 3*nm && stationJacobian.ncol() == state.getNU(),
+        "InverseKinematicsSolver computed station Jacobian of wrong size.");
+
+    for (int i = 0; i < nm; ++i) {
+        const SimTK::Vec3 loc = ikSolver.computeCurrentMarkerLocation(i);
+        SimTK_ASSERT_ALWAYS(
+            (loc - batchedLocations[i]).norm() <= SimTK::SignificantReal,
+            "Batched marker location disagrees with per-marker query.");
+    }
+}
+
+void testLatencyBudgetedTracking()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testLatencyBudgetedTracking()"
+        << endl;
+
+    std::unique_ptr<Model> pendulum{ constructPendulumWithMarkers() };
+    Coordinate& coord = pendulum->getCoordinateSet()[0];
+
+    SimTK::State state = pendulum->initSystem();
+
+    const double refVal = SimTK::Pi / 3;
+    const double dt = 0.01;
+    const int numFrames = 20;
+    StatesTrajectory states;
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i*dt;
+        coord.setValue(state, refVal);
+        states.append(state);
+    }
+
+    SimTK::RowVector_<SimTK::Vec3> biases(3, SimTK::Vec3(0));
+    std::shared_ptr<MarkersReference> markersRef(
+            new MarkersReference(generateMarkerDataFromModelAndStates(
+                    *pendulum, states, biases),
+            Set<MarkerWeight>()));
+    markersRef->setDefaultWeight(1.0);
+
+    SimTK::Array_<CoordinateReference> coordRefs;
+    coord.setValue(state, 0.0);
+    InverseKinematicsSolver ikSolver(*pendulum, markersRef, coordRefs);
+    ikSolver.setAccuracy(1e-6);
+    // A generous budget: the pendulum solves far faster, so the working
+    // accuracy should never need to be loosened.
+    ikSolver.setTrackingLatencyBudget(1.0);
+
+    state.updTime() = 0.0;
+    ikSolver.assemble(state);
+
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i*dt;
+        ikSolver.track(state);
+    }
+
+    SimTK_ASSERT_ALWAYS(ikSolver.getNumTrackedFrames() == numFrames,
+        "Latency-budgeted track() miscounted the frames it timed.");
+    SimTK_ASSERT_ALWAYS(
+        ikSolver.getMeanTrackingTime() <= ikSolver.getPeakTrackingTime(),
+        "Mean tracking time cannot exceed the peak tracking time.");
+    SimTK_ASSERT_ALWAYS(ikSolver.getTrackingTimeJitter() >= 0,
+        "Tracking-time jitter cannot be negative.");
+    SimTK_ASSERT_ALWAYS(ikSolver.getNumBudgetOverruns() == 0,
+        "The pendulum should solve well within a 1 s budget.");
+
+    // the budgeted solve must still track the reference pose
+    SimTK_ASSERT_ALWAYS(abs(coord.getValue(state) - refVal) < 1e-3,
+        "Latency-budgeted track() failed to track the reference pose.");
+
+    ikSolver.resetTrackingStatistics();
+    SimTK_ASSERT_ALWAYS(ikSolver.getNumTrackedFrames() == 0 &&
+        ikSolver.getPeakTrackingTime() == 0,
+        "resetTrackingStatistics() failed to clear the statistics.");
+}
+
+void testTrackingDiagnostics()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testTrackingDiagnostics()"
+        << endl;
+
+    // Solver side: every track() call records one diagnostics row.
+    std::unique_ptr<Model> pendulum{ constructPendulumWithMarkers() };
+    Coordinate& coord = pendulum->getCoordinateSet()[0];
+
+    SimTK::State state = pendulum->initSystem();
+
+    const double refVal = SimTK::Pi / 3;
+    const double dt = 0.01;
+    const int numFrames = 10;
+    StatesTrajectory states;
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i*dt;
+        coord.setValue(state, refVal);
+        states.append(state);
+    }
+
+    SimTK::RowVector_<SimTK::Vec3> biases(3, SimTK::Vec3(0));
+    std::shared_ptr<MarkersReference> markersRef(
+            new MarkersReference(generateMarkerDataFromModelAndStates(
+                    *pendulum, states, biases),
+            Set<MarkerWeight>()));
+    markersRef->setDefaultWeight(1.0);
+
+    SimTK::Array_<CoordinateReference> coordRefs;
+    coord.setValue(state, 0.0);
+    InverseKinematicsSolver ikSolver(*pendulum, markersRef, coordRefs);
+    ikSolver.setAccuracy(1e-6);
+    ikSolver.setTrackingDiagnosticsEnabled(true);
+
+    state.updTime() = 0.0;
+    ikSolver.assemble(state);
+
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i*dt;
+        ikSolver.track(state);
+    }
+
+    const TimeSeriesTable& diagnostics =
+            ikSolver.getTrackingDiagnosticsTable();
+    SimTK_ASSERT_ALWAYS(int(diagnostics.getNumRows()) == numFrames,
+        "Diagnostics table does not have one row per tracked frame.");
+    const auto& solveTimes = diagnostics.getDependentColumn("solve_time");
+    const auto& frameTimes = diagnostics.getDependentColumn("time");
+    const auto& queueDepths = diagnostics.getDependentColumn("queue_depth");
+    for (int i = 0; i < numFrames; ++i) {
+        SimTK_ASSERT_ALWAYS(solveTimes[i] > 0,
+            "Recorded solve time must be positive.");
+        SimTK_ASSERT_ALWAYS(std::abs(frameTimes[i] - i*dt) < 1e-12,
+            "Recorded frame time does not match the tracked state time.");
+        // a table-backed marker reference has no queue to report
+        SimTK_ASSERT_ALWAYS(queueDepths[i] == 0,
+            "Queue depth should be zero without a streaming reference.");
+    }
+    // Disabling stops recording and clears the table.
+    ikSolver.setTrackingDiagnosticsEnabled(false);
+    SimTK_ASSERT_ALWAYS(
+        ikSolver.getTrackingDiagnosticsTable().getNumRows() == 0,
+        "Disabling diagnostics did not clear the table.");
+
+    // Reference side: wait/drop counters on the streaming queue.
+    BufferedOrientationsReference liveRef(
+            std::vector<std::string>{ "A", "B" });
+    liveRef.setQueueRingBufferSize(2);
+    liveRef.setDropFramesOnOverflow(true);
+    SimTK::RowVector_<SimTK::Rotation> row(2, SimTK::Rotation());
+    liveRef.putValues(0.0, row);
+    liveRef.putValues(0.1, row);
+    SimTK_ASSERT_ALWAYS(liveRef.getQueueDepth() == 2,
+        "Queue depth does not reflect the queued frames.");
+    // The ring is full; this frame must be shed, not block the producer.
+    liveRef.putValues(0.2, row);
+    SimTK_ASSERT_ALWAYS(liveRef.getNumDroppedFrames() == 1,
+        "Overflowing the ring buffer did not count a dropped frame.");
+
+    SimTK::Array_<SimTK::Rotation> values;
+    double poppedTime = liveRef.getNextValuesAndTime(values);
+    SimTK_ASSERT_ALWAYS(poppedTime == 0.0,
+        "Dropping on overflow must shed the newest frame, not the oldest.");
+    SimTK_ASSERT_ALWAYS(liveRef.getLastQueueDepth() == 2,
+        "Per-frame queue depth was not captured at the pop.");
+    SimTK_ASSERT_ALWAYS(liveRef.getNumFramesPopped() == 1 &&
+        liveRef.getLastWaitTime() >= 0 &&
+        liveRef.getTotalWaitTime() >= liveRef.getLastWaitTime() &&
+        liveRef.getPeakWaitTime() >= liveRef.getLastWaitTime(),
+        "Wait-time counters are inconsistent after a pop.");
+
+    liveRef.resetStreamingDiagnostics();
+    SimTK_ASSERT_ALWAYS(liveRef.getNumDroppedFrames() == 0 &&
+        liveRef.getNumFramesPopped() == 0 &&
+        liveRef.getTotalWaitTime() == 0,
+        "resetStreamingDiagnostics() failed to clear the counters.");
+}
+
+void testAssemblerTelemetry()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testAssemblerTelemetry()"
+        << endl;
+
+    std::unique_ptr<Model> pendulum{ constructPendulumWithMarkers() };
+    Coordinate& coord = pendulum->getCoordinateSet()[0];
+
+    SimTK::State state = pendulum->initSystem();
+
+    const double refVal = SimTK::Pi / 3;
+    const double dt = 0.01;
+    const int numFrames = 10;
+    StatesTrajectory states;
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i*dt;
+        coord.setValue(state, refVal);
+        states.append(state);
+    }
+
+    SimTK::RowVector_<SimTK::Vec3> biases(3, SimTK::Vec3(0));
+    std::shared_ptr<MarkersReference> markersRef(
+            new MarkersReference(generateMarkerDataFromModelAndStates(
+                    *pendulum, states, biases),
+            Set<MarkerWeight>()));
+    markersRef->setDefaultWeight(1.0);
+
+    SimTK::Array_<CoordinateReference> coordRefs;
+    coord.setValue(state, 0.0);
+    InverseKinematicsSolver ikSolver(*pendulum, markersRef, coordRefs);
+    ikSolver.setAccuracy(1e-6);
+    ikSolver.setRecordTelemetry(true);
+
+    state.updTime() = 0.0;
+    ikSolver.assemble(state);
+
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i*dt;
+        ikSolver.track(state);
+    }
+
+    const TimeSeriesTable& telemetry = ikSolver.getTelemetryTable();
+    // one row for the assemble() call plus one per tracked frame
+    SimTK_ASSERT_ALWAYS(int(telemetry.getNumRows()) == numFrames + 1,
+        "Telemetry table does not have one row per solver call.");
+
+    const auto& isAssemble = telemetry.getDependentColumn("is_assemble");
+    const auto& solveTimes = telemetry.getDependentColumn("solve_time_s");
+    const auto& goalEvals = telemetry.getDependentColumn("goal_evals");
+    const auto& errorNorms = telemetry.getDependentColumn("error_norm");
+    const auto& frameTimes = telemetry.getDependentColumn("time_s");
+    SimTK_ASSERT_ALWAYS(isAssemble[0] == 1 && isAssemble[1] == 0,
+        "The assemble() row must precede the track() rows.");
+    for (int i = 0; i <= numFrames; ++i) {
+        SimTK_ASSERT_ALWAYS(solveTimes[i] >= 0,
+            "Recorded solve time must be nonnegative.");
+        SimTK_ASSERT_ALWAYS(goalEvals[i] >= 0,
+            "Recorded evaluation counts must be nonnegative.");
+        SimTK_ASSERT_ALWAYS(SimTK::isFinite(errorNorms[i]),
+            "Recorded error norm must be finite.");
+    }
+    // the assemble() call should have cost goal evaluations
+    SimTK_ASSERT_ALWAYS(goalEvals[0] > 0,
+        "assemble() consumed no goal evaluations.");
+    for (int i = 1; i <= numFrames; ++i) {
+        SimTK_ASSERT_ALWAYS(
+            std::abs(frameTimes[i] - (i - 1)*dt) < 1e-12,
+            "Recorded state time does not match the tracked frame.");
+    }
+
+    // Recording can be paused and the rows discarded.
+    ikSolver.setRecordTelemetry(false);
+    state.updTime() = 0.0;
+    ikSolver.track(state);
+    SimTK_ASSERT_ALWAYS(
+        int(ikSolver.getTelemetryTable().getNumRows()) == numFrames + 1,
+        "Disabling recording must stop appending rows.");
+    ikSolver.clearTelemetry();
+    SimTK_ASSERT_ALWAYS(ikSolver.getTelemetryTable().getNumRows() == 0,
+        "clearTelemetry() did not discard the recorded rows.");
+}
+
+void testBatchedSensorOrientations()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testBatchedSensorOrientations()"
+        << endl;
+
+    std::unique_ptr<Model> leg{ constructLegWithOrientationFrames() };
+    const Coordinate& coord = leg->getCoordinateSet()[0];
+
+    SimTK::State state = leg->initSystem();
+    coord.setValue(state, SimTK::Pi / 6);
+    StatesTrajectory states;
+    states.append(state);
+
+    // bias one sensor so the batched errors are nontrivial
+    SimTK::RowVector_<SimTK::Rotation> biases(3, SimTK::Rotation());
+    biases[0] *= SimTK::Rotation(0.1, SimTK::XAxis);
+
+    std::shared_ptr<OrientationsReference> orientationsRef(
+            new OrientationsReference(
+                generateOrientationsDataFromModelAndStates(*leg,
+                    states, biases, 0.0, true)));
+
+    SimTK::Array_<CoordinateReference> coordRefs;
+    coord.setValue(state, 0.0);
+    InverseKinematicsSolver ikSolver(*leg, nullptr, orientationsRef,
+                                     coordRefs);
+    ikSolver.setAccuracy(1e-6);
+    ikSolver.assemble(state);
+
+    const int nos = ikSolver.getNumOrientationSensorsInUse();
+
+    // The batched orientations and errors must agree with the per-sensor
+    // queries of the underlying assembly condition.
+    SimTK::Array_<SimTK::Rotation> batchedOrientations;
+    SimTK::Array_<double> batchedErrors;
+    ikSolver.computeCurrentSensorOrientationsAndErrors(batchedOrientations,
+                                                       batchedErrors);
+
+    SimTK_ASSERT_ALWAYS(int(batchedOrientations.size()) == nos &&
+        int(batchedErrors.size()) == nos,
+        "InverseKinematicsSolver computed wrong number of sensor "
+        "orientations or errors.");
+
+    for (int i = 0; i < nos; ++i) {
+        const SimTK::Rotation R = ikSolver.computeCurrentSensorOrientation(i);
+        SimTK_ASSERT_ALWAYS(
+            (R.asMat33() - batchedOrientations[i].asMat33()).norm() <=
+                SimTK::SignificantReal,
+            "Batched sensor orientation disagrees with per-sensor query.");
+
+        const double err = ikSolver.computeCurrentOrientationError(i);
+        SimTK_ASSERT_ALWAYS(
+            abs(err - batchedErrors[i]) <= SimTK::SignificantReal,
+            "Batched sensor error disagrees with per-sensor query.");
+    }
+}
+
+void testPrefetchedReferences()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testPrefetchedReferences()"
+        << endl;
+
+    vector<std::string> labels{ "A", "B", "C" };
+    const size_t nc = labels.size();
+    const size_t nr = 20;
+
+    // Marker replay: each row's value encodes its row index so ordering
+    // mistakes are detectable.
+    TimeSeriesTable_<SimTK::Vec3> markerData;
+    markerData.setColumnLabels(labels);
+    for (size_t r{0}; r < nr; ++r) {
+        SimTK::RowVector_<SimTK::Vec3> row{ int(nc), SimTK::Vec3(double(r)) };
+        markerData.appendRow(0.1*r, row);
+    }
+
+    BufferedMarkersReference markersRef(markerData, Set<MarkerWeight>());
+    // a ring smaller than the table forces the prefetch thread to wait on
+    // the consumer rather than queue the whole table up front
+    markersRef.setQueueRingBufferSize(4);
+    markersRef.startPrefetch();
+
+    SimTK::Array_<SimTK::Vec3> values;
+    for (size_t r{0}; r < nr; ++r) {
+        markersRef.getValuesAtTime(0.1*r, values);
+        SimTK_ASSERT_ALWAYS(values.size() == nc,
+            "Prefetched marker frame has wrong number of values.");
+        for (size_t i{0}; i < nc; ++i) {
+            SimTK_ASSERT_ALWAYS(values[i] == SimTK::Vec3(double(r)),
+                "Prefetched marker frame served out of order.");
+        }
+    }
+    markersRef.stopPrefetch();
+
+    // Same replay through the buffered orientations reference.
+    TimeSeriesTable_<SimTK::Rotation> orientationData;
+    orientationData.setColumnLabels(labels);
+    for (size_t r{0}; r < nr; ++r) {
+        SimTK::RowVector_<SimTK::Rotation> row{ int(nc),
+            SimTK::Rotation(0.05*r, SimTK::XAxis) };
+        orientationData.appendRow(0.1*r, row);
+    }
+
+    BufferedOrientationsReference orientationsRef(orientationData);
+    orientationsRef.setQueueRingBufferSize(4);
+    orientationsRef.startPrefetch();
+
+    SimTK::Array_<SimTK::Rotation> rotations;
+    for (size_t r{0}; r < nr; ++r) {
+        orientationsRef.getValuesAtTime(0.1*r, rotations);
+        SimTK_ASSERT_ALWAYS(rotations.size() == nc,
+            "Prefetched orientation frame has wrong number of values.");
+        const SimTK::Rotation expected(0.05*r, SimTK::XAxis);
+        for (size_t i{0}; i < nc; ++i) {
+            SimTK_ASSERT_ALWAYS(
+                (rotations[i].asMat33() - expected.asMat33()).norm() <=
+                    SimTK::SignificantReal,
+                "Prefetched orientation frame served out of order.");
+        }
+    }
+    orientationsRef.stopPrefetch();
+}
+
+void testLiveOrientationStreaming()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testLiveOrientationStreaming()"
+        << endl;
+
+    vector<std::string> labels{ "A", "B", "C" };
+    const int nc = int(labels.size());
+    const int nframes = 20;
+
+    // A live reference has no backing table: sensor names only.
+    auto orientationsRef =
+            std::make_shared<BufferedOrientationsReference>(labels);
+    SimTK_ASSERT_ALWAYS(orientationsRef->getNumRefs() == nc,
+        "Live reference does not report its sensor count.");
+    // a ring smaller than the stream forces the producer to wait on the
+    // consumer rather than queue every frame up front
+    orientationsRef->setQueueRingBufferSize(4);
+
+    IMUStreamReceiver receiver(orientationsRef);
+    // sensor clock starts at 1000s; align the first frame to t=0
+    receiver.setTimeAlignment(0.0);
+    const SimTK::Rotation sensorToOpenSim(-0.5*SimTK::Pi, SimTK::XAxis);
+    receiver.setSensorToOpenSimRotation(sensorToOpenSim);
+
+    // Producer: push quaternion frames as an acquisition thread would
+    // (in-process ingestion; the UDP path funnels into the same call).
+    std::thread producer([&receiver, nc, nframes]() {
+        std::vector<SimTK::Quaternion> quaternions(nc);
+        for (int r{0}; r < nframes; ++r) {
+            const SimTK::Rotation rotation(0.05*r, SimTK::XAxis);
+            for (int i{0}; i < nc; ++i)
+                quaternions[i] = rotation.convertRotationToQuaternion();
+            receiver.pushFrame(1000.0 + 0.1*r, quaternions.data());
+        }
+        receiver.stop();
+    });
+
+    // Consumer: drain the stream the way the solver does, terminating once
+    // the producer has finished and the queue is empty.
+    SimTK::Array_<SimTK::Rotation> rotations;
+    int framesSeen = 0;
+    while (orientationsRef->hasNext() || orientationsRef->hasQueuedData()) {
+        const double time =
+                orientationsRef->getNextValuesAndTime(rotations);
+        if (SimTK::isNaN(time)) break; // finished while we were waiting
+        SimTK_ASSERT_ALWAYS(std::abs(time - 0.1*framesSeen) < 1e-12,
+            "Streamed frame timestamp was not aligned to the solve clock.");
+        SimTK_ASSERT_ALWAYS(int(rotations.size()) == nc,
+            "Streamed frame has wrong number of values.");
+        const SimTK::Rotation expected =
+                sensorToOpenSim * SimTK::Rotation(0.05*framesSeen,
+                                          SimTK::XAxis);
+        for (int i{0}; i < nc; ++i) {
+            SimTK_ASSERT_ALWAYS(
+                (rotations[i].asMat33() - expected.asMat33()).norm() <= 1e-12,
+                "Streamed frame served out of order or badly converted.");
+        }
+        ++framesSeen;
+    }
+    producer.join();
+
+    SimTK_ASSERT_ALWAYS(framesSeen == nframes,
+        "Consumer did not see every streamed frame.");
+    SimTK_ASSERT_ALWAYS(receiver.getNumFramesReceived() == nframes,
+        "Receiver miscounted the pushed frames.");
+}
+
+void testOrientationStreamFilter()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testOrientationStreamFilter()"
+        << endl;
+
+    const double tau = 0.1;
+    const double dt = 0.01;
+    OrientationStreamFilter filter(2, tau);
+    SimTK_ASSERT_ALWAYS(filter.getSmoothingTimeConstant() == tau,
+        "Filter does not report its time constant.");
+
+    const SimTK::Quaternion qStart =
+            SimTK::Rotation(0.2, SimTK::XAxis).convertRotationToQuaternion();
+    const double stepAngle = 0.5;
+    const SimTK::Quaternion qTarget =
+            SimTK::Rotation(0.2 + stepAngle, SimTK::XAxis)
+                    .convertRotationToQuaternion();
+
+    // The first frame seeds the state and passes through untouched.
+    SimTK::Quaternion frame[2] = { qStart, qStart };
+    filter.filterFrame(0.0, frame);
+    SimTK_ASSERT_ALWAYS((frame[0].asVec4() - qStart.asVec4()).norm() == 0,
+        "First frame did not pass through the filter unchanged.");
+
+    // Hold a stepped target: geodesic blending contracts the remaining
+    // angle by exactly exp(-dt/tau) per frame, so after n frames
+    // remaining = exp(-n*dt/tau)*step, independent of path
+    // discretization. Channel 1 streams the negated (same-rotation)
+    // quaternion; hemisphere alignment must give the same answer.
+    const int nframes = 10;
+    for (int r{1}; r <= nframes; ++r) {
+        frame[0] = qTarget;
+        frame[1] = SimTK::Quaternion(-qTarget[0], -qTarget[1], -qTarget[2],
+                -qTarget[3]);
+        filter.filterFrame(r*dt, frame);
+    }
+    const SimTK::Rotation target(qTarget);
+    const double expectedRemaining = std::exp(-nframes*dt/tau)*stepAngle;
+    for (int i{0}; i < 2; ++i) {
+        const SimTK::Rotation filtered(frame[i]);
+        const double remaining =
+                std::abs((~filtered*target).convertRotationToAngleAxis()[0]);
+        SimTK_ASSERT_ALWAYS(std::abs(remaining - expectedRemaining) < 1e-9,
+            "Filtered orientation did not converge at the expected "
+            "exponential rate.");
+    }
+
+    // A zero time constant makes the stage pass-through.
+    OrientationStreamFilter passThrough(1, 0.0);
+    SimTK::Quaternion q = qStart;
+    passThrough.filterFrame(0.0, &q);
+    q = qTarget;
+    passThrough.filterFrame(dt, &q);
+    SimTK_ASSERT_ALWAYS((q.asVec4() - qTarget.asVec4()).norm() == 0,
+        "Zero time constant did not pass frames through.");
+}
+
+void testMultiSessionTracking()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testMultiSessionTracking()"
+        << endl;
+
+    std::unique_ptr<Model> leg{ constructLegWithOrientationFrames() };
+
+    // Two subjects with distinct hip trajectories, so crossed-over frames
+    // would show up as the wrong coordinate values.
+    const int numSessions = 2;
+    const int nframes = 8;
+    const double dt = 0.1;
+    auto hipAngle = [](int subject, int frame) {
+        return (subject + 1)*0.05*frame;
+    };
+
+    std::vector<TimeSeriesTable_<SimTK::Rotation>> orientationData;
+    for (int subject{0}; subject < numSessions; ++subject) {
+        unique_ptr<Model> m{ leg->clone() };
+        SimTK::State state = m->initSystem();
+        StatesTrajectory states;
+        for (int r{0}; r < nframes; ++r) {
+            m->getCoordinateSet()[0].setValue(state, hipAngle(subject, r));
+            state.setTime(r*dt);
+            states.append(state);
+        }
+        SimTK::RowVector_<SimTK::Rotation> biases(3, SimTK::Rotation());
+        orientationData.push_back(generateOrientationsDataFromModelAndStates(
+                *m, states, biases, 0.0, false));
+    }
+
+    IMUTrackingSessionManager manager;
+    std::vector<std::shared_ptr<BufferedOrientationsReference>> references;
+    for (int subject{0}; subject < numSessions; ++subject) {
+        references.push_back(std::make_shared<BufferedOrientationsReference>(
+                orientationData[subject].getColumnLabels()));
+        int index = manager.addSession(*leg, references[subject]);
+        SimTK_ASSERT_ALWAYS(index == subject,
+            "Session manager did not hand out session indices in order.");
+    }
+    SimTK_ASSERT_ALWAYS(manager.getNumSessions() == numSessions,
+        "Session manager miscounted its sessions.");
+
+    // Per-session calls arrive serialized and in order, so each session
+    // records into its own slot without locking.
+    std::vector<std::vector<std::pair<double, double>>>
+            solvedHip(numSessions);
+    manager.setFrameHandler([&solvedHip](int session,
+                                    const SimTK::State& state) {
+        solvedHip[session].push_back({state.getTime(), state.getQ()[0]});
+    });
+
+    // One producer per subject, as the acquisition threads would be.
+    std::vector<std::thread> producers;
+    for (int subject{0}; subject < numSessions; ++subject) {
+        producers.emplace_back([&orientationData, &references, subject,
+                                       nframes]() {
+            for (int r{0}; r < nframes; ++r) {
+                SimTK::RowVector_<SimTK::Rotation> row{
+                    orientationData[subject].getRowAtIndex(r) };
+                references[subject]->putValues(
+                        orientationData[subject].getIndependentColumn()[r],
+                        row);
+            }
+            references[subject]->setFinished(true);
+        });
+    }
+
+    manager.setNumThreads(numSessions);
+    manager.run();
+    for (auto& producer : producers) producer.join();
+
+    for (int subject{0}; subject < numSessions; ++subject) {
+        SimTK_ASSERT_ALWAYS(
+            manager.getNumFramesSolved(subject) == nframes,
+            "Session did not solve every streamed frame.");
+        SimTK_ASSERT_ALWAYS(
+            int(solvedHip[subject].size()) == nframes,
+            "Frame handler was not called once per solved frame.");
+        for (int r{0}; r < nframes; ++r) {
+            SimTK_ASSERT_ALWAYS(
+                std::abs(solvedHip[subject][r].first - r*dt) < 1e-12,
+                "Session solved frames out of order or with wrong times.");
+            SimTK_ASSERT_ALWAYS(
+                std::abs(solvedHip[subject][r].second -
+                        hipAngle(subject, r)) < 1e-2,
+                "Session did not recover its own subject's trajectory.");
+        }
+        // The per-session solvers remain inspectable after the run.
+        SimTK_ASSERT_ALWAYS(
+            manager.getSolver(subject).getNumOrientationSensorsInUse() == 3,
+            "Session solver is not inspectable after the run.");
+    }
+}
+
 void testNumberOfMarkersMismatch()
 {
     cout << 
@@ -37,6 +37,19 @@ Manager Tests:
 4. testConstructors: Ensure different constructors work as intended.
 5. testIntegratorInterface: Ensure setting integrator options works as intended.
 6. testExceptions: Test that misuse actually triggers exceptions.
+7. testReinitializeWithManager: Reuse one Manager across several simulations
+   of a falling ball by rewinding it to stored states with reinitialize().
+8. testReportingInterval: Decimate state recording with
+   setReportingInterval() and check the final state is unaffected.
+9. testAllocationReporting: Count heap allocations per fixed integration
+   step and check the preconditions of the zero-steady-state-allocations
+   assertion.
+10. testEnsembleSimulator: Run an ensemble of falling-ball simulations with
+   per-sample initial conditions and check each returned trajectory.
+11. testCheckpointRestart: Checkpoint a pendulum simulation halfway, resume
+    it with a fresh Manager, and compare against the uninterrupted run.
+12. testExternalInputController: Feed muscle excitations into a running
+    integration through an ExternalInputController's lock-free input slots.
 
 //=============================================================================*/
 #include <OpenSim/Simulation/Model/Model.h>
@@ -44,7 +57,10 @@ Manager Tests:
 #include <OpenSim/Simulation/SimbodyEngine/FreeJoint.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Manager/EnsembleSimulator.h>
+#include <OpenSim/Common/AllocationTracker.h>
 #include <OpenSim/Common/LoadOpenSimLibrary.h>
+#include <OpenSim/Simulation/Control/ExternalInputController.h>
 #include <OpenSim/Simulation/Control/PrescribedController.h>
 #include <OpenSim/Common/Constant.h>
 
@@ -56,6 +72,14 @@ void testExcitationUpdatesWithManager();
 void testConstructors();
 void testIntegratorInterface();
 void testExceptions();
+void testReinitializeWithManager();
+void testReportingInterval();
+void testAllocationReporting();
+void testEnsembleSimulator();
+void testCheckpointRestart();
+void testExternalInputController();
+void testReplayCapture();
+void testIntegrationTiming();
 
 int main()
 {
@@ -97,6 +121,54 @@ int main()
         failures.push_back("testExceptions");
     }
 
+    try { testReinitializeWithManager(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testReinitializeWithManager");
+    }
+
+    try { testReportingInterval(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testReportingInterval");
+    }
+
+    try { testAllocationReporting(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testAllocationReporting");
+    }
+
+    try { testEnsembleSimulator(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testEnsembleSimulator");
+    }
+
+    try { testCheckpointRestart(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testCheckpointRestart");
+    }
+
+    try { testExternalInputController(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testExternalInputController");
+    }
+
+    try { testReplayCapture(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testReplayCapture");
+    }
+
+    try { testIntegrationTiming(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testIntegrationTiming");
+    }
+
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
         return 1;
@@ -478,3 +550,499 @@ void testExceptions()
     manager.setIntegratorAccuracy(1e-4);
     manager.setIntegratorMinimumStepSize(0.01);
 }
+
+void testReinitializeWithManager()
+{
+    cout << "Running testReinitializeWithManager" << endl;
+
+    using SimTK::Vec3;
+
+    Model model;
+    model.setName("ball");
+
+    auto ball = new Body("ball", 0.7, Vec3(0.1),
+        SimTK::Inertia::sphere(0.5));
+    model.addBody(ball);
+
+    auto freeJoint = new FreeJoint("freeJoint", model.getGround(), Vec3(0),
+        Vec3(0), *ball, Vec3(0), Vec3(0));
+    model.addJoint(freeJoint);
+
+    double g = 9.81;
+    model.setGravity(Vec3(0, -g, 0));
+
+    SimTK::State& state = model.initSystem();
+
+    const Coordinate& sliderCoord =
+        freeJoint->getCoordinate(FreeJoint::Coord::TranslationY);
+
+    // One Manager for all of the episodes; reinitialize() rewinds it to
+    // each episode's stored initial state instead of rebuilding the
+    // TimeStepper and integrator.
+    Manager manager(model);
+    state.setTime(0.0);
+    manager.initialize(state);
+
+    std::vector<double> initHeights = {0.0, 13.3, 6.5};
+    std::vector<double> initSpeeds = {0.0, 0.5, -0.5};
+    double duration = 1.0;
+    size_t n = initHeights.size();
+
+    for (size_t i = 0; i < n; ++i) {
+        sliderCoord.setValue(state, initHeights[i]);
+        sliderCoord.setSpeedValue(state, initSpeeds[i]);
+        state.setTime(0.0);
+
+        manager.reinitialize(state);
+        const SimTK::State& initState = manager.getState();
+
+        SimTK_TEST_EQ(initState.getTime(), 0.0);
+        SimTK_TEST_EQ(sliderCoord.getValue(initState), initHeights[i]);
+        SimTK_TEST_EQ(sliderCoord.getSpeedValue(initState), initSpeeds[i]);
+
+        state = manager.integrate(duration);
+
+        model.realizeVelocity(state);
+
+        double finalHeight =
+            initHeights[i] + initSpeeds[i]*duration - 0.5*g*duration*duration;
+        double finalSpeed = initSpeeds[i] - g*duration;
+        double sliderHeight = sliderCoord.getValue(state);
+        double sliderSpeed = sliderCoord.getSpeedValue(state);
+        cout << "Episode " << i << ": t = " << state.getTime() << ", h = "
+            << sliderHeight << ", v = " << sliderSpeed << " | Eq: h = "
+            << finalHeight << ", v = " << finalSpeed << endl;
+
+        SimTK_TEST_EQ(state.getTime(), duration);
+        SimTK_TEST_EQ(sliderHeight, finalHeight);
+        SimTK_TEST_EQ(sliderSpeed, finalSpeed);
+
+        // Each session should record only its own states.
+        SimTK_TEST(manager.getStateStorage().getFirstTime() == 0.0);
+    }
+}
+
+void testReportingInterval()
+{
+    cout << "Running testReportingInterval" << endl;
+
+    using SimTK::Vec3;
+
+    Model model;
+    model.setName("ball");
+
+    auto ball = new Body("ball", 0.7, Vec3(0.1),
+        SimTK::Inertia::sphere(0.5));
+    model.addBody(ball);
+
+    auto freeJoint = new FreeJoint("freeJoint", model.getGround(), Vec3(0),
+        Vec3(0), *ball, Vec3(0), Vec3(0));
+    model.addJoint(freeJoint);
+
+    double g = 9.81;
+    model.setGravity(Vec3(0, -g, 0));
+
+    SimTK::State& state = model.initSystem();
+
+    const Coordinate& sliderCoord =
+        freeJoint->getCoordinate(FreeJoint::Coord::TranslationY);
+
+    double initHeight = 10.0;
+    double duration = 1.0;
+    SimTK::Vector dts(10, duration/10.0);
+
+    // Baseline: record every fixed step.
+    int fullSize = 0;
+    {
+        Manager manager(model);
+        manager.setUseSpecifiedDT(true);
+        manager.setDTArray(dts, 0.0);
+        ASSERT_THROW(Exception, manager.setReportingInterval(0));
+        sliderCoord.setValue(state, initHeight);
+        sliderCoord.setSpeedValue(state, 0.0);
+        state.setTime(0.0);
+        manager.initialize(state);
+        manager.integrate(duration);
+        fullSize = manager.getStateStorage().getSize();
+    }
+
+    // Decimated: record only every 4th step plus the first and last.
+    {
+        Manager manager(model);
+        manager.setUseSpecifiedDT(true);
+        manager.setDTArray(dts, 0.0);
+        manager.setReportingInterval(4);
+        sliderCoord.setValue(state, initHeight);
+        sliderCoord.setSpeedValue(state, 0.0);
+        state.setTime(0.0);
+        manager.initialize(state);
+        const SimTK::State& finalState = manager.integrate(duration);
+
+        // Decimation must not change the trajectory itself.
+        double finalHeight = initHeight - 0.5*g*duration*duration;
+        SimTK_TEST_EQ(finalState.getTime(), duration);
+        SimTK_TEST_EQ(sliderCoord.getValue(finalState), finalHeight);
+
+        // Fewer rows were recorded, but the last row is the final state.
+        const Storage& decimated = manager.getStateStorage();
+        cout << "Recorded " << decimated.getSize() << " of " << fullSize
+            << " state rows." << endl;
+        SimTK_TEST(decimated.getSize() < fullSize);
+        SimTK_TEST_EQ(decimated.getLastTime(), duration);
+    }
+}
+
+void testAllocationReporting()
+{
+    cout << "Running testAllocationReporting" << endl;
+
+    using SimTK::Vec3;
+
+    Model model;
+    model.setName("ball");
+
+    auto ball = new Body("ball", 0.7, Vec3(0.1),
+        SimTK::Inertia::sphere(0.5));
+    model.addBody(ball);
+
+    auto freeJoint = new FreeJoint("freeJoint", model.getGround(), Vec3(0),
+        Vec3(0), *ball, Vec3(0), Vec3(0));
+    model.addJoint(freeJoint);
+
+    model.setGravity(Vec3(0, -9.81, 0));
+
+    SimTK::State& state = model.initSystem();
+
+    const Coordinate& sliderCoord =
+        freeJoint->getCoordinate(FreeJoint::Coord::TranslationY);
+
+    double duration = 1.0;
+    const int numSteps = 10;
+    SimTK::Vector dts(numSteps, duration/numSteps);
+
+    // Recording mode: one count per fixed integration step. The counts are
+    // meaningful only when the build intercepts the heap, but the bookkeeping
+    // works in every build flavor.
+    {
+        Manager manager(model);
+        manager.setUseSpecifiedDT(true);
+        manager.setDTArray(dts, 0.0);
+        manager.setRecordAllocationsPerStep(true);
+        sliderCoord.setValue(state, 10.0);
+        sliderCoord.setSpeedValue(state, 0.0);
+        state.setTime(0.0);
+        manager.initialize(state);
+        manager.integrate(duration);
+
+        const std::vector<unsigned long long>& counts =
+            manager.getAllocationsPerStep();
+        SimTK_TEST(static_cast<int>(counts.size()) == numSteps);
+        if (!AllocationTracker::isAvailable()) {
+            for (unsigned long long count : counts)
+                SimTK_TEST(count == 0);
+        }
+        SimTK_TEST(!AllocationTracker::isEnabled());
+    }
+
+    // The zero-steady-state-allocations assertion rejects bad setups up
+    // front: a negative warm-up, and a variable-step integrator.
+    {
+        Manager manager(model);
+        ASSERT_THROW(Exception,
+            manager.setAssertZeroSteadyStateAllocations(true, -1));
+        manager.setAssertZeroSteadyStateAllocations(true);
+        sliderCoord.setValue(state, 10.0);
+        sliderCoord.setSpeedValue(state, 0.0);
+        state.setTime(0.0);
+        manager.initialize(state);
+        ASSERT_THROW(Exception, manager.integrate(duration));
+    }
+}
+
+void testEnsembleSimulator()
+{
+    cout << "Running testEnsembleSimulator" << endl;
+
+    using SimTK::Vec3;
+
+    Model model;
+    model.setName("ball");
+
+    auto ball = new Body("ball", 0.7, Vec3(0.1),
+        SimTK::Inertia::sphere(0.5));
+    model.addBody(ball);
+
+    auto freeJoint = new FreeJoint("freeJoint", model.getGround(), Vec3(0),
+        Vec3(0), *ball, Vec3(0), Vec3(0));
+    model.addJoint(freeJoint);
+
+    double g = 9.81;
+    model.setGravity(Vec3(0, -g, 0));
+    model.initSystem();
+
+    // Each sample drops the ball from its own height with its own speed.
+    int numSamples = 8;
+    double duration = 1.0;
+    std::vector<double> initHeights(numSamples), initSpeeds(numSamples);
+    for (int i = 0; i < numSamples; ++i) {
+        initHeights[i] = 2.0 + 0.5*i;
+        initSpeeds[i] = -0.25 + 0.1*i;
+    }
+
+    EnsembleSimulator ensemble(model);
+    ensemble.setNumThreads(2);
+
+    auto trajectories = ensemble.simulate(numSamples, duration,
+        [&](Model& workerModel, SimTK::State& s, int sample) {
+            // TranslationY of the worker model's free joint
+            const Coordinate& coord = workerModel.getCoordinateSet()[4];
+            coord.setValue(s, initHeights[sample]);
+            coord.setSpeedValue(s, initSpeeds[sample]);
+            s.setTime(0.0);
+        });
+
+    SimTK_TEST(trajectories.size() == size_t(numSamples));
+
+    const Coordinate& sliderCoord =
+        freeJoint->getCoordinate(FreeJoint::Coord::TranslationY);
+
+    for (int i = 0; i < numSamples; ++i) {
+        const StatesTrajectory& traj = trajectories[i];
+        SimTK_TEST(traj.getSize() > 0);
+
+        const SimTK::State& finalState = traj.back();
+
+        double finalHeight = initHeights[i] + initSpeeds[i]*duration
+            - 0.5*g*duration*duration;
+        double finalSpeed = initSpeeds[i] - g*duration;
+
+        cout << "Sample " << i << ": h = "
+            << sliderCoord.getValue(finalState) << " | Eq: h = "
+            << finalHeight << endl;
+
+        SimTK_TEST_EQ(finalState.getTime(), duration);
+        SimTK_TEST_EQ_TOL(sliderCoord.getValue(finalState), finalHeight,
+            1e-6);
+        SimTK_TEST_EQ_TOL(sliderCoord.getSpeedValue(finalState), finalSpeed,
+            1e-6);
+    }
+}
+
+void testCheckpointRestart()
+{
+    cout << "Running testCheckpointRestart" << endl;
+
+    using SimTK::Vec3;
+
+    Model pendulum;
+    pendulum.setName("pendulum");
+
+    auto rod = new Body("rod", 0.54321, SimTK::Vec3(0.1, 0.5, 0.2),
+        SimTK::Inertia::cylinderAlongY(0.025, 0.55));
+    pendulum.addBody(rod);
+
+    auto pin = new PinJoint("pin", pendulum.getGround(), Vec3(0), Vec3(0),
+        *rod, Vec3(0), Vec3(0));
+    pendulum.addJoint(pin);
+
+    SimTK::State state = pendulum.initSystem();
+    const Coordinate& coord = pin->getCoordinate(PinJoint::Coord::RotationZ);
+    coord.setValue(state, 0.5);
+
+    const std::string checkpointFile = "testManager_checkpoint.txt";
+
+    // Reference run: integrate to 1.0, checkpointing halfway.
+    Manager manager(pendulum);
+    state.setTime(0.0);
+    manager.initialize(state);
+    state = manager.integrate(0.5);
+    manager.writeCheckpoint(checkpointFile);
+    double angleAtCheckpoint = coord.getValue(state);
+    double speedAtCheckpoint = coord.getSpeedValue(state);
+    state = manager.integrate(1.0);
+    double referenceAngle = coord.getValue(state);
+
+    // Resume run: a fresh Manager picks the simulation up at t = 0.5.
+    Manager resumed(pendulum);
+    resumed.restoreCheckpoint(checkpointFile);
+    const SimTK::State& restored = resumed.getState();
+
+    // The checkpointed state round-trips exactly.
+    SimTK_TEST(restored.getTime() == 0.5);
+    SimTK_TEST(coord.getValue(restored) == angleAtCheckpoint);
+    SimTK_TEST(coord.getSpeedValue(restored) == speedAtCheckpoint);
+
+    const SimTK::State& finalState = resumed.integrate(1.0);
+
+    cout << "Reference angle = " << referenceAngle << " | resumed angle = "
+        << coord.getValue(finalState) << endl;
+
+    // The resumed trajectory agrees with the uninterrupted run to within
+    // the integrator's accuracy.
+    SimTK_TEST_EQ_TOL(coord.getValue(finalState), referenceAngle, 1e-6);
+
+    std::remove(checkpointFile.c_str());
+}
+
+void testExternalInputController()
+{
+    cout << "Running testExternalInputController" << endl;
+    LoadOpenSimLibrary("osimActuators");
+    Model arm("arm26.osim");
+
+    const Set<Muscle>& muscleSet = arm.getMuscles();
+    ExternalInputController* controller = new ExternalInputController();
+    controller->addActuator(muscleSet.get(0));
+    arm.addController(controller);
+
+    SimTK::State& state = arm.initSystem();
+    state.setTime(0);
+
+    SimTK_TEST(controller->getNumInputSlots() == 1);
+    SimTK_TEST_EQ(controller->getInputValue(0), 0.0);
+    ASSERT_THROW(Exception, controller->setInputValue(1, 0.0));
+    ASSERT_THROW(Exception, controller->setInputValue(-1, 0.0));
+
+    // Feed a new excitation in before each integration window, as a
+    // hardware thread would, without restarting the Manager.
+    Manager manager(arm);
+    manager.initialize(state);
+    double stepsize = 0.01;
+    for (int i = 0; i < 3; ++i) {
+        double excitation = 0.3 + 0.2*i; // 0.3, 0.5, 0.7
+        controller->setInputValue(0, excitation);
+        SimTK_TEST_EQ(controller->getInputValue(0), excitation);
+
+        state = manager.integrate(stepsize*(i + 1));
+        arm.realizeDynamics(state);
+        double finalExcitation = muscleSet.get(0).getExcitation(state);
+        cout << state.getTime() << " " << excitation << " "
+            << finalExcitation << endl;
+        SimTK_TEST_EQ(excitation, finalExcitation);
+    }
+}
+
+namespace {
+    // Build the muscle-driven arm with the same prescribed control twice:
+    // once for the captured run and once, as a fresh instance, for the
+    // replay, the way a workstation would reload the model a farm job ran.
+    Model createReplayArm()
+    {
+        Model arm("arm26.osim");
+        PrescribedController* controller = new PrescribedController();
+        controller->addActuator(arm.getMuscles().get(0));
+        controller->prescribeControlForActuator(0, new Constant(0.3));
+        arm.addController(controller);
+        return arm;
+    }
+}
+
+void testReplayCapture()
+{
+    cout << "Running testReplayCapture" << endl;
+    LoadOpenSimLibrary("osimActuators");
+
+    Model arm = createReplayArm();
+    SimTK::State state = arm.initSystem();
+    state.setTime(0.0);
+
+    const int numSteps = 10;
+    const double dt = 0.005;
+    SimTK::Vector dts(numSteps);
+    dts = dt;
+
+    // Captured run: fixed steps so the sampling grid is part of the inputs.
+    Manager manager(arm);
+    manager.setDTArray(dts, 0.0);
+    manager.setUseSpecifiedDT(true);
+    manager.setRecordReplay(true);
+    manager.initialize(state);
+    state = manager.integrate(numSteps*dt);
+    const SimTK::Vector referenceFinal = arm.getStateVariableValues(state);
+
+    // One control sample at the start plus one per completed step.
+    const TimeSeriesTable& controls = manager.getReplayControls();
+    SimTK_TEST(static_cast<int>(controls.getNumRows()) == numSteps + 1);
+    SimTK_TEST(static_cast<int>(controls.getNumColumns()) ==
+        arm.getNumControls());
+
+    const std::string replayFile = "testManager_replay.txt";
+    manager.writeReplay(replayFile);
+
+    // Writing a replay without having captured one is an error.
+    Manager uncaptured(arm);
+    ASSERT_THROW(Exception, uncaptured.writeReplay("unused_replay.txt"));
+
+    // Re-execute on a fresh model instance; on one machine and build the
+    // replay reproduces the captured trajectory exactly.
+    Model armReplay = createReplayArm();
+    const SimTK::State replayedState =
+        Manager::replay(armReplay, replayFile);
+    SimTK_TEST(replayedState.getTime() == numSteps*dt);
+    const SimTK::Vector replayedFinal =
+        armReplay.getStateVariableValues(replayedState);
+    SimTK_TEST(replayedFinal.size() == referenceFinal.size());
+    for (int i = 0; i < referenceFinal.size(); ++i)
+        SimTK_TEST(replayedFinal[i] == referenceFinal[i]);
+
+    std::remove(replayFile.c_str());
+}
+
+void testIntegrationTiming()
+{
+    cout << "Running testIntegrationTiming" << endl;
+
+    using SimTK::Vec3;
+
+    Model pendulum;
+    pendulum.setName("pendulum");
+
+    auto rod = new Body("rod", 0.54321, SimTK::Vec3(0.1, 0.5, 0.2),
+        SimTK::Inertia::cylinderAlongY(0.025, 0.55));
+    pendulum.addBody(rod);
+
+    auto pin = new PinJoint("pin", pendulum.getGround(), Vec3(0), Vec3(0),
+        *rod, Vec3(0), Vec3(0));
+    pendulum.addJoint(pin);
+
+    SimTK::State state = pendulum.initSystem();
+    pin->getCoordinate(PinJoint::Coord::RotationZ).setValue(state, 0.5);
+
+    Manager manager(pendulum);
+
+    // Before any integration the rate getters have nothing to report.
+    SimTK_TEST(SimTK::isNaN(manager.getLastRealTimeFactor()));
+    SimTK_TEST(SimTK::isNaN(manager.getLastStepsPerSecond()));
+
+    state.setTime(0.0);
+    manager.setReportTiming(true);
+    manager.initialize(state);
+    state = manager.integrate(0.5);
+
+    SimTK_TEST(manager.getLastIntegrationWallTime() > 0);
+    SimTK_TEST_EQ_TOL(manager.getLastIntegrationSimTime(), 0.5, 1e-12);
+    SimTK_TEST(manager.getLastNumStepsTaken() > 0);
+    SimTK_TEST_EQ_TOL(manager.getLastRealTimeFactor(),
+        manager.getLastIntegrationSimTime() /
+            manager.getLastIntegrationWallTime(), 1e-12);
+    SimTK_TEST_EQ_TOL(manager.getLastStepsPerSecond(),
+        manager.getLastNumStepsTaken() /
+            manager.getLastIntegrationWallTime(), 1e-12);
+
+    // The realize breakdown is only collected while the realize-cost
+    // profiler is recording; otherwise it reads zero.
+    const std::vector<double>& stageSeconds =
+        manager.getLastRealizeStageSeconds();
+    SimTK_TEST(stageSeconds.size() == 3);
+    SimTK_TEST(stageSeconds[0] == 0 && stageSeconds[1] == 0 &&
+        stageSeconds[2] == 0);
+
+    Component::startRealizeProfiling();
+    manager.reinitialize(state);
+    state = manager.integrate(1.0);
+    Component::stopRealizeProfiling();
+
+    SimTK_TEST_EQ_TOL(manager.getLastIntegrationSimTime(), 0.5, 1e-12);
+    for (int i = 0; i < 3; ++i)
+        SimTK_TEST(manager.getLastRealizeStageSeconds()[i] >= 0);
+}
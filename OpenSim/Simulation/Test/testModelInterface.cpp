@@ -22,16 +22,24 @@
 
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/ModelWorkingContext.h>
 #include <OpenSim/Simulation/Model/PhysicalOffsetFrame.h>
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
 #include <OpenSim/Common/LoadOpenSimLibrary.h>
 
+#include <thread>
+#include <vector>
+
 using namespace OpenSim;
 using namespace std;
 
 void testModelFinalizePropertiesAndConnections();
 void testModelTopologyErrors();
+void testRedundantInitSystem();
+void testCoordinateSnapshot();
+void testParallelPathComputation();
+void testSharedModelWorkingContexts();
 
 int main() {
     LoadOpenSimLibrary("osimActuators");
@@ -39,6 +47,10 @@ int main() {
     SimTK_START_TEST("testModelInterface");
         SimTK_SUBTEST(testModelFinalizePropertiesAndConnections);
         SimTK_SUBTEST(testModelTopologyErrors);
+        SimTK_SUBTEST(testRedundantInitSystem);
+        SimTK_SUBTEST(testCoordinateSnapshot);
+        SimTK_SUBTEST(testParallelPathComputation);
+        SimTK_SUBTEST(testSharedModelWorkingContexts);
     SimTK_END_TEST();
 }
 
@@ -227,3 +239,163 @@ void testModelTopologyErrors()
 
     ASSERT_THROW(JointFramesHaveSameBaseFrame, degenerate.initSystem());
 }
+
+void testRedundantInitSystem()
+{
+    Model model("arm26.osim");
+    // retain a reference to a subcomponent before the system is built;
+    // edits through it flip only the Body's up-to-date flag, not the
+    // Model's own
+    Body& body = model.updBodySet()[1];
+    SimTK::State& state = model.initSystem();
+    const double massBefore = model.getTotalMass(state);
+    const SimTK::MultibodySystem* sysBefore = &model.getSystem();
+
+    // with no edits since the last call, initSystemIfNeeded() reuses the
+    // existing System and only reinitializes the state
+    state = model.initSystemIfNeeded();
+    ASSERT(&model.getSystem() == sysBefore);
+    model.realizeDynamics(state);
+
+    // an edit through the retained reference must still be seen and force
+    // a genuine rebuild, so build-time quantities take the new value
+    const double bodyMass = body.get_mass();
+    body.upd_mass() = 2.0*bodyMass;
+    ASSERT(model.isObjectUpToDateWithProperties());
+    ASSERT(!body.isObjectUpToDateWithProperties());
+    state = model.initSystemIfNeeded();
+    ASSERT(model.isValidSystem());
+    ASSERT_EQUAL(massBefore + bodyMass, model.getTotalMass(state), 1e-10);
+    model.realizeDynamics(state);
+
+    // initSystem() itself always rebuilds, edits or not
+    state = model.initSystem();
+    ASSERT_EQUAL(massBefore + bodyMass, model.getTotalMass(state), 1e-10);
+    model.realizeDynamics(state);
+}
+
+void testCoordinateSnapshot()
+{
+    Model model("arm26.osim");
+
+    // the snapshot requires an initialized system
+    ASSERT_THROW(Exception, model.getCoordinateSnapshot());
+
+    model.initSystem();
+    const auto& snapshot = model.getCoordinateSnapshot();
+    const CoordinateSet& coords = model.getCoordinateSet();
+    ASSERT((int)snapshot.paths.size() == coords.getSize());
+    for (int i = 0; i < coords.getSize(); ++i) {
+        const Coordinate& coord = coords[i];
+        ASSERT(snapshot.paths[i] == coord.getAbsolutePathString());
+        ASSERT(snapshot.rangeMin[i] == coord.getRangeMin());
+        ASSERT(snapshot.rangeMax[i] == coord.getRangeMax());
+        ASSERT(snapshot.defaultValues[i] == coord.getDefaultValue());
+        ASSERT(snapshot.defaultSpeeds[i] == coord.getDefaultSpeedValue());
+        ASSERT(snapshot.clamped[i] == coord.getDefaultClamped());
+        ASSERT(snapshot.locked[i] == coord.getDefaultLocked());
+    }
+
+    // the snapshot is rebuilt when the state is reinitialized
+    coords[0].setRangeMin(coords[0].getRangeMin() - 0.1);
+    model.initSystem();
+    ASSERT(model.getCoordinateSnapshot().rangeMin[0] ==
+            coords[0].getRangeMin());
+}
+
+void testParallelPathComputation()
+{
+    // Muscle path lengths computed with the parallel path computation flag
+    // set must match the lengths computed serially, pose for pose.
+    Model serialModel("arm26.osim");
+    Model parallelModel("arm26.osim");
+    parallelModel.setUseParallelPathComputation(true);
+    ASSERT(parallelModel.getUseParallelPathComputation());
+
+    SimTK::State sSerial = serialModel.initSystem();
+    SimTK::State sParallel = parallelModel.initSystem();
+
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(0);
+    for (int trial = 0; trial < 5; ++trial) {
+        for (int i = 0; i < serialModel.getCoordinateSet().getSize(); ++i) {
+            const Coordinate& coord = serialModel.getCoordinateSet()[i];
+            const double value = coord.getRangeMin() + random.getValue() *
+                (coord.getRangeMax() - coord.getRangeMin());
+            coord.setValue(sSerial, value);
+            parallelModel.getCoordinateSet()[i].setValue(sParallel, value);
+        }
+        serialModel.realizePosition(sSerial);
+        parallelModel.realizePosition(sParallel);
+
+        const auto& muscles = serialModel.getMuscles();
+        for (int i = 0; i < muscles.getSize(); ++i) {
+            ASSERT_EQUAL(muscles[i].getGeometryPath().getLength(sSerial),
+                parallelModel.getMuscles()[i].getGeometryPath()
+                    .getLength(sParallel),
+                SimTK::Eps, __FILE__, __LINE__,
+                "Parallel path computation disagrees with serial "
+                "computation.");
+        }
+    }
+}
+
+void testSharedModelWorkingContexts()
+{
+    Model model("arm26.osim");
+
+    // contexts require an initialized system
+    ASSERT_THROW(Exception, ModelWorkingContext badContext(model));
+
+    SimTK::State& defaultState = model.initSystem();
+    model.realizePosition(defaultState);
+    const SimTK::Vec3 defaultCom = model.calcMassCenterPosition(defaultState);
+
+    const Coordinate& elbow =
+        model.getComponent<Coordinate>("./jointset/r_elbow/r_elbow_flex");
+
+    // several threads share the one initialized model, each working through
+    // its own context; per-thread results must match the values obtained by
+    // posing the model serially.
+    const int numThreads = 4;
+    std::vector<double> elbowAngles(numThreads);
+    std::vector<SimTK::Vec3> threadComs(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        elbowAngles[i] = elbow.getRangeMin() + (i + 1) *
+            (elbow.getRangeMax() - elbow.getRangeMin()) / (numThreads + 1);
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&, i]() {
+            ModelWorkingContext context(model);
+            // enforceConstraints=false: constraint assembly would work
+            // through the model's single, shared AssemblySolver.
+            elbow.setValue(context.updState(), elbowAngles[i], false);
+            context.realize(SimTK::Stage::Position);
+            threadComs[i] =
+                model.calcMassCenterPosition(context.getState());
+
+            // reset() rewinds to the model's default working state
+            context.reset();
+            context.realize(SimTK::Stage::Position);
+            SimTK_TEST_EQ(model.calcMassCenterPosition(context.getState()),
+                defaultCom);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // the model's own working state is untouched by the contexts
+    model.realizePosition(model.getWorkingState());
+    SimTK_TEST_EQ(model.calcMassCenterPosition(model.getWorkingState()),
+        defaultCom);
+
+    // replay each pose serially and compare
+    SimTK::State serialState = model.getWorkingState();
+    for (int i = 0; i < numThreads; ++i) {
+        elbow.setValue(serialState, elbowAngles[i], false);
+        model.realizePosition(serialState);
+        SimTK_TEST_EQ(model.calcMassCenterPosition(serialState),
+            threadComs[i]);
+    }
+}
@@ -252,7 +252,7 @@ SimTK::Vector computeGenForceScaling(const Model &osimModel, const SimTK::State
                 && (ac.getJoint().getName() != "tib_pat_r") ){
             MobilizedBodyIndex modbodIndex = ac.getBodyIndex();
             const MobilizedBody& mobod = osimModel.getMatterSubsystem().getMobilizedBody(modbodIndex);
-            SpatialVec Hcol = mobod.getHCol(s, SimTK::MobilizerUIndex(0)); //ac.getMobilizerQIndex())); // get n�th column of H
+            SpatialVec Hcol = mobod.getHCol(s, SimTK::MobilizerUIndex(0)); //ac.getMobilizerQIndex())); // get n�th column of H
 
             /*double thetaScale = */Hcol[0].norm(); // magnitude of the rotational part of this column of H
             
@@ -352,6 +352,21 @@ void testMomentArmDefinitionForModel(const string &filename, const string &coord
         double ma = maSolver.solve(s, coord, muscle.getGeometryPath());
         double ma_dldtheta = computeMomentArmFromDefinition(s, muscle.getGeometryPath(), coord);
 
+        // The batched solve for the full moment-arm row must agree with the
+        // single-coordinate solve.
+        Vector maRow = maSolver.solveMomentArms(s, muscle.getGeometryPath());
+        int coordIndex = osimModel.getCoordinateSet().getIndex(coord.getName());
+        ASSERT_EQUAL(ma, maRow[coordIndex], integ_accuracy, __FILE__, __LINE__,
+            "Batched moment-arm row disagrees with single-coordinate solve.");
+
+        // The cached matrix service must agree as well; the pose changes
+        // every step of this sweep, so each step exercises a fresh solve.
+        std::vector<const GeometryPath*> paths(1, &muscle.getGeometryPath());
+        const Matrix& maCached = maSolver.solveMomentArmsCached(s, paths);
+        ASSERT_EQUAL(ma, maCached(0, coordIndex), integ_accuracy,
+            __FILE__, __LINE__,
+            "Cached moment-arm matrix disagrees with single-coordinate solve.");
+
         cout << "r's = " << ma << "::" << ma_dldtheta <<"  at q = " << coord.getValue(s)*180/Pi; 
 
         try {
@@ -29,6 +29,8 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
 
+#include <cstdio>
+
 using namespace std;
 using namespace SimTK;
 using namespace OpenSim;
@@ -116,9 +118,75 @@ void testTableReporterLabels() {
     SimTK_TEST(headings[1] == "height");
 }
 
+void testTableReporterStreamingAndDecimation() {
+    const std::string streamFile = "testReporters_stream.sto";
+    remove(streamFile.c_str());
+
+    // Create a model consisting of a falling ball.
+    Model model;
+    model.setName("world");
+
+    auto* ball = new OpenSim::Body("ball", 1., Vec3(0), Inertia(0));
+    model.addBody(ball);
+
+    auto* slider = new SliderJoint("slider", model.getGround(), Vec3(0),
+        Vec3(0,0,Pi/2.), *ball, Vec3(0), Vec3(0,0,Pi/2.));
+    slider->updCoordinate().setName("sliderCoord");
+    model.addJoint(slider);
+
+    // One reporter records every report in memory; the other records every
+    // second report through the bounded ring buffer to an STO file.
+    auto* full = new TableReporter();
+    full->set_report_time_interval(0.1);
+    full->addToReport(slider->getCoordinate().getOutput("value"), "height");
+    model.addComponent(full);
+
+    auto* streamed = new TableReporter();
+    streamed->set_report_time_interval(0.1);
+    streamed->addToReport(slider->getCoordinate().getOutput("value"),
+        "height");
+    streamed->setReportDecimation(2);
+    streamed->streamToFile(streamFile, 8);
+    model.addComponent(streamed);
+
+    SimTK_TEST_MUST_THROW_EXC(streamed->setReportDecimation(0),
+        OpenSim::Exception);
+    SimTK_TEST_MUST_THROW_EXC(streamed->streamToFile(""),
+        OpenSim::Exception);
+
+    // Simulate.
+    State& state = model.initSystem();
+    Manager manager(model);
+    state.setTime(0.0);
+    manager.initialize(state);
+    manager.integrate(1.0);
+
+    SimTK_TEST(streamed->isStreaming());
+    streamed->stopStreaming();
+    SimTK_TEST(!streamed->isStreaming());
+
+    // Streamed rows stay out of memory.
+    SimTK_TEST(streamed->getTable().getNumRows() == 0);
+
+    // The file holds every second report, matching the in-memory reference.
+    const auto& fullTable = full->getTable();
+    TimeSeriesTable onDisk(streamFile);
+    SimTK_TEST(onDisk.getColumnLabels() == fullTable.getColumnLabels());
+    SimTK_TEST(onDisk.getNumRows() == (fullTable.getNumRows() + 1)/2);
+    for (size_t i = 0; i < onDisk.getNumRows(); ++i) {
+        SimTK_TEST_EQ(onDisk.getIndependentColumn()[i],
+            fullTable.getIndependentColumn()[2*i]);
+        SimTK_TEST_EQ(onDisk.getRowAtIndex(i)[0],
+            fullTable.getRowAtIndex(2*i)[0]);
+    }
+
+    remove(streamFile.c_str());
+}
+
 int main() {
     SimTK_START_TEST("testReporters");
         SimTK_SUBTEST(testConsoleReporterLabels);
         SimTK_SUBTEST(testTableReporterLabels);
+        SimTK_SUBTEST(testTableReporterStreamingAndDecimation);
     SimTK_END_TEST();
 };
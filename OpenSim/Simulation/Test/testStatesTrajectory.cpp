@@ -582,6 +582,76 @@ void testBoundsCheck() {
                               IndexOutOfRange);
 }
 
+void testCompactStatesTrajectory() {
+    Model model("arm26.osim");
+    SimTK::State state = model.initSystem();
+
+    // A compact trajectory reconstitutes the same times and continuous
+    // variables as a full trajectory fed the same states.
+    StatesTrajectory full;
+    CompactStatesTrajectory compact;
+    const int numStates = 10;
+    for (int i = 0; i < numStates; ++i) {
+        state.setTime(0.1 * i);
+        for (int j = 0; j < state.getNY(); ++j)
+            state.updY()[j] = 0.01 * i + 0.001 * j;
+        full.append(state);
+        compact.append(state);
+    }
+    SimTK_TEST(compact.getSize() == full.getSize());
+    for (size_t i = 0; i < compact.getSize(); ++i) {
+        SimTK_TEST_EQ(compact.getTime(i), full[i].getTime());
+        const SimTK::State& s = compact.get(i);
+        SimTK_TEST_EQ(s.getTime(), full[i].getTime());
+        SimTK_TEST_EQ(s.getY(), full[i].getY());
+    }
+
+    // Expanding gives an ordinary trajectory of deep copies.
+    StatesTrajectory expanded = compact.expand();
+    SimTK_TEST(expanded.getSize() == full.getSize());
+    SimTK_TEST_EQ(expanded[3].getY(), full[3].getY());
+    SimTK_TEST_EQ(expanded[7].getY(), full[7].getY());
+
+    // Times must be nondecreasing, as for StatesTrajectory.
+    state.setTime(0.0);
+    SimTK_TEST_MUST_THROW_EXC(compact.append(state),
+            SimTK::Exception::APIArgcheckFailed);
+
+    // Bounds are checked by get() and getTime().
+    SimTK_TEST_MUST_THROW_EXC(compact.get(compact.getSize()),
+            IndexOutOfRange);
+    SimTK_TEST_MUST_THROW_EXC(compact.getTime(compact.getSize() + 10),
+            IndexOutOfRange);
+
+    // The reporter records compactly when compact_storage is enabled, and
+    // guards against reading through the wrong accessor.
+    Model model2("arm26.osim");
+    auto* reporter = new StatesTrajectoryReporter();
+    reporter->setName("compact_states_collector");
+    reporter->set_compact_storage(true);
+    reporter->set_report_time_interval(0.01);
+    model2.addComponent(reporter);
+    auto& state2 = model2.initSystem();
+
+    SimTK::RungeKuttaMersonIntegrator integrator(model2.getSystem());
+    SimTK::TimeStepper ts(model2.getSystem(), integrator);
+    ts.initialize(state2);
+    ts.setReportAllSignificantStates(true);
+    integrator.setReturnEveryInternalStep(true);
+    const double finalTime = 0.05;
+    while (ts.getState().getTime() < finalTime) {
+        ts.stepTo(finalTime);
+        model2.getMultibodySystem().realize(ts.getState(),
+                SimTK::Stage::Report);
+    }
+
+    SimTK_TEST(reporter->getCompactStates().getSize() == 6);
+    SimTK_TEST_MUST_THROW_EXC(reporter->getStates(), OpenSim::Exception);
+    for (size_t i = 0; i < reporter->getCompactStates().getSize(); ++i) {
+        ASSERT_EQUAL(reporter->getCompactStates().getTime(i), 0.01 * i, 1e-5);
+    }
+}
+
 void testIntegrityChecks() {
     Model arm26("arm26.osim");
     const auto& s26 = arm26.initSystem();
@@ -770,6 +840,46 @@ void testExport() {
             OpenSim::Exception);
 }
 
+// The StatePool recycler that tools use to avoid allocating a fresh State
+// for every working copy.
+void testStatePool() {
+    Model model;
+    model.setName("pool_pendulum");
+    auto* body = new Body("body", 1.0, SimTK::Vec3(0), SimTK::Inertia(1));
+    model.addBody(body);
+    auto* joint = new PinJoint("joint", model.getGround(), SimTK::Vec3(0),
+            SimTK::Vec3(0), *body, SimTK::Vec3(0, 1, 0), SimTK::Vec3(0));
+    model.addJoint(joint);
+    SimTK::State state = model.initSystem();
+    state.setTime(0.5);
+    model.getCoordinateSet()[0].setValue(state, 0.25);
+
+    StatePool pool;
+    SimTK_TEST(pool.getNumAvailable() == 0);
+    SimTK::State& slot = pool.acquire(state);
+    SimTK_TEST(pool.getNumOutstanding() == 1);
+    SimTK_TEST_EQ(slot.getTime(), 0.5);
+    SimTK_TEST_EQ(slot.getQ()[0], 0.25);
+
+    // A second acquire while the first is outstanding gets its own slot.
+    SimTK::State& slot2 = pool.acquire(state);
+    SimTK_TEST(&slot2 != &slot);
+    pool.release(slot2);
+    SimTK_TEST(pool.getNumAvailable() == 1);
+
+    // A released slot is recycled, not reallocated.
+    SimTK::State& slot3 = pool.acquire(state);
+    SimTK_TEST(&slot3 == &slot2);
+    SimTK_TEST(pool.getNumAvailable() == 0);
+    SimTK_TEST_EQ(slot3.getTime(), 0.5);
+    pool.release(slot3);
+    pool.release(slot);
+    SimTK_TEST(pool.getNumOutstanding() == 0);
+
+    // Releasing a State the pool never handed out is an error.
+    SimTK_TEST_MUST_THROW_EXC(pool.release(state), OpenSim::Exception);
+}
+
 int main() {
     SimTK_START_TEST("testStatesTrajectory");
         // actuators library is not loaded automatically (unless using clang).
@@ -786,7 +896,9 @@ int main() {
         SimTK_SUBTEST(testBoundsCheck);
         SimTK_SUBTEST(testIntegrityChecks);
         SimTK_SUBTEST(testAppendTimesAreNonDecreasing);
+        SimTK_SUBTEST(testCompactStatesTrajectory);
         SimTK_SUBTEST(testCopying);
+        SimTK_SUBTEST(testStatePool);
 
         // Test creation of trajectory from a states storage.
         // -------------------------------------------------
@@ -160,6 +160,19 @@ string WrapCylinder::getDimensionsString() const
     return dimensions.str();
 }
 
+//_____________________________________________________________________________
+/**
+ * Get the radius of a sphere that encloses the wrap surface: the distance
+ * from the cylinder's center to the rim of either end cap.
+ *
+ * @return The radius of the bounding sphere
+ */
+double WrapCylinder::getBoundingSphereRadius() const
+{
+    return sqrt(get_radius() * get_radius() +
+                0.25 * get_length() * get_length());
+}
+
 //=============================================================================
 // WRAPPING
 //=============================================================================
@@ -239,6 +252,24 @@ int WrapCylinder::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::V
         {
             return noWrap;
         }
+
+        // Warm start: if the previous evaluation of this (segment, cylinder)
+        // pairing wrapped and its tangent points are still tangent for the
+        // current endpoints, reuse them and go straight to building the
+        // spiral path. Successive integrator steps move the tangent points
+        // microscopically, so this skips the geometric construction of
+        // candidate tangent points during smooth motion. When the check
+        // fails the full solve below runs as before.
+        if (previousWrap.wrap_pts.getSize() > 0 &&
+            _previous_tangent_point_is_valid(aPoint1, previousWrap.r1) &&
+            _previous_tangent_point_is_valid(aPoint2, previousWrap.r2))
+        {
+            aWrapResult.r1 = previousWrap.r1;
+            aWrapResult.r2 = previousWrap.r2;
+            _make_spiral_path(aPoint1, aPoint2, long_wrap, aWrapResult);
+            aFlag = true;
+            return return_code;
+        }
     }
 
     // find points p11 & p22 on the cylinder axis closest aPoint1 & aPoint2
@@ -801,6 +832,50 @@ bool WrapCylinder::_adjust_tangent_point(SimTK::Vec3& pt1,
     return did_adust;
 }
 
+//_____________________________________________________________________________
+/**
+ * Determine whether the tangent point 'r1' from the previous wrap of this
+ * (segment, cylinder) pairing is still a valid tangent point for the current
+ * endpoint 'pt1', i.e. whether it still lies on the cylinder surface and the
+ * line from pt1 to r1 is tangent to the cylinder to within the tangency
+ * threshold. Used as the validity check for warm-starting the wrap
+ * calculation from the previous solution.
+ *
+ * @param pt1 The current endpoint of the line segment being wrapped
+ * @param r1 The tangent point from the previous wrap
+ * @return Whether or not r1 can seed the current wrap calculation
+ */
+bool WrapCylinder::_previous_tangent_point_is_valid(const SimTK::Vec3& pt1,
+                                                    const SimTK::Vec3& r1) const
+{
+    const double _radius = get_radius();
+
+    // The previous tangent point must be finite (the previous wrap may have
+    // been reset) and must still lie on the wrap surface. The cylinder axis
+    // is the Z axis through the origin.
+    if (!r1.isFinite())
+        return false;
+
+    SimTK::Vec3 radial(r1[0], r1[1], 0.0);
+    double radial_norm = radial.norm();
+    if (fabs(radial_norm - _radius) > 1e-6 * _radius)
+        return false;
+    if (fabs(r1[2]) > 0.5 * get_length())
+        return false;
+
+    // A line tangent to the cylinder is perpendicular to the surface normal
+    // at the tangent point, so the segment from r1 to pt1 should have no
+    // radial component. Accept r1 when its residual angle is below the
+    // tangency threshold.
+    SimTK::Vec3 toPoint = pt1 - r1;
+    double dist = toPoint.norm();
+    if (dist < SimTK::Eps)
+        return false;
+
+    return fabs((~toPoint * radial) / radial_norm) <
+           dist * TANGENCY_THRESHOLD;
+}
+
 // Implement generateDecorations by WrapCylinder to replace the previous out of place implementation 
 // in ModelVisualizer
 void WrapCylinder::generateDecorations(bool fixed, const ModelDisplayHints& hints, const SimTK::State& state,
@@ -58,6 +58,7 @@ public:
 
     const char* getWrapTypeName() const override;
     std::string getDimensionsString() const override;
+    double getBoundingSphereRadius() const override;
 
     /** Scale the cylinder's dimensions. The base class (WrapObject) scales the
         origin of the cylinder in the body's reference frame. */
@@ -95,6 +96,9 @@ private:
                                                       SimTK::Vec3& r1,
                                                       SimTK::Vec3& w1) const;
 
+    bool _previous_tangent_point_is_valid(const SimTK::Vec3& pt1,
+                                          const SimTK::Vec3& r1) const;
+
 //=============================================================================
 };  // END of class WrapCylinder
 //=============================================================================
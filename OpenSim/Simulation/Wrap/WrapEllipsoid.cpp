@@ -161,6 +161,19 @@ string WrapEllipsoid::getDimensionsString() const
     return dimensions.str();
 }
 
+//_____________________________________________________________________________
+/**
+ * Get the radius of a sphere that encloses the wrap surface: the largest
+ * of the ellipsoid's three principal radii.
+ *
+ * @return The radius of the bounding sphere
+ */
+double WrapEllipsoid::getBoundingSphereRadius() const
+{
+    const SimTK::Vec3& radii = get_dimensions();
+    return std::max(radii[0], std::max(radii[1], radii[2]));
+}
+
 //_____________________________________________________________________________
 /**
  * Get the radii of the ellipsoid.
@@ -58,6 +58,7 @@ public:
 
     const char* getWrapTypeName() const override;
     std::string getDimensionsString() const override;
+    double getBoundingSphereRadius() const override;
     SimTK::Vec3 getRadii() const;
 
     /** Scale the ellipsoid's dimensions. The base class (WrapObject) scales the
@@ -25,9 +25,11 @@
 // INCLUDES
 //=============================================================================
 #include "WrapObject.h"
+#include "WrapMath.h"
 #include "WrapResult.h"
 #include <OpenSim/Simulation/Model/PathPoint.h>
 #include <OpenSim/Simulation/Model/PhysicalFrame.h>
+#include <OpenSim/Common/HotPathCounters.h>
 #include <OpenSim/Common/ScaleSet.h>
 
 
@@ -163,6 +165,30 @@ int WrapObject::wrapPathSegment(const SimTK::State& s,
     pt1 = _pose.shiftBaseStationToFrame(pt1);
     pt2 = _pose.shiftBaseStationToFrame(pt2);
 
+    // Broad phase: skip the wrapping computation if the line through the path
+    // points stays farther from the wrap object's origin than a sphere that
+    // encloses the wrap surface. This is only valid for unconstrained wrap
+    // objects: quadrant-constrained ones can deflect a segment that crosses
+    // the constrained plane without ever approaching the surface.
+    if (_quadrant == allQuadrants) {
+        const double boundingRadius = getBoundingSphereRadius();
+        if (boundingRadius < SimTK::Infinity) {
+            Vec3 origin(0.0);
+            Vec3 line = pt2 - pt1;
+            if (line.normSqr() > SimTK::Eps &&
+                WrapMath::CalcDistanceSquaredPointToLine(origin, pt1, line) >
+                    boundingRadius * boundingRadius)
+            {
+                aWrapResult.wrap_pts.setSize(0);
+                aWrapResult.wrap_path_length = 0.0;
+                return noWrap;
+            }
+        }
+    }
+
+    // Segments rejected by the broad phase above do not count as solves.
+    HotPathCounters::increment(HotPathCounters::WrapSolves);
+
     return_code = wrapLine(s, pt1, pt2, aPathWrap, aWrapResult, p_flag);
 
    if (p_flag == true && return_code > 0) {
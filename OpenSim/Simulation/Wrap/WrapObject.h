@@ -114,6 +114,14 @@ public:
     // TODO: total SIMM hack!
     virtual std::string getDimensionsString() const { return ""; }
 
+    /** Get the radius of a sphere, centered at the origin of the wrap
+    object's own frame, that is guaranteed to enclose the entire wrap
+    surface. wrapPathSegment() uses this bound as a broad-phase check to
+    skip the wrapping computation for path segments that provably cannot
+    touch the surface. Wrap objects that cannot supply a meaningful bound
+    return SimTK::Infinity, which disables the check. */
+    virtual double getBoundingSphereRadius() const { return SimTK::Infinity; }
+
 //=============================================================================
 // WRAPPING
 //=============================================================================
@@ -136,6 +136,18 @@ string WrapSphere::getDimensionsString() const
     return dimensions.str();
 }
 
+//_____________________________________________________________________________
+/**
+ * Get the radius of a sphere that encloses the wrap surface; for a sphere
+ * this is simply its own radius.
+ *
+ * @return The radius of the bounding sphere
+ */
+double WrapSphere::getBoundingSphereRadius() const
+{
+    return get_radius();
+}
+
 //_____________________________________________________________________________
 /**
  * Get the radius of the sphere.
@@ -60,6 +60,7 @@ public:
 
     const char* getWrapTypeName() const override;
     std::string getDimensionsString() const override;
+    double getBoundingSphereRadius() const override;
     double getRadius() const;
 
     /** Scale the sphere by the average of the scale factors in each direction.
@@ -168,6 +168,17 @@ string WrapTorus::getDimensionsString() const
     return dimensions.str();
 }
 //_____________________________________________________________________________
+/**
+ * Get the radius of a sphere that encloses the wrap surface: the ring
+ * (outer) radius plus the tube (inner) radius.
+ *
+ * @return The radius of the bounding sphere
+ */
+double WrapTorus::getBoundingSphereRadius() const
+{
+    return get_outer_radius() + get_inner_radius();
+}
+//_____________________________________________________________________________
 /**
  * Get the inner radius of the torus
  *
@@ -274,19 +285,18 @@ int WrapTorus::findClosestPoint(double radius, double p1[], double p2[],
 {
    int info;                  // output flag
    int num_func_calls;        // number of calls to func (nfev)
-   int ldfjac = 1;            // leading dimension of fjac (nres)
    int numResid = 1;
    int numQs = 1;
-   double q[2], resid[2], fjac[2];            // m X n array
+   double q[2], resid[2];
    CircleCallback cb;
    bool constrained = (bool) (wrap_sign != 0);
    // solution parameters
    int mode = 1, nprint = 0, max_iter = 500;
    double ftol = 1e-4, xtol = 1e-4, gtol = 0.0;
    double epsfcn = 0.0, step_factor = 0.2;
-   // work arrays
-   int ipvt[2];
-   double diag[2], qtf[2], wa1[2], wa2[2], wa3[2], wa4[2];
+   double diag[2];
+   // the solver's workspace is reused for the second pass below
+   LmdifSolver solver(numResid, numQs);
    // Circle variables
    double u, mag, nx, ny, nz, x, y, z, a1[3], a2[3], distance1, distance2, betterPt = 0;
 
@@ -300,10 +310,9 @@ int WrapTorus::findClosestPoint(double radius, double p1[], double p2[],
 
    q[0] = 0.0;
 
-   lmdif_C(calcCircleResids, numResid, numQs, q, resid,
+   solver.solve(calcCircleResids, q, resid,
            ftol, xtol, gtol, max_iter, epsfcn, diag, mode, step_factor,
-           nprint, &info, &num_func_calls, fjac, ldfjac, ipvt, qtf,
-           wa1, wa2, wa3, wa4, (void*)&cb);
+           nprint, &info, &num_func_calls, (void*)&cb);
 
    u = q[0];
 
@@ -335,10 +344,9 @@ int WrapTorus::findClosestPoint(double radius, double p1[], double p2[],
 
    q[0] = 0.0;
 
-   lmdif_C(calcCircleResids, numResid, numQs, q, resid,
+   solver.solve(calcCircleResids, q, resid,
            ftol, xtol, gtol, max_iter, epsfcn, diag, mode, step_factor,
-           nprint, &info, &num_func_calls, fjac, ldfjac, ipvt, qtf,
-           wa1, wa2, wa3, wa4, (void*)&cb);
+           nprint, &info, &num_func_calls, (void*)&cb);
 
    u = q[0];
 
@@ -67,6 +67,7 @@ public:
 
     const char* getWrapTypeName() const override;
     std::string getDimensionsString() const override;
+    double getBoundingSphereRadius() const override;
     SimTK::Real getInnerRadius() const;
     SimTK::Real getOuterRadius() const;
 
@@ -41,18 +41,21 @@
 #include "Model/CoordinateSet.h"
 #include "Model/ElasticFoundationForce.h"
 #include "Model/HuntCrossleyForce.h"
+#include "Model/HuntCrossleyContactManager.h"
 #include "Model/SmoothSphereHalfSpaceForce.h"
 #include "Model/Ligament.h"
 #include "Model/Blankevoort1991Ligament.h"
 #include "Model/JointSet.h"
 #include "Model/Marker.h"
 #include "Model/Station.h"
+#include "Model/StationPlaneContactForces.h"
 #include "Model/MarkerSet.h"
 #include "Model/PathPoint.h"
 #include "Model/PathPointSet.h"
 #include "Model/ConditionalPathPoint.h"
 #include "Model/MovingPathPoint.h"
 #include "Model/GeometryPath.h"
+#include "Model/FunctionBasedPath.h"
 #include "Model/PrescribedForce.h"
 #include "Model/PointToPointSpring.h"
 #include "Model/ExpressionBasedPointToPointForce.h"
@@ -62,6 +65,7 @@
 #include "Model/FunctionBasedBushingForce.h"
 #include "Model/ExpressionBasedBushingForce.h"
 #include "Model/CoordinateLimitForce.h"
+#include "Model/DiscreteForces.h"
 #include "Model/ExternalLoads.h"
 #include "Model/PathActuator.h"
 #include "Model/ActuatorPowerProbe.h"
@@ -79,6 +83,7 @@
 #include "Control/ControlSetController.h"
 #include "Control/ControlConstant.h"
 #include "Control/ControlLinear.h"
+#include "Control/ExternalInputController.h"
 #include "Control/PrescribedController.h"
 #include "Wrap/PathWrap.h"
 #include "Wrap/PathWrapSet.h"
@@ -122,12 +127,17 @@
 #include "MomentArmSolver.h"
 #include "Reference.h"
 #include "Solver.h"
+#include "CompactStatesTrajectory.h"
+#include "StatePool.h"
 #include "StatesTrajectory.h"
 #include "StatesTrajectoryReporter.h"
 #include "TableProcessor.h"
 #include "PositionMotion.h"
 #include "OpenSense/OpenSenseUtilities.h"
 #include "OpenSense/IMU.h"
+#include "OpenSense/IMUStreamReceiver.h"
+#include "OpenSense/OrientationStreamFilter.h"
+#include "OpenSense/IMUTrackingSessionManager.h"
 #include "SimulationUtilities.h"
 
 #include "RegisterTypes_osimSimulation.h"   // to expose RegisterTypes_osimSimulation
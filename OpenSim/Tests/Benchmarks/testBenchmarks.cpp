@@ -0,0 +1,340 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  testBenchmarks.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/*=============================================================================
+
+Micro-benchmark suite for the canonical hot paths: path (re)computation,
+spline evaluation, equilibrium-muscle dynamics, inverse-kinematics tracking,
+and time-stepping through Manager. Each benchmark times a fixed number of
+iterations of one operation and the suite writes the results as JSON
+(benchmark name, iteration count, and per-iteration wall time) so runs on
+different machines or releases can be diffed:
+
+    testBenchmarks [outputFile.json]
+
+The default output file is testBenchmarks_results.json in the working
+directory. Timings are wall-clock and inherently machine-dependent, so the
+suite asserts only that every benchmark runs to completion; comparing the
+numbers between revisions is the caller's job.
+
+The corpus_* benchmarks run a common workload over the graded
+reference-model performance corpus in OpenSim/Tests/shared/
+PerformanceCorpus (see the README there); arm26 is the corpus's small
+grade and is exercised by the computePath and Manager benchmarks above.
+
+//=============================================================================*/
+#include <OpenSim/Actuators/Millard2012EquilibriumMuscle.h>
+#include <OpenSim/Common/GCVSpline.h>
+#include <OpenSim/Common/LoadOpenSimLibrary.h>
+#include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/MarkersReference.h>
+#include <OpenSim/Simulation/Model/Marker.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace OpenSim;
+using namespace std;
+
+namespace {
+
+struct BenchmarkResult {
+    std::string name;
+    int iterations{0};
+    double totalMs{SimTK::NaN};
+    double msPerIteration{SimTK::NaN};
+};
+
+// Run `body` once as a warm-up (populating caches and lazy allocations),
+// then time `iterations` further calls.
+BenchmarkResult runBenchmark(const std::string& name, int iterations,
+        const std::function<void(int)>& body)
+{
+    body(0);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        body(i);
+    const auto finish = std::chrono::steady_clock::now();
+
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.totalMs = std::chrono::duration<double, std::milli>(
+        finish - start).count();
+    result.msPerIteration = result.totalMs/iterations;
+    return result;
+}
+
+// GeometryPath::computePath: sweep the elbow through its range and
+// recompute every muscle path length at each configuration.
+BenchmarkResult benchmarkComputePath()
+{
+    Model model("arm26.osim");
+    SimTK::State state = model.initSystem();
+    const Coordinate& elbow = model.getCoordinateSet().get("r_elbow_flex");
+    const double lo = elbow.getRangeMin();
+    const double hi = elbow.getRangeMax();
+
+    return runBenchmark("GeometryPath_computePath", 500, [&](int i) {
+        const double angle = lo + (hi - lo)*(i%100)/99.0;
+        elbow.setValue(state, angle, false);
+        model.realizePosition(state);
+        double totalLength = 0;
+        for (int m = 0; m < model.getMuscles().getSize(); ++m)
+            totalLength += model.getMuscles()[m].getLength(state);
+        SimTK_ASSERT_ALWAYS(totalLength > 0,
+            "computePath benchmark produced a non-positive length.");
+    });
+}
+
+// GCVSpline::calcValue: evaluate a quintic fit of a sine wave across its
+// domain, the pattern Storage-driven function-based controls produce.
+BenchmarkResult benchmarkSplineEvaluation()
+{
+    const int numPoints = 200;
+    std::vector<double> x(numPoints), y(numPoints);
+    for (int i = 0; i < numPoints; ++i) {
+        x[i] = 10.0*i/(numPoints - 1);
+        y[i] = std::sin(x[i]);
+    }
+    GCVSpline spline(5, numPoints, x.data(), y.data(), "sine");
+
+    SimTK::Vector arg(1);
+    return runBenchmark("GCVSpline_calcValue", 100000, [&](int i) {
+        arg[0] = 10.0*(i%1000)/999.0;
+        spline.calcValue(arg);
+    });
+}
+
+// Millard2012EquilibriumMuscle dynamics: realize a one-muscle slider
+// model through Acceleration, which solves the fiber equilibrium and
+// evaluates the activation and fiber state derivatives.
+BenchmarkResult benchmarkMuscleDynamics()
+{
+    Model model;
+    auto* body = new Body("body", 1.0,
+        SimTK::Vec3(0), SimTK::Inertia(1.0));
+    model.addBody(body);
+    auto* slider = new SliderJoint("slider", model.getGround(), *body);
+    slider->updCoordinate().setName("position");
+    // Keep the path near optimalFiberLength + tendonSlackLength so the
+    // initial fiber equilibrium solve is well-posed.
+    slider->updCoordinate().setDefaultValue(0.3);
+    model.addJoint(slider);
+    auto* muscle = new Millard2012EquilibriumMuscle("muscle",
+        100.0, 0.2, 0.1, 0.0);
+    muscle->addNewPathPoint("origin", model.updGround(), SimTK::Vec3(0));
+    muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+    model.addForce(muscle);
+
+    SimTK::State state = model.initSystem();
+    const Coordinate& coord = slider->getCoordinate();
+
+    return runBenchmark("Millard2012EquilibriumMuscle_derivatives", 2000,
+            [&](int i) {
+        coord.setValue(state, 0.3 + 0.02*std::sin(0.01*i), false);
+        coord.setSpeedValue(state, 0.1*std::cos(0.01*i));
+        muscle->setActivation(state, 0.5);
+        model.getMultibodySystem().realize(state,
+            SimTK::Stage::Acceleration);
+    });
+}
+
+// InverseKinematicsSolver::track: synthesize marker trajectories by
+// sweeping the elbow, then track the frames the way IKTool's per-frame
+// loop does.
+BenchmarkResult benchmarkInverseKinematicsTrack()
+{
+    Model model("arm26.osim");
+    model.addMarker(new Marker("humerus_marker",
+        model.getComponent<PhysicalFrame>("./bodyset/r_humerus"),
+        SimTK::Vec3(0.01, -0.15, 0.0)));
+    model.addMarker(new Marker("forearm_marker",
+        model.getComponent<PhysicalFrame>("./bodyset/r_ulna_radius_hand"),
+        SimTK::Vec3(0.0, -0.1, 0.02)));
+    model.addMarker(new Marker("hand_marker",
+        model.getComponent<PhysicalFrame>("./bodyset/r_ulna_radius_hand"),
+        SimTK::Vec3(0.0, -0.23, 0.01)));
+
+    SimTK::State state = model.initSystem();
+    const Coordinate& elbow = model.getCoordinateSet().get("r_elbow_flex");
+    const double lo = elbow.getRangeMin();
+    const double hi = elbow.getRangeMax();
+
+    // Synthetic experimental data: marker ground positions over an elbow
+    // sweep, sampled at 100 Hz.
+    const int numFrames = 50;
+    TimeSeriesTable_<SimTK::Vec3> markerData;
+    std::vector<std::string> labels;
+    for (int m = 0; m < model.getMarkerSet().getSize(); ++m)
+        labels.push_back(model.getMarkerSet()[m].getName());
+    markerData.setColumnLabels(labels);
+    for (int frame = 0; frame < numFrames; ++frame) {
+        const double angle = lo + (hi - lo)*frame/(numFrames - 1.0);
+        elbow.setValue(state, angle, false);
+        model.realizePosition(state);
+        SimTK::RowVector_<SimTK::Vec3> row(int(labels.size()));
+        for (int m = 0; m < model.getMarkerSet().getSize(); ++m)
+            row[m] = model.getMarkerSet()[m].getLocationInGround(state);
+        markerData.appendRow(frame/100.0, row);
+    }
+    markerData.updTableMetaData().setValueForKey("Units",
+        std::string("meters"));
+
+    auto markersRef = std::make_shared<MarkersReference>(markerData,
+        Set<MarkerWeight>());
+    SimTK::Array_<CoordinateReference> coordRefs;
+    InverseKinematicsSolver solver(model, markersRef, coordRefs);
+    solver.setAccuracy(1e-5);
+
+    state.setTime(0.0);
+    solver.assemble(state);
+
+    return runBenchmark("InverseKinematicsSolver_track", 200, [&](int i) {
+        state.setTime((i%numFrames)/100.0);
+        solver.track(state);
+    });
+}
+
+// Manager::integrate: a short forward simulation from the same initial
+// state each iteration, integrator setup included as in the tools.
+BenchmarkResult benchmarkManagerIntegrate()
+{
+    Model model("arm26.osim");
+    const SimTK::State initialState = model.initSystem();
+
+    return runBenchmark("Manager_integrate", 5, [&](int) {
+        SimTK::State state = initialState;
+        state.setTime(0.0);
+        Manager manager(model);
+        manager.setWriteToStorage(false);
+        manager.setPerformAnalyses(false);
+        manager.initialize(state);
+        manager.integrate(0.05);
+    });
+}
+
+// One grade of the reference-model performance corpus: sweep every
+// coordinate through a small motion about mid-range, realize to `stage`,
+// and recompute every muscle path. Position exercises the kinematics and
+// path/wrapping machinery; Dynamics additionally evaluates the model's
+// forces (the contact grade's reason for being).
+BenchmarkResult benchmarkCorpusModel(const std::string& name,
+        const std::string& modelFile, int iterations, SimTK::Stage stage)
+{
+    Model model(modelFile);
+    SimTK::State state = model.initSystem();
+    const CoordinateSet& coords = model.getCoordinateSet();
+
+    return runBenchmark(name, iterations, [&](int i) {
+        for (int c = 0; c < coords.getSize(); ++c) {
+            const Coordinate& coord = coords[c];
+            const double mid =
+                0.5*(coord.getRangeMin() + coord.getRangeMax());
+            const double span = coord.getRangeMax() - coord.getRangeMin();
+            coord.setValue(state, mid + 0.05*span*std::sin(0.1*i + c),
+                false);
+        }
+        model.getMultibodySystem().realize(state, stage);
+        double totalLength = 0;
+        for (int m = 0; m < model.getMuscles().getSize(); ++m)
+            totalLength += model.getMuscles()[m].getLength(state);
+        SimTK_ASSERT1_ALWAYS(SimTK::isFinite(totalLength),
+            "Corpus benchmark %s produced a non-finite path length.",
+            name.c_str());
+    });
+}
+
+void writeResultsAsJson(const std::string& fileName,
+        const std::vector<BenchmarkResult>& results)
+{
+    FILE* file = std::fopen(fileName.c_str(), "w");
+    SimTK_ASSERT1_ALWAYS(file != nullptr,
+        "Benchmark suite could not open '%s' for writing.",
+        fileName.c_str());
+
+    std::fprintf(file, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        std::fprintf(file,
+            "    {\"name\": \"%s\", \"iterations\": %d, "
+            "\"real_time\": %.6g, \"time_unit\": \"ms\"}%s\n",
+            result.name.c_str(), result.iterations,
+            result.msPerIteration, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+    std::fclose(file);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    LoadOpenSimLibrary("osimActuators");
+
+    std::string outputFile = "testBenchmarks_results.json";
+    if (argc > 1)
+        outputFile = argv[1];
+
+    try {
+        std::vector<BenchmarkResult> results;
+        results.push_back(benchmarkComputePath());
+        results.push_back(benchmarkSplineEvaluation());
+        results.push_back(benchmarkMuscleDynamics());
+        results.push_back(benchmarkInverseKinematicsTrack());
+        results.push_back(benchmarkManagerIntegrate());
+        results.push_back(benchmarkCorpusModel("corpus_gait2354_position",
+            "gait2354_simbody.osim", 300, SimTK::Stage::Position));
+        results.push_back(benchmarkCorpusModel("corpus_Rajagopal2016_position",
+            "Rajagopal2016.osim", 100, SimTK::Stage::Position));
+        results.push_back(benchmarkCorpusModel("corpus_2Dgait_dynamics",
+            "2D_gait.osim", 300, SimTK::Stage::Dynamics));
+
+        printf("\n%-42s %10s %14s\n", "benchmark", "iters", "ms/iter");
+        for (const auto& result : results) {
+            printf("%-42s %10d %14.4f\n", result.name.c_str(),
+                result.iterations, result.msPerIteration);
+            SimTK_ASSERT1_ALWAYS(SimTK::isFinite(result.msPerIteration),
+                "Benchmark %s produced a non-finite timing.",
+                result.name.c_str());
+        }
+
+        writeResultsAsJson(outputFile, results);
+        printf("Results written to %s\n", outputFile.c_str());
+    }
+    catch (const std::exception& ex) {
+        cout << ex.what() << endl;
+        cout << "Failed." << endl;
+        return 1;
+    }
+
+    cout << "Done." << endl;
+    return 0;
+}
@@ -0,0 +1,218 @@
+/* -------------------------------------------------------------------------- *
+ *                  OpenSim:  testIntegratorBenchmark.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/*=============================================================================
+
+Integrator benchmark harness. Runs a model over a grid of the integrator
+methods Manager exposes and a range of accuracies, measuring wall time, the
+number of steps the integrator took, and the trajectory's divergence from a
+tight-accuracy reference run, then prints a report table. Use it to pick an
+integrator/accuracy pair for a production model before committing compute
+time:
+
+    testIntegratorBenchmark [modelFile [finalTime]]
+
+With no arguments the arm26 model is benchmarked over a short interval so
+the harness can run as an ordinary test. Divergence is the largest
+infinity-norm difference between a run's state variables and the reference
+run's, compared at common report times.
+
+//=============================================================================*/
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Common/LoadOpenSimLibrary.h>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace OpenSim;
+using namespace std;
+
+namespace {
+
+struct BenchmarkResult {
+    std::string method;
+    double accuracy{SimTK::NaN};
+    double wallTimeMs{SimTK::NaN};
+    int stepsTaken{0};
+    double divergence{SimTK::NaN};
+    bool succeeded{false};
+};
+
+// Integrate the model with the given method/accuracy, sampling the state
+// variables at each report time. Returns the wall time and step count
+// through the result; trajectory rows come back through sampledValues.
+BenchmarkResult runOnce(Model& model, Manager::IntegratorMethod method,
+        const std::string& methodName, double accuracy,
+        const std::vector<double>& reportTimes,
+        std::vector<SimTK::Vector>& sampledValues)
+{
+    BenchmarkResult result;
+    result.method = methodName;
+    result.accuracy = accuracy;
+    sampledValues.clear();
+
+    SimTK::State state = model.initSystem();
+    state.setTime(0.0);
+
+    Manager manager(model);
+    manager.setIntegratorMethod(method);
+    if (manager.getIntegrator().methodHasErrorControl())
+        manager.setIntegratorAccuracy(accuracy);
+    manager.setPerformAnalyses(false);
+    manager.setWriteToStorage(false);
+
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        manager.initialize(state);
+        for (double reportTime : reportTimes) {
+            const SimTK::State& s = manager.integrate(reportTime);
+            sampledValues.push_back(model.getStateVariableValues(s));
+        }
+        result.succeeded = true;
+    }
+    catch (const std::exception& ex) {
+        log_warn("Integrator benchmark: {} at accuracy {} failed: {}",
+            methodName, accuracy, ex.what());
+    }
+    const auto finish = std::chrono::steady_clock::now();
+
+    result.wallTimeMs = std::chrono::duration<double, std::milli>(
+        finish - start).count();
+    result.stepsTaken = manager.getIntegrator().getNumStepsTaken();
+
+    return result;
+}
+
+// Largest infinity-norm difference from the reference trajectory over the
+// common report times.
+double computeDivergence(const std::vector<SimTK::Vector>& values,
+        const std::vector<SimTK::Vector>& reference)
+{
+    double divergence = 0;
+    for (size_t i = 0; i < values.size() && i < reference.size(); ++i) {
+        const double diff = (values[i] - reference[i]).normInf();
+        if (diff > divergence)
+            divergence = diff;
+    }
+    return divergence;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    LoadOpenSimLibrary("osimActuators");
+
+    std::string modelFile = "arm26.osim";
+    double finalTime = 0.2;
+    if (argc > 1)
+        modelFile = argv[1];
+    if (argc > 2)
+        finalTime = atof(argv[2]);
+
+    try {
+        Model model(modelFile);
+        model.finalizeFromProperties();
+
+        // Common report times so trajectories can be compared pointwise.
+        const int numReports = 20;
+        std::vector<double> reportTimes(numReports);
+        for (int i = 0; i < numReports; ++i)
+            reportTimes[i] = finalTime*(i + 1)/numReports;
+
+        // Reference trajectory: the default integrator at tight accuracy.
+        std::vector<SimTK::Vector> reference;
+        BenchmarkResult referenceRun = runOnce(model,
+            Manager::IntegratorMethod::RungeKuttaMerson, "RungeKuttaMerson",
+            1e-8, reportTimes, reference);
+        SimTK_ASSERT_ALWAYS(referenceRun.succeeded,
+            "Integrator benchmark reference run failed.");
+
+        const std::vector<std::pair<Manager::IntegratorMethod, std::string>>
+            methods = {
+                {Manager::IntegratorMethod::RungeKutta2, "RungeKutta2"},
+                {Manager::IntegratorMethod::RungeKutta3, "RungeKutta3"},
+                {Manager::IntegratorMethod::RungeKuttaFeldberg,
+                    "RungeKuttaFeldberg"},
+                {Manager::IntegratorMethod::RungeKuttaMerson,
+                    "RungeKuttaMerson"},
+                {Manager::IntegratorMethod::SemiExplicitEuler2,
+                    "SemiExplicitEuler2"},
+                {Manager::IntegratorMethod::Verlet, "Verlet"},
+            };
+        const std::vector<double> accuracies = {1e-2, 1e-3, 1e-4};
+
+        std::vector<BenchmarkResult> results;
+        std::vector<SimTK::Vector> sampled;
+        for (const auto& method : methods) {
+            for (double accuracy : accuracies) {
+                BenchmarkResult result = runOnce(model, method.first,
+                    method.second, accuracy, reportTimes, sampled);
+                if (result.succeeded)
+                    result.divergence = computeDivergence(sampled, reference);
+                results.push_back(result);
+            }
+        }
+
+        // REPORT
+        printf("\nIntegrator benchmark: %s, t = [0, %g] s, reference = "
+               "RungeKuttaMerson at 1e-8 (%.1f ms)\n",
+            modelFile.c_str(), finalTime, referenceRun.wallTimeMs);
+        printf("%-20s %10s %12s %8s %14s\n",
+            "method", "accuracy", "wall (ms)", "steps", "divergence");
+        for (const auto& result : results) {
+            if (result.succeeded) {
+                printf("%-20s %10.0e %12.2f %8d %14.3e\n",
+                    result.method.c_str(), result.accuracy,
+                    result.wallTimeMs, result.stepsTaken, result.divergence);
+            } else {
+                printf("%-20s %10.0e %12s %8s %14s\n",
+                    result.method.c_str(), result.accuracy,
+                    "failed", "-", "-");
+            }
+        }
+
+        // The harness itself must be trustworthy: every grid point should
+        // complete on the default model and stay near the reference.
+        int numSucceeded = 0;
+        for (const auto& result : results) {
+            if (!result.succeeded)
+                continue;
+            ++numSucceeded;
+            SimTK_ASSERT1_ALWAYS(SimTK::isFinite(result.divergence),
+                "Integrator benchmark: %s produced a non-finite divergence.",
+                result.method.c_str());
+        }
+        SimTK_ASSERT_ALWAYS(numSucceeded > 0,
+            "Integrator benchmark: every grid point failed.");
+    }
+    catch (const std::exception& ex) {
+        cout << ex.what() << endl;
+        cout << "Failed." << endl;
+        return 1;
+    }
+
+    cout << "Done." << endl;
+    return 0;
+}
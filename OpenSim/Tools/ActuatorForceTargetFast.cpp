@@ -32,6 +32,7 @@
 #include "CMC_TaskSet.h"
 #include "CMC.h"
 #include "StateTrackingTask.h"
+#include <simmath/LinearAlgebra.h>
 
 using namespace std;
 using namespace OpenSim;
@@ -165,13 +166,191 @@ prepareToOptimize(SimTK::State& s, double *x)
         if( std::fabs(fOpt) < SimTK::TinyReal )
             fOpt = SimTK::TinyReal;
 
-        _recipOptForceSquared[i] = 1.0 / (fOpt*fOpt);   
+        _recipOptForceSquared[i] = 1.0 / (fOpt*fOpt);
     }
-    
+
+#ifdef USE_LINEAR_CONSTRAINT_MATRIX
+    // Attempt the direct box-constrained QP solve; returning true tells the
+    // controller to use x as the solution without running the generic
+    // optimizer.  If the active set does not settle (or the problem has
+    // non-quadratic terms), fall through to the optimizer as before.
+    if(solveBoundConstrainedQP(x)) return true;
+#endif
+
     // return false to indicate that we still need to proceed with optimization (did not do a lapack direct solve)
     return false;
 }
 
+//______________________________________________________________________________
+/**
+ * Attempt to solve the fast target directly as a bound-constrained quadratic
+ * program, bypassing the generic optimizer.
+ *
+ * The fast target's objective is a diagonal quadratic in the actuator forces
+ * and its constraints are the precomputed linear acceleration constraints, so
+ * the optimum satisfies a linear KKT system once the set of forces pinned at
+ * their bounds is known.  This method iterates a primal-dual active-set
+ * update: fix the currently-active forces at their bounds, solve the
+ * equality-constrained subproblem for the free forces via the (small, number
+ * of tasks squared) Schur complement, then activate any bound that was
+ * violated and release any active bound whose Lagrange multiplier has the
+ * wrong sign.  The working set is retained across control windows, so after
+ * the first window each solve typically settles in one or two iterations.
+ *
+ * @param x Array into which the solution is written on success.
+ * @return True if the active set settled and x holds the optimum; false if
+ * this window should be handed to the generic optimizer instead (e.g.,
+ * state-tracking tasks make the objective non-quadratic, the constraints are
+ * rank deficient, or the active set cycled).
+ */
+bool ActuatorForceTargetFast::
+solveBoundConstrainedQP(double *x)
+{
+    const Set<const Actuator>& fSet = _controller->getActuatorSet();
+    const CMC_TaskSet& tset = _controller->getTaskSet();
+
+    // State-tracking tasks add terms that are not quadratic in the forces;
+    // leave those runs to the generic optimizer.
+    for(int t=0; t<tset.getSize(); t++) {
+        if(dynamic_cast<StateTrackingTask*>(&tset.get(t)) != NULL)
+            return false;
+    }
+
+    if(!getHasLimits()) return false;
+
+    const int nf = getNumParameters();
+    const int nc = getNumConstraints();
+    if(nc<=0 || nf<nc) return false;
+
+    double *lower=NULL,*upper=NULL;
+    getParameterLimits(&lower,&upper);
+
+    // Diagonal of the objective Hessian; each performance term is
+    // q[i]*f[i]*f[i] (see objectiveFunc).
+    Vector h(nf);
+    for(int i=0;i<nf;i++) {
+        auto act = dynamic_cast<const ScalarActuator*>(&fSet[i]);
+        auto mus = dynamic_cast<const Muscle*>(act);
+        h[i] = 2.0*(mus ? _recipOptForceSquared[i] : _recipAreaSquared[i]);
+        if(!(h[i]>0.0)) return false;
+    }
+
+    // Initialize the working set on the first solve or if the problem size
+    // changed; otherwise warm start from the previous control window.
+    if(_qpActiveSet.getSize()!=nf) {
+        _qpActiveSet.setSize(nf);
+        for(int i=0;i<nf;i++) _qpActiveSet[i] = 0;
+    }
+
+    // constraintFunc drives C*f + c0 toward zero, so the equality
+    // right-hand side is -c0.
+    Vector d0 = -_constraintVector;
+
+    // Shallow views over the limit arrays owned by OptimizationTarget.
+    Vector lowerV(nf, lower, true);
+    Vector upperV(nf, upper, true);
+
+    Vector f(nf);
+    if(!solveActiveSetQP(_constraintMatrix, d0, h, lowerV, upperV,
+            _qpActiveSet, f))
+        return false;
+
+    for(int j=0;j<nf;j++) x[j] = f[j];
+    return true;
+}
+
+bool ActuatorForceTargetFast::
+solveActiveSetQP(const SimTK::Matrix& C, const SimTK::Vector& d0,
+    const SimTK::Vector& h, const SimTK::Vector& lower,
+    const SimTK::Vector& upper, Array<int>& activeSet, SimTK::Vector& f)
+{
+    const int nc = C.nrow();
+    const int nf = C.ncol();
+    if(nc<=0 || nf<nc) return false;
+
+    f.resize(nf);
+    Vector lambda(nc),g(nf),rhs(nc);
+    Matrix S(nc,nc);
+
+    const int maxIter = 10 + 2*nf;
+    for(int iter=0; iter<maxIter; iter++) {
+
+        // Right-hand side with the active forces pinned at their bounds,
+        // and the free-force Schur complement S = C_F * inv(H_F) * C_F^T.
+        Vector d = d0;
+        int numFree = 0;
+        S = 0.0;
+        for(int j=0;j<nf;j++) {
+            if(activeSet[j]!=0) {
+                const double bound = activeSet[j]<0 ? lower[j] : upper[j];
+                for(int a=0;a<nc;a++) d[a] -= C(a,j)*bound;
+            } else {
+                numFree++;
+                const double invh = 1.0/h[j];
+                for(int a=0;a<nc;a++) {
+                    const double caj = C(a,j);
+                    if(caj==0.0) continue;
+                    const double w = caj*invh;
+                    for(int b=0;b<nc;b++) S(a,b) += w*C(b,j);
+                }
+            }
+        }
+        if(numFree<nc) return false;
+
+        // Minimize 0.5*f'*H*f subject to C_F*f_F = d:
+        // f_F = -inv(H_F)*C_F^T*lambda with S*lambda = -d.
+        rhs = -d;
+        SimTK::FactorQTZ qtz(S);
+        if(qtz.getRank()<nc) return false;
+        qtz.solve(rhs, lambda);
+
+        for(int j=0;j<nf;j++) {
+            if(activeSet[j]<0) {
+                f[j] = lower[j];
+            } else if(activeSet[j]>0) {
+                f[j] = upper[j];
+            } else {
+                double cjLambda = 0.0;
+                for(int a=0;a<nc;a++) cjLambda += C(a,j)*lambda[a];
+                f[j] = -cjLambda/h[j];
+            }
+        }
+
+        // Gradient of the Lagrangian; at an active bound its sign is the
+        // bound multiplier test.
+        for(int j=0;j<nf;j++) {
+            double cjLambda = 0.0;
+            for(int a=0;a<nc;a++) cjLambda += C(a,j)*lambda[a];
+            g[j] = h[j]*f[j] + cjLambda;
+        }
+
+        // Activate violated bounds; release active bounds whose multipliers
+        // have the wrong sign.
+        bool changed = false;
+        for(int j=0;j<nf;j++) {
+            int next = activeSet[j];
+            if(activeSet[j]==0) {
+                if(f[j]<lower[j])      next = -1;
+                else if(f[j]>upper[j]) next =  1;
+            } else if(activeSet[j]<0) {
+                if(g[j]<0.0) next = 0;
+            } else {
+                if(g[j]>0.0) next = 0;
+            }
+            if(next!=activeSet[j]) {
+                activeSet[j] = next;
+                changed = true;
+            }
+        }
+
+        if(!changed) return true;
+    }
+
+    // The active set did not settle; let the generic optimizer handle this
+    // control window.
+    return false;
+}
+
 //==============================================================================
 // SET AND GET
 //==============================================================================
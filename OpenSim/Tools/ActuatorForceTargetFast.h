@@ -90,7 +90,13 @@ private:
 
     SimTK::Matrix _constraintMatrix;
     SimTK::Vector _constraintVector;
-    
+
+    /** Per-parameter state of the bound working set used by the direct
+    active-set solve in prepareToOptimize(): -1 at the lower bound, 0 free,
+    +1 at the upper bound.  Kept across control windows so each solve warm
+    starts from the previous window's active set. */
+    Array<int> _qpActiveSet;
+
     // Save a (copy) of the state for state tracking purposes
     SimTK::State    _saveState;
 //==============================================================================
@@ -110,6 +116,32 @@ public:
 
     bool prepareToOptimize(SimTK::State& s, double *x) override;
 
+    /** Solve min 0.5*sum_i h[i]*f[i]^2 subject to C*f = d and
+    lower <= f <= upper by primal-dual active-set iteration: fix the
+    currently-active forces at their bounds, solve the equality-constrained
+    subproblem for the free forces via the Schur complement, then activate
+    any violated bound and release any active bound whose multiplier has
+    the wrong sign.  This is the pure-math core of the direct solve in
+    prepareToOptimize(), exposed so it can be exercised against the
+    generic optimizer in isolation.
+    @param C constraint matrix (numConstraints x numParameters).
+    @param d equality-constraint right-hand side.
+    @param h strictly positive diagonal of the objective Hessian.
+    @param lower lower parameter bounds.
+    @param upper upper parameter bounds.
+    @param activeSet working set, one entry per parameter (-1 at the lower
+        bound, 0 free, +1 at the upper bound); pass the previous solve's
+        set to warm start.  Holds the final working set on success.
+    @param f solution on success.
+    @return True if the active set settled and f holds the optimum; false
+        if the problem must go to the generic optimizer instead (fewer
+        free parameters than constraints, a rank-deficient Schur
+        complement, or a cycling active set). */
+    static bool solveActiveSetQP(const SimTK::Matrix& C,
+        const SimTK::Vector& d, const SimTK::Vector& h,
+        const SimTK::Vector& lower, const SimTK::Vector& upper,
+        Array<int>& activeSet, SimTK::Vector& f);
+
     //--------------------------------------------------------------------------
     // REQUIRED OPTIMIZATION TARGET METHODS
     //--------------------------------------------------------------------------
@@ -120,6 +152,7 @@ public:
     CMC* getController() {return (_controller); }
 private:
     void computeConstraintVector(SimTK::State& s, const SimTK::Vector &x, SimTK::Vector &c) const;
+    bool solveBoundConstrainedQP(double *x);
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 };  // END class ActuatorForceTargetFast
@@ -21,8 +21,12 @@
  * -------------------------------------------------------------------------- */
 #include <OpenSim/Common/XMLDocument.h>
 #include "AnalyzeTool.h"
+#include "TrialContext.h"
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/IndexedSTOReader.h>
+#include <OpenSim/Common/FileAdapter.h>
+#include <memory>
 
 #include <OpenSim/Simulation/Control/ControlLinear.h>
 #include <OpenSim/Simulation/Control/ControlSet.h>
@@ -196,6 +200,10 @@ setNull()
 
     _printResultFiles = true;
     _replaceForceSet = false;
+
+    _statesStreaming = false;
+    _statesStreamingWindowSize = 4096;
+    _resultsBundleFileName = "";
 }
 //_____________________________________________________________________________
 /**
@@ -261,6 +269,9 @@ operator=(const AnalyzeTool &aTool)
     _lowpassCutoffFrequency= aTool._lowpassCutoffFrequency;
     _statesStore = aTool._statesStore;
     _printResultFiles = aTool._printResultFiles;
+    _statesStreaming = aTool._statesStreaming;
+    _statesStreamingWindowSize = aTool._statesStreamingWindowSize;
+    _trialContext = aTool._trialContext;
     return(*this);
 }
 
@@ -338,6 +349,26 @@ setStatesStorage(Storage& aStore)
     _statesStore = &aStore;
 }
 //_____________________________________________________________________________
+/**
+ * Set the states from a TimeSeriesTable. The table is converted to the
+ * internal states storage once, here, so callers that already hold their
+ * trajectory as a table (e.g. from a StatesTrajectory or a file adapter)
+ * need not write it out and re-read it through the legacy Storage reader.
+ * The first column of the table must be time, increasing monotonically,
+ * and the column labels must be model state names.
+ *
+ * @param aTable Table containing the time history of model states.
+ */
+void AnalyzeTool::
+setStatesTable(const TimeSeriesTable& aTable)
+{
+    auto* statesStore = new Storage();
+    convertTableToStorage(&aTable, *statesStore);
+    statesStore->setName("states"); // Name appears in GUI
+    delete _statesStore;
+    _statesStore = statesStore;
+}
+//_____________________________________________________________________________
 /**
  * Get the states storage.
  *
@@ -348,6 +379,43 @@ getStatesStorage()
 {
     return *_statesStore;
 }
+//_____________________________________________________________________________
+/**
+ * Set whether run() streams the states file through a windowed reader
+ * instead of loading the entire trial into memory first.  In streaming mode
+ * the states file is indexed once without parsing its numeric columns, and
+ * windows of getStatesStreamingWindowSize() rows are then materialized one
+ * at a time and fed through the same per-frame loop as the in-memory path,
+ * so analyzing a multi-hour recording only ever holds one window of states.
+ *
+ * Streaming requires the states_file property to be set (coordinates cannot
+ * be streamed since filtering and forming speeds require the complete
+ * trial), and is not compatible with analyses that consume the complete
+ * states storage up front (e.g. StaticOptimization and InverseDynamics,
+ * which spline it); such analyses would see only the current window.
+ * This setting is not serialized.
+ *
+ * @param aTrueFalse If true, run() streams the states file.
+ */
+void AnalyzeTool::
+setStatesStreaming(bool aTrueFalse)
+{
+    _statesStreaming = aTrueFalse;
+}
+//_____________________________________________________________________________
+/**
+ * Set the number of state rows materialized per window when streaming the
+ * states file (see setStatesStreaming()).  The default, 4096 rows, keeps
+ * memory use modest without paying a seek per frame.
+ *
+ * @param aNumRows Number of rows per window; must be positive.
+ */
+void AnalyzeTool::
+setStatesStreamingWindowSize(int aNumRows)
+{
+    if(aNumRows<1) throw Exception("AnalyzeTool.setStatesStreamingWindowSize: ERROR- window size must be positive.",__FILE__,__LINE__);
+    _statesStreamingWindowSize = aNumRows;
+}
 
 
 //=============================================================================
@@ -377,7 +445,11 @@ loadStatesFromFile(SimTK::State& s)
                 _statesFileNameProp.getName());
         }
         log_info("Loading states from file '{}'.", _statesFileName);
-        Storage temp(_statesFileName);
+        // A trial context holds a parsed master; copy it rather than
+        // re-reading the file.
+        Storage temp = _trialContext
+            ? Storage(_trialContext->getStorage(_statesFileName))
+            : Storage(_statesFileName);
         _statesStore = new Storage();
         _statesStore->setName("states"); // Name appears in GUI
         _model->formStateStorage(temp, *_statesStore, true);
@@ -386,7 +458,9 @@ loadStatesFromFile(SimTK::State& s)
             throw Exception("AnalyzeTool.initializeFromFiles: Either a states file or a coordinates file must be specified.",__FILE__,__LINE__);
 
         log_info("Loading coordinates from file '{}'.", _coordinatesFileName);
-        Storage coordinatesStore(_coordinatesFileName);
+        Storage coordinatesStore = _trialContext
+            ? Storage(_trialContext->getStorage(_coordinatesFileName))
+            : Storage(_coordinatesFileName);
 
         if(_lowpassCutoffFrequency>=0) {
             log_info("Low-pass filtering coordinates data with a cutoff "
@@ -407,7 +481,9 @@ loadStatesFromFile(SimTK::State& s)
         if(_speedsFileName!="") {
             delete uStore;
             log_info("Loading speeds from file '{}'.", _speedsFileName);
-            uStore = new Storage(_speedsFileName);
+            uStore = _trialContext
+                ? new Storage(_trialContext->getStorage(_speedsFileName))
+                : new Storage(_speedsFileName);
         }
 
         // used to use createStatesStorageFromCoordinatesAndSpeeds(*_model, *qStore, *uStore);
@@ -512,6 +588,52 @@ disableIntegrationOnlyProbes()
     }
 
 }
+//_____________________________________________________________________________
+/**
+ * Bundle the states and the result storages of every active analysis into
+ * one multi-table file, instead of the usual directory of per-analysis
+ * files.  The extension of aFileName selects the registered file adapter
+ * (e.g. ".h5" when OpenSim is built with HDF5 support); each table is
+ * stored under the name "states" or "<analysis>_<storage>".
+ *
+ * @param aFileName Name of the bundle file to write.
+ */
+void AnalyzeTool::
+bundleResults(const std::string &aFileName)
+{
+    std::vector<std::unique_ptr<TimeSeriesTable>> tables;
+    DataAdapter::InputTables inputTables;
+
+    if(_statesStore!=NULL) {
+        tables.emplace_back(
+            new TimeSeriesTable(_statesStore->exportToTable()));
+        inputTables.emplace("states", tables.back().get());
+    }
+
+    AnalysisSet& analysisSet = _model->updAnalysisSet();
+    for(int i=0;i<analysisSet.getSize();i++) {
+        Analysis& analysis = analysisSet.get(i);
+        if(!analysis.getOn()) continue;
+        ArrayPtrs<Storage>& storages = analysis.getStorageList();
+        for(int j=0;j<storages.getSize();j++) {
+            if(storages.get(j)==NULL) continue;
+            tables.emplace_back(
+                new TimeSeriesTable(storages.get(j)->exportToTable()));
+            inputTables.emplace(
+                analysis.getName()+"_"+storages.get(j)->getName(),
+                tables.back().get());
+        }
+    }
+
+    if(inputTables.empty()) {
+        log_warn("AnalyzeTool.bundleResults: no result tables to bundle "
+                 "into '{}'.", aFileName);
+        return;
+    }
+    FileAdapter::writeFile(inputTables, aFileName);
+    log_info("Bundled {} result tables into {}.",
+             inputTables.size(), aFileName);
+}
 //=============================================================================
 // RUN
 //=============================================================================
@@ -551,7 +673,14 @@ bool AnalyzeTool::run(bool plotting)
     _model->getMultibodySystem().realize(s, SimTK::Stage::Position );
 //printf("after AnalyzeTool.run() initSystem \n\n");
 
-    if(_loadModelAndInput) {
+    if(_statesStreaming && !_statesFileNameProp.isValidFileName()) {
+        string msg = "AnalyzeTool.run: ERROR- streaming the states requires a "
+            "states file; coordinates cannot be streamed because filtering "
+            "and forming speeds require the complete trial.";
+        throw Exception(msg,__FILE__,__LINE__);
+    }
+
+    if(_loadModelAndInput && !_statesStreaming) {
         loadStatesFromFile(s);
     }
 
@@ -561,7 +690,8 @@ bool AnalyzeTool::run(bool plotting)
     try {
 
     // VERIFY THE CONTROL SET, STATES, AND PSEUDO STATES ARE TENABLE
-    verifyControlsStates();
+    // (in streaming mode the states are verified on the first window).
+    if(!_statesStreaming) verifyControlsStates();
 
     // SET OUTPUT PRECISION
     IO::SetPrecision(_outputPrecision);
@@ -573,6 +703,9 @@ bool AnalyzeTool::run(bool plotting)
         throw Exception(msg,__FILE__,__LINE__);
     }
 
+    if(_statesStreaming) {
+        runStatesStreaming(s);
+    } else {
     // Call helper function to process analysis
     /*Array<double> bounds;
     bounds.append(_ti);
@@ -591,6 +724,7 @@ bool AnalyzeTool::run(bool plotting)
 
     log_info("Executing the analyses from {} to {}...", ti, tf);
     run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates);
+    }
     _model->getMultibodySystem().realize(s, SimTK::Stage::Position );
     } catch (const Exception& x) {
         x.print(cout);
@@ -603,6 +737,10 @@ bool AnalyzeTool::run(bool plotting)
     if (completed && _printResultFiles)
         printResults(getName(),getResultsDir()); // this will create results directory if necessary
 
+    // BUNDLE RESULTS INTO A SINGLE MULTI-TABLE FILE
+    if (completed && !_resultsBundleFileName.empty())
+        bundleResults(_resultsBundleFileName);
+
     cwd.restore();
 
     removeExternalLoadsFromModel();
@@ -707,3 +845,102 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
         }
     }
 }
+
+//_____________________________________________________________________________
+/**
+ * Run the analyses by streaming the states file in windows (see
+ * setStatesStreaming()).  The file is indexed once by an IndexedSTOReader
+ * without parsing its numeric columns; windows of
+ * getStatesStreamingWindowSize() rows are then materialized one at a time,
+ * mapped onto the model's state order with Model::formStateStorage(), and
+ * fed through the same per-frame processing as the in-memory path, so only
+ * one window of the recording is ever held in memory.
+ *
+ * @param s Working state of the model.
+ */
+void AnalyzeTool::
+runStatesStreaming(SimTK::State& s)
+{
+    AnalysisSet& analysisSet = _model->updAnalysisSet();
+
+    log_info("Streaming states from file '{}'.", _statesFileName);
+    IndexedSTOReader reader(_statesFileName);
+
+    // As in the in-memory path, the closest rows bracketing the requested
+    // time range are used without interpolation.
+    const size_t iInitial = reader.findRowIndex(_ti);
+    const size_t iFinal = reader.findRowIndex(_tf);
+    const size_t windowRows = static_cast<size_t>(_statesStreamingWindowSize);
+
+    log_info("Executing the analyses over {} of {} state frames...",
+        iFinal-iInitial+1, reader.getNumRows());
+
+    int ny = _model->getNumStateVariables();
+    SimTK::Vector stateValues = _model->getStateVariableValues(s);
+    Array<double> rowData(0.0,ny);
+
+    for(size_t start=iInitial; start<=iFinal; start+=windowRows) {
+        const size_t last =
+            (start+windowRows-1 > iFinal) ? iFinal : start+windowRows-1;
+        TimeSeriesTable windowTable = reader.readRowRange(start, last);
+        Storage rawWindow;
+        convertTableToStorage(&windowTable, rawWindow);
+
+        // Map the window's columns onto the model's state order; warn about
+        // unspecified states only once, on the first window.
+        Storage windowStates(static_cast<int>(last-start+1), "states");
+        _model->formStateStorage(rawWindow, windowStates, start==iInitial);
+
+        if(start==iInitial && windowStates.getSmallestNumberOfStates()!=ny) {
+            string msg = "AnalyzeTool.runStatesStreaming: ERROR- Number of states in " + _statesFileName;
+            msg += " doesn't match number of states in model " + _model->getName() + ".";
+            throw Exception(msg,__FILE__,__LINE__);
+        }
+
+        // Point the analyses at the current window. Analyses that consume
+        // the complete states storage up front (e.g. StaticOptimization)
+        // are not supported in streaming mode; see setStatesStreaming().
+        for(int j=0;j<analysisSet.getSize();j++) {
+            analysisSet.get(j).setStatesStore(windowStates);
+        }
+
+        for(int j=0;j<windowStates.getSize();j++) {
+            const size_t i = start + static_cast<size_t>(j);
+            windowStates.getTime(j,s.updTime()); // time
+            _model->setAllControllersEnabled(true);
+
+            // formStateStorage() ordered the columns to match the model's
+            // states, so the values can be assigned without further mapping.
+            windowStates.getData(j,ny,&rowData[0]);
+            for(int k=0;k<ny;k++) stateValues[k] = rowData[k];
+            _model->setStateVariableValues(s, stateValues);
+
+            // Adjust configuration to match constraints and other goals
+            _model->assemble(s);
+
+            // equilibrateMuscles before realization as it may affect forces
+            if(_solveForEquilibriumForAuxiliaryStates){
+                try{// might not be able to equilibrate if model is in
+                    // a non-physical pose; the muscle will throw an
+                    // Exception in this case.
+                    _model->equilibrateMuscles(s);
+                }
+                catch (const std::exception& e) {
+                    log_warn("AnalyzeTool::runStatesStreaming() unable to "
+                        "equilibrate muscles at time = {}. Reason: {}.",
+                        s.getTime(), e.what());
+                }
+            }
+            // Make sure model is at least ready to provide kinematics
+            _model->getMultibodySystem().realize(s, SimTK::Stage::Velocity);
+
+            if(i==iInitial) {
+                analysisSet.begin(s);
+            } else if(i==iFinal) {
+                analysisSet.end(s);
+            } else {
+                analysisSet.step(s,static_cast<int>(i));
+            }
+        }
+    }
+}
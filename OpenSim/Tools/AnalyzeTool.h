@@ -32,6 +32,8 @@
 #include <OpenSim/Simulation/Control/ControlSet.h>
 #include "osimToolsDLL.h"
 
+#include <memory>
+
 #ifdef SWIG
     #ifdef OSIMTOOLS_API
         #undef OSIMTOOLS_API
@@ -39,7 +41,9 @@
     #endif
 #endif
 
-namespace OpenSim { 
+namespace OpenSim {
+
+class TrialContext;
 
 //=============================================================================
 //=============================================================================
@@ -77,6 +81,24 @@ private:
 
     /** Whether the model and states should be loaded from input files */
     bool _loadModelAndInput;
+
+    /** Whether run() streams the states file through a windowed reader
+    rather than materializing the whole trial (see setStatesStreaming()).
+    Not serialized. */
+    bool _statesStreaming;
+    /** Number of state rows held in memory per window when streaming. */
+    int _statesStreamingWindowSize;
+
+    /** When non-empty, run() also bundles the states and the result
+    storages of every active analysis into this single multi-table file;
+    the extension selects the registered file adapter (e.g. ".h5" when
+    OpenSim is built with HDF5 support). Not serialized. */
+    std::string _resultsBundleFileName;
+
+    /** Cache of parsed trial files shared with the other tools in a
+    pipeline; not serialized.  When set, the states, coordinates, and speeds
+    files are read from the cache instead of being re-parsed. */
+    std::shared_ptr<TrialContext> _trialContext;
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -94,6 +116,7 @@ private:
     void setNull();
     void setupProperties();
     void constructCorrectiveSprings();
+    void runStatesStreaming(SimTK::State& s);
 
     //--------------------------------------------------------------------------
     // OPERATORS
@@ -108,6 +131,7 @@ public:
     // GET AND SET
     //--------------------------------------------------------------------------
     void setStatesStorage(Storage& aStore);
+    void setStatesTable(const TimeSeriesTable& aTable);
     static Storage *createStatesStorageFromCoordinatesAndSpeeds(const Model& aModel, const Storage& aQStore, const Storage& aUStore);
     Storage& getStatesStorage();
 
@@ -121,6 +145,19 @@ public:
     void setLowpassCutoffFrequency(double aLowpassCutoffFrequency) { _lowpassCutoffFrequency = aLowpassCutoffFrequency; }
     bool getLoadModelAndInput() const { return _loadModelAndInput; }
     void setLoadModelAndInput(bool b) { _loadModelAndInput = b; }
+    void setStatesStreaming(bool aTrueFalse);
+    bool getStatesStreaming() const { return _statesStreaming; }
+    void setStatesStreamingWindowSize(int aNumRows);
+    int getStatesStreamingWindowSize() const
+    { return _statesStreamingWindowSize; }
+    void setResultsBundleFileName(const std::string &aFileName)
+    { _resultsBundleFileName = aFileName; }
+    const std::string &getResultsBundleFileName() const
+    { return _resultsBundleFileName; }
+    /** %Set a cache of parsed trial files to share with the other tools
+    operating on the same trial, so each file is parsed only once. */
+    void setTrialContext(std::shared_ptr<TrialContext> aContext)
+    { _trialContext = aContext; }
 
     //--------------------------------------------------------------------------
     // UTILITIES
@@ -130,6 +167,7 @@ public:
     void verifyControlsStates();
     void setPrintResultFiles(bool aToWrite);
     void disableIntegrationOnlyProbes();
+    void bundleResults(const std::string &aFileName);
     //--------------------------------------------------------------------------
     // INTERFACE
     //--------------------------------------------------------------------------
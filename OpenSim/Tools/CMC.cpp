@@ -855,8 +855,11 @@ computeControls(SimTK::State& s, ControlSet &controlSet)
     _predictor->evaluate(s, &xmin[0], &fmin[0]);
     _predictor->evaluate(s, &xmax[0], &fmax[0]);
 
-    SimTK::State newState = _predictor->getCMCActSubsys()->getCompleteState();
-    
+    // Borrow a recycled working copy rather than constructing a fresh
+    // State every control step; released at the end of this method.
+    SimTK::State& newState =
+        _statePool.acquire(_predictor->getCMCActSubsys()->getCompleteState());
+
      if(_verbose) {
         log_info("tiReal = {}, tfReal = {}", tiReal, tfReal);
         log_info("Min forces: {}", fmin);
@@ -958,6 +961,8 @@ computeControls(SimTK::State& s, ControlSet &controlSet)
     // SET EXCITATIONS
     controlSet.setControlValues(_tf,&controls[0]);
 
+    _statePool.release(newState);
+
     _model->updAnalysisSet().setOn(true);
 }
 
@@ -34,6 +34,7 @@
 #include "osimToolsDLL.h"
 #include <OpenSim/Simulation/Control/ControlSet.h>
 #include <OpenSim/Simulation/Control/TrackingController.h>
+#include <OpenSim/Simulation/StatePool.h>
 
 namespace SimTK {
 class Optimizer;
@@ -134,6 +135,9 @@ protected:
     VectorFunctionForActuators *_predictor;
     /** Array of actuator forces for achieving the desired accelerations. */
     Array<double> _f;
+    /** Recycles the working State copied on every control step so steady-
+    state tracking performs no allocation from state copying. */
+    StatePool _statePool;
 
 
 //=============================================================================
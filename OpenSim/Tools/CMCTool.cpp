@@ -22,6 +22,7 @@
  * -------------------------------------------------------------------------- */
 #include "CMCTool.h"
 #include "CMC.h"
+#include "TrialContext.h"
 #include "CMC_TaskSet.h"
 #include "ActuatorForceTarget.h"
 #include "ActuatorForceTargetFast.h"
@@ -365,6 +366,7 @@ operator=(const CMCTool &aTool)
     _maxIterations = aTool._maxIterations;
     _printLevel = aTool._printLevel;
     _verbose = aTool._verbose;
+    _trialContext = aTool._trialContext;
 
     return(*this);
 }
@@ -442,7 +444,11 @@ bool CMCTool::run()
         log_warn("A desired points file was not specified.");
     } else {
         log_info("Loading desired points from file '{}'...", _desiredPointsFileName);
-        desiredPointsStore = new Storage(_desiredPointsFileName);
+        // A trial context holds a parsed master; copy it rather than
+        // re-reading the file, since the copy is filtered and padded below.
+        desiredPointsStore = _trialContext
+            ? new Storage(_trialContext->getStorage(_desiredPointsFileName))
+            : new Storage(_desiredPointsFileName);
         desiredPointsFlag = true;
     }
 
@@ -452,7 +458,9 @@ bool CMCTool::run()
         log_warn("A desired kinematics file was not specified.");
     } else {
         log_info("Loading desired kinematics from file '{}'...", _desiredKinematicsFileName);
-        desiredKinStore = new Storage(_desiredKinematicsFileName);
+        desiredKinStore = _trialContext
+            ? new Storage(_trialContext->getStorage(_desiredKinematicsFileName))
+            : new Storage(_desiredKinematicsFileName);
         desiredKinFlag = true;
     }
 
@@ -32,6 +32,8 @@
 #include <OpenSim/Simulation/Model/AbstractTool.h>
 #include <OpenSim/Simulation/Model/ForceSet.h>
 
+#include <memory>
+
 #ifdef SWIG
     #ifdef OSIMTOOLS_API
         #undef OSIMTOOLS_API
@@ -43,6 +45,7 @@ namespace OpenSim {
 
 class ControlSet;
 class Storage;
+class TrialContext;
 
 //=============================================================================
 //=============================================================================
@@ -125,6 +128,11 @@ private:
 
     ForceSet _originalForceSet;
 
+    /** Cache of parsed trial files shared with the other tools in a
+    pipeline; not serialized.  When set, the desired kinematics and desired
+    points files are read from the cache instead of being re-parsed. */
+    std::shared_ptr<TrialContext> _trialContext;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -196,6 +204,11 @@ public:
     bool getUseVerbosePrinting() const {return _verbose;};
     void setUseVerbosePrinting(bool verbose) const { _verbose=verbose;};
 
+    /** %Set a cache of parsed trial files to share with the other tools
+    operating on the same trial, so each file is parsed only once. */
+    void setTrialContext(std::shared_ptr<TrialContext> aContext)
+    { _trialContext = aContext; }
+
 
     //--------------------------------------------------------------------------
     // INTERFACE
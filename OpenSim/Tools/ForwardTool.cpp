@@ -26,6 +26,7 @@
 #include <OpenSim/Common/XMLDocument.h>
 #include "ForwardTool.h"
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/OSTBFileAdapter.h>
 
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
@@ -57,7 +58,9 @@ ForwardTool::~ForwardTool()
 ForwardTool::ForwardTool() :
     AbstractTool(),
     _statesFileName(_statesFileNameProp.getValueStr()),
-    _useSpecifiedDt(_useSpecifiedDtProp.getValueBool())
+    _useSpecifiedDt(_useSpecifiedDtProp.getValueBool()),
+    _outputInterval(_outputIntervalProp.getValueDbl()),
+    _outputFormat(_outputFormatProp.getValueStr())
 {
     setNull();
 }
@@ -73,7 +76,9 @@ ForwardTool::ForwardTool() :
 ForwardTool::ForwardTool(const string &aFileName,bool aUpdateFromXMLNode,bool aLoadModel) :
     AbstractTool(aFileName, false),
     _statesFileName(_statesFileNameProp.getValueStr()),
-    _useSpecifiedDt(_useSpecifiedDtProp.getValueBool())
+    _useSpecifiedDt(_useSpecifiedDtProp.getValueBool()),
+    _outputInterval(_outputIntervalProp.getValueDbl()),
+    _outputFormat(_outputFormatProp.getValueStr())
 {
     setNull();
 
@@ -126,7 +131,9 @@ ForwardTool::
 ForwardTool(const ForwardTool &aTool) :
     AbstractTool(aTool),
     _statesFileName(_statesFileNameProp.getValueStr()),
-    _useSpecifiedDt(_useSpecifiedDtProp.getValueBool())
+    _useSpecifiedDt(_useSpecifiedDtProp.getValueBool()),
+    _outputInterval(_outputIntervalProp.getValueDbl()),
+    _outputFormat(_outputFormatProp.getValueStr())
 {
     setNull();
     *this = aTool;
@@ -143,6 +150,8 @@ void ForwardTool::setNull()
     // BASIC
     _statesFileName = "";
     _useSpecifiedDt = false;
+    _outputInterval = -1.0;
+    _outputFormat = "sto";
     _printResultFiles = true;
 
     _replaceForceSet = false;   // default should be false for Forward.
@@ -188,7 +197,21 @@ void ForwardTool::setupProperties()
     _useSpecifiedDtProp.setName("use_specified_dt");
     _propertySet.append( &_useSpecifiedDtProp );
 
-
+    comment = "Time interval between rows written to the results files.  Results are "
+                 "linearly interpolated at this interval; a zero or negative value (the default) "
+                 "writes a row for every integrator step.  Long simulations with small steps "
+                 "produce far more rows than most analyses need, so setting an interval keeps "
+                 "the results files small.";
+    _outputIntervalProp.setComment(comment);
+    _outputIntervalProp.setName("output_interval");
+    _propertySet.append( &_outputIntervalProp );
+
+    comment = "Format for the states results files.  Valid options are 'sto' (the default), "
+                 "which writes text storage files, and 'ostb', which writes the compressed "
+                 "binary table format (much smaller and faster to load for long simulations).";
+    _outputFormatProp.setComment(comment);
+    _outputFormatProp.setName("output_format");
+    _propertySet.append( &_outputFormatProp );
 }
 
 //=============================================================================
@@ -211,6 +234,8 @@ operator=(const ForwardTool &aTool)
     // BASIC INPUT
     _statesFileName = aTool._statesFileName;
     _useSpecifiedDt = aTool._useSpecifiedDt;
+    _outputInterval = aTool._outputInterval;
+    _outputFormat = aTool._outputFormat;
 
     return(*this);
 }
@@ -341,15 +366,40 @@ void ForwardTool::printResultsInternal()
     // so that the parsing code behaves properly if called from a different directory.
     auto cwd = IO::CwdChanger::changeToParentOf(getDocumentFileName());
 
-    AbstractTool::printResults(getName(),getResultsDir()); // this will create results directory if necessary
+    if(_outputFormat!="sto" && _outputFormat!="ostb")
+        throw Exception("ForwardTool: ERR- Unrecognized '"+_outputFormat+"' in "+_outputFormatProp.getName()+" property (expecting 'sto' or 'ostb').",__FILE__,__LINE__);
+
+    // A positive output interval decimates the results; negative writes
+    // every integrator step, as before.
+    double dt = (_outputInterval>0.0) ? _outputInterval : -1.0;
+
+    AbstractTool::printResults(getName(),getResultsDir(),dt); // this will create results directory if necessary
     if (_model) {
         _model->printControlStorage(getResultsDir() + "/" + getName() + "_controls.sto");
-        getManager().getStateStorage().print(getResultsDir() + "/" + getName() + "_states.sto");
 
-        Storage statesDegrees(getManager().getStateStorage());
-        _model->getSimbodyEngine().convertRadiansToDegrees(statesDegrees);
-        statesDegrees.setWriteSIMMHeader(true);
-        statesDegrees.print(getResultsDir() + "/" + getName() + "_states_degrees.mot");
+        if(_outputFormat=="ostb") {
+            Storage states(getManager().getStateStorage());
+            if(dt>0.0) states.resampleLinear(dt);
+            OSTBFileAdapter().write(states.exportToTable(),
+                getResultsDir() + "/" + getName() + "_states.ostb");
+
+            Storage statesDegrees(states);
+            _model->getSimbodyEngine().convertRadiansToDegrees(statesDegrees);
+            OSTBFileAdapter().write(statesDegrees.exportToTable(),
+                getResultsDir() + "/" + getName() + "_states_degrees.ostb");
+        }
+        else {
+            string statesName = getResultsDir() + "/" + getName() + "_states.sto";
+            if(dt>0.0) getManager().getStateStorage().print(statesName,dt);
+            else getManager().getStateStorage().print(statesName);
+
+            Storage statesDegrees(getManager().getStateStorage());
+            _model->getSimbodyEngine().convertRadiansToDegrees(statesDegrees);
+            statesDegrees.setWriteSIMMHeader(true);
+            string statesDegreesName = getResultsDir() + "/" + getName() + "_states_degrees.mot";
+            if(dt>0.0) statesDegrees.print(statesDegreesName,dt);
+            else statesDegrees.print(statesDegreesName);
+        }
     }
 }
 
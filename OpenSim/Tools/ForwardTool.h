@@ -71,6 +71,16 @@ protected:
     OpenSim::PropertyBool _useSpecifiedDtProp;
     bool &_useSpecifiedDt;
 
+    /** Time interval between rows written to the results files.  Zero or
+    negative (the default) writes results at integrator-step granularity. */
+    PropertyDbl _outputIntervalProp;
+    double &_outputInterval;
+
+    /** Format for the states results files: "sto" (the default) or the
+    compressed binary table format "ostb". */
+    PropertyStr _outputFormatProp;
+    std::string &_outputFormat;
+
     /** Storage for the input states. */
     Storage *_yStore;
     /** Flag indicating whether or not to write to the results (GUI will set this to false). */
@@ -120,6 +130,12 @@ public:
     bool getUseSpecifiedDt() const { return _useSpecifiedDt; }
     void setUseSpecifiedDt(bool aUseSpecifiedDt) { _useSpecifiedDt = aUseSpecifiedDt; }
 
+    double getOutputInterval() const { return _outputInterval; }
+    void setOutputInterval(double aOutputInterval) { _outputInterval = aOutputInterval; }
+
+    const std::string &getOutputFormat() const { return _outputFormat; }
+    void setOutputFormat(const std::string &aFormat) { _outputFormat = aFormat; }
+
     void setPrintResultFiles(bool aToWrite) { _printResultFiles = aToWrite; }
 
     //--------------------------------------------------------------------------
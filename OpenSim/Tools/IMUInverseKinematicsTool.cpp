@@ -1,7 +1,9 @@
 
 #include "IMUInverseKinematicsTool.h"
 #include <OpenSim/Simulation/OpenSense/OpenSenseUtilities.h>
+#include <OpenSim/Common/FileAdapter.h>
 #include <OpenSim/Common/IO.h>
+#include <fstream>
 #include <OpenSim/Common/TimeSeriesTable.h>
 #include <OpenSim/Common/TableSource.h>
 #include <OpenSim/Common/STOFileAdapter.h>
@@ -40,7 +42,46 @@ void IMUInverseKinematicsTool::constructProperties()
     constructProperty_orientations_file("");
     OrientationWeightSet orientationWeights;
     constructProperty_orientation_weights(orientationWeights);
+    constructProperty_orientations_chunk_size(0);
 }
+
+namespace {
+// Add a TableReporter wired to every coordinate value (locking
+// translational coordinates), or rewire the existing one. Ideally if we add
+// a Reporter, we also remove it at the end for good hygiene but at the
+// moment there's no interface to remove a Reporter so we reuse one if it
+// exists.
+TableReporter* addOrReuseIKReporter(Model& model) {
+    const auto reporterExists =
+            model.findComponent<TableReporter>("ik_reporter");
+    bool reuse_reporter = true;
+    TableReporter* ikReporter = nullptr;
+    if (reporterExists == nullptr) {
+        // Add a reporter to get IK computed coordinate values out
+        ikReporter = new TableReporter();
+        ikReporter->setName("ik_reporter");
+        reuse_reporter = false;
+    } else
+        ikReporter = &model.updComponent<TableReporter>("ik_reporter");
+
+    auto coordinates = model.updComponentList<Coordinate>();
+
+    // Hookup reporter inputs to the individual coordinate outputs
+    // and lock coordinates that are translational since they cannot be
+    for (auto& coord : coordinates) {
+        ikReporter->updInput("inputs").connect(
+                coord.getOutput("value"), coord.getName());
+        if (coord.getMotionType() == Coordinate::Translational) {
+            coord.setDefaultLocked(true);
+        }
+    }
+
+    if (!reuse_reporter) {
+        model.addComponent(ikReporter);
+    }
+    return ikReporter;
+}
+} // anonymous namespace
 /**
 void IMUInverseKinematicsTool::
     previewExperimentalData(const TimeSeriesTableVec3& markers,
@@ -95,35 +136,7 @@ void IMUInverseKinematicsTool::runInverseKinematicsWithOrientationsFromFile(
         Model& model, const std::string& orientationsFileName,
         bool visualizeResults) {
 
-    // Ideally if we add a Reporter, we also remove it at the end for good hygiene but 
-    // at the moment there's no interface to remove Reporter so we'll reuse one if exists
-    const auto reporterExists = model.findComponent<TableReporter>("ik_reporter");
-
-    bool reuse_reporter = true;
-    TableReporter* ikReporter = nullptr;
-    if (reporterExists == nullptr) {
-        // Add a reporter to get IK computed coordinate values out
-        ikReporter = new TableReporter();
-        ikReporter->setName("ik_reporter");
-        reuse_reporter = false;
-    } else
-        ikReporter = &model.updComponent<TableReporter>("ik_reporter");
-
-    auto coordinates = model.updComponentList<Coordinate>();
-
-    // Hookup reporter inputs to the individual coordinate outputs
-    // and lock coordinates that are translational since they cannot be
-    for (auto& coord : coordinates) {
-        ikReporter->updInput("inputs").connect(
-                coord.getOutput("value"), coord.getName());
-        if (coord.getMotionType() == Coordinate::Translational) {
-            coord.setDefaultLocked(true);
-        }
-    }
-
-    if (!reuse_reporter) {
-        model.addComponent(ikReporter);
-    }
+    TableReporter* ikReporter = addOrReuseIKReporter(model);
     TimeSeriesTable_<SimTK::Quaternion> quatTable(orientationsFileName);
     log_info("Loading orientations as quaternions from '{}'...",
         orientationsFileName);
@@ -256,6 +269,291 @@ void IMUInverseKinematicsTool::runInverseKinematicsWithOrientationsFromFile(
 }
 
 
+void IMUInverseKinematicsTool::runInverseKinematicsWithLiveOrientations(
+        Model& model,
+        const std::shared_ptr<BufferedOrientationsReference>& oRefs,
+        bool visualizeResults) {
+
+    OPENSIM_THROW_IF(!oRefs || oRefs->getNumRefs() < 1, Exception,
+            "runInverseKinematicsWithLiveOrientations requires a "
+            "BufferedOrientationsReference that names at least one sensor.");
+
+    // Reuse a reporter if one exists, as in the file-based run.
+    TableReporter* ikReporter = addOrReuseIKReporter(model);
+
+    if (visualizeResults)
+        model.setUseVisualizer(true);
+    SimTK::State& s0 = model.initSystem();
+
+    AnalysisSet& analysisSet = model.updAnalysisSet();
+    analysisSet.begin(s0);
+
+    SimTK::Array_<CoordinateReference> coordinateReferences;
+    const double accuracy = 1e-4;
+    InverseKinematicsSolver ikSolver(
+            model, nullptr, oRefs, coordinateReferences);
+    ikSolver.setAccuracy(accuracy);
+    // Each track() pops the next queued frame and takes its time from the
+    // frame's timestamp, so no table of times is ever materialized.
+    ikSolver.setAdvanceTimeFromReference(true);
+
+    // assemble() consumes (and blocks for) the first streamed frame.
+    ikSolver.assemble(s0);
+    if (visualizeResults) {
+        model.getVisualizer().show(s0);
+        model.getVisualizer().getSimbodyVisualizer().setShowSimTime(true);
+    }
+
+    int step = 0;
+    while (oRefs->hasNext() || oRefs->hasQueuedData()) {
+        const double previousTime = s0.getTime();
+        ikSolver.track(s0);
+        // The reference reports the end of a drained stream by leaving the
+        // time unchanged (see BufferedOrientationsReference).
+        if (step > 0 && s0.getTime() == previousTime) break;
+        if (visualizeResults)
+            model.getVisualizer().show(s0);
+        analysisSet.step(s0, step++);
+        model.realizeReport(s0);
+    }
+
+    auto report = ikReporter->getTable();
+    auto resultsDir = get_results_directory();
+    if (resultsDir.empty() && !get_output_motion_file().empty())
+        resultsDir = IO::getParentDirectory(get_output_motion_file());
+    if (!resultsDir.empty()) {
+        IO::makeDir(resultsDir);
+        auto cwd = IO::CwdChanger::changeTo(resultsDir);
+        std::string outName = IO::GetFileNameFromURI(get_output_motion_file());
+        if (outName.empty()) outName = "ik_live";
+
+        model.getSimbodyEngine().convertRadiansToDegrees(report);
+        report.updTableMetaData().setValueForKey<string>("name", outName);
+
+        auto fullOutputFilename = outName;
+        std::string::size_type extSep = fullOutputFilename.rfind(".");
+        if (extSep == std::string::npos) { fullOutputFilename.append(".mot"); }
+        STOFileAdapter_<double>::write(report, fullOutputFilename);
+        log_info("Wrote live IK with IMU tracking results to: '{}'.",
+                fullOutputFilename);
+    } else
+        log_info("IMUInverseKinematicsTool: No output files were generated, "
+                 "set output_motion_file to generate output files.");
+    // Results written to file, clear in case we run again
+    ikReporter->clearTable();
+}
+
+void IMUInverseKinematicsTool::runInverseKinematicsWithChunkedOrientationsFromFile(
+        Model& model, const std::string& orientationsFileName,
+        int framesPerChunk, bool visualizeResults) {
+
+    OPENSIM_THROW_IF(framesPerChunk < 1, Exception,
+            "runInverseKinematicsWithChunkedOrientationsFromFile requires a "
+            "positive chunk size.");
+
+    std::ifstream inStream{ orientationsFileName };
+    OPENSIM_THROW_IF(!inStream.good(), Exception,
+            "Could not open orientations file '" + orientationsFileName +
+            "'.");
+
+    // Skip the STO header, then take the sensor names from the labels line.
+    std::string line;
+    bool sawEndHeader = false;
+    while (std::getline(inStream, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line == "endheader") { sawEndHeader = true; break; }
+    }
+    OPENSIM_THROW_IF(!sawEndHeader, Exception,
+            "'" + orientationsFileName + "' is not a valid .sto file: no "
+            "endheader line was found.");
+    std::getline(inStream, line);
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    std::vector<std::string> labels = FileAdapter::tokenize(line, "\t");
+    OPENSIM_THROW_IF(labels.size() < 2 || labels[0] != "time", Exception,
+            "'" + orientationsFileName + "' does not have a time column "
+            "followed by sensor columns.");
+    const std::vector<std::string> sensorNames(
+            labels.begin() + 1, labels.end());
+    const int numSensors = int(sensorNames.size());
+
+    log_info("Streaming orientations as quaternions from '{}' in chunks of "
+             "{} frames...", orientationsFileName, framesPerChunk);
+
+    // Convert to OpenSim Frame
+    const SimTK::Vec3& rotations = get_sensor_to_opensim_rotations();
+    SimTK::Rotation sensorToOpenSim = SimTK::Rotation(
+            SimTK::BodyOrSpaceType::SpaceRotationSequence,
+            rotations[0], SimTK::XAxis, rotations[1], SimTK::YAxis,
+            rotations[2], SimTK::ZAxis);
+
+    TableReporter* ikReporter = addOrReuseIKReporter(model);
+
+    if (visualizeResults)
+        model.setUseVisualizer(true);
+    SimTK::State& s0 = model.initSystem();
+
+    AnalysisSet& analysisSet = model.updAnalysisSet();
+    analysisSet.begin(s0);
+
+    // The chunk window is the queue of a live-style reference; the solver
+    // consumes it exactly as it would a live stream, so converted frames
+    // never accumulate beyond one chunk.
+    auto oRefs = std::make_shared<BufferedOrientationsReference>(
+            sensorNames, &get_orientation_weights());
+
+    SimTK::Array_<CoordinateReference> coordinateReferences;
+    const double accuracy = 1e-4;
+    InverseKinematicsSolver ikSolver(
+            model, nullptr, oRefs, coordinateReferences);
+    ikSolver.setAccuracy(accuracy);
+    ikSolver.setAdvanceTimeFromReference(true);
+
+    // Reused per-row scratch: parse into quaternions, rotate in place, and
+    // convert into the row pushed to the queue.
+    std::vector<SimTK::Quaternion> quaternions(numSensors);
+    SimTK::RowVector_<SimTK::Rotation> rotationRow(numSensors);
+    const double startTime = getStartTime();
+    const double endTime = getEndTime();
+    bool pastEndTime = false;
+
+    // Read, rotate, convert and queue up to framesPerChunk rows; returns
+    // the number queued (0 at end of file or past the tool's time range).
+    auto queueChunk = [&]() -> int {
+        int queued = 0;
+        std::string dataLine;
+        while (!pastEndTime && queued < framesPerChunk &&
+                std::getline(inStream, dataLine)) {
+            if (!dataLine.empty() && dataLine.back() == '\r')
+                dataLine.pop_back();
+            if (dataLine.empty()) continue;
+            const std::vector<std::string> tokens =
+                    FileAdapter::tokenize(dataLine, "\t");
+            OPENSIM_THROW_IF(int(tokens.size()) != numSensors + 1, Exception,
+                    "'" + orientationsFileName + "' has a data row with " +
+                    std::to_string(tokens.size() - 1) + " columns; expected " +
+                    std::to_string(numSensors) + ".");
+            const double time = std::stod(tokens[0]);
+            // honor the tool's time range as quatTable.trim() does
+            if (time < startTime) continue;
+            if (time > endTime) { pastEndTime = true; break; }
+            for (int i = 0; i < numSensors; ++i) {
+                const std::vector<std::string> elements =
+                        FileAdapter::tokenize(tokens[i + 1], ",");
+                OPENSIM_THROW_IF(elements.size() != 4, Exception,
+                        "'" + orientationsFileName + "' has a malformed "
+                        "quaternion in column '" + sensorNames[i] + "'.");
+                quaternions[i] = SimTK::Quaternion(std::stod(elements[0]),
+                        std::stod(elements[1]), std::stod(elements[2]),
+                        std::stod(elements[3]));
+            }
+            // Rotate data so Y-Axis is up
+            OpenSenseUtilities::rotateQuaternions(
+                    sensorToOpenSim, quaternions.data(), numSensors);
+            OpenSenseUtilities::convertQuaternionsToRotations(
+                    quaternions.data(), numSensors, &rotationRow[0]);
+            oRefs->putValues(time, rotationRow);
+            ++queued;
+        }
+        return queued;
+    };
+
+    std::shared_ptr<TimeSeriesTable> modelOrientationErrors(
+            get_report_errors() ? new TimeSeriesTable()
+                                : nullptr);
+    SimTK::Array_<double> orientationErrors;
+    int step = 0;
+    bool firstChunk = true;
+    while (true) {
+        const int queued = queueChunk();
+        if (queued == 0) break;
+        if (firstChunk) {
+            // assemble() consumes the first queued frame.
+            ikSolver.assemble(s0);
+            const int nos = ikSolver.getNumOrientationSensorsInUse();
+            orientationErrors.resize(nos, 0.0);
+            if (get_report_errors()) {
+                SimTK::Array_<string> errorLabels;
+                for (int i = 0; i < nos; ++i) {
+                    errorLabels.push_back(
+                            ikSolver.getOrientationSensorNameForIndex(i));
+                }
+                modelOrientationErrors->setColumnLabels(errorLabels);
+                modelOrientationErrors->updTableMetaData()
+                        .setValueForKey<string>("name", "OrientationErrors");
+            }
+            if (visualizeResults) {
+                model.getVisualizer().show(s0);
+                model.getVisualizer().getSimbodyVisualizer()
+                        .setShowSimTime(true);
+            }
+            firstChunk = false;
+        }
+        // Track every frame of this chunk; each track() pops one frame.
+        while (oRefs->hasQueuedData()) {
+            ikSolver.track(s0);
+            if (get_report_errors()) {
+                ikSolver.computeCurrentOrientationErrors(orientationErrors);
+                modelOrientationErrors->appendRow(
+                        s0.getTime(), orientationErrors);
+            }
+            if (visualizeResults)
+                model.getVisualizer().show(s0);
+            else
+                log_info("Solved at time: {} s", s0.getTime());
+            // realize to report to get reporter to pull values from model
+            analysisSet.step(s0, step++);
+            model.realizeReport(s0);
+        }
+    }
+    OPENSIM_THROW_IF(firstChunk, Exception,
+            "'" + orientationsFileName + "' contains no orientation frames "
+            "in the tool's time range.");
+
+    auto report = ikReporter->getTable();
+    // form resultsDir either from results_directory or output_motion_file
+    auto resultsDir = get_results_directory();
+    if (resultsDir.empty() && !get_output_motion_file().empty())
+        resultsDir = IO::getParentDirectory(get_output_motion_file());
+    if (!resultsDir.empty()) {
+        IO::makeDir(resultsDir);
+        // directory will be restored on block exit
+        // by changing dir all other files are created in resultsDir
+        auto cwd = IO::CwdChanger::changeTo(resultsDir);
+        std::string outName = get_output_motion_file();
+        outName = IO::GetFileNameFromURI(outName);
+        if (outName.empty()) {
+            bool isAbsolutePath;
+            string directory, fileName, extension;
+            SimTK::Pathname::deconstructPathname(orientationsFileName,
+                    isAbsolutePath, directory, fileName, extension);
+            outName = "ik_" + fileName;
+        }
+        std::string outputFile = outName;
+
+        // Convert to degrees to compare with marker-based IK
+        // but only for rotational coordinates
+        model.getSimbodyEngine().convertRadiansToDegrees(report);
+        report.updTableMetaData().setValueForKey<string>("name", outName);
+
+        auto fullOutputFilename = outputFile;
+        std::string::size_type extSep = fullOutputFilename.rfind(".");
+        if (extSep == std::string::npos) { fullOutputFilename.append(".mot"); }
+        STOFileAdapter_<double>::write(report, fullOutputFilename);
+
+        log_info("Wrote IK with IMU tracking results to: '{}'.",
+                fullOutputFilename);
+        if (get_report_errors()) {
+            STOFileAdapter_<double>::write(*modelOrientationErrors,
+                    outName + "_orientationErrors.sto");
+        }
+    }
+    else
+        log_info("IMUInverseKinematicsTool: No output files were generated, "
+            "set output_motion_file to generate output files.");
+    // Results written to file, clear in case we run again
+    ikReporter->clearTable();
+}
+
 // main driver
 bool IMUInverseKinematicsTool::run(bool visualizeResults)
 {
@@ -263,9 +561,15 @@ bool IMUInverseKinematicsTool::run(bool visualizeResults)
         _model.reset(new Model(get_model_file()));
     }
 
-    runInverseKinematicsWithOrientationsFromFile(*_model,
-                                                 get_orientations_file(),
-                                                 visualizeResults);
+    if (get_orientations_chunk_size() > 0) {
+        runInverseKinematicsWithChunkedOrientationsFromFile(*_model,
+                get_orientations_file(), get_orientations_chunk_size(),
+                visualizeResults);
+    } else {
+        runInverseKinematicsWithOrientationsFromFile(*_model,
+                                                     get_orientations_file(),
+                                                     visualizeResults);
+    }
 
     return true;
 }
@@ -41,9 +41,12 @@
 #include <OpenSim/Common/Set.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
 #include <OpenSim/Simulation/Model/Point.h>
+#include <OpenSim/Simulation/BufferedOrientationsReference.h>
 #include <OpenSim/Simulation/OrientationsReference.h>
 #include <OpenSim/Tools/InverseKinematicsToolBase.h>
 
+#include <memory>
+
 namespace OpenSim {
 
 class Model;
@@ -88,6 +91,13 @@ public:
             "weight being a positive scalar. If not provided, all IMU "
             "orientations are tracked with weight 1.0.");
 
+    OpenSim_DECLARE_PROPERTY(orientations_chunk_size, int,
+            "Number of orientation frames to hold in memory at a time. "
+            "0 (the default) loads and converts the whole orientations file "
+            "at once; a positive value streams the file through a window of "
+            "that many frames (load, convert, track, discard), bounding "
+            "memory use for recordings too long to hold in RAM.");
+
     //=============================================================================
 // METHODS
 //=============================================================================
@@ -112,6 +122,35 @@ public:
     void runInverseKinematicsWithOrientationsFromFile(Model& model,
                             const std::string& quaternionStoFileName, bool visualizeResults=false);
 
+    /** Track orientations from a quaternion .sto file without ever holding
+    the whole recording in memory: rows are read from the file
+    framesPerChunk at a time, rotated into the OpenSim frame, converted to
+    Rotations and queued for the solver, then the chunk is tracked and its
+    storage reused for the next one. Peak orientation-data memory is one
+    chunk regardless of recording length, so overnight recordings that
+    exceed RAM in runInverseKinematicsWithOrientationsFromFile() can be
+    solved on the same node. Only the solved coordinate values and
+    (optionally) per-frame orientation errors accumulate, which are the
+    results written at the end and are small next to the orientation data.
+    Results and error reporting follow the file-based run. */
+    void runInverseKinematicsWithChunkedOrientationsFromFile(Model& model,
+            const std::string& quaternionStoFileName, int framesPerChunk,
+            bool visualizeResults = false);
+
+    /** Track orientations streamed live through the passed-in reference
+    instead of loaded from a file. The reference is typically a live
+    BufferedOrientationsReference constructed from sensor names and fed by
+    an IMUStreamReceiver (or any single producer calling putValues());
+    frames flow from the acquisition thread to the solver with no
+    intermediate table construction. The solver advances its time from the
+    queued frames (InverseKinematicsSolver::setAdvanceTimeFromReference)
+    and the loop runs until the producer marks the stream finished and the
+    queue drains. Solved coordinates are reported through the same
+    ik_reporter/output_motion_file path as the file-based run. */
+    void runInverseKinematicsWithLiveOrientations(Model& model,
+            const std::shared_ptr<BufferedOrientationsReference>& oRefs,
+            bool visualizeResults = false);
+
 private:
     void constructProperties();
 
@@ -25,7 +25,9 @@
 // INCLUDES
 //=============================================================================
 #include "InverseDynamicsTool.h"
+#include "TrialContext.h"
 
+#include <OpenSim/Common/CommonUtilities.h>
 #include <OpenSim/Common/Constant.h>
 #include <OpenSim/Common/FunctionSet.h>
 #include <OpenSim/Common/GCVSplineSet.h>
@@ -188,6 +190,7 @@ operator=(const InverseDynamicsTool &aTool)
     _outputGenForceFileName = aTool._outputGenForceFileName;
     _outputBodyForcesAtJointsFileName = aTool._outputBodyForcesAtJointsFileName;
     _coordinateValues = NULL;
+    _trialContext = aTool._trialContext;
 
     return(*this);
 }
@@ -349,8 +352,16 @@ bool InverseDynamicsTool::run()
             if(_coordinateValues->isInDegrees()){
                 _model->getSimbodyEngine().convertDegreesToRadians(*_coordinateValues);
             }
-            // Create differentiable splines of the coordinate data
-            GCVSplineSet coordSplines(5, _coordinateValues);
+            // Create differentiable splines of the coordinate data.  The
+            // trial context caches the fit so a pipeline of tools pays for
+            // it only once; the cached fit is of the unfiltered data, so it
+            // is only equivalent when no filtering was requested here.
+            GCVSplineSet coordSplines =
+                (_trialContext && _lowpassCutoffFrequency<0 &&
+                 _coordinatesFileName!="")
+                ? _trialContext->getCoordinateSplines(_coordinatesFileName,
+                        *_model)
+                : GCVSplineSet(5, _coordinateValues);
 
             // Functions must correspond to model coordinates.
             // Solver needs the order of Function's to be the same as order
@@ -419,10 +430,13 @@ bool InverseDynamicsTool::run()
         // Preallocate results
         Array_<Vector> genForceTraj(nt, Vector(nCoords, 0.0));
 
-        // solve for the trajectory of generalized forces that correspond to the 
+        // solve for the trajectory of generalized forces that correspond to the
         // coordinate trajectories provided
-        ivdSolver.solve(s, coordFunctions, coordinatesToSpeedsIndexMap, times,
-                genForceTraj);
+        {
+            ScopedTimer timer("InverseDynamicsTool::solve");
+            ivdSolver.solve(s, coordFunctions, coordinatesToSpeedsIndexMap,
+                    times, genForceTraj);
+        }
         success = true;
 
         log_info("InverseDynamicsTool: {} time frames in {}.", nt, 
@@ -530,7 +544,13 @@ bool InverseDynamicsTool::loadCoordinateValues()
         return true;
     // Try constructing coordinates from specified file
     if(_coordinatesFileName != "" && _coordinatesFileName != "Unassigned"){
-            _coordinateValues = new Storage(_coordinatesFileName);
+            // A trial context holds a parsed master; copy it rather than
+            // re-reading the file, since the copy may be filtered below.
+            if(_trialContext)
+                _coordinateValues =
+                    new Storage(_trialContext->getStorage(_coordinatesFileName));
+            else
+                _coordinateValues = new Storage(_coordinatesFileName);
             _coordinateValues->setName(_coordinatesFileName);
             return true;
     }
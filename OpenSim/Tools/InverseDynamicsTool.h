@@ -26,6 +26,8 @@
 #include <OpenSim/Common/Storage.h>
 #include "DynamicsTool.h"
 
+#include <memory>
+
 #ifdef SWIG
     #ifdef OSIMTOOLS_API
         #undef OSIMTOOLS_API
@@ -37,6 +39,7 @@ namespace OpenSim {
 
 class Model;
 class JointSet;
+class TrialContext;
 
 //=============================================================================
 //=============================================================================
@@ -88,6 +91,11 @@ protected:
     PropertyStr _outputBodyForcesAtJointsFileNameProp;
     std::string &_outputBodyForcesAtJointsFileName;
 
+    /** Cache of parsed trial files shared with the other tools in a
+    pipeline; not serialized.  When set, the coordinates file is read from
+    the cache instead of being re-parsed. */
+    std::shared_ptr<TrialContext> _trialContext;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -156,6 +164,11 @@ public:
     void setLowpassCutoffFrequency(double aFrequency) {
         _lowpassCutoffFrequency = aFrequency;
     }
+    /** %Set a cache of parsed trial files to share with the other tools
+    operating on the same trial, so each file is parsed only once. */
+    void setTrialContext(std::shared_ptr<TrialContext> aContext) {
+        _trialContext = aContext;
+    }
     //--------------------------------------------------------------------------
     // INTERFACE
     //--------------------------------------------------------------------------
@@ -0,0 +1,199 @@
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  InverseKinematicsBatch.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+//=============================================================================
+// INCLUDES
+//=============================================================================
+#include "InverseKinematicsBatch.h"
+
+#include <OpenSim/Analyses/Kinematics.h>
+#include <OpenSim/Common/Storage.h>
+#include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Simulation/MarkersReference.h>
+#include <OpenSim/Simulation/Model/Model.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace OpenSim;
+using namespace std;
+
+//=============================================================================
+// CONSTRUCTION
+//=============================================================================
+InverseKinematicsBatch::InverseKinematicsBatch(
+        const InverseKinematicsTool& prototype) : _prototype(prototype)
+{}
+
+void InverseKinematicsBatch::addTrial(const std::string& markerFile,
+                                      const std::string& outputMotionFile)
+{
+    Trial trial;
+    trial.markerFile = markerFile;
+    trial.outputMotionFile = outputMotionFile;
+    _trials.push_back(trial);
+}
+
+//=============================================================================
+// RUN
+//=============================================================================
+int InverseKinematicsBatch::run(int numThreads)
+{
+    const int numTrials = getNumTrials();
+    if (numTrials == 0)
+        return 0;
+
+    // Resolve the shared model once for the whole batch.
+    std::unique_ptr<Model> loadedModel;
+    const Model* sourceModel = _model.get();
+    if (sourceModel == nullptr) {
+        OPENSIM_THROW_IF(_prototype.get_model_file().empty(), Exception,
+            "InverseKinematicsBatch requires a model; provide one with "
+            "setModel() or through the prototype tool's model_file.");
+        loadedModel.reset(new Model(_prototype.get_model_file()));
+        loadedModel->finalizeFromProperties();
+        sourceModel = loadedModel.get();
+    }
+
+    if (numThreads <= 0)
+        numThreads = (int)std::thread::hardware_concurrency();
+    numThreads = std::max(1, std::min(numThreads, numTrials));
+
+    std::atomic<int> nextTrial(0);
+    std::atomic<int> numSolved(0);
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        try {
+            // One model copy and one initialized system per worker, reused
+            // for every trial this worker processes.
+            Model workerModel(*sourceModel);
+            std::unique_ptr<Kinematics> reporter(new Kinematics());
+            reporter->setRecordAccelerations(false);
+            reporter->setInDegrees(true);
+            workerModel.addAnalysis(reporter.get());
+            const SimTK::State baseState = workerModel.initSystem();
+
+            while (true) {
+                const int t = nextTrial++;
+                if (t >= numTrials)
+                    break;
+                try {
+                    solveTrial(workerModel, *reporter, baseState, _trials[t]);
+                    ++numSolved;
+                    log_info("InverseKinematicsBatch solved trial {} of {} "
+                             "({}).", t+1, numTrials, _trials[t].markerFile);
+                }
+                catch (const std::exception& ex) {
+                    // A bad trial is logged and skipped; it does not stop
+                    // the batch.
+                    log_error("InverseKinematicsBatch failed on trial {}: {}",
+                        _trials[t].markerFile, ex.what());
+                }
+            }
+
+            workerModel.removeAnalysis(reporter.get(), false);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError)
+                firstError = std::current_exception();
+        }
+    };
+
+    if (numThreads <= 1) {
+        worker();
+    }
+    else {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i)
+            threads.emplace_back(worker);
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    if (firstError)
+        std::rethrow_exception(firstError);
+
+    log_info("InverseKinematicsBatch completed {} of {} trial(s).",
+        (int)numSolved, numTrials);
+
+    return numSolved;
+}
+
+//_____________________________________________________________________________
+/*
+ * Solve one trial with a worker's model, reporter and base state, and write
+ * the resulting coordinate trajectory to the trial's output motion file.
+ */
+void InverseKinematicsBatch::solveTrial(Model& model, Kinematics& reporter,
+        const SimTK::State& baseState, const Trial& trial) const
+{
+    // A per-trial copy of the prototype carries the trial's marker file and
+    // the worker's model into populateReferences(); copying the tool is
+    // trivial next to a solve.
+    InverseKinematicsTool tool(_prototype);
+    tool.setModel(model);
+    tool.set_marker_file(trial.markerFile);
+
+    MarkersReference markersReference;
+    SimTK::Array_<CoordinateReference> coordinateReferences;
+    tool.populateReferences(markersReference, coordinateReferences);
+
+    // Clip the tool's time range to that of the trial's marker data.
+    SimTK::Vec2 markersValidTimeRange = markersReference.getValidTimeRange();
+    double start_time = (markersValidTimeRange[0] > tool.getStartTime()) ?
+        markersValidTimeRange[0] : tool.getStartTime();
+    double final_time = (markersValidTimeRange[1] < tool.getEndTime()) ?
+        markersValidTimeRange[1] : tool.getEndTime();
+
+    SimTK_ASSERT2_ALWAYS(final_time >= start_time,
+        "InverseKinematicsBatch trial final time (%f) is before start "
+        "time (%f).", final_time, start_time);
+
+    const auto& markersTable = markersReference.getMarkerTable();
+    const int start_ix = int(
+        markersTable.getNearestRowIndexForTime(start_time) );
+    const int final_ix = int(
+        markersTable.getNearestRowIndexForTime(final_time) );
+    const auto& times = markersTable.getIndependentColumn();
+
+    SimTK::State s = baseState;
+    InverseKinematicsSolver ikSolver(model,
+        make_shared<MarkersReference>(markersReference),
+        coordinateReferences, tool.get_constraint_weight());
+    ikSolver.setAccuracy(tool.get_accuracy());
+    s.updTime() = times[start_ix];
+    ikSolver.assemble(s);
+    reporter.begin(s);
+
+    for (int i = start_ix; i <= final_ix; ++i) {
+        s.updTime() = times[i];
+        ikSolver.track(s);
+        reporter.step(s, i);
+    }
+
+    reporter.getPositionStorage()->print(trial.outputMotionFile);
+}
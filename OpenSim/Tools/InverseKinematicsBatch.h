@@ -0,0 +1,103 @@
+#ifndef OPENSIM_INVERSE_KINEMATICS_BATCH_H_
+#define OPENSIM_INVERSE_KINEMATICS_BATCH_H_
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  InverseKinematicsBatch.h                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimToolsDLL.h"
+#include <OpenSim/Tools/InverseKinematicsTool.h>
+
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+class Kinematics;
+class Model;
+
+//=============================================================================
+//=============================================================================
+/**
+ * Process many marker trials against the same model without paying the
+ * model loading and Model::initSystem() cost per trial. A prototype
+ * InverseKinematicsTool supplies the model, the IKTaskSet and the solver
+ * settings (accuracy, constraint weight, time range); trials are a manifest
+ * of marker files, each with the motion file its solution is written to.
+ *
+ * run() builds one Model copy and one initialized system per worker thread
+ * and reuses them for every trial that worker processes, so 10,000 trials
+ * cost as many system initializations as there are threads. Each trial is
+ * solved as the tool would solve it, but without the per-trial error and
+ * marker-location reports of InverseKinematicsTool::run().
+ */
+class OSIMTOOLS_API InverseKinematicsBatch {
+//=============================================================================
+// METHODS
+//=============================================================================
+public:
+    /** Construct a batch from the prototype tool whose model, tasks and
+        solver settings every trial shares. The prototype is copied; later
+        changes to the tool do not affect the batch. */
+    explicit InverseKinematicsBatch(const InverseKinematicsTool& prototype);
+
+    /** Use this model for the batch instead of loading the prototype
+        tool's model_file. The batch keeps a reference; the model must
+        outlive run(). Workers copy it, so it is never modified. */
+    void setModel(const Model& model) { _model = &model; }
+
+    /** Append a trial: the marker (.trc) file to solve and the coordinate
+        motion (.mot) file its solution is written to. */
+    void addTrial(const std::string& markerFile,
+                  const std::string& outputMotionFile);
+
+    int getNumTrials() const { return (int)_trials.size(); }
+
+    /** Process all trials on a pool of worker threads and return the number
+        of trials that solved successfully. Trials that fail are logged and
+        skipped; they do not stop the batch. A numThreads of 0 (the default)
+        uses the available hardware concurrency. */
+    int run(int numThreads = 0);
+
+private:
+    struct Trial {
+        std::string markerFile;
+        std::string outputMotionFile;
+    };
+
+    // Solve one trial with a worker's model, reporter and base state.
+    void solveTrial(Model& model, Kinematics& reporter,
+                    const SimTK::State& baseState, const Trial& trial) const;
+
+    // The tool whose settings every trial shares.
+    InverseKinematicsTool _prototype;
+
+    // The model every trial is solved against, when supplied by the
+    // caller rather than loaded from the prototype's model_file.
+    SimTK::ReferencePtr<const Model> _model;
+
+    std::vector<Trial> _trials;
+
+//=============================================================================
+};  // END of class InverseKinematicsBatch
+//=============================================================================
+} // namespace
+
+#endif // OPENSIM_INVERSE_KINEMATICS_BATCH_H_
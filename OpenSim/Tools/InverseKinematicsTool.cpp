@@ -28,8 +28,10 @@
 #include "IKCoordinateTask.h"
 #include "IKMarkerTask.h"
 #include "IKTaskSet.h"
+#include "TrialContext.h"
 
 #include <OpenSim/Analyses/Kinematics.h>
+#include <OpenSim/Common/CommonUtilities.h>
 #include <OpenSim/Common/Constant.h>
 #include <OpenSim/Common/FunctionSet.h>
 #include <OpenSim/Common/GCVSplineSet.h>
@@ -40,6 +42,10 @@
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 using namespace OpenSim;
 using namespace std;
 using namespace SimTK;
@@ -86,6 +92,7 @@ void InverseKinematicsTool::constructProperties()
     constructProperty_marker_file("");
     constructProperty_coordinate_file("");
     constructProperty_report_marker_locations(false);
+    constructProperty_parallel_threads(1);
 }
 
 //=============================================================================
@@ -189,19 +196,145 @@ bool InverseKinematicsTool::run()
 
         Stopwatch watch;
 
+        // The solve phase records the solution (and any requested marker
+        // errors/locations) for every frame; results are reported afterwards
+        // in frame order. Recording is what allows the windowed-parallel
+        // path below to solve frames out of order.
+        SimTK::Array_<SimTK::Vector> solvedQs(Nframes);
+        SimTK::Array_<SimTK::Array_<double>> solvedSquaredErrors;
+        SimTK::Array_<SimTK::Array_<Vec3>> solvedMarkerLocations;
+        if (get_report_errors())
+            solvedSquaredErrors.resize(Nframes);
+        if (get_report_marker_locations())
+            solvedMarkerLocations.resize(Nframes);
+
+        auto recordFrame = [&](InverseKinematicsSolver& solver,
+                               const SimTK::State& state, int frame) {
+            solvedQs[frame] = state.getQ();
+            if (get_report_errors())
+                solver.computeCurrentSquaredMarkerErrors(
+                    solvedSquaredErrors[frame]);
+            if (get_report_marker_locations())
+                solver.computeCurrentMarkerLocations(
+                    solvedMarkerLocations[frame]);
+        };
+
+        // Number of windows the trial is split into for the parallel solve.
+        // Each window re-tracks a few overlap frames ahead of its own so
+        // that its solver arrives warmed-up at its first reported frame.
+        const int windowOverlap = 5;
+        int numWindows = get_parallel_threads() == 0 ?
+            (int)std::thread::hardware_concurrency() : get_parallel_threads();
+        // Windows must dwarf their overlap (warm-up) frames to be worthwhile.
+        numWindows = std::min(numWindows,
+                              std::max(1, Nframes/(4*windowOverlap)));
+
+        if (numWindows > 1) {
+            // Coarse sequential pre-pass: track every preStride-th frame
+            // with the main solver to obtain seed configurations near each
+            // window's warm-up start.
+            const int preStride = 10;
+            SimTK::Array_<SimTK::Vector> preQs;
+            for (int i = start_ix; i <= final_ix; i += preStride) {
+                s.updTime() = times[i];
+                if (i > start_ix)
+                    ikSolver.track(s);
+                preQs.push_back(s.getQ());
+            }
+
+            // Per-window copies of the model and marker reference; each
+            // window is tracked by its own solver on its own thread.
+            std::vector<std::unique_ptr<Model>> windowModels;
+            std::vector<std::shared_ptr<MarkersReference>> windowMarkersRefs;
+            for (int w = 0; w < numWindows; ++w) {
+                windowModels.emplace_back(new Model(*_model));
+                windowMarkersRefs.push_back(
+                    make_shared<MarkersReference>(markersReference));
+            }
+
+            std::exception_ptr firstError = nullptr;
+            std::mutex errorMutex;
+
+            auto solveWindow = [&](int w) {
+                try {
+                    const int windowBegin = start_ix + (Nframes*w)/numWindows;
+                    const int windowEnd =
+                        start_ix + (Nframes*(w+1))/numWindows - 1;
+                    const int warmStart =
+                        std::max(start_ix, windowBegin - windowOverlap);
+
+                    Model& windowModel = *windowModels[w];
+                    SimTK::State ws = windowModel.initSystem();
+                    SimTK::Array_<CoordinateReference>
+                        windowCoordRefs(coordinateReferences);
+                    InverseKinematicsSolver windowSolver(windowModel,
+                        windowMarkersRefs[w], windowCoordRefs,
+                        get_constraint_weight());
+                    windowSolver.setAccuracy(get_accuracy());
+
+                    // Seed from the pre-pass frame at or before the warm-up
+                    // start, then track as the sequential solver would.
+                    ws.updQ() = preQs[(warmStart - start_ix)/preStride];
+                    ws.updTime() = times[warmStart];
+                    windowSolver.assemble(ws);
+
+                    for (int i = warmStart; i <= windowEnd; ++i) {
+                        ws.updTime() = times[i];
+                        {
+                            ScopedTimer timer(
+                                "InverseKinematicsTool::solveFrame");
+                            windowSolver.track(ws);
+                        }
+                        if (i >= windowBegin)
+                            recordFrame(windowSolver, ws, i - start_ix);
+                    }
+                    log_info("Solved frames {}-{} ({} of {} windows done).",
+                        windowBegin, windowEnd, w+1, numWindows);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!firstError)
+                        firstError = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (int w = 1; w < numWindows; ++w)
+                threads.emplace_back(solveWindow, w);
+            solveWindow(0);
+            for (auto& thread : threads)
+                thread.join();
+
+            if (firstError)
+                std::rethrow_exception(firstError);
+        }
+        else {
+            for (int i = start_ix; i <= final_ix; ++i) {
+                s.updTime() = times[i];
+                {
+                    ScopedTimer timer("InverseKinematicsTool::solveFrame");
+                    ikSolver.track(s);
+                }
+                // show progress line every 1000 frames so users see progress
+                if (std::remainder(i - start_ix, 1000) == 0 && i != start_ix)
+                    log_info("Solved {} frame(s)...", i - start_ix);
+                recordFrame(ikSolver, s, i - start_ix);
+            }
+        }
+
+        // Report the recorded solution in frame order.
         for (int i = start_ix; i <= final_ix; ++i) {
+            const int frame = i - start_ix;
             s.updTime() = times[i];
-            ikSolver.track(s);
-            // show progress line every 1000 frames so users see progress
-            if (std::remainder(i - start_ix, 1000) == 0 && i != start_ix)
-                log_info("Solved {} frame(s)...", i - start_ix);
+            s.updQ() = solvedQs[frame];
+
             if(get_report_errors()){
                 Array<double> markerErrors(0.0, 3);
                 double totalSquaredMarkerError = 0.0;
                 double maxSquaredMarkerError = 0.0;
                 int worst = -1;
 
-                ikSolver.computeCurrentSquaredMarkerErrors(squaredMarkerErrors);
+                squaredMarkerErrors = solvedSquaredErrors[frame];
                 for(int j=0; j<nm; ++j){
                     totalSquaredMarkerError += squaredMarkerErrors[j];
                     if(squaredMarkerErrors[j] > maxSquaredMarkerError){
@@ -211,20 +344,20 @@ bool InverseKinematicsTool::run()
                 }
 
                 double rms = nm > 0 ? sqrt(totalSquaredMarkerError / nm) : 0;
-                markerErrors.set(0, totalSquaredMarkerError); 
+                markerErrors.set(0, totalSquaredMarkerError);
                 markerErrors.set(1, rms);
                 markerErrors.set(2, sqrt(maxSquaredMarkerError));
                 modelMarkerErrors->append(s.getTime(), 3, &markerErrors[0]);
 
                 log_info("Frame {} (t = {}):\t total squared error = {}, "
-                         "marker error: RMS = {}, max = {} ({})", 
+                         "marker error: RMS = {}, max = {} ({})",
                     i, s.getTime(), totalSquaredMarkerError, rms,
-                    sqrt(maxSquaredMarkerError), 
+                    sqrt(maxSquaredMarkerError),
                     ikSolver.getMarkerNameForIndex(worst));
             }
 
             if(get_report_marker_locations()){
-                ikSolver.computeCurrentMarkerLocations(markerLocations);
+                markerLocations = solvedMarkerLocations[frame];
                 Array<double> locations(0.0, 3*nm);
                 for(int j=0; j<nm; ++j){
                     for(int k=0; k<3; ++k)
@@ -408,11 +541,20 @@ void InverseKinematicsTool::populateReferences(MarkersReference& markersReferenc
     // Load the coordinate data
     // bool haveCoordinateFile = false;
     if (get_coordinate_file() != "" && get_coordinate_file() != "Unassigned") {
-        Storage coordinateValues(get_coordinate_file());
-        // Convert degrees to radian (TODO: this needs to have a check that the storage is, in fact, in degrees!)
-        _model->getSimbodyEngine().convertDegreesToRadians(coordinateValues);
-        // haveCoordinateFile = true;
-        coordFunctions = new GCVSplineSet(5, &coordinateValues);
+        if (_trialContext) {
+            // The context caches the parse and the spline fit so a pipeline
+            // of tools on the same trial pays for them only once.
+            coordFunctions = new GCVSplineSet(
+                _trialContext->getCoordinateSplines(get_coordinate_file(),
+                    *_model));
+        }
+        else {
+            Storage coordinateValues(get_coordinate_file());
+            // Convert degrees to radian (TODO: this needs to have a check that the storage is, in fact, in degrees!)
+            _model->getSimbodyEngine().convertDegreesToRadians(coordinateValues);
+            // haveCoordinateFile = true;
+            coordFunctions = new GCVSplineSet(5, &coordinateValues);
+        }
     }
 
     Set<MarkerWeight> markerWeights;
@@ -461,7 +603,13 @@ void InverseKinematicsTool::populateReferences(MarkersReference& markersReferenc
     //Read in the marker data file and set the weights for associated markers.
     //Markers in the model and the marker file but not in the markerWeights are
     //ignored
-    markersReference.initializeFromMarkersFile(get_marker_file(), markerWeights);
+    if (_trialContext)
+        markersReference = MarkersReference(
+                _trialContext->getMarkerTable(get_marker_file()),
+                markerWeights);
+    else
+        markersReference.initializeFromMarkersFile(get_marker_file(),
+                markerWeights);
 }
 
 
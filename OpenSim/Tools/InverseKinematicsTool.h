@@ -28,11 +28,14 @@
 #include <OpenSim/Tools/IKTaskSet.h>
 #include <OpenSim/Tools/InverseKinematicsToolBase.h>
 
+#include <memory>
+
 namespace OpenSim {
 
 class Model;
 class MarkersReference;
 class CoordinateReference;
+class TrialContext;
 
 //=============================================================================
 //=============================================================================
@@ -71,6 +74,15 @@ public:
             "Flag indicating whether or not to report model marker locations. "
             "Note, model marker locations are expressed in Ground.");
 
+    OpenSim_DECLARE_PROPERTY(parallel_threads, int,
+            "Number of threads used to solve the trial. 1 (default) solves "
+            "the frames strictly sequentially. Greater than 1 splits the "
+            "time range into as many overlapping windows, each solved on "
+            "its own thread after a coarse sequential pre-pass seeds the "
+            "window starts; 0 uses the available hardware concurrency. "
+            "Windowed solutions can differ slightly from the sequential "
+            "solution near window boundaries.");
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -102,6 +114,13 @@ public:
 
     IKTaskSet& getIKTaskSet() { return upd_IKTaskSet(); }
 
+    /** %Set a cache of parsed trial files to share with the other tools
+    operating on the same trial, so the marker and coordinate files are
+    parsed (and the coordinate splines fitted) only once per trial. */
+    void setTrialContext(std::shared_ptr<TrialContext> context) {
+        _trialContext = context;
+    }
+
     //--------------------------------------------------------------------------
     // INTERFACE
     //--------------------------------------------------------------------------
@@ -120,6 +139,10 @@ public:
 private:
     void constructProperties();
 
+    // Cache of parsed trial files shared with the other tools in a
+    // pipeline; not serialized.
+    std::shared_ptr<TrialContext> _trialContext;
+
     //=============================================================================
 };  // END of class InverseKinematicsTool
 //=============================================================================
@@ -29,7 +29,6 @@
 #include <OpenSim/Common/FunctionSet.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/Constant.h>
-#include <OpenSim/Common/MarkerData.h>
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/MarkersReference.h>
@@ -38,6 +37,8 @@
 #include "IKTaskSet.h"
 #include <OpenSim/Analyses/StatesReporter.h>
 #include <OpenSim/Common/IO.h>
+#include <algorithm>
+#include <vector>
 //=============================================================================
 // STATICS
 //=============================================================================
@@ -242,7 +243,8 @@ bool MarkerPlacer::processModel(Model* aModel,
         throw Exception("MarkerPlacer::processModel, time_range is unspecified.");
 
     /* Load the static pose marker file, and average all the
-    * frames in the user-specified time range.
+    * frames in the user-specified time range.  The file is parsed once;
+    * the averaged table serves both the IK solve and the marker moving.
     */
     TimeSeriesTableVec3 staticPoseTable{aPathToSubject + _markerFileName};
     const auto& timeCol = staticPoseTable.getIndependentColumn();
@@ -250,19 +252,64 @@ bool MarkerPlacer::processModel(Model* aModel,
     // Users often set a time range that purposely exceeds the range of
     // their data with the mindset that all their data will be used.
     // To allow for that, we have to narrow the provided range to data
-    // range, since the TimeSeriesTable will correctly throw that the 
+    // range, since the TimeSeriesTable will correctly throw that the
     // desired time exceeds the data range.
     if (_timeRange[0] < timeCol.front())
         _timeRange[0] = timeCol.front();
     if (_timeRange[1] > timeCol.back())
         _timeRange[1] = timeCol.back();
 
-    const auto avgRow = staticPoseTable.averageRow(_timeRange[0],
-                                                   _timeRange[1]);
+    // Average the frames in the time range in a single pass over the rows,
+    // skipping missing (NaN) samples per marker and tracking each marker's
+    // bounding box so excessive movement during the static trial can be
+    // reported, as MarkerData::averageFrames() used to do.
+    const int numMarkers = (int)staticPoseTable.getNumColumns();
+    const auto& markerLabels = staticPoseTable.getColumnLabels();
+    SimTK::RowVector_<Vec3> avgRow(numMarkers, Vec3(0));
+    std::vector<int> numSamples(numMarkers, 0);
+    std::vector<Vec3> minCorner(numMarkers, Vec3(SimTK::Infinity));
+    std::vector<Vec3> maxCorner(numMarkers, Vec3(-SimTK::Infinity));
+    for (size_t r = 0; r < staticPoseTable.getNumRows(); ++r) {
+        if (timeCol[r] < _timeRange[0] || timeCol[r] > _timeRange[1])
+            continue;
+        const auto row = staticPoseTable.getRowAtIndex(r);
+        for (int m = 0; m < numMarkers; ++m) {
+            const Vec3& pt = row[m];
+            if (pt.isNaN()) continue;
+            avgRow[m] += pt;
+            ++numSamples[m];
+            for (int k = 0; k < 3; ++k) {
+                if (pt[k] < minCorner[m][k]) minCorner[m][k] = pt[k];
+                if (pt[k] > maxCorner[m][k]) maxCorner[m][k] = pt[k];
+            }
+        }
+    }
+    for (int m = 0; m < numMarkers; ++m) {
+        if (numSamples[m] > 0)
+            avgRow[m] /= (double)numSamples[m];
+        else
+            avgRow[m] = Vec3(SimTK::NaN);
+        if (_maxMarkerMovement > 0.0) {
+            if (numSamples[m] == 0) {
+                log_warn("Marker {} is missing between times {} and {}. "
+                         "Coordinate will be set to NAN.", markerLabels[m],
+                        _timeRange[0], _timeRange[1]);
+            }
+            else {
+                const Vec3 movement = maxCorner[m] - minCorner[m];
+                double maxDim = std::max(movement[0],
+                    std::max(movement[1], movement[2]));
+                if (maxDim > _maxMarkerMovement)
+                    log_warn("Movement of marker {} in {} is {} (threshold "
+                             "= {})", markerLabels[m], _markerFileName,
+                            maxDim, _maxMarkerMovement);
+            }
+        }
+    }
     for(size_t r = staticPoseTable.getNumRows(); r-- > 0; )
         staticPoseTable.removeRowAtIndex(r);
     staticPoseTable.appendRow(_timeRange[0], avgRow);
-    
+
     OPENSIM_THROW_IF(!staticPoseTable.hasTableMetaDataKey("Units"),
                      Exception,
                      "MarkerPlacer::processModel -- Marker file does not have "
@@ -283,14 +330,13 @@ bool MarkerPlacer::processModel(Model* aModel,
                                          staticPoseUnits.getAbbreviation());
     }
     
-    MarkerData* staticPose = new MarkerData(aPathToSubject + _markerFileName);
-    staticPose->averageFrames(_maxMarkerMovement, _timeRange[0], _timeRange[1]);
-    staticPose->convertToUnits(aModel->getLengthUnits());
-
     /* Delete any markers from the model that are not in the static
      * pose marker file.
      */
-    aModel->deleteUnusedMarkers(staticPose->getMarkerNames());
+    Array<string> staticPoseMarkerNames;
+    for (const auto& label : markerLabels)
+        staticPoseMarkerNames.append(label);
+    aModel->deleteUnusedMarkers(staticPoseMarkerNames);
 
     // Construct the system and get the working state when done changing the model
     SimTK::State& s = aModel->initSystem();
@@ -299,7 +345,7 @@ bool MarkerPlacer::processModel(Model* aModel,
     // Create references and WeightSets needed to initialize InverseKinemaicsSolver
     Set<MarkerWeight> markerWeightSet;
     _ikTaskSet.createMarkerWeightSet(markerWeightSet); // order in tasks file
-    // MarkersReference takes ownership of marker data (staticPose)
+    // MarkersReference copies the averaged static pose table
     std::shared_ptr<MarkersReference> markersReference(new MarkersReference(staticPoseTable, markerWeightSet));
     SimTK::Array_<CoordinateReference> coordinateReferences;
 
@@ -377,7 +423,7 @@ bool MarkerPlacer::processModel(Model* aModel,
      * with the measured markers in the static pose. The model is already in
      * the proper configuration so the coordinates do not need to be changed.
      */
-    if(_moveModelMarkers) moveModelMarkersToPose(s, *aModel, *staticPose);
+    if(_moveModelMarkers) moveModelMarkersToPose(s, *aModel, staticPoseTable);
 
     _outputStorage.reset();
     // Make a storage file containing the solved states and markers for display in GUI.
@@ -418,18 +464,16 @@ bool MarkerPlacer::processModel(Model* aModel,
 /**
  * Set the local offset of each non-fixed marker so that in the model's
  * current pose the marker coincides with the marker's global position
- * in the passed-in MarkerData.
+ * in the passed-in static pose table.
  *
  * @param aModel the model to use
- * @param aPose the static-pose marker cloud to get the marker locations from
+ * @param aPose the averaged static-pose marker table (one row, already
+ * converted to the model's length units) to get the marker locations from
  */
 void MarkerPlacer::moveModelMarkersToPose(SimTK::State& s, Model& aModel,
-        MarkerData& aPose) const
+        const TimeSeriesTableVec3& aPose) const
 {
-    aPose.averageFrames(0.01);
-    const MarkerFrame &frame = aPose.getFrame(0);
-
-    // const SimbodyEngine& engine = aModel.getSimbodyEngine();
+    const auto row = aPose.getRowAtIndex(0);
 
     MarkerSet& markerSet = aModel.updMarkerSet();
 
@@ -440,32 +484,28 @@ void MarkerPlacer::moveModelMarkersToPose(SimTK::State& s, Model& aModel,
 
         if (!modelMarker.get_fixed())
         {
-            int index = aPose.getMarkerIndex(modelMarker.getName());
-            if (index >= 0)
+            if (aPose.hasColumn(modelMarker.getName()))
             {
-                Vec3 globalMarker = frame.getMarker(index);
+                Vec3 globalMarker =
+                    row[(int)aPose.getColumnIndex(modelMarker.getName())];
                 if (!globalMarker.isNaN())
                 {
-                    Vec3 pt, pt2;
-                    Vec3 globalPt = globalMarker;
-                    double conversionFactor = aPose.getUnits().convertTo(aModel.getLengthUnits());
-                    pt = conversionFactor*globalPt;
-                    pt2 = aModel.getGround().findStationLocationInAnotherFrame(s, pt, modelMarker.getParentFrame());
+                    Vec3 pt2 = aModel.getGround().findStationLocationInAnotherFrame(s, globalMarker, modelMarker.getParentFrame());
                     modelMarker.set_location(pt2);
                 }
                 else
                 {
                     log_warn("Marker {} does not have valid coordinates in "
                              "'{}'. It will not be moved to match location in "
-                             "marker file.", 
-                        modelMarker.getName(), aPose.getFileName());
+                             "marker file.",
+                        modelMarker.getName(), _markerFileName);
                 }
             }
         }
     }
 
     log_info("Moved markers in model {} to match locations in marker file "
-             "'{}'.", aModel.getName(), aPose.getFileName());
+             "'{}'.", aModel.getName(), _markerFileName);
 }
 
 Storage* MarkerPlacer::getOutputStorage() 
@@ -40,10 +40,10 @@ class State;
 namespace OpenSim {
 
 class Model;
-class MarkerData;
 class IKTaskSet;
 class IKTrial;
 class Storage;
+template <typename T> class TimeSeriesTable_;
 
 //=============================================================================
 //=============================================================================
@@ -209,7 +209,7 @@ private:
     void setNull();
     void setupProperties();
     void moveModelMarkersToPose(SimTK::State& s, Model& aModel,
-            MarkerData& aPose) const;
+            const TimeSeriesTable_<SimTK::Vec3>& aPose) const;
 //=============================================================================
 };  // END of class MarkerPlacer
 //=============================================================================
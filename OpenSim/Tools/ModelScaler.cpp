@@ -28,6 +28,9 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Common/MarkerData.h>
 #include <OpenSim/Common/IO.h>
+#include <exception>
+#include <thread>
+#include <vector>
 
 //=============================================================================
 // STATICS
@@ -247,6 +250,12 @@ bool ModelScaler::processModel(Model* aModel, const string& aPathToSubject,
 
     try
     {
+        /* Static pose marker data; loaded lazily the first time a
+         * "measurements" entry needs it and reused thereafter, so repeated
+         * entries in the scaling order do not re-parse the marker file.
+         */
+        std::unique_ptr<MarkerData> markerData{};
+
         /* Make adjustments to theScaleSet, in the user-specified order. */
         for (i = 0; i < _scalingOrder.getSize(); i++)
         {
@@ -260,28 +269,64 @@ bool ModelScaler::processModel(Model* aModel, const string& aPathToSubject,
             {
                 /* Load the static pose marker file, and convert units.
                 */
-                std::unique_ptr<MarkerData> markerData{};
-                if(!_markerFileName.empty() && _markerFileName!=PropertyStr::getDefaultStr()) {
+                if(!markerData && !_markerFileName.empty() && _markerFileName!=PropertyStr::getDefaultStr()) {
                     markerData.reset(new MarkerData(aPathToSubject + _markerFileName));
                     markerData->convertToUnits(aModel->getLengthUnits());
                 }
 
-                /* Now take and apply the measurements. */
+                std::vector<int> appliedIndices;
                 for (int j = 0; j < _measurementSet.getSize(); j++)
-                {
                     if (_measurementSet.get(j).getApply())
+                        appliedIndices.push_back(j);
+
+                if(!appliedIndices.empty() && !markerData)
+                    throw Exception("ModelScaler.processModel: ERROR- "+_markerFileNameProp.getName()+
+                                        " not set but measurements are used",__FILE__,__LINE__);
+
+                /* Now take the measurements.  Each one only reads the model
+                 * pose and the marker data, so the distance computations for
+                 * all measurements run concurrently; the resulting scale
+                 * factors are then applied in measurement order as before.
+                 */
+                std::vector<double> scaleFactors(appliedIndices.size(), SimTK::NaN);
+                if (appliedIndices.size() > 1)
+                {
+                    std::vector<std::thread> threads;
+                    std::vector<std::exception_ptr> exceptions(appliedIndices.size());
+                    for (size_t k = 0; k < appliedIndices.size(); k++)
                     {
-                        if(!markerData)
-                            throw Exception("ModelScaler.processModel: ERROR- "+_markerFileNameProp.getName()+
-                                                " not set but measurements are used",__FILE__,__LINE__);
-                        double scaleFactor = computeMeasurementScaleFactor(s,*aModel, *markerData, _measurementSet.get(j));
-                        if (!SimTK::isNaN(scaleFactor))
-                            _measurementSet.get(j).applyScaleFactor(scaleFactor, theScaleSet);
-                        else
-                            log_warn("'{}' measurement not used to scale {}", 
-                                _measurementSet.get(j).getName(),
-                                aModel->getName());
+                        const Measurement& measurement = _measurementSet.get(appliedIndices[k]);
+                        double& scaleFactor = scaleFactors[k];
+                        std::exception_ptr& exception = exceptions[k];
+                        threads.emplace_back([this, &s, aModel, &markerData,
+                                &measurement, &scaleFactor, &exception]() {
+                            try {
+                                scaleFactor = computeMeasurementScaleFactor(
+                                    s, *aModel, *markerData, measurement);
+                            } catch (...) {
+                                exception = std::current_exception();
+                            }
+                        });
                     }
+                    for (auto& thread : threads) thread.join();
+                    for (const auto& exception : exceptions)
+                        if (exception) std::rethrow_exception(exception);
+                }
+                else if (appliedIndices.size() == 1)
+                {
+                    scaleFactors[0] = computeMeasurementScaleFactor(s, *aModel,
+                        *markerData, _measurementSet.get(appliedIndices[0]));
+                }
+
+                for (size_t k = 0; k < appliedIndices.size(); k++)
+                {
+                    int j = appliedIndices[k];
+                    if (!SimTK::isNaN(scaleFactors[k]))
+                        _measurementSet.get(j).applyScaleFactor(scaleFactors[k], theScaleSet);
+                    else
+                        log_warn("'{}' measurement not used to scale {}",
+                            _measurementSet.get(j).getName(),
+                            aModel->getName());
                 }
             }
             /* For manual scales, just copy the XYZ scale factors from
@@ -35,6 +35,10 @@
 #include <OpenSim/Analyses/InverseDynamics.h>
 #include <OpenSim/Analyses/Actuation.h>
 #include <OpenSim/Common/DebugUtilities.h>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
 
 
 using namespace std;
@@ -1010,7 +1014,12 @@ adjustCOMToReduceResiduals(SimTK::State& s, const Storage &qStore, const Storage
     log_info("Requested COM adjustment time range {} to {}, clamped to nearest "
         "available data times: {} to {}.", ti, tf, actualTi, actualTf);
 
-    computeAverageResiduals(s, *_model, ti, tf, *statesStore, FAve, MAve);
+    // Fit the states splines once here; both residual sweeps below (and every
+    // worker thread within them) analyze the same states, so there is no need
+    // to refit inside each InverseDynamics::begin().
+    GCVSplineSet statesSplineSet(5,statesStore);
+
+    computeAverageResiduals(s, *_model, ti, tf, *statesStore, FAve, MAve, &statesSplineSet);
 
     std::stringstream resMsg;
     resMsg << endl;
@@ -1028,7 +1037,7 @@ adjustCOMToReduceResiduals(SimTK::State& s, const Storage &qStore, const Storage
     si.updY() = restoreStates;
     _model->getMultibodySystem().realize(si, Stage::Position );
     
-    computeAverageResiduals(si, *_model, ti, tf, *statesStore, FAve, MAve);
+    computeAverageResiduals(si, *_model, ti, tf, *statesStore, FAve, MAve, &statesSplineSet);
 
     resMsg <<  "* Average residuals after adjusting "<<_adjustedCOMBody<<" COM:"<<endl;
     resMsg <<  "*  FX="<<FAve[0]<<" FY="<<FAve[1]<<" FZ="<<FAve[2]<<endl;
@@ -1042,17 +1051,13 @@ adjustCOMToReduceResiduals(SimTK::State& s, const Storage &qStore, const Storage
 
 // Uses an inverse dynamics analysis to compute average residuals
 void RRATool::
-computeAverageResiduals(SimTK::State& s, Model &aModel,double aTi,double aTf,const Storage &aStatesStore,OpenSim::Array<double>& rFAve,OpenSim::Array<double>& rMAve)
+computeAverageResiduals(SimTK::State& s, Model &aModel,double aTi,double aTf,const Storage &aStatesStore,OpenSim::Array<double>& rFAve,OpenSim::Array<double>& rMAve,const GCVSplineSet *aStatesSplineSet)
 {
     // Turn off whatever's currently there (but remember whether it was on/off)
     AnalysisSet& analysisSet = aModel.updAnalysisSet();
     Array<bool> analysisSetOn = analysisSet.getOn();
     analysisSet.setOn(false);
 
-    // add inverse dynamics analysis
-    InverseDynamics* inverseDynamics = new InverseDynamics(&aModel);
-    aModel.addAnalysis(inverseDynamics);
-    inverseDynamics->setModel(aModel);
     /* undo interpolation at bounds for now as it changes results a little. Could fix evaluation at bounds issue
     Array<double> bounds;
     bounds.append(aTi);
@@ -1062,18 +1067,97 @@ computeAverageResiduals(SimTK::State& s, Model &aModel,double aTi,double aTf,con
     int iFinal = aStatesStore.findIndex(aTf);
     aStatesStore.getTime(iInitial,aTi);
     aStatesStore.getTime(iFinal,aTf);
-   
-    aModel.getMultibodySystem().realize(s, Stage::Position );
 
     log_info("Computing average residuals between {} and {}...", aTi, aTf);
-    AnalyzeTool::run(s, aModel, iInitial, iFinal, aStatesStore, false);
 
-    computeAverageResiduals(*inverseDynamics->getStorage(),rFAve,rMAve);
+    // The inverse dynamics solve for each frame is independent of every other
+    // frame, so long sweeps are split across worker threads, each driving its
+    // own clone of the model over a contiguous chunk of frames.  Adjacent
+    // chunks share their boundary frame so the per-chunk time-integral
+    // averages sum exactly to the serial result.  Short sweeps are not worth
+    // the per-thread model clone and run serially as before.
+    int numFrames = iFinal - iInitial + 1;
+    const int minFramesPerThread = 200;
+    int numThreads = (int)std::thread::hardware_concurrency();
+    if(numThreads > numFrames/minFramesPerThread)
+        numThreads = numFrames/minFramesPerThread;
+
+    if(numThreads > 1) {
+        std::vector<std::unique_ptr<Model>> workerModels(numThreads);
+        std::vector<InverseDynamics*> workerAnalyses(numThreads);
+        std::vector<int> firstFrame(numThreads),lastFrame(numThreads);
+        for(int t=0;t<numThreads;t++)
+            firstFrame[t] = iInitial + (t*numFrames)/numThreads;
+        for(int t=0;t<numThreads;t++) {
+            lastFrame[t] = (t==numThreads-1) ? iFinal : firstFrame[t+1];
+
+            // Clone after the analyses were turned off above so the clones
+            // inherit the disabled analysis set.
+            workerModels[t].reset(aModel.clone());
+            InverseDynamics *workerAnalysis = new InverseDynamics(workerModels[t].get());
+            workerModels[t]->addAnalysis(workerAnalysis);
+            workerAnalysis->setModel(*workerModels[t]);
+            if(aStatesSplineSet) workerAnalysis->setStatesSplineSet(*aStatesSplineSet);
+            workerAnalyses[t] = workerAnalysis;
+        }
+
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> exceptions(numThreads);
+        for(int t=0;t<numThreads;t++) {
+            Model *workerModel = workerModels[t].get();
+            int first = firstFrame[t];
+            int last = lastFrame[t];
+            std::exception_ptr& exception = exceptions[t];
+            threads.emplace_back([workerModel, first, last, &aStatesStore, &exception]() {
+                try {
+                    SimTK::State& ws = workerModel->initSystem();
+                    workerModel->getMultibodySystem().realize(ws, Stage::Position);
+                    AnalyzeTool::run(ws, *workerModel, first, last, aStatesStore, false);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+            });
+        }
+        for(auto& thread : threads) thread.join();
+        for(const auto& exception : exceptions)
+            if (exception) std::rethrow_exception(exception);
+
+        // Combine the per-chunk averages, weighting each by the fraction of
+        // the full time range its chunk covers.
+        rFAve.setSize(3);
+        rMAve.setSize(3);
+        for(int i=0;i<3;i++) { rFAve[i]=0.0; rMAve[i]=0.0; }
+        for(int t=0;t<numThreads;t++) {
+            Array<double> FAve(0.0,3),MAve(0.0,3);
+            computeAverageResiduals(*workerAnalyses[t]->getStorage(),FAve,MAve);
+            double tFirst,tLast;
+            aStatesStore.getTime(firstFrame[t],tFirst);
+            aStatesStore.getTime(lastFrame[t],tLast);
+            double weight = (tLast-tFirst)/(aTf-aTi);
+            for(int i=0;i<3;i++) {
+                rFAve[i] += weight*FAve[i];
+                rMAve[i] += weight*MAve[i];
+            }
+        }
+
+    } else {
+        // add inverse dynamics analysis
+        InverseDynamics* inverseDynamics = new InverseDynamics(&aModel);
+        aModel.addAnalysis(inverseDynamics);
+        inverseDynamics->setModel(aModel);
+        if(aStatesSplineSet) inverseDynamics->setStatesSplineSet(*aStatesSplineSet);
+
+        aModel.getMultibodySystem().realize(s, Stage::Position );
+
+        AnalyzeTool::run(s, aModel, iInitial, iFinal, aStatesStore, false);
+
+        computeAverageResiduals(*inverseDynamics->getStorage(),rFAve,rMAve);
 
 //cout << "\nrFAve= " << rFAve << endl;
 //cout << "\nrMAve= " << rMAve << endl;
 
-    aModel.removeAnalysis(inverseDynamics); // This deletes the analysis as well
+        aModel.removeAnalysis(inverseDynamics); // This deletes the analysis as well
+    }
 
     // Turn off whatever's currently there
     analysisSet.setOn(analysisSetOn);
@@ -44,6 +44,7 @@
 namespace OpenSim {
 
 class ControlSet;
+class GCVSplineSet;
 class Storage;
 //=============================================================================
 //=============================================================================
@@ -199,7 +200,7 @@ public:
     void writeAdjustedModel();
 
     static void computeAverageResiduals(const Storage &aForceStore,OpenSim::Array<double> &rFAve,OpenSim::Array<double> &rMAve);
-    static void computeAverageResiduals(SimTK::State& s, Model &aModel,double aTi,double aTf,const Storage &aStatesStore,OpenSim::Array<double>& rFAve,OpenSim::Array<double>& rMAve);
+    static void computeAverageResiduals(SimTK::State& s, Model &aModel,double aTi,double aTf,const Storage &aStatesStore,OpenSim::Array<double>& rFAve,OpenSim::Array<double>& rMAve,const GCVSplineSet *aStatesSplineSet=NULL);
 #endif
 //=============================================================================
 };  // END of class RRATool
@@ -0,0 +1,266 @@
+/* -------------------------------------------------------------------------- *
+ *                OpenSim:  testActuatorForceTargetFast.cpp                   *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+//=============================================================================
+//  testActuatorForceTargetFast exercises the active-set QP solver that the
+//  fast CMC target uses to bypass the generic optimizer, by comparing its
+//  solutions against the generic optimizer on representative problems:
+//
+//  Tests Include:
+//  1. An interior optimum (no bounds active).
+//  2. An optimum with forces pinned at both the lower and the upper bound.
+//  3. A warm-started re-solve from the previous window's working set.
+//  4. A rank-deficient constraint matrix, which must take the fallback.
+//
+//=============================================================================
+
+#include <OpenSim/Tools/ActuatorForceTargetFast.h>
+#include <OpenSim/Common/Array.h>
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <simmath/Optimizer.h>
+
+using namespace OpenSim;
+using namespace SimTK;
+using namespace std;
+
+namespace {
+
+// The same box-constrained QP posed to the generic optimizer:
+// min 0.5*sum_i h[i]*f[i]^2  s.t.  C*f = d,  lower <= f <= upper.
+class BoxConstrainedQP : public OptimizerSystem {
+public:
+    BoxConstrainedQP(const Matrix& C, const Vector& d, const Vector& h,
+            const Vector& lower, const Vector& upper)
+            : OptimizerSystem(h.size()), _C(C), _d(d), _h(h) {
+        setNumEqualityConstraints(d.size());
+        setParameterLimits(lower, upper);
+    }
+    int objectiveFunc(const Vector& f, bool, Real& p) const override {
+        p = 0.0;
+        for (int i = 0; i < f.size(); ++i) p += 0.5*_h[i]*f[i]*f[i];
+        return 0;
+    }
+    int gradientFunc(const Vector& f, bool, Vector& g) const override {
+        for (int i = 0; i < f.size(); ++i) g[i] = _h[i]*f[i];
+        return 0;
+    }
+    int constraintFunc(const Vector& f, bool, Vector& c) const override {
+        c = _C*f - _d;
+        return 0;
+    }
+    int constraintJacobian(const Vector&, bool, Matrix& jac) const override {
+        jac = _C;
+        return 0;
+    }
+private:
+    const Matrix _C;
+    const Vector _d, _h;
+};
+
+Vector solveWithGenericOptimizer(const Matrix& C, const Vector& d,
+        const Vector& h, const Vector& lower, const Vector& upper) {
+    BoxConstrainedQP sys(C, d, h, lower, upper);
+    Optimizer opt(sys, InteriorPoint);
+    opt.setConvergenceTolerance(1e-9);
+    opt.setMaxIterations(1000);
+    opt.useNumericalGradient(false);
+    opt.useNumericalJacobian(false);
+    Vector f(h.size());
+    for (int i = 0; i < f.size(); ++i) f[i] = 0.5*(lower[i] + upper[i]);
+    opt.optimize(f);
+    return f;
+}
+
+void compareSolutions(const Vector& qp, const Vector& reference,
+        double tol) {
+    ASSERT(qp.size() == reference.size(), __FILE__, __LINE__,
+            "QP and optimizer solutions differ in size.");
+    for (int i = 0; i < qp.size(); ++i)
+        ASSERT_EQUAL(reference[i], qp[i], tol, __FILE__, __LINE__,
+                "QP solution does not match the generic optimizer's.");
+}
+
+} // namespace
+
+void testInteriorOptimum();
+void testBoundsPinned();
+void testWarmStartReuse();
+void testRankDeficientFallsBack();
+
+int main()
+{
+    try {
+        log_info("Testing active-set QP with an interior optimum");
+        testInteriorOptimum();
+        log_info("Testing active-set QP with forces pinned at both bounds");
+        testBoundsPinned();
+        log_info("Testing warm-started re-solve");
+        testWarmStartReuse();
+        log_info("Testing rank-deficient fallback");
+        testRankDeficientFallsBack();
+    }
+    catch (const std::exception& e) {
+        log_error("testActuatorForceTargetFast failed due to the following "
+                  "error(s): {}", e.what());
+        return 1;
+    }
+    log_info("testActuatorForceTargetFast passed.");
+    return 0;
+}
+
+//==============================================================================
+void testInteriorOptimum()
+{
+    const int nf = 4;
+    Matrix C(1, nf);
+    C[0][0] = 1; C[0][1] = 1; C[0][2] = 1; C[0][3] = 1;
+    Vector d(1); d[0] = 2.0;
+    Vector h(nf); h[0] = 2; h[1] = 4; h[2] = 8; h[3] = 8;
+    Vector lower(nf, -10.0), upper(nf, 10.0);
+
+    Array<int> activeSet(0, nf);
+    Vector f;
+    ASSERT(ActuatorForceTargetFast::solveActiveSetQP(
+            C, d, h, lower, upper, activeSet, f),
+            __FILE__, __LINE__, "interior problem should solve directly");
+
+    // Closed form: f[i] = lambda/h[i] with lambda chosen to meet sum = 2.
+    const double lambda = 2.0/(1/2.0 + 1/4.0 + 1/8.0 + 1/8.0);
+    for (int i = 0; i < nf; ++i)
+        ASSERT_EQUAL(lambda/h[i], f[i], 1e-12);
+    for (int i = 0; i < nf; ++i)
+        ASSERT(activeSet[i] == 0, __FILE__, __LINE__,
+                "no bound should be active");
+
+    compareSolutions(f,
+            solveWithGenericOptimizer(C, d, h, lower, upper), 1e-4);
+}
+
+void testBoundsPinned()
+{
+    // Sum and partial-sum acceleration constraints over five forces. The
+    // equality-only optimum is [1.5, 1, 1.5, 1, 1]; the bounds below pin
+    // f[0] at its upper bound and f[3] at its lower bound, and the pinned
+    // optimum is [1, 0.8, 2, 1.4, 0.8].
+    const int nf = 5;
+    Matrix C(2, nf); C = 0.0;
+    for (int j = 0; j < nf; ++j) C[0][j] = 1.0;
+    C[1][0] = 1; C[1][2] = 1;
+    Vector d(2); d[0] = 6.0; d[1] = 3.0;
+    Vector h(nf, 2.0);
+    Vector lower(nf, 0.0), upper(nf, 10.0);
+    upper[0] = 1.0;
+    lower[3] = 1.4;
+
+    Array<int> activeSet(0, nf);
+    Vector f;
+    ASSERT(ActuatorForceTargetFast::solveActiveSetQP(
+            C, d, h, lower, upper, activeSet, f),
+            __FILE__, __LINE__, "bounded problem should solve directly");
+
+    ASSERT(activeSet[0] == 1, __FILE__, __LINE__,
+            "f[0] should sit at its upper bound");
+    ASSERT(activeSet[3] == -1, __FILE__, __LINE__,
+            "f[3] should sit at its lower bound");
+    const double expected[] = {1.0, 0.8, 2.0, 1.4, 0.8};
+    for (int i = 0; i < nf; ++i)
+        ASSERT_EQUAL(expected[i], f[i], 1e-9);
+    for (int i = 0; i < nf; ++i) {
+        ASSERT(f[i] >= lower[i] - 1e-12 && f[i] <= upper[i] + 1e-12,
+                __FILE__, __LINE__, "solution must respect the bounds");
+    }
+    Vector residual = C*f - d;
+    for (int a = 0; a < residual.size(); ++a)
+        ASSERT_EQUAL(0.0, residual[a], 1e-10);
+
+    compareSolutions(f,
+            solveWithGenericOptimizer(C, d, h, lower, upper), 1e-4);
+}
+
+void testWarmStartReuse()
+{
+    // Re-solve the pinned problem with perturbed right-hand sides using
+    // the previous solve's working set, as consecutive control windows do.
+    const int nf = 5;
+    Matrix C(2, nf); C = 0.0;
+    for (int j = 0; j < nf; ++j) C[0][j] = 1.0;
+    C[1][0] = 1; C[1][2] = 1;
+    Vector d(2); d[0] = 6.0; d[1] = 3.0;
+    Vector h(nf, 2.0);
+    Vector lower(nf, 0.0), upper(nf, 10.0);
+    upper[0] = 1.0;
+    lower[3] = 1.4;
+
+    Array<int> activeSet(0, nf);
+    Vector f;
+    ASSERT(ActuatorForceTargetFast::solveActiveSetQP(
+            C, d, h, lower, upper, activeSet, f),
+            __FILE__, __LINE__, "first window should solve directly");
+
+    // A small perturbation keeps both bounds active ...
+    Vector dNear(2); dNear[0] = 6.2; dNear[1] = 3.0;
+    ASSERT(ActuatorForceTargetFast::solveActiveSetQP(
+            C, dNear, h, lower, upper, activeSet, f),
+            __FILE__, __LINE__, "warm-started re-solve should settle");
+    compareSolutions(f,
+            solveWithGenericOptimizer(C, dNear, h, lower, upper), 1e-4);
+
+    // ... while this one moves the optimum interior, so the warm-started
+    // solve must release both bounds.
+    Vector dFar(2); dFar[0] = 6.4; dFar[1] = 1.6;
+    ASSERT(ActuatorForceTargetFast::solveActiveSetQP(
+            C, dFar, h, lower, upper, activeSet, f),
+            __FILE__, __LINE__, "re-solve releasing the bounds should settle");
+    ASSERT(activeSet[0] == 0 && activeSet[3] == 0, __FILE__, __LINE__,
+            "both bounds should have been released");
+    compareSolutions(f,
+            solveWithGenericOptimizer(C, dFar, h, lower, upper), 1e-4);
+}
+
+void testRankDeficientFallsBack()
+{
+    // Duplicated constraint rows make the Schur complement singular; the
+    // solver must decline so the controller hands the window to the
+    // generic optimizer.
+    const int nf = 4;
+    Matrix C(2, nf);
+    for (int j = 0; j < nf; ++j) { C[0][j] = 1.0; C[1][j] = 1.0; }
+    Vector d(2, 2.0);
+    Vector h(nf, 2.0);
+    Vector lower(nf, -10.0), upper(nf, 10.0);
+
+    Array<int> activeSet(0, nf);
+    Vector f;
+    ASSERT(!ActuatorForceTargetFast::solveActiveSetQP(
+            C, d, h, lower, upper, activeSet, f),
+            __FILE__, __LINE__, "rank-deficient constraints must take the fallback");
+
+    // More constraints than parameters must also decline.
+    Matrix wide(3, 2); wide = 1.0;
+    Vector dWide(3, 1.0), hWide(2, 2.0);
+    Vector lowerWide(2, -1.0), upperWide(2, 1.0);
+    Array<int> activeSetWide(0, 2);
+    ASSERT(!ActuatorForceTargetFast::solveActiveSetQP(
+            wide, dWide, hWide, lowerWide, upperWide, activeSetWide, f),
+            __FILE__, __LINE__, "over-constrained problems must take the fallback");
+}
@@ -0,0 +1,169 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  testToolJobPool.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and       *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+//=============================================================================
+//  testToolJobPool runs batches of tool configurations on ToolJobPool's
+//  worker threads and verifies that:
+//  1. Programmatically configured ForwardTools run in parallel, each on its
+//     own copy of the model, and write their usual result files.
+//  2. A job that throws is reported Failed with its message, without
+//     stopping the rest of the batch.
+//  3. A tool loaded from a setup file runs through the pool as it would
+//     have run directly.
+//=============================================================================
+
+#include <OpenSim/OpenSim.h>
+#include <OpenSim/Tools/ToolJobPool.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+
+using namespace OpenSim;
+using namespace std;
+
+namespace {
+
+// A one-degree-of-freedom passive pendulum.
+Model buildPendulum()
+{
+    Model model;
+    model.setName("pendulum");
+
+    auto* rod = new Body("rod", 1.0, SimTK::Vec3(0, -0.5, 0),
+            SimTK::Inertia::cylinderAlongY(0.01, 0.5));
+    model.addBody(rod);
+
+    auto* pin = new PinJoint("pin", model.getGround(), SimTK::Vec3(0),
+            SimTK::Vec3(0), *rod, SimTK::Vec3(0), SimTK::Vec3(0));
+    pin->updCoordinate().setName("angle");
+    model.addJoint(pin);
+
+    model.finalizeConnections();
+    return model;
+}
+
+} // namespace
+
+void testParallelForwardJobs();
+void testFailedJobReporting();
+void testSetupFileJob();
+
+int main()
+{
+    try {
+        testParallelForwardJobs();
+        testFailedJobReporting();
+        testSetupFileJob();
+    }
+    catch (const Exception& e) {
+        e.print(cerr);
+        return 1;
+    }
+    cout << "Done" << endl;
+    return 0;
+}
+
+void testParallelForwardJobs()
+{
+    Model pendulum = buildPendulum();
+
+    ToolJobPool pool;
+    pool.setNumThreads(2);
+    Array<int> jobs;
+    for (int i = 0; i < 4; ++i) {
+        ForwardTool tool;
+        tool.setName("poolFwd" + to_string(i));
+        tool.setModel(pendulum);
+        tool.setInitialTime(0.0);
+        tool.setFinalTime(0.1);
+        tool.setResultsDir(".");
+        jobs.append(pool.submit(tool));
+    }
+    ASSERT(pool.getNumJobs() == 4);
+
+    ASSERT(pool.waitAll() == 4);
+    for (int i = 0; i < jobs.getSize(); ++i) {
+        ASSERT(pool.getJobStatus(jobs[i]) ==
+               ToolJobPool::JobStatus::Succeeded);
+        ASSERT(pool.getJobMessage(jobs[i]).empty());
+        // wait() on a finished job returns immediately.
+        ASSERT(pool.wait(jobs[i]));
+    }
+
+    // Every job wrote its own states file, integrated to the final time.
+    for (int i = 0; i < 4; ++i) {
+        Storage states("poolFwd" + to_string(i) + "_states.sto");
+        ASSERT_EQUAL(0.1, states.getLastTime(), 1e-10);
+    }
+}
+
+void testFailedJobReporting()
+{
+    Model pendulum = buildPendulum();
+
+    ToolJobPool pool;
+    pool.setNumThreads(1);
+
+    // A ForwardTool without a model throws from run().
+    ForwardTool broken;
+    broken.setName("poolBroken");
+    const int badJob = pool.submit(broken);
+
+    ForwardTool good;
+    good.setName("poolAfterFailure");
+    good.setModel(pendulum);
+    good.setInitialTime(0.0);
+    good.setFinalTime(0.05);
+    good.setResultsDir(".");
+    const int goodJob = pool.submit(good);
+
+    ASSERT(!pool.wait(badJob));
+    ASSERT(pool.getJobStatus(badJob) == ToolJobPool::JobStatus::Failed);
+    ASSERT(pool.getJobMessage(badJob).find("model") != string::npos);
+
+    // The failure did not take the pool down with it.
+    ASSERT(pool.wait(goodJob));
+
+    // Job numbers that were never issued are rejected.
+    ASSERT_THROW(Exception, pool.getJobStatus(12345));
+    ASSERT_THROW(Exception, pool.getJobMessage(-1));
+}
+
+void testSetupFileJob()
+{
+    buildPendulum().print("poolPendulum.osim");
+    {
+        ForwardTool prototype;
+        prototype.setName("poolFromSetup");
+        prototype.setModelFilename("poolPendulum.osim");
+        prototype.setInitialTime(0.0);
+        prototype.setFinalTime(0.05);
+        prototype.setResultsDir(".");
+        prototype.print("poolSetup.xml");
+    }
+
+    ForwardTool tool("poolSetup.xml");
+    ToolJobPool pool;
+    const int job = pool.submit(tool);
+    ASSERT(pool.wait(job));
+
+    Storage states("poolFromSetup_states.sto");
+    ASSERT_EQUAL(0.05, states.getLastTime(), 1e-10);
+}
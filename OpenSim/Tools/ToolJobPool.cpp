@@ -0,0 +1,279 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  ToolJobPool.cpp                           *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+//=============================================================================
+// INCLUDES
+//=============================================================================
+#include "ToolJobPool.h"
+
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Simulation/Model/Model.h>
+
+#include <algorithm>
+#include <functional>
+
+using namespace OpenSim;
+using namespace std;
+
+//=============================================================================
+// JOB
+//=============================================================================
+struct ToolJobPool::Job {
+    /** Keeps the cloned tool alive for the pool's lifetime. */
+    std::unique_ptr<Object> tool;
+    /** The job's private copy of the prototype's in-memory model, when it
+        had one; clones of an AbstractTool share the prototype's model
+        pointer, which concurrent jobs must not. */
+    std::unique_ptr<Model> model;
+    /** Invokes the clone's run(). */
+    std::function<bool()> run;
+    /** The tool's name, for logging. */
+    std::string name;
+    /** Directory of the setup file the tool was loaded from; empty for a
+        programmatically configured tool. Non-empty jobs run in this
+        directory under the process-wide working-directory lock. */
+    std::string setupDir;
+    JobStatus status{JobStatus::Pending};
+    std::string message;
+};
+
+//=============================================================================
+// CONSTRUCTION
+//=============================================================================
+ToolJobPool::ToolJobPool() : _nextJob(0), _shutdown(false), _numThreads(0)
+{}
+
+ToolJobPool::~ToolJobPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+    _workAvailable.notify_all();
+    for (auto& worker : _workers)
+        worker.join();
+}
+
+//=============================================================================
+// SUBMISSION
+//=============================================================================
+int ToolJobPool::submit(const AbstractTool& tool)
+{
+    std::unique_ptr<Job> job(new Job());
+    AbstractTool* copy = tool.clone();
+    job->tool.reset(copy);
+    if (tool.hasModel()) {
+        // The clone shares the prototype's model pointer; give this job
+        // its own copy. setModel() below re-adds copies of the tool's
+        // analyses and controllers to the model, and the prototype's
+        // setModel() already did the same, so first drop the ones the
+        // model copy carried over, by name, lest each job run them twice.
+        job->model.reset(tool.getModel().clone());
+        const AnalysisSet& toolAnalyses = tool.getAnalysisSet();
+        for (int i = 0; i < toolAnalyses.getSize(); ++i) {
+            AnalysisSet& modelAnalyses = job->model->updAnalysisSet();
+            const int dup =
+                modelAnalyses.getIndex(toolAnalyses.get(i).getName());
+            if (dup >= 0)
+                job->model->removeAnalysis(&modelAnalyses.get(dup));
+        }
+        const ControllerSet& toolControllers = tool.getControllerSet();
+        for (int i = 0; i < toolControllers.getSize(); ++i) {
+            ControllerSet& modelControllers =
+                job->model->updControllerSet();
+            const int dup =
+                modelControllers.getIndex(toolControllers.get(i).getName());
+            if (dup >= 0)
+                job->model->removeController(&modelControllers.get(dup));
+        }
+        copy->setModel(*job->model);
+    }
+    job->run = [copy]() { return copy->run(); };
+    job->name = tool.getName();
+    // Copies of an Object drop its XML document, so the clone cannot
+    // rediscover the setup directory itself; keep it here.
+    if (tool.getDocument() != nullptr)
+        job->setupDir = IO::getParentDirectory(tool.getDocumentFileName());
+    return appendJob(std::move(job));
+}
+
+int ToolJobPool::submit(const Tool& tool)
+{
+    std::unique_ptr<Job> job(new Job());
+    Tool* copy = tool.clone();
+    job->tool.reset(copy);
+    job->run = [copy]() { return copy->run(); };
+    job->name = tool.getName();
+    if (tool.getDocument() != nullptr)
+        job->setupDir = IO::getParentDirectory(tool.getDocumentFileName());
+    return appendJob(std::move(job));
+}
+
+int ToolJobPool::appendJob(std::unique_ptr<Job> job)
+{
+    int index = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        index = (int)_jobs.size();
+        _jobs.push_back(std::move(job));
+    }
+    _workAvailable.notify_one();
+    return index;
+}
+
+int ToolJobPool::getNumJobs() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (int)_jobs.size();
+}
+
+//=============================================================================
+// EXECUTION
+//=============================================================================
+void ToolJobPool::start()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_workers.empty())
+        return;
+    int numThreads = _numThreads;
+    if (numThreads <= 0)
+        numThreads = (int)std::thread::hardware_concurrency();
+    numThreads = std::max(1, numThreads);
+    for (int i = 0; i < numThreads; ++i)
+        _workers.emplace_back(&ToolJobPool::workerLoop, this);
+}
+
+void ToolJobPool::workerLoop()
+{
+    while (true) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _workAvailable.wait(lock,
+            [&] { return _shutdown || _nextJob < _jobs.size(); });
+        if (_shutdown)
+            return;
+        const int index = (int)_nextJob;
+        Job& job = *_jobs[_nextJob++];
+        job.status = JobStatus::Running;
+        lock.unlock();
+
+        JobStatus status = JobStatus::Succeeded;
+        std::string message;
+        try {
+            if (!runJob(job)) {
+                status = JobStatus::Failed;
+                message = "The tool's run() returned false.";
+            }
+        }
+        catch (const std::exception& ex) {
+            status = JobStatus::Failed;
+            message = ex.what();
+        }
+        catch (...) {
+            status = JobStatus::Failed;
+            message = "The tool's run() threw an unrecognized exception.";
+        }
+
+        if (status == JobStatus::Succeeded)
+            log_info("ToolJobPool finished job {} ({}).", index, job.name);
+        else
+            log_error("ToolJobPool job {} ({}) failed: {}", index, job.name,
+                message);
+
+        lock.lock();
+        job.status = status;
+        job.message = message;
+        lock.unlock();
+        _jobDone.notify_all();
+    }
+}
+
+bool ToolJobPool::runJob(Job& job) const
+{
+    // The working directory is process-wide state, so jobs that must run
+    // in their setup file's directory serialize here, across every pool
+    // in the process. Programmatic jobs skip the lock and run in parallel.
+    static std::mutex cwdMutex;
+    if (job.setupDir.empty())
+        return job.run();
+    std::lock_guard<std::mutex> cwdLock(cwdMutex);
+    auto cwd = IO::CwdChanger::changeTo(job.setupDir);
+    return job.run();
+}
+
+//=============================================================================
+// STATUS AND WAITING
+//=============================================================================
+const ToolJobPool::Job& ToolJobPool::getJob(int job) const
+{
+    // Callers hold _mutex.
+    OPENSIM_THROW_IF(job < 0 || job >= (int)_jobs.size(), Exception,
+        "Job {} does not exist; {} jobs have been submitted.",
+        job, _jobs.size());
+    return *_jobs[job];
+}
+
+ToolJobPool::JobStatus ToolJobPool::getJobStatus(int job) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return getJob(job).status;
+}
+
+std::string ToolJobPool::getJobMessage(int job) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return getJob(job).message;
+}
+
+bool ToolJobPool::wait(int job)
+{
+    start();
+    std::unique_lock<std::mutex> lock(_mutex);
+    getJob(job);
+    _jobDone.wait(lock, [&] {
+        const JobStatus status = _jobs[job]->status;
+        return status == JobStatus::Succeeded || status == JobStatus::Failed;
+    });
+    return _jobs[job]->status == JobStatus::Succeeded;
+}
+
+int ToolJobPool::waitAll()
+{
+    start();
+    std::unique_lock<std::mutex> lock(_mutex);
+    // Wait for the jobs submitted so far; jobs submitted while waiting
+    // belong to a later waitAll().
+    const std::size_t count = _jobs.size();
+    auto allDone = [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            const JobStatus status = _jobs[i]->status;
+            if (status != JobStatus::Succeeded && status != JobStatus::Failed)
+                return false;
+        }
+        return true;
+    };
+    _jobDone.wait(lock, allDone);
+    int numSucceeded = 0;
+    for (std::size_t i = 0; i < count; ++i)
+        if (_jobs[i]->status == JobStatus::Succeeded)
+            ++numSucceeded;
+    return numSucceeded;
+}
@@ -0,0 +1,153 @@
+#ifndef OPENSIM_TOOL_JOB_POOL_H_
+#define OPENSIM_TOOL_JOB_POOL_H_
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  ToolJobPool.h                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimToolsDLL.h"
+#include <OpenSim/Simulation/Model/AbstractTool.h>
+#include <OpenSim/Tools/Tool.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * Run many tool configurations inside one process on a pool of worker
+ * threads, instead of spawning an operating-system process per trial.
+ * Submitting a tool clones it and returns a job number; wait() blocks until
+ * that job has run and reports whether it succeeded, and waitAll() drains
+ * the whole batch. A job that throws or whose run() returns false is marked
+ * Failed and its message kept for getJobMessage(); it never stops the pool.
+ *
+ * Jobs run fully in parallel when their tools were configured
+ * programmatically: each clone is private to its worker, and the file names
+ * it holds resolve against the process working directory, which the pool
+ * never changes for such jobs. A tool that was loaded from a setup file is
+ * different: its file names resolve against the setup file's directory, so
+ * the pool must change the process-wide working directory for the duration
+ * of its run, and such jobs therefore execute one at a time under an
+ * internal lock (still without any per-trial process spawn). For large
+ * batches, build each trial's tool in memory with absolute file names, or
+ * use a purpose-built batch class such as InverseKinematicsBatch or
+ * EnsembleSimulator, which also reuse one initialized model per worker.
+ *
+ * An AbstractTool holding an in-memory model — which includes every tool
+ * constructed from a setup file — is deep-copied model and all, so
+ * concurrent jobs never touch the same Model. Tool subclasses offer no
+ * such hook: a Tool given a live model reference (e.g. through
+ * InverseKinematicsToolBase::setModel()) would share it across clones, so
+ * submit only fully file-configured Tools.
+ *
+ * From Python, release-worthy blocking calls (wait(), waitAll()) release
+ * the global interpreter lock, so jobs progress while the caller's script
+ * continues.
+ */
+class OSIMTOOLS_API ToolJobPool {
+//=============================================================================
+// METHODS
+//=============================================================================
+public:
+    /** The lifecycle of a submitted job. Failed covers both a run() that
+        returned false and one that threw; see getJobMessage(). */
+    enum class JobStatus { Pending, Running, Succeeded, Failed };
+
+    ToolJobPool();
+
+    /** Stops the workers and joins them. Jobs already running finish;
+        jobs still pending are left unrun. */
+    ~ToolJobPool();
+
+    ToolJobPool(const ToolJobPool&) = delete;
+    ToolJobPool& operator=(const ToolJobPool&) = delete;
+
+    /** Number of worker threads start() spawns. Zero or negative (the
+        default) resolves to the hardware concurrency. Has no effect once
+        the workers are running. */
+    void setNumThreads(int numThreads) { _numThreads = numThreads; }
+    int getNumThreads() const { return _numThreads; }
+
+    /** Queue a copy of an AbstractTool configuration (AnalyzeTool,
+        ForwardTool, CMCTool, ...) and return its job number. Throws if the
+        tool holds an in-memory model; see the class description. */
+    int submit(const AbstractTool& tool);
+
+    /** Queue a copy of a Tool configuration (InverseKinematicsTool,
+        InverseDynamicsTool, ...) and return its job number. */
+    int submit(const Tool& tool);
+
+    int getNumJobs() const;
+
+    /** Spawn the worker threads. Called implicitly by wait() and
+        waitAll(); calling it again once the workers are running is a
+        no-op. Jobs may be submitted before and after. */
+    void start();
+
+    JobStatus getJobStatus(int job) const;
+
+    /** The failure message of a Failed job: the exception text, or an
+        explanation that run() returned false. Empty otherwise. */
+    std::string getJobMessage(int job) const;
+
+    /** Block until job `job` has run and return whether it succeeded. */
+    bool wait(int job);
+
+    /** Block until every submitted job has run and return the number that
+        succeeded. */
+    int waitAll();
+
+private:
+    struct Job;
+
+    int appendJob(std::unique_ptr<Job> job);
+    void workerLoop();
+    void runJob(Job& job) const;
+    const Job& getJob(int job) const;
+
+//=============================================================================
+// DATA
+//=============================================================================
+private:
+    std::vector<std::unique_ptr<Job>> _jobs;
+    /** Index of the next job a worker will take. */
+    std::size_t _nextJob;
+    std::vector<std::thread> _workers;
+    bool _shutdown;
+    /** Worker thread count; <= 0 resolves to hardware concurrency. */
+    int _numThreads;
+    /** Guards _jobs, _nextJob and _shutdown. */
+    mutable std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::condition_variable _jobDone;
+
+//=============================================================================
+};  // END of class ToolJobPool
+//=============================================================================
+} // namespace
+
+#endif // OPENSIM_TOOL_JOB_POOL_H_
@@ -0,0 +1,96 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  TrialContext.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include "TrialContext.h"
+
+#include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/Storage.h>
+#include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/SimbodyEngine/SimbodyEngine.h>
+
+using namespace OpenSim;
+
+TrialContext::TrialContext() = default;
+
+TrialContext::~TrialContext() = default;
+
+const Storage& TrialContext::getStorage(const std::string& aFileName)
+{
+    auto it = _storages.find(aFileName);
+    if(it == _storages.end()) {
+        log_info("TrialContext: parsing '{}'.", aFileName);
+        it = _storages.emplace(aFileName,
+                std::unique_ptr<Storage>(new Storage(aFileName))).first;
+    }
+    return *it->second;
+}
+
+const TimeSeriesTable_<SimTK::Vec3>&
+TrialContext::getMarkerTable(const std::string& aFileName)
+{
+    auto it = _markerTables.find(aFileName);
+    if(it == _markerTables.end()) {
+        log_info("TrialContext: parsing marker file '{}'.", aFileName);
+        it = _markerTables.emplace(aFileName,
+                std::unique_ptr<TimeSeriesTable_<SimTK::Vec3>>(
+                    new TimeSeriesTable_<SimTK::Vec3>(aFileName))).first;
+    }
+    return *it->second;
+}
+
+const GCVSplineSet& TrialContext::getCoordinateSplines(
+        const std::string& aFileName, const Model& aModel, int aDegree)
+{
+    auto it = _coordinateSplines.find(aFileName);
+    if(it == _coordinateSplines.end()) {
+        // Copy the cached parse; the master stays in whatever units the file
+        // was written in.
+        Storage coordinateValues(getStorage(aFileName));
+        if(coordinateValues.isInDegrees())
+            aModel.getSimbodyEngine().convertDegreesToRadians(coordinateValues);
+        log_info("TrialContext: fitting splines to '{}'.", aFileName);
+        it = _coordinateSplines.emplace(aFileName,
+                std::unique_ptr<GCVSplineSet>(
+                    new GCVSplineSet(aDegree, &coordinateValues))).first;
+    }
+    return *it->second;
+}
+
+Model* TrialContext::createModel(const std::string& aFileName)
+{
+    auto it = _models.find(aFileName);
+    if(it == _models.end()) {
+        log_info("TrialContext: loading model '{}'.", aFileName);
+        it = _models.emplace(aFileName,
+                std::unique_ptr<Model>(new Model(aFileName))).first;
+        it->second->finalizeFromProperties();
+    }
+    return it->second->clone();
+}
+
+void TrialContext::clear()
+{
+    _storages.clear();
+    _markerTables.clear();
+    _coordinateSplines.clear();
+    _models.clear();
+}
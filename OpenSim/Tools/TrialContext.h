@@ -0,0 +1,113 @@
+#ifndef OPENSIM_TRIAL_CONTEXT_H_
+#define OPENSIM_TRIAL_CONTEXT_H_
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  TrialContext.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimToolsDLL.h"
+
+#include <SimTKcommon/SmallMatrix.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace OpenSim {
+
+class GCVSplineSet;
+class Model;
+class Storage;
+template <typename T> class TimeSeriesTable_;
+
+//=============================================================================
+//=============================================================================
+/**
+ * A cache of parsed data files, fitted splines, and loaded models shared by
+ * the tools operating on one motion trial.  A typical pipeline runs several
+ * tools (e.g., IK, ID, Static Optimization via Analyze, CMC) over the same
+ * trial, and each tool independently re-reads and re-splines the same
+ * kinematics files.  Constructing one TrialContext and handing it to each
+ * tool (via the tool's setTrialContext() method) makes each file be parsed,
+ * and each spline set fitted, exactly once for the whole pipeline.
+ *
+ * Cached entries are keyed by file name exactly as passed in, so the same
+ * file should be referred to by the same path throughout the pipeline.  The
+ * cache returns const references to its masters; tools that need to mutate
+ * the data (filter, pad, convert units) make their own copies, which is
+ * still far cheaper than re-parsing the file.  The context is not
+ * thread-safe; tools in a pipeline consult it sequentially.
+ */
+class OSIMTOOLS_API TrialContext {
+
+//=============================================================================
+// METHODS
+//=============================================================================
+public:
+    TrialContext();
+    ~TrialContext();
+
+    // The cached masters are shared by reference; copying the context would
+    // silently duplicate (or lose) them.
+    TrialContext(const TrialContext&) = delete;
+    TrialContext& operator=(const TrialContext&) = delete;
+
+    /** Get the parsed contents of a states/coordinates/kinematics file,
+    reading the file only on the first request.  The returned Storage is the
+    cache's master copy: callers must not modify it, and should copy it if
+    they need to filter or convert it. */
+    const Storage& getStorage(const std::string& aFileName);
+
+    /** Get the parsed contents of a marker data file (.trc) as a
+    TimeSeriesTable of Vec3, reading the file only on the first request. */
+    const TimeSeriesTable_<SimTK::Vec3>&
+        getMarkerTable(const std::string& aFileName);
+
+    /** Get splines fitted to a coordinates file after conversion from
+    degrees to radians (the form consumed by the IK and ID solvers), fitting
+    them only on the first request.  The conversion uses the coordinate set
+    of aModel, which is assumed to be the same model throughout the trial. */
+    const GCVSplineSet& getCoordinateSplines(const std::string& aFileName,
+        const Model& aModel, int aDegree=5);
+
+    /** Create a working copy of a model file for one tool in the pipeline.
+    The file is deserialized only on the first request; subsequent requests
+    clone the cached master, which is much cheaper than re-parsing the XML.
+    The caller takes ownership of the returned model. */
+    Model* createModel(const std::string& aFileName);
+
+    /** Empty all caches, releasing the parsed masters. */
+    void clear();
+
+//=============================================================================
+// DATA
+//=============================================================================
+private:
+    std::map<std::string, std::unique_ptr<Storage>> _storages;
+    std::map<std::string,
+        std::unique_ptr<TimeSeriesTable_<SimTK::Vec3>>> _markerTables;
+    std::map<std::string, std::unique_ptr<GCVSplineSet>> _coordinateSplines;
+    std::map<std::string, std::unique_ptr<Model>> _models;
+
+//=============================================================================
+};  // END of class TrialContext
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_TRIAL_CONTEXT_H_
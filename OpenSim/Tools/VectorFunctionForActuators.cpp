@@ -43,6 +43,7 @@ using namespace std;
  */
 VectorFunctionForActuators::~VectorFunctionForActuators()
 {
+    delete _timeStepper;
 }
 //_____________________________________________________________________________
 /**
@@ -63,6 +64,7 @@ VectorFunctionForActuators(SimTK::System *aActuatorSystem, Model* model, CMCActu
 
     // Don't project constraints while inside the controller
     _integrator->setProjectInterpolatedStates( false );
+    _timeStepper = new SimTK::TimeStepper(*aActuatorSystem, *_integrator);
     _f.setSize(getNX());
 }
 //_____________________________________________________________________________
@@ -99,6 +101,7 @@ setNull()
     _CMCActuatorSubsystem = NULL;
     _model             = NULL;
     _integrator        = NULL;
+    _timeStepper       = NULL;
 }
 
 //_____________________________________________________________________________
@@ -262,9 +265,11 @@ evaluate(const SimTK::State& s, const double *aX, double *rF)
                                             .getDefaultSubsystem().getZ(s);
     actSysState.setTime(_ti);
 
-    SimTK::TimeStepper ts(*_CMCActuatorSystem, *_integrator);
-    ts.initialize(actSysState);
-    ts.stepTo(_tf);
+    // Reinitializing the member time stepper rewinds the integrator in
+    // place, reusing its allocations, so evaluating a candidate control
+    // vector costs only the integration itself.
+    _timeStepper->initialize(actSysState);
+    _timeStepper->stepTo(_tf);
 
     const Set<const Actuator>& forceSet = controller.getActuatorSet();
     // Vector function values
@@ -33,6 +33,7 @@
 namespace SimTK {
 class Integrator;
 class System;
+class TimeStepper;
 }
 
 //=============================================================================
@@ -77,6 +78,11 @@ protected:
     CMCActuatorSubsystem* _CMCActuatorSubsystem;
     /** Integrator. */
     SimTK::Integrator* _integrator;
+    /** Time stepper reused across evaluations.  Every candidate control
+    vector the optimizer and root solver try costs one integration of the
+    actuator subsystem; reinitializing one time stepper in place spares
+    each candidate the construction and allocation of a new one. */
+    SimTK::TimeStepper* _timeStepper;
     /** Model */
     Model* _model;
 
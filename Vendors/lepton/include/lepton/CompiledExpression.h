@@ -62,6 +62,13 @@ class LEPTON_EXPORT CompiledExpression {
 public:
     CompiledExpression();
     CompiledExpression(const CompiledExpression& expression);
+    /**
+     * Create a CompiledExpression that evaluates several expressions at once.
+     * Subexpressions that are shared between the expressions are evaluated
+     * only once.  Use evaluate(double*) to compute the values of all the
+     * expressions.
+     */
+    CompiledExpression(const std::vector<ParsedExpression>& expressions);
     ~CompiledExpression();
     CompiledExpression& operator=(const CompiledExpression& expression);
     /**
@@ -75,15 +82,27 @@ public:
     double& getVariableReference(const std::string& name);
     /**
      * Evaluate the expression.  The values of all variables should have been set before calling this.
+     * If this object evaluates several expressions, this returns the value of the first one.
      */
     double evaluate() const;
+    /**
+     * Get the number of expressions this object evaluates.
+     */
+    int getNumOutputs() const;
+    /**
+     * Evaluate all the expressions, storing their values into results, which must have getNumOutputs()
+     * elements.  The values of all variables should have been set before calling this.
+     */
+    void evaluate(double* results) const;
 private:
     friend class ParsedExpression;
     CompiledExpression(const ParsedExpression& expression);
     void compileExpression(const ExpressionTreeNode& node, std::vector<std::pair<ExpressionTreeNode, int> >& temps);
     int findTempIndex(const ExpressionTreeNode& node, std::vector<std::pair<ExpressionTreeNode, int> >& temps);
+    void evaluateOperations() const;
     std::vector<std::vector<int> > arguments;
     std::vector<int> target;
+    std::vector<int> outputIndices;
     std::vector<Operation*> operation;
     std::map<std::string, int> variableIndices;
     std::set<std::string> variableNames;
@@ -57,6 +57,16 @@ public:
      * @param children     the children of this node
      */
     ExpressionTreeNode(Operation* operation, const std::vector<ExpressionTreeNode>& children);
+    /**
+     * Create a new ExpressionTreeNode, taking over ownership of the children.
+     * This avoids recursively copying the child trees and cloning their
+     * Operations, which matters when building large trees during parsing.
+     *
+     * @param operation    the operation for this node.  The ExpressionTreeNode takes over ownership
+     *                     of this object, and deletes it when the node is itself deleted.
+     * @param children     the children of this node
+     */
+    ExpressionTreeNode(Operation* operation, std::vector<ExpressionTreeNode>&& children);
     /**
      * Create a new ExpressionTreeNode with two children.
      *
@@ -66,6 +76,16 @@ public:
      * @param child2       the second child of this node
      */
     ExpressionTreeNode(Operation* operation, const ExpressionTreeNode& child1, const ExpressionTreeNode& child2);
+    /**
+     * Create a new ExpressionTreeNode with two children, taking over ownership
+     * of the children.
+     *
+     * @param operation    the operation for this node.  The ExpressionTreeNode takes over ownership
+     *                     of this object, and deletes it when the node is itself deleted.
+     * @param child1       the first child of this node
+     * @param child2       the second child of this node
+     */
+    ExpressionTreeNode(Operation* operation, ExpressionTreeNode&& child1, ExpressionTreeNode&& child2);
     /**
      * Create a new ExpressionTreeNode with one child.
      *
@@ -74,6 +94,15 @@ public:
      * @param child        the child of this node
      */
     ExpressionTreeNode(Operation* operation, const ExpressionTreeNode& child);
+    /**
+     * Create a new ExpressionTreeNode with one child, taking over ownership of
+     * the child.
+     *
+     * @param operation    the operation for this node.  The ExpressionTreeNode takes over ownership
+     *                     of this object, and deletes it when the node is itself deleted.
+     * @param child        the child of this node
+     */
+    ExpressionTreeNode(Operation* operation, ExpressionTreeNode&& child);
     /**
      * Create a new ExpressionTreeNode with no children.
      *
@@ -82,11 +111,13 @@ public:
      */
     ExpressionTreeNode(Operation* operation);
     ExpressionTreeNode(const ExpressionTreeNode& node);
+    ExpressionTreeNode(ExpressionTreeNode&& node) noexcept;
     ExpressionTreeNode();
     ~ExpressionTreeNode();
     bool operator==(const ExpressionTreeNode& node) const;
     bool operator!=(const ExpressionTreeNode& node) const;
     ExpressionTreeNode& operator=(const ExpressionTreeNode& node);
+    ExpressionTreeNode& operator=(ExpressionTreeNode&& node) noexcept;
     /**
      * Get the Operation performed by this node.
      */
@@ -59,6 +59,12 @@ public:
      * to parse expression.
      */
     ParsedExpression(const ExpressionTreeNode& rootNode);
+    /**
+     * Create a ParsedExpression, taking over ownership of the root node.  This avoids copying the
+     * expression tree.  Normally you will not call this directly.  Instead, use the Parser class
+     * to parse expression.
+     */
+    ParsedExpression(ExpressionTreeNode&& rootNode);
     /**
      * Get the root node of the expression's abstract syntax tree.
      */
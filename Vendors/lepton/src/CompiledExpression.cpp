@@ -47,6 +47,7 @@ CompiledExpression::CompiledExpression(const ParsedExpression& expression) : jit
     ParsedExpression expr = expression.optimize(); // Just in case it wasn't already optimized.
     vector<pair<ExpressionTreeNode, int> > temps;
     compileExpression(expr.getRootNode(), temps);
+    outputIndices.push_back(findTempIndex(expr.getRootNode(), temps));
     int maxArguments = 1;
     for (int i = 0; i < (int) operation.size(); i++)
         if (operation[i]->getNumArguments() > maxArguments)
@@ -57,6 +58,29 @@ CompiledExpression::CompiledExpression(const ParsedExpression& expression) : jit
 #endif
 }
 
+CompiledExpression::CompiledExpression(const vector<ParsedExpression>& expressions) : jitCode(NULL) {
+    // Compile all the expressions into a single program.  Subtrees that appear in
+    // more than one expression are recognized by compileExpression() and evaluated
+    // only once.
+    vector<pair<ExpressionTreeNode, int> > temps;
+    for (int i = 0; i < (int) expressions.size(); i++) {
+        ParsedExpression expr = expressions[i].optimize(); // Just in case it wasn't already optimized.
+        compileExpression(expr.getRootNode(), temps);
+        outputIndices.push_back(findTempIndex(expr.getRootNode(), temps));
+    }
+    int maxArguments = 1;
+    for (int i = 0; i < (int) operation.size(); i++)
+        if (operation[i]->getNumArguments() > maxArguments)
+            maxArguments = operation[i]->getNumArguments();
+    argValues.resize(maxArguments);
+#ifdef LEPTON_USE_JIT
+    // The generated code returns a single value, so only use it when there is
+    // a single output.
+    if (outputIndices.size() == 1)
+        generateJitCode();
+#endif
+}
+
 CompiledExpression::~CompiledExpression() {
     for (int i = 0; i < (int) operation.size(); i++)
         if (operation[i] != NULL)
@@ -70,6 +94,7 @@ CompiledExpression::CompiledExpression(const CompiledExpression& expression) : j
 CompiledExpression& CompiledExpression::operator=(const CompiledExpression& expression) {
     arguments = expression.arguments;
     target = expression.target;
+    outputIndices = expression.outputIndices;
     variableIndices = expression.variableIndices;
     variableNames = expression.variableNames;
     workspace.resize(expression.workspace.size());
@@ -78,7 +103,8 @@ CompiledExpression& CompiledExpression::operator=(const CompiledExpression& expr
     for (int i = 0; i < (int) operation.size(); i++)
         operation[i] = expression.operation[i]->clone();
 #ifdef LEPTON_USE_JIT
-    generateJitCode();
+    if (outputIndices.size() == 1)
+        generateJitCode();
 #endif
     return *this;
 }
@@ -145,10 +171,33 @@ double& CompiledExpression::getVariableReference(const string& name) {
 
 double CompiledExpression::evaluate() const {
 #ifdef LEPTON_USE_JIT
-    return ((double (*)()) jitCode)();
-#else
+    if (jitCode != NULL)
+        return ((double (*)()) jitCode)();
+#endif
+    evaluateOperations();
+    return workspace[outputIndices[0]];
+}
+
+int CompiledExpression::getNumOutputs() const {
+    return (int) outputIndices.size();
+}
+
+void CompiledExpression::evaluate(double* results) const {
+#ifdef LEPTON_USE_JIT
+    // Generated code is only available when there is a single output.
+    if (jitCode != NULL) {
+        results[0] = ((double (*)()) jitCode)();
+        return;
+    }
+#endif
+    evaluateOperations();
+    for (int i = 0; i < (int) outputIndices.size(); i++)
+        results[i] = workspace[outputIndices[i]];
+}
+
+void CompiledExpression::evaluateOperations() const {
     // Loop over the operations and evaluate each one.
-    
+
     for (unsigned step = 0; step < operation.size(); step++) {
         const vector<int>& args = arguments[step];
         if (args.size() == 1)
@@ -159,8 +208,6 @@ double CompiledExpression::evaluate() const {
             workspace[target[step]] = operation[step]->evaluate(&argValues[0], dummyVariables);
         }
     }
-    return workspace[workspace.size()-1];
-#endif
 }
 
 #ifdef LEPTON_USE_JIT
@@ -32,6 +32,7 @@
 #include "lepton/ExpressionTreeNode.h"
 #include "lepton/Exception.h"
 #include "lepton/Operation.h"
+#include <utility>
 
 using namespace Lepton;
 using namespace std;
@@ -41,6 +42,11 @@ ExpressionTreeNode::ExpressionTreeNode(Operation* operation, const vector<Expres
         throw Exception("Parse error: wrong number of arguments to function: "+operation->getName());
 }
 
+ExpressionTreeNode::ExpressionTreeNode(Operation* operation, vector<ExpressionTreeNode>&& children) : operation(operation), children(std::move(children)) {
+    if (static_cast<unsigned>(operation->getNumArguments()) != this->children.size())
+        throw Exception("Parse error: wrong number of arguments to function: "+operation->getName());
+}
+
 ExpressionTreeNode::ExpressionTreeNode(Operation* operation, const ExpressionTreeNode& child1, const ExpressionTreeNode& child2) : operation(operation) {
     children.push_back(child1);
     children.push_back(child2);
@@ -48,12 +54,25 @@ ExpressionTreeNode::ExpressionTreeNode(Operation* operation, const ExpressionTre
         throw Exception("Parse error: wrong number of arguments to function: "+operation->getName());
 }
 
+ExpressionTreeNode::ExpressionTreeNode(Operation* operation, ExpressionTreeNode&& child1, ExpressionTreeNode&& child2) : operation(operation) {
+    children.push_back(std::move(child1));
+    children.push_back(std::move(child2));
+    if (static_cast<unsigned>(operation->getNumArguments()) != children.size())
+        throw Exception("Parse error: wrong number of arguments to function: "+operation->getName());
+}
+
 ExpressionTreeNode::ExpressionTreeNode(Operation* operation, const ExpressionTreeNode& child) : operation(operation) {
     children.push_back(child);
     if (static_cast<unsigned>(operation->getNumArguments()) != children.size())
         throw Exception("Parse error: wrong number of arguments to function: "+operation->getName());
 }
 
+ExpressionTreeNode::ExpressionTreeNode(Operation* operation, ExpressionTreeNode&& child) : operation(operation) {
+    children.push_back(std::move(child));
+    if (static_cast<unsigned>(operation->getNumArguments()) != children.size())
+        throw Exception("Parse error: wrong number of arguments to function: "+operation->getName());
+}
+
 ExpressionTreeNode::ExpressionTreeNode(Operation* operation) : operation(operation) {
     if (static_cast<unsigned>(operation->getNumArguments()) != children.size())
         throw Exception("Parse error: wrong number of arguments to function: "+operation->getName());
@@ -62,6 +81,10 @@ ExpressionTreeNode::ExpressionTreeNode(Operation* operation) : operation(operati
 ExpressionTreeNode::ExpressionTreeNode(const ExpressionTreeNode& node) : operation(&node.getOperation() == NULL ? NULL : node.getOperation().clone()), children(node.getChildren()) {
 }
 
+ExpressionTreeNode::ExpressionTreeNode(ExpressionTreeNode&& node) noexcept : operation(node.operation), children(std::move(node.children)) {
+    node.operation = NULL;
+}
+
 ExpressionTreeNode::ExpressionTreeNode() : operation(NULL) {
 }
 
@@ -98,6 +121,17 @@ ExpressionTreeNode& ExpressionTreeNode::operator=(const ExpressionTreeNode& node
     return *this;
 }
 
+ExpressionTreeNode& ExpressionTreeNode::operator=(ExpressionTreeNode&& node) noexcept {
+    if (this == &node)
+        return *this;
+    if (operation != NULL)
+        delete operation;
+    operation = node.operation;
+    node.operation = NULL;
+    children = std::move(node.children);
+    return *this;
+}
+
 const Operation& ExpressionTreeNode::getOperation() const {
     return *operation;
 }
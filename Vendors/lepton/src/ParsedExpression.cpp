@@ -34,6 +34,7 @@
 #include "lepton/ExpressionProgram.h"
 #include "lepton/Operation.h"
 #include <limits>
+#include <utility>
 #include <vector>
 
 using namespace Lepton;
@@ -42,6 +43,9 @@ using namespace std;
 ParsedExpression::ParsedExpression() : rootNode(ExpressionTreeNode()) {
 }
 
+ParsedExpression::ParsedExpression(ExpressionTreeNode&& rootNode) : rootNode(std::move(rootNode)) {
+}
+
 ParsedExpression::ParsedExpression(const ExpressionTreeNode& rootNode) : rootNode(rootNode) {
 }
 
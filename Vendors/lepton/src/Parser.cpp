@@ -37,6 +37,7 @@
 #include "lepton/ParsedExpression.h"
 #include <cctype>
 #include <iostream>
+#include <utility>
 
 using namespace Lepton;
 using namespace std;
@@ -188,7 +189,7 @@ ParsedExpression Parser::parse(const string& expression, const map<string, Custo
     ExpressionTreeNode result = parsePrecedence(tokens, pos, customFunctions, subexpDefs, 0);
     if (static_cast<unsigned>(pos) != tokens.size())
         throw Exception("Parse error: unexpected text at end of expression: "+tokens[pos].getText());
-    return ParsedExpression(result);
+    return ParsedExpression(std::move(result));
 }
 
 ExpressionTreeNode Parser::parsePrecedence(const vector<ParseToken>& tokens, int& pos, const map<string, CustomFunction*>& customFunctions,
@@ -240,7 +241,7 @@ ExpressionTreeNode Parser::parsePrecedence(const vector<ParseToken>& tokens, int
         pos++;
         Operation* op = getFunctionOperation(token.getText(), customFunctions);
         try {
-            result = ExpressionTreeNode(op, args);
+            result = ExpressionTreeNode(op, std::move(args));
         }
         catch (...) {
             delete op;
@@ -250,7 +251,7 @@ ExpressionTreeNode Parser::parsePrecedence(const vector<ParseToken>& tokens, int
     else if (token.getType() == ParseToken::Operator && token.getText() == "-") {
         pos++;
         ExpressionTreeNode toNegate = parsePrecedence(tokens, pos, customFunctions, subexpressionDefs, 2);
-        result = ExpressionTreeNode(new Operation::Negate(), toNegate);
+        result = ExpressionTreeNode(new Operation::Negate(), std::move(toNegate));
     }
     else
         throw Exception("Parse error: unexpected token: "+token.getText());
@@ -267,7 +268,7 @@ ExpressionTreeNode Parser::parsePrecedence(const vector<ParseToken>& tokens, int
         ExpressionTreeNode arg = parsePrecedence(tokens, pos, customFunctions, subexpressionDefs, LeftAssociative[opIndex] ? opPrecedence+1 : opPrecedence);
         Operation* op = getOperatorOperation(token.getText());
         try {
-            result = ExpressionTreeNode(op, result, arg);
+            result = ExpressionTreeNode(op, std::move(result), std::move(arg));
         }
         catch (...) {
             delete op;
@@ -498,6 +498,30 @@ TEST_CASE("Check derivatives with analytical deriv.; sparse Jacobian.")
         }
     }
 
+    SECTION("Parallel finite differences") {
+        // SparseJacobian's evaluation functions have no mutable working
+        // memory, so it can declare thread-safe evaluation.
+        class ParallelSparseJacobian : public SparseJacobian<double> {
+            bool get_thread_safe_evaluation() const override { return true; }
+        } problemd;
+        auto proxy = problemd.make_decorator();
+        proxy->set_findiff_parallel(2);
+        SparsityCoordinates jac_sparsity;
+        SparsityCoordinates hes_sparsity;
+        proxy->calc_sparsity(proxy->make_initial_guess_from_bounds(),
+                jac_sparsity, true, hes_sparsity);
+
+        VectorXd fd_jacobian_values(num_jacobian_elem);
+        proxy->calc_jacobian(problem.get_num_variables(), x.data(), true,
+                num_jacobian_elem, fd_jacobian_values.data());
+        for (int inz = 0; inz < (int)num_jacobian_elem; ++inz) {
+            const auto& i = jac_sparsity.row[inz];
+            const auto& j = jac_sparsity.col[inz];
+            REQUIRE(analytical_jacobian(i, j) ==
+                    Approx(fd_jacobian_values[inz]).epsilon(1e-8));
+        }
+    }
+
     // Automatic derivatives.
     // ----------------------
     SECTION("ADOL-C") {
@@ -541,6 +565,36 @@ TEST_CASE("Check derivatives with analytical deriv.; sparse Jacobian.")
             REQUIRE(analytical_jacobian(i, j) == adolc_jacobian_values[inz]);
         }
     }
+
+    SECTION("ADOL-C tape reuse") {
+        auto proxy = problem.make_decorator();
+        proxy->set_adolc_reuse_tapes(true);
+        SparsityCoordinates jac_sparsity;
+        SparsityCoordinates hes_sparsity;
+        proxy->calc_sparsity(proxy->make_initial_guess_from_bounds(),
+                jac_sparsity, true, hes_sparsity);
+
+        // A second calc_sparsity() call (e.g., a warm-started re-solve)
+        // reuses the tapes and must report the same sparsity pattern.
+        SparsityCoordinates jac_sparsity2;
+        SparsityCoordinates hes_sparsity2;
+        proxy->calc_sparsity(proxy->make_initial_guess_from_bounds(),
+                jac_sparsity2, true, hes_sparsity2);
+        REQUIRE(jac_sparsity2.row == jac_sparsity.row);
+        REQUIRE(jac_sparsity2.col == jac_sparsity.col);
+        REQUIRE(hes_sparsity2.row == hes_sparsity.row);
+        REQUIRE(hes_sparsity2.col == hes_sparsity.col);
+
+        // The reused tapes still produce correct derivatives.
+        VectorXd adolc_jacobian_values(num_jacobian_elem);
+        proxy->calc_jacobian(problem.get_num_variables(), x.data(), true,
+                num_jacobian_elem, adolc_jacobian_values.data());
+        for (int inz = 0; inz < (int)num_jacobian_elem; ++inz) {
+            const auto& i = jac_sparsity.row[inz];
+            const auto& j = jac_sparsity.col[inz];
+            REQUIRE(analytical_jacobian(i, j) == adolc_jacobian_values[inz]);
+        }
+    }
 }
 
 TEST_CASE("Check finite differences on bounds", "[finitediff][!mayfail]")
@@ -57,6 +57,21 @@ public:
     }
 };
 
+// The same task as SlidingMass, but with the effort split evenly across two
+// cost terms so that parallel cost evaluation has independent terms to
+// evaluate.
+template<typename T>
+class SlidingMassSplitEffort : public SlidingMass<T> {
+public:
+    SlidingMassSplitEffort() {
+        this->add_cost("effort2", 1);
+    }
+    void calc_cost(int, const CostInput<T>& in, T& cost) const override {
+        cost = 0.5 * in.integral;
+    }
+    bool get_thread_safe_cost_evaluation() const override { return true; }
+};
+
 TEST_CASE("IPOPT") {
 
     SECTION("ADOL-C, trapezoidal") {
@@ -187,6 +202,86 @@ TEST_CASE("IPOPT") {
         TROPTER_REQUIRE_EIGEN(solution.controls.middleCols(1, N - 2), expected,
             0.1);
     }
+    SECTION("Exact Hessian, sparse block detection, trapezoidal") {
+        auto ocp = std::make_shared<SlidingMass<double>>();
+        DirectCollocationSolver<double> dircol(ocp, "trapezoidal", "ipopt");
+        dircol.set_exact_hessian_block_sparsity_mode("sparse");
+        dircol.get_opt_solver().set_findiff_hessian_step_size(1e-3);
+        dircol.get_opt_solver().set_jacobian_approximation("exact");
+        dircol.get_opt_solver().set_hessian_approximation("exact");
+        Solution solution = dircol.solve();
+        REQUIRE(Approx(solution.states(0, 0)) == 0.0);
+        REQUIRE(Approx(solution.states.rightCols<1>()[0]) == 1.0);
+        // Initial and final speed.
+        REQUIRE(Approx(solution.states(1, 0)) == 0.0);
+        REQUIRE(Approx(solution.states.rightCols<1>()[1]) == 0.0);
+        int N = (int)solution.time.size();
+        RowVectorXd expected = RowVectorXd::LinSpaced(N - 2, 14.6119, -14.6119);
+        TROPTER_REQUIRE_EIGEN(solution.controls.middleCols(1, N - 2), expected,
+                0.1);
+    }
+    SECTION("Exact Hessian, sparse block detection, hermite-simpson") {
+        auto ocp = std::make_shared<SlidingMass<double>>();
+        DirectCollocationSolver<double> dircol(ocp, "hermite-simpson", "ipopt");
+        dircol.set_exact_hessian_block_sparsity_mode("sparse");
+        dircol.get_opt_solver().set_findiff_hessian_step_size(1e-3);
+        dircol.get_opt_solver().set_jacobian_approximation("exact");
+        dircol.get_opt_solver().set_hessian_approximation("exact");
+        Solution solution = dircol.solve();
+        REQUIRE(Approx(solution.states(0, 0)) == 0.0);
+        REQUIRE(Approx(solution.states.rightCols<1>()[0]) == 1.0);
+        // Initial and final speed.
+        REQUIRE(Approx(solution.states(1, 0)) == 0.0);
+        REQUIRE(Approx(solution.states.rightCols<1>()[1]) == 0.0);
+        int N = (int)solution.time.size();
+        RowVectorXd expected = RowVectorXd::LinSpaced(N - 2, 14.6119, -14.6119);
+        TROPTER_REQUIRE_EIGEN(solution.controls.middleCols(1, N - 2), expected,
+            0.1);
+    }
+    SECTION("Warm start from a previous solution") {
+        auto ocp = std::make_shared<SlidingMass<double>>();
+        DirectCollocationSolver<double> dircol(ocp, "trapezoidal", "ipopt");
+        dircol.get_opt_solver().set_findiff_hessian_step_size(1e-3);
+        Solution cold = dircol.solve();
+        REQUIRE(cold.success);
+        REQUIRE(cold.constraint_multipliers.size() > 0);
+        REQUIRE(cold.bound_multipliers_lower.size() > 0);
+        REQUIRE(cold.bound_multipliers_upper.size() > 0);
+
+        // Re-solve from the solution and its multipliers; the warm-started
+        // solve should not need more iterations than the cold solve, and
+        // should reach the same solution.
+        dircol.get_opt_solver().set_warm_start(true);
+        dircol.get_opt_solver().set_warm_start_multipliers(
+                cold.constraint_multipliers,
+                cold.bound_multipliers_lower,
+                cold.bound_multipliers_upper);
+        Solution warm = dircol.solve(cold);
+        REQUIRE(warm.success);
+        REQUIRE(warm.num_iterations <= cold.num_iterations);
+        TROPTER_REQUIRE_EIGEN(warm.states, cold.states, 1e-3);
+        TROPTER_REQUIRE_EIGEN(warm.controls, cold.controls, 1e-2);
+    }
+    SECTION("Parallel evaluation of cost terms") {
+        auto ocp = std::make_shared<SlidingMassSplitEffort<double>>();
+        DirectCollocationSolver<double> dircol(ocp, "hermite-simpson", "ipopt");
+        dircol.set_parallel_cost_evaluation(2);
+        dircol.get_opt_solver().set_findiff_hessian_step_size(1e-3);
+        dircol.get_opt_solver()
+            .set_jacobian_approximation("finite-difference-values");
+        dircol.get_opt_solver().set_hessian_approximation("limited-memory");
+        Solution solution = dircol.solve();
+        REQUIRE(solution.success);
+        REQUIRE(Approx(solution.states(0, 0)) == 0.0);
+        REQUIRE(Approx(solution.states.rightCols<1>()[0]) == 1.0);
+        // Initial and final speed.
+        REQUIRE(Approx(solution.states(1, 0)) == 0.0);
+        REQUIRE(Approx(solution.states.rightCols<1>()[1]) == 0.0);
+        int N = (int)solution.time.size();
+        RowVectorXd expected = RowVectorXd::LinSpaced(N - 2, 14.6119, -14.6119);
+        TROPTER_REQUIRE_EIGEN(solution.controls.middleCols(1, N - 2), expected,
+            0.1);
+    }
 }
 
 #if defined(TROPTER_WITH_SNOPT)
@@ -100,6 +100,16 @@ public:
     bool get_interpolate_control_midpoints() const
     { return m_interpolate_control_midpoints; }
 
+    /// Maximum number of threads to use when evaluating independent cost
+    /// terms in the objective (default: 1). This setting is copied into the
+    /// underlying transcription scheme; see
+    /// transcription::Base::set_parallel_cost_evaluation() for the conditions
+    /// under which it takes effect.
+    void set_parallel_cost_evaluation(int num_threads);
+    /// @copydoc set_parallel_cost_evaluation()
+    int get_parallel_cost_evaluation() const
+    { return m_parallel_cost_evaluation; }
+
     /// Solve the problem using an initial guess that is based on the bounds
     /// on the variables.
     Solution solve() const;
@@ -145,6 +155,7 @@ private:
     int m_verbosity = 1;
     std::string m_exact_hessian_block_sparsity_mode{"dense"};
     bool m_interpolate_control_midpoints = true;
+    int m_parallel_cost_evaluation = 1;
 };
 
 } // namespace tropter
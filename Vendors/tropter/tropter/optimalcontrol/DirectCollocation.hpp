@@ -92,6 +92,13 @@ void DirectCollocationSolver<T>::set_interpolate_control_midpoints(bool tf) {
     m_interpolate_control_midpoints = tf;
 }
 
+template<typename T>
+void DirectCollocationSolver<T>::set_parallel_cost_evaluation(
+        int num_threads) {
+    m_transcription->set_parallel_cost_evaluation(num_threads);
+    m_parallel_cost_evaluation = num_threads;
+}
+
 template<typename T>
 Solution DirectCollocationSolver<T>::solve() const
 {
@@ -120,6 +127,9 @@ Solution DirectCollocationSolver<T>::solve(
     solution.diffuses = traj.diffuses;
     solution.parameters = traj.parameters;
     solution.objective = optsol.objective;
+    solution.constraint_multipliers = optsol.constraint_multipliers;
+    solution.bound_multipliers_lower = optsol.bound_multipliers_lower;
+    solution.bound_multipliers_upper = optsol.bound_multipliers_upper;
     solution.state_names = traj.state_names;
     solution.control_names = traj.control_names;
     solution.adjunct_names = traj.adjunct_names;
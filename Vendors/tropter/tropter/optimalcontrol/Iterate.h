@@ -89,6 +89,18 @@ struct Iterate {
 /// @ingroup optimalcontrol
 struct Solution : public Iterate {
     double objective;
+    /// Lagrange multipliers for the transcribed problem's constraints at the
+    /// solution (empty if the optimizer does not report multipliers). Along
+    /// with the bound multipliers below, these can be passed to
+    /// optimization::Solver::set_warm_start_multipliers() to warm-start a
+    /// subsequent solve of a problem with the same mesh and structure.
+    Eigen::VectorXd constraint_multipliers;
+    /// Multipliers for the transcribed problem's variable lower bounds at the
+    /// solution (empty if the optimizer does not report multipliers).
+    Eigen::VectorXd bound_multipliers_lower;
+    /// Multipliers for the transcribed problem's variable upper bounds at the
+    /// solution (empty if the optimizer does not report multipliers).
+    Eigen::VectorXd bound_multipliers_upper;
     /// Did the solver converge?
     explicit operator bool() { return success; }
     /// Did the solver converge?
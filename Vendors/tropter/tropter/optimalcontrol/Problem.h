@@ -407,6 +407,12 @@ public:
     /// to ensure determine which cost to compute.
     virtual void calc_cost_integrand(
             int cost_index, const Input<T>& in, T& integrand) const;
+    /// May calc_cost() and calc_cost_integrand() be invoked concurrently from
+    /// multiple threads, for different cost terms? Override this to return
+    /// true to permit parallel evaluation of independent cost terms (see
+    /// transcription::Base::set_parallel_cost_evaluation()). Implementations
+    /// whose cost terms share mutable state must leave this false.
+    virtual bool get_thread_safe_cost_evaluation() const { return false; }
     /// @}
 
     /// @name Helpers for setting an initial guess
@@ -96,8 +96,24 @@ public:
     std::string get_exact_hessian_block_sparsity_mode () const
     {   return m_exact_hessian_block_sparsity_mode; }
 
+    /// Maximum number of threads to use when evaluating independent cost
+    /// terms in calc_objective(). Values greater than 1 take effect only with
+    /// double scalars (ADOL-C taping is global state and is not thread-safe)
+    /// and only if the optimal control problem permits concurrent cost
+    /// evaluation (see Problem::get_thread_safe_cost_evaluation()).
+    /// (default: 1).
+    void set_parallel_cost_evaluation(int num_threads) {
+        TROPTER_VALUECHECK(num_threads >= 1,
+            "parallel cost evaluation thread count", num_threads, "positive");
+        m_parallel_cost_evaluation = num_threads;
+    }
+    /// @copydoc set_parallel_cost_evaluation()
+    int get_parallel_cost_evaluation() const
+    {   return m_parallel_cost_evaluation; }
+
 private:
     std::string m_exact_hessian_block_sparsity_mode{"dense"};
+    int m_parallel_cost_evaluation = 1;
 
 };
 
@@ -277,9 +277,13 @@ private:
     mutable VectorX<T> m_empty_path_constraint_col;
     // This empty vector is passed to calc_differential_algebraic_equations()
     // for collocation points on the mesh where we do not have diffuse
-    // variables. If the user tries to write to it, an Eigen runtime assertion 
-    // will be violated. 
+    // variables. If the user tries to write to it, an Eigen runtime assertion
+    // will be violated.
     mutable VectorX<T> m_empty_diffuse_col;
+    // Holds the diffuse variables at a midpoint in calc_objective();
+    // preallocated so that the integrand loop does not allocate during
+    // optimizer iterations.
+    mutable VectorX<T> m_diffuse_working;
 };
 
 } // namespace transcription
@@ -17,7 +17,10 @@
 // ----------------------------------------------------------------------------
 
 #include "HermiteSimpson.h"
+#include <algorithm>
 #include <iomanip>
+#include <thread>
+#include <type_traits>
 
 #include <tropter/Exception.hpp>
 #include <tropter/SparsityPattern.h>
@@ -304,6 +307,7 @@ void HermiteSimpson<T>::set_ocproblem(
     m_integrand.resize(m_num_col_points);
     m_derivs_mesh.resize(m_num_states, m_num_mesh_points);
     m_derivs_mid.resize(m_num_states, m_num_mesh_intervals);
+    m_diffuse_working.resize(m_num_diffuses);
     m_mesh_and_midpoints.resize(m_num_col_points);
     // Return a mesh including the Hermite-Simpson collocation midpoints to
     // enable initialization of mesh-dependent integral cost quantities.
@@ -338,37 +342,41 @@ void HermiteSimpson<T>::calc_objective(
     // ----------------------
     m_ocproblem->initialize_on_iterate(parameters);
 
-    for (int i_cost = 0; i_cost < m_ocproblem->get_num_costs(); ++i_cost) {
+    // Evaluate a single cost term, writing the result to `cost`; `integrand`
+    // and `diffuse_working` are working memory for costs that require an
+    // integral.
+    auto calc_cost_term = [&](int i_cost, VectorX<T>& integrand,
+                                  VectorX<T>& diffuse_working, T& cost) {
         // Compute integral.
         // -----------------
         T integral = 0;
         if (m_ocproblem->get_cost_requires_integral(i_cost)) {
-            m_integrand.setZero();
+            integrand.setZero();
             int i_diff = 0;
-            // TODO avoid this copy. use Ref?
-            VectorX<T> diffuse_to_use;
             for (int i_col = 0; i_col < m_num_col_points; ++i_col) {
                 const T time =
                         duration * m_mesh_and_midpoints[i_col] + initial_time;
                 // Only pass diffuse variables on the midpoints where they are
-                // defined, otherwise pass an empty variable.
+                // defined, otherwise pass an empty variable. Copy into
+                // preallocated working memory (TODO avoid this copy; use
+                // Ref?) so this loop does not allocate on each evaluation.
                 if (i_col % 2) {
-                    diffuse_to_use = diffuses.col(i_diff);
+                    diffuse_working = diffuses.col(i_diff);
                     ++i_diff;
-                } else {
-                    diffuse_to_use = m_empty_diffuse_col;
                 }
+                const VectorX<T>& diffuse_to_use =
+                        i_col % 2 ? diffuse_working : m_empty_diffuse_col;
 
                 m_ocproblem->calc_cost_integrand(i_cost,
                         {i_col, time, states.col(i_col), controls.col(i_col),
                                 adjuncts.col(i_col), diffuse_to_use,
                                 parameters},
-                        m_integrand[i_col]);
+                        integrand[i_col]);
             }
 
             for (int i_col = 0; i_col < m_num_col_points; ++i_col) {
                 integral += m_simpson_quadrature_coefficients[i_col] *
-                            m_integrand[i_col];
+                            integrand[i_col];
             }
             // The quadrature coefficients are fractions of the duration;
             // multiply by duration to get the correct units.
@@ -379,15 +387,50 @@ void HermiteSimpson<T>::calc_objective(
 
         // Compute cost.
         // -------------
-        T cost = 0;
+        cost = 0;
         m_ocproblem->calc_cost(i_cost,
                 {0, initial_time, states.leftCols(1), controls.leftCols(1),
                         adjuncts.leftCols(1), m_num_mesh_points - 1, final_time,
                         states.rightCols(1), controls.rightCols(1),
                         adjuncts.rightCols(1), parameters, integral},
                 cost);
+    };
 
-        obj_value += cost;
+    const int num_costs = m_ocproblem->get_num_costs();
+    const int num_threads =
+            std::min(this->get_parallel_cost_evaluation(), num_costs);
+    if (std::is_same<T, double>::value && num_threads > 1 &&
+            m_ocproblem->get_thread_safe_cost_evaluation()) {
+        // Evaluate independent cost terms concurrently, then reduce to the
+        // scalar objective below. ADOL-C taping relies on global state, so
+        // this branch is restricted to double scalars.
+        VectorX<T> costs(num_costs);
+        auto evaluate_costs = [&](int ifirst, int ilast) {
+            // Per-thread working memory.
+            VectorX<T> integrand(m_num_col_points);
+            VectorX<T> diffuse_working(m_num_diffuses);
+            for (int i_cost = ifirst; i_cost < ilast; ++i_cost)
+                calc_cost_term(
+                        i_cost, integrand, diffuse_working, costs[i_cost]);
+        };
+        std::vector<std::thread> threads;
+        const int chunk = num_costs / num_threads;
+        const int remainder = num_costs % num_threads;
+        int ifirst = 0;
+        for (int ithread = 0; ithread < num_threads; ++ithread) {
+            const int ilast = ifirst + chunk + (ithread < remainder ? 1 : 0);
+            threads.emplace_back(evaluate_costs, ifirst, ilast);
+            ifirst = ilast;
+        }
+        for (auto& thread : threads) thread.join();
+        for (int i_cost = 0; i_cost < num_costs; ++i_cost)
+            obj_value += costs[i_cost];
+    } else {
+        for (int i_cost = 0; i_cost < num_costs; ++i_cost) {
+            T cost;
+            calc_cost_term(i_cost, m_integrand, m_diffuse_working, cost);
+            obj_value += cost;
+        }
     }
 }
 
@@ -520,16 +563,51 @@ void HermiteSimpson<T>::calc_sparsity_hessian_lagrangian(
 
     SymmetricSparsityPattern dae_sparsity(m_num_continuous_variables);
     if (this->get_exact_hessian_block_sparsity_mode() == "sparse") {
-        TROPTER_THROW(
-                "Automatic sparsity detection for Hessian diagonal "
-                "blocks not implemented for Hermite-Simpson transcription.");
+        // The Hessian of sum_i lambda_i * constraint_i over constraints i has
+        // the same repeated square block of dimension num_continuous_variables
+        // on its diagonal, one per collocation point. We estimate the sparsity
+        // of this block by perturbing the continuous variables at collocation
+        // point 0 (a mesh point; diffuse variables, which exist only at
+        // midpoints, are not perturbed) and combining the sparsity from each
+        // DAE derivative and path constraint output.
+
+        // This function evaluates the DAE at collocation point 0, and returns
+        // a single DAE derivative or path constraint.
+        std::function<T(const VectorX<T>&, int)> calc_dae =
+                [this, &x](const VectorX<T>& vars, int idx) {
+                    T t = x[0]; // initial time.
+                    VectorX<T> s = vars.head(m_num_states);
+                    VectorX<T> c = vars.segment(m_num_states, m_num_controls);
+                    VectorX<T> a = vars.tail(m_num_adjuncts);
+                    VectorX<T> d; // empty
+                    VectorX<T> p =
+                            x.segment(m_num_time_variables, m_num_parameters)
+                                    .template cast<T>();
+                    VectorX<T> deriv(m_num_states);
+                    VectorX<T> path(m_num_path_constraints);
+                    m_ocproblem->calc_differential_algebraic_equations(
+                            {0, t, s, c, a, d, p}, {deriv, path});
+                    return idx < m_num_states ? deriv[idx]
+                                              : path[idx - m_num_states];
+                };
+        for (int i = 0; i < (m_num_states + m_num_path_constraints); ++i) {
+            // Create a function for a specific derivative or path constraint.
+            std::function<T(const VectorX<T>&)> calc_dae_i =
+                    std::bind(calc_dae, std::placeholders::_1, i);
+            // Determine the sparsity for this specific derivative/path
+            // constraint.
+            auto block_sparsity = calc_hessian_sparsity_with_perturbation(
+                    x.segment(
+                            m_num_dense_variables, m_num_continuous_variables),
+                    calc_dae_i);
+            // Add in this sparsity to the block that we'll repeat.
+            dae_sparsity.add_in_nonzeros(block_sparsity);
+        }
     } else if (this->get_exact_hessian_block_sparsity_mode() == "dense") {
         dae_sparsity.set_dense();
     }
 
     // Repeat the block down the diagonal of the Hessian of constraints.
-    // TODO may need to move this into each branch of if-statement above,
-    // depending on how automatic sparsity detection is implemented.
     for (int i_col = 0; i_col < m_num_col_points; ++i_col) {
         const auto istart = m_num_dense_variables + i_col * num_con_vars;
         hescon_sparsity.set_nonzero_block(istart, dae_sparsity);
@@ -549,10 +627,32 @@ void HermiteSimpson<T>::calc_sparsity_hessian_lagrangian(
         if (m_ocproblem->get_cost_requires_integral(icost)) {
             SymmetricSparsityPattern integral_cost_sparsity(num_con_vars);
             if (this->get_exact_hessian_block_sparsity_mode() == "sparse") {
-                TROPTER_THROW(
-                        "Automatic sparsity detection for Hessian diagonal "
-                        "blocks not implemented for Hermite-Simpson "
-                        "transcription.");
+                // Integral cost depends on states and controls at all times.
+                // Determine how the integrand depends on the continuous
+                // variables at collocation point 0, then repeat this block
+                // down the diagonal.
+                std::function<T(const VectorX<T>&)> calc_cost_integrand =
+                        [this, icost, &x](const VectorX<T>& vars) {
+                            T t = x[0]; // initial time.
+                            VectorX<T> s = vars.head(m_num_states);
+                            VectorX<T> c =
+                                    vars.segment(m_num_states, m_num_controls);
+                            VectorX<T> a = vars.tail(m_num_adjuncts);
+                            VectorX<T> d; // empty
+                            VectorX<T> p = x.segment(m_num_time_variables,
+                                                    m_num_parameters)
+                                                   .template cast<T>();
+                            T integrand = 0;
+                            m_ocproblem->calc_cost_integrand(
+                                    icost, {0, t, s, c, a, d, p}, integrand);
+                            return integrand;
+                        };
+                integral_cost_sparsity =
+                        calc_hessian_sparsity_with_perturbation(
+                                // Grab the first state, first controls and
+                                // first adjuncts.
+                                x.segment(m_num_dense_variables, num_con_vars),
+                                calc_cost_integrand);
             } else if (this->get_exact_hessian_block_sparsity_mode() ==
                        "dense") {
                 integral_cost_sparsity.set_dense();
@@ -560,9 +660,6 @@ void HermiteSimpson<T>::calc_sparsity_hessian_lagrangian(
 
             // Repeat the block down the diagonal of the Hessian of the
             // objective.
-            // TODO may need to move this into each branch of if-statement
-            // above, depending on how automatic sparsity detection is
-            // implemented.
             for (int i_col = 0; i_col < m_num_col_points; ++i_col) {
                 const auto istart =
                         m_num_dense_variables + i_col * num_con_vars;
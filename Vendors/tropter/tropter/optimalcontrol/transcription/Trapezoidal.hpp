@@ -17,7 +17,10 @@
 // ----------------------------------------------------------------------------
 
 #include "Trapezoidal.h"
+#include <algorithm>
 #include <iomanip>
+#include <thread>
+#include <type_traits>
 
 #include <tropter/Exception.hpp>
 #include <tropter/SparsityPattern.h>
@@ -233,24 +236,26 @@ void Trapezoidal<T>::calc_objective(const VectorX<T>& x, T& obj_value) const {
     // ----------------------
     m_ocproblem->initialize_on_iterate(parameters);
 
-    for (int i_cost = 0; i_cost < m_ocproblem->get_num_costs(); ++i_cost) {
+    // Evaluate a single cost term, writing the result to `cost`; `integrand`
+    // is working memory for costs that require an integral.
+    auto calc_cost_term = [&](int i_cost, VectorX<T>& integrand, T& cost) {
         // Compute integral.
         // -----------------
         T integral = 0;
         if (m_ocproblem->get_cost_requires_integral(i_cost)) {
-            m_integrand.setZero();
+            integrand.setZero();
             for (int i_mesh = 0; i_mesh < m_num_mesh_points; ++i_mesh) {
                 const T time = duration * m_mesh[i_mesh] + initial_time;
                 m_ocproblem->calc_cost_integrand(i_cost,
                         {i_mesh, time, states.col(i_mesh), controls.col(i_mesh),
                                 adjuncts.col(i_mesh), m_empty_diffuse_col,
                                 parameters},
-                        m_integrand[i_mesh]);
+                        integrand[i_mesh]);
             }
 
             for (int i_mesh = 0; i_mesh < m_num_mesh_points; ++i_mesh) {
                 integral += m_trapezoidal_quadrature_coefficients[i_mesh] *
-                            m_integrand[i_mesh];
+                            integrand[i_mesh];
             }
             // The quadrature coefficients are fractions of the duration;
             // multiply by duration to get the correct units.
@@ -261,15 +266,48 @@ void Trapezoidal<T>::calc_objective(const VectorX<T>& x, T& obj_value) const {
 
         // Compute cost.
         // -------------
-        T cost = 0;
+        cost = 0;
         m_ocproblem->calc_cost(i_cost,
                 {0, initial_time, states.leftCols(1), controls.leftCols(1),
                         adjuncts.leftCols(1), m_num_mesh_points - 1, final_time,
                         states.rightCols(1), controls.rightCols(1),
                         adjuncts.rightCols(1), parameters, integral},
                 cost);
+    };
 
-        obj_value += cost;
+    const int num_costs = m_ocproblem->get_num_costs();
+    const int num_threads =
+            std::min(this->get_parallel_cost_evaluation(), num_costs);
+    if (std::is_same<T, double>::value && num_threads > 1 &&
+            m_ocproblem->get_thread_safe_cost_evaluation()) {
+        // Evaluate independent cost terms concurrently, then reduce to the
+        // scalar objective below. ADOL-C taping relies on global state, so
+        // this branch is restricted to double scalars.
+        VectorX<T> costs(num_costs);
+        auto evaluate_costs = [&](int ifirst, int ilast) {
+            // Per-thread working memory.
+            VectorX<T> integrand(m_num_mesh_points);
+            for (int i_cost = ifirst; i_cost < ilast; ++i_cost)
+                calc_cost_term(i_cost, integrand, costs[i_cost]);
+        };
+        std::vector<std::thread> threads;
+        const int chunk = num_costs / num_threads;
+        const int remainder = num_costs % num_threads;
+        int ifirst = 0;
+        for (int ithread = 0; ithread < num_threads; ++ithread) {
+            const int ilast = ifirst + chunk + (ithread < remainder ? 1 : 0);
+            threads.emplace_back(evaluate_costs, ifirst, ilast);
+            ifirst = ilast;
+        }
+        for (auto& thread : threads) thread.join();
+        for (int i_cost = 0; i_cost < num_costs; ++i_cost)
+            obj_value += costs[i_cost];
+    } else {
+        for (int i_cost = 0; i_cost < num_costs; ++i_cost) {
+            T cost;
+            calc_cost_term(i_cost, m_integrand, cost);
+            obj_value += cost;
+        }
     }
 }
 
@@ -426,13 +464,6 @@ void Trapezoidal<T>::calc_sparsity_hessian_lagrangian(const Eigen::VectorXd& x,
         if (m_ocproblem->get_cost_requires_integral(icost)) {
             SymmetricSparsityPattern integral_cost_sparsity(num_con_vars);
             if (this->get_exact_hessian_block_sparsity_mode() == "sparse") {
-                // Despite our attempt to correctly implementing the sparse
-                // sparsity detection for costs, we disable this functionality
-                // until we add adequate tests.
-                TROPTER_THROW(
-                        "Automatic sparsity detection for Hessian diagonal "
-                        "blocks not implemented for Trapezoidal "
-                        "transcription.");
                 // Integral cost depends on states and controls at all times.
                 // Determine how the integrand depends on the state and control
                 // at mesh point 0, then repeat this block down the diagonal.
@@ -88,6 +88,13 @@ public:
     /// This must be false if using automatic differentiation.
     void set_use_supplied_sparsity_hessian_lagrangian(bool value)
     {   m_use_supplied_sparsity_hessian_lagrangian = value; }
+    /// May the objective and constraint functions be invoked concurrently
+    /// from multiple threads? Override this to return true to permit
+    /// multithreaded finite differences (see
+    /// ProblemDecorator::set_findiff_parallel()). Implementations whose
+    /// evaluation functions share mutable working memory--including
+    /// tropter's own transcriptions--must leave this false.
+    virtual bool get_thread_safe_evaluation() const { return false; }
     /// If using finite differences (double) with a Newton method (exact
     /// Hessian in IPOPT), then we require the sparsity pattern of the
     /// Hessian of the Lagrangian. By default, we estimate the Hessian's
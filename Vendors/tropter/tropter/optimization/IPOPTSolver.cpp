@@ -37,10 +37,22 @@ public:
     void initialize(const VectorXd& guess,
             SparsityCoordinates jacobian_sparsity,
             SparsityCoordinates hessian_sparsity);
+    /// Provide initial values for the constraint and bound multipliers; these
+    /// are given to IPOPT when warm-starting (warm_start_init_point is "yes").
+    /// Empty vectors are replaced with IPOPT's usual initialization.
+    void set_initial_multipliers(const VectorXd& constraint_multipliers,
+            const VectorXd& bound_multipliers_lower,
+            const VectorXd& bound_multipliers_upper);
     const Eigen::VectorXd& get_solution() const { return m_solution; }
     const double& get_optimal_objective_value() const
     {   return m_optimal_obj_value; }
     const int& get_num_iterations() const { return m_num_iterations; }
+    const Eigen::VectorXd& get_constraint_multipliers() const
+    {   return m_constraint_multipliers; }
+    const Eigen::VectorXd& get_bound_multipliers_lower() const
+    {   return m_bound_multipliers_lower; }
+    const Eigen::VectorXd& get_bound_multipliers_upper() const
+    {   return m_bound_multipliers_upper; }
 private:
     // TODO move to Problem if more than one solver would need this.
     // TODO should use fancy arguments to avoid temporaries and to exploit
@@ -61,7 +73,8 @@ private:
                          Number* g_lower, Number* g_upper) override;
 
     // z: multipliers for bound constraints on x.
-    // warmstart will require giving initial values for the multipliers.
+    // When warm-starting, this method also provides initial values for the
+    // multipliers (see set_initial_multipliers()).
     bool get_starting_point(Index num_variables, bool init_x, Number* x,
                             bool init_z, Number* z_L, Number* z_U,
                             Index num_constraints, bool init_lambda,
@@ -117,7 +130,13 @@ private:
     unsigned m_num_constraints = std::numeric_limits<unsigned>::max();
 
     Eigen::VectorXd m_initial_guess;
+    Eigen::VectorXd m_initial_constraint_multipliers;
+    Eigen::VectorXd m_initial_bound_multipliers_lower;
+    Eigen::VectorXd m_initial_bound_multipliers_upper;
     Eigen::VectorXd m_solution;
+    Eigen::VectorXd m_constraint_multipliers;
+    Eigen::VectorXd m_bound_multipliers_lower;
+    Eigen::VectorXd m_bound_multipliers_upper;
     double m_optimal_obj_value = std::numeric_limits<double>::quiet_NaN();
     int m_num_iterations = -1;
 
@@ -218,6 +237,20 @@ Solution IPOPTSolver::optimize_impl(const VectorXd& guess) const {
             "computed Hessian information.");
     }
 
+    if (get_warm_start()) {
+        // Start from the provided iterate (and multipliers, if provided)
+        // rather than pushing the initial point towards the interior of the
+        // bounds. The push values below can be overridden via the advanced
+        // options, which are set afterwards.
+        ipoptions->SetStringValue("warm_start_init_point", "yes");
+        ipoptions->SetNumericValue("warm_start_bound_push", 1e-9);
+        ipoptions->SetNumericValue("warm_start_bound_frac", 1e-9);
+        ipoptions->SetNumericValue("warm_start_slack_bound_push", 1e-9);
+        ipoptions->SetNumericValue("warm_start_slack_bound_frac", 1e-9);
+        ipoptions->SetNumericValue("warm_start_mult_bound_push", 1e-9);
+        ipoptions->SetNumericValue("mu_init", 1e-5);
+    }
+
     // Set advanced options.
     for (const auto& option : get_advanced_options_string()) {
         if (option.second) {
@@ -270,6 +303,11 @@ Solution IPOPTSolver::optimize_impl(const VectorXd& guess) const {
             need_exact_hessian, hessian_sparsity);
     nlp->initialize(guess, std::move(jacobian_sparsity),
             std::move(hessian_sparsity));
+    if (get_warm_start()) {
+        nlp->set_initial_multipliers(get_warm_start_constraint_multipliers(),
+                get_warm_start_bound_multipliers_lower(),
+                get_warm_start_bound_multipliers_upper());
+    }
 
     // Optimize!!!
     // -----------
@@ -277,6 +315,9 @@ Solution IPOPTSolver::optimize_impl(const VectorXd& guess) const {
     Solution solution;
     solution.variables = nlp->get_solution();
     solution.objective = nlp->get_optimal_objective_value();
+    solution.constraint_multipliers = nlp->get_constraint_multipliers();
+    solution.bound_multipliers_lower = nlp->get_bound_multipliers_lower();
+    solution.bound_multipliers_upper = nlp->get_bound_multipliers_upper();
     if (status == Ipopt::Solve_Succeeded
             || status == Ipopt::Solved_To_Acceptable_Level
             || status == Ipopt::Feasible_Point_Found) {
@@ -380,21 +421,52 @@ bool IPOPTSolver::TNLP::get_bounds_info(
     return true;
 }
 
+void IPOPTSolver::TNLP::set_initial_multipliers(
+        const VectorXd& constraint_multipliers,
+        const VectorXd& bound_multipliers_lower,
+        const VectorXd& bound_multipliers_upper) {
+    m_initial_constraint_multipliers = constraint_multipliers;
+    m_initial_bound_multipliers_lower = bound_multipliers_lower;
+    m_initial_bound_multipliers_upper = bound_multipliers_upper;
+}
+
 // z: multipliers for bound constraints on x.
-// warmstart will require giving initial values for the multipliers.
+// When warm-starting, IPOPT requests initial values for the multipliers
+// (init_z and init_lambda are true).
 bool IPOPTSolver::TNLP::get_starting_point(
         Index num_variables, bool init_x, Number* x,
-        bool init_z, Number* /*z_L*/, Number* /*z_U*/,
+        bool init_z, Number* z_L, Number* z_U,
         Index num_constraints, bool init_lambda,
-        Number* /*lambda*/) {
+        Number* lambda) {
     // Must this method provide initial values for x, z, lambda?
     assert(init_x == true);
-    assert(init_z == false);
-    assert(init_lambda == false);
     assert((unsigned)num_constraints == m_num_constraints);
     for (Index ivar = 0; ivar < num_variables; ++ivar) {
         x[ivar] = m_initial_guess[ivar];
     }
+    if (init_z) {
+        // If the user did not provide bound multipliers, use IPOPT's default
+        // initial value for them (the value of the bound_mult_init_val
+        // option).
+        const bool has_z = m_initial_bound_multipliers_lower.size() > 0;
+        assert(!has_z ||
+                m_initial_bound_multipliers_lower.size() == num_variables);
+        assert(!has_z ||
+                m_initial_bound_multipliers_upper.size() == num_variables);
+        for (Index ivar = 0; ivar < num_variables; ++ivar) {
+            z_L[ivar] = has_z ? m_initial_bound_multipliers_lower[ivar] : 1.0;
+            z_U[ivar] = has_z ? m_initial_bound_multipliers_upper[ivar] : 1.0;
+        }
+    }
+    if (init_lambda) {
+        const bool has_lambda = m_initial_constraint_multipliers.size() > 0;
+        assert(!has_lambda ||
+                m_initial_constraint_multipliers.size() == num_constraints);
+        for (Index icon = 0; icon < num_constraints; ++icon) {
+            lambda[icon] =
+                    has_lambda ? m_initial_constraint_multipliers[icon] : 0;
+        }
+    }
     return true;
 }
 
@@ -471,9 +543,9 @@ bool IPOPTSolver::TNLP::eval_h(
 void IPOPTSolver::TNLP::finalize_solution(Ipopt::SolverReturn /*status*/,
                                           Index num_variables,
                                           const Number* x,
-                                          const Number* /*z_L*/, const Number* /*z_U*/,
-                                          Index /*num_constraints*/,
-                                          const Number* /*g*/, const Number* /*lambda*/,
+                                          const Number* z_L, const Number* z_U,
+                                          Index num_constraints,
+                                          const Number* /*g*/, const Number* lambda,
                                           Number obj_value,
                                           const Ipopt::IpoptData* ip_data,
                                           Ipopt::IpoptCalculatedQuantities* /*ip_cq*/)
@@ -484,17 +556,20 @@ void IPOPTSolver::TNLP::finalize_solution(Ipopt::SolverReturn /*status*/,
         //printf("x[%d]: %e\n", i, x[i]);
         m_solution[i] = x[i];
     }
+    // Save the multipliers so that they can be used to warm-start a
+    // subsequent solve of a problem with the same structure.
+    m_constraint_multipliers.resize(num_constraints);
+    for (Index i = 0; i < num_constraints; ++i) {
+        m_constraint_multipliers[i] = lambda[i];
+    }
+    m_bound_multipliers_lower.resize(num_variables);
+    m_bound_multipliers_upper.resize(num_variables);
+    for (Index i = 0; i < num_variables; ++i) {
+        m_bound_multipliers_lower[i] = z_L[i];
+        m_bound_multipliers_upper[i] = z_U[i];
+    }
     m_optimal_obj_value = obj_value;
     m_num_iterations = ip_data->iter_count();
-    //printf("\nSolution of the bound multipliers, z_L and z_U\n");
-    //for (Index i = 0; i < num_variables; ++i) {
-    //    printf("z_L[%d] = %e\n", i, z_L[i]);
-    //}
-    //for (Index i = 0; i < num_variables; ++i) {
-    //    printf("z_U[%d] = %e\n", i, z_U[i]);
-    //}
-    //printf("\nObjective value\n");
-    //printf("f(x*) = %e\n", obj_value);
     // TODO also implement Ipopt's intermediate_() function.
 }
 
@@ -38,6 +38,16 @@ void ProblemDecorator::set_findiff_hessian_mode(std::string value) {
     m_findiff_hessian_mode = std::move(value);
 }
 
+void ProblemDecorator::set_findiff_parallel(int num_threads) {
+    TROPTER_VALUECHECK(num_threads >= 1, "findiff_parallel", num_threads,
+            "1 or greater");
+    m_findiff_parallel = num_threads;
+}
+
+void ProblemDecorator::set_adolc_reuse_tapes(bool value) {
+    m_adolc_reuse_tapes = value;
+}
+
 // Explicit instantiation.
 
 template class Problem<double>;
@@ -114,10 +114,35 @@ public:
     ///  - "slow": Slower mode to be used only for debugging. Each nonzero of
     ///    the Hessian of the Lagrangian is computed separately.
     void set_findiff_hessian_mode(std::string value);
+    /// The number of threads used to evaluate finite difference
+    /// perturbations of the constraint function when computing the Jacobian.
+    /// More than one thread is used only if the problem declares that its
+    /// evaluation functions are thread-safe (see
+    /// AbstractProblem::get_thread_safe_evaluation()).
+    /// (default: 1).
+    void set_findiff_parallel(int num_threads);
     /// @copydoc set_findiff_hessian_step_size()
     double get_findiff_hessian_step_size() const;
     /// @copydoc set_findiff_hessian_mode()
     const std::string& get_findiff_hessian_mode() const;
+    /// @copydoc set_findiff_parallel()
+    int get_findiff_parallel() const;
+    /// @}
+
+    /// @name Options for automatic differentiation
+    /// These options are only used when the scalar type is adouble.
+    /// @{
+
+    /// Should the ADOL-C tapes recorded by the first calc_sparsity() call be
+    /// reused by later calls (e.g., when re-solving the same problem with a
+    /// warm start)? The problem structure must not change between solves.
+    /// The tapes record the control flow taken at the taping point; reusing
+    /// them across solves makes the same assumption that replaying them
+    /// across iterates within a solve already makes.
+    /// (default: false).
+    void set_adolc_reuse_tapes(bool value);
+    /// @copydoc set_adolc_reuse_tapes()
+    bool get_adolc_reuse_tapes() const;
     /// @}
 
 protected:
@@ -128,6 +153,8 @@ private:
     int m_verbosity = 1;
     double m_findiff_hessian_step_size = 1e-5;
     std::string m_findiff_hessian_mode = "fast";
+    int m_findiff_parallel = 1;
+    bool m_adolc_reuse_tapes = false;
 };
 
 inline int ProblemDecorator::get_verbosity() const
@@ -136,6 +163,10 @@ inline double ProblemDecorator::get_findiff_hessian_step_size() const
 {   return m_findiff_hessian_step_size; }
 inline const std::string& ProblemDecorator::get_findiff_hessian_mode() const
 {   return m_findiff_hessian_mode; }
+inline int ProblemDecorator::get_findiff_parallel() const
+{   return m_findiff_parallel; }
+inline bool ProblemDecorator::get_adolc_reuse_tapes() const
+{   return m_adolc_reuse_tapes; }
 template<typename ...Types>
 inline void ProblemDecorator::print(
         const std::string& format_string, Types... args) const {
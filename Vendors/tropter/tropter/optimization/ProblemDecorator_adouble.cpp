@@ -17,6 +17,8 @@
 #include <tropter/SparsityPattern.h>
 #include <tropter/Exception.hpp>
 
+#include <chrono>
+
 #ifdef _MSC_VER
 // Ignore warnings from ADOL-C headers.
     #pragma warning(push)
@@ -33,6 +35,22 @@
 using Eigen::VectorXd;
 using Eigen::Ref;
 
+namespace {
+/// Accumulates the elapsed wall time into the provided total when destructed.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(double& total) : m_total(total),
+            m_start(std::chrono::high_resolution_clock::now()) {}
+    ~ScopedTimer() {
+        m_total += std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - m_start).count();
+    }
+private:
+    double& m_total;
+    std::chrono::high_resolution_clock::time_point m_start;
+};
+} // namespace
+
 namespace tropter {
 namespace optimization {
 
@@ -58,6 +76,11 @@ Problem<adouble>::Decorator::Decorator(
 }
 
 Problem<adouble>::Decorator::~Decorator() {
+    if (m_num_replays) {
+        print("ADOL-C timing: %g seconds taping; %g seconds replaying tapes "
+                "(%i driver calls).",
+                m_tape_time, m_replay_time, m_num_replays);
+    }
     if (m_jacobian_row_indices) {
         delete [] m_jacobian_row_indices;
         m_jacobian_row_indices = nullptr;
@@ -89,6 +112,22 @@ calc_sparsity(const Eigen::VectorXd& x,
     // This function also creates the ADOL-C tapes that are used in the other
     // function calls.
 
+    // If requested, reuse the tapes (and sparsity patterns) recorded by a
+    // previous call; see set_adolc_reuse_tapes(). Replaying an existing tape
+    // at new variables is exactly what the calc_* functions below do on every
+    // iteration within a solve, so this is safe as long as the problem
+    // structure has not changed between solves.
+    if (get_adolc_reuse_tapes() && m_tapes_created &&
+            (!provide_hessian_sparsity || m_hessian_taped)) {
+        print("Reusing ADOL-C tapes from a previous calc_sparsity() call.");
+        jacobian_sparsity = m_cached_jacobian_sparsity;
+        if (provide_hessian_sparsity)
+            hessian_sparsity = m_cached_hessian_sparsity;
+        return;
+    }
+
+    const auto tape_start = std::chrono::high_resolution_clock::now();
+
     // Objective.
     // ----------
     {
@@ -176,6 +215,19 @@ calc_sparsity(const Eigen::VectorXd& x,
         //        hessian_sparsity.row, hessian_sparsity.col);
         //hes_sparsity.write("DEBUG_adolc_hessian_lagrangian_sparsity.csv");
     }
+
+    const double tape_duration = std::chrono::duration<double>(
+            std::chrono::high_resolution_clock::now() - tape_start).count();
+    m_tape_time += tape_duration;
+    print("Recorded ADOL-C tapes in %g seconds.", tape_duration);
+
+    // Cache the sparsity patterns so the tapes can be reused.
+    m_tapes_created = true;
+    m_cached_jacobian_sparsity = jacobian_sparsity;
+    if (provide_hessian_sparsity) {
+        m_hessian_taped = true;
+        m_cached_hessian_sparsity = hessian_sparsity;
+    }
 }
 
 void Problem<adouble>::Decorator::
@@ -183,6 +235,8 @@ calc_objective(unsigned num_variables, const double* x,
         bool /*new_x*/,
         double& obj_value) const
 {
+    ScopedTimer timer(m_replay_time);
+    ++m_num_replays;
     int status = ::function(m_objective_tag,
             1, // number of dependent variables.
             num_variables, // number of independent variables.
@@ -202,6 +256,8 @@ calc_constraints(unsigned num_variables, const double* variables,
         unsigned num_constraints, double* constr) const
 {
     // Evaluate the constraints tape.
+    ScopedTimer timer(m_replay_time);
+    ++m_num_replays;
     int status = ::function(m_constraints_tag,
             num_constraints, // number of dependent variables.
             num_variables, // number of independent variables.
@@ -216,6 +272,8 @@ void Problem<adouble>::Decorator::
 calc_gradient(unsigned num_variables, const double* x, bool /*new_x*/,
         double* grad) const
 {
+    ScopedTimer timer(m_replay_time);
+    ++m_num_replays;
     int status = ::gradient(m_objective_tag, num_variables, x, grad);
     assert(status); // TODO error codes can be -2,-1,0,1,2,3; improve assert!
 }
@@ -224,6 +282,8 @@ void Problem<adouble>::Decorator::
 calc_jacobian(unsigned num_variables, const double* x, bool /*new_x*/,
         unsigned /*num_nonzeros*/, double* jacobian_values) const
 {
+    ScopedTimer timer(m_replay_time);
+    ++m_num_replays;
     int repeated_call = 1; // We already have the sparsity structure.
     int status = ::sparse_jac(m_constraints_tag, get_num_constraints(),
             num_variables, repeated_call, x,
@@ -247,6 +307,8 @@ calc_hessian_lagrangian(unsigned num_variables, const double* x,
 {
     // TODO if not new_x, then do NOT re-eval objective()!!!
 
+    ScopedTimer timer(m_replay_time);
+    ++m_num_replays;
     int repeated_call = 1;
     // http://list.coin-or.org/pipermail/adol-c/2013-April/000900.html
     // TODO "since lambda changes, the Lagrangian function has to be
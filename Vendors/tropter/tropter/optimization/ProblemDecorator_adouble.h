@@ -19,9 +19,9 @@
 #include "Problem.h"
 #include "ProblemDecorator.h"
 
-namespace tropter {
+#include <tropter/SparsityPattern.h>
 
-struct SparsityCoordinates;
+namespace tropter {
 
 namespace optimization {
 
@@ -55,6 +55,15 @@ public:
             const double* variables, bool new_variables, double obj_factor,
             unsigned num_constraints, const double* lambda, bool new_lambda,
             unsigned num_nonzeros, double* nonzeros) const override;
+    /// Total time, in seconds, spent recording ADOL-C tapes in
+    /// calc_sparsity().
+    double get_tape_time() const { return m_tape_time; }
+    /// Total time, in seconds, spent replaying the tapes in calc_objective(),
+    /// calc_constraints(), calc_gradient(), calc_jacobian(), and
+    /// calc_hessian_lagrangian().
+    double get_replay_time() const { return m_replay_time; }
+    /// Number of tape replays included in get_replay_time().
+    int get_num_replays() const { return m_num_replays; }
 private:
     void trace_objective(short int tag,
             unsigned num_variables, const double* variables,
@@ -93,6 +102,16 @@ private:
     // Working memory for lambda multipliers and the "obj_factor."
     mutable std::vector<double> m_hessian_obj_factor_lambda;
     std::vector<int> m_sparse_hess_options;
+
+    // Tape reuse (see set_adolc_reuse_tapes()) and instrumentation.
+    // -------------------------------------------------------------
+    mutable bool m_tapes_created = false;
+    mutable bool m_hessian_taped = false;
+    mutable SparsityCoordinates m_cached_jacobian_sparsity;
+    mutable SparsityCoordinates m_cached_hessian_sparsity;
+    mutable double m_tape_time = 0;
+    mutable double m_replay_time = 0;
+    mutable int m_num_replays = 0;
 };
 
 } // namespace optimization
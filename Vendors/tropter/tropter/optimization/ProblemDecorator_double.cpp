@@ -17,6 +17,9 @@
 #include <tropter/Exception.hpp>
 #include "internal/GraphColoring.h"
 
+#include <algorithm>
+#include <thread>
+
 //#if defined(TROPTER_WITH_OPENMP) && _OPENMP
 //    // TODO only include ifdef _OPENMP
 //    #include <omp.h>
@@ -273,18 +276,48 @@ calc_jacobian(unsigned num_variables, const double* variables, bool /*new_x*/,
     Eigen::Map<const VectorXd> x0(variables, num_variables);
 
     // Compute the dense "compressed Jacobian" using the directions ColPack
-    // told us to use.
-    // TODO for OpenMP: Trapezoidal has working memory!
-    //#pragma omp parallel for firstprivate(m_constr_pos, m_constr_neg)
-    for (Eigen::Index iseed = 0; iseed < num_seeds; ++iseed) {
-        const auto direction = seed.col(iseed);
-        // Perturb x in the positive direction.
-        m_problem.calc_constraints(x0 + eps * direction, m_constr_pos);
-        // Perturb x in the negative direction.
-        m_problem.calc_constraints(x0 - eps * direction, m_constr_neg);
-        // Compute central difference.
-        m_jacobian_compressed.col(iseed) =
-                (m_constr_pos - m_constr_neg) / two_eps;
+    // told us to use. The graph coloring already fused perturbations of
+    // structurally independent variables into single seeds; the remaining
+    // seeds are independent of each other and can be evaluated concurrently
+    // if the problem permits concurrent evaluation.
+    const int num_threads = std::min<int>(get_findiff_parallel(),
+            (int)num_seeds);
+    if (num_threads > 1 && m_problem.get_thread_safe_evaluation()) {
+        auto evaluate_seeds = [&](Eigen::Index ifirst, Eigen::Index ilast) {
+            // Per-thread working memory.
+            VectorXd constr_pos = VectorXd::Zero(m_constr_pos.size());
+            VectorXd constr_neg = VectorXd::Zero(m_constr_neg.size());
+            for (Eigen::Index iseed = ifirst; iseed < ilast; ++iseed) {
+                const auto direction = seed.col(iseed);
+                m_problem.calc_constraints(x0 + eps * direction, constr_pos);
+                m_problem.calc_constraints(x0 - eps * direction, constr_neg);
+                // Threads write to disjoint columns.
+                m_jacobian_compressed.col(iseed) =
+                        (constr_pos - constr_neg) / two_eps;
+            }
+        };
+        std::vector<std::thread> threads;
+        const Eigen::Index chunk = num_seeds / num_threads;
+        const Eigen::Index remainder = num_seeds % num_threads;
+        Eigen::Index ifirst = 0;
+        for (int ithread = 0; ithread < num_threads; ++ithread) {
+            const Eigen::Index ilast =
+                    ifirst + chunk + (ithread < remainder ? 1 : 0);
+            threads.emplace_back(evaluate_seeds, ifirst, ilast);
+            ifirst = ilast;
+        }
+        for (auto& thread : threads) thread.join();
+    } else {
+        for (Eigen::Index iseed = 0; iseed < num_seeds; ++iseed) {
+            const auto direction = seed.col(iseed);
+            // Perturb x in the positive direction.
+            m_problem.calc_constraints(x0 + eps * direction, m_constr_pos);
+            // Perturb x in the negative direction.
+            m_problem.calc_constraints(x0 - eps * direction, m_constr_neg);
+            // Compute central difference.
+            m_jacobian_compressed.col(iseed) =
+                    (m_constr_pos - m_constr_neg) / two_eps;
+        }
     }
 
     m_jacobian_coloring->recover(m_jacobian_compressed, jacobian_values);
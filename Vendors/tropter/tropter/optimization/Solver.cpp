@@ -83,9 +83,57 @@ const std::string& Solver::get_sparsity_detection() const {
     return m_sparsity_detection;
 }
 
+void Solver::set_warm_start(bool v) {
+    m_warm_start = v;
+}
+bool Solver::get_warm_start() const {
+    return m_warm_start;
+}
+void Solver::set_warm_start_multipliers(
+        Eigen::VectorXd constraint_multipliers,
+        Eigen::VectorXd bound_multipliers_lower,
+        Eigen::VectorXd bound_multipliers_upper) {
+    TROPTER_THROW_IF(constraint_multipliers.size() &&
+            constraint_multipliers.size() !=
+                    (int)m_problem->get_num_constraints(),
+            "Expected constraint_multipliers to have %i element(s), but it "
+            "has %i.",
+            m_problem->get_num_constraints(), constraint_multipliers.size());
+    TROPTER_THROW_IF(bound_multipliers_lower.size() &&
+            bound_multipliers_lower.size() !=
+                    (int)m_problem->get_num_variables(),
+            "Expected bound_multipliers_lower to have %i element(s), but it "
+            "has %i.",
+            m_problem->get_num_variables(), bound_multipliers_lower.size());
+    TROPTER_THROW_IF(bound_multipliers_upper.size() &&
+            bound_multipliers_upper.size() !=
+                    (int)m_problem->get_num_variables(),
+            "Expected bound_multipliers_upper to have %i element(s), but it "
+            "has %i.",
+            m_problem->get_num_variables(), bound_multipliers_upper.size());
+    m_warm_start_constraint_multipliers = std::move(constraint_multipliers);
+    m_warm_start_bound_multipliers_lower = std::move(bound_multipliers_lower);
+    m_warm_start_bound_multipliers_upper = std::move(bound_multipliers_upper);
+}
+const Eigen::VectorXd& Solver::get_warm_start_constraint_multipliers() const {
+    return m_warm_start_constraint_multipliers;
+}
+const Eigen::VectorXd& Solver::get_warm_start_bound_multipliers_lower() const {
+    return m_warm_start_bound_multipliers_lower;
+}
+const Eigen::VectorXd& Solver::get_warm_start_bound_multipliers_upper() const {
+    return m_warm_start_bound_multipliers_upper;
+}
+
 void Solver::set_findiff_hessian_mode(std::string v) {
     m_problem->set_findiff_hessian_mode(std::move(v));
 }
+void Solver::set_findiff_parallel(int num_threads) {
+    m_problem->set_findiff_parallel(num_threads);
+}
+void Solver::set_adolc_reuse_tapes(bool value) {
+    m_problem->set_adolc_reuse_tapes(value);
+}
 void Solver::set_findiff_hessian_step_size(double v) {
     m_problem->set_findiff_hessian_step_size(v);
 }
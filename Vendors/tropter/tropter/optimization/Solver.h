@@ -35,6 +35,15 @@ class ProblemDecorator;
 struct Solution {
     Eigen::VectorXd variables;
     double objective = std::numeric_limits<double>::quiet_NaN();
+    /// Lagrange multipliers for the constraints at the solution. Empty if the
+    /// solver does not report multipliers.
+    Eigen::VectorXd constraint_multipliers;
+    /// Multipliers for the variables' lower bounds at the solution. Empty if
+    /// the solver does not report multipliers.
+    Eigen::VectorXd bound_multipliers_lower;
+    /// Multipliers for the variables' upper bounds at the solution. Empty if
+    /// the solver does not report multipliers.
+    Eigen::VectorXd bound_multipliers_upper;
     bool success = false;
     /// Number of solver iterations at which this solution was obtained.
     int num_iterations = -1;
@@ -104,6 +113,30 @@ public:
     void set_findiff_hessian_mode(std::string v);
     /// @copydoc ProblemDecorator::set_findiff_hessian_step_size()
     void set_findiff_hessian_step_size(double value);
+    /// @copydoc ProblemDecorator::set_findiff_parallel()
+    void set_findiff_parallel(int num_threads);
+    /// @copydoc ProblemDecorator::set_adolc_reuse_tapes()
+    void set_adolc_reuse_tapes(bool value);
+
+    /// Should the solver start from the provided guess (and multipliers, if
+    /// provided via set_warm_start_multipliers()) rather than pushing the
+    /// initial point towards the interior of the variable bounds? Enable this
+    /// when re-solving a problem whose structure has not changed (e.g., each
+    /// step of a continuation sweep) so that the solver does not re-discover
+    /// the active set from scratch.
+    /// @note This setting currently takes effect only when using IPOPT.
+    void set_warm_start(bool v);
+    /// Initial values for the constraint multipliers and the multipliers for
+    /// the variables' lower and upper bounds; obtain these from the Solution
+    /// of a previous optimization of a problem with the same structure.
+    /// Pass empty vectors to clear the multiplier guess, in which case the
+    /// solver initializes the multipliers itself.
+    /// These values are used only if warm starting is enabled via
+    /// set_warm_start().
+    /// @note This setting currently takes effect only when using IPOPT.
+    void set_warm_start_multipliers(Eigen::VectorXd constraint_multipliers,
+            Eigen::VectorXd bound_multipliers_lower,
+            Eigen::VectorXd bound_multipliers_upper);
     /// @}
 
     /// @name Set solver-specific advanced options.
@@ -146,6 +179,14 @@ public:
     /// @copydoc set_hessian_approximation()
     Optional<std::string> get_hessian_approximation() const;
     const std::string& get_sparsity_detection() const;
+    /// @copydoc set_warm_start()
+    bool get_warm_start() const;
+    /// @copydoc set_warm_start_multipliers()
+    const Eigen::VectorXd& get_warm_start_constraint_multipliers() const;
+    /// @copydoc set_warm_start_multipliers()
+    const Eigen::VectorXd& get_warm_start_bound_multipliers_lower() const;
+    /// @copydoc set_warm_start_multipliers()
+    const Eigen::VectorXd& get_warm_start_bound_multipliers_upper() const;
     /// @}
 
 protected:
@@ -193,6 +234,10 @@ private:
     std::string m_jacobian_approximation = "exact";
     Optional<std::string> m_hessian_approximation;
     std::string m_sparsity_detection = "initial-guess";
+    bool m_warm_start = false;
+    Eigen::VectorXd m_warm_start_constraint_multipliers;
+    Eigen::VectorXd m_warm_start_bound_multipliers_lower;
+    Eigen::VectorXd m_warm_start_bound_multipliers_upper;
 
     OptionsMap<std::string> m_advanced_options_string;
     OptionsMap<int> m_advanced_options_int;